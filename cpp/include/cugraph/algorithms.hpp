@@ -17,9 +17,12 @@
 
 #include <cugraph/api_helpers.hpp>
 
+#include <cugraph/contraction_hierarchy.hpp>
 #include <cugraph/dendrogram.hpp>
 #include <cugraph/graph.hpp>
 #include <cugraph/graph_view.hpp>
+#include <cugraph/minhash_index.hpp>
+#include <cugraph/propagation_blocking.hpp>
 
 #include <cugraph/legacy/graph.hpp>
 #include <cugraph/legacy/internals.hpp>
@@ -32,6 +35,11 @@
 #include <raft/random/rng_state.hpp>
 #include <raft/span.hpp>
 
+#include <array>
+#include <limits>
+#include <tuple>
+#include <vector>
+
 /** @ingroup cpp_api
  *  @{
  */
@@ -138,6 +146,102 @@ void overlap_list(legacy::GraphCSRView<VT, ET, WT> const& graph,
                   VT const* second,
                   WT* result);
 
+/**
+ * @brief Build a MinHash index to estimate Jaccard similarity coefficients.
+ *
+ * Computes a signature of @p num_hashes hash values for the out-neighborhood of every vertex. The
+ * index is built once (with one pass over the edges per four hash functions) and answers Jaccard
+ * similarity queries in O(@p num_hashes) time per vertex pair without accessing the graph. The
+ * standard error of an estimate is sqrt(J * (1 - J) / @p num_hashes) for a Jaccard similarity J.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param num_hashes Signature length, should be a positive multiple of 4.
+ * @param seed Seed of the hash functions.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return MinHash index of the input graph.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+minhash_index_t<vertex_t> build_minhash_index(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, false> const& graph_view,
+  size_t num_hashes       = 128,
+  uint64_t seed           = 0,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Estimate Jaccard similarity coefficients of vertex pairs using a MinHash index.
+ *
+ * The estimate for a pair is the fraction of the signature values the two vertices agree on. The
+ * estimate is 0 if either vertex has no neighbors.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam result_t Type of the estimates. Needs to be a floating point type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param index MinHash index built by build_minhash_index.
+ * @param first First vertex of each pair.
+ * @param second Second vertex of each pair.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Estimated Jaccard similarity coefficient of each pair.
+ */
+template <typename vertex_t, typename result_t>
+rmm::device_uvector<result_t> minhash_jaccard_coefficients(
+  raft::handle_t const& handle,
+  minhash_index_t<vertex_t> const& index,
+  raft::device_span<vertex_t const> first,
+  raft::device_span<vertex_t const> second,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Find the vertex pairs with high estimated Jaccard similarity using locality sensitive
+ * hashing.
+ *
+ * Signatures are split into @p num_bands bands, and two vertices become a candidate pair if they
+ * agree on all the signature values of at least one band. This finds the similar pairs without
+ * enumerating two-hop neighborhoods: a pair with Jaccard similarity J becomes a candidate with
+ * probability 1 - (1 - J^r)^@p num_bands, where r = num_hashes / @p num_bands. Candidates with an
+ * estimated Jaccard similarity below @p threshold are discarded. More bands find more of the
+ * pairs with similarity near @p threshold at the cost of more candidates. A pair is materialized
+ * only in the first band its vertices agree on. Buckets of vertices sharing popular signature
+ * values can be large; a vertex is paired with at most @p max_bucket_size - 1 vertices following
+ * it (in vertex ID order) in its bucket, so a band produces at most V * (@p max_bucket_size - 1)
+ * candidates for V vertices (pairs in large buckets may be missed).
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam result_t Type of the estimates. Needs to be a floating point type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param index MinHash index built by build_minhash_index.
+ * @param num_bands Number of bands, the signature length should be a multiple of @p num_bands.
+ * @param threshold Minimum estimated Jaccard similarity coefficient of the returned pairs.
+ * @param max_bucket_size Maximum number of vertices in a bucket paired with each other, should be
+ * at least 2 (no limit by default).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the first vertices (smaller IDs), the second vertices (larger IDs), and the
+ * estimated Jaccard similarity coefficients of the pairs found, sorted by vertex pair.
+ */
+template <typename vertex_t, typename result_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<result_t>>
+minhash_similar_pairs(raft::handle_t const& handle,
+                      minhash_index_t<vertex_t> const& index,
+                      size_t num_bands,
+                      result_t threshold,
+                      size_t max_bucket_size  = std::numeric_limits<size_t>::max(),
+                      bool do_expensive_check = false);
+
 /**
  *
  * @brief                                       ForceAtlas2 is a continuous graph layout algorithm
@@ -1028,6 +1132,68 @@ void bfs(raft::handle_t const& handle,
          vertex_t depth_limit      = std::numeric_limits<vertex_t>::max(),
          bool do_expensive_check   = false);
 
+/**
+ * @brief Run a batch of independent single-source breadth-first searches together.
+ *
+ * Request i starts from @p sources[i] and visits the vertices within (*@p depth_limits)[i] (or @p
+ * depth_limit if @p depth_limits is std::nullopt) hops. All
+ * the requests share a single (vertex, request) tagged frontier, so every hop of every request is
+ * processed by one pass over the graph instead of one pass (and one set of vertex-sized arrays)
+ * per request. This is suited to many small (e.g. depth-limited) traversals; use bfs() for a
+ * single traversal covering a large fraction of the graph.
+ *
+ * Only the vertices reached by a request are returned, packed request by request. Traversal state
+ * is kept per visited (vertex, request) pair, so the cost scales with the number of vertices
+ * visited rather than with the number of vertices in the graph. A request can additionally stop
+ * early once it reaches its target vertex or exhausts its vertex or edge budget; the vertices
+ * visited up to (and including) the hop where this happens are returned.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param sources Source vertex of each request. In a multi-gpu context the source vertices need not
+ * be local to this GPU, the results of the requests submitted by this GPU are returned to this GPU.
+ * @param depth_limits Optional maximum number of hops of each request (size should coincide with
+ * the size of @p sources).
+ * @param depth_limit Maximum number of hops of every request (used if @p depth_limits is
+ * std::nullopt).
+ * @param compute_predecessors A flag to compute the predecessor of each reached vertex as well.
+ * @param targets Optional target vertex of each request (size should coincide with the size of @p
+ * sources), a request stops expanding after visiting its target. Set to invalid_vertex_id for
+ * requests without a target.
+ * @param vertex_budget Optional maximum number of vertices to visit per request, a request stops
+ * expanding once it has visited at least this many vertices.
+ * @param edge_budget Optional maximum number of edges to examine per request, a request stops
+ * expanding once it has examined at least this many edges.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of request offsets (size = @p sources.size() + 1, the results of request i are
+ * stored in [offsets[i], offsets[i + 1])), reached vertices (sorted within each request), distances
+ * of the reached vertices, and predecessors of the reached vertices (empty if @p
+ * compute_predecessors is false, invalid_vertex_id for the sources).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>>
+bfs_batched(raft::handle_t const& handle,
+            graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+            raft::device_span<vertex_t const> sources,
+            std::optional<raft::device_span<vertex_t const>> depth_limits,
+            vertex_t depth_limit,
+            bool compute_predecessors,
+            std::optional<raft::device_span<vertex_t const>> targets = std::nullopt,
+            std::optional<size_t> vertex_budget                      = std::nullopt,
+            std::optional<size_t> edge_budget                        = std::nullopt,
+            bool do_expensive_check                                  = false);
+
 /**
  * @brief Extract paths from breadth-first search output
  *
@@ -1101,6 +1267,326 @@ void sssp(raft::handle_t const& handle,
           weight_t cutoff         = std::numeric_limits<weight_t>::max(),
           bool do_expensive_check = false);
 
+/**
+ * @brief Run single-source shortest-path on the host with multiple threads.
+ *
+ * Same inputs and outputs as sssp, but the graph is copied to host memory and the distances (and
+ * predecessors) are computed with a multithreaded delta-stepping (per-thread buckets, work stealing
+ * within the current bucket, and separate light and heavy edge relaxation). The distances match the
+ * device implementation. Among equally short paths, the predecessor is the smallest vertex ID
+ * reaching the final distance in the relaxation round that set it, so the output does not depend
+ * on the number of threads.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param distances Pointer to the output distance array (device memory).
+ * @param predecessors Pointer to the output predecessor array (device memory) or `nullptr`.
+ * @param source_vertex Source vertex to start single-source shortest-path.
+ * @param cutoff Single-source shortest-path terminates if no more vertices are reachable within the
+ * distance of @p cutoff. Any vertex farther than @p cutoff will be marked as unreachable.
+ * @param num_threads Number of host threads to use, 0 to use std::thread::hardware_concurrency().
+ * @param numa_aware If true, pin the threads to the NUMA nodes in contiguous groups, place each
+ * thread's vertex range of the CSR on its node (first touch), and steal work within a node before
+ * stealing across nodes. Has no effect on hosts with a single NUMA node.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+void host_sssp(raft::handle_t const& handle,
+               graph_view_t<vertex_t, edge_t, weight_t, false, false> const& graph_view,
+               weight_t* distances,
+               vertex_t* predecessors,
+               vertex_t source_vertex,
+               weight_t cutoff         = std::numeric_limits<weight_t>::max(),
+               size_t num_threads      = 0,
+               bool numa_aware         = true,
+               bool do_expensive_check = false);
+
+/**
+ * @brief Run single-source shortest-path on a host CSR with multiple threads.
+ *
+ * Same algorithm as the graph view overload of host_sssp, for graphs already in host memory (no
+ * device memory is used).
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param offsets CSR offsets (host memory, size = number of vertices + 1).
+ * @param indices CSR indices (host memory, size = number of edges).
+ * @param weights CSR edge weights (host memory, size = number of edges).
+ * @param distances Pointer to the output distance array (host memory).
+ * @param predecessors Pointer to the output predecessor array (host memory) or `nullptr`.
+ * @param source_vertex Source vertex to start single-source shortest-path.
+ * @param cutoff Single-source shortest-path terminates if no more vertices are reachable within the
+ * distance of @p cutoff. Any vertex farther than @p cutoff will be marked as unreachable.
+ * @param num_threads Number of host threads to use, 0 to use std::thread::hardware_concurrency().
+ * @param numa_aware If true, pin the threads to the NUMA nodes in contiguous groups, place each
+ * thread's vertex range of the CSR on its node (first touch), and steal work within a node before
+ * stealing across nodes. Has no effect on hosts with a single NUMA node.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+void host_sssp(raft::host_span<edge_t const> offsets,
+               raft::host_span<vertex_t const> indices,
+               raft::host_span<weight_t const> weights,
+               weight_t* distances,
+               vertex_t* predecessors,
+               vertex_t source_vertex,
+               weight_t cutoff         = std::numeric_limits<weight_t>::max(),
+               size_t num_threads      = 0,
+               bool numa_aware         = true,
+               bool do_expensive_check = false);
+
+/**
+ * @brief Compute the shortest path between each (source, target) pair.
+ *
+ * Unlike sssp, each search stops expanding a vertex once its distance plus its heuristic value
+ * cannot improve the best distance found to the target, so only the part of the graph between the
+ * source and the target is explored. Every pair (submitted by any GPU) is searched at the same
+ * time, the number of iterations is set by the longest search and not by the number of pairs. If
+ * @p heuristics is provided, the search is goal-directed (A*), the heuristic values should be
+ * admissible (a lower bound of the distance from the vertex to every target in the batch, e.g. a
+ * coordinate based distance) for the returned paths to be shortest paths. Graph edge weights should
+ * be non-negative.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param sources Source vertex of each pair. In a multi-gpu context, each GPU can submit its own
+ * pairs, the sources need not be local to this GPU.
+ * @param targets Target vertex of each pair (size should coincide with @p sources).
+ * @param heuristics Optional pointer to the heuristic value of each local vertex (size should
+ * coincide with graph_view.local_vertex_partition_range_size()). If std::nullopt, every heuristic
+ * value is 0.
+ * @param cutoff Vertices farther than @p cutoff from the source are not explored, a target farther
+ * than @p cutoff is marked as unreachable.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of path offsets (size = sources.size() + 1, the path of pair i is stored in
+ * [offsets[i], offsets[i + 1])), path vertices (from the source to the target, empty if the target
+ * is unreachable) and the distance from the source to each path vertex, for the pairs submitted by
+ * this GPU.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+point_to_point_shortest_paths(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  raft::device_span<vertex_t const> sources,
+  raft::device_span<vertex_t const> targets,
+  std::optional<weight_t const*> heuristics = std::nullopt,
+  weight_t cutoff                           = std::numeric_limits<weight_t>::max(),
+  bool do_expensive_check                   = false);
+
+/**
+ * @brief Compute the shortest path between each (source, target) pair with a heuristic per target.
+ *
+ * Same as the point_to_point_shortest_paths overload taking a heuristic value per vertex, but the
+ * heuristic value of a vertex is specific to the target of the pair, so the values need to be
+ * admissible only for their own target.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param sources Source vertex of each pair. In a multi-gpu context, each GPU can submit its own
+ * pairs, the sources need not be local to this GPU.
+ * @param targets Target vertex of each pair (size should coincide with @p sources).
+ * @param heuristic_targets Sorted unique targets with heuristic values (should be identical in
+ * every GPU in a multi-gpu context). The heuristic values toward the targets not in this list are
+ * 0.
+ * @param heuristics Heuristic value of each local vertex toward each target in @p
+ * heuristic_targets, the values toward heuristic_targets[i] are stored in [i *
+ * graph_view.local_vertex_partition_range_size(), (i + 1) *
+ * graph_view.local_vertex_partition_range_size()).
+ * @param cutoff Vertices farther than @p cutoff from the source are not explored, a target farther
+ * than @p cutoff is marked as unreachable.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of path offsets (size = sources.size() + 1, the path of pair i is stored in
+ * [offsets[i], offsets[i + 1])), path vertices (from the source to the target, empty if the target
+ * is unreachable) and the distance from the source to each path vertex, for the pairs submitted by
+ * this GPU.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+point_to_point_shortest_paths(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  raft::device_span<vertex_t const> sources,
+  raft::device_span<vertex_t const> targets,
+  raft::device_span<vertex_t const> heuristic_targets,
+  raft::device_span<weight_t const> heuristics,
+  weight_t cutoff         = std::numeric_limits<weight_t>::max(),
+  bool do_expensive_check = false);
+
+/**
+ * @brief Compute the shortest path between each (source, target) pair searching from both ends.
+ *
+ * Same as the point_to_point_shortest_paths overload taking a heuristic value per vertex, but the
+ * targets are searched backward (over the incoming edges stored in @p transposed_graph_view) at the
+ * same time as the sources are searched forward, and a pair stops once no path through the vertices
+ * still queued in both searches can be shorter than the best path found. This explores roughly half
+ * the radius of a unidirectional search. Keep both storage orientations of a graph (e.g.
+ * keep_both_orientations in the C API) to avoid re-building the transposed graph per call.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param transposed_graph_view Graph view object of the same graph in the transposed storage
+ * orientation, its vertex IDs can differ from the @p graph_view vertex IDs (e.g. if the two are
+ * renumbered separately).
+ * @param transposed_graph_vertex_ids @p graph_view vertex ID of each local vertex of @p
+ * transposed_graph_view (size should coincide with
+ * transposed_graph_view.local_vertex_partition_range_size()).
+ * @param sources Source vertex of each pair (in @p graph_view vertex IDs). In a multi-gpu context,
+ * each GPU can submit its own pairs, the sources need not be local to this GPU.
+ * @param targets Target vertex of each pair (in @p graph_view vertex IDs, size should coincide with
+ * @p sources).
+ * @param heuristics Optional pointer to the heuristic value of each local vertex of @p graph_view
+ * (size should coincide with graph_view.local_vertex_partition_range_size()), used by the forward
+ * search only. If std::nullopt, every heuristic value is 0.
+ * @param cutoff Vertices farther than @p cutoff from the source are not explored, a target farther
+ * than @p cutoff is marked as unreachable.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of path offsets (size = sources.size() + 1, the path of pair i is stored in
+ * [offsets[i], offsets[i + 1])), path vertices (in @p graph_view vertex IDs, from the source to the
+ * target, empty if the target is unreachable) and the distance from the source to each path vertex,
+ * for the pairs submitted by this GPU.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+point_to_point_shortest_paths(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const& transposed_graph_view,
+  raft::device_span<vertex_t const> transposed_graph_vertex_ids,
+  raft::device_span<vertex_t const> sources,
+  raft::device_span<vertex_t const> targets,
+  std::optional<weight_t const*> heuristics = std::nullopt,
+  weight_t cutoff                           = std::numeric_limits<weight_t>::max(),
+  bool do_expensive_check                   = false);
+
+/**
+ * @brief Build a contraction hierarchy to answer repeated shortest path distance queries.
+ *
+ * Vertices are contracted in levels, each level is an independent set of the remaining graph
+ * selected by edge difference (shortcuts added minus edges removed) and the number of already
+ * contracted neighbors. Contracting a vertex inserts a shortcut between each pair of its remaining
+ * in-neighbor and out-neighbor unless a witness search (a hop-limited search in the remaining graph
+ * avoiding the vertices contracted in the level) finds a path as short. The vertex each shortcut
+ * bypasses is recorded to unpack paths. Graph edge weights should be non-negative.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Contraction hierarchy of the input graph.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+contraction_hierarchy_t<vertex_t, edge_t, weight_t> build_contraction_hierarchy(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, false> const& graph_view,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Compute shortest path distances using a contraction hierarchy.
+ *
+ * Each distance is computed by an upward search from the source and an upward search from the
+ * target (in the reversed downward graph), both searches only visit vertices of higher contraction
+ * levels, so a query explores a small fraction of the graph. All the queries are processed in a
+ * batch.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param hierarchy Contraction hierarchy built by build_contraction_hierarchy.
+ * @param sources Source vertex of each query, or a single source for one-to-many queries.
+ * @param targets Target vertex of each query.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Distance from the source to the target of each query
+ * (std::numeric_limits<weight_t>::max() if the target is unreachable).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+rmm::device_uvector<weight_t> contraction_hierarchy_distances(
+  raft::handle_t const& handle,
+  contraction_hierarchy_t<vertex_t, edge_t, weight_t> const& hierarchy,
+  raft::device_span<vertex_t const> sources,
+  raft::device_span<vertex_t const> targets,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Compute shortest paths using a contraction hierarchy.
+ *
+ * The path of each query in the hierarchy is found as in contraction_hierarchy_distances, then the
+ * shortcuts on the paths are recursively replaced by the two edges they bypass. All the queries
+ * are processed in a batch.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param hierarchy Contraction hierarchy built by build_contraction_hierarchy.
+ * @param sources Source vertex of each query, or a single source for one-to-many queries.
+ * @param targets Target vertex of each query.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of path offsets (size = targets.size() + 1, the path of query i is stored in
+ * [offsets[i], offsets[i + 1])), path vertices in the input graph (from the source to the target,
+ * empty if the target is unreachable) and the distance from the source to each path vertex.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+contraction_hierarchy_paths(raft::handle_t const& handle,
+                            contraction_hierarchy_t<vertex_t, edge_t, weight_t> const& hierarchy,
+                            raft::device_span<vertex_t const> sources,
+                            raft::device_span<vertex_t const> targets,
+                            bool do_expensive_check = false);
+
 /**
  * @brief Compute PageRank scores.
  *
@@ -1156,6 +1642,59 @@ void pagerank(raft::handle_t const& handle,
               bool has_initial_guess  = false,
               bool do_expensive_check = false);
 
+/**
+ * @brief Compute PageRank scores walking edges binned by destination vertex block.
+ *
+ * Same as the pagerank function above, but every iteration runs the edge pass in two phases over
+ * @p blocking (propagation blocking) instead of gathering the edge contributions over the
+ * compressed sparse graph. The binning phase walks the edges in source order and writes each
+ * contribution to the bin of its destination vertex block, the accumulation phase reduces each bin
+ * into its block of PageRank values in shared memory (no global atomics). This improves the memory
+ * locality of the edge pass on graphs whose vertex values do not fit in the cache. @p blocking can
+ * be reused across calls on the same graph.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments or if fails to converge before @p
+ * max_iterations.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of PageRank scores.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param blocking Edges of @p graph_view binned by destination vertex block, built by
+ * build_propagation_blocking<result_t>.
+ * @param precomputed_vertex_out_weight_sums Pointer to an array storing sums of out-going edge
+ * weights for the vertices (for re-use) or `std::nullopt`.
+ * @param personalization_vertices Pointer to an array storing personalization vertex identifiers
+ * (compute personalized PageRank) or `std::nullopt` (compute general PageRank).
+ * @param personalization_values Pointer to an array storing personalization values for the vertices
+ * in the personalization set. Relevant only if @p personalization_vertices is not `std::nullopt`.
+ * @param personalization_vector_size Size of the personalization set.
+ * @param pageranks Pointer to the output PageRank score array.
+ * @param alpha PageRank damping factor.
+ * @param epsilon Error tolerance to check convergence.
+ * @param max_iterations Maximum number of PageRank iterations.
+ * @param has_initial_guess If set to `true`, values in the PageRank output array (pointed by @p
+ * pageranks) is used as initial PageRank values.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+void pagerank(raft::handle_t const& handle,
+              graph_view_t<vertex_t, edge_t, weight_t, true, false> const& graph_view,
+              propagation_blocking_t<vertex_t, edge_t, weight_t> const& blocking,
+              std::optional<weight_t const*> precomputed_vertex_out_weight_sums,
+              std::optional<vertex_t const*> personalization_vertices,
+              std::optional<result_t const*> personalization_values,
+              std::optional<vertex_t> personalization_vector_size,
+              result_t* pageranks,
+              result_t alpha,
+              result_t epsilon,
+              size_t max_iterations   = 500,
+              bool has_initial_guess  = false,
+              bool do_expensive_check = false);
+
 /**
  * @brief Compute Eigenvector Centrality scores.
  *
@@ -1279,6 +1818,57 @@ void katz_centrality(raft::handle_t const& handle,
                      bool has_initial_guess  = false,
                      bool normalize          = false,
                      bool do_expensive_check = false);
+
+/**
+ * @brief Compute approximate harmonic and closeness centralities and the neighborhood function
+ * (HyperBall).
+ *
+ * Every vertex keeps a HyperLogLog counter estimating the number of vertices within distance t
+ * (the ball of radius t), and iteration t computes the balls of radius t as the unions of the
+ * balls of radius t - 1 of each vertex and its out-neighbors. This takes one pass over the edges
+ * per iteration (the number of iterations is the diameter of the graph) and 1 byte per register per
+ * vertex (plus 32 bytes per vertex of temporary storage) instead of a BFS per vertex. Edge weights
+ * are ignored (distances are the number of hops).
+ *
+ * Distances are measured from each vertex along the outgoing edges; use the reverse graph for the
+ * distances to each vertex (e.g. to match NetworkX closeness centrality for directed graphs).
+ * The relative standard error of each ball size estimate is about 1.04 / sqrt(@p num_registers).
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of centrality scores. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true). Currently, only single-GPU is supported.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param num_registers Number of HyperLogLog registers per vertex. Needs to be a power of two in
+ * [32, 65536].
+ * @param max_iterations Maximum number of iterations (distances larger than this are ignored).
+ * @param seed Seed of the hash function assigning vertices to registers.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<rmm::device_uvector<result_t>, rmm::device_uvector<result_t>,
+ * std::vector<result_t>, result_t> Tuple of the harmonic centralities (sum of the inverse distances
+ * to the reachable vertices), the closeness centralities (number of the other reachable vertices
+ * divided by the sum of the distances to them, 0 if no other vertex is reachable), the neighborhood
+ * function (element t is the number of vertex pairs within distance t, including (v, v) pairs),
+ * and the effective diameter (the interpolated distance within which 90% of the reachable pairs
+ * are).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<result_t>,
+           rmm::device_uvector<result_t>,
+           std::vector<result_t>,
+           result_t>
+hyperball(raft::handle_t const& handle,
+          graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+          size_t num_registers    = 64,
+          size_t max_iterations   = std::numeric_limits<size_t>::max(),
+          uint64_t seed           = 0,
+          bool do_expensive_check = false);
 /**
  * @brief returns induced EgoNet subgraph(s) of neighbors centered at nodes in source_vertex within
  * a given radius.
@@ -1650,6 +2240,86 @@ uniform_nbr_sample(
   bool with_replacement = true,
   uint64_t seed         = 0);
 
+/**
+ * @brief Uniform Neighborhood Sampling on the host with multiple threads.
+ *
+ * Same inputs and outputs as uniform_nbr_sample, but the graph is copied to host memory and the
+ * neighbors are sampled with multiple threads. Sampling without replacement takes every neighbor
+ * of a vertex whose out-degree does not exceed the fan-out, and otherwise uses Floyd's algorithm
+ * (small fan-outs) or reservoir sampling (fan-outs close to the out-degree). The samples depend on
+ * @p seed but not on the number of threads (they differ from the samples of uniform_nbr_sample).
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph View object to generate NBR Sampling on.
+ * @param starting_vertices Device span of starting vertex IDs for the NBR Sampling.
+ * @param fan_out Host span defining branching out (fan-out) degree per source vertex for each
+ * level (all the neighbors are taken in a level with a non-positive fan-out).
+ * @param with_replacement boolean flag specifying if random sampling is done with replacement
+ * (true); or, without replacement (false); default = true;
+ * @param seed A seed to initialize the random number generator
+ * @param num_threads Number of host threads to use, 0 to use std::thread::hardware_concurrency().
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return tuple device vectors (vertex_t source_vertex, vertex_t destination_vertex, weight_t
+ * weight, edge_t count)
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>,
+           rmm::device_uvector<edge_t>>
+host_uniform_nbr_sample(raft::handle_t const& handle,
+                        graph_view_t<vertex_t, edge_t, weight_t, false, false> const& graph_view,
+                        raft::device_span<vertex_t const> starting_vertices,
+                        raft::host_span<int const> fan_out,
+                        bool with_replacement   = true,
+                        uint64_t seed           = 0,
+                        size_t num_threads      = 0,
+                        bool do_expensive_check = false);
+
+/**
+ * @brief Uniform Neighborhood Sampling on a host CSR with multiple threads.
+ *
+ * Same as the host_uniform_nbr_sample overload taking a graph view, but the input graph is a CSR in
+ * host memory and the neighbors are sampled without a GPU.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param offsets CSR offsets (host memory, size: number of vertices + 1).
+ * @param indices CSR indices (host memory, size: number of edges).
+ * @param weights Optional CSR edge weights (host memory, size: number of edges), the output
+ * weights are 1.0 if std::nullopt.
+ * @param starting_vertices Starting vertex IDs for the NBR Sampling (host memory).
+ * @param fan_out Host span defining branching out (fan-out) degree per source vertex for each
+ * level (all the neighbors are taken in a level with a non-positive fan-out).
+ * @param with_replacement boolean flag specifying if random sampling is done with replacement
+ * (true); or, without replacement (false); default = true;
+ * @param seed A seed to initialize the random number generator
+ * @param num_threads Number of host threads to use, 0 to use std::thread::hardware_concurrency().
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return tuple host vectors (vertex_t source_vertex, vertex_t destination_vertex, weight_t
+ * weight, edge_t count)
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<std::vector<vertex_t>, std::vector<vertex_t>, std::vector<weight_t>, std::vector<edge_t>>
+host_uniform_nbr_sample(raft::host_span<edge_t const> offsets,
+                        raft::host_span<vertex_t const> indices,
+                        std::optional<raft::host_span<weight_t const>> weights,
+                        raft::host_span<vertex_t const> starting_vertices,
+                        raft::host_span<int const> fan_out,
+                        bool with_replacement   = true,
+                        uint64_t seed           = 0,
+                        size_t num_threads      = 0,
+                        bool do_expensive_check = false);
+
 /*
  * @brief Compute triangle counts.
  *
@@ -1677,6 +2347,291 @@ void triangle_count(raft::handle_t const& handle,
                     raft::device_span<edge_t> counts,
                     bool do_expensive_check = false);
 
+/*
+ * @brief Compute the triad census of a directed graph.
+ *
+ * Every unordered triple of vertices is classified to one of the 16 isomorphism classes of directed
+ * graphs with three vertices (triad types, Holland & Leinhardt). Self-loops are ignored.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Triad counts in the order of 003, 012, 102, 021D, 021U, 021C, 111D, 111U, 030T, 030C,
+ * 201, 120D, 120U, 120C, 210, and 300. Counts are computed in modulo 2^64 arithmetic (the 003 count
+ * wraps around if the actual count does not fit in 64 bits).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::array<uint64_t, 16> triad_census(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  bool do_expensive_check = false);
+
+/*
+ * @brief Compute the triad census of a directed graph on the host with multiple threads.
+ *
+ * Same output as triad_census, but the input graph is a CSR in host memory and the census is
+ * computed without a GPU. Self-loops are ignored and parallel edges are treated as a single edge.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @param offsets CSR offsets (host memory, size: number of vertices + 1).
+ * @param indices CSR indices (host memory, size: number of edges).
+ * @param num_threads Number of host threads to use, 0 to use std::thread::hardware_concurrency().
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Triad counts in the order of 003, 012, 102, 021D, 021U, 021C, 111D, 111U, 030T, 030C,
+ * 201, 120D, 120U, 120C, 210, and 300 (in modulo 2^64 arithmetic as in triad_census).
+ */
+template <typename vertex_t, typename edge_t>
+std::array<uint64_t, 16> host_triad_census(raft::host_span<edge_t const> offsets,
+                                           raft::host_span<vertex_t const> indices,
+                                           size_t num_threads      = 0,
+                                           bool do_expensive_check = false);
+
+/**
+ * @brief Detect communities by label propagation.
+ *
+ * Every vertex starts with its own label (or, if seeds are provided, the seed vertices start with
+ * the seed labels and the other vertices start unlabeled) and repeatedly adopts the most frequent
+ * label among its neighbors (weighted by the edge weights, a vertex keeps its current label on
+ * ties, and the smallest label wins the remaining ties). Only the vertices with a neighbor that
+ * changed its label in the previous iteration are re-evaluated, and each of those re-evaluates in
+ * roughly every other iteration (selected by a hash of the vertex ID and the iteration) to avoid
+ * the label oscillation of fully synchronous updates. The seed labels never change
+ * (semi-supervised label propagation). Each iteration takes time linear in the number of edges
+ * (only the frontier vertices' edges once the frontier becomes small in single-GPU), and the
+ * communities are coarser (and less stable) than the communities found by Louvain.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object, the graph should be symmetric.
+ * @param labels Output labels of the local vertices (size: the number of local vertices). Labels
+ * are in [0, graph_view.number_of_vertices()) (vertex IDs without seeds, and seed labels with
+ * seeds).
+ * With seeds, the labels of the vertices not connected to any seed vertex are set to
+ * invalid_vertex_id<vertex_t>::value.
+ * @param seed_vertices Optional seed vertices with fixed labels (in multi-GPU, the seed vertices
+ * should be in the local vertex partition range).
+ * @param seed_labels Labels of the seed vertices (valid if and only if @p seed_vertices is valid),
+ * labels should be in [0, graph_view.number_of_vertices()).
+ * @param max_iterations Maximum number of iterations.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Number of iterations run (less than @p max_iterations if the labels converged).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+size_t label_propagation(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  raft::device_span<vertex_t> labels,
+  std::optional<raft::device_span<vertex_t const>> seed_vertices = std::nullopt,
+  std::optional<raft::device_span<vertex_t const>> seed_labels   = std::nullopt,
+  size_t max_iterations                                          = 100,
+  bool do_expensive_check                                        = false);
+
+/**
+ * @brief Detect communities by label propagation on the host with multiple threads.
+ *
+ * Same inputs and outputs as label_propagation, but the graph is copied to host memory and the
+ * labels are computed with multiple threads. The iteration is the same as label_propagation, so the
+ * labels match the device implementation (up to the floating point summation order of the edge
+ * weights) and do not depend on the number of threads.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object, the graph should be symmetric.
+ * @param labels Output labels (device memory, size: graph_view.number_of_vertices()).
+ * @param seed_vertices Optional seed vertices with fixed labels (device memory).
+ * @param seed_labels Labels of the seed vertices (device memory, valid if and only if @p
+ * seed_vertices is valid).
+ * @param max_iterations Maximum number of iterations.
+ * @param num_threads Number of host threads to use, 0 to use std::thread::hardware_concurrency().
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Number of iterations run (less than @p max_iterations if the labels converged).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+size_t host_label_propagation(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, false> const& graph_view,
+  raft::device_span<vertex_t> labels,
+  std::optional<raft::device_span<vertex_t const>> seed_vertices = std::nullopt,
+  std::optional<raft::device_span<vertex_t const>> seed_labels   = std::nullopt,
+  size_t max_iterations                                          = 100,
+  size_t num_threads                                             = 0,
+  bool do_expensive_check                                        = false);
+
+/**
+ * @brief Detect communities by label propagation on a host CSR with multiple threads.
+ *
+ * Same as the host_label_propagation overload taking a graph view, but the input graph is a CSR in
+ * host memory and the labels are computed without a GPU.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param offsets CSR offsets (host memory, size: number of vertices + 1), the graph should be
+ * symmetric.
+ * @param indices CSR indices (host memory, size: number of edges).
+ * @param weights Optional CSR edge weights (host memory, size: number of edges).
+ * @param labels Output labels (host memory, size: number of vertices).
+ * @param seed_vertices Optional seed vertices with fixed labels (host memory).
+ * @param seed_labels Labels of the seed vertices (host memory, valid if and only if @p
+ * seed_vertices is valid).
+ * @param max_iterations Maximum number of iterations.
+ * @param num_threads Number of host threads to use, 0 to use std::thread::hardware_concurrency().
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Number of iterations run (less than @p max_iterations if the labels converged).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+size_t host_label_propagation(
+  raft::host_span<edge_t const> offsets,
+  raft::host_span<vertex_t const> indices,
+  std::optional<raft::host_span<weight_t const>> weights,
+  raft::host_span<vertex_t> labels,
+  std::optional<raft::host_span<vertex_t const>> seed_vertices = std::nullopt,
+  std::optional<raft::host_span<vertex_t const>> seed_labels   = std::nullopt,
+  size_t max_iterations                                        = 100,
+  size_t num_threads                                           = 0,
+  bool do_expensive_check                                      = false);
+
+/**
+ * @brief Vertex coloring algorithms.
+ *
+ * JONES_PLASSMANN: in each round, the uncolored vertices with the largest random priority among
+ * the uncolored vertices within the coloring distance (local maxima) take the smallest color not
+ * used within the coloring distance (first fit). The local maxima are never within the coloring
+ * distance of each other, so no conflict resolution is necessary.
+ * SPECULATIVE: in each round, all the uncolored vertices tentatively take the smallest color not
+ * used within the coloring distance, and the vertices that share a tentative color with a higher
+ * priority vertex within the coloring distance retry in the next round. This typically takes fewer
+ * rounds than JONES_PLASSMANN.
+ */
+enum class coloring_algorithm_t { JONES_PLASSMANN = 0, SPECULATIVE };
+
+/**
+ * @brief Compute a distance-1 or distance-2 vertex coloring.
+ *
+ * No two vertices within @p distance hops (ignoring self-loops) share a color. The colors are dense
+ * (in [0, number of colors)). Each color class is an independent set (distance 1) or a set of
+ * vertices with pairwise disjoint closed neighborhoods (distance 2), so the vertices of a color
+ * class can be updated concurrently without conflicts (see color_classes).
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object, the graph should be symmetric.
+ * @param distance Coloring distance (1 or 2).
+ * @param algorithm Coloring algorithm.
+ * @param seed Seed for the vertex priorities (the output is deterministic for a given seed).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Colors of the local vertices (device memory, size:
+ * graph_view.local_vertex_partition_range_size()).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<vertex_t> vertex_coloring(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  size_t distance                = 1,
+  coloring_algorithm_t algorithm = coloring_algorithm_t::JONES_PLASSMANN,
+  uint64_t seed                  = 0,
+  bool do_expensive_check        = false);
+
+/**
+ * @brief Group the local vertices by color.
+ *
+ * The vertices of each color class are sorted, so a class can be inserted into a vertex frontier
+ * bucket as is to process the classes in phases.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param colors Colors of the local vertices (e.g. returned by vertex_coloring, device memory,
+ * size: graph_view.local_vertex_partition_range_size()).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Tuple of the local vertices sorted by (color, vertex) (device memory) and the host
+ * offsets of the color classes (size: the global number of colors + 1, the vertices of color c are
+ * in [offsets[c], offsets[c + 1])).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, std::vector<size_t>> color_classes(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  raft::device_span<vertex_t const> colors,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Multilevel k-way graph partitioning.
+ *
+ * Partitions the vertices into @p num_partitions balanced parts while trying to minimize the total
+ * weight of the edges between the parts (METIS style): the graph is repeatedly coarsened by
+ * contracting a heavy-edge matching, the coarsest graph is partitioned by greedy graph growing,
+ * and the partition is projected back level by level with balance constrained refinement at each
+ * level. The final refinement is followed by a rebalancing pass that moves the excess vertices of
+ * the overweight parts to the parts with room. The part IDs combined with the renumber map can be
+ * used as an (external) vertex to GPU map to shuffle the graph for multi-GPU runs.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object, the graph should be symmetric and weighted.
+ * @param num_partitions Number of parts (in [1, graph_view.number_of_vertices()]).
+ * @param imbalance Allowed imbalance, every part has at most max(floor((1.0 + @p imbalance) * V /
+ * @p num_partitions), ceil(V / @p num_partitions)) vertices (V: graph_view.number_of_vertices()).
+ * @param refinement_iterations Maximum number of refinement iterations per level.
+ * @param seed Seed for the matching tie-breaking (the output is deterministic for a given seed).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return Part IDs (in [0, @p num_partitions)) of the local vertices (device memory, size:
+ * graph_view.local_vertex_partition_range_size()).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<vertex_t> k_way_partition(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  size_t num_partitions,
+  double imbalance             = 0.03,
+  size_t refinement_iterations = 10,
+  uint64_t seed                = 0,
+  bool do_expensive_check      = false);
+
 }  // namespace cugraph
 
 /**
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/graph.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+namespace cugraph {
+
+/**
+ * @brief Contraction hierarchy of a weighted (single-GPU) graph.
+ *
+ * Vertices are contracted level by level, every level is an independent set of the graph remaining
+ * at the time of its contraction. Contracting a vertex inserts shortcut edges between its
+ * remaining neighbors, so the shortest path distance between any two vertices is the minimum over
+ * the meeting vertices of an upward search from the source (in @p upward_graph) and an upward
+ * search from the target (in @p downward_graph). A shortcut (u, w) bypasses the contracted vertex
+ * shortcut_middles[i] (with shortcut_srcs[i] = u and shortcut_dsts[i] = w), replacing the shortcuts
+ * with (u, middle) and (middle, w) recursively unpacks a path in the hierarchy to a path in the
+ * input graph.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct contraction_hierarchy_t {
+  rmm::device_uvector<vertex_t> levels;  // contraction level of each vertex
+  graph_t<vertex_t, edge_t, weight_t, false, false>
+    upward_graph;  // input and shortcut edges (u, v) with levels[u] < levels[v]
+  graph_t<vertex_t, edge_t, weight_t, false, false>
+    downward_graph;  // input and shortcut edges (u, v) with levels[u] > levels[v], reversed
+
+  // shortcuts in the upward and the downward graphs (in the input edge direction) sorted by (src,
+  // dst), with the vertex each shortcut bypasses and the weight of the (src, middle) edge
+  rmm::device_uvector<vertex_t> shortcut_srcs;
+  rmm::device_uvector<vertex_t> shortcut_dsts;
+  rmm::device_uvector<vertex_t> shortcut_middles;
+  rmm::device_uvector<weight_t> shortcut_first_weights;
+};
+
+}  // namespace cugraph
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/graph.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+/**
+ * @brief Options to parse a delimited (e.g. CSV or TSV) edge list file.
+ *
+ * Empty lines and lines starting with '#' or '%' are skipped. A field enclosed in double quotes
+ * is unquoted (quoted fields should not include the delimiter or line breaks).
+ */
+struct delimited_edgelist_options_t {
+  // if std::nullopt, ',' if the first record includes ',', '\t' if the first record includes '\t',
+  // and runs of spaces otherwise
+  std::optional<char> delimiter{std::nullopt};
+  bool header{false};  // if true, the first (non-comment) line holds column names
+
+  size_t src_column{0};
+  size_t dst_column{1};
+  // ignored if the file has no such column
+  std::optional<size_t> weight_column{2};
+
+  size_t num_threads{0};  // number of host threads to parse with, 0 to use every hardware thread
+};
+
+/**
+ * @brief Edge list read from a delimited edge list file (in host memory).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ */
+template <typename vertex_t, typename weight_t>
+struct host_edgelist_t {
+  std::vector<vertex_t> srcs{};
+  std::vector<vertex_t> dsts{};
+  std::optional<std::vector<weight_t>> weights{std::nullopt};
+
+  // if the file uses non-integer vertex IDs, the vertex IDs in srcs & dsts are indices to this
+  // vector (in the order of first appearance in the file)
+  std::optional<std::vector<std::string>> vertex_labels{std::nullopt};
+
+  std::optional<std::vector<std::string>> column_names{std::nullopt};  // valid if header is true
+  std::vector<size_t> extra_column_indices{};  // file column indices of extra_columns
+  std::vector<std::vector<std::string>> extra_columns{};  // unparsed values of the other columns
+};
+
+/**
+ * @brief Read a delimited (e.g. CSV or TSV) edge list file.
+ *
+ * The file is memory mapped (if supported), split at line boundaries, and parsed by multiple host
+ * threads. Vertex IDs are parsed as integers if every vertex ID in the file is an integer, and
+ * are mapped to consecutive integers otherwise (and the original IDs are returned in
+ * host_edgelist_t::vertex_labels).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param file_path Path to the edge list file.
+ * @param options Parsing options.
+ * @return host_edgelist_t<vertex_t, weight_t> Edges read from the file, in the file order.
+ */
+template <typename vertex_t, typename weight_t>
+host_edgelist_t<vertex_t, weight_t> read_delimited_edgelist(
+  std::string const& file_path, delimited_edgelist_options_t const& options = {});
+
+/**
+ * @brief Create a (single-GPU) graph from a delimited (e.g. CSV or TSV) edge list file.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param file_path Path to the edge list file.
+ * @param options Parsing options.
+ * @param graph_properties Properties of the graph represented by the input edge list.
+ * @param renumber Flag indicating whether to renumber vertices or not. Vertex IDs should be
+ * non-negative integers if @p renumber is false.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<graph_t<vertex_t, edge_t, weight_t, store_transposed, false>,
+ * std::optional<rmm::device_uvector<vertex_t>>, std::optional<std::vector<std::string>>> Tuple of
+ * the generated graph, an optional renumber map (to recover the vertex IDs in the file, valid if
+ * @p renumber is true), and optional vertex labels (valid if the file uses non-integer vertex IDs;
+ * the vertex IDs recovered with the renumber map are indices to the labels).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+std::tuple<graph_t<vertex_t, edge_t, weight_t, store_transposed, false>,
+           std::optional<rmm::device_uvector<vertex_t>>,
+           std::optional<std::vector<std::string>>>
+create_graph_from_delimited_edgelist_file(raft::handle_t const& handle,
+                                          std::string const& file_path,
+                                          delimited_edgelist_options_t const& options,
+                                          graph_properties_t graph_properties,
+                                          bool renumber,
+                                          bool do_expensive_check = false);
+
+}  // namespace cugraph
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/graph_view.hpp>
+
+#include <raft/handle.hpp>
+#include <raft/span.hpp>
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <array>
+#include <optional>
+#include <tuple>
+
+namespace cugraph {
+
+/**
+ * @brief Iterate over the edges of a (single-GPU) graph in bounded-size (src, dst, weight) chunks.
+ *
+ * This is an alternative to graph_t::decompress_to_edgelist() for exporting large graphs (e.g. to
+ * a file writer or a network sink): only two chunk buffers are allocated instead of full edge list
+ * arrays. The chunks are double-buffered: when a chunk is returned, decompression of the next
+ * chunk is already enqueued (on a stream from the handle's stream pool if available) so it
+ * overlaps with the consumer processing the returned chunk. Chunks are returned in the order the
+ * edges are stored in the graph.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+class edge_chunk_iterator_t {
+ public:
+  using chunk_type = std::tuple<raft::device_span<vertex_t const>,
+                                raft::device_span<vertex_t const>,
+                                std::optional<raft::device_span<weight_t const>>>;
+
+  /**
+   * @brief Construct an edge chunk iterator and enqueue decompression of the first chunk.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param graph_view Graph view object to export; the graph should outlive this object.
+   * @param renumber_map Optional renumber map to recover the original vertex IDs from the
+   * renumbered vertex IDs. If @p renumber_map.has_value() is false, the returned chunks hold the
+   * (internal) vertex IDs of @p graph_view.
+   * @param max_chunk_size Maximum number of edges in a chunk.
+   */
+  edge_chunk_iterator_t(
+    raft::handle_t const& handle,
+    graph_view_t<vertex_t, edge_t, weight_t, store_transposed, false> const& graph_view,
+    std::optional<raft::device_span<vertex_t const>> renumber_map,
+    size_t max_chunk_size);
+
+  edge_chunk_iterator_t(edge_chunk_iterator_t&&) = default;
+
+  /**
+   * @brief Wait for the decompression of the chunk enqueued in advance (if any) to finish before
+   * the chunk buffers are released.
+   */
+  ~edge_chunk_iterator_t();
+
+  /**
+   * @brief Return the next chunk.
+   *
+   * The returned arrays are valid until the following call to next(). Work the consumer enqueues
+   * on the handle's stream on the returned arrays is waited for before their buffer is reused.
+   *
+   * @return std::optional<chunk_type> Sources, destinations, and (if the graph is weighted)
+   * weights of the next chunk, std::nullopt if every chunk has already been returned.
+   */
+  std::optional<chunk_type> next();
+
+  size_t num_chunks() const { return num_chunks_; }
+
+ private:
+  // enqueue decompression of the chunk_idx'th chunk into buffer chunk_idx % 2
+  void enqueue_chunk(size_t chunk_idx);
+
+  raft::handle_t const* handle_ptr_{nullptr};
+  rmm::cuda_stream_view stream_view_{};
+
+  edge_t const* offsets_{nullptr};
+  vertex_t const* indices_{nullptr};
+  std::optional<weight_t const*> weights_{std::nullopt};
+  vertex_t number_of_vertices_{0};
+  edge_t number_of_edges_{0};
+  std::optional<raft::device_span<vertex_t const>> renumber_map_{std::nullopt};
+
+  size_t max_chunk_size_{0};
+  size_t num_chunks_{0};
+  size_t next_chunk_idx_{0};
+
+  std::array<rmm::device_uvector<vertex_t>, 2> majors_;
+  std::array<rmm::device_uvector<vertex_t>, 2> minors_;
+  std::optional<std::array<rmm::device_uvector<weight_t>, 2>> chunk_weights_{std::nullopt};
+};
+
+}  // namespace cugraph
@@ -23,9 +23,12 @@
 #include <rmm/device_uvector.hpp>
 
 #include <cstddef>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 /** @defgroup cpp_api cuGraph C++ API
@@ -71,6 +74,62 @@ struct graph_meta_t<vertex_t, edge_t, multi_gpu, std::enable_if_t<!multi_gpu>> {
   std::optional<std::vector<vertex_t>> segment_offsets{std::nullopt};
 };
 
+namespace detail {
+
+// vertex attributes derived from the graph structure, computed on first use (through the owning
+// graph_t or its graph views) and kept until the owning graph_t is modified (every modifying
+// graph_t member function replaces *this, and this cache with it)
+template <typename edge_t, typename weight_t>
+struct graph_derived_attributes_t {
+  std::mutex mutex{};
+
+  std::optional<rmm::device_uvector<edge_t>> in_degrees{std::nullopt};
+  std::optional<rmm::device_uvector<edge_t>> out_degrees{std::nullopt};
+  std::optional<rmm::device_uvector<weight_t>> in_weight_sums{std::nullopt};
+  std::optional<rmm::device_uvector<weight_t>> out_weight_sums{std::nullopt};
+
+  std::optional<edge_t> max_in_degree{std::nullopt};
+  std::optional<edge_t> max_out_degree{std::nullopt};
+  std::optional<weight_t> max_in_weight_sum{std::nullopt};
+  std::optional<weight_t> max_out_weight_sum{std::nullopt};
+};
+
+// owns the derived attribute cache of a graph_t; the cache keeps its address when the graph_t is
+// moved (graph views hold a pointer to it), and a moved-from holder gets a new empty cache so a
+// moved-from graph_t stays valid
+template <typename edge_t, typename weight_t>
+class graph_derived_attributes_holder_t {
+ public:
+  graph_derived_attributes_holder_t()
+    : ptr_(std::make_unique<graph_derived_attributes_t<edge_t, weight_t>>())
+  {
+  }
+
+  graph_derived_attributes_holder_t(graph_derived_attributes_holder_t&& other)
+    : ptr_(
+        std::exchange(other.ptr_, std::make_unique<graph_derived_attributes_t<edge_t, weight_t>>()))
+  {
+  }
+
+  graph_derived_attributes_holder_t& operator=(graph_derived_attributes_holder_t&& other)
+  {
+    if (this != &other) {
+      ptr_ =
+        std::exchange(other.ptr_, std::make_unique<graph_derived_attributes_t<edge_t, weight_t>>());
+    }
+    return *this;
+  }
+
+  graph_derived_attributes_t<edge_t, weight_t>* get() const { return ptr_.get(); }
+  graph_derived_attributes_t<edge_t, weight_t>& operator*() const { return *ptr_; }
+  graph_derived_attributes_t<edge_t, weight_t>* operator->() const { return ptr_.get(); }
+
+ private:
+  std::unique_ptr<graph_derived_attributes_t<edge_t, weight_t>> ptr_{};
+};
+
+}  // namespace detail
+
 // graph_t is an owning graph class (note that graph_view_t is a non-owning graph class)
 template <typename vertex_t,
           typename edge_t,
@@ -290,7 +349,8 @@ class graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enab
         local_sorted_unique_edge_dsts,
         local_sorted_unique_edge_dst_chunk_start_offsets,
         local_sorted_unique_edge_dst_chunk_size_,
-        local_sorted_unique_edge_dst_vertex_partition_offsets});
+        local_sorted_unique_edge_dst_vertex_partition_offsets},
+      derived_attributes_.get());
   }
 
   std::tuple<rmm::device_uvector<vertex_t>,
@@ -300,6 +360,29 @@ class graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enab
                          std::optional<rmm::device_uvector<vertex_t>> const& renumber_map,
                          bool destroy = false);
 
+  /**
+   * @brief Get the (cached) in-degrees of the local vertices.
+   *
+   * The derived vertex attributes (degrees, weight sums, and their maximums) are computed on the
+   * first call and reused by the following calls until this graph is modified. The returned spans
+   * are valid as long as this graph is not modified or destroyed.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @return raft::device_span<edge_t const> In-degrees of the local vertices.
+   */
+  raft::device_span<edge_t const> in_degrees(raft::handle_t const& handle) const;
+  raft::device_span<edge_t const> out_degrees(raft::handle_t const& handle) const;
+
+  raft::device_span<weight_t const> in_weight_sums(raft::handle_t const& handle) const;
+  raft::device_span<weight_t const> out_weight_sums(raft::handle_t const& handle) const;
+
+  edge_t max_in_degree(raft::handle_t const& handle) const;
+  edge_t max_out_degree(raft::handle_t const& handle) const;
+
+  weight_t max_in_weight_sum(raft::handle_t const& handle) const;
+  weight_t max_out_weight_sum(raft::handle_t const& handle) const;
+
  private:
   std::vector<rmm::device_uvector<edge_t>> edge_partition_offsets_{};
   std::vector<rmm::device_uvector<vertex_t>> edge_partition_indices_{};
@@ -345,6 +428,8 @@ class graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enab
                      std::optional<std::vector<vertex_t>>,
                      std::optional<std::byte> /* dummy */>
     local_sorted_unique_edge_dst_vertex_partition_offsets_{std::nullopt};
+
+  detail::graph_derived_attributes_holder_t<edge_t, weight_t> derived_attributes_{};
 };
 
 // single-GPU version
@@ -446,7 +531,8 @@ class graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enab
       graph_view_meta_t<vertex_t, edge_t, store_transposed, multi_gpu>{this->number_of_vertices(),
                                                                        this->number_of_edges(),
                                                                        this->graph_properties(),
-                                                                       segment_offsets_});
+                                                                       segment_offsets_},
+      derived_attributes_.get());
   }
 
   // FIXME: possibley to be added later;
@@ -479,6 +565,29 @@ class graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enab
                          std::optional<rmm::device_uvector<vertex_t>> const& renumber_map,
                          bool destroy = false);
 
+  /**
+   * @brief Get the (cached) in-degrees of the local vertices.
+   *
+   * The derived vertex attributes (degrees, weight sums, and their maximums) are computed on the
+   * first call and reused by the following calls until this graph is modified. The returned spans
+   * are valid as long as this graph is not modified or destroyed.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @return raft::device_span<edge_t const> In-degrees of the local vertices.
+   */
+  raft::device_span<edge_t const> in_degrees(raft::handle_t const& handle) const;
+  raft::device_span<edge_t const> out_degrees(raft::handle_t const& handle) const;
+
+  raft::device_span<weight_t const> in_weight_sums(raft::handle_t const& handle) const;
+  raft::device_span<weight_t const> out_weight_sums(raft::handle_t const& handle) const;
+
+  edge_t max_in_degree(raft::handle_t const& handle) const;
+  edge_t max_out_degree(raft::handle_t const& handle) const;
+
+  weight_t max_in_weight_sum(raft::handle_t const& handle) const;
+  weight_t max_out_weight_sum(raft::handle_t const& handle) const;
+
  private:
   friend class cugraph::serializer::serializer_t;
 
@@ -507,6 +616,8 @@ class graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enab
 
   // segment offsets based on vertex degree, relevant only if sorted_by_global_degree is true
   std::optional<std::vector<vertex_t>> segment_offsets_{};
+
+  detail::graph_derived_attributes_holder_t<edge_t, weight_t> derived_attributes_{};
 };
 
 template <typename T, typename Enable = void>
@@ -17,6 +17,7 @@
 
 #include <cugraph/graph.hpp>
 #include <cugraph/graph_view.hpp>
+#include <cugraph/propagation_blocking.hpp>
 
 #include <raft/handle.hpp>
 #include <raft/span.hpp>
@@ -334,6 +335,109 @@ void renumber_local_ext_vertices(raft::handle_t const& handle,
                                  vertex_t local_int_vertex_last,
                                  bool do_expensive_check = false);
 
+/**
+ * @brief Reusable index mapping the local external vertices to internal vertices.
+ *
+ * renumber_ext_vertices and renumber_local_ext_vertices taking @p renumber_map_labels build a hash
+ * map over the entire local renumber map on every call. This index is built once (the local
+ * renumber map labels are sorted with their internal vertices) and can be shared by every
+ * subsequent call; each look-up then costs O(log(V_local)) regardless of the number of vertices to
+ * renumber. The index is a snapshot of @p renumber_map_labels and should be rebuilt if the renumber
+ * map changes.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ */
+template <typename vertex_t, bool multi_gpu>
+class renumber_index_t {
+ public:
+  /**
+   * @brief Build the index.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param renumber_map_labels Pointer to the external vertices corresponding to the internal
+   * vertices in the range [@p local_int_vertex_first, @p local_int_vertex_last).
+   * @param local_int_vertex_first The first local internal vertex (inclusive, assigned to this
+   * process in multi-GPU).
+   * @param local_int_vertex_last The last local internal vertex (exclusive, assigned to this
+   * process in multi-GPU).
+   * @param do_expensive_check A flag to run expensive checks for input arguments (if set to
+   * `true`).
+   */
+  renumber_index_t(raft::handle_t const& handle,
+                   vertex_t const* renumber_map_labels,
+                   vertex_t local_int_vertex_first,
+                   vertex_t local_int_vertex_last,
+                   bool do_expensive_check = false);
+
+  vertex_t local_int_vertex_first() const { return local_int_vertex_first_; }
+  vertex_t local_int_vertex_last() const { return local_int_vertex_last_; }
+
+  size_t size() const { return sorted_ext_vertices_.size(); }
+
+  // local external vertices in the ascending order
+  vertex_t const* sorted_ext_vertices() const { return sorted_ext_vertices_.data(); }
+  // internal vertices corresponding to sorted_ext_vertices()
+  vertex_t const* int_vertices() const { return int_vertices_.data(); }
+
+ private:
+  rmm::device_uvector<vertex_t> sorted_ext_vertices_;
+  rmm::device_uvector<vertex_t> int_vertices_;
+  vertex_t local_int_vertex_first_{};
+  vertex_t local_int_vertex_last_{};
+};
+
+/**
+ * @brief Renumber external vertices to internal vertices using a pre-built renumber index.
+ *
+ * Equivalent to renumber_ext_vertices taking the renumber map labels the index was built from, but
+ * without building a hash map over the entire renumber map.
+ *
+ * Note cugraph::invalid_id<vertex_t>::value remains unchanged.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param vertices Pointer to the vertices to be renumbered. The input external vertices are
+ * renumbered to internal vertices in-place.
+ * @param num_vertices Number of vertices to be renumbered.
+ * @param renumber_index Index built from the local renumber map labels.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, bool multi_gpu>
+void renumber_ext_vertices(raft::handle_t const& handle,
+                           vertex_t* vertices /* [INOUT] */,
+                           size_t num_vertices,
+                           renumber_index_t<vertex_t, multi_gpu> const& renumber_index,
+                           bool do_expensive_check = false);
+
+/**
+ * @brief Renumber local external vertices to internal vertices using a pre-built renumber index.
+ *
+ * Note cugraph::invalid_id<vertex_t>::value remains unchanged.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param vertices Pointer to the vertices to be renumbered. The input external vertices are
+ * renumbered to internal vertices in-place.
+ * @param num_vertices Number of vertices to be renumbered.
+ * @param renumber_index Index built from the local renumber map labels.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, bool multi_gpu>
+void renumber_local_ext_vertices(raft::handle_t const& handle,
+                                 vertex_t* vertices /* [INOUT] */,
+                                 size_t num_vertices,
+                                 renumber_index_t<vertex_t, multi_gpu> const& renumber_index,
+                                 bool do_expensive_check = false);
+
 /**
  * @brief Symmetrize edgelist.
  *
@@ -522,4 +626,36 @@ create_graph_from_edgelist(raft::handle_t const& handle,
                            bool renumber,
                            bool do_expensive_check = false);
 
+/**
+ * @brief Bin the edges of a graph by destination vertex block for propagation-blocked edge passes.
+ *
+ * The result can be reused across iterations and calls of the algorithms accepting a
+ * propagation_blocking_t object (e.g. pagerank) on the same graph.
+ *
+ * @tparam result_t Type of the destination values accumulated per block (e.g. PageRank scores).
+ * Needs to be specified explicitly, determines the default block size.
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to use sources (if false) or destinations (if
+ * true) as major indices in storing edges using a 2D sparse matrix. transposed.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the graph to bin.
+ * @param block_size Number of destination vertices per block. The result_t values of a block should
+ * fit in the shared memory of a thread block. If std::nullopt, the block size is set so that the
+ * result_t values of a block fill the shared memory of a thread block of the current device.
+ * @return propagation_blocking_t<vertex_t, edge_t, weight_t> Edges sorted by source, the bin slot
+ * of each edge, the destination of each bin slot, and the slot offsets of each bin.
+ */
+template <typename result_t,
+          typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed>
+propagation_blocking_t<vertex_t, edge_t, weight_t> build_propagation_blocking(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, store_transposed, false> const& graph_view,
+  std::optional<vertex_t> block_size = std::nullopt);
+
 }  // namespace cugraph
@@ -259,6 +259,9 @@ size_t constexpr low_degree_threshold{raft::warp_size()};
 size_t constexpr mid_degree_threshold{1024};
 size_t constexpr num_sparse_segments_per_vertex_partition{3};
 
+template <typename edge_t, typename weight_t>
+struct graph_derived_attributes_t;
+
 // Common for both graph_view_t & graph_t and both single-GPU & multi-GPU versions
 template <typename vertex_t, typename edge_t, typename weight_t>
 class graph_base_t : public graph_envelope_t::base_graph_t /*<- visitor logic*/ {
@@ -416,7 +419,8 @@ class graph_view_t<vertex_t,
                std::optional<std::vector<weight_t const*>> const& edge_partition_weights,
                std::optional<std::vector<vertex_t const*>> const& edge_partition_dcs_nzd_vertices,
                std::optional<std::vector<vertex_t>> const& edge_partition_dcs_nzd_vertex_counts,
-               graph_view_meta_t<vertex_t, edge_t, store_transposed, multi_gpu> meta);
+               graph_view_meta_t<vertex_t, edge_t, store_transposed, multi_gpu> meta,
+               detail::graph_derived_attributes_t<edge_t, weight_t>* derived_attributes = nullptr);
 
   bool is_weighted() const { return edge_partition_weights_.has_value(); }
 
@@ -664,6 +668,36 @@ class graph_view_t<vertex_t,
       major_value_range_start_offset);
   }
 
+  // view the stored edges as the edges of the reversed graph in the other storage orientation (a
+  // CSC view of a graph is a CSR view of its reverse), no data is copied and the returned view is
+  // valid as long as this view is valid
+  graph_view_t<vertex_t, edge_t, weight_t, !store_transposed, multi_gpu> reverse_view() const
+  {
+    return graph_view_t<vertex_t, edge_t, weight_t, !store_transposed, multi_gpu>(
+      *(this->handle_ptr()),
+      edge_partition_offsets_,
+      edge_partition_indices_,
+      edge_partition_weights_,
+      edge_partition_dcs_nzd_vertices_,
+      edge_partition_dcs_nzd_vertex_counts_,
+      graph_view_meta_t<vertex_t, edge_t, !store_transposed, multi_gpu>{
+        this->number_of_vertices(),
+        this->number_of_edges(),
+        this->graph_properties(),
+        partition_,
+        edge_partition_segment_offsets_,
+        local_sorted_unique_edge_dsts_,
+        local_sorted_unique_edge_dst_chunk_start_offsets_,
+        local_sorted_unique_edge_dst_chunk_size_,
+        local_sorted_unique_edge_dst_vertex_partition_offsets_,
+        local_sorted_unique_edge_srcs_,
+        local_sorted_unique_edge_src_chunk_start_offsets_,
+        local_sorted_unique_edge_src_chunk_size_,
+        local_sorted_unique_edge_src_vertex_partition_offsets_});
+  }
+
+  // the derived vertex attributes of a view created by graph_t::view() are computed once and cached
+  // in the owning graph_t (see graph_t::in_degrees()), later calls copy the cached values
   rmm::device_uvector<edge_t> compute_in_degrees(raft::handle_t const& handle) const;
   rmm::device_uvector<edge_t> compute_out_degrees(raft::handle_t const& handle) const;
 
@@ -775,6 +809,27 @@ class graph_view_t<vertex_t,
   decompress_to_edgelist(raft::handle_t const& handle,
                          std::optional<rmm::device_uvector<vertex_t>> const& renumber_map) const;
 
+  // query whether the edges (edge_srcs[i], edge_dsts[i]) exist, edge_srcs and edge_dsts are in
+  // external vertex IDs if renumber_map is valid (and in internal vertex IDs otherwise), edges of
+  // vertices missing in renumber_map are not found (or throw if do_expensive_check is true)
+  rmm::device_uvector<bool> has_edges(
+    raft::handle_t const& handle,
+    raft::device_span<vertex_t const> edge_srcs,
+    raft::device_span<vertex_t const> edge_dsts,
+    std::optional<rmm::device_uvector<vertex_t>> const& renumber_map,
+    bool do_expensive_check = false) const;
+
+  // query the weights of the edges (edge_srcs[i], edge_dsts[i]) (1.0 if the graph is unweighted,
+  // the weight of the first edge for multi-edges, and std::numeric_limits<weight_t>::max() if the
+  // edge does not exist), edge_srcs and edge_dsts are in external vertex IDs if renumber_map is
+  // valid (and in internal vertex IDs otherwise)
+  rmm::device_uvector<weight_t> lookup_edge_weights(
+    raft::handle_t const& handle,
+    raft::device_span<vertex_t const> edge_srcs,
+    raft::device_span<vertex_t const> edge_dsts,
+    std::optional<rmm::device_uvector<vertex_t>> const& renumber_map,
+    bool do_expensive_check = false) const;
+
  private:
   std::vector<edge_t const*> edge_partition_offsets_{};
   std::vector<vertex_t const*> edge_partition_indices_{};
@@ -821,6 +876,9 @@ class graph_view_t<vertex_t,
                      std::optional<raft::host_span<vertex_t const>>,
                      std::optional<std::byte> /* dummy */>
     local_sorted_unique_edge_dst_vertex_partition_offsets_{std::nullopt};
+
+  // derived attribute cache of the owning graph_t, nullptr if not created by graph_t::view()
+  detail::graph_derived_attributes_t<edge_t, weight_t>* derived_attributes_{nullptr};
 };
 
 // single-GPU version
@@ -847,7 +905,8 @@ class graph_view_t<vertex_t,
                edge_t const* offsets,
                vertex_t const* indices,
                std::optional<weight_t const*> weights,
-               graph_view_meta_t<vertex_t, edge_t, store_transposed, multi_gpu> meta);
+               graph_view_meta_t<vertex_t, edge_t, store_transposed, multi_gpu> meta,
+               detail::graph_derived_attributes_t<edge_t, weight_t>* derived_attributes = nullptr);
 
   bool is_weighted() const { return weights_.has_value(); }
 
@@ -966,6 +1025,25 @@ class graph_view_t<vertex_t,
       offsets_, indices_, weights_, this->number_of_vertices(), this->number_of_edges());
   }
 
+  // view the stored edges as the edges of the reversed graph in the other storage orientation (a
+  // CSC view of a graph is a CSR view of its reverse), no data is copied and the returned view is
+  // valid as long as this view is valid
+  graph_view_t<vertex_t, edge_t, weight_t, !store_transposed, multi_gpu> reverse_view() const
+  {
+    return graph_view_t<vertex_t, edge_t, weight_t, !store_transposed, multi_gpu>(
+      *(this->handle_ptr()),
+      offsets_,
+      indices_,
+      weights_,
+      graph_view_meta_t<vertex_t, edge_t, !store_transposed, multi_gpu>{
+        this->number_of_vertices(),
+        this->number_of_edges(),
+        this->graph_properties(),
+        segment_offsets_});
+  }
+
+  // the derived vertex attributes of a view created by graph_t::view() are computed once and cached
+  // in the owning graph_t (see graph_t::in_degrees()), later calls copy the cached values
   rmm::device_uvector<edge_t> compute_in_degrees(raft::handle_t const& handle) const;
   rmm::device_uvector<edge_t> compute_out_degrees(raft::handle_t const& handle) const;
 
@@ -1065,6 +1143,27 @@ class graph_view_t<vertex_t,
   decompress_to_edgelist(raft::handle_t const& handle,
                          std::optional<rmm::device_uvector<vertex_t>> const& renumber_map) const;
 
+  // query whether the edges (edge_srcs[i], edge_dsts[i]) exist, edge_srcs and edge_dsts are in
+  // external vertex IDs if renumber_map is valid (and in internal vertex IDs otherwise), edges of
+  // vertices missing in renumber_map are not found (or throw if do_expensive_check is true)
+  rmm::device_uvector<bool> has_edges(
+    raft::handle_t const& handle,
+    raft::device_span<vertex_t const> edge_srcs,
+    raft::device_span<vertex_t const> edge_dsts,
+    std::optional<rmm::device_uvector<vertex_t>> const& renumber_map,
+    bool do_expensive_check = false) const;
+
+  // query the weights of the edges (edge_srcs[i], edge_dsts[i]) (1.0 if the graph is unweighted,
+  // the weight of the first edge for multi-edges, and std::numeric_limits<weight_t>::max() if the
+  // edge does not exist), edge_srcs and edge_dsts are in external vertex IDs if renumber_map is
+  // valid (and in internal vertex IDs otherwise)
+  rmm::device_uvector<weight_t> lookup_edge_weights(
+    raft::handle_t const& handle,
+    raft::device_span<vertex_t const> edge_srcs,
+    raft::device_span<vertex_t const> edge_dsts,
+    std::optional<rmm::device_uvector<vertex_t>> const& renumber_map,
+    bool do_expensive_check = false) const;
+
  private:
   edge_t const* offsets_{nullptr};
   vertex_t const* indices_{nullptr};
@@ -1072,6 +1171,9 @@ class graph_view_t<vertex_t,
 
   // segment offsets based on vertex degree, relevant only if vertex IDs are renumbered
   std::optional<std::vector<vertex_t>> segment_offsets_{std::nullopt};
+
+  // derived attribute cache of the owning graph_t, nullptr if not created by graph_t::view()
+  detail::graph_derived_attributes_t<edge_t, weight_t>* derived_attributes_{nullptr};
 };
 
 }  // namespace cugraph
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <rmm/device_uvector.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cugraph {
+
+/**
+ * @brief MinHash signatures of the (out-)neighborhoods of the vertices of a (single-GPU) graph.
+ *
+ * Signature value i of a vertex is the extreme value of the i'th hash function over the vertex's
+ * neighbors, so two vertices agree on a signature value with probability equal to the Jaccard
+ * similarity of their neighborhoods. Signature values are never 0 unless the neighborhood is empty.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ */
+template <typename vertex_t>
+struct minhash_index_t {
+  vertex_t number_of_vertices{};
+  size_t num_hashes{};  // signature length
+  uint64_t seed{};      // seed of the hash functions
+  rmm::device_uvector<uint32_t>
+    signatures;  // signature value i of vertex v is stored at signatures[v * num_hashes + i]
+};
+
+}  // namespace cugraph
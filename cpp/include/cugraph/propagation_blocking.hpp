@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <rmm/device_uvector.hpp>
+
+#include <optional>
+
+namespace cugraph {
+
+/**
+ * @brief Edges of a (single-GPU) graph binned by destination vertex block (propagation blocking).
+ *
+ * An edge pass that scatters per-edge contributions to the destination vertices (e.g. the
+ * PageRank SpMV) runs in two phases over this structure. The binning phase walks the edges in
+ * source order (reading the source values sequentially) and writes each contribution to the slot
+ * bin_positions[i] of its destination block's bin (the slots of a bin are filled in source order).
+ * The accumulation phase reduces each bin into its block of destination values held in the
+ * on-chip shared memory, so no global atomics are needed. The binning depends only on the graph
+ * and can be reused by every iteration (and every call) that runs an edge pass on the same graph.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct propagation_blocking_t {
+  vertex_t block_size{};                      // number of destination vertices per block
+  rmm::device_uvector<edge_t> block_offsets;  // bin offsets, size = number of blocks + 1
+  rmm::device_uvector<vertex_t> srcs;         // sorted by (srcs[i], destination)
+  std::optional<rmm::device_uvector<weight_t>> weights;
+  rmm::device_uvector<edge_t> bin_positions;  // bin slot of each edge
+  rmm::device_uvector<vertex_t> bin_dsts;     // destination of each bin slot
+};
+
+}  // namespace cugraph
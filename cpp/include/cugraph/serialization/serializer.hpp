@@ -18,13 +18,16 @@
 //
 #pragma once
 
+#include <cugraph/contraction_hierarchy.hpp>
 #include <cugraph/graph.hpp>
+#include <cugraph/minhash_index.hpp>
 
 #include <rmm/device_uvector.hpp>
 
 #include <raft/handle.hpp>
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace cugraph {
@@ -142,6 +145,40 @@ class serializer_t {
   template <typename graph_t>
   graph_t unserialize(size_t device_sz_bytes, size_t host_sz_bytes);
 
+  // contraction hierarchy serialization,
+  // (the sizes of the upward and downward graphs are stored first):
+  //
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void serialize(contraction_hierarchy_t<vertex_t, edge_t, weight_t> const& hierarchy);
+
+  // contraction hierarchy unserialization:
+  //
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  contraction_hierarchy_t<vertex_t, edge_t, weight_t> unserialize_contraction_hierarchy(void);
+
+  // MinHash index serialization:
+  //
+  template <typename vertex_t>
+  void serialize(minhash_index_t<vertex_t> const& index);
+
+  // MinHash index unserialization:
+  //
+  template <typename vertex_t>
+  minhash_index_t<vertex_t> unserialize_minhash_index(void);
+
+  // serialization of the cached derived vertex attributes of a graph
+  // (degrees and weight sums, only those already computed),
+  // optional, to follow the graph serialization:
+  //
+  template <typename graph_t>
+  void serialize_derived_attributes(graph_t const& graph);
+
+  // unserialization of the cached derived vertex attributes
+  // into the graph unserialized right before:
+  //
+  template <typename graph_t>
+  void unserialize_derived_attributes(graph_t& graph);
+
   template <typename graph_t>
   static std::pair<size_t, size_t> get_device_graph_sz_bytes(
     graph_meta_t<graph_t> const& graph_meta)
@@ -179,6 +216,51 @@ class serializer_t {
     return get_device_graph_sz_bytes(gmeta);
   }
 
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  static size_t get_device_contraction_hierarchy_sz_bytes(
+    contraction_hierarchy_t<vertex_t, edge_t, weight_t> const& hierarchy)
+  {
+    auto upward_sz   = get_device_graph_sz_bytes(hierarchy.upward_graph);
+    auto downward_sz = get_device_graph_sz_bytes(hierarchy.downward_graph);
+
+    return 6 * sizeof(size_t) + hierarchy.levels.size() * sizeof(vertex_t) +
+           hierarchy.shortcut_srcs.size() * (3 * sizeof(vertex_t) + sizeof(weight_t)) +
+           upward_sz.first + upward_sz.second + downward_sz.first + downward_sz.second;
+  }
+
+  template <typename vertex_t>
+  static size_t get_device_minhash_index_sz_bytes(minhash_index_t<vertex_t> const& index)
+  {
+    return sizeof(vertex_t) + sizeof(size_t) + sizeof(uint64_t) +
+           index.signatures.size() * sizeof(uint32_t);
+  }
+
+  template <typename graph_t>
+  static size_t get_device_derived_attributes_sz_bytes(graph_t const& graph)
+  {
+    using edge_t   = typename graph_t::edge_type;
+    using weight_t = typename graph_t::weight_type;
+    using bool_t   = typename graph_meta_t<graph_t>::bool_ser_t;
+
+    if constexpr (!graph_t::is_multi_gpu) {
+      auto& attributes = *(graph.derived_attributes_);
+      std::lock_guard<std::mutex> lock(attributes.mutex);
+
+      size_t num_vertices = graph.number_of_vertices();
+      size_t num_degree_arrays =
+        (attributes.in_degrees ? 1 : 0) + (attributes.out_degrees ? 1 : 0);
+      size_t num_weight_sum_arrays =
+        (attributes.in_weight_sums ? 1 : 0) + (attributes.out_weight_sums ? 1 : 0);
+
+      return 4 * sizeof(bool_t) + num_vertices * (num_degree_arrays * sizeof(edge_t) +
+                                                  num_weight_sum_arrays * sizeof(weight_t));
+    } else {
+      CUGRAPH_FAIL("Unsupported graph type for un/serialization.");
+
+      return size_t{0};
+    }
+  }
+
   byte_t const* get_storage(void) const { return d_storage_.begin(); }
   byte_t* get_storage(void) { return d_storage_.begin(); }
 
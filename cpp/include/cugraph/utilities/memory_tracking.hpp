@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/host/host_memory_resource.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace cugraph {
+
+/**
+ * @brief Memory usage statistics of a single phase.
+ *
+ * Allocations are attributed to the innermost phase active (on the allocating thread) when the
+ * allocation is made; the matching deallocation is attributed to the same phase even if it happens
+ * later or elsewhere.
+ */
+struct memory_phase_stats_t {
+  size_t current_bytes{0};      ///< bytes allocated in this phase and still live
+  size_t peak_bytes{0};         ///< maximum of current_bytes
+  size_t total_bytes{0};        ///< bytes allocated in this phase (including freed ones)
+  size_t num_allocations{0};    ///< number of allocations made in this phase
+  size_t num_deallocations{0};  ///< number of the allocations above that have been freed
+};
+
+namespace detail {
+
+// (range ID, phase name) pairs of the calling thread, innermost last
+inline std::vector<std::pair<size_t, std::string>>& memory_phase_stack()
+{
+  thread_local std::vector<std::pair<size_t, std::string>> phases{};
+  return phases;
+}
+
+inline size_t next_memory_phase_range_id()
+{
+  thread_local size_t next_id{0};
+  return next_id++;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Name of the innermost memory phase of the calling thread (empty if none).
+ */
+inline std::string const& current_memory_phase()
+{
+  static std::string const unannotated{};
+  auto const& phases = detail::memory_phase_stack();
+  return phases.empty() ? unannotated : phases.back().second;
+}
+
+/**
+ * @brief RAII object annotating allocations made by the calling thread during its lifetime.
+ *
+ * Phase names are expected to be qualified by the algorithm (e.g. "louvain/coarsen",
+ * "renumber/hash_build"). Annotating is cheap and has no effect unless a tracking resource adaptor
+ * is installed. Ranges are normally nested, but a range held in a longer-lived object (e.g. a
+ * std::optional member) may end out of order; it then removes its own entry and the innermost
+ * phase stays the most recently started one still alive.
+ */
+class memory_phase_range_t {
+ public:
+  explicit memory_phase_range_t(std::string name) : id_{detail::next_memory_phase_range_id()}
+  {
+    detail::memory_phase_stack().emplace_back(id_, std::move(name));
+  }
+  ~memory_phase_range_t()
+  {
+    auto& phases = detail::memory_phase_stack();
+    auto it      = std::find_if(
+      phases.rbegin(), phases.rend(), [id = id_](auto const& phase) { return phase.first == id; });
+    if (it != phases.rend()) { phases.erase(std::next(it).base()); }
+  }
+
+  memory_phase_range_t(memory_phase_range_t const&) = delete;
+  memory_phase_range_t& operator=(memory_phase_range_t const&) = delete;
+
+ private:
+  size_t id_{};
+};
+
+/**
+ * @brief Thread-safe per-phase allocation bookkeeping shared by the tracking resource adaptors.
+ */
+class memory_tracker_t {
+ public:
+  void record_allocation(void* ptr, size_t bytes)
+  {
+    if (ptr == nullptr) { return; }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = phase_stats_.try_emplace(current_memory_phase()).first;
+    add(it->second, bytes);
+    add(total_stats_, bytes);
+    ptr_phases_[ptr] = &(it->first);
+  }
+
+  void record_deallocation(void* ptr, size_t bytes)
+  {
+    if (ptr == nullptr) { return; }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto ptr_it = ptr_phases_.find(ptr);
+    if (ptr_it == ptr_phases_.end()) { return; }  // allocated before tracking started
+    subtract(phase_stats_[*(ptr_it->second)], bytes);
+    subtract(total_stats_, bytes);
+    ptr_phases_.erase(ptr_it);
+  }
+
+  /**
+   * @brief Statistics of every phase that made at least one allocation, keyed by phase name (the
+   * empty name collects unannotated allocations).
+   */
+  std::map<std::string, memory_phase_stats_t> phase_stats() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return phase_stats_;
+  }
+
+  /**
+   * @brief Statistics aggregated over all phases (peak_bytes is the overall high-water mark).
+   */
+  memory_phase_stats_t total_stats() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return total_stats_;
+  }
+
+  /**
+   * @brief Reset peak_bytes to current_bytes and drop the allocation counters, live allocations
+   * remain tracked.
+   */
+  void reset()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& [name, stats] : phase_stats_) {
+      stats = memory_phase_stats_t{stats.current_bytes, stats.current_bytes, 0, 0, 0};
+    }
+    total_stats_ = memory_phase_stats_t{
+      total_stats_.current_bytes, total_stats_.current_bytes, 0, 0, 0};
+  }
+
+  void print(std::ostream& os) const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto print_stats = [&os](std::string const& name, memory_phase_stats_t const& stats) {
+      os << name << ": peak " << stats.peak_bytes << " B, live " << stats.current_bytes
+         << " B, allocated " << stats.total_bytes << " B in " << stats.num_allocations
+         << " allocations (" << stats.num_deallocations << " freed)\n";
+    };
+    for (auto const& [name, stats] : phase_stats_) {
+      print_stats(name.empty() ? std::string("(unannotated)") : name, stats);
+    }
+    print_stats("(total)", total_stats_);
+  }
+
+ private:
+  static void add(memory_phase_stats_t& stats, size_t bytes)
+  {
+    stats.current_bytes += bytes;
+    stats.peak_bytes = std::max(stats.peak_bytes, stats.current_bytes);
+    stats.total_bytes += bytes;
+    ++stats.num_allocations;
+  }
+
+  static void subtract(memory_phase_stats_t& stats, size_t bytes)
+  {
+    stats.current_bytes -= std::min(stats.current_bytes, bytes);
+    ++stats.num_deallocations;
+  }
+
+  mutable std::mutex mutex_{};
+  std::map<std::string, memory_phase_stats_t> phase_stats_{};  // node based, keys are stable
+  memory_phase_stats_t total_stats_{};
+  std::unordered_map<void*, std::string const*> ptr_phases_{};
+};
+
+/**
+ * @brief Device memory resource adaptor recording per-phase allocation statistics.
+ *
+ * Install with rmm::mr::set_current_device_resource() to instrument every allocation made by
+ * cuGraph (and anything else using the current device resource).
+ *
+ * @tparam Upstream Type of the upstream device memory resource.
+ */
+template <typename Upstream>
+class phase_tracking_resource_adaptor final : public rmm::mr::device_memory_resource {
+ public:
+  explicit phase_tracking_resource_adaptor(Upstream* upstream) : upstream_{upstream}
+  {
+    CUGRAPH_EXPECTS(upstream != nullptr, "Invalid input argument: upstream should not be nullptr.");
+  }
+
+  Upstream* get_upstream() const noexcept { return upstream_; }
+
+  memory_tracker_t& tracker() noexcept { return tracker_; }
+  memory_tracker_t const& tracker() const noexcept { return tracker_; }
+
+  bool supports_streams() const noexcept override { return upstream_->supports_streams(); }
+  bool supports_get_mem_info() const noexcept override
+  {
+    return upstream_->supports_get_mem_info();
+  }
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    auto ptr = upstream_->allocate(bytes, stream);
+    tracker_.record_allocation(ptr, bytes);
+    return ptr;
+  }
+
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    // record first, the upstream may hand the same address to another thread right away
+    tracker_.record_deallocation(ptr, bytes);
+    upstream_->deallocate(ptr, bytes, stream);
+  }
+
+  bool do_is_equal(rmm::mr::device_memory_resource const& other) const noexcept override
+  {
+    if (this == &other) { return true; }
+    auto cast = dynamic_cast<phase_tracking_resource_adaptor<Upstream> const*>(&other);
+    return cast != nullptr ? upstream_->is_equal(*cast->get_upstream())
+                           : upstream_->is_equal(other);
+  }
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(rmm::cuda_stream_view stream) const override
+  {
+    return upstream_->get_mem_info(stream);
+  }
+
+  Upstream* upstream_{nullptr};
+  memory_tracker_t tracker_{};
+};
+
+/**
+ * @brief Host memory resource adaptor recording per-phase allocation statistics.
+ *
+ * @tparam Upstream Type of the upstream host memory resource.
+ */
+template <typename Upstream>
+class phase_tracking_host_resource_adaptor final : public rmm::mr::host_memory_resource {
+ public:
+  explicit phase_tracking_host_resource_adaptor(Upstream* upstream) : upstream_{upstream}
+  {
+    CUGRAPH_EXPECTS(upstream != nullptr, "Invalid input argument: upstream should not be nullptr.");
+  }
+
+  Upstream* get_upstream() const noexcept { return upstream_; }
+
+  memory_tracker_t& tracker() noexcept { return tracker_; }
+  memory_tracker_t const& tracker() const noexcept { return tracker_; }
+
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override
+  {
+    auto ptr = upstream_->allocate(bytes, alignment);
+    tracker_.record_allocation(ptr, bytes);
+    return ptr;
+  }
+
+  void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override
+  {
+    tracker_.record_deallocation(ptr, bytes);
+    upstream_->deallocate(ptr, bytes, alignment);
+  }
+
+  bool do_is_equal(rmm::mr::host_memory_resource const& other) const noexcept override
+  {
+    if (this == &other) { return true; }
+    auto cast = dynamic_cast<phase_tracking_host_resource_adaptor<Upstream> const*>(&other);
+    return cast != nullptr ? upstream_->is_equal(*cast->get_upstream())
+                           : upstream_->is_equal(other);
+  }
+
+  Upstream* upstream_{nullptr};
+  memory_tracker_t tracker_{};
+};
+
+}  // namespace cugraph
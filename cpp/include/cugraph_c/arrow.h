@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cugraph_c/array.h>
+#include <cugraph_c/centrality_algorithms.h>
+#include <cugraph_c/error.h>
+#include <cugraph_c/resource_handle.h>
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Arrow C data interface and C device data interface structures, as defined (to be copied
+// verbatim) by the Arrow specification. These let Arrow producers and consumers (Arrow IPC
+// readers, Parquet readers decoding one row group at a time, ...) exchange buffers with this API
+// without a build dependency on Arrow.
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+  // Array type description
+  const char* format;
+  const char* name;
+  const char* metadata;
+  int64_t flags;
+  int64_t n_children;
+  struct ArrowSchema** children;
+  struct ArrowSchema* dictionary;
+
+  // Release callback
+  void (*release)(struct ArrowSchema*);
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+struct ArrowArray {
+  // Array data description
+  int64_t length;
+  int64_t null_count;
+  int64_t offset;
+  int64_t n_buffers;
+  int64_t n_children;
+  const void** buffers;
+  struct ArrowArray** children;
+  struct ArrowArray* dictionary;
+
+  // Release callback
+  void (*release)(struct ArrowArray*);
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+#endif  // ARROW_C_DATA_INTERFACE
+
+#ifndef ARROW_C_DEVICE_DATA_INTERFACE
+#define ARROW_C_DEVICE_DATA_INTERFACE
+
+typedef int32_t ArrowDeviceType;
+
+#define ARROW_DEVICE_CPU 1
+#define ARROW_DEVICE_CUDA 2
+#define ARROW_DEVICE_CUDA_HOST 3
+#define ARROW_DEVICE_CUDA_MANAGED 13
+
+struct ArrowDeviceArray {
+  struct ArrowArray array;
+  int64_t device_id;
+  ArrowDeviceType device_type;
+  void* sync_event;
+  int64_t reserved[3];
+};
+
+#endif  // ARROW_C_DEVICE_DATA_INTERFACE
+
+/**
+ * @brief     Create a type erased device array view of an Arrow array (zero-copy)
+ *
+ * The Arrow array should be a primitive array of int32, int64, float32, or float64 values without
+ * nulls, in memory accessible from the device (ARROW_DEVICE_CUDA, ARROW_DEVICE_CUDA_HOST, or
+ * ARROW_DEVICE_CUDA_MANAGED). The view points to the Arrow data buffer (adjusted by the array
+ * offset), so the Arrow array should not be released while the view is in use. The returned view
+ * can be passed as the src/dst/weight arrays to graph creation.
+ *
+ * @param [in]  handle      Handle for accessing resources. If @p array->sync_event is not NULL,
+ *                          work subsequently enqueued on the handle's stream waits for the event.
+ * @param [in]  array       Arrow device array
+ * @param [in]  schema      Arrow schema of @p array
+ * @param [out] view        Pointer to the location to store the pointer to the device array view
+ * @param [out] error       Pointer to an error object storing details of any error.  Will
+ *                          be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_type_erased_device_array_view_from_arrow(
+  const cugraph_resource_handle_t* handle,
+  const struct ArrowDeviceArray* array,
+  const struct ArrowSchema* schema,
+  cugraph_type_erased_device_array_view_t** view,
+  cugraph_error_t** error);
+
+/**
+ * @brief     Create a type erased host array view of an Arrow array (zero-copy)
+ *
+ * The Arrow array should be a primitive array of int32, int64, float32, or float64 values without
+ * nulls. The view points to the Arrow data buffer (adjusted by the array offset), so the Arrow
+ * array should not be released while the view is in use. This does not use the device, use
+ * cugraph_type_erased_device_array_view_copy_from_host to move the values to device memory (e.g.
+ * one Parquet row group at a time into a slice of a preallocated device array).
+ *
+ * @param [in]  array       Arrow array
+ * @param [in]  schema      Arrow schema of @p array
+ * @param [out] view        Pointer to the location to store the pointer to the host array view
+ * @param [out] error       Pointer to an error object storing details of any error.  Will
+ *                          be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_type_erased_host_array_view_from_arrow(
+  const struct ArrowArray* array,
+  const struct ArrowSchema* schema,
+  cugraph_type_erased_host_array_view_t** view,
+  cugraph_error_t** error);
+
+/**
+ * @brief     Export a type erased device array as an Arrow device array (zero-copy)
+ *
+ * The exported Arrow array takes ownership of @p array; @p array should not be used or freed
+ * afterwards, the device memory is freed when the Arrow array is released.
+ *
+ * @param [in]  handle      Handle for accessing resources. The handle's stream is synchronized
+ *                          so the values are ready when this function returns.
+ * @param [in]  array       Type erased device array to export
+ * @param [out] out_array   Arrow device array to fill
+ * @param [out] out_schema  Arrow schema to fill
+ * @param [out] error       Pointer to an error object storing details of any error.  Will
+ *                          be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_type_erased_device_array_export_arrow(
+  const cugraph_resource_handle_t* handle,
+  cugraph_type_erased_device_array_t* array,
+  struct ArrowDeviceArray* out_array,
+  struct ArrowSchema* out_schema,
+  cugraph_error_t** error);
+
+/**
+ * @brief     Export a type erased host array as an Arrow array (zero-copy)
+ *
+ * The exported Arrow array takes ownership of @p array; @p array should not be used or freed
+ * afterwards, the host memory is freed when the Arrow array is released.
+ *
+ * @param [in]  array       Type erased host array to export
+ * @param [out] out_array   Arrow array to fill
+ * @param [out] out_schema  Arrow schema to fill
+ * @param [out] error       Pointer to an error object storing details of any error.  Will
+ *                          be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_type_erased_host_array_export_arrow(
+  cugraph_type_erased_host_array_t* array,
+  struct ArrowArray* out_array,
+  struct ArrowSchema* out_schema,
+  cugraph_error_t** error);
+
+/**
+ * @brief     Export a centrality result as an Arrow record batch (zero-copy)
+ *
+ * The record batch is exported as an Arrow struct array with two columns, "vertex" and "value".
+ * The vertex IDs and values are moved out of @p result into the exported Arrow array (and freed
+ * when the Arrow array is released); @p result should still be freed with
+ * cugraph_centrality_result_free, but its vertex IDs and values should not be accessed anymore.
+ *
+ * @param [in]  handle      Handle for accessing resources. The handle's stream is synchronized
+ *                          so the values are ready when this function returns.
+ * @param [in]  result      The result from a centrality algorithm
+ * @param [out] out_array   Arrow device array to fill
+ * @param [out] out_schema  Arrow schema to fill
+ * @param [out] error       Pointer to an error object storing details of any error.  Will
+ *                          be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_centrality_result_export_arrow(const cugraph_resource_handle_t* handle,
+                                                            cugraph_centrality_result_t* result,
+                                                            struct ArrowDeviceArray* out_array,
+                                                            struct ArrowSchema* out_schema,
+                                                            cugraph_error_t** error);
+
+#ifdef __cplusplus
+}
+#endif
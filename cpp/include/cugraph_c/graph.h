@@ -31,6 +31,22 @@ typedef struct {
   bool_t is_multigraph;
 } cugraph_graph_properties_t;
 
+/**
+ * @brief     Policy for keeping the two storage orientations of a graph
+ *
+ * Some algorithms (e.g. PageRank) require the graph stored transposed and others (e.g. BFS)
+ * require the graph stored non-transposed, a graph stored in the other orientation is transposed
+ * when such an algorithm is called. With CUGRAPH_ORIENTATION_KEEP_ONE, the previous orientation is
+ * discarded, so alternating between these algorithms re-transposes the graph on every call. The
+ * other policies keep the previous orientation once it is materialized, trading memory for
+ * avoiding the re-transposition.
+ */
+typedef enum {
+  CUGRAPH_ORIENTATION_KEEP_ONE  = 0, /** Keep only the orientation in use (default) */
+  CUGRAPH_ORIENTATION_KEEP_BOTH = 1, /** Keep both orientations once materialized */
+  CUGRAPH_ORIENTATION_BUDGETED  = 2  /** Keep both orientations if each fits in the budget */
+} cugraph_orientation_policy_t;
+
 // FIXME: Add support for specifying isolated vertices
 /**
  * @brief     Construct an SG graph
@@ -116,6 +132,29 @@ cugraph_error_code_t cugraph_mg_graph_create(const cugraph_resource_handle_t* ha
 //         but didn't want to confuse with original cugraph_free_graph
 void cugraph_mg_graph_free(cugraph_graph_t* graph);
 
+/**
+ * @brief     Set the policy for keeping the two storage orientations of a graph
+ *
+ * Switching to CUGRAPH_ORIENTATION_KEEP_ONE (or to a budget the graph does not fit) releases the
+ * orientation not in use. In multi-GPU, this should be called on every GPU with the same
+ * arguments.
+ *
+ * @param [in]  handle       Handle for accessing resources
+ * @param [in]  graph        A pointer to the graph object
+ * @param [in]  policy       The policy
+ * @param [in]  budget_bytes Memory budget (in bytes per GPU) for one orientation, ignored unless
+ *                           @p policy is CUGRAPH_ORIENTATION_BUDGETED
+ * @param [out] error        Pointer to an error object storing details of any error.  Will
+ *                           be populated if error code is not CUGRAPH_SUCCESS
+ *
+ * @return error code
+ */
+cugraph_error_code_t cugraph_graph_set_orientation_policy(const cugraph_resource_handle_t* handle,
+                                                          cugraph_graph_t* graph,
+                                                          cugraph_orientation_policy_t policy,
+                                                          size_t budget_bytes,
+                                                          cugraph_error_t** error);
+
 #ifdef __cplusplus
 }
 #endif
@@ -68,6 +68,19 @@ cugraph_type_erased_device_array_view_t* cugraph_paths_result_get_distances(
 cugraph_type_erased_device_array_view_t* cugraph_paths_result_get_predecessors(
   cugraph_paths_result_t* result);
 
+/**
+ * @brief     Get the request offsets from the paths result
+ *
+ * Set only by batched algorithms (e.g. cugraph_bfs_batched), the vertices, distances and
+ * predecessors of request i are stored in the range [offsets[i], offsets[i + 1]).
+ *
+ * @param [in]   result   The result from a batched algorithm
+ * @return type erased array of offsets (INT64, size = number of requests + 1).  Value will be NULL
+ *         if the result was not produced by a batched algorithm.
+ */
+cugraph_type_erased_device_array_view_t* cugraph_paths_result_get_offsets(
+  cugraph_paths_result_t* result);
+
 /**
  * @brief     Free paths result
  *
@@ -114,6 +127,58 @@ cugraph_error_code_t cugraph_bfs(
   cugraph_paths_result_t** result,
   cugraph_error_t** error);
 
+/**
+ * @brief     Perform a batch of independent breadth first searches, one per source vertex.
+ *
+ * Request i computes the distances (and optionally the predecessors) of the vertices within
+ * depth_limits[i] hops of sources[i].  All the requests are advanced together one hop at a time,
+ * so a large number of small (e.g. depth limited) searches is executed with the per call setup
+ * and the graph passes of a single search.
+ *
+ * A request stops expanding early once it reaches its target (if @p targets is not NULL) or once
+ * it has visited @p vertex_budget vertices or examined @p edge_budget edges; the vertices visited
+ * up to that hop are still returned.  Traversal state is kept only for the visited vertices, so a
+ * small query costs time and memory proportional to the vertices it touches, not to the graph.
+ *
+ * Only the vertices reached by each request are returned.  The results of request i are stored
+ * in the range [offsets[i], offsets[i + 1]) of the vertices, distances and predecessors arrays,
+ * see cugraph_paths_result_get_offsets.  In a multi-GPU context the results of the requests
+ * submitted by a GPU are returned to that GPU.
+ *
+ * @param [in]  handle       Handle for accessing resources
+ * @param [in]  graph        Pointer to graph
+ * @param [in]  sources      Array of source vertices, one per request
+ * @param [in]  depth_limits Optional array (same size and type as @p sources) of the maximum
+ *                           number of hops of each request.  If NULL, @p depth_limit is used for
+ *                           every request
+ * @param [in]  depth_limit  Maximum number of hops of every request if @p depth_limits is NULL
+ * @param [in]  targets      Optional array (same size and type as @p sources) of the target
+ *                           vertex of each request.  If NULL, no request stops at a target
+ * @param [in]  vertex_budget Maximum number of vertices to visit per request (0 for no limit)
+ * @param [in]  edge_budget  Maximum number of edges to examine per request (0 for no limit)
+ * @param [in]  compute_predecessors A flag to indicate whether to compute the predecessors in the
+ * result
+ * @param [in]  do_expensive_check A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ * @param [out] result       Opaque pointer to paths results
+ * @param [out] error        Pointer to an error object storing details of any error.  Will
+ *                           be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_bfs_batched(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_view_t* sources,
+  const cugraph_type_erased_device_array_view_t* depth_limits,
+  size_t depth_limit,
+  const cugraph_type_erased_device_array_view_t* targets,
+  size_t vertex_budget,
+  size_t edge_budget,
+  bool_t compute_predecessors,
+  bool_t do_expensive_check,
+  cugraph_paths_result_t** result,
+  cugraph_error_t** error);
+
 /**
  * @brief     Perform single-source shortest-path to compute the minimum distances
  *            (and predecessors) from the source vertex.
@@ -144,6 +209,52 @@ cugraph_error_code_t cugraph_sssp(const cugraph_resource_handle_t* handle,
                                   cugraph_paths_result_t** result,
                                   cugraph_error_t** error);
 
+/**
+ * @brief     Compute the shortest path between each (source, target) pair.
+ *
+ * Each search only explores the vertices that can lie on a path shorter than the best path to
+ * the target found so far, instead of computing the distances to every vertex as in
+ * cugraph_sssp. If heuristic values are provided, the search is goal-directed (A*), the values
+ * should be admissible (never exceed the distance from the vertex to any target in the batch) for
+ * the returned paths to be shortest paths. Every pair is searched at the same time.
+ *
+ * If the graph keeps both storage orientations (see cugraph_graph_set_orientation_policy) and the
+ * graph was created with store_transposed set (or was transposed before), the targets are searched
+ * backward at the same time as the sources are searched forward (bidirectional search), the
+ * heuristic values are used by the forward search only.
+ *
+ * The path of pair i is stored in the range [offsets[i], offsets[i + 1]) of the vertices (from the
+ * source to the target) and distances (from the source) in the result, see
+ * cugraph_paths_result_get_offsets.  The path is empty if the target is not reachable within
+ * @p cutoff.  Predecessors are not stored, the previous vertex in the path is the predecessor.
+ *
+ * @param [in]  handle       Handle for accessing resources
+ * @param [in]  graph        Pointer to graph
+ * @param [in]  sources      Source vertex of each pair
+ * @param [in]  targets      Target vertex of each pair
+ * @param [in]  heuristic_vertices Optional vertex ids for the heuristic values, vertices not in
+ *                           the list get 0 (NULL if no heuristic is used)
+ * @param [in]  heuristic_values   Optional heuristic values (NULL if no heuristic is used)
+ * @param [in]  cutoff       Maximum edge weight sum to consider
+ * @param [in]  do_expensive_check A flag to run expensive checks for input arguments (if set to
+ * `true`).
+ * @param [out] result       Opaque pointer to paths results
+ * @param [out] error        Pointer to an error object storing details of any error.  Will
+ *                           be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_point_to_point_shortest_paths(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_view_t* sources,
+  const cugraph_type_erased_device_array_view_t* targets,
+  const cugraph_type_erased_device_array_view_t* heuristic_vertices,
+  const cugraph_type_erased_device_array_view_t* heuristic_values,
+  double cutoff,
+  bool_t do_expensive_check,
+  cugraph_paths_result_t** result,
+  cugraph_error_t** error);
+
 /**
  * @brief     Opaque extract_paths result type
  */
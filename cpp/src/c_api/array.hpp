@@ -26,6 +26,7 @@ namespace cugraph {
 namespace c_api {
 
 extern cugraph::visitors::DTypes dtypes_mapping[data_type_id_t::NTYPES];
+extern size_t data_type_sz[data_type_id_t::NTYPES];
 
 struct cugraph_type_erased_device_array_view_t {
   void* data_;
@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cugraph_c/arrow.h>
+
+#include <c_api/array.hpp>
+#include <c_api/centrality_result.hpp>
+#include <c_api/error.hpp>
+#include <c_api/resource_handle.hpp>
+
+#include <raft/cudart_utils.h>
+
+#include <cuda_runtime_api.h>
+
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace cugraph {
+namespace c_api {
+
+namespace {
+
+// Arrow format strings of the supported primitive types, indexed by data_type_id_t
+char const* arrow_formats[] = {"i", "l", "f", "g"};
+
+std::optional<data_type_id_t> data_type_from_arrow_format(char const* format)
+{
+  if (format == nullptr) { return std::nullopt; }
+  for (int i = 0; i < data_type_id_t::NTYPES; ++i) {
+    if (std::strcmp(format, arrow_formats[i]) == 0) { return static_cast<data_type_id_t>(i); }
+  }
+  return std::nullopt;
+}
+
+// returns an error message if the Arrow array can't be viewed as a type erased array
+std::optional<std::string> check_arrow_primitive_array(ArrowArray const* array,
+                                                       ArrowSchema const* schema)
+{
+  if ((array == nullptr) || (schema == nullptr) || (array->release == nullptr)) {
+    return std::string{"invalid (or released) Arrow array or schema"};
+  }
+  if (!data_type_from_arrow_format(schema->format)) {
+    return std::string{"unsupported Arrow type, should be int32, int64, float32, or float64"};
+  }
+  if ((array->n_buffers != 2) || (array->n_children != 0) || (array->dictionary != nullptr)) {
+    return std::string{"Arrow array should be a primitive array"};
+  }
+  if ((array->null_count != 0) && (array->buffers[0] != nullptr)) {
+    return std::string{"Arrow array should not have nulls"};
+  }
+  return std::nullopt;
+}
+
+struct arrow_array_private_t {
+  std::unique_ptr<cugraph_type_erased_device_array_t> device_array{};
+  std::unique_ptr<cugraph_type_erased_host_array_t> host_array{};
+  std::vector<void const*> buffers{};
+  std::vector<ArrowArray> children{};
+  std::vector<ArrowArray*> child_ptrs{};
+};
+
+struct arrow_schema_private_t {
+  std::string name{};
+  std::vector<ArrowSchema> children{};
+  std::vector<ArrowSchema*> child_ptrs{};
+};
+
+void release_arrow_array(ArrowArray* array)
+{
+  auto private_data = reinterpret_cast<arrow_array_private_t*>(array->private_data);
+  for (auto& child : private_data->children) {
+    if (child.release != nullptr) { child.release(&child); }
+  }
+  delete private_data;
+  array->release = nullptr;
+}
+
+void release_arrow_schema(ArrowSchema* schema)
+{
+  auto private_data = reinterpret_cast<arrow_schema_private_t*>(schema->private_data);
+  for (auto& child : private_data->children) {
+    if (child.release != nullptr) { child.release(&child); }
+  }
+  delete private_data;
+  schema->release = nullptr;
+}
+
+void fill_arrow_array(ArrowArray* array, int64_t length, arrow_array_private_t* private_data)
+{
+  array->length     = length;
+  array->null_count = 0;
+  array->offset     = 0;
+  array->n_buffers  = static_cast<int64_t>(private_data->buffers.size());
+  array->n_children = static_cast<int64_t>(private_data->child_ptrs.size());
+  array->buffers    = private_data->buffers.data();
+  array->children =
+    private_data->child_ptrs.empty() ? nullptr : private_data->child_ptrs.data();
+  array->dictionary   = nullptr;
+  array->release      = release_arrow_array;
+  array->private_data = private_data;
+}
+
+void fill_arrow_schema(ArrowSchema* schema,
+                       char const* format,
+                       std::string const& name,
+                       arrow_schema_private_t* private_data)
+{
+  private_data->name = name;
+
+  schema->format     = format;
+  schema->name       = private_data->name.c_str();
+  schema->metadata   = nullptr;
+  schema->flags      = 0;
+  schema->n_children = static_cast<int64_t>(private_data->child_ptrs.size());
+  schema->children =
+    private_data->child_ptrs.empty() ? nullptr : private_data->child_ptrs.data();
+  schema->dictionary   = nullptr;
+  schema->release      = release_arrow_schema;
+  schema->private_data = private_data;
+}
+
+// move a device array into a (child) Arrow array & schema
+void export_device_array(cugraph_type_erased_device_array_t* device_array,
+                         std::string const& name,
+                         ArrowArray* out_array,
+                         ArrowSchema* out_schema)
+{
+  auto array_private_data = new arrow_array_private_t{};
+  array_private_data->device_array.reset(device_array);
+  array_private_data->buffers = {nullptr, device_array->data_.data()};
+  fill_arrow_array(out_array, static_cast<int64_t>(device_array->size_), array_private_data);
+
+  fill_arrow_schema(
+    out_schema, arrow_formats[device_array->type_], name, new arrow_schema_private_t{});
+}
+
+void fill_arrow_device_array(ArrowDeviceArray* out_array)
+{
+  int device_id{};
+  RAFT_CUDA_TRY(cudaGetDevice(&device_id));
+  out_array->device_id   = device_id;
+  out_array->device_type = ARROW_DEVICE_CUDA;
+  out_array->sync_event  = nullptr;
+  std::memset(out_array->reserved, 0, sizeof(out_array->reserved));
+}
+
+}  // namespace
+
+}  // namespace c_api
+}  // namespace cugraph
+
+extern "C" cugraph_error_code_t cugraph_type_erased_device_array_view_from_arrow(
+  const cugraph_resource_handle_t* handle,
+  const struct ArrowDeviceArray* array,
+  const struct ArrowSchema* schema,
+  cugraph_type_erased_device_array_view_t** view,
+  cugraph_error_t** error)
+{
+  *view  = nullptr;
+  *error = nullptr;
+
+  try {
+    if (!handle) {
+      *error = reinterpret_cast<cugraph_error_t*>(
+        new cugraph::c_api::cugraph_error_t{"invalid resource handle"});
+      return CUGRAPH_INVALID_HANDLE;
+    }
+
+    auto error_message = cugraph::c_api::check_arrow_primitive_array(
+      array != nullptr ? &(array->array) : nullptr, schema);
+    if (!error_message && (array->device_type != ARROW_DEVICE_CUDA) &&
+        (array->device_type != ARROW_DEVICE_CUDA_HOST) &&
+        (array->device_type != ARROW_DEVICE_CUDA_MANAGED)) {
+      error_message = std::string{
+        "Arrow array is not accessible from the device, use "
+        "cugraph_type_erased_host_array_view_from_arrow instead"};
+    }
+    if (error_message) {
+      *error = reinterpret_cast<cugraph_error_t*>(
+        new cugraph::c_api::cugraph_error_t{error_message->c_str()});
+      return CUGRAPH_INVALID_INPUT;
+    }
+
+    auto p_handle = reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle);
+    if (array->sync_event != nullptr) {
+      RAFT_CUDA_TRY(cudaStreamWaitEvent(p_handle->handle_->get_stream(),
+                                        *reinterpret_cast<cudaEvent_t*>(array->sync_event),
+                                        0));
+    }
+
+    auto dtype   = *(cugraph::c_api::data_type_from_arrow_format(schema->format));
+    auto elem_sz = cugraph::c_api::data_type_sz[dtype];
+    auto n_elems = static_cast<size_t>(array->array.length);
+    auto pointer =
+      const_cast<std::byte*>(static_cast<std::byte const*>(array->array.buffers[1])) +
+      static_cast<size_t>(array->array.offset) * elem_sz;
+
+    *view = reinterpret_cast<cugraph_type_erased_device_array_view_t*>(
+      new cugraph::c_api::cugraph_type_erased_device_array_view_t{
+        pointer, n_elems, n_elems * elem_sz, dtype});
+    return CUGRAPH_SUCCESS;
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+}
+
+extern "C" cugraph_error_code_t cugraph_type_erased_host_array_view_from_arrow(
+  const struct ArrowArray* array,
+  const struct ArrowSchema* schema,
+  cugraph_type_erased_host_array_view_t** view,
+  cugraph_error_t** error)
+{
+  *view  = nullptr;
+  *error = nullptr;
+
+  try {
+    auto error_message = cugraph::c_api::check_arrow_primitive_array(array, schema);
+    if (error_message) {
+      *error = reinterpret_cast<cugraph_error_t*>(
+        new cugraph::c_api::cugraph_error_t{error_message->c_str()});
+      return CUGRAPH_INVALID_INPUT;
+    }
+
+    auto dtype   = *(cugraph::c_api::data_type_from_arrow_format(schema->format));
+    auto elem_sz = cugraph::c_api::data_type_sz[dtype];
+    auto n_elems = static_cast<size_t>(array->length);
+    auto pointer = const_cast<std::byte*>(static_cast<std::byte const*>(array->buffers[1])) +
+                   static_cast<size_t>(array->offset) * elem_sz;
+
+    *view = reinterpret_cast<cugraph_type_erased_host_array_view_t*>(
+      new cugraph::c_api::cugraph_type_erased_host_array_view_t{
+        pointer, n_elems, n_elems * elem_sz, dtype});
+    return CUGRAPH_SUCCESS;
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+}
+
+extern "C" cugraph_error_code_t cugraph_type_erased_device_array_export_arrow(
+  const cugraph_resource_handle_t* handle,
+  cugraph_type_erased_device_array_t* array,
+  struct ArrowDeviceArray* out_array,
+  struct ArrowSchema* out_schema,
+  cugraph_error_t** error)
+{
+  *error = nullptr;
+
+  try {
+    if (!handle) {
+      *error = reinterpret_cast<cugraph_error_t*>(
+        new cugraph::c_api::cugraph_error_t{"invalid resource handle"});
+      return CUGRAPH_INVALID_HANDLE;
+    }
+
+    auto p_handle = reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle);
+    p_handle->handle_->sync_stream();
+
+    cugraph::c_api::fill_arrow_device_array(out_array);
+    cugraph::c_api::export_device_array(
+      reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_t*>(array),
+      std::string{},
+      &(out_array->array),
+      out_schema);
+
+    return CUGRAPH_SUCCESS;
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+}
+
+extern "C" cugraph_error_code_t cugraph_type_erased_host_array_export_arrow(
+  cugraph_type_erased_host_array_t* array,
+  struct ArrowArray* out_array,
+  struct ArrowSchema* out_schema,
+  cugraph_error_t** error)
+{
+  *error = nullptr;
+
+  try {
+    auto internal_pointer =
+      reinterpret_cast<cugraph::c_api::cugraph_type_erased_host_array_t*>(array);
+
+    auto array_private_data = new cugraph::c_api::arrow_array_private_t{};
+    array_private_data->host_array.reset(internal_pointer);
+    array_private_data->buffers = {nullptr, internal_pointer->data_.get()};
+    cugraph::c_api::fill_arrow_array(
+      out_array, static_cast<int64_t>(internal_pointer->size_), array_private_data);
+
+    cugraph::c_api::fill_arrow_schema(out_schema,
+                                      cugraph::c_api::arrow_formats[internal_pointer->type_],
+                                      std::string{},
+                                      new cugraph::c_api::arrow_schema_private_t{});
+
+    return CUGRAPH_SUCCESS;
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+}
+
+extern "C" cugraph_error_code_t cugraph_centrality_result_export_arrow(
+  const cugraph_resource_handle_t* handle,
+  cugraph_centrality_result_t* result,
+  struct ArrowDeviceArray* out_array,
+  struct ArrowSchema* out_schema,
+  cugraph_error_t** error)
+{
+  *error = nullptr;
+
+  try {
+    if (!handle) {
+      *error = reinterpret_cast<cugraph_error_t*>(
+        new cugraph::c_api::cugraph_error_t{"invalid resource handle"});
+      return CUGRAPH_INVALID_HANDLE;
+    }
+
+    auto p_handle = reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle);
+    auto internal_pointer =
+      reinterpret_cast<cugraph::c_api::cugraph_centrality_result_t*>(result);
+
+    if ((internal_pointer->vertex_ids_ == nullptr) || (internal_pointer->values_ == nullptr)) {
+      *error = reinterpret_cast<cugraph_error_t*>(
+        new cugraph::c_api::cugraph_error_t{"centrality result is already exported"});
+      return CUGRAPH_INVALID_INPUT;
+    }
+
+    p_handle->handle_->sync_stream();
+
+    auto array_private_data  = new cugraph::c_api::arrow_array_private_t{};
+    auto schema_private_data = new cugraph::c_api::arrow_schema_private_t{};
+    array_private_data->buffers = {nullptr};
+    array_private_data->children.resize(2);
+    schema_private_data->children.resize(2);
+
+    auto num_rows = static_cast<int64_t>(internal_pointer->vertex_ids_->size_);
+
+    cugraph::c_api::export_device_array(internal_pointer->vertex_ids_,
+                                        std::string{"vertex"},
+                                        &(array_private_data->children[0]),
+                                        &(schema_private_data->children[0]));
+    internal_pointer->vertex_ids_ = nullptr;
+    cugraph::c_api::export_device_array(internal_pointer->values_,
+                                        std::string{"value"},
+                                        &(array_private_data->children[1]),
+                                        &(schema_private_data->children[1]));
+    internal_pointer->values_ = nullptr;
+
+    for (size_t i = 0; i < 2; ++i) {
+      array_private_data->child_ptrs.push_back(&(array_private_data->children[i]));
+      schema_private_data->child_ptrs.push_back(&(schema_private_data->children[i]));
+    }
+
+    cugraph::c_api::fill_arrow_device_array(out_array);
+    cugraph::c_api::fill_arrow_array(&(out_array->array), num_rows, array_private_data);
+    cugraph::c_api::fill_arrow_schema(out_schema, "+s", std::string{}, schema_private_data);
+
+    return CUGRAPH_SUCCESS;
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+}
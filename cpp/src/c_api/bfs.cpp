@@ -27,6 +27,10 @@
 #include <cugraph/detail/utility_wrappers.hpp>
 #include <cugraph/graph_functions.hpp>
 
+#include <algorithm>
+#include <limits>
+#include <optional>
+
 namespace cugraph {
 namespace c_api {
 
@@ -104,13 +108,17 @@ struct bfs_functor : public abstract_functor {
       //
       // Need to renumber sources
       //
-      renumber_ext_vertices<vertex_t, multi_gpu>(handle_,
-                                                 sources.data(),
-                                                 sources.size(),
-                                                 number_map->data(),
-                                                 graph_view.local_vertex_partition_range_first(),
-                                                 graph_view.local_vertex_partition_range_last(),
-                                                 do_expensive_check_);
+      renumber_ext_vertices<vertex_t, multi_gpu>(
+        handle_,
+        sources.data(),
+        sources.size(),
+        cugraph::c_api::get_number_map_index<vertex_t, multi_gpu>(
+          handle_,
+          graph_,
+          graph_view.local_vertex_partition_range_first(),
+          graph_view.local_vertex_partition_range_last(),
+          do_expensive_check_),
+        do_expensive_check_);
 
       cugraph::bfs<vertex_t, edge_t, weight_t, multi_gpu>(
         handle_,
@@ -147,6 +155,166 @@ struct bfs_functor : public abstract_functor {
   }
 };
 
+struct bfs_batched_functor : public abstract_functor {
+  raft::handle_t const& handle_;
+  cugraph_graph_t* graph_;
+  cugraph_type_erased_device_array_view_t const* sources_;
+  cugraph_type_erased_device_array_view_t const* depth_limits_;
+  size_t depth_limit_;
+  cugraph_type_erased_device_array_view_t const* targets_;
+  size_t vertex_budget_;
+  size_t edge_budget_;
+  bool compute_predecessors_;
+  bool do_expensive_check_;
+  cugraph_paths_result_t* result_{};
+
+  bfs_batched_functor(::cugraph_resource_handle_t const* handle,
+                      ::cugraph_graph_t* graph,
+                      ::cugraph_type_erased_device_array_view_t const* sources,
+                      ::cugraph_type_erased_device_array_view_t const* depth_limits,
+                      size_t depth_limit,
+                      ::cugraph_type_erased_device_array_view_t const* targets,
+                      size_t vertex_budget,
+                      size_t edge_budget,
+                      bool compute_predecessors,
+                      bool do_expensive_check)
+    : abstract_functor(),
+      handle_(*reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle)->handle_),
+      graph_(reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph)),
+      sources_(
+        reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(sources)),
+      depth_limits_(
+        reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(
+          depth_limits)),
+      depth_limit_(depth_limit),
+      targets_(
+        reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(targets)),
+      vertex_budget_(vertex_budget),
+      edge_budget_(edge_budget),
+      compute_predecessors_(compute_predecessors),
+      do_expensive_check_(do_expensive_check)
+  {
+  }
+
+  template <typename vertex_t,
+            typename edge_t,
+            typename weight_t,
+            bool store_transposed,
+            bool multi_gpu>
+  void operator()()
+  {
+    if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
+      unsupported();
+    } else {
+      if ((depth_limits_ != nullptr) && ((depth_limits_->size_ != sources_->size_) ||
+                                         (depth_limits_->type_ != sources_->type_))) {
+        error_code_ = CUGRAPH_INVALID_INPUT;
+        error_->error_message_ =
+          "Invalid input arguments: depth_limits should have the same size and type as sources.";
+        return;
+      }
+
+      if ((targets_ != nullptr) &&
+          ((targets_->size_ != sources_->size_) || (targets_->type_ != sources_->type_))) {
+        error_code_ = CUGRAPH_INVALID_INPUT;
+        error_->error_message_ =
+          "Invalid input arguments: targets should have the same size and type as sources.";
+        return;
+      }
+
+      // BFS expects store_transposed == false
+      if constexpr (store_transposed) {
+        error_code_ = cugraph::c_api::
+          transpose_storage<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+            handle_, graph_, error_.get());
+        if (error_code_ != CUGRAPH_SUCCESS) return;
+      }
+
+      auto graph =
+        reinterpret_cast<cugraph::graph_t<vertex_t, edge_t, weight_t, false, multi_gpu>*>(
+          graph_->graph_);
+
+      auto graph_view = graph->view();
+
+      auto number_map = reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph_->number_map_);
+
+      rmm::device_uvector<vertex_t> sources(sources_->size_, handle_.get_stream());
+      raft::copy(
+        sources.data(), sources_->as_type<vertex_t>(), sources_->size_, handle_.get_stream());
+
+      std::optional<raft::device_span<vertex_t const>> depth_limits{std::nullopt};
+      if (depth_limits_ != nullptr) {
+        depth_limits = raft::device_span<vertex_t const>{depth_limits_->as_type<vertex_t>(),
+                                                         depth_limits_->size_};
+      }
+
+      //
+      // Need to renumber sources (and targets), the batched BFS does not require local sources so
+      // every vertex is translated in a single lookup against the cached renumber index
+      //
+      auto const& number_map_index = cugraph::c_api::get_number_map_index<vertex_t, multi_gpu>(
+        handle_,
+        graph_,
+        graph_view.local_vertex_partition_range_first(),
+        graph_view.local_vertex_partition_range_last(),
+        do_expensive_check_);
+
+      renumber_ext_vertices<vertex_t, multi_gpu>(
+        handle_, sources.data(), sources.size(), number_map_index, do_expensive_check_);
+
+      std::optional<rmm::device_uvector<vertex_t>> targets{std::nullopt};
+      if (targets_ != nullptr) {
+        targets = rmm::device_uvector<vertex_t>(targets_->size_, handle_.get_stream());
+        raft::copy(
+          targets->data(), targets_->as_type<vertex_t>(), targets_->size_, handle_.get_stream());
+        renumber_ext_vertices<vertex_t, multi_gpu>(
+          handle_, targets->data(), targets->size(), number_map_index, do_expensive_check_);
+      }
+
+      auto [offsets, vertices, distances, predecessors] =
+        cugraph::bfs_batched<vertex_t, edge_t, weight_t, multi_gpu>(
+          handle_,
+          graph_view,
+          raft::device_span<vertex_t const>{sources.data(), sources.size()},
+          depth_limits,
+          static_cast<vertex_t>(
+            std::min(depth_limit_, static_cast<size_t>(std::numeric_limits<vertex_t>::max()))),
+          compute_predecessors_,
+          targets ? std::make_optional<raft::device_span<vertex_t const>>(targets->data(),
+                                                                          targets->size())
+                  : std::nullopt,
+          vertex_budget_ > 0 ? std::make_optional(vertex_budget_) : std::nullopt,
+          edge_budget_ > 0 ? std::make_optional(edge_budget_) : std::nullopt,
+          do_expensive_check_);
+
+      std::vector<vertex_t> vertex_partition_range_lasts =
+        graph_view.vertex_partition_range_lasts();
+
+      unrenumber_int_vertices<vertex_t, multi_gpu>(handle_,
+                                                   vertices.data(),
+                                                   vertices.size(),
+                                                   number_map->data(),
+                                                   vertex_partition_range_lasts,
+                                                   do_expensive_check_);
+
+      if (compute_predecessors_) {
+        unrenumber_int_vertices<vertex_t, multi_gpu>(handle_,
+                                                     predecessors.data(),
+                                                     predecessors.size(),
+                                                     number_map->data(),
+                                                     vertex_partition_range_lasts,
+                                                     do_expensive_check_);
+      }
+
+      result_ = new cugraph_paths_result_t{
+        new cugraph_type_erased_device_array_t(vertices, graph_->vertex_type_),
+        new cugraph_type_erased_device_array_t(distances, graph_->vertex_type_),
+        new cugraph_type_erased_device_array_t(predecessors, graph_->vertex_type_),
+        new cugraph_type_erased_device_array_t(offsets, data_type_id_t::INT64)};
+    }
+  }
+};
+
 }  // namespace c_api
 }  // namespace cugraph
 
@@ -174,12 +342,23 @@ extern "C" cugraph_type_erased_device_array_view_t* cugraph_paths_result_get_pre
     internal_pointer->predecessors_->view());
 }
 
+extern "C" cugraph_type_erased_device_array_view_t* cugraph_paths_result_get_offsets(
+  cugraph_paths_result_t* result)
+{
+  auto internal_pointer = reinterpret_cast<cugraph::c_api::cugraph_paths_result_t*>(result);
+  return internal_pointer->offsets_ == nullptr
+           ? nullptr
+           : reinterpret_cast<cugraph_type_erased_device_array_view_t*>(
+               internal_pointer->offsets_->view());
+}
+
 extern "C" void cugraph_paths_result_free(cugraph_paths_result_t* result)
 {
   auto internal_pointer = reinterpret_cast<cugraph::c_api::cugraph_paths_result_t*>(result);
   delete internal_pointer->vertex_ids_;
   delete internal_pointer->distances_;
   delete internal_pointer->predecessors_;
+  delete internal_pointer->offsets_;
   delete internal_pointer;
 }
 
@@ -203,3 +382,31 @@ extern "C" cugraph_error_code_t cugraph_bfs(const cugraph_resource_handle_t* han
 
   return cugraph::c_api::run_algorithm(graph, functor, result, error);
 }
+
+extern "C" cugraph_error_code_t cugraph_bfs_batched(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_view_t* sources,
+  const cugraph_type_erased_device_array_view_t* depth_limits,
+  size_t depth_limit,
+  const cugraph_type_erased_device_array_view_t* targets,
+  size_t vertex_budget,
+  size_t edge_budget,
+  bool_t compute_predecessors,
+  bool_t do_expensive_check,
+  cugraph_paths_result_t** result,
+  cugraph_error_t** error)
+{
+  cugraph::c_api::bfs_batched_functor functor(handle,
+                                              graph,
+                                              sources,
+                                              depth_limits,
+                                              depth_limit,
+                                              targets,
+                                              vertex_budget,
+                                              edge_budget,
+                                              compute_predecessors,
+                                              do_expensive_check);
+
+  return cugraph::c_api::run_algorithm(graph, functor, result, error);
+}
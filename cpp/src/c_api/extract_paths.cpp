@@ -102,21 +102,29 @@ struct extract_paths_functor : public abstract_functor {
       //
       // Need to renumber destinations
       //
-      renumber_ext_vertices<vertex_t, multi_gpu>(handle_,
-                                                 destinations.data(),
-                                                 destinations.size(),
-                                                 number_map->data(),
-                                                 graph_view.local_vertex_partition_range_first(),
-                                                 graph_view.local_vertex_partition_range_last(),
-                                                 false);
-
-      renumber_ext_vertices<vertex_t, multi_gpu>(handle_,
-                                                 predecessors.data(),
-                                                 predecessors.size(),
-                                                 number_map->data(),
-                                                 graph_view.local_vertex_partition_range_first(),
-                                                 graph_view.local_vertex_partition_range_last(),
-                                                 false);
+      renumber_ext_vertices<vertex_t, multi_gpu>(
+        handle_,
+        destinations.data(),
+        destinations.size(),
+        cugraph::c_api::get_number_map_index<vertex_t, multi_gpu>(
+          handle_,
+          graph_,
+          graph_view.local_vertex_partition_range_first(),
+          graph_view.local_vertex_partition_range_last(),
+          false),
+        false);
+
+      renumber_ext_vertices<vertex_t, multi_gpu>(
+        handle_,
+        predecessors.data(),
+        predecessors.size(),
+        cugraph::c_api::get_number_map_index<vertex_t, multi_gpu>(
+          handle_,
+          graph_,
+          graph_view.local_vertex_partition_range_first(),
+          graph_view.local_vertex_partition_range_last(),
+          false),
+        false);
 
       auto [result, max_path_length] =
         cugraph::extract_bfs_paths<vertex_t, edge_t, weight_t, multi_gpu>(
@@ -20,8 +20,15 @@
 #include <cugraph_c/graph.h>
 
 #include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
 
 #include <memory>
+#include <utility>
 
 namespace cugraph {
 namespace c_api {
@@ -35,8 +42,111 @@ struct cugraph_graph_t {
 
   void* graph_;       // graph_t<...>*
   void* number_map_;  // rmm::device_uvector<vertex_t>*
+
+  // renumber_index_t<vertex_t, multi_gpu>* over number_map_, built on first use by
+  // get_number_map_index() and reused by every call translating external vertex IDs until
+  // number_map_ changes
+  void* number_map_index_{nullptr};
+
+  // the other storage orientation (graph_t<..., !store_transposed_, ...>*) with its own number map
+  // (and number map index), kept per orientation_policy_ when the graph is transposed
+  void* transposed_graph_{nullptr};
+  void* transposed_number_map_{nullptr};
+  void* transposed_number_map_index_{nullptr};
+
+  cugraph_orientation_policy_t orientation_policy_{CUGRAPH_ORIENTATION_KEEP_ONE};
+  size_t orientation_budget_bytes_{0};
 };
 
+template <typename vertex_t, bool multi_gpu>
+cugraph::renumber_index_t<vertex_t, multi_gpu> const& get_number_map_index(
+  raft::handle_t const& handle,
+  cugraph_graph_t* graph,
+  vertex_t local_vertex_partition_range_first,
+  vertex_t local_vertex_partition_range_last,
+  bool do_expensive_check = false)
+{
+  if (graph->number_map_index_ == nullptr) {
+    auto number_map = reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph->number_map_);
+    graph->number_map_index_ =
+      new cugraph::renumber_index_t<vertex_t, multi_gpu>(handle,
+                                                         number_map->data(),
+                                                         local_vertex_partition_range_first,
+                                                         local_vertex_partition_range_last,
+                                                         do_expensive_check);
+  }
+
+  return *reinterpret_cast<cugraph::renumber_index_t<vertex_t, multi_gpu>*>(
+    graph->number_map_index_);
+}
+
+// should be called whenever number_map_ changes
+template <typename vertex_t, bool multi_gpu>
+void invalidate_number_map_index(cugraph_graph_t* graph)
+{
+  delete reinterpret_cast<cugraph::renumber_index_t<vertex_t, multi_gpu>*>(
+    graph->number_map_index_);
+  graph->number_map_index_ = nullptr;
+}
+
+// release the cached orientation not in use (the graph is currently stored in the store_transposed
+// orientation)
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void release_transposed_storage(cugraph_graph_t* graph)
+{
+  delete reinterpret_cast<
+    cugraph::graph_t<vertex_t, edge_t, weight_t, !store_transposed, multi_gpu>*>(
+    graph->transposed_graph_);
+  delete reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph->transposed_number_map_);
+  delete reinterpret_cast<cugraph::renumber_index_t<vertex_t, multi_gpu>*>(
+    graph->transposed_number_map_index_);
+
+  graph->transposed_graph_            = nullptr;
+  graph->transposed_number_map_       = nullptr;
+  graph->transposed_number_map_index_ = nullptr;
+}
+
+// whether the orientation in use should be kept when the graph is transposed, the decision is
+// identical on every GPU in multi-GPU (as transposing the graph is a collective operation)
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+bool keep_both_orientations(raft::handle_t const& handle, cugraph_graph_t const& graph)
+{
+  switch (graph.orientation_policy_) {
+    case CUGRAPH_ORIENTATION_KEEP_ONE: return false;
+    case CUGRAPH_ORIENTATION_KEEP_BOTH: return true;
+    default: break;
+  }
+
+  auto graph_view =
+    reinterpret_cast<cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>*>(
+      graph.graph_)
+      ->view();
+
+  // approximate (ignores the hypersparse segments and the segment offsets)
+  size_t bytes =
+    reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph.number_map_)->size() * sizeof(vertex_t);
+  for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+    bytes += static_cast<size_t>(graph_view.number_of_local_edge_partition_edges(i)) *
+               (sizeof(vertex_t) + (graph_view.is_weighted() ? sizeof(weight_t) : size_t{0})) +
+             (static_cast<size_t>(graph_view.local_vertex_partition_range_size()) + 1) *
+               sizeof(edge_t);
+  }
+  if constexpr (multi_gpu) {
+    bytes = cugraph::host_scalar_allreduce(
+      handle.get_comms(), bytes, raft::comms::op_t::MAX, handle.get_stream());
+  }
+
+  return bytes <= graph.orientation_budget_bytes_;
+}
+
 template <typename vertex_t,
           typename edge_t,
           typename weight_t,
@@ -47,25 +157,53 @@ cugraph_error_code_t transpose_storage(raft::handle_t const& handle,
                                        cugraph_error_t* error)
 {
   if (store_transposed == graph->store_transposed_) {
-    auto p_graph =
-      reinterpret_cast<cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>*>(
-        graph->graph_);
+    if (graph->transposed_graph_ == nullptr) {
+      using graph_type = cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>;
 
-    auto number_map = reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph->number_map_);
+      auto p_graph = reinterpret_cast<graph_type*>(graph->graph_);
+
+      auto number_map = reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph->number_map_);
+
+      auto keep_both =
+        keep_both_orientations<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(handle,
+                                                                                         *graph);
+
+      rmm::device_uvector<vertex_t> number_map_to_transpose(0, handle.get_stream());
+      if (keep_both) {
+        number_map_to_transpose.resize(number_map->size(), handle.get_stream());
+        raft::copy(number_map_to_transpose.data(),
+                   number_map->data(),
+                   number_map->size(),
+                   handle.get_stream());
+      } else {
+        number_map_to_transpose = std::move(*number_map);
+      }
+
+      auto graph_transposed =
+        new cugraph::graph_t<vertex_t, edge_t, weight_t, !store_transposed, multi_gpu>(handle);
 
-    auto graph_transposed =
-      new cugraph::graph_t<vertex_t, edge_t, weight_t, !store_transposed, multi_gpu>(handle);
+      std::optional<rmm::device_uvector<vertex_t>> new_number_map;
 
-    std::optional<rmm::device_uvector<vertex_t>> new_number_map;
+      std::tie(*graph_transposed, new_number_map) =
+        p_graph->transpose_storage(handle, std::move(number_map_to_transpose), !keep_both);
 
-    std::tie(*graph_transposed, new_number_map) =
-      p_graph->transpose_storage(handle, std::move(*number_map), true);
+      graph->transposed_graph_ = graph_transposed;
+      graph->transposed_number_map_ =
+        new rmm::device_uvector<vertex_t>(std::move(new_number_map.value()));
 
-    *number_map = std::move(new_number_map.value());
+      if (!keep_both) {
+        delete p_graph;
+        delete number_map;
+        invalidate_number_map_index<vertex_t, multi_gpu>(graph);
 
-    delete p_graph;
+        graph->graph_      = nullptr;
+        graph->number_map_ = nullptr;
+      }
+    }
 
-    graph->graph_            = graph_transposed;
+    std::swap(graph->graph_, graph->transposed_graph_);
+    std::swap(graph->number_map_, graph->transposed_number_map_);
+    std::swap(graph->number_map_index_, graph->transposed_number_map_index_);
     graph->store_transposed_ = !store_transposed;
 
     return CUGRAPH_SUCCESS;
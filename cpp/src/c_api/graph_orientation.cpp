@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cugraph_c/graph.h>
+
+#include <c_api/abstract_functor.hpp>
+#include <c_api/graph.hpp>
+#include <c_api/resource_handle.hpp>
+
+#include <cugraph/visitors/generic_cascaded_dispatch.hpp>
+
+namespace {
+
+struct set_orientation_policy_functor : public cugraph::c_api::abstract_functor {
+  raft::handle_t const& handle_;
+  cugraph::c_api::cugraph_graph_t* graph_{};
+  cugraph_orientation_policy_t policy_{};
+  size_t budget_bytes_{};
+
+  set_orientation_policy_functor(cugraph_resource_handle_t const* handle,
+                                 cugraph::c_api::cugraph_graph_t* graph,
+                                 cugraph_orientation_policy_t policy,
+                                 size_t budget_bytes)
+    : abstract_functor(),
+      handle_(*reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle)->handle_),
+      graph_(graph),
+      policy_(policy),
+      budget_bytes_(budget_bytes)
+  {
+  }
+
+  template <typename vertex_t,
+            typename edge_t,
+            typename weight_t,
+            bool store_transposed,
+            bool multi_gpu>
+  void operator()()
+  {
+    if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
+      unsupported();
+    } else {
+      graph_->orientation_policy_       = policy_;
+      graph_->orientation_budget_bytes_ = budget_bytes_;
+
+      if ((graph_->transposed_graph_ != nullptr) &&
+          !cugraph::c_api::
+            keep_both_orientations<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+              handle_, *graph_)) {
+        cugraph::c_api::
+          release_transposed_storage<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+            graph_);
+      }
+    }
+  }
+};
+
+}  // namespace
+
+extern "C" cugraph_error_code_t cugraph_graph_set_orientation_policy(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  cugraph_orientation_policy_t policy,
+  size_t budget_bytes,
+  cugraph_error_t** error)
+{
+  *error = nullptr;
+
+  try {
+    auto p_graph = reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph);
+
+    set_orientation_policy_functor functor(handle, p_graph, policy, budget_bytes);
+
+    cugraph::dispatch::vertex_dispatcher(cugraph::c_api::dtypes_mapping[p_graph->vertex_type_],
+                                         cugraph::c_api::dtypes_mapping[p_graph->edge_type_],
+                                         cugraph::c_api::dtypes_mapping[p_graph->weight_type_],
+                                         p_graph->store_transposed_,
+                                         p_graph->multi_gpu_,
+                                         functor);
+
+    if (functor.error_code_ != CUGRAPH_SUCCESS) {
+      *error = reinterpret_cast<cugraph_error_t*>(functor.error_.release());
+      return functor.error_code_;
+    }
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+
+  return CUGRAPH_SUCCESS;
+}
@@ -139,11 +139,9 @@ struct create_graph_functor : public cugraph::c_api::abstract_functor {
 };
 
 struct destroy_graph_functor : public cugraph::c_api::abstract_functor {
-  void* graph_;
-  void* number_map_;
+  cugraph::c_api::cugraph_graph_t* graph_;
 
-  destroy_graph_functor(void* graph, void* number_map)
-    : abstract_functor(), graph_(graph), number_map_(number_map)
+  destroy_graph_functor(cugraph::c_api::cugraph_graph_t* graph) : abstract_functor(), graph_(graph)
   {
   }
 
@@ -156,14 +154,18 @@ struct destroy_graph_functor : public cugraph::c_api::abstract_functor {
   {
     auto internal_graph_pointer =
       reinterpret_cast<cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>*>(
-        graph_);
+        graph_->graph_);
 
     delete internal_graph_pointer;
 
     auto internal_number_map_pointer =
-      reinterpret_cast<rmm::device_uvector<vertex_t>*>(number_map_);
+      reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph_->number_map_);
 
     delete internal_number_map_pointer;
+
+    cugraph::c_api::invalidate_number_map_index<vertex_t, multi_gpu>(graph_);
+    cugraph::c_api::
+      release_transposed_storage<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(graph_);
   }
 };
 
@@ -253,7 +255,7 @@ extern "C" void cugraph_sg_graph_free(cugraph_graph_t* ptr_graph)
 {
   auto internal_pointer = reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(ptr_graph);
 
-  destroy_graph_functor functor(internal_pointer->graph_, internal_pointer->number_map_);
+  destroy_graph_functor functor(internal_pointer);
 
   cugraph::dispatch::vertex_dispatcher(
     cugraph::c_api::dtypes_mapping[internal_pointer->vertex_type_],
@@ -146,9 +146,12 @@ struct pagerank_functor : public cugraph::c_api::abstract_functor {
           handle_,
           personalization_vertices.data(),
           personalization_vertices.size(),
-          number_map->data(),
-          graph_view.local_vertex_partition_range_first(),
-          graph_view.local_vertex_partition_range_last(),
+          cugraph::c_api::get_number_map_index<vertex_t, multi_gpu>(
+            handle_,
+            graph_,
+            graph_view.local_vertex_partition_range_first(),
+            graph_view.local_vertex_partition_range_last(),
+            do_expensive_check_),
           do_expensive_check_);
       }
 
@@ -208,12 +211,16 @@ struct pagerank_functor : public cugraph::c_api::abstract_functor {
             do_expensive_check_);
       }
 
+      // without user provided values, use the out-weight sums cached in the graph (computed once
+      // and reused by the following calls on the same graph)
+      weight_t const* vertex_out_weight_sums = precomputed_vertex_out_weight_sums_
+                                                 ? precomputed_vertex_out_weight_sums.data()
+                                                 : graph->out_weight_sums(handle_).data();
+
       cugraph::pagerank<vertex_t, edge_t, weight_t, weight_t, multi_gpu>(
         handle_,
         graph_view,
-        precomputed_vertex_out_weight_sums_
-          ? std::make_optional(precomputed_vertex_out_weight_sums.data())
-          : std::nullopt,
+        std::make_optional(vertex_out_weight_sums),
         personalization_vertices_ ? std::make_optional(personalization_vertices.data())
                                   : std::nullopt,
         personalization_values_ ? std::make_optional(personalization_values.data()) : std::nullopt,
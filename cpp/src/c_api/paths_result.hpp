@@ -24,6 +24,7 @@ struct cugraph_paths_result_t {
   cugraph_type_erased_device_array_t* vertex_ids_;
   cugraph_type_erased_device_array_t* distances_;
   cugraph_type_erased_device_array_t* predecessors_;
+  cugraph_type_erased_device_array_t* offsets_{nullptr};  // only set by the batched algorithms
 };
 
 }  // namespace c_api
@@ -105,13 +105,17 @@ struct node2vec_functor : public abstract_functor {
       //
       // Need to renumber start_vertices
       //
-      renumber_ext_vertices<vertex_t, multi_gpu>(handle_,
-                                                 start_vertices.data(),
-                                                 start_vertices.size(),
-                                                 number_map->data(),
-                                                 graph_view.local_vertex_partition_range_first(),
-                                                 graph_view.local_vertex_partition_range_last(),
-                                                 false);
+      renumber_ext_vertices<vertex_t, multi_gpu>(
+        handle_,
+        start_vertices.data(),
+        start_vertices.size(),
+        cugraph::c_api::get_number_map_index<vertex_t, multi_gpu>(
+          handle_,
+          graph_,
+          graph_view.local_vertex_partition_range_first(),
+          graph_view.local_vertex_partition_range_last(),
+          false),
+        false);
 
       // FIXME:  Forcing this to edge_t for now.  What should it really be?
       // Seems like it should be the smallest size that can accommodate
@@ -211,9 +215,12 @@ struct uniform_random_walks_functor : public cugraph::c_api::abstract_functor {
         handle_,
         start_vertices.data(),
         start_vertices.size(),
-        number_map->data(),
-        graph_view.local_vertex_partition_range_first(),
-        graph_view.local_vertex_partition_range_last(),
+        cugraph::c_api::get_number_map_index<vertex_t, multi_gpu>(
+          handle_,
+          graph_,
+          graph_view.local_vertex_partition_range_first(),
+          graph_view.local_vertex_partition_range_last(),
+          false),
         false);
 
       auto [paths, weights] = cugraph::uniform_random_walks(
@@ -305,9 +312,12 @@ struct biased_random_walks_functor : public cugraph::c_api::abstract_functor {
         handle_,
         start_vertices.data(),
         start_vertices.size(),
-        number_map->data(),
-        graph_view.local_vertex_partition_range_first(),
-        graph_view.local_vertex_partition_range_last(),
+        cugraph::c_api::get_number_map_index<vertex_t, multi_gpu>(
+          handle_,
+          graph_,
+          graph_view.local_vertex_partition_range_first(),
+          graph_view.local_vertex_partition_range_last(),
+          false),
         false);
 
       auto [paths, weights] = cugraph::biased_random_walks(
@@ -405,9 +415,12 @@ struct node2vec_random_walks_functor : public cugraph::c_api::abstract_functor {
         handle_,
         start_vertices.data(),
         start_vertices.size(),
-        number_map->data(),
-        graph_view.local_vertex_partition_range_first(),
-        graph_view.local_vertex_partition_range_last(),
+        cugraph::c_api::get_number_map_index<vertex_t, multi_gpu>(
+          handle_,
+          graph_,
+          graph_view.local_vertex_partition_range_first(),
+          graph_view.local_vertex_partition_range_last(),
+          false),
         false);
 
       auto [paths, weights] = cugraph::node2vec_random_walks(
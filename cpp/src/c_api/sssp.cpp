@@ -23,9 +23,12 @@
 #include <c_api/utils.hpp>
 
 #include <cugraph/algorithms.hpp>
+#include <cugraph/detail/shuffle_wrappers.hpp>
 #include <cugraph/detail/utility_wrappers.hpp>
 #include <cugraph/graph_functions.hpp>
 
+#include <optional>
+
 namespace cugraph {
 namespace c_api {
 
@@ -96,13 +99,17 @@ struct sssp_functor : public abstract_functor {
       //
       // Need to renumber sources
       //
-      renumber_ext_vertices<vertex_t, multi_gpu>(handle_,
-                                                 source_ids.data(),
-                                                 source_ids.size(),
-                                                 number_map->data(),
-                                                 graph_view.local_vertex_partition_range_first(),
-                                                 graph_view.local_vertex_partition_range_last(),
-                                                 do_expensive_check_);
+      renumber_ext_vertices<vertex_t, multi_gpu>(
+        handle_,
+        source_ids.data(),
+        source_ids.size(),
+        cugraph::c_api::get_number_map_index<vertex_t, multi_gpu>(
+          handle_,
+          graph_,
+          graph_view.local_vertex_partition_range_first(),
+          graph_view.local_vertex_partition_range_last(),
+          do_expensive_check_),
+        do_expensive_check_);
 
       raft::update_host(&src, source_ids.data(), 1, handle_.get_stream());
 
@@ -139,6 +146,209 @@ struct sssp_functor : public abstract_functor {
   }
 };
 
+struct point_to_point_shortest_paths_functor : public abstract_functor {
+  raft::handle_t const& handle_;
+  cugraph_graph_t* graph_;
+  cugraph_type_erased_device_array_view_t const* sources_;
+  cugraph_type_erased_device_array_view_t const* targets_;
+  cugraph_type_erased_device_array_view_t const* heuristic_vertices_;
+  cugraph_type_erased_device_array_view_t const* heuristic_values_;
+  double cutoff_;
+  bool do_expensive_check_;
+  cugraph_paths_result_t* result_{};
+
+  point_to_point_shortest_paths_functor(
+    ::cugraph_resource_handle_t const* handle,
+    ::cugraph_graph_t* graph,
+    ::cugraph_type_erased_device_array_view_t const* sources,
+    ::cugraph_type_erased_device_array_view_t const* targets,
+    ::cugraph_type_erased_device_array_view_t const* heuristic_vertices,
+    ::cugraph_type_erased_device_array_view_t const* heuristic_values,
+    double cutoff,
+    bool do_expensive_check)
+    : abstract_functor(),
+      handle_(*reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle)->handle_),
+      graph_(reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph)),
+      sources_(
+        reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(sources)),
+      targets_(
+        reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(targets)),
+      heuristic_vertices_(
+        reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(
+          heuristic_vertices)),
+      heuristic_values_(
+        reinterpret_cast<cugraph::c_api::cugraph_type_erased_device_array_view_t const*>(
+          heuristic_values)),
+      cutoff_(cutoff),
+      do_expensive_check_(do_expensive_check)
+  {
+  }
+
+  template <typename vertex_t,
+            typename edge_t,
+            typename weight_t,
+            bool store_transposed,
+            bool multi_gpu>
+  void operator()()
+  {
+    if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
+      unsupported();
+    } else {
+      if ((targets_->size_ != sources_->size_) || (targets_->type_ != sources_->type_)) {
+        error_code_ = CUGRAPH_INVALID_INPUT;
+        error_->error_message_ =
+          "Invalid input arguments: targets should have the same size and type as sources.";
+        return;
+      }
+
+      if ((heuristic_vertices_ == nullptr) != (heuristic_values_ == nullptr)) {
+        error_code_ = CUGRAPH_INVALID_INPUT;
+        error_->error_message_ =
+          "Invalid input arguments: heuristic_vertices and heuristic_values should be both set "
+          "or both NULL.";
+        return;
+      }
+
+      // Shortest paths expect store_transposed == false
+      if constexpr (store_transposed) {
+        error_code_ = cugraph::c_api::
+          transpose_storage<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+            handle_, graph_, error_.get());
+        if (error_code_ != CUGRAPH_SUCCESS) return;
+      }
+
+      auto graph =
+        reinterpret_cast<cugraph::graph_t<vertex_t, edge_t, weight_t, false, multi_gpu>*>(
+          graph_->graph_);
+
+      auto graph_view = graph->view();
+
+      auto number_map = reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph_->number_map_);
+
+      rmm::device_uvector<vertex_t> sources(sources_->size_, handle_.get_stream());
+      rmm::device_uvector<vertex_t> targets(targets_->size_, handle_.get_stream());
+      raft::copy(
+        sources.data(), sources_->as_type<vertex_t>(), sources_->size_, handle_.get_stream());
+      raft::copy(
+        targets.data(), targets_->as_type<vertex_t>(), targets_->size_, handle_.get_stream());
+
+      //
+      // Need to renumber sources and targets
+      //
+      auto const& number_map_index = cugraph::c_api::get_number_map_index<vertex_t, multi_gpu>(
+        handle_,
+        graph_,
+        graph_view.local_vertex_partition_range_first(),
+        graph_view.local_vertex_partition_range_last(),
+        do_expensive_check_);
+
+      renumber_ext_vertices<vertex_t, multi_gpu>(
+        handle_, sources.data(), sources.size(), number_map_index, do_expensive_check_);
+      renumber_ext_vertices<vertex_t, multi_gpu>(
+        handle_, targets.data(), targets.size(), number_map_index, do_expensive_check_);
+
+      rmm::device_uvector<weight_t> heuristics(0, handle_.get_stream());
+      if (heuristic_vertices_ != nullptr) {
+        rmm::device_uvector<vertex_t> heuristic_vertices(heuristic_vertices_->size_,
+                                                         handle_.get_stream());
+        heuristics.resize(heuristic_values_->size_, handle_.get_stream());
+
+        raft::copy(heuristic_vertices.data(),
+                   heuristic_vertices_->as_type<vertex_t>(),
+                   heuristic_vertices_->size_,
+                   handle_.get_stream());
+        raft::copy(heuristics.data(),
+                   heuristic_values_->as_type<weight_t>(),
+                   heuristic_values_->size_,
+                   handle_.get_stream());
+
+        heuristics = cugraph::detail::
+          collect_local_vertex_values_from_ext_vertex_value_pairs<vertex_t, weight_t, multi_gpu>(
+            handle_,
+            std::move(heuristic_vertices),
+            std::move(heuristics),
+            *number_map,
+            graph_view.local_vertex_partition_range_first(),
+            graph_view.local_vertex_partition_range_last(),
+            weight_t{0},
+            do_expensive_check_);
+      }
+
+      rmm::device_uvector<size_t> offsets(0, handle_.get_stream());
+      rmm::device_uvector<vertex_t> path_vertices(0, handle_.get_stream());
+      rmm::device_uvector<weight_t> path_distances(0, handle_.get_stream());
+      if (graph_->transposed_graph_ != nullptr) {
+        // both storage orientations are kept, search from the sources and the targets at once
+        auto transposed_graph =
+          reinterpret_cast<cugraph::graph_t<vertex_t, edge_t, weight_t, true, multi_gpu>*>(
+            graph_->transposed_graph_);
+        auto transposed_graph_view = transposed_graph->view();
+
+        // the two orientations are renumbered separately
+        auto transposed_number_map =
+          reinterpret_cast<rmm::device_uvector<vertex_t>*>(graph_->transposed_number_map_);
+        rmm::device_uvector<vertex_t> transposed_graph_vertex_ids(transposed_number_map->size(),
+                                                                  handle_.get_stream());
+        raft::copy(transposed_graph_vertex_ids.data(),
+                   transposed_number_map->data(),
+                   transposed_number_map->size(),
+                   handle_.get_stream());
+        renumber_ext_vertices<vertex_t, multi_gpu>(handle_,
+                                                   transposed_graph_vertex_ids.data(),
+                                                   transposed_graph_vertex_ids.size(),
+                                                   number_map_index,
+                                                   do_expensive_check_);
+
+        std::tie(offsets, path_vertices, path_distances) =
+          cugraph::point_to_point_shortest_paths<vertex_t, edge_t, weight_t, multi_gpu>(
+            handle_,
+            graph_view,
+            transposed_graph_view,
+            raft::device_span<vertex_t const>{transposed_graph_vertex_ids.data(),
+                                              transposed_graph_vertex_ids.size()},
+            raft::device_span<vertex_t const>{sources.data(), sources.size()},
+            raft::device_span<vertex_t const>{targets.data(), targets.size()},
+            heuristic_vertices_ != nullptr
+              ? std::make_optional<weight_t const*>(heuristics.data())
+              : std::nullopt,
+            static_cast<weight_t>(cutoff_),
+            do_expensive_check_);
+      } else {
+        std::tie(offsets, path_vertices, path_distances) =
+          cugraph::point_to_point_shortest_paths<vertex_t, edge_t, weight_t, multi_gpu>(
+            handle_,
+            graph_view,
+            raft::device_span<vertex_t const>{sources.data(), sources.size()},
+            raft::device_span<vertex_t const>{targets.data(), targets.size()},
+            heuristic_vertices_ != nullptr
+              ? std::make_optional<weight_t const*>(heuristics.data())
+              : std::nullopt,
+            static_cast<weight_t>(cutoff_),
+            do_expensive_check_);
+      }
+
+      std::vector<vertex_t> vertex_partition_range_lasts =
+        graph_view.vertex_partition_range_lasts();
+
+      unrenumber_int_vertices<vertex_t, multi_gpu>(handle_,
+                                                   path_vertices.data(),
+                                                   path_vertices.size(),
+                                                   number_map->data(),
+                                                   vertex_partition_range_lasts,
+                                                   do_expensive_check_);
+
+      // the predecessor of each path vertex is the previous vertex in the path
+      rmm::device_uvector<vertex_t> predecessors(0, handle_.get_stream());
+
+      result_ = new cugraph_paths_result_t{
+        new cugraph_type_erased_device_array_t(path_vertices, graph_->vertex_type_),
+        new cugraph_type_erased_device_array_t(path_distances, graph_->weight_type_),
+        new cugraph_type_erased_device_array_t(predecessors, graph_->vertex_type_),
+        new cugraph_type_erased_device_array_t(offsets, data_type_id_t::INT64)};
+    }
+  }
+};
+
 }  // namespace c_api
 }  // namespace cugraph
 
@@ -156,3 +366,27 @@ extern "C" cugraph_error_code_t cugraph_sssp(const cugraph_resource_handle_t* ha
 
   return cugraph::c_api::run_algorithm(graph, functor, result, error);
 }
+
+extern "C" cugraph_error_code_t cugraph_point_to_point_shortest_paths(
+  const cugraph_resource_handle_t* handle,
+  cugraph_graph_t* graph,
+  const cugraph_type_erased_device_array_view_t* sources,
+  const cugraph_type_erased_device_array_view_t* targets,
+  const cugraph_type_erased_device_array_view_t* heuristic_vertices,
+  const cugraph_type_erased_device_array_view_t* heuristic_values,
+  double cutoff,
+  bool_t do_expensive_check,
+  cugraph_paths_result_t** result,
+  cugraph_error_t** error)
+{
+  cugraph::c_api::point_to_point_shortest_paths_functor functor(handle,
+                                                                graph,
+                                                                sources,
+                                                                targets,
+                                                                heuristic_vertices,
+                                                                heuristic_values,
+                                                                cutoff,
+                                                                do_expensive_check);
+
+  return cugraph::c_api::run_algorithm(graph, functor, result, error);
+}
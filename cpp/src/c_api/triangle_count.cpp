@@ -106,9 +106,12 @@ struct triangle_count_functor : public cugraph::c_api::abstract_functor {
           handle_,
           vertices.data(),
           vertices.size(),
-          number_map->data(),
-          graph_view.local_vertex_partition_range_first(),
-          graph_view.local_vertex_partition_range_last(),
+          cugraph::c_api::get_number_map_index<vertex_t, multi_gpu>(
+            handle_,
+            graph_,
+            graph_view.local_vertex_partition_range_first(),
+            graph_view.local_vertex_partition_range_last(),
+            do_expensive_check_),
           do_expensive_check_);
       } else {
         counts.resize(graph_view.local_vertex_partition_range_size(), handle_.get_stream());
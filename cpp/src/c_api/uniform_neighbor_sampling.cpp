@@ -114,9 +114,12 @@ struct uniform_neighbor_sampling_functor : public cugraph::c_api::abstract_funct
         handle_,
         start.data(),
         start.size(),
-        number_map->data(),
-        graph_view.local_vertex_partition_range_first(),
-        graph_view.local_vertex_partition_range_last(),
+        cugraph::c_api::get_number_map_index<vertex_t, multi_gpu>(
+          handle_,
+          graph_,
+          graph_view.local_vertex_partition_range_first(),
+          graph_view.local_vertex_partition_range_last(),
+          false),
         false);
 
       auto&& [srcs, dsts, weights, counts] = cugraph::uniform_nbr_sample(
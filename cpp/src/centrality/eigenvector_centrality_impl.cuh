@@ -21,6 +21,7 @@
 #include <prims/per_v_transform_reduce_incoming_outgoing_e.cuh>
 #include <prims/reduce_v.cuh>
 #include <prims/transform_reduce_v.cuh>
+#include <prims/transform_reduce_v_with_output.cuh>
 #include <prims/update_edge_partition_src_dst_property.cuh>
 
 #include <cugraph/algorithms.hpp>
@@ -106,7 +107,7 @@ rmm::device_uvector<weight_t> eigenvector_centrality(
       weight_t{0},
       centralities.begin());
 
-    // Normalize the centralities
+    // Compute the L2 norm of the centralities
     auto hypotenuse = sqrt(transform_reduce_v(
       handle,
       pull_graph_view,
@@ -114,17 +115,16 @@ rmm::device_uvector<weight_t> eigenvector_centrality(
       [] __device__(auto, auto val) { return val * val; },
       weight_t{0.0}));
 
-    thrust::transform(handle.get_thrust_policy(),
-                      centralities.begin(),
-                      centralities.end(),
-                      centralities.begin(),
-                      [hypotenuse] __device__(auto val) { return val / hypotenuse; });
-
-    auto diff_sum = transform_reduce_v(
+    // normalize the centralities and compute the difference in a single pass
+    auto diff_sum = transform_reduce_v_with_output(
       handle,
       pull_graph_view,
       thrust::make_zip_iterator(thrust::make_tuple(centralities.begin(), old_centralities.data())),
-      [] __device__(auto, auto val) { return std::abs(thrust::get<0>(val) - thrust::get<1>(val)); },
+      centralities.begin(),
+      [hypotenuse] __device__(auto, auto val) {
+        auto const centrality = thrust::get<0>(val) / hypotenuse;
+        return thrust::make_tuple(centrality, std::abs(centrality - thrust::get<1>(val)));
+      },
       weight_t{0.0});
 
     iter++;
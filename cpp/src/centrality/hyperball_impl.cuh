@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <prims/edge_partition_src_dst_property.cuh>
+#include <prims/per_v_transform_reduce_incoming_outgoing_e.cuh>
+#include <prims/transform_reduce_v_with_output.cuh>
+#include <prims/update_edge_partition_src_dst_property.cuh>
+#include <utilities/hyperloglog.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/dataframe_buffer.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+// fraction of the reachable pairs used to define the effective diameter
+constexpr double effective_diameter_fraction{0.9};
+
+template <typename vertex_t>
+struct insert_self_t {
+  detail::hll::register_word_t* registers{};
+  vertex_t num_vertices{};
+  vertex_t vertex_first{};
+  uint32_t log2_num_registers{};
+  uint64_t seed{};
+
+  __device__ void operator()(vertex_t v_offset) const
+  {
+    auto h   = detail::hll::hash(static_cast<uint64_t>(vertex_first + v_offset), seed);
+    auto idx = static_cast<size_t>(h & ((uint64_t{1} << log2_num_registers) - 1));
+    auto r   = detail::hll::rank(h, log2_num_registers);
+    registers[(idx / detail::hll::registers_per_word) * static_cast<size_t>(num_vertices) +
+              v_offset] |= static_cast<detail::hll::register_word_t>(r)
+                           << ((idx % detail::hll::registers_per_word) * 8);
+  }
+};
+
+// take the union of the old registers and the registers reduced over the neighbors, and count the
+// vertices whose registers changed
+template <typename vertex_t>
+struct union_registers_t {
+  template <typename OldAndNbrRegisters>
+  __device__ thrust::tuple<detail::hll::register_slab_t, size_t> operator()(
+    vertex_t, OldAndNbrRegisters old_and_nbr) const
+  {
+    detail::hll::register_slab_t old_registers = thrust::get<0>(old_and_nbr);
+    detail::hll::register_slab_t nbr_registers = thrust::get<1>(old_and_nbr);
+    auto new_registers = detail::hll::register_slab_max_t{}(old_registers, nbr_registers);
+    return thrust::make_tuple(new_registers,
+                              new_registers != old_registers ? size_t{1} : size_t{0});
+  }
+};
+
+// update the ball size estimate of iteration (distance) t and accumulate the harmonic centrality
+// (sum of 1 / distance) and distance sum contributions of the newly reached vertices
+template <typename vertex_t, typename result_t>
+struct update_ball_sizes_t {
+  detail::hll::register_word_t const* registers{};
+  vertex_t num_vertices{};
+  size_t num_registers{};
+  size_t t{};
+
+  template <typename OldValues>
+  __device__ thrust::tuple<thrust::tuple<result_t, result_t, result_t>, double> operator()(
+    vertex_t v, OldValues old_values) const
+  {
+    double inverse_power_sum{0.0};
+    uint32_t num_zeros{0};
+    for (size_t i = 0; i < num_registers / detail::hll::registers_per_word; ++i) {
+      detail::hll::accumulate_register_word(
+        registers[i * static_cast<size_t>(num_vertices) + v], inverse_power_sum, num_zeros);
+    }
+    result_t old_size = thrust::get<0>(old_values);
+    // ball sizes are non-decreasing, but the estimates may not be
+    auto new_size = std::max(
+      static_cast<result_t>(detail::hll::estimate(inverse_power_sum, num_zeros, num_registers)),
+      old_size);
+    auto delta = new_size - old_size;
+    return thrust::make_tuple(
+      thrust::make_tuple(new_size,
+                         thrust::get<1>(old_values) + delta / static_cast<result_t>(t),
+                         thrust::get<2>(old_values) + delta * static_cast<result_t>(t)),
+      static_cast<double>(new_size));
+  }
+};
+
+}  // namespace
+
+namespace detail {
+
+template <typename GraphViewType, typename result_t>
+std::tuple<rmm::device_uvector<result_t>,
+           rmm::device_uvector<result_t>,
+           std::vector<result_t>,
+           result_t>
+hyperball(raft::handle_t const& handle,
+          GraphViewType const& graph_view,
+          size_t num_registers,
+          size_t max_iterations,
+          uint64_t seed,
+          bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+  static_assert(!GraphViewType::is_multi_gpu, "hyperball currently supports single-GPU only.");
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((num_registers >= hll::registers_per_slab) &&
+                    (num_registers <= (size_t{1} << 16)) &&
+                    ((num_registers & (num_registers - 1)) == 0),
+                  "Invalid input argument: num_registers should be a power of two in [32, 65536].");
+
+  if (do_expensive_check) {
+    // currently, nothing to do
+  }
+
+  auto num_vertices = graph_view.local_vertex_partition_range_size();
+
+  uint32_t log2_num_registers{0};
+  while ((size_t{1} << log2_num_registers) < num_registers) {
+    ++log2_num_registers;
+  }
+  auto num_slabs = num_registers / hll::registers_per_slab;
+
+  // 2. initialize the registers (the ball of radius 0 of every vertex is the vertex itself)
+
+  // word i of the registers of vertex v is stored at registers[i * num_vertices + v]
+  rmm::device_uvector<hll::register_word_t> registers(
+    (num_registers / hll::registers_per_word) * static_cast<size_t>(num_vertices),
+    handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(),
+               registers.begin(),
+               registers.end(),
+               hll::register_word_t{0});
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator(vertex_t{0}),
+                   thrust::make_counting_iterator(num_vertices),
+                   insert_self_t<vertex_t>{registers.data(),
+                                           num_vertices,
+                                           graph_view.local_vertex_partition_range_first(),
+                                           log2_num_registers,
+                                           seed});
+
+  rmm::device_uvector<result_t> ball_sizes(num_vertices, handle.get_stream());
+  rmm::device_uvector<result_t> harmonic_centralities(num_vertices, handle.get_stream());
+  rmm::device_uvector<result_t> distance_sums(num_vertices, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), ball_sizes.begin(), ball_sizes.end(), result_t{1.0});
+  thrust::fill(handle.get_thrust_policy(),
+               harmonic_centralities.begin(),
+               harmonic_centralities.end(),
+               result_t{0.0});
+  thrust::fill(
+    handle.get_thrust_policy(), distance_sums.begin(), distance_sums.end(), result_t{0.0});
+
+  std::vector<result_t> neighborhood_function{static_cast<result_t>(num_vertices)};
+
+  // 3. iterate, the registers of a vertex in iteration t estimate the ball of radius t (the union
+  // of the balls of radius t - 1 of the vertex and its out-neighbors)
+
+  edge_partition_dst_property_t<GraphViewType, hll::register_slab_t> edge_partition_dst_registers(
+    handle, graph_view);
+  auto nbr_registers = allocate_dataframe_buffer<hll::register_slab_t>(
+    static_cast<size_t>(num_vertices), handle.get_stream());
+
+  for (size_t t = 1; t <= max_iterations; ++t) {
+    size_t num_changed{0};
+    for (size_t i = 0; i < num_slabs; ++i) {
+      auto word_first = registers.data() + i * hll::words_per_slab * num_vertices;
+      auto slab_first = thrust::make_zip_iterator(
+        thrust::make_tuple(word_first,
+                           word_first + num_vertices,
+                           word_first + 2 * num_vertices,
+                           word_first + 3 * num_vertices));
+
+      update_edge_partition_dst_property(
+        handle, graph_view, slab_first, edge_partition_dst_registers);
+
+      per_v_transform_reduce_outgoing_e(
+        handle,
+        graph_view,
+        dummy_property_t<vertex_t>{}.device_view(),
+        edge_partition_dst_registers.device_view(),
+        [] __device__(vertex_t, vertex_t, weight_t, auto, auto dst_registers) {
+          return dst_registers;
+        },
+        hll::register_slab_t{},
+        hll::register_slab_max_t{},
+        get_dataframe_buffer_begin(nbr_registers));
+
+      num_changed += transform_reduce_v_with_output(
+        handle,
+        graph_view,
+        thrust::make_zip_iterator(
+          thrust::make_tuple(slab_first, get_dataframe_buffer_begin(nbr_registers))),
+        slab_first,
+        union_registers_t<vertex_t>{},
+        size_t{0});
+    }
+
+    if (num_changed == 0) { break; }
+
+    auto values_first = thrust::make_zip_iterator(thrust::make_tuple(
+      ball_sizes.begin(), harmonic_centralities.begin(), distance_sums.begin()));
+    auto num_pairs    = transform_reduce_v_with_output(
+      handle,
+      graph_view,
+      values_first,
+      values_first,
+      update_ball_sizes_t<vertex_t, result_t>{registers.data(), num_vertices, num_registers, t},
+      double{0.0});
+    neighborhood_function.push_back(static_cast<result_t>(num_pairs));
+  }
+
+  // 4. compute closeness centralities (inverse average distance to the reachable vertices, in place
+  // of the distance sums) and the effective diameter
+
+  thrust::transform(handle.get_thrust_policy(),
+                    ball_sizes.begin(),
+                    ball_sizes.end(),
+                    distance_sums.begin(),
+                    distance_sums.begin(),
+                    [] __device__(auto ball_size, auto distance_sum) {
+                      return distance_sum > result_t{0.0}
+                               ? std::max(ball_size - result_t{1.0}, result_t{0.0}) / distance_sum
+                               : result_t{0.0};
+                    });
+
+  result_t effective_diameter{0.0};
+  auto threshold = effective_diameter_fraction * static_cast<double>(neighborhood_function.back());
+  for (size_t t = 0; t < neighborhood_function.size(); ++t) {
+    if (static_cast<double>(neighborhood_function[t]) >= threshold) {
+      if (t > 0) {  // interpolate between t - 1 and t
+        auto prev          = static_cast<double>(neighborhood_function[t - 1]);
+        auto cur           = static_cast<double>(neighborhood_function[t]);
+        effective_diameter = static_cast<result_t>(static_cast<double>(t - 1) +
+                                                   (threshold - prev) / (cur - prev));
+      }
+      break;
+    }
+  }
+
+  return std::make_tuple(std::move(harmonic_centralities),
+                         std::move(distance_sums),
+                         std::move(neighborhood_function),
+                         effective_diameter);
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<result_t>,
+           rmm::device_uvector<result_t>,
+           std::vector<result_t>,
+           result_t>
+hyperball(raft::handle_t const& handle,
+          graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+          size_t num_registers,
+          size_t max_iterations,
+          uint64_t seed,
+          bool do_expensive_check)
+{
+  return detail::hyperball<graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu>, result_t>(
+    handle, graph_view, num_registers, max_iterations, seed, do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -19,6 +19,7 @@
 #include <prims/edge_partition_src_dst_property.cuh>
 #include <prims/per_v_transform_reduce_incoming_outgoing_e.cuh>
 #include <prims/transform_reduce_v.cuh>
+#include <prims/transform_reduce_v_with_output.cuh>
 #include <prims/update_edge_partition_src_dst_property.cuh>
 
 #include <cugraph/algorithms.hpp>
@@ -119,26 +120,31 @@ void katz_centrality(raft::handle_t const& handle,
       betas != nullptr ? result_t{0.0} : beta,
       new_katz_centralities);
 
-    if (betas != nullptr) {
-      auto val_first = thrust::make_zip_iterator(thrust::make_tuple(new_katz_centralities, betas));
-      thrust::transform(handle.get_thrust_policy(),
-                        val_first,
-                        val_first + pull_graph_view.local_vertex_partition_range_size(),
-                        new_katz_centralities,
-                        [] __device__(auto val) {
-                          auto const katz_centrality = thrust::get<0>(val);
-                          auto const beta            = thrust::get<1>(val);
-                          return katz_centrality + beta;
-                        });
+    result_t diff_sum{};
+    if (betas != nullptr) {  // add betas and compute the difference in a single pass
+      diff_sum = transform_reduce_v_with_output(
+        handle,
+        pull_graph_view,
+        thrust::make_zip_iterator(
+          thrust::make_tuple(new_katz_centralities, betas, old_katz_centralities)),
+        new_katz_centralities,
+        [] __device__(auto, auto val) {
+          auto const katz_centrality = thrust::get<0>(val) + thrust::get<1>(val);
+          return thrust::make_tuple(katz_centrality,
+                                    std::abs(katz_centrality - thrust::get<2>(val)));
+        },
+        result_t{0.0});
+    } else {
+      diff_sum = transform_reduce_v(
+        handle,
+        pull_graph_view,
+        thrust::make_zip_iterator(thrust::make_tuple(new_katz_centralities, old_katz_centralities)),
+        [] __device__(auto, auto val) {
+          return std::abs(thrust::get<0>(val) - thrust::get<1>(val));
+        },
+        result_t{0.0});
     }
 
-    auto diff_sum = transform_reduce_v(
-      handle,
-      pull_graph_view,
-      thrust::make_zip_iterator(thrust::make_tuple(new_katz_centralities, old_katz_centralities)),
-      [] __device__(auto, auto val) { return std::abs(thrust::get<0>(val) - thrust::get<1>(val)); },
-      result_t{0.0});
-
     iter++;
 
     if (diff_sum < epsilon) {
@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <community/label_propagation_utils.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <raft/span.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// Same iteration as the device implementation (see label_propagation_impl.cuh) on a host CSR, the
+// frontier vertices re-evaluating their labels in an iteration are split into contiguous ranges
+// over the threads. New labels are applied after every thread finishes (as in the device
+// implementation), so the output does not depend on the number of threads.
+template <typename vertex_t, typename edge_t, typename weight_t>
+size_t host_label_propagation(edge_t const* offsets,
+                              vertex_t const* indices,
+                              weight_t const* weights /* nullptr if unweighted */,
+                              vertex_t num_vertices,
+                              vertex_t* labels,
+                              std::vector<uint8_t> const& is_seed /* empty if there are no seeds */,
+                              size_t max_iterations,
+                              size_t num_threads)
+{
+  auto const unlabeled = num_vertices;
+
+  std::vector<vertex_t> frontier{};
+  for (vertex_t v = 0; v < num_vertices; ++v) {
+    if ((offsets[v + 1] > offsets[v]) && (is_seed.empty() || (is_seed[v] == 0))) {
+      frontier.push_back(v);
+    }
+  }
+
+  auto run_on_threads = [num_threads](auto op) {
+    std::vector<std::thread> threads{};
+    threads.reserve(num_threads - 1);
+    for (size_t i = 1; i < num_threads; ++i) {
+      threads.emplace_back(op, i);
+    }
+    op(0);
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  };
+
+  std::vector<std::vector<vertex_t>> thread_neighbors(num_threads);
+  size_t iter{0};
+  while (iter < max_iterations) {
+    if (frontier.size() == 0) { break; }
+
+    // 1. find the new labels of the frontier vertices re-evaluating their labels in this iteration
+
+    std::vector<vertex_t> update_vertices{};
+    std::vector<vertex_t> next_frontier{};
+    for (auto v : frontier) {
+      if (lpa::is_update_iteration(v, iter)) {
+        update_vertices.push_back(v);
+      } else {
+        next_frontier.push_back(v);
+      }
+    }
+
+    std::vector<vertex_t> new_labels(update_vertices.size());
+    auto evaluate = [&](size_t thread_idx) {
+      auto first = (update_vertices.size() * thread_idx) / num_threads;
+      auto last  = (update_vertices.size() * (thread_idx + 1)) / num_threads;
+      std::vector<std::pair<vertex_t, weight_t>> neighbor_labels{};
+      for (auto i = first; i < last; ++i) {
+        auto v = update_vertices[i];
+        neighbor_labels.clear();
+        for (auto e = offsets[v]; e < offsets[v + 1]; ++e) {
+          auto label = labels[indices[e]];
+          if (label != unlabeled) {
+            neighbor_labels.emplace_back(label, weights != nullptr ? weights[e] : weight_t{1.0});
+          }
+        }
+        std::sort(neighbor_labels.begin(),
+                  neighbor_labels.end(),
+                  [](auto lhs, auto rhs) { return lhs.first < rhs.first; });
+
+        auto best_label  = unlabeled;
+        auto best_weight = std::numeric_limits<weight_t>::lowest();
+        for (size_t j = 0; j < neighbor_labels.size();) {
+          auto label        = neighbor_labels[j].first;
+          auto label_weight = weight_t{0.0};
+          for (; (j < neighbor_labels.size()) && (neighbor_labels[j].first == label); ++j) {
+            label_weight += neighbor_labels[j].second;
+          }
+          if (lpa::is_preferred_label(label,
+                                      label_weight,
+                                      label == labels[v],
+                                      best_label,
+                                      best_weight,
+                                      best_label == labels[v])) {
+            best_label  = label;
+            best_weight = label_weight;
+          }
+        }
+        new_labels[i] = ((best_label != unlabeled) && (best_label != labels[v]))
+                          ? best_label
+                          : invalid_vertex_id<vertex_t>::value;
+      }
+    };
+
+    // 2. apply the new labels and collect the (unfixed) neighbors of the vertices with new labels
+
+    auto expand = [&](size_t thread_idx) {
+      auto first      = (update_vertices.size() * thread_idx) / num_threads;
+      auto last       = (update_vertices.size() * (thread_idx + 1)) / num_threads;
+      auto& neighbors = thread_neighbors[thread_idx];
+      neighbors.clear();
+      for (auto i = first; i < last; ++i) {
+        if (new_labels[i] == invalid_vertex_id<vertex_t>::value) { continue; }
+        auto v = update_vertices[i];
+        for (auto e = offsets[v]; e < offsets[v + 1]; ++e) {
+          auto nbr = indices[e];
+          if (is_seed.empty() || (is_seed[nbr] == 0)) { neighbors.push_back(nbr); }
+        }
+      }
+    };
+
+    run_on_threads(evaluate);
+    run_on_threads(expand);
+
+    for (size_t i = 0; i < update_vertices.size(); ++i) {
+      if (new_labels[i] != invalid_vertex_id<vertex_t>::value) {
+        labels[update_vertices[i]] = new_labels[i];
+      }
+    }
+
+    // 3. the next frontier is the frontier vertices that did not re-evaluate their labels in this
+    // iteration and the (unfixed) neighbors of the vertices with new labels
+
+    for (auto const& neighbors : thread_neighbors) {
+      next_frontier.insert(next_frontier.end(), neighbors.begin(), neighbors.end());
+    }
+    std::sort(next_frontier.begin(), next_frontier.end());
+    next_frontier.erase(std::unique(next_frontier.begin(), next_frontier.end()),
+                        next_frontier.end());
+    frontier = std::move(next_frontier);
+
+    ++iter;
+  }
+
+  if (!is_seed.empty()) {
+    std::replace(labels, labels + num_vertices, unlabeled, invalid_vertex_id<vertex_t>::value);
+  }
+
+  return iter;
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+size_t host_label_propagation(raft::host_span<edge_t const> offsets,
+                              raft::host_span<vertex_t const> indices,
+                              std::optional<raft::host_span<weight_t const>> weights,
+                              raft::host_span<vertex_t> labels,
+                              std::optional<raft::host_span<vertex_t const>> seed_vertices,
+                              std::optional<raft::host_span<vertex_t const>> seed_labels,
+                              size_t max_iterations,
+                              size_t num_threads,
+                              bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(offsets.size() >= 1,
+                  "Invalid input arguments: offsets should have at least one element.");
+  CUGRAPH_EXPECTS(
+    offsets.size() - 1 <= static_cast<size_t>(std::numeric_limits<vertex_t>::max()),
+    "Invalid input arguments: the number of vertices does not fit in vertex_t.");
+  CUGRAPH_EXPECTS((offsets[0] == edge_t{0}) &&
+                    (static_cast<size_t>(offsets[offsets.size() - 1]) == indices.size()),
+                  "Invalid input arguments: offsets and indices do not form a valid CSR.");
+  CUGRAPH_EXPECTS(!weights || ((*weights).size() == indices.size()),
+                  "Invalid input arguments: (*weights).size() does not coincide with "
+                  "indices.size().");
+
+  auto const num_vertices = static_cast<vertex_t>(offsets.size() - 1);
+
+  CUGRAPH_EXPECTS(labels.size() == static_cast<size_t>(num_vertices),
+                  "Invalid input arguments: labels.size() does not coincide with the number of "
+                  "vertices.");
+  CUGRAPH_EXPECTS(seed_vertices.has_value() == seed_labels.has_value(),
+                  "Invalid input arguments: seed_vertices and seed_labels should be both valid or "
+                  "both std::nullopt.");
+  if (seed_vertices) {
+    CUGRAPH_EXPECTS((*seed_vertices).size() == (*seed_labels).size(),
+                    "Invalid input arguments: (*seed_vertices).size() does not coincide with "
+                    "(*seed_labels).size().");
+  }
+
+  if (do_expensive_check) {
+    CUGRAPH_EXPECTS(std::is_sorted(offsets.begin(), offsets.end()),
+                    "Invalid input arguments: offsets should be non-decreasing.");
+    CUGRAPH_EXPECTS(
+      std::all_of(indices.begin(),
+                  indices.end(),
+                  [num_vertices](auto v) { return is_valid_vertex(num_vertices, v); }),
+      "Invalid input arguments: indices have invalid vertex IDs.");
+    if (seed_vertices) {
+      CUGRAPH_EXPECTS(
+        std::all_of((*seed_vertices).begin(),
+                    (*seed_vertices).end(),
+                    [num_vertices](auto v) { return is_valid_vertex(num_vertices, v); }),
+        "Invalid input arguments: *seed_vertices has invalid vertex IDs.");
+      CUGRAPH_EXPECTS(
+        std::all_of((*seed_labels).begin(),
+                    (*seed_labels).end(),
+                    [num_vertices](auto l) { return is_valid_vertex(num_vertices, l); }),
+        "Invalid input arguments: *seed_labels has labels out of [0, "
+        "graph_view.number_of_vertices()).");
+      std::vector<vertex_t> sorted_seed_vertices((*seed_vertices).begin(),
+                                                 (*seed_vertices).end());
+      std::sort(sorted_seed_vertices.begin(), sorted_seed_vertices.end());
+      CUGRAPH_EXPECTS(
+        std::adjacent_find(sorted_seed_vertices.begin(), sorted_seed_vertices.end()) ==
+          sorted_seed_vertices.end(),
+        "Invalid input arguments: *seed_vertices has duplicate vertices.");
+    }
+  }
+  if (num_vertices == 0) { return 0; }
+
+  if (num_threads == 0) {
+    num_threads = std::max(static_cast<size_t>(std::thread::hardware_concurrency()), size_t{1});
+  }
+
+  std::vector<uint8_t> is_seed{};
+  if (seed_vertices) {
+    std::fill(labels.begin(), labels.end(), num_vertices /* unlabeled */);
+    is_seed.assign(num_vertices, uint8_t{0});
+    for (size_t i = 0; i < (*seed_vertices).size(); ++i) {
+      labels[(*seed_vertices)[i]]  = (*seed_labels)[i];
+      is_seed[(*seed_vertices)[i]] = uint8_t{1};
+    }
+  } else {
+    std::iota(labels.begin(), labels.end(), vertex_t{0});
+  }
+
+  return detail::host_label_propagation(offsets.data(),
+                                        indices.data(),
+                                        weights ? (*weights).data() : nullptr,
+                                        num_vertices,
+                                        labels.data(),
+                                        is_seed,
+                                        max_iterations,
+                                        num_threads);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+size_t host_label_propagation(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, false> const& graph_view,
+  raft::device_span<vertex_t> labels,
+  std::optional<raft::device_span<vertex_t const>> seed_vertices,
+  std::optional<raft::device_span<vertex_t const>> seed_labels,
+  size_t max_iterations,
+  size_t num_threads,
+  bool do_expensive_check)
+{
+  auto const num_vertices = graph_view.number_of_vertices();
+  auto const num_edges    = graph_view.number_of_edges();
+
+  CUGRAPH_EXPECTS(
+    graph_view.is_symmetric(),
+    "Invalid input arguments: host_label_propagation currently supports undirected graphs only.");
+  CUGRAPH_EXPECTS(labels.size() == static_cast<size_t>(num_vertices),
+                  "Invalid input arguments: labels.size() does not coincide with the number of "
+                  "vertices.");
+  CUGRAPH_EXPECTS(seed_vertices.has_value() == seed_labels.has_value(),
+                  "Invalid input arguments: seed_vertices and seed_labels should be both valid or "
+                  "both std::nullopt.");
+
+  auto edge_partition = graph_view.local_edge_partition_view();
+
+  std::vector<edge_t> h_offsets(num_vertices + 1);
+  std::vector<vertex_t> h_indices(num_edges);
+  std::vector<weight_t> h_weights(graph_view.is_weighted() ? num_edges : edge_t{0});
+  raft::update_host(
+    h_offsets.data(), edge_partition.offsets(), h_offsets.size(), handle.get_stream());
+  raft::update_host(
+    h_indices.data(), edge_partition.indices(), h_indices.size(), handle.get_stream());
+  if (graph_view.is_weighted()) {
+    raft::update_host(
+      h_weights.data(), *(edge_partition.weights()), h_weights.size(), handle.get_stream());
+  }
+
+  std::vector<vertex_t> h_seed_vertices(seed_vertices ? (*seed_vertices).size() : size_t{0});
+  std::vector<vertex_t> h_seed_labels(seed_labels ? (*seed_labels).size() : size_t{0});
+  if (seed_vertices) {
+    raft::update_host(h_seed_vertices.data(),
+                      (*seed_vertices).data(),
+                      h_seed_vertices.size(),
+                      handle.get_stream());
+    raft::update_host(
+      h_seed_labels.data(), (*seed_labels).data(), h_seed_labels.size(), handle.get_stream());
+  }
+  handle.sync_stream();
+
+  std::vector<vertex_t> h_labels(num_vertices);
+  auto num_iterations = host_label_propagation(
+    raft::host_span<edge_t const>(h_offsets.data(), h_offsets.size()),
+    raft::host_span<vertex_t const>(h_indices.data(), h_indices.size()),
+    graph_view.is_weighted()
+      ? std::make_optional<raft::host_span<weight_t const>>(h_weights.data(), h_weights.size())
+      : std::nullopt,
+    raft::host_span<vertex_t>(h_labels.data(), h_labels.size()),
+    seed_vertices ? std::make_optional<raft::host_span<vertex_t const>>(h_seed_vertices.data(),
+                                                                        h_seed_vertices.size())
+                  : std::nullopt,
+    seed_labels ? std::make_optional<raft::host_span<vertex_t const>>(h_seed_labels.data(),
+                                                                      h_seed_labels.size())
+                : std::nullopt,
+    max_iterations,
+    num_threads,
+    do_expensive_check);
+
+  raft::update_device(labels.data(), h_labels.data(), h_labels.size(), handle.get_stream());
+  handle.sync_stream();
+
+  return num_iterations;
+}
+
+}  // namespace cugraph
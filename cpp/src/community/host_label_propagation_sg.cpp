@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <community/host_label_propagation_impl.hpp>
+
+namespace cugraph {
+
+// SG instantiation
+
+template size_t host_label_propagation(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
+  raft::device_span<int32_t> labels,
+  std::optional<raft::device_span<int32_t const>> seed_vertices,
+  std::optional<raft::device_span<int32_t const>> seed_labels,
+  size_t max_iterations,
+  size_t num_threads,
+  bool do_expensive_check);
+
+template size_t host_label_propagation(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
+  raft::device_span<int32_t> labels,
+  std::optional<raft::device_span<int32_t const>> seed_vertices,
+  std::optional<raft::device_span<int32_t const>> seed_labels,
+  size_t max_iterations,
+  size_t num_threads,
+  bool do_expensive_check);
+
+template size_t host_label_propagation(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
+  raft::device_span<int32_t> labels,
+  std::optional<raft::device_span<int32_t const>> seed_vertices,
+  std::optional<raft::device_span<int32_t const>> seed_labels,
+  size_t max_iterations,
+  size_t num_threads,
+  bool do_expensive_check);
+
+template size_t host_label_propagation(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
+  raft::device_span<int32_t> labels,
+  std::optional<raft::device_span<int32_t const>> seed_vertices,
+  std::optional<raft::device_span<int32_t const>> seed_labels,
+  size_t max_iterations,
+  size_t num_threads,
+  bool do_expensive_check);
+
+template size_t host_label_propagation(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
+  raft::device_span<int64_t> labels,
+  std::optional<raft::device_span<int64_t const>> seed_vertices,
+  std::optional<raft::device_span<int64_t const>> seed_labels,
+  size_t max_iterations,
+  size_t num_threads,
+  bool do_expensive_check);
+
+template size_t host_label_propagation(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
+  raft::device_span<int64_t> labels,
+  std::optional<raft::device_span<int64_t const>> seed_vertices,
+  std::optional<raft::device_span<int64_t const>> seed_labels,
+  size_t max_iterations,
+  size_t num_threads,
+  bool do_expensive_check);
+
+template size_t host_label_propagation(raft::host_span<int32_t const> offsets,
+                                       raft::host_span<int32_t const> indices,
+                                       std::optional<raft::host_span<float const>> weights,
+                                       raft::host_span<int32_t> labels,
+                                       std::optional<raft::host_span<int32_t const>> seed_vertices,
+                                       std::optional<raft::host_span<int32_t const>> seed_labels,
+                                       size_t max_iterations,
+                                       size_t num_threads,
+                                       bool do_expensive_check);
+
+template size_t host_label_propagation(raft::host_span<int32_t const> offsets,
+                                       raft::host_span<int32_t const> indices,
+                                       std::optional<raft::host_span<double const>> weights,
+                                       raft::host_span<int32_t> labels,
+                                       std::optional<raft::host_span<int32_t const>> seed_vertices,
+                                       std::optional<raft::host_span<int32_t const>> seed_labels,
+                                       size_t max_iterations,
+                                       size_t num_threads,
+                                       bool do_expensive_check);
+
+template size_t host_label_propagation(raft::host_span<int64_t const> offsets,
+                                       raft::host_span<int32_t const> indices,
+                                       std::optional<raft::host_span<float const>> weights,
+                                       raft::host_span<int32_t> labels,
+                                       std::optional<raft::host_span<int32_t const>> seed_vertices,
+                                       std::optional<raft::host_span<int32_t const>> seed_labels,
+                                       size_t max_iterations,
+                                       size_t num_threads,
+                                       bool do_expensive_check);
+
+template size_t host_label_propagation(raft::host_span<int64_t const> offsets,
+                                       raft::host_span<int32_t const> indices,
+                                       std::optional<raft::host_span<double const>> weights,
+                                       raft::host_span<int32_t> labels,
+                                       std::optional<raft::host_span<int32_t const>> seed_vertices,
+                                       std::optional<raft::host_span<int32_t const>> seed_labels,
+                                       size_t max_iterations,
+                                       size_t num_threads,
+                                       bool do_expensive_check);
+
+template size_t host_label_propagation(raft::host_span<int64_t const> offsets,
+                                       raft::host_span<int64_t const> indices,
+                                       std::optional<raft::host_span<float const>> weights,
+                                       raft::host_span<int64_t> labels,
+                                       std::optional<raft::host_span<int64_t const>> seed_vertices,
+                                       std::optional<raft::host_span<int64_t const>> seed_labels,
+                                       size_t max_iterations,
+                                       size_t num_threads,
+                                       bool do_expensive_check);
+
+template size_t host_label_propagation(raft::host_span<int64_t const> offsets,
+                                       raft::host_span<int64_t const> indices,
+                                       std::optional<raft::host_span<double const>> weights,
+                                       raft::host_span<int64_t> labels,
+                                       std::optional<raft::host_span<int64_t const>> seed_vertices,
+                                       std::optional<raft::host_span<int64_t const>> seed_labels,
+                                       size_t max_iterations,
+                                       size_t num_threads,
+                                       bool do_expensive_check);
+
+}  // namespace cugraph
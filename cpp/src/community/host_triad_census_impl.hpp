@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <community/triad_census_utils.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/span.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// Same counting scheme as the device implementation (see triad_census_impl.cuh) on a host CSR:
+// build the undirected neighbor lists with dyad codes, count the neighbor combinations around every
+// vertex, and enumerate each triangle (u, v, w) with u < v < w once by merging the neighbor lists
+// of u and v. The vertices are handed out to the threads in small chunks (vertex degrees are
+// skewed) and the per-thread counts are summed at the end, so the output does not depend on the
+// number of threads.
+template <typename vertex_t, typename edge_t>
+std::array<uint64_t, 16> host_triad_census(edge_t const* offsets,
+                                           vertex_t const* indices,
+                                           vertex_t num_vertices,
+                                           size_t num_threads)
+{
+  constexpr size_t vertex_chunk_size{256};  // tuning parameter
+
+  auto run_on_threads = [num_threads](auto op) {
+    std::vector<std::thread> threads{};
+    threads.reserve(num_threads - 1);
+    for (size_t i = 1; i < num_threads; ++i) {
+      threads.emplace_back(op, i);
+    }
+    op(0);
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  };
+
+  // 1. build the undirected neighbor lists, (neighbor, dyad code relative to (vertex, neighbor))
+  // pairs sorted by neighbor, self-loops are ignored and parallel edges are merged
+
+  std::vector<size_t> nbr_offsets(static_cast<size_t>(num_vertices) + 1, size_t{0});
+  for (vertex_t u = 0; u < num_vertices; ++u) {
+    for (auto e = offsets[u]; e < offsets[u + 1]; ++e) {
+      auto v = indices[e];
+      if (v != u) {
+        ++nbr_offsets[u + 1];
+        ++nbr_offsets[v + 1];
+      }
+    }
+  }
+  std::partial_sum(nbr_offsets.begin(), nbr_offsets.end(), nbr_offsets.begin());
+
+  std::vector<std::pair<vertex_t, uint8_t>> nbrs(nbr_offsets.back());
+  {
+    std::vector<size_t> positions(nbr_offsets.begin(), nbr_offsets.end() - 1);
+    for (vertex_t u = 0; u < num_vertices; ++u) {
+      for (auto e = offsets[u]; e < offsets[u + 1]; ++e) {
+        auto v = indices[e];
+        if (v != u) {
+          nbrs[positions[u]++] = std::make_pair(v, triad::dyad_forward);
+          nbrs[positions[v]++] = std::make_pair(u, triad::dyad_backward);
+        }
+      }
+    }
+  }
+
+  std::vector<size_t> nbr_counts(num_vertices);
+  std::atomic<size_t> next_chunk_first{0};
+  run_on_threads([&](size_t) {
+    while (true) {
+      auto first = next_chunk_first.fetch_add(vertex_chunk_size);
+      if (first >= static_cast<size_t>(num_vertices)) { break; }
+      auto last = std::min(first + vertex_chunk_size, static_cast<size_t>(num_vertices));
+      for (auto u = first; u < last; ++u) {
+        auto list_first = nbrs.begin() + nbr_offsets[u];
+        auto list_last  = nbrs.begin() + nbr_offsets[u + 1];
+        std::sort(list_first, list_last, [](auto lhs, auto rhs) { return lhs.first < rhs.first; });
+        auto out = list_first;
+        for (auto it = list_first; it != list_last; ++it) {
+          if ((out != list_first) && ((out - 1)->first == it->first)) {
+            (out - 1)->second |= it->second;
+          } else {
+            *out++ = *it;
+          }
+        }
+        nbr_counts[u] = static_cast<size_t>(out - list_first);
+      }
+    }
+  });
+
+  // 2. count the neighbor combinations around every vertex and enumerate and classify triangles
+
+  struct thread_counts_t {
+    std::array<uint64_t, triad::num_closed_triad_types> closed_triad_counts{};
+    std::array<uint64_t, 8> vertex_dyad_sums{};
+    uint64_t num_dyads{0};
+    uint64_t num_asymmetric_dyads{0};
+  };
+  std::vector<thread_counts_t> thread_counts(num_threads);
+
+  next_chunk_first = 0;
+  run_on_threads([&](size_t thread_idx) {
+    auto& counts = thread_counts[thread_idx];
+    while (true) {
+      auto first = next_chunk_first.fetch_add(vertex_chunk_size);
+      if (first >= static_cast<size_t>(num_vertices)) { break; }
+      auto last = std::min(first + vertex_chunk_size, static_cast<size_t>(num_vertices));
+      for (auto u = first; u < last; ++u) {
+        auto u_first = nbrs.data() + nbr_offsets[u];
+        auto u_last  = u_first + nbr_counts[u];
+
+        uint64_t o{0};
+        uint64_t i{0};
+        uint64_t m{0};
+        for (auto it = u_first; it != u_last; ++it) {
+          if (it->second == triad::dyad_mutual) {
+            ++m;
+          } else if (it->second == triad::dyad_forward) {
+            ++o;
+          } else {
+            ++i;
+          }
+        }
+        uint64_t sums[8];
+        triad::compute_vertex_dyad_sums(o, i, m, sums);
+        for (size_t j = 0; j < counts.vertex_dyad_sums.size(); ++j) {
+          counts.vertex_dyad_sums[j] += sums[j];
+        }
+
+        // neighbor lists are sorted, so the neighbors larger than u form a suffix
+        auto u_upper_first = std::upper_bound(
+          u_first,
+          u_last,
+          static_cast<vertex_t>(u),
+          [](vertex_t lhs, std::pair<vertex_t, uint8_t> const& rhs) { return lhs < rhs.first; });
+        for (auto uv = u_upper_first; uv != u_last; ++uv) {
+          auto v = uv->first;
+          ++counts.num_dyads;
+          if (uv->second != triad::dyad_mutual) { ++counts.num_asymmetric_dyads; }
+
+          // merge the neighbors of u and v larger than v
+          auto v_first = nbrs.data() + nbr_offsets[v];
+          auto v_last  = v_first + nbr_counts[v];
+          auto uw      = uv + 1;
+          auto vw      = std::upper_bound(
+            v_first, v_last, v, [](vertex_t lhs, std::pair<vertex_t, uint8_t> const& rhs) {
+              return lhs < rhs.first;
+            });
+          while ((uw != u_last) && (vw != v_last)) {
+            if (uw->first < vw->first) {
+              ++uw;
+            } else if (uw->first > vw->first) {
+              ++vw;
+            } else {
+              ++counts.closed_triad_counts[triad::classify_closed_triad(
+                uv->second, uw->second, vw->second)];
+              ++uw;
+              ++vw;
+            }
+          }
+        }
+      }
+    }
+  });
+
+  // 3. derive the census
+
+  thread_counts_t total_counts{};
+  for (auto const& counts : thread_counts) {
+    for (size_t j = 0; j < total_counts.closed_triad_counts.size(); ++j) {
+      total_counts.closed_triad_counts[j] += counts.closed_triad_counts[j];
+    }
+    for (size_t j = 0; j < total_counts.vertex_dyad_sums.size(); ++j) {
+      total_counts.vertex_dyad_sums[j] += counts.vertex_dyad_sums[j];
+    }
+    total_counts.num_dyads += counts.num_dyads;
+    total_counts.num_asymmetric_dyads += counts.num_asymmetric_dyads;
+  }
+
+  return triad::derive_triad_census(total_counts.closed_triad_counts,
+                                    total_counts.vertex_dyad_sums,
+                                    static_cast<uint64_t>(num_vertices),
+                                    total_counts.num_dyads,
+                                    total_counts.num_asymmetric_dyads);
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t>
+std::array<uint64_t, 16> host_triad_census(raft::host_span<edge_t const> offsets,
+                                           raft::host_span<vertex_t const> indices,
+                                           size_t num_threads,
+                                           bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(offsets.size() >= 1,
+                  "Invalid input arguments: offsets should have at least one element.");
+  CUGRAPH_EXPECTS(
+    offsets.size() - 1 <= static_cast<size_t>(std::numeric_limits<vertex_t>::max()),
+    "Invalid input arguments: the number of vertices does not fit in vertex_t.");
+  CUGRAPH_EXPECTS((offsets[0] == edge_t{0}) &&
+                    (static_cast<size_t>(offsets[offsets.size() - 1]) == indices.size()),
+                  "Invalid input arguments: offsets and indices do not form a valid CSR.");
+
+  auto num_vertices = static_cast<vertex_t>(offsets.size() - 1);
+
+  if (do_expensive_check) {
+    CUGRAPH_EXPECTS(std::is_sorted(offsets.begin(), offsets.end()),
+                    "Invalid input arguments: offsets should be non-decreasing.");
+    CUGRAPH_EXPECTS(std::all_of(indices.begin(),
+                                indices.end(),
+                                [num_vertices](auto v) { return (v >= 0) && (v < num_vertices); }),
+                    "Invalid input arguments: indices have invalid vertex IDs.");
+  }
+
+  if (num_threads == 0) { num_threads = std::max(std::thread::hardware_concurrency(), 1u); }
+
+  return detail::host_triad_census(offsets.data(), indices.data(), num_vertices, num_threads);
+}
+
+}  // namespace cugraph
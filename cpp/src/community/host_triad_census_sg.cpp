@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <community/host_triad_census_impl.hpp>
+
+namespace cugraph {
+
+// SG instantiation
+
+template std::array<uint64_t, 16> host_triad_census(raft::host_span<int32_t const> offsets,
+                                                    raft::host_span<int32_t const> indices,
+                                                    size_t num_threads,
+                                                    bool do_expensive_check);
+
+template std::array<uint64_t, 16> host_triad_census(raft::host_span<int64_t const> offsets,
+                                                    raft::host_span<int32_t const> indices,
+                                                    size_t num_threads,
+                                                    bool do_expensive_check);
+
+template std::array<uint64_t, 16> host_triad_census(raft::host_span<int64_t const> offsets,
+                                                    raft::host_span<int64_t const> indices,
+                                                    size_t num_threads,
+                                                    bool do_expensive_check);
+
+}  // namespace cugraph
@@ -0,0 +1,1411 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <detail/graph_utils.cuh>
+#include <prims/edge_partition_src_dst_property.cuh>
+#include <prims/per_v_transform_reduce_dst_key_aggregated_outgoing_e.cuh>
+#include <prims/per_v_transform_reduce_incoming_outgoing_e.cuh>
+#include <prims/reduce_op.cuh>
+#include <prims/update_edge_partition_src_dst_property.cuh>
+#include <utilities/collect_comm.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/shuffle_wrappers.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/dataframe_buffer.hpp>
+#include <cugraph/utilities/device_comm.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+// stop coarsening once the graph has no more than max(num_partitions * coarsest_vertices_per_part,
+// min_coarsest_vertices) vertices, or a level shrinks the graph by less than
+// (1.0 - min_coarsening_ratio)
+size_t constexpr coarsest_vertices_per_part{16};
+size_t constexpr min_coarsest_vertices{256};
+double constexpr min_coarsening_ratio{0.95};
+size_t constexpr max_coarsening_levels{32};
+size_t constexpr num_matching_rounds{4};
+
+// heavy-edge matching
+
+// the same value for (u, v) and (v, u), so both endpoints of an edge agree on tie-breaking, which
+// makes mutual proposals (and matches) more likely
+template <typename vertex_t>
+__device__ uint64_t edge_tie_breaker(vertex_t u, vertex_t v, uint64_t seed)
+{
+  auto lo = static_cast<uint64_t>(u < v ? u : v);
+  auto hi = static_cast<uint64_t>(u < v ? v : u);
+  auto x  = (lo * uint64_t{0x9e3779b97f4a7c15}) ^ (hi + seed);
+  x       = (x ^ (x >> 30)) * uint64_t{0xbf58476d1ce4e5b9};
+  x       = (x ^ (x >> 27)) * uint64_t{0x94d049bb133111eb};
+  return x ^ (x >> 31);
+}
+
+// a vertex can be matched with a neighbor if both are unmatched (a positive matching weight, the
+// vertex weight of an unmatched vertex and 0 for a matched vertex) and the merged vertex does not
+// get too heavy
+template <typename vertex_t, typename weight_t>
+__device__ bool is_matchable(
+  vertex_t src, vertex_t dst, weight_t src_weight, weight_t dst_weight, weight_t max_vertex_weight)
+{
+  return (src != dst) && (src_weight > weight_t{0}) && (dst_weight > weight_t{0}) &&
+         (src_weight + dst_weight <= max_vertex_weight);
+}
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct heaviest_matchable_edge_t {
+  weight_t max_vertex_weight{};
+
+  __device__ weight_t operator()(vertex_t src,
+                                 vertex_t dst,
+                                 weight_t w,
+                                 thrust::tuple<weight_t, weight_t, uint64_t> src_info,
+                                 weight_t dst_weight) const
+  {
+    return is_matchable(src, dst, thrust::get<0>(src_info), dst_weight, max_vertex_weight)
+             ? w
+             : std::numeric_limits<weight_t>::lowest();
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct heaviest_matchable_edge_tie_breaker_t {
+  weight_t max_vertex_weight{};
+  uint64_t seed{};
+
+  __device__ uint64_t operator()(vertex_t src,
+                                 vertex_t dst,
+                                 weight_t w,
+                                 thrust::tuple<weight_t, weight_t, uint64_t> src_info,
+                                 weight_t dst_weight) const
+  {
+    return (is_matchable(src, dst, thrust::get<0>(src_info), dst_weight, max_vertex_weight) &&
+            (w == thrust::get<1>(src_info)))
+             ? edge_tie_breaker(src, dst, seed)
+             : uint64_t{0};
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct matching_proposal_t {
+  weight_t max_vertex_weight{};
+  uint64_t seed{};
+
+  __device__ vertex_t operator()(vertex_t src,
+                                 vertex_t dst,
+                                 weight_t w,
+                                 thrust::tuple<weight_t, weight_t, uint64_t> src_info,
+                                 weight_t dst_weight) const
+  {
+    return (is_matchable(src, dst, thrust::get<0>(src_info), dst_weight, max_vertex_weight) &&
+            (w == thrust::get<1>(src_info)) &&
+            (edge_tie_breaker(src, dst, seed) == thrust::get<2>(src_info)))
+             ? dst
+             : invalid_vertex_id<vertex_t>::value;
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct is_mutual_proposal_t {
+  __device__ vertex_t operator()(
+    vertex_t src, vertex_t dst, weight_t, vertex_t src_proposal, vertex_t dst_proposal) const
+  {
+    return ((src_proposal == dst) && (dst_proposal == src)) ? vertex_t{1} : vertex_t{0};
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct update_match_t {
+  __device__ thrust::tuple<vertex_t, weight_t> operator()(
+    thrust::tuple<vertex_t, weight_t, vertex_t, vertex_t> quadruplet) const
+  {
+    auto partner         = thrust::get<0>(quadruplet);
+    auto matching_weight = thrust::get<1>(quadruplet);
+    auto proposal        = thrust::get<2>(quadruplet);
+    auto is_mutual       = thrust::get<3>(quadruplet);
+    return is_mutual != vertex_t{0} ? thrust::make_tuple(proposal, weight_t{0})
+                                    : thrust::make_tuple(partner, matching_weight);
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct match_label_t {
+  __device__ vertex_t operator()(thrust::tuple<vertex_t, vertex_t> pair) const
+  {
+    auto v       = thrust::get<0>(pair);
+    auto partner = thrust::get<1>(pair);
+    return ((partner != invalid_vertex_id<vertex_t>::value) && (partner < v)) ? partner : v;
+  }
+};
+
+// refinement
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct own_part_edge_weight_t {
+  __device__ weight_t
+  operator()(vertex_t src, vertex_t dst, weight_t w, vertex_t src_part, vertex_t dst_part) const
+  {
+    return ((src != dst) && (src_part == dst_part)) ? w : weight_t{0};
+  }
+};
+
+// (part, gain) of moving the source vertex to the part (the total edge weight to the part minus
+// the total edge weight to the vertex's current part), src_info is (part, vertex weight, total edge
+// weight to the current part, weight of the current part)
+template <typename vertex_t, typename weight_t>
+struct move_gain_t {
+  weight_t max_part_weight{};
+
+  __device__ thrust::tuple<vertex_t, weight_t> operator()(
+    vertex_t,
+    vertex_t part,
+    weight_t part_edge_weight,
+    thrust::tuple<vertex_t, weight_t, weight_t, weight_t> src_info,
+    weight_t part_weight) const
+  {
+    return ((part != thrust::get<0>(src_info)) &&
+            (part_weight + thrust::get<1>(src_info) <= max_part_weight))
+             ? thrust::make_tuple(part, part_edge_weight - thrust::get<2>(src_info))
+             : thrust::make_tuple(invalid_vertex_id<vertex_t>::value,
+                                  std::numeric_limits<weight_t>::lowest());
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct best_move_t {
+  using value_type                    = thrust::tuple<vertex_t, weight_t>;
+  static constexpr bool pure_function = true;  // this can be called from any process
+  inline static value_type const identity_element = thrust::make_tuple(
+    invalid_vertex_id<vertex_t>::value, std::numeric_limits<weight_t>::lowest());
+
+  __device__ value_type operator()(value_type p0, value_type p1) const
+  {
+    auto part0 = thrust::get<0>(p0);
+    auto part1 = thrust::get<0>(p1);
+    auto gain0 = thrust::get<1>(p0);
+    auto gain1 = thrust::get<1>(p1);
+
+    return (gain0 < gain1) ? p1 : ((gain0 > gain1) ? p0 : ((part0 < part1) ? p0 : p1));
+  }
+};
+
+// a vertex moves if the move reduces the edge cut or the vertex's current part is overweight, and
+// only to a higher (lower) part in the iterations with up_down set to true (false) to avoid two
+// vertices swapping parts forever
+template <typename vertex_t, typename weight_t>
+struct is_move_candidate_t {
+  vertex_t const* parts{nullptr};
+  weight_t const* own_part_weights{nullptr};
+  vertex_t const* best_parts{nullptr};
+  weight_t const* best_gains{nullptr};
+  weight_t max_part_weight{};
+  bool up_down{};
+
+  __device__ bool operator()(size_t i) const
+  {
+    auto part      = parts[i];
+    auto best_part = best_parts[i];
+    return (best_part != invalid_vertex_id<vertex_t>::value) && ((best_part > part) == up_down) &&
+           ((best_gains[i] > weight_t{0}) || (own_part_weights[i] > max_part_weight));
+  }
+};
+
+// (target part, gain, local vertex offset): by target part, then the larger gain first
+template <typename vertex_t, typename weight_t>
+struct move_priority_less_t {
+  __device__ bool operator()(thrust::tuple<vertex_t, weight_t, size_t> lhs,
+                             thrust::tuple<vertex_t, weight_t, size_t> rhs) const
+  {
+    if (thrust::get<0>(lhs) != thrust::get<0>(rhs)) {
+      return thrust::get<0>(lhs) < thrust::get<0>(rhs);
+    }
+    if (thrust::get<1>(lhs) != thrust::get<1>(rhs)) {
+      return thrust::get<1>(lhs) > thrust::get<1>(rhs);
+    }
+    return thrust::get<2>(lhs) < thrust::get<2>(rhs);
+  }
+};
+
+// the moves to a part are accepted in the gain order while the part stays within its capacity (in
+// multi-GPU, every GPU gets an equal share of the capacity as the GPUs decide concurrently)
+template <typename vertex_t, typename weight_t>
+struct is_accepted_move_t {
+  weight_t const* part_weights{nullptr};
+  weight_t max_part_weight{};
+  int comm_size{1};
+
+  __device__ bool operator()(thrust::tuple<vertex_t, weight_t> pair) const
+  {
+    auto part              = thrust::get<0>(pair);
+    auto cumulative_weight = thrust::get<1>(pair);
+    return cumulative_weight <=
+           (max_part_weight - part_weights[part]) / static_cast<weight_t>(comm_size);
+  }
+};
+
+// rebalancing: a vertex in an overweight part moves to the part with the largest gain among the
+// parts with room, or to the lightest part if no neighboring part has room (the gain is then the
+// negated total edge weight to the vertex's current part)
+template <typename vertex_t, typename weight_t>
+struct rebalancing_move_t {
+  weight_t max_part_weight{};
+  vertex_t lightest_part{};
+
+  __device__ thrust::tuple<vertex_t, weight_t> operator()(
+    thrust::tuple<weight_t, weight_t, vertex_t, weight_t> quadruplet) const
+  {
+    auto own_part_weight      = thrust::get<0>(quadruplet);
+    auto own_part_edge_weight = thrust::get<1>(quadruplet);
+    auto best_part            = thrust::get<2>(quadruplet);
+    auto best_gain            = thrust::get<3>(quadruplet);
+    if (own_part_weight <= max_part_weight) {
+      return thrust::make_tuple(invalid_vertex_id<vertex_t>::value,
+                                std::numeric_limits<weight_t>::lowest());
+    }
+    return best_part != invalid_vertex_id<vertex_t>::value
+             ? thrust::make_tuple(best_part, best_gain)
+             : thrust::make_tuple(lightest_part, -own_part_edge_weight);
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct is_valid_part_t {
+  __device__ bool operator()(vertex_t part) const
+  {
+    return part != invalid_vertex_id<vertex_t>::value;
+  }
+};
+
+// the rebalancing moves out of (into) a part are accepted in the gain order while their cumulative
+// weight stays within the part's quota (this GPU's share of the part's excess (room))
+template <typename vertex_t, typename weight_t>
+struct is_within_quota_t {
+  weight_t const* quotas{nullptr};
+
+  __device__ bool operator()(thrust::tuple<vertex_t, weight_t> pair) const
+  {
+    return thrust::get<1>(pair) <= quotas[thrust::get<0>(pair)];
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct is_local_key_t {
+  int comm_rank{};
+  int comm_size{};
+
+  __device__ bool operator()(vertex_t key) const
+  {
+    return cugraph::detail::compute_gpu_id_from_ext_vertex_t<vertex_t>{comm_size}(key) ==
+           comm_rank;
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename value_t>
+struct sorted_unique_value_lookup_t {
+  vertex_t const* sorted_unique_keys{nullptr};
+  value_t const* values{nullptr};
+  size_t num_keys{};
+
+  __device__ value_t operator()(vertex_t key) const
+  {
+    return values[thrust::distance(
+      sorted_unique_keys,
+      thrust::lower_bound(thrust::seq, sorted_unique_keys, sorted_unique_keys + num_keys, key))];
+  }
+};
+
+}  // namespace
+
+namespace detail {
+
+// greedy graph growing (on the host): grow the parts one by one from a seed vertex, repeatedly
+// adding the unassigned vertex most strongly connected to the part until the part reaches its
+// share of the remaining vertex weight (re-seeding if the part runs out of unassigned neighbors)
+template <typename vertex_t, typename weight_t>
+std::vector<vertex_t> greedy_graph_growing(std::vector<size_t> const& offsets,
+                                           std::vector<vertex_t> const& indices,
+                                           std::vector<weight_t> const& weights,
+                                           std::vector<weight_t> const& vertex_weights,
+                                           vertex_t num_parts)
+{
+  auto const num_vertices = static_cast<vertex_t>(vertex_weights.size());
+
+  std::vector<vertex_t> parts(num_vertices, invalid_vertex_id<vertex_t>::value);
+  std::vector<weight_t> connections(num_vertices, weight_t{0});
+  auto remaining_weight =
+    std::accumulate(vertex_weights.begin(), vertex_weights.end(), weight_t{0});
+
+  vertex_t next_seed{0};
+  for (vertex_t p = 0; p < num_parts; ++p) {
+    if (p == num_parts - 1) {
+      std::replace(parts.begin(), parts.end(), invalid_vertex_id<vertex_t>::value, p);
+      break;
+    }
+
+    auto target_weight = remaining_weight / static_cast<weight_t>(num_parts - p);
+    auto part_weight   = weight_t{0};
+    std::priority_queue<std::pair<weight_t, vertex_t>> queue{};
+    std::vector<vertex_t> touched_vertices{};
+    while (part_weight < target_weight) {
+      if (queue.empty()) {
+        while ((next_seed < num_vertices) &&
+               (parts[next_seed] != invalid_vertex_id<vertex_t>::value)) {
+          ++next_seed;
+        }
+        if (next_seed == num_vertices) { break; }
+        queue.emplace(connections[next_seed], next_seed);
+      }
+      auto [connection, v] = queue.top();
+      queue.pop();
+      if ((parts[v] != invalid_vertex_id<vertex_t>::value) || (connection != connections[v])) {
+        continue;  // already assigned or a stale entry
+      }
+      parts[v] = p;
+      part_weight += vertex_weights[v];
+      for (auto i = offsets[v]; i < offsets[v + 1]; ++i) {
+        auto nbr = indices[i];
+        if ((nbr != v) && (parts[nbr] == invalid_vertex_id<vertex_t>::value)) {
+          if (connections[nbr] == weight_t{0}) { touched_vertices.push_back(nbr); }
+          connections[nbr] += weights[i];
+          queue.emplace(connections[nbr], nbr);
+        }
+      }
+    }
+    for (auto v : touched_vertices) {
+      connections[v] = weight_t{0};  // connections to the next part start from 0
+    }
+    remaining_weight -= part_weight;
+  }
+
+  return parts;
+}
+
+template <typename GraphViewType>
+rmm::device_uvector<typename GraphViewType::vertex_type> heavy_edge_matching(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  rmm::device_uvector<typename GraphViewType::weight_type> const& vertex_weights,
+  typename GraphViewType::weight_type max_vertex_weight,
+  uint64_t seed)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  auto const v_first    = graph_view.local_vertex_partition_range_first();
+  auto const local_size = static_cast<size_t>(graph_view.local_vertex_partition_range_size());
+
+  rmm::device_uvector<vertex_t> partners(local_size, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(),
+               partners.begin(),
+               partners.end(),
+               invalid_vertex_id<vertex_t>::value);
+  // vertex weight if unmatched, 0 if matched
+  rmm::device_uvector<weight_t> matching_weights(local_size, handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(),
+               vertex_weights.begin(),
+               vertex_weights.end(),
+               matching_weights.begin());
+
+  rmm::device_uvector<weight_t> heaviest_weights(local_size, handle.get_stream());
+  rmm::device_uvector<uint64_t> tie_breakers(local_size, handle.get_stream());
+  rmm::device_uvector<vertex_t> proposals(local_size, handle.get_stream());
+  rmm::device_uvector<vertex_t> is_mutuals(local_size, handle.get_stream());
+
+  auto src_info_cache =
+    edge_partition_src_property_t<GraphViewType, thrust::tuple<weight_t, weight_t, uint64_t>>(
+      handle);
+  auto dst_matching_weights_cache = edge_partition_dst_property_t<GraphViewType, weight_t>(handle);
+  auto src_proposals_cache        = edge_partition_src_property_t<GraphViewType, vertex_t>(handle);
+  auto dst_proposals_cache        = edge_partition_dst_property_t<GraphViewType, vertex_t>(handle);
+  if constexpr (GraphViewType::is_multi_gpu) {
+    src_info_cache =
+      edge_partition_src_property_t<GraphViewType, thrust::tuple<weight_t, weight_t, uint64_t>>(
+        handle, graph_view);
+    dst_matching_weights_cache =
+      edge_partition_dst_property_t<GraphViewType, weight_t>(handle, graph_view);
+    src_proposals_cache =
+      edge_partition_src_property_t<GraphViewType, vertex_t>(handle, graph_view);
+    dst_proposals_cache =
+      edge_partition_dst_property_t<GraphViewType, vertex_t>(handle, graph_view);
+  }
+
+  auto src_info_first = thrust::make_zip_iterator(thrust::make_tuple(
+    matching_weights.cbegin(), heaviest_weights.cbegin(), tie_breakers.cbegin()));
+  auto src_info_view =
+    GraphViewType::is_multi_gpu
+      ? src_info_cache.device_view()
+      : detail::edge_partition_major_property_device_view_t<vertex_t, decltype(src_info_first)>(
+          src_info_first);
+  auto dst_matching_weights_view =
+    GraphViewType::is_multi_gpu
+      ? dst_matching_weights_cache.device_view()
+      : detail::edge_partition_minor_property_device_view_t<vertex_t, weight_t const*>(
+          matching_weights.data(), vertex_t{0});
+  auto update_src_info = [&]() {
+    if constexpr (GraphViewType::is_multi_gpu) {
+      update_edge_partition_src_property(handle, graph_view, src_info_first, src_info_cache);
+    }
+  };
+
+  // every unmatched vertex proposes to the unmatched neighbor with the heaviest edge (ties broken
+  // by edge_tie_breaker and then by the neighbor's vertex ID), and mutual proposals are matched
+
+  for (size_t round = 0; round < num_matching_rounds; ++round) {
+    auto round_seed = seed + static_cast<uint64_t>(round);
+
+    if constexpr (GraphViewType::is_multi_gpu) {
+      update_edge_partition_dst_property(
+        handle, graph_view, matching_weights.begin(), dst_matching_weights_cache);
+    }
+
+    update_src_info();
+    per_v_transform_reduce_outgoing_e(
+      handle,
+      graph_view,
+      src_info_view,
+      dst_matching_weights_view,
+      heaviest_matchable_edge_t<vertex_t, weight_t>{max_vertex_weight},
+      std::numeric_limits<weight_t>::lowest(),
+      reduce_op::maximum<weight_t>{},
+      heaviest_weights.begin());
+
+    update_src_info();
+    per_v_transform_reduce_outgoing_e(
+      handle,
+      graph_view,
+      src_info_view,
+      dst_matching_weights_view,
+      heaviest_matchable_edge_tie_breaker_t<vertex_t, weight_t>{max_vertex_weight, round_seed},
+      uint64_t{0},
+      reduce_op::maximum<uint64_t>{},
+      tie_breakers.begin());
+
+    update_src_info();
+    per_v_transform_reduce_outgoing_e(
+      handle,
+      graph_view,
+      src_info_view,
+      dst_matching_weights_view,
+      matching_proposal_t<vertex_t, weight_t>{max_vertex_weight, round_seed},
+      invalid_vertex_id<vertex_t>::value,
+      reduce_op::maximum<vertex_t>{},
+      proposals.begin());
+
+    if constexpr (GraphViewType::is_multi_gpu) {
+      update_edge_partition_src_property(
+        handle, graph_view, proposals.begin(), src_proposals_cache);
+      update_edge_partition_dst_property(
+        handle, graph_view, proposals.begin(), dst_proposals_cache);
+    }
+    per_v_transform_reduce_outgoing_e(
+      handle,
+      graph_view,
+      GraphViewType::is_multi_gpu
+        ? src_proposals_cache.device_view()
+        : detail::edge_partition_major_property_device_view_t<vertex_t, vertex_t const*>(
+            proposals.data()),
+      GraphViewType::is_multi_gpu
+        ? dst_proposals_cache.device_view()
+        : detail::edge_partition_minor_property_device_view_t<vertex_t, vertex_t const*>(
+            proposals.data(), vertex_t{0}),
+      is_mutual_proposal_t<vertex_t, weight_t>{},
+      vertex_t{0},
+      reduce_op::maximum<vertex_t>{},
+      is_mutuals.begin());
+
+    auto num_matched = static_cast<size_t>(thrust::count(
+      handle.get_thrust_policy(), is_mutuals.begin(), is_mutuals.end(), vertex_t{1}));
+    if constexpr (GraphViewType::is_multi_gpu) {
+      num_matched = host_scalar_allreduce(
+        handle.get_comms(), num_matched, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    if (num_matched == 0) { break; }
+
+    auto quadruplet_first = thrust::make_zip_iterator(thrust::make_tuple(
+      partners.begin(), matching_weights.begin(), proposals.begin(), is_mutuals.begin()));
+    thrust::transform(
+      handle.get_thrust_policy(),
+      quadruplet_first,
+      quadruplet_first + local_size,
+      thrust::make_zip_iterator(thrust::make_tuple(partners.begin(), matching_weights.begin())),
+      update_match_t<vertex_t, weight_t>{});
+  }
+
+  // a matched pair is labeled with the smaller vertex ID, an unmatched vertex with its own ID
+
+  rmm::device_uvector<vertex_t> labels(local_size, handle.get_stream());
+  auto pair_first = thrust::make_zip_iterator(
+    thrust::make_tuple(thrust::make_counting_iterator(v_first), partners.begin()));
+  thrust::transform(handle.get_thrust_policy(),
+                    pair_first,
+                    pair_first + local_size,
+                    labels.begin(),
+                    match_label_t<vertex_t>{});
+
+  return labels;
+}
+
+// vertex weights of the coarsened graph (the sum of the vertex weights with the same label)
+template <typename GraphViewType>
+rmm::device_uvector<typename GraphViewType::weight_type> coarsen_vertex_weights(
+  raft::handle_t const& handle,
+  GraphViewType const& coarse_graph_view,
+  rmm::device_uvector<typename GraphViewType::vertex_type> const& labels,
+  rmm::device_uvector<typename GraphViewType::weight_type> const& vertex_weights,
+  rmm::device_uvector<typename GraphViewType::vertex_type> const& numbering_map)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  auto reduce_by_label = [&handle](rmm::device_uvector<vertex_t>&& keys,
+                                   rmm::device_uvector<weight_t>&& values) {
+    thrust::sort_by_key(handle.get_thrust_policy(), keys.begin(), keys.end(), values.begin());
+    rmm::device_uvector<vertex_t> reduced_keys(keys.size(), handle.get_stream());
+    rmm::device_uvector<weight_t> reduced_values(reduced_keys.size(), handle.get_stream());
+    auto last = thrust::reduce_by_key(handle.get_thrust_policy(),
+                                      keys.begin(),
+                                      keys.end(),
+                                      values.begin(),
+                                      reduced_keys.begin(),
+                                      reduced_values.begin());
+    reduced_keys.resize(thrust::distance(reduced_keys.begin(), thrust::get<0>(last)),
+                        handle.get_stream());
+    reduced_values.resize(reduced_keys.size(), handle.get_stream());
+    return std::make_tuple(std::move(reduced_keys), std::move(reduced_values));
+  };
+
+  rmm::device_uvector<vertex_t> keys(labels.size(), handle.get_stream());
+  rmm::device_uvector<weight_t> values(vertex_weights.size(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(), labels.begin(), labels.end(), keys.begin());
+  thrust::copy(
+    handle.get_thrust_policy(), vertex_weights.begin(), vertex_weights.end(), values.begin());
+  std::tie(keys, values) = reduce_by_label(std::move(keys), std::move(values));
+  if constexpr (GraphViewType::is_multi_gpu) {
+    std::tie(keys, values) =
+      cugraph::detail::shuffle_ext_vertices_and_values_by_gpu_id(
+        handle, std::move(keys), std::move(values));
+    std::tie(keys, values) = reduce_by_label(std::move(keys), std::move(values));
+  }
+
+  return cugraph::detail::collect_local_vertex_values_from_ext_vertex_value_pairs<
+    vertex_t,
+    weight_t,
+    GraphViewType::is_multi_gpu>(handle,
+                                 std::move(keys),
+                                 std::move(values),
+                                 numbering_map,
+                                 coarse_graph_view.local_vertex_partition_range_first(),
+                                 coarse_graph_view.local_vertex_partition_range_last(),
+                                 weight_t{0},
+                                 false);
+}
+
+template <typename GraphViewType>
+rmm::device_uvector<typename GraphViewType::vertex_type> initial_partition(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  rmm::device_uvector<typename GraphViewType::weight_type> const& vertex_weights,
+  typename GraphViewType::vertex_type num_parts)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  auto const num_vertices = graph_view.number_of_vertices();
+
+  // the coarsest graph is small, so every GPU gathers the entire graph and computes the same
+  // partition on the host
+
+  auto [srcs, dsts, weights] =
+    graph_view.decompress_to_edgelist(handle, std::optional<rmm::device_uvector<vertex_t>>{});
+  rmm::device_uvector<weight_t> all_vertex_weights(0, handle.get_stream());
+  std::vector<vertex_t> vertex_partition_firsts{graph_view.local_vertex_partition_range_first()};
+  std::vector<size_t> vertex_partition_sizes{vertex_weights.size()};
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& comm = handle.get_comms();
+
+    auto rx_counts = host_scalar_allgather(comm, srcs.size(), handle.get_stream());
+    std::vector<size_t> displacements(rx_counts.size());
+    std::exclusive_scan(rx_counts.begin(), rx_counts.end(), displacements.begin(), size_t{0});
+    rmm::device_uvector<vertex_t> rx_srcs(displacements.back() + rx_counts.back(),
+                                          handle.get_stream());
+    rmm::device_uvector<vertex_t> rx_dsts(rx_srcs.size(), handle.get_stream());
+    rmm::device_uvector<weight_t> rx_weights(rx_srcs.size(), handle.get_stream());
+    device_allgatherv(
+      comm,
+      thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), dsts.begin(), (*weights).begin())),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(rx_srcs.begin(), rx_dsts.begin(), rx_weights.begin())),
+      rx_counts,
+      displacements,
+      handle.get_stream());
+    srcs     = std::move(rx_srcs);
+    dsts     = std::move(rx_dsts);
+    *weights = std::move(rx_weights);
+
+    vertex_partition_firsts = host_scalar_allgather(
+      comm, graph_view.local_vertex_partition_range_first(), handle.get_stream());
+    vertex_partition_sizes =
+      host_scalar_allgather(comm, vertex_weights.size(), handle.get_stream());
+    std::exclusive_scan(vertex_partition_sizes.begin(),
+                        vertex_partition_sizes.end(),
+                        displacements.begin(),
+                        size_t{0});
+    all_vertex_weights.resize(num_vertices, handle.get_stream());
+    device_allgatherv(comm,
+                      vertex_weights.begin(),
+                      all_vertex_weights.begin(),
+                      vertex_partition_sizes,
+                      displacements,
+                      handle.get_stream());
+  }
+
+  std::vector<vertex_t> h_srcs(srcs.size());
+  std::vector<vertex_t> h_dsts(dsts.size());
+  std::vector<weight_t> h_weights(srcs.size());
+  std::vector<weight_t> h_gathered_vertex_weights(num_vertices);
+  raft::update_host(h_srcs.data(), srcs.data(), srcs.size(), handle.get_stream());
+  raft::update_host(h_dsts.data(), dsts.data(), dsts.size(), handle.get_stream());
+  raft::update_host(h_weights.data(), (*weights).data(), (*weights).size(), handle.get_stream());
+  raft::update_host(h_gathered_vertex_weights.data(),
+                    GraphViewType::is_multi_gpu ? all_vertex_weights.data() : vertex_weights.data(),
+                    num_vertices,
+                    handle.get_stream());
+  handle.sync_stream();
+
+  std::vector<weight_t> h_vertex_weights(num_vertices);
+  for (size_t i = 0, offset = 0; i < vertex_partition_firsts.size(); ++i) {
+    std::copy(h_gathered_vertex_weights.begin() + offset,
+              h_gathered_vertex_weights.begin() + offset + vertex_partition_sizes[i],
+              h_vertex_weights.begin() + vertex_partition_firsts[i]);
+    offset += vertex_partition_sizes[i];
+  }
+
+  // host CSR
+
+  std::vector<size_t> h_offsets(num_vertices + 1, size_t{0});
+  for (auto src : h_srcs) {
+    ++h_offsets[src + 1];
+  }
+  std::partial_sum(h_offsets.begin(), h_offsets.end(), h_offsets.begin());
+  std::vector<vertex_t> h_indices(h_srcs.size());
+  std::vector<weight_t> h_csr_weights(h_srcs.size());
+  {
+    auto insert_offsets = h_offsets;
+    for (size_t i = 0; i < h_srcs.size(); ++i) {
+      auto pos           = insert_offsets[h_srcs[i]]++;
+      h_indices[pos]     = h_dsts[i];
+      h_csr_weights[pos] = h_weights[i];
+    }
+  }
+
+  auto h_parts =
+    greedy_graph_growing(h_offsets, h_indices, h_csr_weights, h_vertex_weights, num_parts);
+
+  rmm::device_uvector<vertex_t> parts(vertex_weights.size(), handle.get_stream());
+  raft::update_device(parts.data(),
+                      h_parts.data() + graph_view.local_vertex_partition_range_first(),
+                      parts.size(),
+                      handle.get_stream());
+  handle.sync_stream();
+
+  return parts;
+}
+
+// total vertex weight of each part (replicated in every GPU)
+template <typename GraphViewType>
+void compute_part_weights(
+  raft::handle_t const& handle,
+  rmm::device_uvector<typename GraphViewType::vertex_type> const& parts,
+  rmm::device_uvector<typename GraphViewType::weight_type> const& vertex_weights,
+  rmm::device_uvector<typename GraphViewType::weight_type>& part_weights)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  rmm::device_uvector<vertex_t> sorted_parts(parts.size(), handle.get_stream());
+  rmm::device_uvector<weight_t> weights(vertex_weights.size(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(), parts.begin(), parts.end(), sorted_parts.begin());
+  thrust::copy(
+    handle.get_thrust_policy(), vertex_weights.begin(), vertex_weights.end(), weights.begin());
+  thrust::sort_by_key(
+    handle.get_thrust_policy(), sorted_parts.begin(), sorted_parts.end(), weights.begin());
+
+  rmm::device_uvector<vertex_t> unique_parts(sorted_parts.size(), handle.get_stream());
+  rmm::device_uvector<weight_t> sums(unique_parts.size(), handle.get_stream());
+  auto last = thrust::reduce_by_key(handle.get_thrust_policy(),
+                                    sorted_parts.begin(),
+                                    sorted_parts.end(),
+                                    weights.begin(),
+                                    unique_parts.begin(),
+                                    sums.begin());
+  thrust::fill(handle.get_thrust_policy(), part_weights.begin(), part_weights.end(), weight_t{0});
+  thrust::scatter(handle.get_thrust_policy(),
+                  sums.begin(),
+                  sums.begin() + thrust::distance(unique_parts.begin(), thrust::get<0>(last)),
+                  unique_parts.begin(),
+                  part_weights.begin());
+
+  if constexpr (GraphViewType::is_multi_gpu) {
+    device_allreduce(handle.get_comms(),
+                     part_weights.begin(),
+                     part_weights.begin(),
+                     part_weights.size(),
+                     raft::comms::op_t::SUM,
+                     handle.get_stream());
+  }
+}
+
+// parallel label propagation style refinement (with a balance constraint): in every iteration,
+// each vertex finds the part (among its neighbors' parts) with the largest gain, and the moves with
+// positive gains (or out of overweight parts) are accepted in the gain order while the target part
+// stays within max_part_weight. If rebalance is set, the refinement is followed by rebalancing
+// rounds that move the excess vertices of the overweight parts to the parts with room.
+template <typename GraphViewType>
+void refine_partition(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  rmm::device_uvector<typename GraphViewType::weight_type> const& vertex_weights,
+  rmm::device_uvector<typename GraphViewType::vertex_type>& parts,
+  typename GraphViewType::vertex_type num_parts,
+  typename GraphViewType::weight_type max_part_weight,
+  size_t max_iterations,
+  bool rebalance)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  auto const local_size = static_cast<size_t>(graph_view.local_vertex_partition_range_size());
+  int comm_rank{0};
+  int comm_size{1};
+  if constexpr (GraphViewType::is_multi_gpu) {
+    comm_rank = handle.get_comms().get_rank();
+    comm_size = handle.get_comms().get_size();
+  }
+
+  rmm::device_uvector<weight_t> part_weights(num_parts, handle.get_stream());
+  rmm::device_uvector<weight_t> own_part_edge_weights(local_size, handle.get_stream());
+  rmm::device_uvector<weight_t> own_part_weights(local_size, handle.get_stream());
+  auto best_moves =
+    allocate_dataframe_buffer<thrust::tuple<vertex_t, weight_t>>(local_size, handle.get_stream());
+
+  auto src_parts_cache = edge_partition_src_property_t<GraphViewType, vertex_t>(handle);
+  auto dst_parts_cache = edge_partition_dst_property_t<GraphViewType, vertex_t>(handle);
+  auto src_info_cache =
+    edge_partition_src_property_t<GraphViewType,
+                                  thrust::tuple<vertex_t, weight_t, weight_t, weight_t>>(handle);
+  if constexpr (GraphViewType::is_multi_gpu) {
+    src_parts_cache = edge_partition_src_property_t<GraphViewType, vertex_t>(handle, graph_view);
+    dst_parts_cache = edge_partition_dst_property_t<GraphViewType, vertex_t>(handle, graph_view);
+    src_info_cache =
+      edge_partition_src_property_t<GraphViewType,
+                                    thrust::tuple<vertex_t, weight_t, weight_t, weight_t>>(
+        handle, graph_view);
+  }
+  auto src_info_first = thrust::make_zip_iterator(thrust::make_tuple(parts.cbegin(),
+                                                                     vertex_weights.cbegin(),
+                                                                     own_part_edge_weights.cbegin(),
+                                                                     own_part_weights.cbegin()));
+
+  // part_weights, own_part_weights, own_part_edge_weights, and the best move (the part with the
+  // largest gain among the parts with room) of every local vertex for the current parts
+  auto compute_best_moves = [&]() {
+    compute_part_weights<GraphViewType>(handle, parts, vertex_weights, part_weights);
+    thrust::gather(handle.get_thrust_policy(),
+                   parts.begin(),
+                   parts.end(),
+                   part_weights.begin(),
+                   own_part_weights.begin());
+
+    if constexpr (GraphViewType::is_multi_gpu) {
+      update_edge_partition_src_property(handle, graph_view, parts.begin(), src_parts_cache);
+      update_edge_partition_dst_property(handle, graph_view, parts.begin(), dst_parts_cache);
+    }
+    auto dst_parts_view =
+      GraphViewType::is_multi_gpu
+        ? dst_parts_cache.device_view()
+        : detail::edge_partition_minor_property_device_view_t<vertex_t, vertex_t const*>(
+            parts.data(), vertex_t{0});
+
+    per_v_transform_reduce_outgoing_e(
+      handle,
+      graph_view,
+      GraphViewType::is_multi_gpu
+        ? src_parts_cache.device_view()
+        : detail::edge_partition_major_property_device_view_t<vertex_t, vertex_t const*>(
+            parts.data()),
+      dst_parts_view,
+      own_part_edge_weight_t<vertex_t, weight_t>{},
+      weight_t{0},
+      own_part_edge_weights.begin());
+
+    if constexpr (GraphViewType::is_multi_gpu) {
+      update_edge_partition_src_property(handle, graph_view, src_info_first, src_info_cache);
+    }
+
+    // (part, part weight) pairs (in multi-GPU, distributed by
+    // cugraph::detail::compute_gpu_id_from_ext_vertex_t)
+
+    rmm::device_uvector<vertex_t> map_keys(num_parts, handle.get_stream());
+    map_keys.resize(
+      thrust::distance(map_keys.begin(),
+                       thrust::copy_if(handle.get_thrust_policy(),
+                                       thrust::make_counting_iterator(vertex_t{0}),
+                                       thrust::make_counting_iterator(num_parts),
+                                       map_keys.begin(),
+                                       is_local_key_t<vertex_t>{comm_rank, comm_size})),
+      handle.get_stream());
+    rmm::device_uvector<weight_t> map_values(map_keys.size(), handle.get_stream());
+    thrust::gather(handle.get_thrust_policy(),
+                   map_keys.begin(),
+                   map_keys.end(),
+                   part_weights.begin(),
+                   map_values.begin());
+
+    per_v_transform_reduce_dst_key_aggregated_outgoing_e(
+      handle,
+      graph_view,
+      GraphViewType::is_multi_gpu
+        ? src_info_cache.device_view()
+        : detail::edge_partition_major_property_device_view_t<vertex_t, decltype(src_info_first)>(
+            src_info_first),
+      dst_parts_view,
+      map_keys.begin(),
+      map_keys.end(),
+      map_values.begin(),
+      invalid_vertex_id<vertex_t>::value,
+      std::numeric_limits<weight_t>::max(),
+      move_gain_t<vertex_t, weight_t>{max_part_weight},
+      best_move_t<vertex_t, weight_t>::identity_element,
+      best_move_t<vertex_t, weight_t>{},
+      get_dataframe_buffer_begin(best_moves));
+  };
+
+  bool up_down{true};
+  size_t num_idle_iterations{0};
+  for (size_t iter = 0; iter < max_iterations; ++iter) {
+    compute_best_moves();
+
+    // select the moves
+
+    rmm::device_uvector<size_t> candidates(local_size, handle.get_stream());
+    candidates.resize(
+      thrust::distance(
+        candidates.begin(),
+        thrust::copy_if(handle.get_thrust_policy(),
+                        thrust::make_counting_iterator(size_t{0}),
+                        thrust::make_counting_iterator(local_size),
+                        candidates.begin(),
+                        is_move_candidate_t<vertex_t, weight_t>{parts.data(),
+                                                                own_part_weights.data(),
+                                                                std::get<0>(best_moves).data(),
+                                                                std::get<1>(best_moves).data(),
+                                                                max_part_weight,
+                                                                up_down})),
+      handle.get_stream());
+
+    rmm::device_uvector<vertex_t> targets(candidates.size(), handle.get_stream());
+    rmm::device_uvector<weight_t> gains(candidates.size(), handle.get_stream());
+    rmm::device_uvector<weight_t> cumulative_weights(candidates.size(), handle.get_stream());
+    thrust::gather(handle.get_thrust_policy(),
+                   candidates.begin(),
+                   candidates.end(),
+                   get_dataframe_buffer_begin(best_moves),
+                   thrust::make_zip_iterator(thrust::make_tuple(targets.begin(), gains.begin())));
+    auto triplet_first = thrust::make_zip_iterator(
+      thrust::make_tuple(targets.begin(), gains.begin(), candidates.begin()));
+    thrust::sort(handle.get_thrust_policy(),
+                 triplet_first,
+                 triplet_first + candidates.size(),
+                 move_priority_less_t<vertex_t, weight_t>{});
+    thrust::gather(handle.get_thrust_policy(),
+                   candidates.begin(),
+                   candidates.end(),
+                   vertex_weights.begin(),
+                   cumulative_weights.begin());
+    thrust::inclusive_scan_by_key(handle.get_thrust_policy(),
+                                  targets.begin(),
+                                  targets.end(),
+                                  cumulative_weights.begin(),
+                                  cumulative_weights.begin());
+
+    auto pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(targets.begin(), cumulative_weights.begin()));
+    rmm::device_uvector<vertex_t> moved_parts(candidates.size(), handle.get_stream());
+    rmm::device_uvector<size_t> moved_vertices(candidates.size(), handle.get_stream());
+    auto moved_pair_first = thrust::make_zip_iterator(
+      thrust::make_tuple(moved_parts.begin(), moved_vertices.begin()));
+    auto num_moves = static_cast<size_t>(thrust::distance(
+      moved_pair_first,
+      thrust::copy_if(
+        handle.get_thrust_policy(),
+        thrust::make_zip_iterator(thrust::make_tuple(targets.begin(), candidates.begin())),
+        thrust::make_zip_iterator(thrust::make_tuple(targets.end(), candidates.end())),
+        pair_first,
+        moved_pair_first,
+        is_accepted_move_t<vertex_t, weight_t>{
+          part_weights.data(), max_part_weight, comm_size})));
+    thrust::scatter(handle.get_thrust_policy(),
+                    moved_parts.begin(),
+                    moved_parts.begin() + num_moves,
+                    moved_vertices.begin(),
+                    parts.begin());
+
+    if constexpr (GraphViewType::is_multi_gpu) {
+      num_moves = host_scalar_allreduce(
+        handle.get_comms(), num_moves, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    // stop after an idle iteration in each direction
+    num_idle_iterations = num_moves > 0 ? size_t{0} : num_idle_iterations + 1;
+    if (num_idle_iterations >= 2) { break; }
+    up_down = !up_down;
+  }
+
+  if (!rebalance) { return; }
+
+  // rebalance: the refinement moves a vertex out of an overweight part only to a neighboring part
+  // with room, so the excess may remain; move the excess of every overweight part (in the gain
+  // order) to the parts with room (this succeeds if the vertex weights are 1 and max_part_weight is
+  // an integer no smaller than the average part weight)
+
+  std::vector<weight_t> h_part_weights(num_parts);
+  std::vector<weight_t> h_quotas(num_parts);
+  rmm::device_uvector<weight_t> quotas(num_parts, handle.get_stream());
+  size_t num_idle_rounds{0};
+  for (size_t round = 0; num_idle_rounds < static_cast<size_t>(comm_size); ++round) {
+    compute_best_moves();
+    raft::update_host(
+      h_part_weights.data(), part_weights.data(), part_weights.size(), handle.get_stream());
+    handle.sync_stream();
+    if (*std::max_element(h_part_weights.begin(), h_part_weights.end()) <= max_part_weight) {
+      break;
+    }
+
+    // the excess of an overweight part (or the room of any other part) is split among the GPUs as
+    // the GPUs decide concurrently, the remainder goes to different GPUs in different rounds, so
+    // every GPU gets a non-zero quota at least once in every comm_size rounds
+    auto lightest_part = static_cast<vertex_t>(std::distance(
+      h_part_weights.begin(), std::min_element(h_part_weights.begin(), h_part_weights.end())));
+    for (vertex_t p = 0; p < num_parts; ++p) {
+      auto quota  = static_cast<size_t>(h_part_weights[p] > max_part_weight
+                                         ? h_part_weights[p] - max_part_weight
+                                         : max_part_weight - h_part_weights[p]);
+      h_quotas[p] = static_cast<weight_t>(
+        quota / static_cast<size_t>(comm_size) +
+        (((static_cast<size_t>(comm_rank) + round) % static_cast<size_t>(comm_size)) <
+             quota % static_cast<size_t>(comm_size)
+           ? size_t{1}
+           : size_t{0}));
+    }
+    raft::update_device(quotas.data(), h_quotas.data(), h_quotas.size(), handle.get_stream());
+
+    auto moves =
+      allocate_dataframe_buffer<thrust::tuple<vertex_t, weight_t>>(local_size, handle.get_stream());
+    auto quadruplet_first = thrust::make_zip_iterator(
+      thrust::make_tuple(own_part_weights.begin(),
+                         own_part_edge_weights.begin(),
+                         std::get<0>(best_moves).begin(),
+                         std::get<1>(best_moves).begin()));
+    thrust::transform(handle.get_thrust_policy(),
+                      quadruplet_first,
+                      quadruplet_first + local_size,
+                      get_dataframe_buffer_begin(moves),
+                      rebalancing_move_t<vertex_t, weight_t>{max_part_weight, lightest_part});
+
+    rmm::device_uvector<size_t> candidates(local_size, handle.get_stream());
+    candidates.resize(thrust::distance(candidates.begin(),
+                                       thrust::copy_if(handle.get_thrust_policy(),
+                                                       thrust::make_counting_iterator(size_t{0}),
+                                                       thrust::make_counting_iterator(local_size),
+                                                       std::get<0>(moves).begin(),
+                                                       candidates.begin(),
+                                                       is_valid_part_t<vertex_t>{})),
+                      handle.get_stream());
+
+    rmm::device_uvector<vertex_t> sources(candidates.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> targets(candidates.size(), handle.get_stream());
+    rmm::device_uvector<weight_t> gains(candidates.size(), handle.get_stream());
+    rmm::device_uvector<weight_t> cumulative_weights(candidates.size(), handle.get_stream());
+    thrust::gather(handle.get_thrust_policy(),
+                   candidates.begin(),
+                   candidates.end(),
+                   parts.begin(),
+                   sources.begin());
+    thrust::gather(handle.get_thrust_policy(),
+                   candidates.begin(),
+                   candidates.end(),
+                   get_dataframe_buffer_begin(moves),
+                   thrust::make_zip_iterator(thrust::make_tuple(targets.begin(), gains.begin())));
+
+    // the moves out of every overweight part within its quota
+
+    auto source_triplet_first = thrust::make_zip_iterator(
+      thrust::make_tuple(sources.begin(), gains.begin(), candidates.begin()));
+    thrust::sort_by_key(handle.get_thrust_policy(),
+                        source_triplet_first,
+                        source_triplet_first + candidates.size(),
+                        targets.begin(),
+                        move_priority_less_t<vertex_t, weight_t>{});
+    thrust::gather(handle.get_thrust_policy(),
+                   candidates.begin(),
+                   candidates.end(),
+                   vertex_weights.begin(),
+                   cumulative_weights.begin());
+    thrust::inclusive_scan_by_key(handle.get_thrust_policy(),
+                                  sources.begin(),
+                                  sources.end(),
+                                  cumulative_weights.begin(),
+                                  cumulative_weights.begin());
+    {
+      rmm::device_uvector<vertex_t> selected_targets(candidates.size(), handle.get_stream());
+      rmm::device_uvector<weight_t> selected_gains(candidates.size(), handle.get_stream());
+      rmm::device_uvector<size_t> selected_candidates(candidates.size(), handle.get_stream());
+      auto selected_triplet_first = thrust::make_zip_iterator(thrust::make_tuple(
+        selected_targets.begin(), selected_gains.begin(), selected_candidates.begin()));
+      auto triplet_first = thrust::make_zip_iterator(
+        thrust::make_tuple(targets.begin(), gains.begin(), candidates.begin()));
+      auto num_selected = static_cast<size_t>(thrust::distance(
+        selected_triplet_first,
+        thrust::copy_if(handle.get_thrust_policy(),
+                        triplet_first,
+                        triplet_first + candidates.size(),
+                        thrust::make_zip_iterator(
+                          thrust::make_tuple(sources.begin(), cumulative_weights.begin())),
+                        selected_triplet_first,
+                        is_within_quota_t<vertex_t, weight_t>{quotas.data()})));
+      selected_targets.resize(num_selected, handle.get_stream());
+      selected_gains.resize(num_selected, handle.get_stream());
+      selected_candidates.resize(num_selected, handle.get_stream());
+      targets    = std::move(selected_targets);
+      gains      = std::move(selected_gains);
+      candidates = std::move(selected_candidates);
+      cumulative_weights.resize(num_selected, handle.get_stream());
+    }
+
+    // the moves into every part within its quota
+
+    auto target_triplet_first = thrust::make_zip_iterator(
+      thrust::make_tuple(targets.begin(), gains.begin(), candidates.begin()));
+    thrust::sort(handle.get_thrust_policy(),
+                 target_triplet_first,
+                 target_triplet_first + candidates.size(),
+                 move_priority_less_t<vertex_t, weight_t>{});
+    thrust::gather(handle.get_thrust_policy(),
+                   candidates.begin(),
+                   candidates.end(),
+                   vertex_weights.begin(),
+                   cumulative_weights.begin());
+    thrust::inclusive_scan_by_key(handle.get_thrust_policy(),
+                                  targets.begin(),
+                                  targets.end(),
+                                  cumulative_weights.begin(),
+                                  cumulative_weights.begin());
+
+    rmm::device_uvector<vertex_t> moved_parts(candidates.size(), handle.get_stream());
+    rmm::device_uvector<size_t> moved_vertices(candidates.size(), handle.get_stream());
+    auto moved_pair_first = thrust::make_zip_iterator(
+      thrust::make_tuple(moved_parts.begin(), moved_vertices.begin()));
+    auto num_moves = static_cast<size_t>(thrust::distance(
+      moved_pair_first,
+      thrust::copy_if(
+        handle.get_thrust_policy(),
+        thrust::make_zip_iterator(thrust::make_tuple(targets.begin(), candidates.begin())),
+        thrust::make_zip_iterator(thrust::make_tuple(targets.end(), candidates.end())),
+        thrust::make_zip_iterator(thrust::make_tuple(targets.begin(), cumulative_weights.begin())),
+        moved_pair_first,
+        is_within_quota_t<vertex_t, weight_t>{quotas.data()})));
+    thrust::scatter(handle.get_thrust_policy(),
+                    moved_parts.begin(),
+                    moved_parts.begin() + num_moves,
+                    moved_vertices.begin(),
+                    parts.begin());
+
+    if constexpr (GraphViewType::is_multi_gpu) {
+      num_moves = host_scalar_allreduce(
+        handle.get_comms(), num_moves, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    num_idle_rounds = num_moves > 0 ? size_t{0} : num_idle_rounds + 1;
+  }
+}
+
+// partition of the coarse vertices => partition of the fine vertices
+template <typename GraphViewType>
+rmm::device_uvector<typename GraphViewType::vertex_type> project_partition(
+  raft::handle_t const& handle,
+  GraphViewType const& coarse_graph_view,
+  rmm::device_uvector<typename GraphViewType::vertex_type> const& coarse_parts,
+  rmm::device_uvector<typename GraphViewType::vertex_type> const& fine_to_coarse)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  rmm::device_uvector<vertex_t> fine_parts(fine_to_coarse.size(), handle.get_stream());
+  if constexpr (GraphViewType::is_multi_gpu) {
+    rmm::device_uvector<vertex_t> unique_coarse_vertices(fine_to_coarse.size(),
+                                                         handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 fine_to_coarse.begin(),
+                 fine_to_coarse.end(),
+                 unique_coarse_vertices.begin());
+    thrust::sort(
+      handle.get_thrust_policy(), unique_coarse_vertices.begin(), unique_coarse_vertices.end());
+    unique_coarse_vertices.resize(thrust::distance(unique_coarse_vertices.begin(),
+                                                   thrust::unique(handle.get_thrust_policy(),
+                                                                  unique_coarse_vertices.begin(),
+                                                                  unique_coarse_vertices.end())),
+                                  handle.get_stream());
+    auto unique_coarse_parts = collect_values_for_sorted_unique_vertices(
+      handle.get_comms(),
+      unique_coarse_vertices.data(),
+      static_cast<vertex_t>(unique_coarse_vertices.size()),
+      coarse_parts.begin(),
+      coarse_graph_view.vertex_partition_range_lasts(),
+      handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      fine_to_coarse.begin(),
+                      fine_to_coarse.end(),
+                      fine_parts.begin(),
+                      sorted_unique_value_lookup_t<vertex_t, vertex_t>{
+                        unique_coarse_vertices.data(),
+                        unique_coarse_parts.data(),
+                        unique_coarse_vertices.size()});
+  } else {
+    thrust::gather(handle.get_thrust_policy(),
+                   fine_to_coarse.begin(),
+                   fine_to_coarse.end(),
+                   coarse_parts.begin(),
+                   fine_parts.begin());
+  }
+
+  return fine_parts;
+}
+
+template <typename GraphViewType>
+rmm::device_uvector<typename GraphViewType::vertex_type> k_way_partition(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  size_t num_partitions,
+  double imbalance,
+  size_t refinement_iterations,
+  uint64_t seed,
+  bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+  using graph_t =
+    cugraph::graph_t<vertex_t, edge_t, weight_t, false, GraphViewType::is_multi_gpu>;
+
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  auto const num_vertices = graph_view.number_of_vertices();
+  auto const local_size   = static_cast<size_t>(graph_view.local_vertex_partition_range_size());
+
+  CUGRAPH_EXPECTS(
+    graph_view.is_symmetric(),
+    "Invalid input arguments: k_way_partition currently supports undirected graphs only.");
+  CUGRAPH_EXPECTS(graph_view.is_weighted(),
+                  "Invalid input arguments: k_way_partition currently requires a weighted graph.");
+  CUGRAPH_EXPECTS((num_partitions > 0) && (num_partitions <= static_cast<size_t>(num_vertices)),
+                  "Invalid input arguments: num_partitions should be in [1, "
+                  "graph_view.number_of_vertices()].");
+  CUGRAPH_EXPECTS(imbalance >= 0.0, "Invalid input arguments: imbalance should be non-negative.");
+
+  if (do_expensive_check) {
+    // currently, nothing to do
+  }
+
+  auto const num_parts = static_cast<vertex_t>(num_partitions);
+  if (num_parts == vertex_t{1}) {
+    rmm::device_uvector<vertex_t> parts(local_size, handle.get_stream());
+    thrust::fill(handle.get_thrust_policy(), parts.begin(), parts.end(), vertex_t{0});
+    return parts;
+  }
+
+  auto const total_weight    = static_cast<weight_t>(num_vertices);
+  auto const coarsest_size   = std::max(num_partitions * coarsest_vertices_per_part,
+                                        min_coarsest_vertices);
+  // an integer no smaller than the average part weight, so the final rebalancing always succeeds
+  auto const max_part_weight = static_cast<weight_t>(
+    std::max(std::floor((1.0 + imbalance) * static_cast<double>(total_weight) /
+                        static_cast<double>(num_partitions)),
+             std::ceil(static_cast<double>(total_weight) / static_cast<double>(num_partitions))));
+  // METIS style vertex weight limit, so the coarsest graph can still be balanced
+  auto const max_vertex_weight =
+    static_cast<weight_t>(1.5 * static_cast<double>(total_weight) /
+                          static_cast<double>(coarsest_size));
+
+  // 1. coarsen: level 0 is the input graph, level l + 1 is level l contracted along a heavy-edge
+  // matching
+
+  std::vector<graph_t> coarse_graphs{};
+  coarse_graphs.reserve(max_coarsening_levels);
+  std::vector<rmm::device_uvector<vertex_t>> fine_to_coarse_maps{};
+  std::vector<rmm::device_uvector<weight_t>> level_vertex_weights{};
+  level_vertex_weights.emplace_back(local_size, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(),
+               level_vertex_weights.back().begin(),
+               level_vertex_weights.back().end(),
+               weight_t{1});
+
+  auto level_view = [&graph_view, &coarse_graphs](size_t level) {
+    return level == 0 ? graph_view : coarse_graphs[level - 1].view();
+  };
+
+  while (level_vertex_weights.size() < max_coarsening_levels) {
+    auto fine_graph_view = level_view(level_vertex_weights.size() - 1);
+    if (static_cast<size_t>(fine_graph_view.number_of_vertices()) <= coarsest_size) { break; }
+
+    auto labels = heavy_edge_matching(handle,
+                                      fine_graph_view,
+                                      level_vertex_weights.back(),
+                                      max_vertex_weight,
+                                      seed + static_cast<uint64_t>(level_vertex_weights.size()) *
+                                               num_matching_rounds);
+    auto [coarse_graph, numbering_map] = coarsen_graph(handle, fine_graph_view, labels.data());
+    auto coarse_graph_view             = coarse_graph.view();
+    if (static_cast<double>(coarse_graph_view.number_of_vertices()) >
+        min_coarsening_ratio * static_cast<double>(fine_graph_view.number_of_vertices())) {
+      break;
+    }
+
+    auto coarse_vertex_weights = coarsen_vertex_weights(
+      handle, coarse_graph_view, labels, level_vertex_weights.back(), numbering_map);
+
+    rmm::device_uvector<vertex_t> numbering_indices(numbering_map.size(), handle.get_stream());
+    thrust::sequence(handle.get_thrust_policy(),
+                     numbering_indices.begin(),
+                     numbering_indices.end(),
+                     coarse_graph_view.local_vertex_partition_range_first());
+    relabel<vertex_t, GraphViewType::is_multi_gpu>(
+      handle,
+      std::make_tuple(static_cast<vertex_t const*>(numbering_map.begin()),
+                      static_cast<vertex_t const*>(numbering_indices.begin())),
+      coarse_graph_view.local_vertex_partition_range_size(),
+      labels.data(),
+      static_cast<vertex_t>(labels.size()),
+      false);
+
+    coarse_graphs.push_back(std::move(coarse_graph));
+    fine_to_coarse_maps.push_back(std::move(labels));
+    level_vertex_weights.push_back(std::move(coarse_vertex_weights));
+  }
+
+  // 2. partition the coarsest graph and refine
+
+  auto coarsest_level = level_vertex_weights.size() - 1;
+  auto parts          = initial_partition(
+    handle, level_view(coarsest_level), level_vertex_weights[coarsest_level], num_parts);
+  refine_partition(handle,
+                   level_view(coarsest_level),
+                   level_vertex_weights[coarsest_level],
+                   parts,
+                   num_parts,
+                   max_part_weight,
+                   refinement_iterations,
+                   coarsest_level == 0);
+
+  // 3. uncoarsen: project the partition to the finer level and refine (and rebalance at the input
+  // graph level)
+
+  for (size_t level = coarsest_level; level > 0; --level) {
+    parts = project_partition(handle, level_view(level), parts, fine_to_coarse_maps[level - 1]);
+    fine_to_coarse_maps[level - 1].resize(0, handle.get_stream());
+    fine_to_coarse_maps[level - 1].shrink_to_fit(handle.get_stream());
+    refine_partition(handle,
+                     level_view(level - 1),
+                     level_vertex_weights[level - 1],
+                     parts,
+                     num_parts,
+                     max_part_weight,
+                     refinement_iterations,
+                     level == 1);
+  }
+
+  return parts;
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<vertex_t> k_way_partition(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  size_t num_partitions,
+  double imbalance,
+  size_t refinement_iterations,
+  uint64_t seed,
+  bool do_expensive_check)
+{
+  return detail::k_way_partition(handle,
+                                 graph_view,
+                                 num_partitions,
+                                 imbalance,
+                                 refinement_iterations,
+                                 seed,
+                                 do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,730 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <community/label_propagation_utils.hpp>
+#include <prims/edge_partition_src_dst_property.cuh>
+#include <prims/per_v_transform_reduce_dst_key_aggregated_outgoing_e.cuh>
+#include <prims/reduce_op.cuh>
+#include <prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh>
+#include <prims/update_edge_partition_src_dst_property.cuh>
+#include <prims/vertex_frontier.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/shuffle_wrappers.hpp>
+#include <cugraph/edge_partition_device_view.cuh>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/dataframe_buffer.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/handle.hpp>
+#include <raft/span.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/distance.h>
+#include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/replace.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <cstddef>
+#include <limits>
+#include <optional>
+
+namespace cugraph {
+
+namespace {
+
+// (label, aggregated edge weight, 1 if the label is the vertex's current label & 0 otherwise)
+template <typename vertex_t, typename weight_t>
+using label_score_t = thrust::tuple<vertex_t, weight_t, uint8_t>;
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct label_score_op_t {
+  vertex_t unlabeled{};
+
+  __device__ label_score_t<vertex_t, weight_t> operator()(
+    vertex_t, vertex_t neighbor_label, weight_t label_weight, vertex_t src_label, vertex_t) const
+  {
+    return neighbor_label != unlabeled
+             ? thrust::make_tuple(neighbor_label,
+                                  label_weight,
+                                  static_cast<uint8_t>(neighbor_label == src_label))
+             : thrust::make_tuple(unlabeled, std::numeric_limits<weight_t>::lowest(), uint8_t{0});
+  }
+};
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t, typename weight_t>
+struct best_label_op_t {
+  using type                          = label_score_t<vertex_t, weight_t>;
+  static constexpr bool pure_function = true;  // this can be called from any process
+
+  __device__ type operator()(type lhs, type rhs) const
+  {
+    return detail::lpa::is_preferred_label(thrust::get<0>(lhs),
+                                           thrust::get<1>(lhs),
+                                           thrust::get<2>(lhs) != uint8_t{0},
+                                           thrust::get<0>(rhs),
+                                           thrust::get<1>(rhs),
+                                           thrust::get<2>(rhs) != uint8_t{0})
+             ? lhs
+             : rhs;
+  }
+};
+
+template <typename vertex_t>
+struct invalid_or_outside_local_vertex_partition_range_t {
+  vertex_t num_vertices{};
+  vertex_t local_vertex_partition_range_first{};
+  vertex_t local_vertex_partition_range_last{};
+
+  __device__ bool operator()(vertex_t v) const
+  {
+    return !is_valid_vertex(num_vertices, v) || (v < local_vertex_partition_range_first) ||
+           (v >= local_vertex_partition_range_last);
+  }
+};
+
+template <typename vertex_t>
+struct invalid_label_t {
+  vertex_t num_vertices{};
+
+  __device__ bool operator()(vertex_t label) const { return !is_valid_vertex(num_vertices, label); }
+};
+
+// a vertex joins the initial frontier if it has a neighbor and its label is not fixed
+template <typename vertex_t, typename edge_t>
+struct is_initial_frontier_vertex_t {
+  edge_t const* degrees{nullptr};
+  uint8_t const* is_seed{nullptr};  // nullptr if there are no seeds
+  vertex_t local_vertex_partition_range_first{};
+
+  __device__ bool operator()(vertex_t v) const
+  {
+    auto offset = v - local_vertex_partition_range_first;
+    return (degrees[offset] > edge_t{0}) && ((is_seed == nullptr) || (is_seed[offset] == 0));
+  }
+};
+
+template <typename vertex_t>
+struct is_seed_t {
+  uint8_t const* is_seed{nullptr};  // nullptr if there are no seeds
+  vertex_t local_vertex_partition_range_first{};
+
+  __device__ bool operator()(vertex_t v) const
+  {
+    return (is_seed != nullptr) && (is_seed[v - local_vertex_partition_range_first] != 0);
+  }
+};
+
+template <typename vertex_t>
+struct is_update_iteration_t {
+  size_t iteration{};
+
+  __device__ bool operator()(vertex_t v) const
+  {
+    return detail::lpa::is_update_iteration(v, iteration);
+  }
+};
+
+// returns the new label of a frontier vertex if the vertex re-evaluates its label in this iteration
+// and the best label differs from the current label, invalid_vertex_id<vertex_t>::value otherwise
+template <typename vertex_t, typename weight_t>
+struct new_label_t {
+  vertex_t const* labels{nullptr};
+  vertex_t local_vertex_partition_range_first{};
+  size_t iteration{};
+
+  __device__ vertex_t operator()(
+    thrust::tuple<vertex_t, label_score_t<vertex_t, weight_t>> pair) const
+  {
+    auto v          = thrust::get<0>(pair);
+    auto best_label = thrust::get<0>(thrust::get<1>(pair));
+    auto score      = thrust::get<1>(thrust::get<1>(pair));
+    return (detail::lpa::is_update_iteration(v, iteration) &&
+            (score != std::numeric_limits<weight_t>::lowest()) &&
+            (best_label != labels[v - local_vertex_partition_range_first]))
+             ? best_label
+             : invalid_vertex_id<vertex_t>::value;
+  }
+};
+
+template <typename vertex_t>
+struct is_valid_label_pair_t {
+  __device__ bool operator()(thrust::tuple<vertex_t, vertex_t> pair) const
+  {
+    return thrust::get<1>(pair) != invalid_vertex_id<vertex_t>::value;
+  }
+};
+
+template <typename vertex_t>
+struct local_offset_t {
+  vertex_t local_vertex_partition_range_first{};
+
+  __device__ vertex_t operator()(vertex_t v) const
+  {
+    return v - local_vertex_partition_range_first;
+  }
+};
+
+template <typename vertex_t>
+struct push_to_neighbor_t {
+  __device__ thrust::optional<std::byte> operator()(vertex_t,
+                                                    vertex_t,
+                                                    thrust::nullopt_t,
+                                                    thrust::nullopt_t) const
+  {
+    return thrust::optional<std::byte>{std::byte{0}};
+  }
+};
+
+template <typename vertex_t, typename edge_t, typename EdgePartitionDeviceView>
+struct frontier_degree_t {
+  EdgePartitionDeviceView edge_partition{};
+
+  __device__ edge_t operator()(vertex_t v) const { return edge_partition.local_degree(v); }
+};
+
+// expands the edges of the frontier vertices to (frontier index, neighbor label, edge weight)
+// triplets, one thread per edge so high-degree vertices do not serialize
+template <typename vertex_t, typename edge_t, typename weight_t, typename EdgePartitionDeviceView>
+struct gather_frontier_edge_t {
+  EdgePartitionDeviceView edge_partition{};
+  raft::device_span<vertex_t const> frontier{};
+  raft::device_span<edge_t const> frontier_offsets{};
+  vertex_t const* labels{nullptr};
+  vertex_t* frontier_indices{nullptr};
+  vertex_t* neighbor_labels{nullptr};
+  weight_t* edge_weights{nullptr};
+
+  __device__ void operator()(edge_t i) const
+  {
+    auto idx = static_cast<vertex_t>(thrust::distance(
+                 frontier_offsets.begin() + 1,
+                 thrust::upper_bound(
+                   thrust::seq, frontier_offsets.begin() + 1, frontier_offsets.end(), i)));
+    vertex_t const* indices{nullptr};
+    thrust::optional<weight_t const*> weights{thrust::nullopt};
+    edge_t local_degree{};
+    thrust::tie(indices, weights, local_degree) = edge_partition.local_edges(frontier[idx]);
+    auto k                                      = i - frontier_offsets[idx];
+    frontier_indices[i]                         = idx;
+    neighbor_labels[i]                          = labels[indices[k]];
+    edge_weights[i]                             = weights ? (*weights)[k] : weight_t{1.0};
+  }
+};
+
+template <typename vertex_t, typename weight_t>
+struct frontier_label_score_t {
+  raft::device_span<vertex_t const> frontier{};
+  vertex_t const* labels{nullptr};
+  vertex_t unlabeled{};
+
+  __device__ label_score_t<vertex_t, weight_t> operator()(
+    thrust::tuple<thrust::tuple<vertex_t, vertex_t>, weight_t> triplet) const
+  {
+    auto idx            = thrust::get<0>(thrust::get<0>(triplet));
+    auto neighbor_label = thrust::get<1>(thrust::get<0>(triplet));
+    return label_score_op_t<vertex_t, weight_t>{unlabeled}(
+      frontier[idx], neighbor_label, thrust::get<1>(triplet), labels[frontier[idx]], vertex_t{});
+  }
+};
+
+// computes the best labels of the frontier vertices by aggregating only the frontier vertices'
+// edges, this is cheaper than aggregating every edge in the graph once the frontier becomes small
+template <typename vertex_t, typename edge_t, typename weight_t, typename LabelScoreOutputIterator>
+void best_frontier_labels(raft::handle_t const& handle,
+                          graph_view_t<vertex_t, edge_t, weight_t, false, false> const& graph_view,
+                          raft::device_span<vertex_t const> frontier,
+                          vertex_t const* labels,
+                          vertex_t unlabeled,
+                          LabelScoreOutputIterator best_label_first)
+{
+  auto edge_partition = edge_partition_device_view_t<vertex_t, edge_t, weight_t, false>(
+    graph_view.local_edge_partition_view());
+
+  rmm::device_uvector<edge_t> frontier_offsets(frontier.size() + 1, handle.get_stream());
+  frontier_offsets.set_element_to_zero_async(0, handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    frontier.begin(),
+                    frontier.end(),
+                    frontier_offsets.begin() + 1,
+                    frontier_degree_t<vertex_t, edge_t, decltype(edge_partition)>{edge_partition});
+  thrust::inclusive_scan(handle.get_thrust_policy(),
+                         frontier_offsets.begin() + 1,
+                         frontier_offsets.end(),
+                         frontier_offsets.begin() + 1);
+  auto num_edges = frontier_offsets.back_element(handle.get_stream());
+
+  rmm::device_uvector<vertex_t> frontier_indices(num_edges, handle.get_stream());
+  rmm::device_uvector<vertex_t> neighbor_labels(num_edges, handle.get_stream());
+  rmm::device_uvector<weight_t> edge_weights(num_edges, handle.get_stream());
+  thrust::for_each(
+    handle.get_thrust_policy(),
+    thrust::make_counting_iterator(edge_t{0}),
+    thrust::make_counting_iterator(num_edges),
+    gather_frontier_edge_t<vertex_t, edge_t, weight_t, decltype(edge_partition)>{
+      edge_partition,
+      frontier,
+      raft::device_span<edge_t const>(frontier_offsets.data(), frontier_offsets.size()),
+      labels,
+      frontier_indices.data(),
+      neighbor_labels.data(),
+      edge_weights.data()});
+
+  // aggregate the edge weights by (frontier vertex, neighbor label)
+
+  auto input_pair_first = thrust::make_zip_iterator(
+    thrust::make_tuple(frontier_indices.begin(), neighbor_labels.begin()));
+  thrust::sort_by_key(handle.get_thrust_policy(),
+                      input_pair_first,
+                      input_pair_first + num_edges,
+                      edge_weights.begin());
+  rmm::device_uvector<vertex_t> pair_frontier_indices(num_edges, handle.get_stream());
+  rmm::device_uvector<vertex_t> pair_neighbor_labels(num_edges, handle.get_stream());
+  rmm::device_uvector<weight_t> pair_weights(num_edges, handle.get_stream());
+  auto pair_first = thrust::make_zip_iterator(
+    thrust::make_tuple(pair_frontier_indices.begin(), pair_neighbor_labels.begin()));
+  auto num_pairs = static_cast<size_t>(thrust::distance(
+    pair_first,
+    thrust::get<0>(thrust::reduce_by_key(handle.get_thrust_policy(),
+                                         input_pair_first,
+                                         input_pair_first + num_edges,
+                                         edge_weights.begin(),
+                                         pair_first,
+                                         pair_weights.begin()))));
+  frontier_indices.resize(0, handle.get_stream());
+  frontier_indices.shrink_to_fit(handle.get_stream());
+  neighbor_labels.resize(0, handle.get_stream());
+  neighbor_labels.shrink_to_fit(handle.get_stream());
+  edge_weights.resize(0, handle.get_stream());
+  edge_weights.shrink_to_fit(handle.get_stream());
+
+  // reduce to the best label of each frontier vertex
+
+  auto scores = allocate_dataframe_buffer<label_score_t<vertex_t, weight_t>>(num_pairs,
+                                                                              handle.get_stream());
+  auto triplet_first =
+    thrust::make_zip_iterator(thrust::make_tuple(pair_first, pair_weights.begin()));
+  thrust::transform(handle.get_thrust_policy(),
+                    triplet_first,
+                    triplet_first + num_pairs,
+                    get_dataframe_buffer_begin(scores),
+                    frontier_label_score_t<vertex_t, weight_t>{frontier, labels, unlabeled});
+  rmm::device_uvector<vertex_t> unique_frontier_indices(num_pairs, handle.get_stream());
+  auto best_scores = allocate_dataframe_buffer<label_score_t<vertex_t, weight_t>>(
+    num_pairs, handle.get_stream());
+  auto num_uniques = static_cast<size_t>(thrust::distance(
+    unique_frontier_indices.begin(),
+    thrust::get<0>(thrust::reduce_by_key(handle.get_thrust_policy(),
+                                         pair_frontier_indices.begin(),
+                                         pair_frontier_indices.begin() + num_pairs,
+                                         get_dataframe_buffer_begin(scores),
+                                         unique_frontier_indices.begin(),
+                                         get_dataframe_buffer_begin(best_scores),
+                                         thrust::equal_to<vertex_t>{},
+                                         best_label_op_t<vertex_t, weight_t>{}))));
+
+  thrust::fill(
+    handle.get_thrust_policy(),
+    best_label_first,
+    best_label_first + frontier.size(),
+    thrust::make_tuple(unlabeled, std::numeric_limits<weight_t>::lowest(), uint8_t{0}));
+  thrust::scatter(handle.get_thrust_policy(),
+                  get_dataframe_buffer_begin(best_scores),
+                  get_dataframe_buffer_begin(best_scores) + num_uniques,
+                  unique_frontier_indices.begin(),
+                  best_label_first);
+}
+
+}  // namespace
+
+namespace detail {
+
+template <typename GraphViewType>
+size_t label_propagation(raft::handle_t const& handle,
+                         GraphViewType const& graph_view,
+                         raft::device_span<typename GraphViewType::vertex_type> labels,
+                         std::optional<raft::device_span<typename GraphViewType::vertex_type const>>
+                           seed_vertices,
+                         std::optional<raft::device_span<typename GraphViewType::vertex_type const>>
+                           seed_labels,
+                         size_t max_iterations,
+                         bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  // if the frontier has fewer than (1 / small_frontier_ratio) of the local vertices, aggregate only
+  // the frontier vertices' edges (single-GPU only, in multi-GPU, a vertex's edges are spread over
+  // the edge partitions of a GPU column)
+  constexpr size_t small_frontier_ratio = 8;
+
+  auto const num_vertices = graph_view.number_of_vertices();
+  auto const v_first      = graph_view.local_vertex_partition_range_first();
+  auto const local_size   = static_cast<size_t>(graph_view.local_vertex_partition_range_size());
+  auto const unlabeled    = num_vertices;  // labels are in [0, num_vertices)
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(
+    graph_view.is_symmetric(),
+    "Invalid input arguments: label_propagation currently supports undirected graphs only.");
+  CUGRAPH_EXPECTS(labels.size() == local_size,
+                  "Invalid input arguments: labels.size() does not coincide with the number of "
+                  "local vertices.");
+  CUGRAPH_EXPECTS(seed_vertices.has_value() == seed_labels.has_value(),
+                  "Invalid input arguments: seed_vertices and seed_labels should be both valid or "
+                  "both std::nullopt.");
+  if (seed_vertices) {
+    CUGRAPH_EXPECTS((*seed_vertices).size() == (*seed_labels).size(),
+                    "Invalid input arguments: (*seed_vertices).size() does not coincide with "
+                    "(*seed_labels).size().");
+  }
+
+  if (do_expensive_check && seed_vertices) {
+    auto num_invalid_vertices =
+      thrust::count_if(handle.get_thrust_policy(),
+                       (*seed_vertices).begin(),
+                       (*seed_vertices).end(),
+                       invalid_or_outside_local_vertex_partition_range_t<vertex_t>{
+                         num_vertices, v_first, graph_view.local_vertex_partition_range_last()});
+    auto num_invalid_labels = thrust::count_if(handle.get_thrust_policy(),
+                                               (*seed_labels).begin(),
+                                               (*seed_labels).end(),
+                                               invalid_label_t<vertex_t>{num_vertices});
+    rmm::device_uvector<vertex_t> sorted_seed_vertices((*seed_vertices).size(),
+                                                       handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 (*seed_vertices).begin(),
+                 (*seed_vertices).end(),
+                 sorted_seed_vertices.begin());
+    thrust::sort(
+      handle.get_thrust_policy(), sorted_seed_vertices.begin(), sorted_seed_vertices.end());
+    auto num_duplicates = static_cast<size_t>(thrust::distance(
+      thrust::unique(
+        handle.get_thrust_policy(), sorted_seed_vertices.begin(), sorted_seed_vertices.end()),
+      sorted_seed_vertices.end()));
+    if constexpr (GraphViewType::is_multi_gpu) {
+      auto& comm           = handle.get_comms();
+      num_invalid_vertices = host_scalar_allreduce(
+        comm, num_invalid_vertices, raft::comms::op_t::SUM, handle.get_stream());
+      num_invalid_labels = host_scalar_allreduce(
+        comm, num_invalid_labels, raft::comms::op_t::SUM, handle.get_stream());
+      num_duplicates =
+        host_scalar_allreduce(comm, num_duplicates, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input arguments: *seed_vertices has invalid vertex IDs (or vertices "
+                    "not in the local vertex partition range).");
+    CUGRAPH_EXPECTS(num_invalid_labels == 0,
+                    "Invalid input arguments: *seed_labels has labels out of [0, "
+                    "graph_view.number_of_vertices()).");
+    CUGRAPH_EXPECTS(num_duplicates == 0,
+                    "Invalid input arguments: *seed_vertices has duplicate vertices.");
+  }
+
+  // 2. initialize labels, every vertex starts with its own label, or the seeds start with the seed
+  // labels and the other vertices start unlabeled
+
+  rmm::device_uvector<uint8_t> is_seed(seed_vertices ? local_size : size_t{0},
+                                       handle.get_stream());
+  if (seed_vertices) {
+    thrust::fill(handle.get_thrust_policy(), labels.begin(), labels.end(), unlabeled);
+    auto offset_first = thrust::make_transform_iterator((*seed_vertices).begin(),
+                                                        local_offset_t<vertex_t>{v_first});
+    thrust::scatter(handle.get_thrust_policy(),
+                    (*seed_labels).begin(),
+                    (*seed_labels).end(),
+                    offset_first,
+                    labels.begin());
+    thrust::fill(handle.get_thrust_policy(), is_seed.begin(), is_seed.end(), uint8_t{0});
+    thrust::scatter(handle.get_thrust_policy(),
+                    thrust::make_constant_iterator(uint8_t{1}),
+                    thrust::make_constant_iterator(uint8_t{1}) + (*seed_vertices).size(),
+                    offset_first,
+                    is_seed.begin());
+  } else {
+    thrust::sequence(handle.get_thrust_policy(), labels.begin(), labels.end(), v_first);
+  }
+  uint8_t const* is_seed_ptr = seed_vertices ? is_seed.data() : nullptr;
+
+  auto src_labels_cache = edge_partition_src_property_t<GraphViewType, vertex_t>(handle);
+  auto dst_labels_cache = edge_partition_dst_property_t<GraphViewType, vertex_t>(handle);
+  if constexpr (GraphViewType::is_multi_gpu) {
+    src_labels_cache = edge_partition_src_property_t<GraphViewType, vertex_t>(handle, graph_view);
+    update_edge_partition_src_property(handle, graph_view, labels.begin(), src_labels_cache);
+    dst_labels_cache = edge_partition_dst_property_t<GraphViewType, vertex_t>(handle, graph_view);
+    update_edge_partition_dst_property(handle, graph_view, labels.begin(), dst_labels_cache);
+  }
+
+  // 3. initialize the frontier (every unfixed vertex with a neighbor)
+
+  constexpr size_t bucket_idx_cur     = 0;
+  constexpr size_t bucket_idx_next    = 1;
+  constexpr size_t bucket_idx_changed = 2;
+  constexpr size_t num_buckets        = 3;
+
+  vertex_frontier_t<vertex_t, void, GraphViewType::is_multi_gpu> vertex_frontier(
+    handle, num_buckets, v_first, graph_view.local_vertex_partition_range_last());
+
+  {
+    auto degrees = graph_view.compute_out_degrees(handle);
+    rmm::device_uvector<vertex_t> initial_frontier(local_size, handle.get_stream());
+    initial_frontier.resize(
+      thrust::distance(initial_frontier.begin(),
+                       thrust::copy_if(handle.get_thrust_policy(),
+                                       thrust::make_counting_iterator(v_first),
+                                       thrust::make_counting_iterator(
+                                         graph_view.local_vertex_partition_range_last()),
+                                       initial_frontier.begin(),
+                                       is_initial_frontier_vertex_t<vertex_t, edge_t>{
+                                         degrees.data(), is_seed_ptr, v_first})),
+      handle.get_stream());
+    vertex_frontier.bucket(bucket_idx_cur).insert(initial_frontier.begin(), initial_frontier.end());
+  }
+
+  // 4. iterate till no vertex changes its label (or till max_iterations)
+
+  auto const init =
+    thrust::make_tuple(unlabeled, std::numeric_limits<weight_t>::lowest(), uint8_t{0});
+
+  size_t iter{0};
+  while (iter < max_iterations) {
+    if (vertex_frontier.bucket(bucket_idx_cur).aggregate_size() == 0) { break; }
+
+    // 4-1. find the most frequent (in aggregated edge weights) neighbor label of every frontier
+    // vertex
+
+    auto& cur_bucket = vertex_frontier.bucket(bucket_idx_cur);
+    rmm::device_uvector<vertex_t> frontier(cur_bucket.size(), handle.get_stream());
+    thrust::copy(
+      handle.get_thrust_policy(), cur_bucket.begin(), cur_bucket.end(), frontier.begin());
+
+    auto best_labels = allocate_dataframe_buffer<label_score_t<vertex_t, weight_t>>(
+      frontier.size(), handle.get_stream());
+    bool small_frontier{false};
+    if constexpr (!GraphViewType::is_multi_gpu) {
+      small_frontier = frontier.size() * small_frontier_ratio < local_size;
+      if (small_frontier) {
+        best_frontier_labels(handle,
+                             graph_view,
+                             raft::device_span<vertex_t const>(frontier.data(), frontier.size()),
+                             labels.data(),
+                             unlabeled,
+                             get_dataframe_buffer_begin(best_labels));
+      }
+    }
+    if (!small_frontier) {
+      rmm::device_uvector<vertex_t> unique_labels(local_size, handle.get_stream());
+      thrust::copy(
+        handle.get_thrust_policy(), labels.begin(), labels.end(), unique_labels.begin());
+      thrust::sort(handle.get_thrust_policy(), unique_labels.begin(), unique_labels.end());
+      unique_labels.resize(
+        thrust::distance(
+          unique_labels.begin(),
+          thrust::unique(handle.get_thrust_policy(), unique_labels.begin(), unique_labels.end())),
+        handle.get_stream());
+      if constexpr (GraphViewType::is_multi_gpu) {
+        unique_labels =
+          cugraph::detail::shuffle_ext_vertices_by_gpu_id(handle, std::move(unique_labels));
+        thrust::sort(handle.get_thrust_policy(), unique_labels.begin(), unique_labels.end());
+        unique_labels.resize(
+          thrust::distance(
+            unique_labels.begin(),
+            thrust::unique(handle.get_thrust_policy(), unique_labels.begin(), unique_labels.end())),
+          handle.get_stream());
+      }
+
+      auto all_best_labels = allocate_dataframe_buffer<label_score_t<vertex_t, weight_t>>(
+        local_size, handle.get_stream());
+      // the (key, value) map values are not used, labels are passed as dummy values
+      per_v_transform_reduce_dst_key_aggregated_outgoing_e(
+        handle,
+        graph_view,
+        GraphViewType::is_multi_gpu
+          ? src_labels_cache.device_view()
+          : detail::edge_partition_major_property_device_view_t<vertex_t, vertex_t const*>(
+              labels.data()),
+        GraphViewType::is_multi_gpu
+          ? dst_labels_cache.device_view()
+          : detail::edge_partition_minor_property_device_view_t<vertex_t, vertex_t const*>(
+              labels.data(), vertex_t{0}),
+        unique_labels.begin(),
+        unique_labels.end(),
+        unique_labels.begin(),
+        invalid_vertex_id<vertex_t>::value,
+        invalid_vertex_id<vertex_t>::value,
+        label_score_op_t<vertex_t, weight_t>{unlabeled},
+        init,
+        best_label_op_t<vertex_t, weight_t>{},
+        get_dataframe_buffer_begin(all_best_labels));
+
+      thrust::gather(handle.get_thrust_policy(),
+                     thrust::make_transform_iterator(frontier.begin(),
+                                                     local_offset_t<vertex_t>{v_first}),
+                     thrust::make_transform_iterator(frontier.end(),
+                                                     local_offset_t<vertex_t>{v_first}),
+                     get_dataframe_buffer_begin(all_best_labels),
+                     get_dataframe_buffer_begin(best_labels));
+    }
+
+    // 4-2. update the labels of the frontier vertices re-evaluating their labels in this iteration
+
+    rmm::device_uvector<vertex_t> new_labels(frontier.size(), handle.get_stream());
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(frontier.begin(), get_dataframe_buffer_begin(best_labels))),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(frontier.end(), get_dataframe_buffer_end(best_labels))),
+      new_labels.begin(),
+      new_label_t<vertex_t, weight_t>{labels.data(), v_first, iter});
+
+    rmm::device_uvector<vertex_t> changed_vertices(frontier.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> changed_labels(frontier.size(), handle.get_stream());
+    {
+      auto input_pair_first =
+        thrust::make_zip_iterator(thrust::make_tuple(frontier.begin(), new_labels.begin()));
+      auto output_pair_first = thrust::make_zip_iterator(
+        thrust::make_tuple(changed_vertices.begin(), changed_labels.begin()));
+      changed_vertices.resize(
+        thrust::distance(output_pair_first,
+                         thrust::copy_if(handle.get_thrust_policy(),
+                                         input_pair_first,
+                                         input_pair_first + frontier.size(),
+                                         output_pair_first,
+                                         is_valid_label_pair_t<vertex_t>{})),
+        handle.get_stream());
+      changed_labels.resize(changed_vertices.size(), handle.get_stream());
+    }
+    new_labels.resize(0, handle.get_stream());
+    new_labels.shrink_to_fit(handle.get_stream());
+
+    thrust::scatter(handle.get_thrust_policy(),
+                    changed_labels.begin(),
+                    changed_labels.end(),
+                    thrust::make_transform_iterator(changed_vertices.begin(),
+                                                    local_offset_t<vertex_t>{v_first}),
+                    labels.begin());
+    if constexpr (GraphViewType::is_multi_gpu) {
+      update_edge_partition_src_property(handle,
+                                         graph_view,
+                                         changed_vertices.begin(),
+                                         changed_vertices.end(),
+                                         labels.begin(),
+                                         src_labels_cache);
+      update_edge_partition_dst_property(handle,
+                                         graph_view,
+                                         changed_vertices.begin(),
+                                         changed_vertices.end(),
+                                         labels.begin(),
+                                         dst_labels_cache);
+    }
+
+    // 4-3. the next frontier is the frontier vertices that did not re-evaluate their labels in
+    // this iteration and the (unfixed) neighbors of the vertices with new labels
+
+    frontier.resize(thrust::distance(frontier.begin(),
+                                     thrust::remove_if(handle.get_thrust_policy(),
+                                                       frontier.begin(),
+                                                       frontier.end(),
+                                                       is_update_iteration_t<vertex_t>{iter})),
+                    handle.get_stream());
+
+    vertex_frontier.bucket(bucket_idx_changed)
+      .insert(changed_vertices.begin(), changed_vertices.end());
+    auto neighbors = transform_reduce_v_frontier_outgoing_e_by_dst(
+      handle,
+      graph_view,
+      vertex_frontier,
+      bucket_idx_changed,
+      dummy_property_t<vertex_t>{}.device_view(),
+      dummy_property_t<vertex_t>{}.device_view(),
+      push_to_neighbor_t<vertex_t>{},
+      reduce_op::null{});
+    neighbors.resize(thrust::distance(neighbors.begin(),
+                                      thrust::remove_if(handle.get_thrust_policy(),
+                                                        neighbors.begin(),
+                                                        neighbors.end(),
+                                                        is_seed_t<vertex_t>{is_seed_ptr, v_first})),
+                     handle.get_stream());
+    thrust::sort(handle.get_thrust_policy(), neighbors.begin(), neighbors.end());
+
+    vertex_frontier.bucket(bucket_idx_next).insert(neighbors.begin(), neighbors.end());
+    vertex_frontier.bucket(bucket_idx_next).insert(frontier.begin(), frontier.end());
+
+    vertex_frontier.bucket(bucket_idx_changed).clear();
+    vertex_frontier.bucket(bucket_idx_changed).shrink_to_fit();
+    vertex_frontier.bucket(bucket_idx_cur).clear();
+    vertex_frontier.bucket(bucket_idx_cur).shrink_to_fit();
+    vertex_frontier.swap_buckets(bucket_idx_cur, bucket_idx_next);
+
+    ++iter;
+  }
+
+  // 5. vertices not reachable from any seed remain unlabeled
+
+  if (seed_vertices) {
+    thrust::replace(handle.get_thrust_policy(),
+                    labels.begin(),
+                    labels.end(),
+                    unlabeled,
+                    invalid_vertex_id<vertex_t>::value);
+  }
+
+  return iter;
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+size_t label_propagation(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  raft::device_span<vertex_t> labels,
+  std::optional<raft::device_span<vertex_t const>> seed_vertices,
+  std::optional<raft::device_span<vertex_t const>> seed_labels,
+  size_t max_iterations,
+  bool do_expensive_check)
+{
+  return detail::label_propagation(
+    handle, graph_view, labels, seed_vertices, seed_labels, max_iterations, do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <community/label_propagation_impl.cuh>
+
+namespace cugraph {
+
+// MG instantiation
+
+template size_t label_propagation(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, true> const& graph_view,
+  raft::device_span<int32_t> labels,
+  std::optional<raft::device_span<int32_t const>> seed_vertices,
+  std::optional<raft::device_span<int32_t const>> seed_labels,
+  size_t max_iterations,
+  bool do_expensive_check);
+
+template size_t label_propagation(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, true> const& graph_view,
+  raft::device_span<int32_t> labels,
+  std::optional<raft::device_span<int32_t const>> seed_vertices,
+  std::optional<raft::device_span<int32_t const>> seed_labels,
+  size_t max_iterations,
+  bool do_expensive_check);
+
+template size_t label_propagation(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, true> const& graph_view,
+  raft::device_span<int32_t> labels,
+  std::optional<raft::device_span<int32_t const>> seed_vertices,
+  std::optional<raft::device_span<int32_t const>> seed_labels,
+  size_t max_iterations,
+  bool do_expensive_check);
+
+template size_t label_propagation(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, true> const& graph_view,
+  raft::device_span<int32_t> labels,
+  std::optional<raft::device_span<int32_t const>> seed_vertices,
+  std::optional<raft::device_span<int32_t const>> seed_labels,
+  size_t max_iterations,
+  bool do_expensive_check);
+
+template size_t label_propagation(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, true> const& graph_view,
+  raft::device_span<int64_t> labels,
+  std::optional<raft::device_span<int64_t const>> seed_vertices,
+  std::optional<raft::device_span<int64_t const>> seed_labels,
+  size_t max_iterations,
+  bool do_expensive_check);
+
+template size_t label_propagation(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, true> const& graph_view,
+  raft::device_span<int64_t> labels,
+  std::optional<raft::device_span<int64_t const>> seed_vertices,
+  std::optional<raft::device_span<int64_t const>> seed_labels,
+  size_t max_iterations,
+  bool do_expensive_check);
+
+}  // namespace cugraph
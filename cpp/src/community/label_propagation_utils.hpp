@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+// shared by the device (label_propagation_impl.cuh) and the host (host_label_propagation_impl.hpp)
+// implementations, so the two produce the same labels (up to the floating point summation order of
+// the edge weights)
+
+#include <raft/cudart_utils.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cugraph {
+namespace detail {
+namespace lpa {
+
+// A frontier vertex re-evaluates its label only in the iterations selected by a hash of (vertex,
+// iteration) (roughly every other iteration). Updating every vertex at once makes adjacent
+// vertices swap labels forever (e.g. a single edge with two different labels); updating a random
+// half per iteration breaks the symmetry while keeping the result deterministic.
+template <typename vertex_t>
+__host__ __device__ inline bool is_update_iteration(vertex_t v, size_t iteration)
+{
+  auto x =
+    static_cast<uint64_t>(v) + static_cast<uint64_t>(iteration) * uint64_t{0x9e3779b97f4a7c15};
+  x = (x ^ (x >> 30)) * uint64_t{0xbf58476d1ce4e5b9};
+  x = (x ^ (x >> 27)) * uint64_t{0x94d049bb133111eb};
+  return ((x ^ (x >> 31)) & uint64_t{1}) == uint64_t{0};
+}
+
+// true if the label l0 (with the aggregated edge weight w0 and the current label flag c0) is
+// preferred over l1: a larger aggregated weight first, then the vertex's current label (a vertex
+// keeps its label on ties, so the iteration converges), then the smaller label
+template <typename vertex_t, typename weight_t>
+__host__ __device__ inline bool is_preferred_label(
+  vertex_t l0, weight_t w0, bool c0, vertex_t l1, weight_t w1, bool c1)
+{
+  if (w0 != w1) { return w0 > w1; }
+  if (c0 != c1) { return c0; }
+  return l0 <= l1;
+}
+
+}  // namespace lpa
+}  // namespace detail
+}  // namespace cugraph
@@ -26,6 +26,7 @@
 #include <cugraph/dendrogram.hpp>
 #include <cugraph/graph.hpp>
 #include <cugraph/graph_functions.hpp>
+#include <cugraph/utilities/memory_tracking.hpp>
 
 #include <raft/handle.hpp>
 #include <rmm/device_uvector.hpp>
@@ -41,6 +42,9 @@
 #include <thrust/transform_reduce.h>
 #include <thrust/tuple.h>
 
+#include <optional>
+#include <string>
+
 //#define TIMING
 
 #ifdef TIMING
@@ -203,6 +207,7 @@ class Louvain {
  protected:
   void timer_start(std::string const& region)
   {
+    memory_phase_.emplace("louvain/" + region);
 #ifdef TIMING
     if (graph_view_t::is_multi_gpu) {
       if (handle.get_comms().get_rank() == 0) hr_timer_.start(region);
@@ -214,6 +219,7 @@ class Louvain {
 
   void timer_stop(rmm::cuda_stream_view stream_view)
   {
+    memory_phase_.reset();
 #ifdef TIMING
     if (graph_view_t::is_multi_gpu) {
       if (handle.get_comms().get_rank() == 0) {
@@ -571,7 +577,7 @@ class Louvain {
 
   void shrink_graph()
   {
-    timer_start("shrinking graph");
+    timer_start("shrinking_graph");
 
     cluster_keys_v_.resize(0, handle_.get_stream());
     cluster_weights_v_.resize(0, handle_.get_stream());
@@ -636,6 +642,8 @@ class Louvain {
   edge_partition_dst_property_t<graph_view_t, vertex_t>
     dst_clusters_cache_;  // dst cache for next_clusters_v_
 
+  std::optional<memory_phase_range_t> memory_phase_{};  // phase of the current timer region
+
 #ifdef TIMING
   HighResTimer hr_timer_;
 #endif
@@ -0,0 +1,802 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <community/triad_census_utils.hpp>
+#include <prims/detail/nbr_intersection.cuh>
+#include <prims/extract_if_e.cuh>
+#include <prims/per_v_transform_reduce_incoming_outgoing_e.cuh>
+#include <prims/property_op_utils.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/detail/decompress_edge_partition.cuh>
+#include <cugraph/detail/shuffle_wrappers.hpp>
+#include <cugraph/edge_partition_device_view.cuh>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/device_functors.cuh>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace cugraph {
+
+namespace {
+
+template <typename vertex_t>
+struct is_self_loop_t {
+  __device__ bool operator()(thrust::tuple<vertex_t, vertex_t> e) const
+  {
+    return thrust::get<0>(e) == thrust::get<1>(e);
+  }
+};
+
+template <typename vertex_t>
+struct edge_to_dyad_t {
+  __device__ thrust::tuple<vertex_t, vertex_t, uint8_t> operator()(
+    thrust::tuple<vertex_t, vertex_t> e) const
+  {
+    auto src = thrust::get<0>(e);
+    auto dst = thrust::get<1>(e);
+    return src < dst ? thrust::make_tuple(src, dst, detail::triad::dyad_forward)
+                     : thrust::make_tuple(dst, src, detail::triad::dyad_backward);
+  }
+};
+
+template <typename vertex_t, typename edge_t>
+struct update_dyad_counts_t {
+  vertex_t const* dyad_firsts{nullptr};
+  vertex_t const* dyad_seconds{nullptr};
+  uint8_t const* dyad_codes{nullptr};
+
+  edge_t* out_counts{nullptr};
+  edge_t* in_counts{nullptr};
+  edge_t* mutual_counts{nullptr};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto u    = dyad_firsts[i];
+    auto v    = dyad_seconds[i];
+    auto code = dyad_codes[i];
+    if (code == detail::triad::dyad_mutual) {
+      atomicAdd(mutual_counts + u, edge_t{1});
+      atomicAdd(mutual_counts + v, edge_t{1});
+    } else if (code == detail::triad::dyad_forward) {
+      atomicAdd(out_counts + u, edge_t{1});
+      atomicAdd(in_counts + v, edge_t{1});
+    } else {
+      atomicAdd(in_counts + u, edge_t{1});
+      atomicAdd(out_counts + v, edge_t{1});
+    }
+  }
+};
+
+using vertex_dyad_sums_t =
+  thrust::tuple<uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t>;
+
+template <typename edge_t>
+struct compute_vertex_dyad_sums_t {
+  __device__ vertex_dyad_sums_t operator()(thrust::tuple<edge_t, edge_t, edge_t> counts) const
+  {
+    uint64_t sums[8];
+    detail::triad::compute_vertex_dyad_sums(static_cast<uint64_t>(thrust::get<0>(counts)),
+                                            static_cast<uint64_t>(thrust::get<1>(counts)),
+                                            static_cast<uint64_t>(thrust::get<2>(counts)),
+                                            sums);
+    return thrust::make_tuple(
+      sums[0], sums[1], sums[2], sums[3], sums[4], sums[5], sums[6], sums[7]);
+  }
+};
+
+using closed_triad_counts_t =
+  thrust::tuple<uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t>;
+
+// Enumerate the closed triads (u, v, w) with u < v < w for the dyad (u, v) by merging
+// out(u) \cap out(v), out(u) \cap in(v), in(u) \cap out(v), and in(u) \cap in(v). A vertex w's
+// memberships in the four intersections fully determine the dyad codes of (u, w) and (v, w).
+template <typename vertex_t>
+struct classify_triangles_t {
+  vertex_t const* dyad_seconds{nullptr};
+  uint8_t const* dyad_codes{nullptr};
+
+  size_t const* out_out_offsets{nullptr};
+  vertex_t const* out_out_indices{nullptr};
+  size_t const* out_in_offsets{nullptr};
+  vertex_t const* out_in_indices{nullptr};
+  size_t const* in_out_offsets{nullptr};
+  vertex_t const* in_out_indices{nullptr};
+  size_t const* in_in_offsets{nullptr};
+  vertex_t const* in_in_indices{nullptr};
+
+  __device__ closed_triad_counts_t operator()(size_t i) const
+  {
+    auto v  = dyad_seconds[i];
+    auto uv = dyad_codes[i];
+
+    vertex_t const* firsts[4] = {out_out_indices + out_out_offsets[i],
+                                 out_in_indices + out_in_offsets[i],
+                                 in_out_indices + in_out_offsets[i],
+                                 in_in_indices + in_in_offsets[i]};
+    vertex_t const* lasts[4]  = {out_out_indices + out_out_offsets[i + 1],
+                                out_in_indices + out_in_offsets[i + 1],
+                                in_out_indices + in_out_offsets[i + 1],
+                                in_in_indices + in_in_offsets[i + 1]};
+
+    uint64_t counts[detail::triad::num_closed_triad_types] = {0, 0, 0, 0, 0, 0, 0};
+
+    // FIXME: this can lead to thread-divergence with a mix of high-degree and low-degree vertices
+    // in a single warp (better optimize if this becomes a performance bottleneck)
+    while (true) {
+      auto w = std::numeric_limits<vertex_t>::max();
+      bool found{false};
+      for (int j = 0; j < 4; ++j) {
+        if ((firsts[j] != lasts[j]) && (*firsts[j] <= w)) {
+          w     = *firsts[j];
+          found = true;
+        }
+      }
+      if (!found) { break; }
+
+      bool in_intersection[4] = {false, false, false, false};
+      for (int j = 0; j < 4; ++j) {
+        if ((firsts[j] != lasts[j]) && (*firsts[j] == w)) {
+          in_intersection[j] = true;
+          ++firsts[j];
+        }
+      }
+
+      if (w > v) {  // count each triangle once (from the dyad with the two smallest vertex IDs)
+        uint8_t uw =
+          ((in_intersection[0] || in_intersection[1]) ? detail::triad::dyad_forward : uint8_t{0}) |
+          ((in_intersection[2] || in_intersection[3]) ? detail::triad::dyad_backward : uint8_t{0});
+        uint8_t vw =
+          ((in_intersection[0] || in_intersection[2]) ? detail::triad::dyad_forward : uint8_t{0}) |
+          ((in_intersection[1] || in_intersection[3]) ? detail::triad::dyad_backward : uint8_t{0});
+        ++counts[detail::triad::classify_closed_triad(uv, uw, vw)];
+      }
+    }
+
+    return thrust::make_tuple(
+      counts[0], counts[1], counts[2], counts[3], counts[4], counts[5], counts[6]);
+  }
+};
+
+// multi-GPU: the dyad graph has an edge (a, b) (and (b, a)) for every dyad {a, b} with the edge
+// weight storing the dyad code relative to (a, b), i.e. bit 0 for a -> b and bit 1 for b -> a.
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct is_dyad_code_t {
+  weight_t code{};
+
+  __device__ edge_t operator()(
+    vertex_t, vertex_t, weight_t w, thrust::nullopt_t, thrust::nullopt_t) const
+  {
+    return w == code ? edge_t{1} : edge_t{0};
+  }
+};
+
+template <typename vertex_t, typename weight_t>
+struct is_upper_dyad_edge_t {
+  __device__ bool operator()(
+    vertex_t src, vertex_t dst, weight_t, thrust::nullopt_t, thrust::nullopt_t) const
+  {
+    return src < dst;
+  }
+};
+
+// expand the i'th element of the intersection output to (u, v, w, dyad code of (u, v))
+template <typename vertex_t, typename weight_t>
+struct intersection_to_triangle_t {
+  size_t const* intersection_offsets{nullptr};
+  vertex_t const* intersection_indices{nullptr};
+  size_t num_pairs{0};
+  vertex_t const* pair_firsts{nullptr};
+  vertex_t const* pair_seconds{nullptr};
+  weight_t const* pair_codes{nullptr};
+
+  __device__ thrust::tuple<vertex_t, vertex_t, vertex_t, weight_t> operator()(size_t i) const
+  {
+    auto pair_idx = static_cast<size_t>(thrust::distance(
+      intersection_offsets + 1,
+      thrust::upper_bound(
+        thrust::seq, intersection_offsets + 1, intersection_offsets + num_pairs + 1, i)));
+    return thrust::make_tuple(
+      pair_firsts[pair_idx], pair_seconds[pair_idx], intersection_indices[i], pair_codes[pair_idx]);
+  }
+};
+
+template <typename vertex_t, typename weight_t>
+struct is_upper_triangle_t {
+  __device__ bool operator()(thrust::tuple<vertex_t, vertex_t, vertex_t, weight_t> t) const
+  {
+    return thrust::get<2>(t) > thrust::get<1>(t);
+  }
+};
+
+template <typename weight_t>
+struct classify_triangle_codes_t {
+  __device__ closed_triad_counts_t operator()(thrust::tuple<weight_t, weight_t, weight_t> t) const
+  {
+    uint64_t counts[detail::triad::num_closed_triad_types] = {0, 0, 0, 0, 0, 0, 0};
+    ++counts[detail::triad::classify_closed_triad(static_cast<uint8_t>(thrust::get<0>(t)),
+                                                  static_cast<uint8_t>(thrust::get<1>(t)),
+                                                  static_cast<uint8_t>(thrust::get<2>(t)))];
+    return thrust::make_tuple(
+      counts[0], counts[1], counts[2], counts[3], counts[4], counts[5], counts[6]);
+  }
+};
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::array<uint64_t, 16> single_gpu_triad_census(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, false> const& graph_view,
+  bool do_expensive_check)
+{
+  // 1. Find dyads (unordered vertex pairs connected by at least one edge, self-loops are ignored)
+
+  rmm::device_uvector<vertex_t> dyad_firsts(size_t{0}, handle.get_stream());
+  rmm::device_uvector<vertex_t> dyad_seconds(size_t{0}, handle.get_stream());
+  rmm::device_uvector<uint8_t> dyad_codes(size_t{0}, handle.get_stream());
+  {
+    auto edge_partition = edge_partition_device_view_t<vertex_t, edge_t, weight_t, false>(
+      graph_view.local_edge_partition_view());
+
+    rmm::device_uvector<vertex_t> srcs(edge_partition.number_of_edges(), handle.get_stream());
+    rmm::device_uvector<vertex_t> dsts(srcs.size(), handle.get_stream());
+    detail::decompress_edge_partition_to_edgelist(
+      handle,
+      edge_partition,
+      srcs.data(),
+      dsts.data(),
+      std::optional<weight_t*>{std::nullopt},
+      graph_view.local_edge_partition_segment_offsets());
+
+    auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), dsts.begin()));
+    auto num_edges  = static_cast<size_t>(
+      thrust::distance(edge_first,
+                       thrust::remove_if(handle.get_thrust_policy(),
+                                         edge_first,
+                                         edge_first + srcs.size(),
+                                         is_self_loop_t<vertex_t>{})));
+
+    rmm::device_uvector<vertex_t> lows(num_edges, handle.get_stream());
+    rmm::device_uvector<vertex_t> highs(num_edges, handle.get_stream());
+    rmm::device_uvector<uint8_t> codes(num_edges, handle.get_stream());
+    thrust::transform(
+      handle.get_thrust_policy(),
+      edge_first,
+      edge_first + num_edges,
+      thrust::make_zip_iterator(thrust::make_tuple(lows.begin(), highs.begin(), codes.begin())),
+      edge_to_dyad_t<vertex_t>{});
+    srcs.resize(size_t{0}, handle.get_stream());
+    dsts.resize(size_t{0}, handle.get_stream());
+    srcs.shrink_to_fit(handle.get_stream());
+    dsts.shrink_to_fit(handle.get_stream());
+
+    auto pair_first = thrust::make_zip_iterator(thrust::make_tuple(lows.begin(), highs.begin()));
+    thrust::sort_by_key(
+      handle.get_thrust_policy(), pair_first, pair_first + num_edges, codes.begin());
+
+    dyad_firsts.resize(num_edges, handle.get_stream());
+    dyad_seconds.resize(num_edges, handle.get_stream());
+    dyad_codes.resize(num_edges, handle.get_stream());
+    auto dyad_pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(dyad_firsts.begin(), dyad_seconds.begin()));
+    auto num_dyads = static_cast<size_t>(thrust::distance(
+      dyad_pair_first,
+      thrust::get<0>(thrust::reduce_by_key(handle.get_thrust_policy(),
+                                           pair_first,
+                                           pair_first + num_edges,
+                                           codes.begin(),
+                                           dyad_pair_first,
+                                           dyad_codes.begin(),
+                                           thrust::equal_to<thrust::tuple<vertex_t, vertex_t>>{},
+                                           thrust::bit_or<uint8_t>{}))));
+    dyad_firsts.resize(num_dyads, handle.get_stream());
+    dyad_seconds.resize(num_dyads, handle.get_stream());
+    dyad_codes.resize(num_dyads, handle.get_stream());
+    dyad_firsts.shrink_to_fit(handle.get_stream());
+    dyad_seconds.shrink_to_fit(handle.get_stream());
+    dyad_codes.shrink_to_fit(handle.get_stream());
+  }
+
+  // 2. Count (out, out), (in, in), (out, in), (mutual, in), (mutual, out), and (mutual, mutual)
+  // neighbor combinations around every vertex
+
+  vertex_dyad_sums_t vertex_dyad_sums{};
+  uint64_t num_asymmetric_dyads{0};
+  {
+    rmm::device_uvector<edge_t> out_counts(graph_view.number_of_vertices(), handle.get_stream());
+    rmm::device_uvector<edge_t> in_counts(out_counts.size(), handle.get_stream());
+    rmm::device_uvector<edge_t> mutual_counts(out_counts.size(), handle.get_stream());
+    thrust::fill(handle.get_thrust_policy(), out_counts.begin(), out_counts.end(), edge_t{0});
+    thrust::fill(handle.get_thrust_policy(), in_counts.begin(), in_counts.end(), edge_t{0});
+    thrust::fill(handle.get_thrust_policy(), mutual_counts.begin(), mutual_counts.end(), edge_t{0});
+
+    thrust::for_each(handle.get_thrust_policy(),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(dyad_firsts.size()),
+                     update_dyad_counts_t<vertex_t, edge_t>{dyad_firsts.data(),
+                                                            dyad_seconds.data(),
+                                                            dyad_codes.data(),
+                                                            out_counts.data(),
+                                                            in_counts.data(),
+                                                            mutual_counts.data()});
+
+    auto count_first = thrust::make_zip_iterator(
+      thrust::make_tuple(out_counts.begin(), in_counts.begin(), mutual_counts.begin()));
+    vertex_dyad_sums = thrust::transform_reduce(
+      handle.get_thrust_policy(),
+      count_first,
+      count_first + out_counts.size(),
+      compute_vertex_dyad_sums_t<edge_t>{},
+      vertex_dyad_sums_t{0, 0, 0, 0, 0, 0, 0, 0},
+      property_op<vertex_dyad_sums_t, thrust::plus>{});
+
+    num_asymmetric_dyads = static_cast<uint64_t>(
+      thrust::count_if(handle.get_thrust_policy(),
+                       dyad_codes.begin(),
+                       dyad_codes.end(),
+                       detail::not_equal_t<uint8_t>{detail::triad::dyad_mutual}));
+  }
+
+  // 3. Enumerate and classify triangles
+
+  closed_triad_counts_t closed_triad_counts{0, 0, 0, 0, 0, 0, 0};
+  {
+    // the three intersection modes involving incoming neighbors share the incoming neighbor lists
+    // (built once here instead of extracting them from the entire edge partition in every call)
+    auto reverse_nbr_lists = detail::build_reverse_nbr_lists(handle, graph_view);
+
+    // FIXME: Peak memory requirement is also dependent on the average minimum degree of the input
+    // vertex pairs. We may need a more sophisticated mechanism to set max_chunk_size considering
+    // vertex degrees. to limit memory footprint ((1 << 15) is a tuning parameter)
+    auto max_chunk_size =
+      static_cast<size_t>(handle.get_device_properties().multiProcessorCount) * (1 << 15);
+
+    for (size_t chunk_first = 0; chunk_first < dyad_firsts.size(); chunk_first += max_chunk_size) {
+      auto this_chunk_size         = std::min(max_chunk_size, dyad_firsts.size() - chunk_first);
+      auto chunk_vertex_pair_first = thrust::make_zip_iterator(thrust::make_tuple(
+        dyad_firsts.begin() + chunk_first, dyad_seconds.begin() + chunk_first));
+
+      // dyads are sorted by construction, detail::nbr_intersection() requires sorted vertex pairs.
+      auto [out_out_offsets, out_out_indices] =
+        detail::nbr_intersection(handle,
+                                 graph_view,
+                                 chunk_vertex_pair_first,
+                                 chunk_vertex_pair_first + this_chunk_size,
+                                 std::array<bool, 2>{true, true},
+                                 do_expensive_check);
+      auto [out_in_offsets, out_in_indices] =
+        detail::nbr_intersection(handle,
+                                 graph_view,
+                                 chunk_vertex_pair_first,
+                                 chunk_vertex_pair_first + this_chunk_size,
+                                 std::array<bool, 2>{true, false},
+                                 do_expensive_check,
+                                 &reverse_nbr_lists);
+      auto [in_out_offsets, in_out_indices] =
+        detail::nbr_intersection(handle,
+                                 graph_view,
+                                 chunk_vertex_pair_first,
+                                 chunk_vertex_pair_first + this_chunk_size,
+                                 std::array<bool, 2>{false, true},
+                                 do_expensive_check,
+                                 &reverse_nbr_lists);
+      auto [in_in_offsets, in_in_indices] =
+        detail::nbr_intersection(handle,
+                                 graph_view,
+                                 chunk_vertex_pair_first,
+                                 chunk_vertex_pair_first + this_chunk_size,
+                                 std::array<bool, 2>{false, false},
+                                 do_expensive_check,
+                                 &reverse_nbr_lists);
+
+      auto chunk_counts = thrust::transform_reduce(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(size_t{0}),
+        thrust::make_counting_iterator(this_chunk_size),
+        classify_triangles_t<vertex_t>{dyad_seconds.data() + chunk_first,
+                                       dyad_codes.data() + chunk_first,
+                                       out_out_offsets.data(),
+                                       out_out_indices.data(),
+                                       out_in_offsets.data(),
+                                       out_in_indices.data(),
+                                       in_out_offsets.data(),
+                                       in_out_indices.data(),
+                                       in_in_offsets.data(),
+                                       in_in_indices.data()},
+        closed_triad_counts_t{0, 0, 0, 0, 0, 0, 0},
+        property_op<closed_triad_counts_t, thrust::plus>{});
+      closed_triad_counts =
+        property_op<closed_triad_counts_t, thrust::plus>{}(closed_triad_counts, chunk_counts);
+    }
+  }
+
+  // 4. Derive the census
+
+  return detail::triad::derive_triad_census(
+    std::array<uint64_t, detail::triad::num_closed_triad_types>{
+      thrust::get<0>(closed_triad_counts),
+      thrust::get<1>(closed_triad_counts),
+      thrust::get<2>(closed_triad_counts),
+      thrust::get<3>(closed_triad_counts),
+      thrust::get<4>(closed_triad_counts),
+      thrust::get<5>(closed_triad_counts),
+      thrust::get<6>(closed_triad_counts)},
+    std::array<uint64_t, 8>{thrust::get<0>(vertex_dyad_sums),
+                            thrust::get<1>(vertex_dyad_sums),
+                            thrust::get<2>(vertex_dyad_sums),
+                            thrust::get<3>(vertex_dyad_sums),
+                            thrust::get<4>(vertex_dyad_sums),
+                            thrust::get<5>(vertex_dyad_sums),
+                            thrust::get<6>(vertex_dyad_sums),
+                            thrust::get<7>(vertex_dyad_sums)},
+    static_cast<uint64_t>(graph_view.number_of_vertices()),
+    static_cast<uint64_t>(dyad_codes.size()),
+    num_asymmetric_dyads);
+}
+
+// Multi-GPU: incoming neighbor intersection is not supported in multi-GPU, so we build the dyad
+// graph (see above) and intersect over its (symmetric) neighbor lists instead. The dyad codes of
+// (u, w) and (v, w) for each common neighbor w are looked up from the dyad graph edge weights.
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::array<uint64_t, 16> multi_gpu_triad_census(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, true> const& graph_view,
+  bool do_expensive_check)
+{
+  auto& comm = handle.get_comms();
+
+  // 1. Build the dyad graph (self-loops are ignored)
+
+  graph_t<vertex_t, edge_t, weight_t, false, true> dyad_graph(handle);
+  {
+    rmm::device_uvector<vertex_t> srcs(size_t{0}, handle.get_stream());
+    rmm::device_uvector<vertex_t> dsts(size_t{0}, handle.get_stream());
+    std::tie(srcs, dsts, std::ignore) =
+      graph_view.decompress_to_edgelist(handle, std::optional<rmm::device_uvector<vertex_t>>{});
+
+    auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), dsts.begin()));
+    auto num_edges  = static_cast<size_t>(
+      thrust::distance(edge_first,
+                       thrust::remove_if(handle.get_thrust_policy(),
+                                         edge_first,
+                                         edge_first + srcs.size(),
+                                         is_self_loop_t<vertex_t>{})));
+
+    rmm::device_uvector<vertex_t> arc_srcs(num_edges * 2, handle.get_stream());
+    rmm::device_uvector<vertex_t> arc_dsts(arc_srcs.size(), handle.get_stream());
+    rmm::device_uvector<weight_t> arc_codes(arc_srcs.size(), handle.get_stream());
+    thrust::copy(
+      handle.get_thrust_policy(), srcs.begin(), srcs.begin() + num_edges, arc_srcs.begin());
+    thrust::copy(handle.get_thrust_policy(),
+                 dsts.begin(),
+                 dsts.begin() + num_edges,
+                 arc_srcs.begin() + num_edges);
+    thrust::copy(
+      handle.get_thrust_policy(), dsts.begin(), dsts.begin() + num_edges, arc_dsts.begin());
+    thrust::copy(handle.get_thrust_policy(),
+                 srcs.begin(),
+                 srcs.begin() + num_edges,
+                 arc_dsts.begin() + num_edges);
+    thrust::fill(handle.get_thrust_policy(),
+                 arc_codes.begin(),
+                 arc_codes.begin() + num_edges,
+                 static_cast<weight_t>(detail::triad::dyad_forward));
+    thrust::fill(handle.get_thrust_policy(),
+                 arc_codes.begin() + num_edges,
+                 arc_codes.end(),
+                 static_cast<weight_t>(detail::triad::dyad_backward));
+    srcs.resize(size_t{0}, handle.get_stream());
+    dsts.resize(size_t{0}, handle.get_stream());
+    srcs.shrink_to_fit(handle.get_stream());
+    dsts.shrink_to_fit(handle.get_stream());
+
+    std::optional<rmm::device_uvector<weight_t>> tmp_codes{std::move(arc_codes)};
+    std::tie(arc_srcs, arc_dsts, tmp_codes) =
+      detail::shuffle_edgelist_by_gpu_id<vertex_t, weight_t>(
+        handle, std::move(arc_srcs), std::move(arc_dsts), std::move(tmp_codes));
+    arc_codes = std::move(*tmp_codes);
+
+    // the arc (a, b) from a -> b and the arc (a, b) from b -> a are shuffled to the same GPU, and
+    // 1 (forward) + 2 (backward) = 3 (mutual) as the input graph is not a multi-graph
+
+    auto arc_first =
+      thrust::make_zip_iterator(thrust::make_tuple(arc_srcs.begin(), arc_dsts.begin()));
+    thrust::sort_by_key(
+      handle.get_thrust_policy(), arc_first, arc_first + arc_srcs.size(), arc_codes.begin());
+
+    rmm::device_uvector<vertex_t> dyad_srcs(arc_srcs.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> dyad_dsts(dyad_srcs.size(), handle.get_stream());
+    rmm::device_uvector<weight_t> dyad_codes(dyad_srcs.size(), handle.get_stream());
+    auto dyad_first =
+      thrust::make_zip_iterator(thrust::make_tuple(dyad_srcs.begin(), dyad_dsts.begin()));
+    auto num_dyad_edges = static_cast<size_t>(thrust::distance(
+      dyad_first,
+      thrust::get<0>(thrust::reduce_by_key(handle.get_thrust_policy(),
+                                           arc_first,
+                                           arc_first + arc_srcs.size(),
+                                           arc_codes.begin(),
+                                           dyad_first,
+                                           dyad_codes.begin()))));
+    arc_srcs.resize(size_t{0}, handle.get_stream());
+    arc_dsts.resize(size_t{0}, handle.get_stream());
+    arc_codes.resize(size_t{0}, handle.get_stream());
+    arc_srcs.shrink_to_fit(handle.get_stream());
+    arc_dsts.shrink_to_fit(handle.get_stream());
+    arc_codes.shrink_to_fit(handle.get_stream());
+    dyad_srcs.resize(num_dyad_edges, handle.get_stream());
+    dyad_dsts.resize(num_dyad_edges, handle.get_stream());
+    dyad_codes.resize(num_dyad_edges, handle.get_stream());
+
+    // the dyad graph is structurally symmetric but the edge weights are not
+    std::tie(dyad_graph, std::ignore) =
+      create_graph_from_edgelist<vertex_t, edge_t, weight_t, false, true>(
+        handle,
+        std::nullopt,
+        std::move(dyad_srcs),
+        std::move(dyad_dsts),
+        std::make_optional(std::move(dyad_codes)),
+        graph_properties_t{false, false},
+        true);
+  }
+  auto dyad_graph_view = dyad_graph.view();
+
+  // 2. Count (out, out), (in, in), (out, in), (mutual, in), (mutual, out), and (mutual, mutual)
+  // neighbor combinations around every vertex
+
+  vertex_dyad_sums_t vertex_dyad_sums{};
+  {
+    rmm::device_uvector<edge_t> out_counts(dyad_graph_view.local_vertex_partition_range_size(),
+                                           handle.get_stream());
+    rmm::device_uvector<edge_t> in_counts(out_counts.size(), handle.get_stream());
+    rmm::device_uvector<edge_t> mutual_counts(out_counts.size(), handle.get_stream());
+    per_v_transform_reduce_outgoing_e(
+      handle,
+      dyad_graph_view,
+      dummy_property_t<vertex_t>{}.device_view(),
+      dummy_property_t<vertex_t>{}.device_view(),
+      is_dyad_code_t<vertex_t, edge_t, weight_t>{
+        static_cast<weight_t>(detail::triad::dyad_forward)},
+      edge_t{0},
+      out_counts.begin());
+    per_v_transform_reduce_outgoing_e(
+      handle,
+      dyad_graph_view,
+      dummy_property_t<vertex_t>{}.device_view(),
+      dummy_property_t<vertex_t>{}.device_view(),
+      is_dyad_code_t<vertex_t, edge_t, weight_t>{
+        static_cast<weight_t>(detail::triad::dyad_backward)},
+      edge_t{0},
+      in_counts.begin());
+    per_v_transform_reduce_outgoing_e(
+      handle,
+      dyad_graph_view,
+      dummy_property_t<vertex_t>{}.device_view(),
+      dummy_property_t<vertex_t>{}.device_view(),
+      is_dyad_code_t<vertex_t, edge_t, weight_t>{
+        static_cast<weight_t>(detail::triad::dyad_mutual)},
+      edge_t{0},
+      mutual_counts.begin());
+
+    auto count_first = thrust::make_zip_iterator(
+      thrust::make_tuple(out_counts.begin(), in_counts.begin(), mutual_counts.begin()));
+    vertex_dyad_sums = host_scalar_allreduce(
+      comm,
+      thrust::transform_reduce(handle.get_thrust_policy(),
+                               count_first,
+                               count_first + out_counts.size(),
+                               compute_vertex_dyad_sums_t<edge_t>{},
+                               vertex_dyad_sums_t{0, 0, 0, 0, 0, 0, 0, 0},
+                               property_op<vertex_dyad_sums_t, thrust::plus>{}),
+      raft::comms::op_t::SUM,
+      handle.get_stream());
+  }
+
+  // 3. Enumerate and classify triangles (from the dyad (u, v) with u < v, each dyad graph edge is
+  // local to exactly one GPU)
+
+  rmm::device_uvector<vertex_t> dyad_firsts(size_t{0}, handle.get_stream());
+  rmm::device_uvector<vertex_t> dyad_seconds(size_t{0}, handle.get_stream());
+  rmm::device_uvector<weight_t> dyad_codes(size_t{0}, handle.get_stream());
+  {
+    std::optional<rmm::device_uvector<weight_t>> tmp_codes{std::nullopt};
+    std::tie(dyad_firsts, dyad_seconds, tmp_codes) =
+      extract_if_e(handle,
+                   dyad_graph_view,
+                   dummy_property_t<vertex_t>{}.device_view(),
+                   dummy_property_t<vertex_t>{}.device_view(),
+                   is_upper_dyad_edge_t<vertex_t, weight_t>{});
+    dyad_codes = std::move(*tmp_codes);
+
+    auto pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(dyad_firsts.begin(), dyad_seconds.begin()));
+    thrust::sort_by_key(
+      handle.get_thrust_policy(), pair_first, pair_first + dyad_firsts.size(), dyad_codes.begin());
+  }
+
+  auto num_dyads            = host_scalar_allreduce(comm,
+                                         static_cast<uint64_t>(dyad_codes.size()),
+                                         raft::comms::op_t::SUM,
+                                         handle.get_stream());
+  auto num_asymmetric_dyads = host_scalar_allreduce(
+    comm,
+    static_cast<uint64_t>(
+      thrust::count_if(handle.get_thrust_policy(),
+                       dyad_codes.begin(),
+                       dyad_codes.end(),
+                       detail::not_equal_t<weight_t>{
+                         static_cast<weight_t>(detail::triad::dyad_mutual)})),
+    raft::comms::op_t::SUM,
+    handle.get_stream());
+
+  closed_triad_counts_t closed_triad_counts{0, 0, 0, 0, 0, 0, 0};
+  {
+    // FIXME: Peak memory requirement is also dependent on the average minimum degree of the input
+    // vertex pairs. We may need a more sophisticated mechanism to set max_chunk_size considering
+    // vertex degrees. to limit memory footprint ((1 << 15) is a tuning parameter)
+    auto max_chunk_size =
+      static_cast<size_t>(handle.get_device_properties().multiProcessorCount) * (1 << 15);
+    auto max_num_chunks =
+      host_scalar_allreduce(comm,
+                            (dyad_firsts.size() + max_chunk_size - 1) / max_chunk_size,
+                            raft::comms::op_t::MAX,
+                            handle.get_stream());
+
+    for (size_t i = 0; i < max_num_chunks; ++i) {
+      auto chunk_first     = std::min(i * max_chunk_size, dyad_firsts.size());
+      auto this_chunk_size = std::min(max_chunk_size, dyad_firsts.size() - chunk_first);
+      auto chunk_vertex_pair_first = thrust::make_zip_iterator(thrust::make_tuple(
+        dyad_firsts.begin() + chunk_first, dyad_seconds.begin() + chunk_first));
+
+      auto [intersection_offsets, intersection_indices] =
+        detail::nbr_intersection(handle,
+                                 dyad_graph_view,
+                                 chunk_vertex_pair_first,
+                                 chunk_vertex_pair_first + this_chunk_size,
+                                 std::array<bool, 2>{true, true},
+                                 do_expensive_check);
+
+      rmm::device_uvector<vertex_t> triangle_us(intersection_indices.size(), handle.get_stream());
+      rmm::device_uvector<vertex_t> triangle_vs(triangle_us.size(), handle.get_stream());
+      rmm::device_uvector<vertex_t> triangle_ws(triangle_us.size(), handle.get_stream());
+      rmm::device_uvector<weight_t> uv_codes(triangle_us.size(), handle.get_stream());
+      auto triangle_first = thrust::make_transform_iterator(
+        thrust::make_counting_iterator(size_t{0}),
+        intersection_to_triangle_t<vertex_t, weight_t>{intersection_offsets.data(),
+                                                       intersection_indices.data(),
+                                                       this_chunk_size,
+                                                       dyad_firsts.data() + chunk_first,
+                                                       dyad_seconds.data() + chunk_first,
+                                                       dyad_codes.data() + chunk_first});
+      auto output_first = thrust::make_zip_iterator(thrust::make_tuple(
+        triangle_us.begin(), triangle_vs.begin(), triangle_ws.begin(), uv_codes.begin()));
+      auto num_triangles = static_cast<size_t>(
+        thrust::distance(output_first,
+                         thrust::copy_if(handle.get_thrust_policy(),
+                                         triangle_first,
+                                         triangle_first + intersection_indices.size(),
+                                         output_first,
+                                         is_upper_triangle_t<vertex_t, weight_t>{})));
+      triangle_us.resize(num_triangles, handle.get_stream());
+      triangle_vs.resize(num_triangles, handle.get_stream());
+      triangle_ws.resize(num_triangles, handle.get_stream());
+      uv_codes.resize(num_triangles, handle.get_stream());
+
+      auto uw_codes = dyad_graph_view.lookup_edge_weights(
+        handle,
+        raft::device_span<vertex_t const>(triangle_us.data(), triangle_us.size()),
+        raft::device_span<vertex_t const>(triangle_ws.data(), triangle_ws.size()),
+        std::optional<rmm::device_uvector<vertex_t>>{});
+      auto vw_codes = dyad_graph_view.lookup_edge_weights(
+        handle,
+        raft::device_span<vertex_t const>(triangle_vs.data(), triangle_vs.size()),
+        raft::device_span<vertex_t const>(triangle_ws.data(), triangle_ws.size()),
+        std::optional<rmm::device_uvector<vertex_t>>{});
+
+      auto code_first = thrust::make_zip_iterator(
+        thrust::make_tuple(uv_codes.begin(), uw_codes.begin(), vw_codes.begin()));
+      closed_triad_counts = property_op<closed_triad_counts_t, thrust::plus>{}(
+        closed_triad_counts,
+        thrust::transform_reduce(handle.get_thrust_policy(),
+                                 code_first,
+                                 code_first + num_triangles,
+                                 classify_triangle_codes_t<weight_t>{},
+                                 closed_triad_counts_t{0, 0, 0, 0, 0, 0, 0},
+                                 property_op<closed_triad_counts_t, thrust::plus>{}));
+    }
+
+    closed_triad_counts = host_scalar_allreduce(
+      comm, closed_triad_counts, raft::comms::op_t::SUM, handle.get_stream());
+  }
+
+  // 4. Derive the census
+
+  return detail::triad::derive_triad_census(
+    std::array<uint64_t, detail::triad::num_closed_triad_types>{
+      thrust::get<0>(closed_triad_counts),
+      thrust::get<1>(closed_triad_counts),
+      thrust::get<2>(closed_triad_counts),
+      thrust::get<3>(closed_triad_counts),
+      thrust::get<4>(closed_triad_counts),
+      thrust::get<5>(closed_triad_counts),
+      thrust::get<6>(closed_triad_counts)},
+    std::array<uint64_t, 8>{thrust::get<0>(vertex_dyad_sums),
+                            thrust::get<1>(vertex_dyad_sums),
+                            thrust::get<2>(vertex_dyad_sums),
+                            thrust::get<3>(vertex_dyad_sums),
+                            thrust::get<4>(vertex_dyad_sums),
+                            thrust::get<5>(vertex_dyad_sums),
+                            thrust::get<6>(vertex_dyad_sums),
+                            thrust::get<7>(vertex_dyad_sums)},
+    static_cast<uint64_t>(graph_view.number_of_vertices()),
+    num_dyads,
+    num_asymmetric_dyads);
+}
+
+}  // namespace
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::array<uint64_t, 16> triad_census(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  bool do_expensive_check)
+{
+  // 1. Check input arguments.
+
+  CUGRAPH_EXPECTS(
+    !graph_view.is_multigraph(),
+    "Invalid input arguments: triad_census currently does not support multi-graphs.");
+
+  if (do_expensive_check) {
+    // currently, nothing to do
+  }
+
+  // 2. Compute the census
+
+  if constexpr (multi_gpu) {
+    return multi_gpu_triad_census(handle, graph_view, do_expensive_check);
+  } else {
+    return single_gpu_triad_census(handle, graph_view, do_expensive_check);
+  }
+}
+
+}  // namespace cugraph
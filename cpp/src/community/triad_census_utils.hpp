@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+// shared by the device (triad_census_impl.cuh) and the host (host_triad_census_impl.hpp)
+// implementations
+
+#include <raft/cudart_utils.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace cugraph {
+namespace detail {
+namespace triad {
+
+// triad type indices in the standard (Holland & Leinhardt) order
+constexpr size_t triad_003{0};
+constexpr size_t triad_012{1};
+constexpr size_t triad_102{2};
+constexpr size_t triad_021D{3};
+constexpr size_t triad_021U{4};
+constexpr size_t triad_021C{5};
+constexpr size_t triad_111D{6};
+constexpr size_t triad_111U{7};
+constexpr size_t triad_030T{8};
+constexpr size_t triad_030C{9};
+constexpr size_t triad_201{10};
+constexpr size_t triad_120D{11};
+constexpr size_t triad_120U{12};
+constexpr size_t triad_120C{13};
+constexpr size_t triad_210{14};
+constexpr size_t triad_300{15};
+
+// a dyad code has bit 0 set if there is an edge from the smaller to the larger vertex and bit 1 set
+// if there is an edge from the larger to the smaller vertex
+constexpr uint8_t dyad_forward{0b01};
+constexpr uint8_t dyad_backward{0b10};
+constexpr uint8_t dyad_mutual{0b11};
+
+// closed triad (all three dyads connected) types, the order of the closed triad counts returned by
+// classify_closed_triad
+constexpr size_t num_closed_triad_types{7};
+constexpr std::array<size_t, num_closed_triad_types> closed_triad_types{
+  triad_030T, triad_030C, triad_120D, triad_120U, triad_120C, triad_210, triad_300};
+
+// For each closed triad type, the number of (center, two neighbors) combinations in the triad with
+// the center's relationship to the two neighbors being (out, out), (in, in), (out, in),
+// (mutual, in), (mutual, out), and (mutual, mutual), respectively. These are the combinations that
+// the open triad types 021D, 021U, 021C, 111D, 111U, and 201 are counted from.
+constexpr std::array<std::array<uint64_t, 6>, num_closed_triad_types> closed_triad_corner_counts{
+  {{1, 1, 1, 0, 0, 0} /* 030T */,
+   {0, 0, 3, 0, 0, 0} /* 030C */,
+   {1, 0, 0, 2, 0, 0} /* 120D */,
+   {0, 1, 0, 0, 2, 0} /* 120U */,
+   {0, 0, 1, 1, 1, 0} /* 120C */,
+   {0, 0, 0, 1, 1, 1} /* 210 */,
+   {0, 0, 0, 0, 0, 3} /* 300 */}};
+constexpr std::array<size_t, 6> open_triad_types{
+  triad_021D, triad_021U, triad_021C, triad_111D, triad_111U, triad_201};
+
+// number of asymmetric dyads in each closed triad type (the remaining dyads are mutual)
+constexpr std::array<uint64_t, num_closed_triad_types> closed_triad_asymmetric_dyad_counts{
+  3, 3, 2, 2, 2, 1, 0};
+
+// (out, out), (in, in), (out, in), (mutual, in), (mutual, out), (mutual, mutual) neighbor
+// combinations around a vertex with o out-only, i in-only, and m mutual neighbors, and the number
+// of (asymmetric dyad, non-neighbor) and (mutual dyad, non-neighbor) combinations to subtract from
+// (dyad, third vertex) combinations
+__host__ __device__ inline void compute_vertex_dyad_sums(uint64_t o,
+                                                         uint64_t i,
+                                                         uint64_t m,
+                                                         uint64_t (&sums)[8])
+{
+  auto d  = o + i + m;
+  sums[0] = o * (o - 1) / 2;
+  sums[1] = i * (i - 1) / 2;
+  sums[2] = o * i;
+  sums[3] = m * i;
+  sums[4] = m * o;
+  sums[5] = m * (m - 1) / 2;
+  sums[6] = d * (o + i);
+  sums[7] = d * m;
+}
+
+// classify a closed triad (u, v, w) given the dyad codes of (u, v), (u, w), and (v, w) (bit 0: edge
+// from the first to the second vertex, bit 1: edge from the second to the first vertex), returns an
+// index to closed_triad_types
+__host__ __device__ inline size_t classify_closed_triad(uint8_t uv, uint8_t uw, uint8_t vw)
+{
+  uint8_t codes[3]    = {uv, uw, vw};
+  int endpoints[3][2] = {{0, 1}, {0, 2}, {1, 2}};
+  int num_mutuals{0};
+  int asymmetric_out_degrees[3] = {0, 0, 0};
+  int asymmetric_in_degrees[3]  = {0, 0, 0};
+  int non_mutual_vertex{-1};
+  for (int i = 0; i < 3; ++i) {
+    if (codes[i] == dyad_mutual) {
+      ++num_mutuals;
+      non_mutual_vertex = 3 - (endpoints[i][0] + endpoints[i][1]);
+    } else {
+      auto src = codes[i] == dyad_forward ? endpoints[i][0] : endpoints[i][1];
+      auto dst = codes[i] == dyad_forward ? endpoints[i][1] : endpoints[i][0];
+      ++asymmetric_out_degrees[src];
+      ++asymmetric_in_degrees[dst];
+    }
+  }
+
+  size_t ret{};
+  if (num_mutuals == 0) {
+    ret = ((asymmetric_out_degrees[0] == 1) && (asymmetric_out_degrees[1] == 1) &&
+           (asymmetric_out_degrees[2] == 1))
+            ? size_t{1} /* 030C */
+            : size_t{0} /* 030T */;
+  } else if (num_mutuals == 1) {
+    ret = (asymmetric_out_degrees[non_mutual_vertex] == 2)
+            ? size_t{2} /* 120D */
+            : ((asymmetric_in_degrees[non_mutual_vertex] == 2) ? size_t{3} /* 120U */
+                                                                : size_t{4} /* 120C */);
+  } else if (num_mutuals == 2) {
+    ret = size_t{5}; /* 210 */
+  } else {
+    ret = size_t{6}; /* 300 */
+  }
+  return ret;
+}
+
+// n choose 3 in modulo 2^64 arithmetic
+inline uint64_t choose_three(uint64_t n)
+{
+  if (n < 3) { return uint64_t{0}; }
+  uint64_t a = n;
+  uint64_t b = n - 1;
+  uint64_t c = n - 2;
+  if (a % 2 == 0) {
+    a /= 2;
+  } else {
+    b /= 2;
+  }
+  if (a % 3 == 0) {
+    a /= 3;
+  } else if (b % 3 == 0) {
+    b /= 3;
+  } else {
+    c /= 3;
+  }
+  return a * b * c;
+}
+
+// Derive the census from the closed triad counts, the per-vertex sums (compute_vertex_dyad_sums
+// summed over every vertex), and the dyad counts (counts are in modulo 2^64 arithmetic, 003 counts
+// can wrap around for graphs with more than a few million vertices)
+inline std::array<uint64_t, 16> derive_triad_census(
+  std::array<uint64_t, num_closed_triad_types> const& closed_triad_counts,
+  std::array<uint64_t, 8> const& vertex_dyad_sums,
+  uint64_t num_vertices,
+  uint64_t num_dyads,
+  uint64_t num_asymmetric_dyads)
+{
+  std::array<uint64_t, 16> census{};
+  census.fill(uint64_t{0});
+
+  for (size_t i = 0; i < num_closed_triad_types; ++i) {
+    census[closed_triad_types[i]] = closed_triad_counts[i];
+  }
+
+  for (size_t i = 0; i < open_triad_types.size(); ++i) {
+    auto count = vertex_dyad_sums[i];
+    for (size_t j = 0; j < num_closed_triad_types; ++j) {
+      count -= closed_triad_counts[j] * closed_triad_corner_counts[j][i];
+    }
+    census[open_triad_types[i]] = count;
+  }
+
+  // a dyad (u, v) forms a 012 or 102 triad with every vertex w not adjacent to u and v, there are
+  // V - deg(u) - deg(v) + (# triangles including (u, v)) such w.
+  auto num_mutual_dyads = num_dyads - num_asymmetric_dyads;
+  census[triad_012]     = num_vertices * num_asymmetric_dyads - vertex_dyad_sums[6];
+  census[triad_102]     = num_vertices * num_mutual_dyads - vertex_dyad_sums[7];
+  for (size_t i = 0; i < num_closed_triad_types; ++i) {
+    census[triad_012] += closed_triad_counts[i] * closed_triad_asymmetric_dyad_counts[i];
+    census[triad_102] += closed_triad_counts[i] * (3 - closed_triad_asymmetric_dyad_counts[i]);
+  }
+
+  census[triad_003] = choose_three(num_vertices);
+  for (size_t i = 0; i < census.size(); ++i) {
+    if (i != triad_003) { census[triad_003] -= census[i]; }
+  }
+
+  return census;
+}
+
+}  // namespace triad
+}  // namespace detail
+}  // namespace cugraph
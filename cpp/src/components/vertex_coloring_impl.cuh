@@ -0,0 +1,940 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <prims/edge_partition_src_dst_property.cuh>
+#include <prims/per_v_transform_reduce_incoming_outgoing_e.cuh>
+#include <prims/reduce_op.cuh>
+#include <prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh>
+#include <prims/update_edge_partition_src_dst_property.cuh>
+#include <prims/vertex_frontier.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/dataframe_buffer.hpp>
+#include <cugraph/utilities/device_comm.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <raft/span.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/distance.h>
+#include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/optional.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <cstdint>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+uint64_t constexpr max_coloring_priority = uint64_t{1} << 63;
+
+// unique priorities in [1, max_coloring_priority] (0 marks colored vertices): a bijective mix of
+// the 63 bit (vertex ID XOR seed) (every step is invertible modulo 2^63) plus one
+template <typename vertex_t>
+__device__ uint64_t coloring_priority(vertex_t v, uint64_t seed)
+{
+  constexpr uint64_t mask = max_coloring_priority - 1;
+  auto x                  = (static_cast<uint64_t>(v) ^ seed) & mask;
+  x                       = ((x ^ (x >> 30)) * uint64_t{0xbf58476d1ce4e5b9}) & mask;
+  x                       = ((x ^ (x >> 27)) * uint64_t{0x94d049bb133111eb}) & mask;
+  return (x ^ (x >> 31)) + uint64_t{1};
+}
+
+// a workaround for cudaErrorInvalidDeviceFunction error when device lambda is used
+template <typename vertex_t>
+struct local_offset_t {
+  vertex_t v_first{};
+
+  __device__ vertex_t operator()(vertex_t v) const { return v - v_first; }
+};
+
+template <typename vertex_t>
+struct is_uncolored_t {
+  __device__ bool operator()(vertex_t color) const
+  {
+    return color == invalid_vertex_id<vertex_t>::value;
+  }
+};
+
+template <typename vertex_t>
+struct is_invalid_color_t {
+  __device__ bool operator()(vertex_t color) const
+  {
+    return (color < vertex_t{0}) || (color == invalid_vertex_id<vertex_t>::value);
+  }
+};
+
+template <typename vertex_t>
+struct is_colored_vertex_t {
+  vertex_t const* colors{nullptr};
+  vertex_t v_first{};
+
+  __device__ bool operator()(vertex_t v) const
+  {
+    return colors[v - v_first] != invalid_vertex_id<vertex_t>::value;
+  }
+};
+
+template <typename vertex_t>
+struct coloring_priority_op_t {
+  uint64_t seed{};
+
+  __device__ uint64_t operator()(vertex_t v) const { return coloring_priority(v, seed); }
+};
+
+// first fit coloring
+
+template <typename vertex_t>
+struct push_to_neighbor_t {
+  __device__ thrust::optional<std::byte> operator()(vertex_t,
+                                                    vertex_t,
+                                                    thrust::nullopt_t,
+                                                    thrust::nullopt_t) const
+  {
+    return thrust::optional<std::byte>{std::byte{0}};
+  }
+};
+
+template <typename vertex_t>
+struct push_to_colored_neighbor_t {
+  __device__ thrust::optional<std::byte> operator()(vertex_t,
+                                                    vertex_t,
+                                                    thrust::nullopt_t,
+                                                    vertex_t dst_color) const
+  {
+    return dst_color != invalid_vertex_id<vertex_t>::value
+             ? thrust::optional<std::byte>{std::byte{0}}
+             : thrust::nullopt;
+  }
+};
+
+template <typename vertex_t>
+struct push_color_to_neighbor_t {
+  __device__ thrust::optional<vertex_t> operator()(thrust::tuple<vertex_t, vertex_t> tagged_src,
+                                                   vertex_t,
+                                                   thrust::nullopt_t,
+                                                   thrust::nullopt_t) const
+  {
+    return thrust::optional<vertex_t>{thrust::get<1>(tagged_src)};
+  }
+};
+
+template <typename vertex_t>
+struct push_color_to_uncolored_neighbor_t {
+  __device__ thrust::optional<vertex_t> operator()(thrust::tuple<vertex_t, vertex_t> tagged_src,
+                                                   vertex_t,
+                                                   thrust::nullopt_t,
+                                                   vertex_t dst_color) const
+  {
+    return dst_color == invalid_vertex_id<vertex_t>::value
+             ? thrust::optional<vertex_t>{thrust::get<1>(tagged_src)}
+             : thrust::nullopt;
+  }
+};
+
+template <typename vertex_t>
+struct push_color_and_priority_to_neighbor_t {
+  uint64_t seed{};
+
+  __device__ thrust::optional<thrust::tuple<vertex_t, uint64_t>> operator()(
+    thrust::tuple<vertex_t, vertex_t> tagged_src, vertex_t, thrust::nullopt_t, thrust::nullopt_t)
+    const
+  {
+    return thrust::optional<thrust::tuple<vertex_t, uint64_t>>{thrust::make_tuple(
+      thrust::get<1>(tagged_src), coloring_priority(thrust::get<0>(tagged_src), seed))};
+  }
+};
+
+template <typename vertex_t>
+struct is_not_in_sorted_list_t {
+  raft::device_span<vertex_t const> sorted_list{};
+
+  __device__ bool operator()(thrust::tuple<vertex_t, vertex_t> pair) const
+  {
+    return !thrust::binary_search(
+      thrust::seq, sorted_list.begin(), sorted_list.end(), thrust::get<0>(pair));
+  }
+};
+
+// the (vertex, forbidden color) pairs are sorted and unique, so the colors of a vertex's pairs
+// start with 0, 1, 2, ..., and the smallest free color is the length of this prefix
+template <typename vertex_t>
+struct is_first_fit_prefix_t {
+  raft::device_span<vertex_t const> vertices{};
+  vertex_t const* colors{nullptr};
+
+  __device__ vertex_t operator()(size_t i) const
+  {
+    auto first = thrust::lower_bound(
+      thrust::seq, vertices.begin(), vertices.begin() + i, vertices[i]);
+    auto rank = static_cast<vertex_t>(i - thrust::distance(vertices.begin(), first));
+    return colors[i] == rank ? vertex_t{1} : vertex_t{0};
+  }
+};
+
+template <typename vertex_t>
+struct initial_tentative_color_t {
+  __device__ vertex_t operator()(vertex_t color) const
+  {
+    return color == invalid_vertex_id<vertex_t>::value ? vertex_t{0}
+                                                       : invalid_vertex_id<vertex_t>::value;
+  }
+};
+
+// priority of an uncolored neighbor (Jones-Plassmann), the tentative colors of the colored vertices
+// are invalid
+template <typename vertex_t>
+struct uncolored_neighbor_priority_t {
+  uint64_t seed{};
+
+  __device__ uint64_t operator()(vertex_t src,
+                                 vertex_t dst,
+                                 thrust::nullopt_t,
+                                 vertex_t dst_tentative_color) const
+  {
+    return ((src != dst) && (dst_tentative_color != invalid_vertex_id<vertex_t>::value))
+             ? coloring_priority(dst, seed)
+             : uint64_t{0};
+  }
+};
+
+// maximum priority of the uncolored vertices in the closed neighborhood of a vertex
+template <typename vertex_t>
+struct closed_neighborhood_priority_t {
+  uint64_t seed{};
+
+  __device__ uint64_t operator()(thrust::tuple<vertex_t, vertex_t, uint64_t> triplet) const
+  {
+    auto v               = thrust::get<0>(triplet);
+    auto tentative_color = thrust::get<1>(triplet);
+    auto priority        = thrust::get<2>(triplet);
+    if (tentative_color == invalid_vertex_id<vertex_t>::value) { return priority; }
+    auto p = coloring_priority(v, seed);
+    return p > priority ? p : priority;
+  }
+};
+
+template <typename vertex_t>
+struct neighbor_priority_t {
+  __device__ uint64_t operator()(vertex_t, vertex_t, thrust::nullopt_t, uint64_t dst_priority) const
+  {
+    return dst_priority;
+  }
+};
+
+// maximum priority of the neighbors with the same tentative color (distance-1 conflicts)
+template <typename vertex_t>
+struct conflicting_neighbor_priority_t {
+  uint64_t seed{};
+
+  __device__ uint64_t operator()(vertex_t src,
+                                 vertex_t dst,
+                                 vertex_t src_tentative_color,
+                                 vertex_t dst_tentative_color) const
+  {
+    return ((src != dst) && (src_tentative_color != invalid_vertex_id<vertex_t>::value) &&
+            (src_tentative_color == dst_tentative_color))
+             ? coloring_priority(dst, seed)
+             : uint64_t{0};
+  }
+};
+
+// maximum priority of the vertices with the same tentative color in the closed neighborhoods of
+// the neighbors (distance-2 conflicts), looked up in the sorted (vertex, tentative color, maximum
+// priority) table of the edge partition's destination vertices
+template <typename vertex_t>
+struct conflicting_two_hop_priority_t {
+  raft::device_span<vertex_t const> table_vertices{};
+  vertex_t const* table_colors{nullptr};
+  uint64_t const* table_priorities{nullptr};
+
+  __device__ uint64_t operator()(vertex_t,
+                                 vertex_t dst,
+                                 vertex_t src_tentative_color,
+                                 thrust::nullopt_t) const
+  {
+    if (src_tentative_color == invalid_vertex_id<vertex_t>::value) { return uint64_t{0}; }
+    auto pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(table_vertices.begin(), table_colors));
+    auto pair_last = pair_first + table_vertices.size();
+    auto it        = thrust::lower_bound(
+      thrust::seq, pair_first, pair_last, thrust::make_tuple(dst, src_tentative_color));
+    auto idx       = thrust::distance(pair_first, it);
+    return ((it != pair_last) && (table_vertices[idx] == dst) &&
+            (table_colors[idx] == src_tentative_color))
+             ? table_priorities[idx]
+             : uint64_t{0};
+  }
+};
+
+// an uncolored vertex keeps its tentative color if no higher priority vertex (within the coloring
+// distance) conflicts with it (has the same tentative color in speculative coloring, or is
+// uncolored in Jones-Plassmann coloring)
+template <typename vertex_t>
+struct resolve_conflict_t {
+  uint64_t seed{};
+
+  __device__ vertex_t
+  operator()(thrust::tuple<vertex_t, vertex_t, vertex_t, uint64_t> quadruplet) const
+  {
+    auto v                    = thrust::get<0>(quadruplet);
+    auto color                = thrust::get<1>(quadruplet);
+    auto tentative_color      = thrust::get<2>(quadruplet);
+    auto conflicting_priority = thrust::get<3>(quadruplet);
+    if (color != invalid_vertex_id<vertex_t>::value) { return color; }
+    return conflicting_priority <= coloring_priority(v, seed) ? tentative_color
+                                                              : invalid_vertex_id<vertex_t>::value;
+  }
+};
+
+}  // namespace
+
+namespace detail {
+
+template <typename GraphViewType>
+size_t count_uncolored_vertices(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  rmm::device_uvector<typename GraphViewType::vertex_type> const& colors)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto num_uncolored = static_cast<size_t>(thrust::count_if(
+    handle.get_thrust_policy(), colors.begin(), colors.end(), is_uncolored_t<vertex_t>{}));
+  if constexpr (GraphViewType::is_multi_gpu) {
+    num_uncolored = host_scalar_allreduce(
+      handle.get_comms(), num_uncolored, raft::comms::op_t::SUM, handle.get_stream());
+  }
+  return num_uncolored;
+}
+
+// In each round, every uncolored vertex tentatively takes the smallest color not used by the
+// colored vertices within the coloring distance (first fit). In speculative coloring, the vertices
+// sharing a tentative color with a higher priority vertex within the coloring distance give up
+// their tentative colors and retry in the next round. In Jones-Plassmann coloring, only the local
+// maxima (the uncolored vertices with the highest priority among the uncolored vertices within the
+// coloring distance) keep their tentative colors; the local maxima are not within the coloring
+// distance of each other, so their first fit colors never conflict.
+template <typename GraphViewType>
+rmm::device_uvector<typename GraphViewType::vertex_type> first_fit_coloring(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  size_t distance,
+  bool speculative,
+  uint64_t seed)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto const v_first    = graph_view.local_vertex_partition_range_first();
+  auto const v_last     = graph_view.local_vertex_partition_range_last();
+  auto const local_size = static_cast<size_t>(graph_view.local_vertex_partition_range_size());
+
+  rmm::device_uvector<vertex_t> colors(local_size, handle.get_stream());
+  thrust::fill(
+    handle.get_thrust_policy(), colors.begin(), colors.end(), invalid_vertex_id<vertex_t>::value);
+  rmm::device_uvector<vertex_t> tentative_colors(local_size, handle.get_stream());
+
+  auto dst_colors_cache           = edge_partition_dst_property_t<GraphViewType, vertex_t>(handle);
+  auto src_tentative_colors_cache = edge_partition_src_property_t<GraphViewType, vertex_t>(handle);
+  auto dst_tentative_colors_cache = edge_partition_dst_property_t<GraphViewType, vertex_t>(handle);
+  auto dst_priorities_cache       = edge_partition_dst_property_t<GraphViewType, uint64_t>(handle);
+  if constexpr (GraphViewType::is_multi_gpu) {
+    dst_colors_cache = edge_partition_dst_property_t<GraphViewType, vertex_t>(handle, graph_view);
+    if (speculative) {
+      src_tentative_colors_cache =
+        edge_partition_src_property_t<GraphViewType, vertex_t>(handle, graph_view);
+    }
+    if ((distance == 1) || !speculative) {
+      dst_tentative_colors_cache =
+        edge_partition_dst_property_t<GraphViewType, vertex_t>(handle, graph_view);
+    }
+    if ((distance == 2) && !speculative) {
+      dst_priorities_cache =
+        edge_partition_dst_property_t<GraphViewType, uint64_t>(handle, graph_view);
+    }
+  }
+  auto dst_colors_view =
+    GraphViewType::is_multi_gpu
+      ? dst_colors_cache.device_view()
+      : detail::edge_partition_minor_property_device_view_t<vertex_t, vertex_t const*>(
+          colors.data(), vertex_t{0});
+
+  constexpr size_t bucket_idx_cur = 0;
+  constexpr size_t num_buckets    = 1;
+
+  vertex_frontier_t<vertex_t, void, GraphViewType::is_multi_gpu> vertex_frontier(
+    handle, num_buckets, v_first, v_last);
+  vertex_frontier_t<vertex_t, vertex_t, GraphViewType::is_multi_gpu> tagged_frontier(handle,
+                                                                                     num_buckets);
+
+  // (sorted & unique) neighbors of the vertices in [first, last) (on the neighbors' owners)
+  auto neighbors = [&](auto first, auto last, bool colored_only) {
+    vertex_frontier.bucket(bucket_idx_cur).insert(first, last);
+    auto ret = colored_only ? transform_reduce_v_frontier_outgoing_e_by_dst(
+                                handle,
+                                graph_view,
+                                vertex_frontier,
+                                bucket_idx_cur,
+                                dummy_property_t<vertex_t>{}.device_view(),
+                                dst_colors_view,
+                                push_to_colored_neighbor_t<vertex_t>{},
+                                reduce_op::null{})
+                            : transform_reduce_v_frontier_outgoing_e_by_dst(
+                                handle,
+                                graph_view,
+                                vertex_frontier,
+                                bucket_idx_cur,
+                                dummy_property_t<vertex_t>{}.device_view(),
+                                dummy_property_t<vertex_t>{}.device_view(),
+                                push_to_neighbor_t<vertex_t>{},
+                                reduce_op::null{});
+    vertex_frontier.bucket(bucket_idx_cur).clear();
+    vertex_frontier.bucket(bucket_idx_cur).shrink_to_fit();
+    return ret;
+  };
+
+  // (vertex, color) pairs of the colored vertices in [first, last)
+  auto colored_vertex_color_pairs = [&](auto first, auto last) {
+    auto num_inputs = static_cast<size_t>(thrust::distance(first, last));
+    rmm::device_uvector<vertex_t> vertices(num_inputs, handle.get_stream());
+    vertices.resize(
+      thrust::distance(vertices.begin(),
+                       thrust::copy_if(handle.get_thrust_policy(),
+                                       first,
+                                       last,
+                                       vertices.begin(),
+                                       is_colored_vertex_t<vertex_t>{colors.data(), v_first})),
+      handle.get_stream());
+    rmm::device_uvector<vertex_t> vertex_colors(vertices.size(), handle.get_stream());
+    thrust::gather(
+      handle.get_thrust_policy(),
+      thrust::make_transform_iterator(vertices.begin(), local_offset_t<vertex_t>{v_first}),
+      thrust::make_transform_iterator(vertices.end(), local_offset_t<vertex_t>{v_first}),
+      colors.begin(),
+      vertex_colors.begin());
+    return std::make_tuple(std::move(vertices), std::move(vertex_colors));
+  };
+
+  while (true) {
+    rmm::device_uvector<vertex_t> uncolored_vertices(local_size, handle.get_stream());
+    uncolored_vertices.resize(
+      thrust::distance(uncolored_vertices.begin(),
+                       thrust::copy_if(handle.get_thrust_policy(),
+                                       thrust::make_counting_iterator(v_first),
+                                       thrust::make_counting_iterator(v_last),
+                                       colors.begin(),
+                                       uncolored_vertices.begin(),
+                                       is_uncolored_t<vertex_t>{})),
+      handle.get_stream());
+    auto num_uncolored = uncolored_vertices.size();
+    if constexpr (GraphViewType::is_multi_gpu) {
+      num_uncolored = host_scalar_allreduce(
+        handle.get_comms(), num_uncolored, raft::comms::op_t::SUM, handle.get_stream());
+      update_edge_partition_dst_property(handle, graph_view, colors.begin(), dst_colors_cache);
+    }
+    if (num_uncolored == 0) { break; }
+
+    // 1. collect the colors in use within the coloring distance from the uncolored vertices,
+    // (colored vertex, color) pairs within distance - 1 are pushed to the uncolored neighbors
+
+    std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> color_pairs{
+      rmm::device_uvector<vertex_t>(0, handle.get_stream()),
+      rmm::device_uvector<vertex_t>(0, handle.get_stream())};
+    if (distance == 1) {
+      auto colored_nbrs =
+        neighbors(uncolored_vertices.begin(), uncolored_vertices.end(), true);
+      color_pairs = colored_vertex_color_pairs(colored_nbrs.begin(), colored_nbrs.end());
+    } else {
+      // (vertex, color) pairs for the colors in the closed neighborhoods of the uncolored vertices'
+      // neighbors
+      auto nbrs = neighbors(uncolored_vertices.begin(), uncolored_vertices.end(), false);
+      auto colored_two_hop_nbrs = neighbors(nbrs.begin(), nbrs.end(), true);
+      auto [two_hop_vertices, two_hop_colors] =
+        colored_vertex_color_pairs(colored_two_hop_nbrs.begin(), colored_two_hop_nbrs.end());
+      colored_two_hop_nbrs.resize(0, handle.get_stream());
+      colored_two_hop_nbrs.shrink_to_fit(handle.get_stream());
+
+      auto two_hop_pair_first = thrust::make_zip_iterator(
+        thrust::make_tuple(two_hop_vertices.begin(), two_hop_colors.begin()));
+      tagged_frontier.bucket(bucket_idx_cur)
+        .insert(two_hop_pair_first, two_hop_pair_first + two_hop_vertices.size());
+      auto [pushed_vertices, pushed_colors] =
+        transform_reduce_v_frontier_outgoing_e_by_dst(handle,
+                                                      graph_view,
+                                                      tagged_frontier,
+                                                      bucket_idx_cur,
+                                                      dummy_property_t<vertex_t>{}.device_view(),
+                                                      dummy_property_t<vertex_t>{}.device_view(),
+                                                      push_color_to_neighbor_t<vertex_t>{},
+                                                      reduce_op::null{});
+      tagged_frontier.bucket(bucket_idx_cur).clear();
+      tagged_frontier.bucket(bucket_idx_cur).shrink_to_fit();
+
+      // only the pairs of the uncolored vertices' neighbors are relevant
+      {
+        auto pair_first = thrust::make_zip_iterator(
+          thrust::make_tuple(pushed_vertices.begin(), pushed_colors.begin()));
+        pushed_vertices.resize(
+          thrust::distance(
+            pair_first,
+            thrust::remove_if(handle.get_thrust_policy(),
+                              pair_first,
+                              pair_first + pushed_vertices.size(),
+                              is_not_in_sorted_list_t<vertex_t>{
+                                raft::device_span<vertex_t const>(nbrs.data(), nbrs.size())})),
+          handle.get_stream());
+        pushed_colors.resize(pushed_vertices.size(), handle.get_stream());
+      }
+
+      auto [own_vertices, own_colors] = colored_vertex_color_pairs(nbrs.begin(), nbrs.end());
+      std::get<0>(color_pairs).resize(pushed_vertices.size() + own_vertices.size(),
+                                      handle.get_stream());
+      std::get<1>(color_pairs).resize(std::get<0>(color_pairs).size(), handle.get_stream());
+      auto pair_first = thrust::make_zip_iterator(
+        thrust::make_tuple(std::get<0>(color_pairs).begin(), std::get<1>(color_pairs).begin()));
+      thrust::copy(handle.get_thrust_policy(),
+                   thrust::make_zip_iterator(
+                     thrust::make_tuple(pushed_vertices.begin(), pushed_colors.begin())),
+                   thrust::make_zip_iterator(
+                     thrust::make_tuple(pushed_vertices.end(), pushed_colors.end())),
+                   pair_first);
+      thrust::copy(
+        handle.get_thrust_policy(),
+        thrust::make_zip_iterator(thrust::make_tuple(own_vertices.begin(), own_colors.begin())),
+        thrust::make_zip_iterator(thrust::make_tuple(own_vertices.end(), own_colors.end())),
+        pair_first + pushed_vertices.size());
+      thrust::sort(
+        handle.get_thrust_policy(), pair_first, pair_first + std::get<0>(color_pairs).size());
+      std::get<0>(color_pairs)
+        .resize(thrust::distance(pair_first,
+                                 thrust::unique(handle.get_thrust_policy(),
+                                                pair_first,
+                                                pair_first + std::get<0>(color_pairs).size())),
+                handle.get_stream());
+      std::get<1>(color_pairs).resize(std::get<0>(color_pairs).size(), handle.get_stream());
+    }
+
+    {
+      auto pair_first = thrust::make_zip_iterator(
+        thrust::make_tuple(std::get<0>(color_pairs).begin(), std::get<1>(color_pairs).begin()));
+      tagged_frontier.bucket(bucket_idx_cur)
+        .insert(pair_first, pair_first + std::get<0>(color_pairs).size());
+    }
+    std::get<0>(color_pairs).resize(0, handle.get_stream());
+    std::get<0>(color_pairs).shrink_to_fit(handle.get_stream());
+    std::get<1>(color_pairs).resize(0, handle.get_stream());
+    std::get<1>(color_pairs).shrink_to_fit(handle.get_stream());
+    auto [forbidden_vertices, forbidden_colors] =
+      transform_reduce_v_frontier_outgoing_e_by_dst(handle,
+                                                    graph_view,
+                                                    tagged_frontier,
+                                                    bucket_idx_cur,
+                                                    dummy_property_t<vertex_t>{}.device_view(),
+                                                    dst_colors_view,
+                                                    push_color_to_uncolored_neighbor_t<vertex_t>{},
+                                                    reduce_op::null{});
+    tagged_frontier.bucket(bucket_idx_cur).clear();
+    tagged_frontier.bucket(bucket_idx_cur).shrink_to_fit();
+
+    // 2. first fit: the smallest color not in use within the coloring distance
+
+    thrust::transform(handle.get_thrust_policy(),
+                      colors.begin(),
+                      colors.end(),
+                      tentative_colors.begin(),
+                      initial_tentative_color_t<vertex_t>{});
+    {
+      rmm::device_uvector<vertex_t> unique_vertices(forbidden_vertices.size(), handle.get_stream());
+      rmm::device_uvector<vertex_t> first_fit_colors(unique_vertices.size(), handle.get_stream());
+      auto prefix_first = thrust::make_transform_iterator(
+        thrust::make_counting_iterator(size_t{0}),
+        is_first_fit_prefix_t<vertex_t>{
+          raft::device_span<vertex_t const>(forbidden_vertices.data(), forbidden_vertices.size()),
+          forbidden_colors.data()});
+      auto last = thrust::reduce_by_key(handle.get_thrust_policy(),
+                                        forbidden_vertices.begin(),
+                                        forbidden_vertices.end(),
+                                        prefix_first,
+                                        unique_vertices.begin(),
+                                        first_fit_colors.begin());
+      unique_vertices.resize(thrust::distance(unique_vertices.begin(), thrust::get<0>(last)),
+                             handle.get_stream());
+      first_fit_colors.resize(unique_vertices.size(), handle.get_stream());
+      thrust::scatter(
+        handle.get_thrust_policy(),
+        first_fit_colors.begin(),
+        first_fit_colors.end(),
+        thrust::make_transform_iterator(unique_vertices.begin(), local_offset_t<vertex_t>{v_first}),
+        tentative_colors.begin());
+    }
+    forbidden_vertices.resize(0, handle.get_stream());
+    forbidden_vertices.shrink_to_fit(handle.get_stream());
+    forbidden_colors.resize(0, handle.get_stream());
+    forbidden_colors.shrink_to_fit(handle.get_stream());
+
+    // 3. detect conflicts, the maximum priority of the other uncolored vertices within the coloring
+    // distance (with the same tentative color in speculative coloring)
+
+    auto dst_tentative_colors_view =
+      GraphViewType::is_multi_gpu
+        ? dst_tentative_colors_cache.device_view()
+        : detail::edge_partition_minor_property_device_view_t<vertex_t, vertex_t const*>(
+            tentative_colors.data(), vertex_t{0});
+    if constexpr (GraphViewType::is_multi_gpu) {
+      if (speculative) {
+        update_edge_partition_src_property(
+          handle, graph_view, tentative_colors.begin(), src_tentative_colors_cache);
+      }
+      if ((distance == 1) || !speculative) {
+        update_edge_partition_dst_property(
+          handle, graph_view, tentative_colors.begin(), dst_tentative_colors_cache);
+      }
+    }
+    auto src_tentative_colors_view =
+      GraphViewType::is_multi_gpu
+        ? src_tentative_colors_cache.device_view()
+        : detail::edge_partition_major_property_device_view_t<vertex_t, vertex_t const*>(
+            tentative_colors.data());
+
+    rmm::device_uvector<uint64_t> conflicting_priorities(local_size, handle.get_stream());
+    if (!speculative) {
+      per_v_transform_reduce_outgoing_e(handle,
+                                        graph_view,
+                                        dummy_property_t<vertex_t>{}.device_view(),
+                                        dst_tentative_colors_view,
+                                        uncolored_neighbor_priority_t<vertex_t>{seed},
+                                        uint64_t{0},
+                                        reduce_op::maximum<uint64_t>{},
+                                        conflicting_priorities.begin());
+      if (distance == 2) {
+        // the maximum over the closed neighborhoods of the neighbors covers every vertex within
+        // distance 2 (including the vertex itself, which does not conflict with itself as
+        // resolve_conflict_t compares with <=)
+        auto triplet_first =
+          thrust::make_zip_iterator(thrust::make_tuple(thrust::make_counting_iterator(v_first),
+                                                       tentative_colors.begin(),
+                                                       conflicting_priorities.begin()));
+        thrust::transform(handle.get_thrust_policy(),
+                          triplet_first,
+                          triplet_first + local_size,
+                          conflicting_priorities.begin(),
+                          closed_neighborhood_priority_t<vertex_t>{seed});
+        if constexpr (GraphViewType::is_multi_gpu) {
+          update_edge_partition_dst_property(
+            handle, graph_view, conflicting_priorities.begin(), dst_priorities_cache);
+        }
+        rmm::device_uvector<uint64_t> two_hop_priorities(local_size, handle.get_stream());
+        per_v_transform_reduce_outgoing_e(
+          handle,
+          graph_view,
+          dummy_property_t<vertex_t>{}.device_view(),
+          GraphViewType::is_multi_gpu
+            ? dst_priorities_cache.device_view()
+            : detail::edge_partition_minor_property_device_view_t<vertex_t, uint64_t const*>(
+                conflicting_priorities.data(), vertex_t{0}),
+          neighbor_priority_t<vertex_t>{},
+          uint64_t{0},
+          reduce_op::maximum<uint64_t>{},
+          two_hop_priorities.begin());
+        conflicting_priorities = std::move(two_hop_priorities);
+      }
+    } else if (distance == 1) {
+      per_v_transform_reduce_outgoing_e(
+        handle,
+        graph_view,
+        src_tentative_colors_view,
+        dst_tentative_colors_view,
+        conflicting_neighbor_priority_t<vertex_t>{seed},
+        uint64_t{0},
+        reduce_op::maximum<uint64_t>{},
+        conflicting_priorities.begin());
+    } else {
+      // (vertex, tentative color, maximum priority) over the closed neighborhood of every vertex
+      // with an uncolored neighbor (or uncolored itself)
+
+      rmm::device_uvector<vertex_t> uncolored_tentative_colors(uncolored_vertices.size(),
+                                                               handle.get_stream());
+      thrust::gather(handle.get_thrust_policy(),
+                     thrust::make_transform_iterator(uncolored_vertices.begin(),
+                                                     local_offset_t<vertex_t>{v_first}),
+                     thrust::make_transform_iterator(uncolored_vertices.end(),
+                                                     local_offset_t<vertex_t>{v_first}),
+                     tentative_colors.begin(),
+                     uncolored_tentative_colors.begin());
+      auto uncolored_pair_first = thrust::make_zip_iterator(
+        thrust::make_tuple(uncolored_vertices.begin(), uncolored_tentative_colors.begin()));
+      tagged_frontier.bucket(bucket_idx_cur)
+        .insert(uncolored_pair_first, uncolored_pair_first + uncolored_vertices.size());
+      auto [pushed_pairs, pushed_priorities] = transform_reduce_v_frontier_outgoing_e_by_dst(
+        handle,
+        graph_view,
+        tagged_frontier,
+        bucket_idx_cur,
+        dummy_property_t<vertex_t>{}.device_view(),
+        dummy_property_t<vertex_t>{}.device_view(),
+        push_color_and_priority_to_neighbor_t<vertex_t>{seed},
+        reduce_op::maximum<uint64_t>{});
+      tagged_frontier.bucket(bucket_idx_cur).clear();
+      tagged_frontier.bucket(bucket_idx_cur).shrink_to_fit();
+
+      auto num_pushed = std::get<0>(pushed_pairs).size();
+      rmm::device_uvector<vertex_t> table_vertices(num_pushed + uncolored_vertices.size(),
+                                                   handle.get_stream());
+      rmm::device_uvector<vertex_t> table_colors(table_vertices.size(), handle.get_stream());
+      rmm::device_uvector<uint64_t> table_priorities(table_vertices.size(), handle.get_stream());
+      auto table_pair_first = thrust::make_zip_iterator(
+        thrust::make_tuple(table_vertices.begin(), table_colors.begin()));
+      thrust::copy(handle.get_thrust_policy(),
+                   get_dataframe_buffer_cbegin(pushed_pairs),
+                   get_dataframe_buffer_cend(pushed_pairs),
+                   table_pair_first);
+      thrust::copy(handle.get_thrust_policy(),
+                   pushed_priorities.begin(),
+                   pushed_priorities.end(),
+                   table_priorities.begin());
+      thrust::copy(handle.get_thrust_policy(),
+                   uncolored_pair_first,
+                   uncolored_pair_first + uncolored_vertices.size(),
+                   table_pair_first + num_pushed);
+      thrust::transform(handle.get_thrust_policy(),
+                        uncolored_vertices.begin(),
+                        uncolored_vertices.end(),
+                        table_priorities.begin() + num_pushed,
+                        coloring_priority_op_t<vertex_t>{seed});
+      thrust::sort_by_key(handle.get_thrust_policy(),
+                          table_pair_first,
+                          table_pair_first + table_vertices.size(),
+                          table_priorities.begin());
+      {
+        rmm::device_uvector<vertex_t> tmp_vertices(table_vertices.size(), handle.get_stream());
+        rmm::device_uvector<vertex_t> tmp_colors(tmp_vertices.size(), handle.get_stream());
+        rmm::device_uvector<uint64_t> tmp_priorities(tmp_vertices.size(), handle.get_stream());
+        auto tmp_pair_first =
+          thrust::make_zip_iterator(thrust::make_tuple(tmp_vertices.begin(), tmp_colors.begin()));
+        auto last = thrust::reduce_by_key(handle.get_thrust_policy(),
+                                          table_pair_first,
+                                          table_pair_first + table_vertices.size(),
+                                          table_priorities.begin(),
+                                          tmp_pair_first,
+                                          tmp_priorities.begin(),
+                                          thrust::equal_to<thrust::tuple<vertex_t, vertex_t>>{},
+                                          thrust::maximum<uint64_t>{});
+        tmp_vertices.resize(thrust::distance(tmp_pair_first, thrust::get<0>(last)),
+                            handle.get_stream());
+        tmp_colors.resize(tmp_vertices.size(), handle.get_stream());
+        tmp_priorities.resize(tmp_vertices.size(), handle.get_stream());
+        table_vertices   = std::move(tmp_vertices);
+        table_colors     = std::move(tmp_colors);
+        table_priorities = std::move(tmp_priorities);
+      }
+
+      if constexpr (GraphViewType::is_multi_gpu) {
+        // the edge partition's destination vertices are the vertices of the row communicator's
+        // vertex partitions (in the rank order), so the gathered tables remain sorted
+        auto& row_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+        auto rx_counts =
+          host_scalar_allgather(row_comm, table_vertices.size(), handle.get_stream());
+        std::vector<size_t> displacements(rx_counts.size());
+        std::exclusive_scan(rx_counts.begin(), rx_counts.end(), displacements.begin(), size_t{0});
+        auto rx_size = displacements.back() + rx_counts.back();
+        rmm::device_uvector<vertex_t> rx_vertices(rx_size, handle.get_stream());
+        rmm::device_uvector<vertex_t> rx_colors(rx_size, handle.get_stream());
+        rmm::device_uvector<uint64_t> rx_priorities(rx_size, handle.get_stream());
+        auto triplet_first = thrust::make_zip_iterator(thrust::make_tuple(
+          table_vertices.begin(), table_colors.begin(), table_priorities.begin()));
+        device_allgatherv(row_comm,
+                          triplet_first,
+                          thrust::make_zip_iterator(thrust::make_tuple(
+                            rx_vertices.begin(), rx_colors.begin(), rx_priorities.begin())),
+                          rx_counts,
+                          displacements,
+                          handle.get_stream());
+        table_vertices   = std::move(rx_vertices);
+        table_colors     = std::move(rx_colors);
+        table_priorities = std::move(rx_priorities);
+      }
+
+      per_v_transform_reduce_outgoing_e(
+        handle,
+        graph_view,
+        src_tentative_colors_view,
+        dummy_property_t<vertex_t>{}.device_view(),
+        conflicting_two_hop_priority_t<vertex_t>{
+          raft::device_span<vertex_t const>(table_vertices.data(), table_vertices.size()),
+          table_colors.data(),
+          table_priorities.data()},
+        uint64_t{0},
+        reduce_op::maximum<uint64_t>{},
+        conflicting_priorities.begin());
+    }
+
+    // 4. the uncolored vertices without a conflict keep their tentative colors (the highest
+    // priority uncolored vertex never has a conflict, so every round colors at least one vertex)
+
+    auto quadruplet_first = thrust::make_zip_iterator(
+      thrust::make_tuple(thrust::make_counting_iterator(v_first),
+                         colors.begin(),
+                         tentative_colors.begin(),
+                         conflicting_priorities.begin()));
+    thrust::transform(handle.get_thrust_policy(),
+                      quadruplet_first,
+                      quadruplet_first + local_size,
+                      colors.begin(),
+                      resolve_conflict_t<vertex_t>{seed});
+  }
+
+  return colors;
+}
+
+template <typename GraphViewType>
+rmm::device_uvector<typename GraphViewType::vertex_type> vertex_coloring(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  size_t distance,
+  coloring_algorithm_t algorithm,
+  uint64_t seed,
+  bool do_expensive_check)
+{
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  CUGRAPH_EXPECTS(
+    graph_view.is_symmetric(),
+    "Invalid input arguments: vertex_coloring currently supports undirected graphs only.");
+  CUGRAPH_EXPECTS((distance == 1) || (distance == 2),
+                  "Invalid input arguments: distance should be 1 or 2.");
+
+  if (do_expensive_check) {
+    // currently, nothing to do
+  }
+
+  return first_fit_coloring(
+    handle, graph_view, distance, algorithm == coloring_algorithm_t::SPECULATIVE, seed);
+}
+
+template <typename GraphViewType>
+std::tuple<rmm::device_uvector<typename GraphViewType::vertex_type>, std::vector<size_t>>
+color_classes(raft::handle_t const& handle,
+              GraphViewType const& graph_view,
+              raft::device_span<typename GraphViewType::vertex_type const> colors,
+              bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto const v_first    = graph_view.local_vertex_partition_range_first();
+  auto const local_size = static_cast<size_t>(graph_view.local_vertex_partition_range_size());
+
+  CUGRAPH_EXPECTS(colors.size() == local_size,
+                  "Invalid input arguments: colors.size() does not coincide with the number of "
+                  "local vertices.");
+
+  if (do_expensive_check) {
+    auto num_invalid_colors = static_cast<size_t>(thrust::count_if(
+      handle.get_thrust_policy(), colors.begin(), colors.end(), is_invalid_color_t<vertex_t>{}));
+    if constexpr (GraphViewType::is_multi_gpu) {
+      num_invalid_colors = host_scalar_allreduce(
+        handle.get_comms(), num_invalid_colors, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalid_colors == 0,
+                    "Invalid input arguments: colors should be non-negative and valid.");
+  }
+
+  // every GPU sees the same number of color classes (some may be locally empty)
+
+  auto num_colors = thrust::reduce(handle.get_thrust_policy(),
+                                   colors.begin(),
+                                   colors.end(),
+                                   vertex_t{-1},
+                                   thrust::maximum<vertex_t>{}) +
+                    vertex_t{1};
+  if constexpr (GraphViewType::is_multi_gpu) {
+    num_colors = host_scalar_allreduce(
+      handle.get_comms(), num_colors, raft::comms::op_t::MAX, handle.get_stream());
+  }
+
+  rmm::device_uvector<vertex_t> sorted_colors(local_size, handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(), colors.begin(), colors.end(), sorted_colors.begin());
+  rmm::device_uvector<vertex_t> vertices(local_size, handle.get_stream());
+  thrust::sequence(handle.get_thrust_policy(), vertices.begin(), vertices.end(), v_first);
+  thrust::stable_sort_by_key(
+    handle.get_thrust_policy(), sorted_colors.begin(), sorted_colors.end(), vertices.begin());
+
+  rmm::device_uvector<size_t> d_offsets(static_cast<size_t>(num_colors) + 1, handle.get_stream());
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      sorted_colors.begin(),
+                      sorted_colors.end(),
+                      thrust::make_counting_iterator(vertex_t{0}),
+                      thrust::make_counting_iterator(num_colors + 1),
+                      d_offsets.begin());
+  std::vector<size_t> h_offsets(d_offsets.size());
+  raft::update_host(h_offsets.data(), d_offsets.data(), d_offsets.size(), handle.get_stream());
+  handle.sync_stream();
+
+  return std::make_tuple(std::move(vertices), std::move(h_offsets));
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+rmm::device_uvector<vertex_t> vertex_coloring(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  size_t distance,
+  coloring_algorithm_t algorithm,
+  uint64_t seed,
+  bool do_expensive_check)
+{
+  return detail::vertex_coloring(
+    handle, graph_view, distance, algorithm, seed, do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, std::vector<size_t>> color_classes(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  raft::device_span<vertex_t const> colors,
+  bool do_expensive_check)
+{
+  return detail::color_classes(handle, graph_view, colors, do_expensive_check);
+}
+
+}  // namespace cugraph
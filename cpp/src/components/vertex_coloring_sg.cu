@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <components/vertex_coloring_impl.cuh>
+
+namespace cugraph {
+
+// SG instantiation
+
+template rmm::device_uvector<int32_t> vertex_coloring(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
+  size_t distance,
+  coloring_algorithm_t algorithm,
+  uint64_t seed,
+  bool do_expensive_check);
+
+template rmm::device_uvector<int32_t> vertex_coloring(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
+  size_t distance,
+  coloring_algorithm_t algorithm,
+  uint64_t seed,
+  bool do_expensive_check);
+
+template rmm::device_uvector<int32_t> vertex_coloring(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
+  size_t distance,
+  coloring_algorithm_t algorithm,
+  uint64_t seed,
+  bool do_expensive_check);
+
+template rmm::device_uvector<int32_t> vertex_coloring(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
+  size_t distance,
+  coloring_algorithm_t algorithm,
+  uint64_t seed,
+  bool do_expensive_check);
+
+template rmm::device_uvector<int64_t> vertex_coloring(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
+  size_t distance,
+  coloring_algorithm_t algorithm,
+  uint64_t seed,
+  bool do_expensive_check);
+
+template rmm::device_uvector<int64_t> vertex_coloring(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
+  size_t distance,
+  coloring_algorithm_t algorithm,
+  uint64_t seed,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>, std::vector<size_t>> color_classes(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
+  raft::device_span<int32_t const> colors,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>, std::vector<size_t>> color_classes(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
+  raft::device_span<int32_t const> colors,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>, std::vector<size_t>> color_classes(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
+  raft::device_span<int32_t const> colors,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>, std::vector<size_t>> color_classes(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
+  raft::device_span<int32_t const> colors,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int64_t>, std::vector<size_t>> color_classes(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
+  raft::device_span<int64_t const> colors,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int64_t>, std::vector<size_t>> color_classes(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
+  raft::device_span<int64_t const> colors,
+  bool do_expensive_check);
+
+}  // namespace cugraph
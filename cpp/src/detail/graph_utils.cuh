@@ -82,6 +82,33 @@ struct compute_gpu_id_from_edge_t {
   }
 };
 
+// compute_gpu_id_from_edge_t for renumbered (internal) vertex IDs, the vertex partition of an
+// internal vertex ID is the hashed GPU ID of the corresponding external vertex ID
+template <typename vertex_t>
+struct compute_gpu_id_from_int_edge_t {
+  raft::device_span<vertex_t const> vertex_partition_range_lasts_span;
+  int comm_size{0};
+  int row_comm_size{0};
+  int col_comm_size{0};
+
+  __device__ int operator()(vertex_t major, vertex_t minor) const
+  {
+    auto major_comm_rank = static_cast<int>(
+      thrust::distance(vertex_partition_range_lasts_span.begin(),
+                       thrust::upper_bound(thrust::seq,
+                                           vertex_partition_range_lasts_span.begin(),
+                                           vertex_partition_range_lasts_span.end(),
+                                           major)));
+    auto minor_comm_rank = static_cast<int>(
+      thrust::distance(vertex_partition_range_lasts_span.begin(),
+                       thrust::upper_bound(thrust::seq,
+                                           vertex_partition_range_lasts_span.begin(),
+                                           vertex_partition_range_lasts_span.end(),
+                                           minor)));
+    return (minor_comm_rank / row_comm_size) * row_comm_size + (major_comm_rank % row_comm_size);
+  }
+};
+
 template <typename vertex_t>
 struct compute_partition_id_from_edge_t {
   int comm_size{0};
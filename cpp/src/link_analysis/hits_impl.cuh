@@ -19,7 +19,7 @@
 #include <prims/edge_partition_src_dst_property.cuh>
 #include <prims/per_v_transform_reduce_incoming_outgoing_e.cuh>
 #include <prims/reduce_v.cuh>
-#include <prims/transform_reduce_v.cuh>
+#include <prims/transform_reduce_v_with_output.cuh>
 #include <prims/update_edge_partition_src_dst_property.cuh>
 
 #include <cugraph/algorithms.hpp>
@@ -135,13 +135,6 @@ std::tuple<result_t, size_t> hits(raft::handle_t const& handle,
       result_t{0},
       curr_hubs);
 
-    // Normalize current hub values
-    detail::normalize(handle,
-                      graph_view,
-                      curr_hubs,
-                      std::numeric_limits<result_t>::lowest(),
-                      reduce_op::maximum<result_t>{});
-
     // Normalize current authority values
     detail::normalize(handle,
                       graph_view,
@@ -149,12 +142,22 @@ std::tuple<result_t, size_t> hits(raft::handle_t const& handle,
                       std::numeric_limits<result_t>::lowest(),
                       reduce_op::maximum<result_t>{});
 
-    // Test for exit condition
-    diff_sum = transform_reduce_v(
+    // Normalize current hub values and test for exit condition in a single pass
+    auto hubs_norm = reduce_v(handle,
+                              graph_view,
+                              curr_hubs,
+                              std::numeric_limits<result_t>::lowest(),
+                              reduce_op::maximum<result_t>{});
+    CUGRAPH_EXPECTS(hubs_norm > 0, "Norm is required to be a positive value.");
+    diff_sum = transform_reduce_v_with_output(
       handle,
       graph_view,
       thrust::make_zip_iterator(thrust::make_tuple(curr_hubs, prev_hubs)),
-      [] __device__(auto, auto val) { return std::abs(thrust::get<0>(val) - thrust::get<1>(val)); },
+      curr_hubs,
+      [hubs_norm] __device__(auto, auto val) {
+        auto const hub = thrust::get<0>(val) / hubs_norm;
+        return thrust::make_tuple(hub, std::abs(hub - thrust::get<1>(val)));
+      },
       result_t{0});
     if (diff_sum < epsilon) {
       final_iteration_count = iter;
@@ -21,33 +21,94 @@
 #include <prims/per_v_transform_reduce_incoming_outgoing_e.cuh>
 #include <prims/reduce_v.cuh>
 #include <prims/transform_reduce_v.cuh>
+#include <prims/transform_reduce_v_with_output.cuh>
 #include <prims/update_edge_partition_src_dst_property.cuh>
 
 #include <cugraph/algorithms.hpp>
 #include <cugraph/graph_view.hpp>
+#include <cugraph/propagation_blocking.hpp>
 #include <cugraph/utilities/error.hpp>
 
+#include <raft/device_atomics.cuh>
 #include <raft/handle.hpp>
 #include <rmm/exec_policy.hpp>
 
-#include <thrust/copy.h>
 #include <thrust/count.h>
 #include <thrust/fill.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/reduce.h>
+#include <thrust/scatter.h>
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 
 namespace cugraph {
 namespace detail {
 
+int32_t constexpr pagerank_accumulate_block_size = 512;
+
+// binning phase of propagation blocking, the contribution of the i-th edge (in source order)
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+struct blocked_edge_contribution_t {
+  vertex_t const* srcs{nullptr};
+  weight_t const* weights{nullptr};  // nullptr if unweighted
+  result_t const* src_values{nullptr};
+  result_t alpha{};
+
+  __device__ result_t operator()(edge_t i) const
+  {
+    auto w = weights != nullptr ? static_cast<result_t>(weights[i]) : result_t{1.0};
+    return src_values[srcs[i]] * w * alpha;
+  }
+};
+
+// accumulation phase of propagation blocking, a thread block reduces a bin into the destination
+// values of its block held in shared memory and writes them out once
+template <typename vertex_t, typename edge_t, typename result_t>
+__global__ void accumulate_propagation_blocks(edge_t const* block_offsets,
+                                              vertex_t const* bin_dsts,
+                                              result_t const* bin_values,
+                                              vertex_t block_size,
+                                              vertex_t num_vertices,
+                                              result_t init,
+                                              result_t* outputs)
+{
+  extern __shared__ char shared_memory[];
+  auto accumulators = reinterpret_cast<result_t*>(shared_memory);
+
+  auto const block       = static_cast<vertex_t>(blockIdx.x);
+  auto const block_first = block * block_size;
+  auto const block_range_size =
+    (num_vertices - block_first) < block_size ? (num_vertices - block_first) : block_size;
+
+  for (auto i = static_cast<vertex_t>(threadIdx.x); i < block_range_size; i += blockDim.x) {
+    accumulators[i] = result_t{0.0};
+  }
+  __syncthreads();
+
+  for (auto i = block_offsets[block] + static_cast<edge_t>(threadIdx.x);
+       i < block_offsets[block + 1];
+       i += blockDim.x) {
+    atomicAdd(accumulators + (bin_dsts[i] - block_first), bin_values[i]);
+  }
+  __syncthreads();
+
+  for (auto i = static_cast<vertex_t>(threadIdx.x); i < block_range_size; i += blockDim.x) {
+    outputs[block_first + i] = init + accumulators[i];
+  }
+}
+
 // FIXME: personalization_vector_size is confusing in OPG (local or aggregate?)
 template <typename GraphViewType, typename result_t>
 void pagerank(
   raft::handle_t const& handle,
   GraphViewType const& pull_graph_view,
+  std::optional<propagation_blocking_t<typename GraphViewType::vertex_type,
+                                      typename GraphViewType::edge_type,
+                                      typename GraphViewType::weight_type> const*> blocking,
   std::optional<typename GraphViewType::weight_type const*> precomputed_vertex_out_weight_sums,
   std::optional<typename GraphViewType::vertex_type const*> personalization_vertices,
   std::optional<result_t const*> personalization_values,
@@ -60,6 +121,7 @@ void pagerank(
   bool do_expensive_check)
 {
   using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
   using weight_t = typename GraphViewType::weight_type;
 
   static_assert(std::is_integral<vertex_t>::value,
@@ -91,6 +153,19 @@ void pagerank(
   CUGRAPH_EXPECTS((alpha >= 0.0) && (alpha <= 1.0),
                   "Invalid input argument: alpha should be in [0.0, 1.0].");
   CUGRAPH_EXPECTS(epsilon >= 0.0, "Invalid input argument: epsilon should be non-negative.");
+  CUGRAPH_EXPECTS(
+    !blocking ||
+      (!GraphViewType::is_multi_gpu &&
+       ((*blocking)->srcs.size() == static_cast<size_t>(pull_graph_view.number_of_edges())) &&
+       ((*blocking)->block_size > vertex_t{0}) &&
+       ((*blocking)->block_offsets.size() ==
+        static_cast<size_t>((num_vertices - 1) / (*blocking)->block_size + 2))),
+    "Invalid input argument: blocking should be built from the input graph (single-GPU only).");
+  CUGRAPH_EXPECTS(
+    !blocking || (static_cast<size_t>((*blocking)->block_size) * sizeof(result_t) <=
+                  static_cast<size_t>(handle.get_device_properties().sharedMemPerBlock)),
+    "Invalid input argument: the PageRank values of a block should fit in the shared memory of a "
+    "thread block, use a smaller block size.");
 
   if (do_expensive_check) {
     if (precomputed_vertex_out_weight_sums) {
@@ -204,59 +279,85 @@ void pagerank(
   // old PageRank values
   rmm::device_uvector<result_t> old_pageranks(pull_graph_view.local_vertex_partition_range_size(),
                                               handle.get_stream());
-  edge_partition_src_property_t<GraphViewType, result_t> edge_partition_src_pageranks(
-    handle, pull_graph_view);
+  // PageRank values scaled by the out-weight sums, read by the edge pass
+  auto edge_partition_src_pageranks =
+    blocking ? edge_partition_src_property_t<GraphViewType, result_t>(handle)
+             : edge_partition_src_property_t<GraphViewType, result_t>(handle, pull_graph_view);
+  rmm::device_uvector<result_t> blocked_src_pageranks(
+    blocking ? pull_graph_view.local_vertex_partition_range_size() : vertex_t{0},
+    handle.get_stream());
+  // edge contributions binned by destination block
+  rmm::device_uvector<result_t> bin_values(blocking ? (*blocking)->srcs.size() : size_t{0},
+                                           handle.get_stream());
   size_t iter{0};
   while (true) {
-    thrust::copy(handle.get_thrust_policy(),
-                 pageranks,
-                 pageranks + pull_graph_view.local_vertex_partition_range_size(),
-                 old_pageranks.data());
-
-    auto vertex_val_first =
-      thrust::make_zip_iterator(thrust::make_tuple(pageranks, vertex_out_weight_sums));
-
-    auto dangling_sum = transform_reduce_v(
+    // save the old PageRank values, compute the dangling sum, and scale the PageRank values by the
+    // out-weight sums in a single pass
+    auto dangling_sum = transform_reduce_v_with_output(
       handle,
       pull_graph_view,
-      vertex_val_first,
+      thrust::make_zip_iterator(thrust::make_tuple(pageranks, vertex_out_weight_sums)),
+      thrust::make_zip_iterator(thrust::make_tuple(
+        old_pageranks.data(), blocking ? blocked_src_pageranks.data() : pageranks)),
       [] __device__(auto, auto val) {
         auto const pagerank       = thrust::get<0>(val);
         auto const out_weight_sum = thrust::get<1>(val);
-        return out_weight_sum == result_t{0.0} ? pagerank : result_t{0.0};
+        auto const divisor = out_weight_sum == result_t{0.0} ? result_t{1.0} : out_weight_sum;
+        return thrust::make_tuple(
+          thrust::make_tuple(pagerank, static_cast<result_t>(pagerank / divisor)),
+          out_weight_sum == result_t{0.0} ? pagerank : result_t{0.0});
       },
       result_t{0.0});
 
-    thrust::transform(handle.get_thrust_policy(),
-                      vertex_val_first,
-                      vertex_val_first + pull_graph_view.local_vertex_partition_range_size(),
-                      pageranks,
-                      [] __device__(auto val) {
-                        auto const pagerank       = thrust::get<0>(val);
-                        auto const out_weight_sum = thrust::get<1>(val);
-                        auto const divisor =
-                          out_weight_sum == result_t{0.0} ? result_t{1.0} : out_weight_sum;
-                        return pagerank / divisor;
-                      });
-
-    update_edge_partition_src_property(
-      handle, pull_graph_view, pageranks, edge_partition_src_pageranks);
-
     auto unvarying_part = aggregate_personalization_vector_size == 0
                             ? (dangling_sum * alpha + static_cast<result_t>(1.0 - alpha)) /
                                 static_cast<result_t>(num_vertices)
                             : result_t{0.0};
 
-    per_v_transform_reduce_incoming_e(
-      handle,
-      pull_graph_view,
-      edge_partition_src_pageranks.device_view(),
-      dummy_property_t<vertex_t>{}.device_view(),
-      [alpha] __device__(vertex_t, vertex_t, weight_t w, auto src_val, auto) {
-        return src_val * w * alpha;
-      },
-      unvarying_part,
-      pageranks);
+    if (blocking) {
+      // propagation blocking: the binning phase walks the edges in source order and writes the
+      // contributions to the bins of the destination blocks, the accumulation phase reduces each
+      // bin in shared memory (no global atomics)
+      auto contribution_first = thrust::make_transform_iterator(
+        thrust::make_counting_iterator(edge_t{0}),
+        blocked_edge_contribution_t<vertex_t, edge_t, weight_t, result_t>{
+          (*blocking)->srcs.data(),
+          (*blocking)->weights ? (*(*blocking)->weights).data() : nullptr,
+          blocked_src_pageranks.data(),
+          alpha});
+      thrust::scatter(handle.get_thrust_policy(),
+                      contribution_first,
+                      contribution_first + (*blocking)->srcs.size(),
+                      (*blocking)->bin_positions.begin(),
+                      bin_values.begin());
+
+      auto num_blocks = static_cast<unsigned int>((*blocking)->block_offsets.size() - 1);
+      accumulate_propagation_blocks<<<num_blocks,
+                                      pagerank_accumulate_block_size,
+                                      static_cast<size_t>((*blocking)->block_size) *
+                                        sizeof(result_t),
+                                      handle.get_stream()>>>((*blocking)->block_offsets.data(),
+                                                             (*blocking)->bin_dsts.data(),
+                                                             bin_values.data(),
+                                                             (*blocking)->block_size,
+                                                             num_vertices,
+                                                             unvarying_part,
+                                                             pageranks);
+    } else {
+      update_edge_partition_src_property(
+        handle, pull_graph_view, pageranks, edge_partition_src_pageranks);
+
+      per_v_transform_reduce_incoming_e(
+        handle,
+        pull_graph_view,
+        edge_partition_src_pageranks.device_view(),
+        dummy_property_t<vertex_t>{}.device_view(),
+        [alpha] __device__(vertex_t, vertex_t, weight_t w, auto src_val, auto) {
+          return src_val * w * alpha;
+        },
+        unvarying_part,
+        pageranks);
+    }
 
     if (aggregate_personalization_vector_size > 0) {
       auto vertex_partition = vertex_partition_device_view_t<vertex_t, GraphViewType::is_multi_gpu>(
@@ -312,6 +413,37 @@ void pagerank(raft::handle_t const& handle,
 {
   detail::pagerank(handle,
                    graph_view,
+                   std::nullopt,
+                   precomputed_vertex_out_weight_sums,
+                   personalization_vertices,
+                   personalization_values,
+                   personalization_vector_size,
+                   pageranks,
+                   alpha,
+                   epsilon,
+                   max_iterations,
+                   has_initial_guess,
+                   do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+void pagerank(raft::handle_t const& handle,
+              graph_view_t<vertex_t, edge_t, weight_t, true, false> const& graph_view,
+              propagation_blocking_t<vertex_t, edge_t, weight_t> const& blocking,
+              std::optional<weight_t const*> precomputed_vertex_out_weight_sums,
+              std::optional<vertex_t const*> personalization_vertices,
+              std::optional<result_t const*> personalization_values,
+              std::optional<vertex_t> personalization_vector_size,
+              result_t* pageranks,
+              result_t alpha,
+              result_t epsilon,
+              size_t max_iterations,
+              bool has_initial_guess,
+              bool do_expensive_check)
+{
+  detail::pagerank(handle,
+                   graph_view,
+                   std::make_optional(&blocking),
                    precomputed_vertex_out_weight_sums,
                    personalization_vertices,
                    personalization_values,
@@ -96,4 +96,89 @@ template void pagerank(raft::handle_t const& handle,
                        bool has_initial_guess,
                        bool do_expensive_check);
 
+// SG instantiation (propagation blocking)
+template void pagerank(raft::handle_t const& handle,
+                       graph_view_t<int32_t, int32_t, float, true, false> const& graph_view,
+                       propagation_blocking_t<int32_t, int32_t, float> const& blocking,
+                       std::optional<float const*> precomputed_vertex_out_weight_sums,
+                       std::optional<int32_t const*> personalization_vertices,
+                       std::optional<float const*> personalization_values,
+                       std::optional<int32_t> personalization_vector_size,
+                       float* pageranks,
+                       float alpha,
+                       float epsilon,
+                       size_t max_iterations,
+                       bool has_initial_guess,
+                       bool do_expensive_check);
+
+template void pagerank(raft::handle_t const& handle,
+                       graph_view_t<int32_t, int32_t, double, true, false> const& graph_view,
+                       propagation_blocking_t<int32_t, int32_t, double> const& blocking,
+                       std::optional<double const*> precomputed_vertex_out_weight_sums,
+                       std::optional<int32_t const*> personalization_vertices,
+                       std::optional<double const*> personalization_values,
+                       std::optional<int32_t> personalization_vector_size,
+                       double* pageranks,
+                       double alpha,
+                       double epsilon,
+                       size_t max_iterations,
+                       bool has_initial_guess,
+                       bool do_expensive_check);
+
+template void pagerank(raft::handle_t const& handle,
+                       graph_view_t<int32_t, int64_t, float, true, false> const& graph_view,
+                       propagation_blocking_t<int32_t, int64_t, float> const& blocking,
+                       std::optional<float const*> precomputed_vertex_out_weight_sums,
+                       std::optional<int32_t const*> personalization_vertices,
+                       std::optional<float const*> personalization_values,
+                       std::optional<int32_t> personalization_vector_size,
+                       float* pageranks,
+                       float alpha,
+                       float epsilon,
+                       size_t max_iterations,
+                       bool has_initial_guess,
+                       bool do_expensive_check);
+
+template void pagerank(raft::handle_t const& handle,
+                       graph_view_t<int32_t, int64_t, double, true, false> const& graph_view,
+                       propagation_blocking_t<int32_t, int64_t, double> const& blocking,
+                       std::optional<double const*> precomputed_vertex_out_weight_sums,
+                       std::optional<int32_t const*> personalization_vertices,
+                       std::optional<double const*> personalization_values,
+                       std::optional<int32_t> personalization_vector_size,
+                       double* pageranks,
+                       double alpha,
+                       double epsilon,
+                       size_t max_iterations,
+                       bool has_initial_guess,
+                       bool do_expensive_check);
+
+template void pagerank(raft::handle_t const& handle,
+                       graph_view_t<int64_t, int64_t, float, true, false> const& graph_view,
+                       propagation_blocking_t<int64_t, int64_t, float> const& blocking,
+                       std::optional<float const*> precomputed_vertex_out_weight_sums,
+                       std::optional<int64_t const*> personalization_vertices,
+                       std::optional<float const*> personalization_values,
+                       std::optional<int64_t> personalization_vector_size,
+                       float* pageranks,
+                       float alpha,
+                       float epsilon,
+                       size_t max_iterations,
+                       bool has_initial_guess,
+                       bool do_expensive_check);
+
+template void pagerank(raft::handle_t const& handle,
+                       graph_view_t<int64_t, int64_t, double, true, false> const& graph_view,
+                       propagation_blocking_t<int64_t, int64_t, double> const& blocking,
+                       std::optional<double const*> precomputed_vertex_out_weight_sums,
+                       std::optional<int64_t const*> personalization_vertices,
+                       std::optional<double const*> personalization_values,
+                       std::optional<int64_t> personalization_vector_size,
+                       double* pageranks,
+                       double alpha,
+                       double epsilon,
+                       size_t max_iterations,
+                       bool has_initial_guess,
+                       bool do_expensive_check);
+
 }  // namespace cugraph
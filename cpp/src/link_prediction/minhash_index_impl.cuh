@@ -0,0 +1,446 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <prims/edge_partition_src_dst_property.cuh>
+#include <prims/per_v_transform_reduce_incoming_outgoing_e.cuh>
+#include <utilities/hyperloglog.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/minhash_index.hpp>
+#include <cugraph/utilities/dataframe_buffer.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/handle.hpp>
+#include <raft/span.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/distance.h>
+#include <thrust/extrema.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <tuple>
+
+namespace cugraph {
+
+namespace detail {
+
+// signature values are computed in slabs of four hash functions (one pass over the edges per slab),
+// as the graph primitives take arithmetic types or thrust tuples of arithmetic types for vertex
+// properties
+using minhash_slab_t = thrust::tuple<uint32_t, uint32_t, uint32_t, uint32_t>;
+
+constexpr size_t minhash_slab_size{thrust::tuple_size<minhash_slab_t>::value};
+
+// hash value of vertex v under the i'th hash function, never 0
+__host__ __device__ inline uint32_t minhash_value(uint64_t v, size_t i, uint64_t seed)
+{
+  auto h = static_cast<uint32_t>(hll::hash(v, hll::hash(static_cast<uint64_t>(i), seed)) >> 32);
+  return h != 0 ? h : uint32_t{1};
+}
+
+// signatures keep the maximum (instead of the minimum) hash value over the neighbors, so the
+// all-zero slab (the signature of an empty neighborhood) is the identity element of the reduction
+struct minhash_slab_max_t {
+  using value_type                    = minhash_slab_t;
+  static constexpr bool pure_function = true;  // this can be called in any process
+
+  __host__ __device__ minhash_slab_t operator()(minhash_slab_t const& lhs,
+                                                minhash_slab_t const& rhs) const
+  {
+    return thrust::make_tuple(thrust::max(thrust::get<0>(lhs), thrust::get<0>(rhs)),
+                              thrust::max(thrust::get<1>(lhs), thrust::get<1>(rhs)),
+                              thrust::max(thrust::get<2>(lhs), thrust::get<2>(rhs)),
+                              thrust::max(thrust::get<3>(lhs), thrust::get<3>(rhs)));
+  }
+};
+
+template <typename vertex_t, typename weight_t>
+struct hash_neighbor_t {
+  size_t hash_first{};
+  uint64_t seed{};
+
+  template <typename SrcValue, typename DstValue>
+  __device__ minhash_slab_t operator()(vertex_t, vertex_t dst, weight_t, SrcValue, DstValue) const
+  {
+    auto v = static_cast<uint64_t>(dst);
+    return thrust::make_tuple(minhash_value(v, hash_first, seed),
+                              minhash_value(v, hash_first + 1, seed),
+                              minhash_value(v, hash_first + 2, seed),
+                              minhash_value(v, hash_first + 3, seed));
+  }
+};
+
+template <typename vertex_t>
+struct scatter_slab_t {
+  uint32_t* signatures{nullptr};
+  size_t num_hashes{};
+  size_t hash_first{};
+
+  template <typename VertexAndSlab>
+  __device__ void operator()(VertexAndSlab v_and_slab) const
+  {
+    auto v                    = thrust::get<0>(v_and_slab);
+    minhash_slab_t slab       = thrust::get<1>(v_and_slab);
+    auto signature            = signatures + static_cast<size_t>(v) * num_hashes;
+    signature[hash_first]     = thrust::get<0>(slab);
+    signature[hash_first + 1] = thrust::get<1>(slab);
+    signature[hash_first + 2] = thrust::get<2>(slab);
+    signature[hash_first + 3] = thrust::get<3>(slab);
+  }
+};
+
+template <typename vertex_t, typename result_t>
+struct estimate_jaccard_t {
+  uint32_t const* signatures{nullptr};
+  size_t num_hashes{};
+
+  __device__ result_t operator()(vertex_t u, vertex_t v) const
+  {
+    auto u_signature = signatures + static_cast<size_t>(u) * num_hashes;
+    auto v_signature = signatures + static_cast<size_t>(v) * num_hashes;
+    size_t num_matches{0};
+    for (size_t i = 0; i < num_hashes; ++i) {
+      // empty neighborhoods (0 signature values) are not similar to anything
+      num_matches += ((u_signature[i] == v_signature[i]) && (u_signature[i] != 0)) ? 1 : 0;
+    }
+    return static_cast<result_t>(num_matches) / static_cast<result_t>(num_hashes);
+  }
+};
+
+// bucket key of a vertex in a band, hash of the band's signature values
+template <typename vertex_t>
+struct band_key_t {
+  uint32_t const* signatures{nullptr};
+  size_t num_hashes{};
+  size_t hash_first{};
+  size_t rows_per_band{};
+
+  __device__ uint64_t operator()(vertex_t v) const
+  {
+    auto signature = signatures + static_cast<size_t>(v) * num_hashes + hash_first;
+    uint64_t key{0};
+    for (size_t i = 0; i < rows_per_band; ++i) {
+      key = hll::hash(static_cast<uint64_t>(signature[i]), key);
+    }
+    return key;
+  }
+};
+
+// whether the vertex pair (u, v), in the same bucket of the current band, is reported in this
+// band: the pair is new (u and v do not agree on all the signature values of an earlier band, so
+// each pair is materialized in the first band it collides in) and the estimate is high enough
+template <typename vertex_t, typename result_t>
+struct is_new_similar_pair_t {
+  uint32_t const* signatures{nullptr};
+  size_t num_hashes{};
+  size_t rows_per_band{};
+  size_t band{};
+  result_t threshold{};
+
+  __device__ bool operator()(vertex_t u, vertex_t v) const
+  {
+    auto u_signature = signatures + static_cast<size_t>(u) * num_hashes;
+    auto v_signature = signatures + static_cast<size_t>(v) * num_hashes;
+    for (size_t b = 0; b < band; ++b) {
+      bool agree{true};
+      for (size_t i = b * rows_per_band; i < (b + 1) * rows_per_band; ++i) {
+        if (u_signature[i] != v_signature[i]) {
+          agree = false;
+          break;
+        }
+      }
+      if (agree) { return false; }
+    }
+    return estimate_jaccard_t<vertex_t, result_t>{signatures, num_hashes}(u, v) >= threshold;
+  }
+};
+
+// count the pairs of the vertex at position i (in the vertices sorted by bucket key) and the
+// vertices following it in the same bucket (up to bucket_ends[i]) reported in the current band
+template <typename vertex_t, typename result_t>
+struct count_bucket_pairs_t {
+  vertex_t const* vertices{nullptr};
+  size_t const* bucket_ends{nullptr};
+  is_new_similar_pair_t<vertex_t, result_t> is_new_similar_pair{};
+
+  __device__ size_t operator()(size_t i) const
+  {
+    size_t count{0};
+    for (auto j = i + 1; j < bucket_ends[i]; ++j) {
+      if (is_new_similar_pair(vertices[i], vertices[j])) { ++count; }
+    }
+    return count;
+  }
+};
+
+// emit the pairs counted by count_bucket_pairs_t
+template <typename vertex_t, typename result_t>
+struct emit_bucket_pairs_t {
+  vertex_t const* vertices{nullptr};
+  size_t const* bucket_ends{nullptr};
+  size_t const* offsets{nullptr};
+  is_new_similar_pair_t<vertex_t, result_t> is_new_similar_pair{};
+  vertex_t* firsts{nullptr};
+  vertex_t* seconds{nullptr};
+  result_t* coefficients{nullptr};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto offset = offsets[i];
+    for (auto j = i + 1; j < bucket_ends[i]; ++j) {
+      if (is_new_similar_pair(vertices[i], vertices[j])) {
+        firsts[offset]       = thrust::min(vertices[i], vertices[j]);
+        seconds[offset]      = thrust::max(vertices[i], vertices[j]);
+        coefficients[offset] = estimate_jaccard_t<vertex_t, result_t>{
+          is_new_similar_pair.signatures, is_new_similar_pair.num_hashes}(vertices[i], vertices[j]);
+        ++offset;
+      }
+    }
+  }
+};
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+minhash_index_t<vertex_t> build_minhash_index(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, false> const& graph_view,
+  size_t num_hashes,
+  uint64_t seed,
+  bool do_expensive_check)
+{
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((num_hashes > 0) && (num_hashes % detail::minhash_slab_size == 0),
+                  "Invalid input argument: num_hashes should be a positive multiple of 4.");
+
+  if (do_expensive_check) {
+    // currently, nothing to do
+  }
+
+  auto num_vertices = graph_view.number_of_vertices();
+
+  // 2. compute the signatures a slab of hash functions at a time
+
+  rmm::device_uvector<uint32_t> signatures(num_hashes * static_cast<size_t>(num_vertices),
+                                           handle.get_stream());
+
+  auto slabs = allocate_dataframe_buffer<detail::minhash_slab_t>(
+    static_cast<size_t>(num_vertices), handle.get_stream());
+
+  for (size_t i = 0; i < num_hashes; i += detail::minhash_slab_size) {
+    per_v_transform_reduce_outgoing_e(handle,
+                                      graph_view,
+                                      dummy_property_t<vertex_t>{}.device_view(),
+                                      dummy_property_t<vertex_t>{}.device_view(),
+                                      detail::hash_neighbor_t<vertex_t, weight_t>{i, seed},
+                                      detail::minhash_slab_t{},
+                                      detail::minhash_slab_max_t{},
+                                      get_dataframe_buffer_begin(slabs));
+
+    auto v_and_slab_first = thrust::make_zip_iterator(thrust::make_tuple(
+      thrust::make_counting_iterator(vertex_t{0}), get_dataframe_buffer_begin(slabs)));
+    thrust::for_each(handle.get_thrust_policy(),
+                     v_and_slab_first,
+                     v_and_slab_first + num_vertices,
+                     detail::scatter_slab_t<vertex_t>{signatures.data(), num_hashes, i});
+  }
+
+  return minhash_index_t<vertex_t>{num_vertices, num_hashes, seed, std::move(signatures)};
+}
+
+template <typename vertex_t, typename result_t>
+rmm::device_uvector<result_t> minhash_jaccard_coefficients(
+  raft::handle_t const& handle,
+  minhash_index_t<vertex_t> const& index,
+  raft::device_span<vertex_t const> first,
+  raft::device_span<vertex_t const> second,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(first.size() == second.size(),
+                  "Invalid input argument: first and second should have the same size.");
+
+  if (do_expensive_check) {
+    auto num_vertices = index.number_of_vertices;
+    auto is_invalid   = [num_vertices] __device__(auto v) {
+      return (v < 0) || (v >= num_vertices);
+    };
+    auto num_invalid_vertices =
+      thrust::count_if(handle.get_thrust_policy(), first.begin(), first.end(), is_invalid) +
+      thrust::count_if(handle.get_thrust_policy(), second.begin(), second.end(), is_invalid);
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input argument: first or second have invalid vertex IDs.");
+  }
+
+  rmm::device_uvector<result_t> coefficients(first.size(), handle.get_stream());
+  thrust::transform(
+    handle.get_thrust_policy(),
+    first.begin(),
+    first.end(),
+    second.begin(),
+    coefficients.begin(),
+    detail::estimate_jaccard_t<vertex_t, result_t>{index.signatures.data(), index.num_hashes});
+
+  return coefficients;
+}
+
+template <typename vertex_t, typename result_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<result_t>>
+minhash_similar_pairs(raft::handle_t const& handle,
+                      minhash_index_t<vertex_t> const& index,
+                      size_t num_bands,
+                      result_t threshold,
+                      size_t max_bucket_size,
+                      bool do_expensive_check)
+{
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((num_bands > 0) && (index.num_hashes % num_bands == 0),
+                  "Invalid input argument: num_bands should divide the signature length.");
+  CUGRAPH_EXPECTS(max_bucket_size >= 2,
+                  "Invalid input argument: max_bucket_size should be at least 2.");
+
+  if (do_expensive_check) {
+    // currently, nothing to do
+  }
+
+  auto rows_per_band = index.num_hashes / num_bands;
+  auto signatures    = index.signatures.data();
+  auto num_hashes    = index.num_hashes;
+
+  // 2. vertices with empty neighborhoods share the all-zero signature but are not similar to
+  // anything, exclude them from the buckets
+
+  rmm::device_uvector<vertex_t> vertices(index.number_of_vertices, handle.get_stream());
+  vertices.resize(
+    thrust::distance(vertices.begin(),
+                     thrust::copy_if(handle.get_thrust_policy(),
+                                     thrust::make_counting_iterator(vertex_t{0}),
+                                     thrust::make_counting_iterator(index.number_of_vertices),
+                                     vertices.begin(),
+                                     [signatures, num_hashes] __device__(auto v) {
+                                       return signatures[static_cast<size_t>(v) * num_hashes] != 0;
+                                     })),
+    handle.get_stream());
+
+  // 3. for each band, bucket the vertices by the band's signature values and materialize the
+  // pairs in the same bucket that are not in the same bucket of an earlier band and have a high
+  // enough estimated Jaccard similarity; a vertex is paired with at most max_bucket_size - 1
+  // vertices following it in its bucket, which bounds the number of candidates of the buckets of
+  // popular signature values (e.g. of hub neighbors) to O(V * max_bucket_size) per band
+
+  rmm::device_uvector<vertex_t> firsts(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> seconds(0, handle.get_stream());
+  rmm::device_uvector<result_t> coefficients(0, handle.get_stream());
+
+  rmm::device_uvector<uint64_t> keys(vertices.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> bucket_vertices(vertices.size(), handle.get_stream());
+  rmm::device_uvector<size_t> bucket_ends(vertices.size(), handle.get_stream());
+  rmm::device_uvector<size_t> offsets(vertices.size() + 1, handle.get_stream());
+
+  for (size_t b = 0; b < num_bands; ++b) {
+    thrust::copy(
+      handle.get_thrust_policy(), vertices.begin(), vertices.end(), bucket_vertices.begin());
+    thrust::transform(
+      handle.get_thrust_policy(),
+      bucket_vertices.begin(),
+      bucket_vertices.end(),
+      keys.begin(),
+      detail::band_key_t<vertex_t>{signatures, num_hashes, b * rows_per_band, rows_per_band});
+    thrust::sort_by_key(
+      handle.get_thrust_policy(), keys.begin(), keys.end(), bucket_vertices.begin());
+    thrust::upper_bound(handle.get_thrust_policy(),
+                        keys.begin(),
+                        keys.end(),
+                        keys.begin(),
+                        keys.end(),
+                        bucket_ends.begin());
+    thrust::transform(handle.get_thrust_policy(),
+                      bucket_ends.begin(),
+                      bucket_ends.end(),
+                      thrust::make_counting_iterator(size_t{0}),
+                      bucket_ends.begin(),
+                      [max_bucket_size] __device__(auto bucket_end, auto i) {
+                        return (bucket_end - i) > max_bucket_size ? i + max_bucket_size
+                                                                  : bucket_end;
+                      });
+
+    detail::is_new_similar_pair_t<vertex_t, result_t> is_new_similar_pair{
+      signatures, num_hashes, rows_per_band, b, threshold};
+
+    thrust::transform(handle.get_thrust_policy(),
+                      thrust::make_counting_iterator(size_t{0}),
+                      thrust::make_counting_iterator(vertices.size()),
+                      offsets.begin(),
+                      detail::count_bucket_pairs_t<vertex_t, result_t>{
+                        bucket_vertices.data(), bucket_ends.data(), is_new_similar_pair});
+    offsets.set_element_to_zero_async(vertices.size(), handle.get_stream());
+    thrust::exclusive_scan(
+      handle.get_thrust_policy(), offsets.begin(), offsets.end(), offsets.begin());
+    auto num_band_pairs = offsets.back_element(handle.get_stream());
+
+    auto old_size = firsts.size();
+    firsts.resize(old_size + num_band_pairs, handle.get_stream());
+    seconds.resize(old_size + num_band_pairs, handle.get_stream());
+    coefficients.resize(old_size + num_band_pairs, handle.get_stream());
+
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(vertices.size()),
+      detail::emit_bucket_pairs_t<vertex_t, result_t>{bucket_vertices.data(),
+                                                      bucket_ends.data(),
+                                                      offsets.data(),
+                                                      is_new_similar_pair,
+                                                      firsts.data() + old_size,
+                                                      seconds.data() + old_size,
+                                                      coefficients.data() + old_size});
+  }
+
+  // 4. sort the pairs, a pair appears more than once only if its vertices collide in the band keys
+  // (64 bit hash values) of an earlier band without agreeing on the band's signature values
+
+  auto triplet_first = thrust::make_zip_iterator(
+    thrust::make_tuple(firsts.begin(), seconds.begin(), coefficients.begin()));
+  thrust::sort(handle.get_thrust_policy(), triplet_first, triplet_first + firsts.size());
+  auto num_pairs = static_cast<size_t>(thrust::distance(
+    triplet_first,
+    thrust::unique(handle.get_thrust_policy(), triplet_first, triplet_first + firsts.size())));
+  firsts.resize(num_pairs, handle.get_stream());
+  seconds.resize(num_pairs, handle.get_stream());
+  coefficients.resize(num_pairs, handle.get_stream());
+  firsts.shrink_to_fit(handle.get_stream());
+  seconds.shrink_to_fit(handle.get_stream());
+  coefficients.shrink_to_fit(handle.get_stream());
+
+  return std::make_tuple(std::move(firsts), std::move(seconds), std::move(coefficients));
+}
+
+}  // namespace cugraph
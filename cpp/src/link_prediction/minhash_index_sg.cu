@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <link_prediction/minhash_index_impl.cuh>
+
+namespace cugraph {
+
+// SG instantiation
+
+template minhash_index_t<int32_t> build_minhash_index(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
+  size_t num_hashes,
+  uint64_t seed,
+  bool do_expensive_check);
+
+template minhash_index_t<int32_t> build_minhash_index(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
+  size_t num_hashes,
+  uint64_t seed,
+  bool do_expensive_check);
+
+template minhash_index_t<int32_t> build_minhash_index(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
+  size_t num_hashes,
+  uint64_t seed,
+  bool do_expensive_check);
+
+template minhash_index_t<int32_t> build_minhash_index(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
+  size_t num_hashes,
+  uint64_t seed,
+  bool do_expensive_check);
+
+template minhash_index_t<int64_t> build_minhash_index(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
+  size_t num_hashes,
+  uint64_t seed,
+  bool do_expensive_check);
+
+template minhash_index_t<int64_t> build_minhash_index(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
+  size_t num_hashes,
+  uint64_t seed,
+  bool do_expensive_check);
+
+template rmm::device_uvector<float> minhash_jaccard_coefficients(
+  raft::handle_t const& handle,
+  minhash_index_t<int32_t> const& index,
+  raft::device_span<int32_t const> first,
+  raft::device_span<int32_t const> second,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<float>>
+minhash_similar_pairs(raft::handle_t const& handle,
+                      minhash_index_t<int32_t> const& index,
+                      size_t num_bands,
+                      float threshold,
+                      size_t max_bucket_size,
+                      bool do_expensive_check);
+
+template rmm::device_uvector<double> minhash_jaccard_coefficients(
+  raft::handle_t const& handle,
+  minhash_index_t<int32_t> const& index,
+  raft::device_span<int32_t const> first,
+  raft::device_span<int32_t const> second,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<double>>
+minhash_similar_pairs(raft::handle_t const& handle,
+                      minhash_index_t<int32_t> const& index,
+                      size_t num_bands,
+                      double threshold,
+                      size_t max_bucket_size,
+                      bool do_expensive_check);
+
+template rmm::device_uvector<float> minhash_jaccard_coefficients(
+  raft::handle_t const& handle,
+  minhash_index_t<int64_t> const& index,
+  raft::device_span<int64_t const> first,
+  raft::device_span<int64_t const> second,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<float>>
+minhash_similar_pairs(raft::handle_t const& handle,
+                      minhash_index_t<int64_t> const& index,
+                      size_t num_bands,
+                      float threshold,
+                      size_t max_bucket_size,
+                      bool do_expensive_check);
+
+template rmm::device_uvector<double> minhash_jaccard_coefficients(
+  raft::handle_t const& handle,
+  minhash_index_t<int64_t> const& index,
+  raft::device_span<int64_t const> first,
+  raft::device_span<int64_t const> second,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<double>>
+minhash_similar_pairs(raft::handle_t const& handle,
+                      minhash_index_t<int64_t> const& index,
+                      size_t num_bands,
+                      double threshold,
+                      size_t max_bucket_size,
+                      bool do_expensive_check);
+
+}  // namespace cugraph
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cugraph/detail/decompress_edge_partition.cuh>
 #include <cugraph/partition_manager.hpp>
 #include <cugraph/utilities/device_functors.cuh>
 #include <cugraph/utilities/host_scalar_comm.hpp>
@@ -426,6 +427,44 @@ struct copy_intersecting_nbrs_and_update_intersection_size_t {
   }
 };
 
+template <typename vertex_t>
+struct is_first_element_not_in_sorted_set_t {
+  raft::device_span<vertex_t const> sorted_set{};
+
+  __device__ bool operator()(thrust::tuple<vertex_t, vertex_t> pair) const
+  {
+    return !thrust::binary_search(
+      thrust::seq, sorted_set.begin(), sorted_set.end(), thrust::get<0>(pair));
+  }
+};
+
+template <typename vertex_t>
+struct reverse_nbr_list_degree_t {
+  raft::device_span<size_t const> offsets{};
+
+  __device__ size_t operator()(vertex_t v) const { return offsets[v + 1] - offsets[v]; }
+};
+
+template <typename vertex_t>
+struct copy_reverse_nbr_list_t {
+  raft::device_span<size_t const> offsets{};
+  raft::device_span<vertex_t const> indices{};
+  vertex_t const* vertices{nullptr};
+  size_t const* output_offsets{nullptr};
+  vertex_t* output_indices{nullptr};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto v = vertices[i];
+    // FIXME: this can lead to thread-divergence with a mix of high-degree and low-degree vertices
+    // in a single warp (better optimize if this becomes a performance bottleneck)
+    thrust::copy(thrust::seq,
+                 indices.begin() + offsets[v],
+                 indices.begin() + offsets[v + 1],
+                 output_indices + output_offsets[i]);
+  }
+};
+
 template <typename edge_t>
 struct strided_accumulate_t {
   edge_t const* rx_nbr_intersection_sizes{nullptr};
@@ -472,6 +511,56 @@ struct gatherv_indices_t {
   }
 };
 
+// Source (incoming) neighbor lists of every vertex (destination (outgoing) neighbor lists if
+// GraphViewType::is_storage_transposed), i.e. the neighbor lists in the direction opposite to the
+// edge partition storage, in CSR format (offsets: number of vertices + 1, indices: sorted within
+// each list). Single-GPU only. Build this once with build_reverse_nbr_lists() and pass it to
+// nbr_intersection() when intersecting over reverse neighbors in multiple calls, nbr_intersection()
+// otherwise extracts the reverse neighbor lists from the entire edge partition in every call.
+template <typename vertex_t>
+struct reverse_nbr_lists_t {
+  rmm::device_uvector<size_t> offsets;
+  rmm::device_uvector<vertex_t> indices;
+};
+
+template <typename GraphViewType>
+reverse_nbr_lists_t<typename GraphViewType::vertex_type> build_reverse_nbr_lists(
+  raft::handle_t const& handle, GraphViewType const& graph_view)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(!GraphViewType::is_multi_gpu,
+                "build_reverse_nbr_lists() currently supports single-GPU only.");
+
+  auto edge_partition =
+    edge_partition_device_view_t<vertex_t, edge_t, weight_t, GraphViewType::is_multi_gpu>(
+      graph_view.local_edge_partition_view(size_t{0}));
+
+  rmm::device_uvector<vertex_t> majors(edge_partition.number_of_edges(), handle.get_stream());
+  rmm::device_uvector<vertex_t> minors(majors.size(), handle.get_stream());
+  decompress_edge_partition_to_edgelist(handle,
+                                        edge_partition,
+                                        majors.data(),
+                                        minors.data(),
+                                        std::optional<weight_t*>{std::nullopt},
+                                        graph_view.local_edge_partition_segment_offsets(0));
+
+  auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(minors.begin(), majors.begin()));
+  thrust::sort(handle.get_thrust_policy(), edge_first, edge_first + minors.size());
+
+  rmm::device_uvector<size_t> offsets(graph_view.number_of_vertices() + 1, handle.get_stream());
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      minors.begin(),
+                      minors.end(),
+                      thrust::make_counting_iterator(vertex_t{0}),
+                      thrust::make_counting_iterator(graph_view.number_of_vertices() + 1),
+                      offsets.begin());
+
+  return reverse_nbr_lists_t<vertex_t>{std::move(offsets), std::move(majors)};
+}
+
 // In multi-GPU, the first element of every vertex pair in [vertex_pair_first, vertex_pair) should
 // be within the valid edge partition major range assigned to this process and the second element
 // should be within the valid edge partition minor range assigned to this process.
@@ -487,6 +576,13 @@ struct gatherv_indices_t {
 // thrust::distance(vertex_pair_first, vertex_pair_last) should be comparable across the global
 // communicator. If we need to build the neighbor lists, grouping based on applying "vertex ID %
 // number of groups"  is recommended for load-balancing.
+// intersect_dst_nbr[i] selects the destination (outgoing) neighbors (if true) or the source
+// (incoming) neighbors (if false) of the i'th pair element, e.g. {true, false} computes out(first)
+// \cap in(second) for directed graphs. Intersecting over source neighbors when
+// !GraphViewType::is_storage_transposed (or over destination neighbors when
+// GraphViewType::is_storage_transposed) is currently supported only in single-GPU, and
+// reverse_nbr_lists (if provided) should be the output of build_reverse_nbr_lists() for
+// graph_view.
 template <typename GraphViewType, typename VertexPairIterator>
 std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<typename GraphViewType::vertex_type>>
 nbr_intersection(raft::handle_t const& handle,
@@ -494,7 +590,9 @@ nbr_intersection(raft::handle_t const& handle,
                  VertexPairIterator vertex_pair_first,
                  VertexPairIterator vertex_pair_last,
                  std::array<bool, 2> intersect_dst_nbr,
-                 bool do_expensive_check = false)
+                 bool do_expensive_check = false,
+                 reverse_nbr_lists_t<typename GraphViewType::vertex_type> const* reverse_nbr_lists =
+                   nullptr)
 {
   using vertex_t = typename GraphViewType::vertex_type;
   using edge_t   = typename GraphViewType::edge_type;
@@ -872,9 +970,141 @@ nbr_intersection(raft::handle_t const& handle,
   std::optional<rmm::device_uvector<vertex_t>> minor_nbr_indices{std::nullopt};
 
   if (!intersect_minor_nbr[0] || !intersect_minor_nbr[1]) {
-    // FIXME: currently no use case, but this can be necessary to supporting triangle counting for
-    // directed graphs
-    CUGRAPH_FAIL("unimplemented.");
+    if constexpr (GraphViewType::is_multi_gpu) {
+      // FIXME: in multi-GPU, the major neighbors of a minor are spread over the GPUs in the
+      // column communicator, this requires another round of neighbor list shuffling.
+      CUGRAPH_FAIL("unimplemented.");
+    } else {
+      // 3.1 Find unique pair elements that need major neighbor lists (in-neighbors if
+      // !GraphViewType::is_storage_transposed, out-neighbors otherwise)
+
+      rmm::device_uvector<vertex_t> unique_minors(
+        (intersect_minor_nbr[0] ? size_t{0} : input_size) +
+          (intersect_minor_nbr[1] ? size_t{0} : input_size),
+        handle.get_stream());
+      {
+        auto output_first = unique_minors.begin();
+        if (!intersect_minor_nbr[0]) {
+          auto first_element_first = thrust::make_transform_iterator(
+            vertex_pair_first, thrust_tuple_get<thrust::tuple<vertex_t, vertex_t>, size_t{0}>{});
+          output_first = thrust::copy(handle.get_thrust_policy(),
+                                      first_element_first,
+                                      first_element_first + input_size,
+                                      output_first);
+        }
+        if (!intersect_minor_nbr[1]) {
+          auto second_element_first = thrust::make_transform_iterator(
+            vertex_pair_first, thrust_tuple_get<thrust::tuple<vertex_t, vertex_t>, size_t{1}>{});
+          thrust::copy(handle.get_thrust_policy(),
+                       second_element_first,
+                       second_element_first + input_size,
+                       output_first);
+        }
+        thrust::sort(handle.get_thrust_policy(), unique_minors.begin(), unique_minors.end());
+        unique_minors.resize(
+          thrust::distance(
+            unique_minors.begin(),
+            thrust::unique(handle.get_thrust_policy(), unique_minors.begin(), unique_minors.end())),
+          handle.get_stream());
+        unique_minors.shrink_to_fit(handle.get_stream());
+      }
+
+      // 3.2 Build the neighbor lists (from reverse_nbr_lists if provided, otherwise by extracting
+      // the edges whose minors are in unique_minors and sorting them using the minor as the
+      // primary key and the major as the secondary key)
+
+      if (reverse_nbr_lists) {
+        auto cached_offsets = raft::device_span<size_t const>((*reverse_nbr_lists).offsets.data(),
+                                                              (*reverse_nbr_lists).offsets.size());
+        auto cached_indices = raft::device_span<vertex_t const>(
+          (*reverse_nbr_lists).indices.data(), (*reverse_nbr_lists).indices.size());
+
+        minor_nbr_offsets =
+          rmm::device_uvector<size_t>(unique_minors.size() + 1, handle.get_stream());
+        (*minor_nbr_offsets).set_element_to_zero_async(size_t{0}, handle.get_stream());
+        auto degree_first = thrust::make_transform_iterator(
+          unique_minors.begin(), reverse_nbr_list_degree_t<vertex_t>{cached_offsets});
+        thrust::inclusive_scan(handle.get_thrust_policy(),
+                               degree_first,
+                               degree_first + unique_minors.size(),
+                               (*minor_nbr_offsets).begin() + 1);
+
+        minor_nbr_indices = rmm::device_uvector<vertex_t>(
+          (*minor_nbr_offsets).back_element(handle.get_stream()), handle.get_stream());
+        thrust::for_each(handle.get_thrust_policy(),
+                         thrust::make_counting_iterator(size_t{0}),
+                         thrust::make_counting_iterator(unique_minors.size()),
+                         copy_reverse_nbr_list_t<vertex_t>{cached_offsets,
+                                                           cached_indices,
+                                                           unique_minors.data(),
+                                                           (*minor_nbr_offsets).data(),
+                                                           (*minor_nbr_indices).data()});
+      } else {
+        auto edge_partition =
+          edge_partition_device_view_t<vertex_t, edge_t, weight_t, GraphViewType::is_multi_gpu>(
+            graph_view.local_edge_partition_view(size_t{0}));
+
+        rmm::device_uvector<vertex_t> edgelist_majors(edge_partition.number_of_edges(),
+                                                      handle.get_stream());
+        rmm::device_uvector<vertex_t> edgelist_minors(edgelist_majors.size(), handle.get_stream());
+        decompress_edge_partition_to_edgelist(handle,
+                                              edge_partition,
+                                              edgelist_majors.data(),
+                                              edgelist_minors.data(),
+                                              std::optional<weight_t*>{std::nullopt},
+                                              graph_view.local_edge_partition_segment_offsets(0));
+
+        auto edge_first = thrust::make_zip_iterator(
+          thrust::make_tuple(edgelist_minors.begin(), edgelist_majors.begin()));
+        auto num_remaining_edges = static_cast<size_t>(thrust::distance(
+          edge_first,
+          thrust::remove_if(
+            handle.get_thrust_policy(),
+            edge_first,
+            edge_first + edgelist_minors.size(),
+            is_first_element_not_in_sorted_set_t<vertex_t>{
+              raft::device_span<vertex_t const>(unique_minors.data(), unique_minors.size())})));
+        edgelist_minors.resize(num_remaining_edges, handle.get_stream());
+        edgelist_majors.resize(num_remaining_edges, handle.get_stream());
+        edgelist_minors.shrink_to_fit(handle.get_stream());
+        edgelist_majors.shrink_to_fit(handle.get_stream());
+
+        thrust::sort(handle.get_thrust_policy(), edge_first, edge_first + edgelist_minors.size());
+
+        minor_nbr_offsets =
+          rmm::device_uvector<size_t>(unique_minors.size() + 1, handle.get_stream());
+        (*minor_nbr_offsets).set_element_to_zero_async(size_t{0}, handle.get_stream());
+        thrust::upper_bound(handle.get_thrust_policy(),
+                            edgelist_minors.begin(),
+                            edgelist_minors.end(),
+                            unique_minors.begin(),
+                            unique_minors.end(),
+                            (*minor_nbr_offsets).begin() + 1);
+        edgelist_minors.resize(size_t{0}, handle.get_stream());
+        edgelist_minors.shrink_to_fit(handle.get_stream());
+        minor_nbr_indices = std::move(edgelist_majors);
+      }
+
+      // 3.3 Build the vertex to neighbor list index map
+
+      minor_to_idx_map_ptr = std::make_unique<
+        cuco::static_map<vertex_t, vertex_t, cuda::thread_scope_device, decltype(stream_adapter)>>(
+        // cuco::static_map requires at least one empty slot
+        std::max(static_cast<size_t>(static_cast<double>(unique_minors.size()) / load_factor),
+                 static_cast<size_t>(unique_minors.size()) + 1),
+        cuco::sentinel::empty_key<vertex_t>{invalid_vertex_id<vertex_t>::value},
+        cuco::sentinel::empty_value<vertex_t>{invalid_vertex_id<vertex_t>::value},
+        stream_adapter,
+        handle.get_stream());
+      auto pair_first = thrust::make_zip_iterator(unique_minors.begin(),
+                                                  thrust::make_counting_iterator(vertex_t{0}));
+      (*minor_to_idx_map_ptr)
+        ->insert(pair_first,
+                 pair_first + unique_minors.size(),
+                 cuco::detail::MurmurHash3_32<vertex_t>{},
+                 thrust::equal_to<vertex_t>{},
+                 handle.get_stream());
+    }
   }
 
   // 4. Intersect
@@ -1241,7 +1471,39 @@ nbr_intersection(raft::handle_t const& handle,
                         pick_min_degree_t<void*, void*, vertex_t, edge_t, weight_t, false>{
                           nullptr, nullptr, nullptr, nullptr, edge_partition});
     } else {
-      CUGRAPH_FAIL("unimplemented.");
+      auto minor_to_idx_map = (*minor_to_idx_map_ptr)->get_device_view();
+      if (intersect_minor_nbr[0]) {
+        thrust::transform(
+          handle.get_thrust_policy(),
+          vertex_pair_first,
+          vertex_pair_first + input_size,
+          nbr_intersection_sizes.begin(),
+          pick_min_degree_t<void*, decltype(minor_to_idx_map), vertex_t, edge_t, weight_t, false>{
+            nullptr, nullptr, minor_to_idx_map, (*minor_nbr_offsets).data(), edge_partition});
+      } else if (intersect_minor_nbr[1]) {
+        thrust::transform(
+          handle.get_thrust_policy(),
+          vertex_pair_first,
+          vertex_pair_first + input_size,
+          nbr_intersection_sizes.begin(),
+          pick_min_degree_t<decltype(minor_to_idx_map), void*, vertex_t, edge_t, weight_t, false>{
+            minor_to_idx_map, (*minor_nbr_offsets).data(), nullptr, nullptr, edge_partition});
+      } else {
+        thrust::transform(handle.get_thrust_policy(),
+                          vertex_pair_first,
+                          vertex_pair_first + input_size,
+                          nbr_intersection_sizes.begin(),
+                          pick_min_degree_t<decltype(minor_to_idx_map),
+                                            decltype(minor_to_idx_map),
+                                            vertex_t,
+                                            edge_t,
+                                            weight_t,
+                                            false>{minor_to_idx_map,
+                                                   (*minor_nbr_offsets).data(),
+                                                   minor_to_idx_map,
+                                                   (*minor_nbr_offsets).data(),
+                                                   edge_partition});
+      }
     }
 
     nbr_intersection_offsets.resize(nbr_intersection_sizes.size() + 1, handle.get_stream());
@@ -1279,7 +1541,74 @@ nbr_intersection(raft::handle_t const& handle,
           nbr_intersection_indices.data(),
           invalid_vertex_id<vertex_t>::value});
     } else {
-      CUGRAPH_FAIL("unimplemented.");
+      auto minor_to_idx_map = (*minor_to_idx_map_ptr)->get_device_view();
+      if (intersect_minor_nbr[0]) {
+        thrust::tabulate(handle.get_thrust_policy(),
+                         nbr_intersection_sizes.begin(),
+                         nbr_intersection_sizes.end(),
+                         copy_intersecting_nbrs_and_update_intersection_size_t<
+                           void*,
+                           decltype(minor_to_idx_map),
+                           decltype(vertex_pair_first),
+                           vertex_t,
+                           edge_t,
+                           weight_t,
+                           false>{nullptr,
+                                  nullptr,
+                                  nullptr,
+                                  minor_to_idx_map,
+                                  (*minor_nbr_offsets).data(),
+                                  (*minor_nbr_indices).data(),
+                                  edge_partition,
+                                  vertex_pair_first,
+                                  nbr_intersection_offsets.data(),
+                                  nbr_intersection_indices.data(),
+                                  invalid_vertex_id<vertex_t>::value});
+      } else if (intersect_minor_nbr[1]) {
+        thrust::tabulate(handle.get_thrust_policy(),
+                         nbr_intersection_sizes.begin(),
+                         nbr_intersection_sizes.end(),
+                         copy_intersecting_nbrs_and_update_intersection_size_t<
+                           decltype(minor_to_idx_map),
+                           void*,
+                           decltype(vertex_pair_first),
+                           vertex_t,
+                           edge_t,
+                           weight_t,
+                           false>{minor_to_idx_map,
+                                  (*minor_nbr_offsets).data(),
+                                  (*minor_nbr_indices).data(),
+                                  nullptr,
+                                  nullptr,
+                                  nullptr,
+                                  edge_partition,
+                                  vertex_pair_first,
+                                  nbr_intersection_offsets.data(),
+                                  nbr_intersection_indices.data(),
+                                  invalid_vertex_id<vertex_t>::value});
+      } else {
+        thrust::tabulate(handle.get_thrust_policy(),
+                         nbr_intersection_sizes.begin(),
+                         nbr_intersection_sizes.end(),
+                         copy_intersecting_nbrs_and_update_intersection_size_t<
+                           decltype(minor_to_idx_map),
+                           decltype(minor_to_idx_map),
+                           decltype(vertex_pair_first),
+                           vertex_t,
+                           edge_t,
+                           weight_t,
+                           false>{minor_to_idx_map,
+                                  (*minor_nbr_offsets).data(),
+                                  (*minor_nbr_indices).data(),
+                                  minor_to_idx_map,
+                                  (*minor_nbr_offsets).data(),
+                                  (*minor_nbr_indices).data(),
+                                  edge_partition,
+                                  vertex_pair_first,
+                                  nbr_intersection_offsets.data(),
+                                  nbr_intersection_indices.data(),
+                                  invalid_vertex_id<vertex_t>::value});
+      }
     }
 
 #if 1  // FIXME: work-around for the 32 bit integer overflow issue in thrust::remove,
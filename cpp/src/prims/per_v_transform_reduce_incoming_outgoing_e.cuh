@@ -78,7 +78,8 @@ template <bool update_major,
                                                          otherwise */
           ,
           typename EdgeOp,
-          typename T>
+          typename T,
+          typename ReduceOp>
 __global__ void per_v_transform_reduce_e_hypersparse(
   edge_partition_device_view_t<typename GraphViewType::vertex_type,
                                typename GraphViewType::edge_type,
@@ -88,7 +89,8 @@ __global__ void per_v_transform_reduce_e_hypersparse(
   EdgePartitionDstValueInputWrapper edge_partition_dst_value_input,
   ResultValueOutputIteratorOrWrapper result_value_output,
   EdgeOp e_op,
-  T init /* relevent only if update_major == true */)
+  T init /* relevent only if update_major == true */,
+  ReduceOp reduce_op /* relevent only if update_major == true */)
 {
   using vertex_t = typename GraphViewType::vertex_type;
   using edge_t   = typename GraphViewType::edge_type;
@@ -101,8 +103,6 @@ __global__ void per_v_transform_reduce_e_hypersparse(
 
   auto dcs_nzd_vertex_count = *(edge_partition.dcs_nzd_vertex_count());
 
-  [[maybe_unused]] property_op<T, thrust::plus>
-    edge_property_add{};  // relevant only if update_major == true
   while (idx < static_cast<size_t>(dcs_nzd_vertex_count)) {
     auto major =
       *(edge_partition.major_from_major_hypersparse_idx_nocheck(static_cast<vertex_t>(idx)));
@@ -150,7 +150,7 @@ __global__ void per_v_transform_reduce_e_hypersparse(
                                  thrust::make_counting_iterator(local_degree),
                                  transform_op,
                                  init,
-                                 edge_property_add);
+                                 reduce_op);
     } else {
       if constexpr (GraphViewType::is_multi_gpu) {
         thrust::for_each(
@@ -190,7 +190,8 @@ template <bool update_major,
                                                          otherwise */
           ,
           typename EdgeOp,
-          typename T>
+          typename T,
+          typename ReduceOp>
 __global__ void per_v_transform_reduce_e_low_degree(
   edge_partition_device_view_t<typename GraphViewType::vertex_type,
                                typename GraphViewType::edge_type,
@@ -202,7 +203,8 @@ __global__ void per_v_transform_reduce_e_low_degree(
   EdgePartitionDstValueInputWrapper edge_partition_dst_value_input,
   ResultValueOutputIteratorOrWrapper result_value_output,
   EdgeOp e_op,
-  T init /* relevent only if update_major == true */)
+  T init /* relevent only if update_major == true */,
+  ReduceOp reduce_op /* relevent only if update_major == true */)
 {
   using vertex_t = typename GraphViewType::vertex_type;
   using edge_t   = typename GraphViewType::edge_type;
@@ -213,8 +215,6 @@ __global__ void per_v_transform_reduce_e_low_degree(
     static_cast<size_t>(major_range_first - edge_partition.major_range_first());
   auto idx = static_cast<size_t>(tid);
 
-  [[maybe_unused]] property_op<T, thrust::plus>
-    edge_property_add{};  // relevant only if update_major == true
   while (idx < static_cast<size_t>(major_range_last - major_range_first)) {
     auto major_offset = major_start_offset + idx;
     vertex_t const* indices{nullptr};
@@ -262,7 +262,7 @@ __global__ void per_v_transform_reduce_e_low_degree(
                                  thrust::make_counting_iterator(local_degree),
                                  transform_op,
                                  init,
-                                 edge_property_add);
+                                 reduce_op);
     } else {
       if constexpr (GraphViewType::is_multi_gpu) {
         thrust::for_each(
@@ -302,7 +302,8 @@ template <bool update_major,
                                                          otherwise */
           ,
           typename EdgeOp,
-          typename T>
+          typename T,
+          typename ReduceOp>
 __global__ void per_v_transform_reduce_e_mid_degree(
   edge_partition_device_view_t<typename GraphViewType::vertex_type,
                                typename GraphViewType::edge_type,
@@ -314,7 +315,8 @@ __global__ void per_v_transform_reduce_e_mid_degree(
   EdgePartitionDstValueInputWrapper edge_partition_dst_value_input,
   ResultValueOutputIteratorOrWrapper result_value_output,
   EdgeOp e_op,
-  T init /* relevent only if update_major == true */)
+  T init /* relevent only if update_major == true */,
+  ReduceOp reduce_op /* relevent only if update_major == true */)
 {
   using vertex_t      = typename GraphViewType::vertex_type;
   using edge_t        = typename GraphViewType::edge_type;
@@ -333,8 +335,6 @@ __global__ void per_v_transform_reduce_e_mid_degree(
     temp_storage[per_v_transform_reduce_e_kernel_block_size /
                  raft::warp_size()];  // relevant only if update_major == true
 
-  [[maybe_unused]] property_op<e_op_result_t, thrust::plus>
-    edge_property_add{};  // relevant only if update_major == true
   while (idx < static_cast<size_t>(major_range_last - major_range_first)) {
     auto major_offset = major_start_offset + idx;
     vertex_t const* indices{nullptr};
@@ -369,7 +369,7 @@ __global__ void per_v_transform_reduce_e_mid_degree(
                                     edge_partition_dst_value_input.get(dst_offset),
                                     e_op);
       if constexpr (update_major) {
-        e_op_result_sum = edge_property_add(e_op_result_sum, e_op_result);
+        e_op_result_sum = reduce_op(e_op_result_sum, e_op_result);
       } else {
         if constexpr (GraphViewType::is_multi_gpu) {
           atomic_accumulate_edge_op_result(result_value_output.get_iter(minor_offset), e_op_result);
@@ -380,7 +380,7 @@ __global__ void per_v_transform_reduce_e_mid_degree(
     }
     if constexpr (update_major) {
       e_op_result_sum = WarpReduce(temp_storage[threadIdx.x / raft::warp_size()])
-                          .Reduce(e_op_result_sum, edge_property_add);
+                          .Reduce(e_op_result_sum, reduce_op);
       if (lane_id == 0) { *(result_value_output + idx) = e_op_result_sum; }
     }
 
@@ -397,7 +397,8 @@ template <bool update_major,
                                                          otherwise */
           ,
           typename EdgeOp,
-          typename T>
+          typename T,
+          typename ReduceOp>
 __global__ void per_v_transform_reduce_e_high_degree(
   edge_partition_device_view_t<typename GraphViewType::vertex_type,
                                typename GraphViewType::edge_type,
@@ -409,7 +410,8 @@ __global__ void per_v_transform_reduce_e_high_degree(
   EdgePartitionDstValueInputWrapper edge_partition_dst_value_input,
   ResultValueOutputIteratorOrWrapper result_value_output,
   EdgeOp e_op,
-  T init /* relevent only if update_major == true */)
+  T init /* relevent only if update_major == true */,
+  ReduceOp reduce_op /* relevent only if update_major == true */)
 {
   using vertex_t      = typename GraphViewType::vertex_type;
   using edge_t        = typename GraphViewType::edge_type;
@@ -424,8 +426,6 @@ __global__ void per_v_transform_reduce_e_high_degree(
   [[maybe_unused]] __shared__
     typename BlockReduce::TempStorage temp_storage;  // relevant only if update_major == true
 
-  [[maybe_unused]] property_op<e_op_result_t, thrust::plus>
-    edge_property_add{};  // relevant only if update_major == true
   while (idx < static_cast<size_t>(major_range_last - major_range_first)) {
     auto major_offset = major_start_offset + idx;
     vertex_t const* indices{nullptr};
@@ -460,7 +460,7 @@ __global__ void per_v_transform_reduce_e_high_degree(
                                     edge_partition_dst_value_input.get(dst_offset),
                                     e_op);
       if constexpr (update_major) {
-        e_op_result_sum = edge_property_add(e_op_result_sum, e_op_result);
+        e_op_result_sum = reduce_op(e_op_result_sum, e_op_result);
       } else {
         if constexpr (GraphViewType::is_multi_gpu) {
           atomic_accumulate_edge_op_result(result_value_output.get_iter(minor_offset), e_op_result);
@@ -470,7 +470,7 @@ __global__ void per_v_transform_reduce_e_high_degree(
       }
     }
     if constexpr (update_major) {
-      e_op_result_sum = BlockReduce(temp_storage).Reduce(e_op_result_sum, edge_property_add);
+      e_op_result_sum = BlockReduce(temp_storage).Reduce(e_op_result_sum, reduce_op);
       if (threadIdx.x == 0) { *(result_value_output + idx) = e_op_result_sum; }
     }
 
@@ -485,6 +485,7 @@ template <bool incoming,  // iterate over incoming edges (incoming == true) or o
           typename EdgePartitionDstValueInputWrapper,
           typename EdgeOp,
           typename T,
+          typename ReduceOp,
           typename VertexValueOutputIterator>
 void per_v_transform_reduce_e(raft::handle_t const& handle,
                               GraphViewType const& graph_view,
@@ -492,6 +493,7 @@ void per_v_transform_reduce_e(raft::handle_t const& handle,
                               EdgePartitionDstValueInputWrapper edge_partition_dst_value_input,
                               EdgeOp e_op,
                               T init,
+                              ReduceOp reduce_op,
                               VertexValueOutputIterator vertex_value_output_first)
 {
   constexpr auto update_major = (incoming == GraphViewType::is_storage_transposed);
@@ -502,6 +504,21 @@ void per_v_transform_reduce_e(raft::handle_t const& handle,
   using weight_t = typename GraphViewType::weight_type;
 
   static_assert(is_arithmetic_or_thrust_tuple_of_arithmetic<T>::value);
+  static_assert(std::is_same_v<typename ReduceOp::value_type, T>);
+  // reducing to minor vertices relies on atomic additions
+  static_assert(update_major || std::is_same_v<ReduceOp, cugraph::reduce_op::plus<T>>,
+                "only reduce_op::plus is supported when reducing to minor vertices.");
+  static_assert(!GraphViewType::is_multi_gpu ||
+                  cugraph::reduce_op::has_compatible_raft_comms_op_v<ReduceOp>,
+                "ReduceOp should have a compatible raft::comms::op_t in multi-GPU.");
+  // the edge partitions not owning the major vertices are seeded with the identity element
+  static_assert(cugraph::reduce_op::has_identity_element_v<ReduceOp>,
+                "ReduceOp should have an identity element.");
+  // raft::comms reduces thrust tuples element-wise, which matches only reduce_op::plus (e.g.
+  // reduce_op::minimum & maximum compare thrust tuples lexicographically)
+  static_assert(!GraphViewType::is_multi_gpu || std::is_arithmetic_v<T> ||
+                  std::is_same_v<ReduceOp, cugraph::reduce_op::plus<T>>,
+                "only reduce_op::plus is supported for thrust tuple types in multi-GPU.");
 
   [[maybe_unused]] std::conditional_t<GraphViewType::is_storage_transposed,
                                       edge_partition_src_property_t<GraphViewType, T>,
@@ -642,12 +659,12 @@ void per_v_transform_reduce_e(raft::handle_t const& handle,
       edge_partition_device_view_t<vertex_t, edge_t, weight_t, GraphViewType::is_multi_gpu>(
         graph_view.local_edge_partition_view(i));
 
-    auto major_init = T{};
+    auto major_init = ReduceOp::identity_element;
     if constexpr (update_major) {
       if constexpr (GraphViewType::is_multi_gpu) {
         auto& col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
         auto const col_comm_rank = col_comm.get_rank();
-        major_init               = (static_cast<int>(i) == col_comm_rank) ? init : T{};
+        major_init = (static_cast<int>(i) == col_comm_rank) ? init : ReduceOp::identity_element;
       } else {
         major_init = init;
       }
@@ -714,7 +731,8 @@ void per_v_transform_reduce_e(raft::handle_t const& handle,
               edge_partition_dst_value_input_copy,
               segment_output_buffer,
               e_op,
-              major_init);
+              major_init,
+              reduce_op);
         }
       }
       if ((*segment_offsets)[3] - (*segment_offsets)[2] > 0) {
@@ -736,7 +754,8 @@ void per_v_transform_reduce_e(raft::handle_t const& handle,
             edge_partition_dst_value_input_copy,
             segment_output_buffer,
             e_op,
-            major_init);
+            major_init,
+            reduce_op);
       }
       if ((*segment_offsets)[2] - (*segment_offsets)[1] > 0) {
         auto exec_stream = stream_pool_indices
@@ -757,7 +776,8 @@ void per_v_transform_reduce_e(raft::handle_t const& handle,
             edge_partition_dst_value_input_copy,
             segment_output_buffer,
             e_op,
-            major_init);
+            major_init,
+            reduce_op);
       }
       if ((*segment_offsets)[1] > 0) {
         auto exec_stream = stream_pool_indices
@@ -776,7 +796,8 @@ void per_v_transform_reduce_e(raft::handle_t const& handle,
             edge_partition_dst_value_input_copy,
             output_buffer,
             e_op,
-            major_init);
+            major_init,
+            reduce_op);
       }
     } else {
       if (edge_partition.major_range_size() > 0) {
@@ -792,7 +813,8 @@ void per_v_transform_reduce_e(raft::handle_t const& handle,
             edge_partition_dst_value_input_copy,
             output_buffer,
             e_op,
-            major_init);
+            major_init,
+            reduce_op);
       }
     }
 
@@ -869,8 +891,7 @@ void per_v_transform_reduce_e(raft::handle_t const& handle,
                              scatter_reduce_t<vertex_t,
                                               T,
                                               decltype(major_buffer_first),
-                                              property_op<T, thrust::plus>>{
-                               major_buffer_first, property_op<T, thrust::plus>{}});
+                                              ReduceOp>{major_buffer_first, reduce_op});
           }
 
           if (col_comm_rank == static_cast<int>(i)) {
@@ -885,7 +906,7 @@ void per_v_transform_reduce_e(raft::handle_t const& handle,
             major_buffer_first + (*segment_offsets)[3],
             vertex_value_output_first + (*segment_offsets)[3],
             (*segment_offsets)[4] - (*segment_offsets)[3],
-            raft::comms::op_t::SUM,
+            ReduceOp::compatible_raft_comms_op,
             static_cast<int>(i),
             handle.get_stream_from_stream_pool((i * max_segments) % (*stream_pool_indices).size()));
 #endif
@@ -895,7 +916,7 @@ void per_v_transform_reduce_e(raft::handle_t const& handle,
                         major_buffer_first + (*segment_offsets)[2],
                         vertex_value_output_first + (*segment_offsets)[2],
                         (*segment_offsets)[3] - (*segment_offsets)[2],
-                        raft::comms::op_t::SUM,
+                        ReduceOp::compatible_raft_comms_op,
                         static_cast<int>(i),
                         handle.get_stream_from_stream_pool((i * max_segments + 1) %
                                                            (*stream_pool_indices).size()));
@@ -905,7 +926,7 @@ void per_v_transform_reduce_e(raft::handle_t const& handle,
                         major_buffer_first + (*segment_offsets)[1],
                         vertex_value_output_first + (*segment_offsets)[1],
                         (*segment_offsets)[2] - (*segment_offsets)[1],
-                        raft::comms::op_t::SUM,
+                        ReduceOp::compatible_raft_comms_op,
                         static_cast<int>(i),
                         handle.get_stream_from_stream_pool((i * max_segments + 2) %
                                                            (*stream_pool_indices).size()));
@@ -915,7 +936,7 @@ void per_v_transform_reduce_e(raft::handle_t const& handle,
                         major_buffer_first,
                         vertex_value_output_first,
                         (*segment_offsets)[1],
-                        raft::comms::op_t::SUM,
+                        ReduceOp::compatible_raft_comms_op,
                         static_cast<int>(i),
                         handle.get_stream_from_stream_pool((i * max_segments + 3) %
                                                            (*stream_pool_indices).size()));
@@ -928,7 +949,7 @@ void per_v_transform_reduce_e(raft::handle_t const& handle,
                       major_buffer_first,
                       vertex_value_output_first,
                       reduction_size,
-                      raft::comms::op_t::SUM,
+                      ReduceOp::compatible_raft_comms_op,
                       static_cast<int>(i),
                       handle.get_stream());
       }
@@ -1068,6 +1089,57 @@ void per_v_transform_reduce_incoming_e(
                                          edge_partition_dst_value_input,
                                          e_op,
                                          init,
+                                         reduce_op::plus<T>{},
+                                         vertex_value_output_first);
+}
+
+/**
+ * @brief Iterate over every vertex's incoming edges to update vertex properties with a custom
+ * reduction operator.
+ *
+ * Identical to the overload above except that the @p e_op return values are reduced with @p
+ * reduce_op instead of being summed. This is supported only if the vertices are the major vertices
+ * of the edge partitions (i.e. GraphViewType::is_storage_transposed is true). @p reduce_op should
+ * define an identity element (the edge partitions not owning a vertex start from it). In multi-GPU,
+ * @p reduce_op should also have a compatible raft::comms::op_t, and T should be an arithmetic type
+ * unless @p reduce_op is reduce_op::plus (raft::comms reduces thrust tuples element-wise, see
+ * reduce_op.cuh).
+ *
+ * @tparam ReduceOp Type of the binary reduction operator.
+ * @param reduce_op Binary operator reducing two @p e_op return values (or @p init) to one.
+ */
+template <typename GraphViewType,
+          typename EdgePartitionSrcValueInputWrapper,
+          typename EdgePartitionDstValueInputWrapper,
+          typename EdgeOp,
+          typename T,
+          typename ReduceOp,
+          typename VertexValueOutputIterator>
+void per_v_transform_reduce_incoming_e(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  EdgePartitionSrcValueInputWrapper edge_partition_src_value_input,
+  EdgePartitionDstValueInputWrapper edge_partition_dst_value_input,
+  EdgeOp e_op,
+  T init,
+  ReduceOp reduce_op,
+  VertexValueOutputIterator vertex_value_output_first,
+  bool do_expensive_check = false)
+{
+  static_assert(GraphViewType::is_storage_transposed == true,
+                "custom reduction operators are supported only when updating major vertices.");
+
+  if (do_expensive_check) {
+    // currently, nothing to do
+  }
+
+  detail::per_v_transform_reduce_e<true>(handle,
+                                         graph_view,
+                                         edge_partition_src_value_input,
+                                         edge_partition_dst_value_input,
+                                         e_op,
+                                         init,
+                                         reduce_op,
                                          vertex_value_output_first);
 }
 
@@ -1133,6 +1205,57 @@ void per_v_transform_reduce_outgoing_e(
                                           edge_partition_dst_value_input,
                                           e_op,
                                           init,
+                                          reduce_op::plus<T>{},
+                                          vertex_value_output_first);
+}
+
+/**
+ * @brief Iterate over every vertex's outgoing edges to update vertex properties with a custom
+ * reduction operator.
+ *
+ * Identical to the overload above except that the @p e_op return values are reduced with @p
+ * reduce_op instead of being summed. This is supported only if the vertices are the major vertices
+ * of the edge partitions (i.e. GraphViewType::is_storage_transposed is false). @p reduce_op should
+ * define an identity element (the edge partitions not owning a vertex start from it). In multi-GPU,
+ * @p reduce_op should also have a compatible raft::comms::op_t, and T should be an arithmetic type
+ * unless @p reduce_op is reduce_op::plus (raft::comms reduces thrust tuples element-wise, see
+ * reduce_op.cuh).
+ *
+ * @tparam ReduceOp Type of the binary reduction operator.
+ * @param reduce_op Binary operator reducing two @p e_op return values (or @p init) to one.
+ */
+template <typename GraphViewType,
+          typename EdgePartitionSrcValueInputWrapper,
+          typename EdgePartitionDstValueInputWrapper,
+          typename EdgeOp,
+          typename T,
+          typename ReduceOp,
+          typename VertexValueOutputIterator>
+void per_v_transform_reduce_outgoing_e(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  EdgePartitionSrcValueInputWrapper edge_partition_src_value_input,
+  EdgePartitionDstValueInputWrapper edge_partition_dst_value_input,
+  EdgeOp e_op,
+  T init,
+  ReduceOp reduce_op,
+  VertexValueOutputIterator vertex_value_output_first,
+  bool do_expensive_check = false)
+{
+  static_assert(GraphViewType::is_storage_transposed == false,
+                "custom reduction operators are supported only when updating major vertices.");
+
+  if (do_expensive_check) {
+    // currently, nothing to do
+  }
+
+  detail::per_v_transform_reduce_e<false>(handle,
+                                          graph_view,
+                                          edge_partition_src_value_input,
+                                          edge_partition_dst_value_input,
+                                          e_op,
+                                          init,
+                                          reduce_op,
                                           vertex_value_output_first);
 }
 
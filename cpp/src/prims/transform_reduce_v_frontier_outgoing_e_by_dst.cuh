@@ -40,7 +40,10 @@
 #include <thrust/count.h>
 #include <thrust/distance.h>
 #include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
 #include <thrust/functional.h>
+#include <thrust/gather.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/iterator_traits.h>
@@ -59,6 +62,8 @@
 #include <cstdlib>
 #include <limits>
 #include <numeric>
+#include <optional>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -720,14 +725,154 @@ __global__ void update_v_frontier_from_outgoing_e_high_degree(
   }
 }
 
+template <typename key_t, typename index_t>
+struct update_dense_reduce_winner_t {
+  key_t const* keys{nullptr};
+  index_t* winners{nullptr};
+  key_t key_range_first{};
+
+  __device__ void operator()(index_t i) const
+  {
+    atomicMin(winners + (keys[i] - key_range_first), i);
+  }
+};
+
+// pick the first (in buffer order) element of each key, this is deterministic; index_t is the
+// narrowest type (with atomicMin support) able to index the buffer
+template <typename key_t, typename payload_t, typename index_t>
+auto dense_select_winner_elements(
+  raft::handle_t const& handle,
+  decltype(allocate_dataframe_buffer<key_t>(0, rmm::cuda_stream_view{}))&& key_buffer,
+  decltype(allocate_optional_payload_buffer<payload_t>(0,
+                                                       rmm::cuda_stream_view{}))&& payload_buffer,
+  key_t key_range_first,
+  size_t range_size)
+{
+  auto constexpr invalid_idx = std::numeric_limits<index_t>::max();
+
+  rmm::device_uvector<index_t> winners(range_size, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), winners.begin(), winners.end(), invalid_idx);
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator(index_t{0}),
+                   thrust::make_counting_iterator(
+                     static_cast<index_t>(size_dataframe_buffer(key_buffer))),
+                   update_dense_reduce_winner_t<key_t, index_t>{
+                     get_dataframe_buffer_begin(key_buffer), winners.data(), key_range_first});
+  winners.resize(
+    thrust::distance(
+      winners.begin(),
+      thrust::remove(handle.get_thrust_policy(), winners.begin(), winners.end(), invalid_idx)),
+    handle.get_stream());
+
+  auto new_key_buffer = allocate_dataframe_buffer<key_t>(winners.size(), handle.get_stream());
+  auto new_payload_buffer =
+    allocate_dataframe_buffer<payload_t>(winners.size(), handle.get_stream());
+  auto input_pair_first = thrust::make_zip_iterator(
+    thrust::make_tuple(get_dataframe_buffer_begin(key_buffer),
+                       get_optional_payload_buffer_begin<payload_t>(payload_buffer)));
+  auto output_pair_first =
+    thrust::make_zip_iterator(thrust::make_tuple(get_dataframe_buffer_begin(new_key_buffer),
+                                                 get_dataframe_buffer_begin(new_payload_buffer)));
+  thrust::gather(handle.get_thrust_policy(),
+                 winners.begin(),
+                 winners.end(),
+                 input_pair_first,
+                 output_pair_first);
+
+  return std::make_tuple(std::move(new_key_buffer), std::move(new_payload_buffer));
+}
+
+// de-duplicate vertex keys (and pick an arbitrary payload for each unique key if payload_t is not
+// void, so this is valid only for reduce_op::any) using a bitmap (and a per-vertex winner slot)
+// over [key_range_first, key_range_last); unlike sort & unique, the cost is linear in the number
+// of keys and the range size, so this is faster if the keys densely populate the range (e.g. BFS
+// iterations visiting a large fraction of the graph).
+template <typename key_t, typename payload_t>
+auto dense_reduce_buffer_elements(
+  raft::handle_t const& handle,
+  decltype(allocate_dataframe_buffer<key_t>(0, rmm::cuda_stream_view{}))&& key_buffer,
+  decltype(allocate_optional_payload_buffer<payload_t>(0,
+                                                       rmm::cuda_stream_view{}))&& payload_buffer,
+  key_t key_range_first,
+  key_t key_range_last)
+{
+  static_assert(std::is_integral_v<key_t>);
+
+  auto range_size = static_cast<size_t>(key_range_last - key_range_first);
+
+  if constexpr (std::is_same_v<payload_t, void>) {
+    rmm::device_uvector<uint32_t> bitmap(
+      (range_size + (sizeof(uint32_t) * 8 - 1)) / (sizeof(uint32_t) * 8), handle.get_stream());
+    thrust::fill(handle.get_thrust_policy(), bitmap.begin(), bitmap.end(), uint32_t{0});
+    thrust::for_each(handle.get_thrust_policy(),
+                     get_dataframe_buffer_begin(key_buffer),
+                     get_dataframe_buffer_end(key_buffer),
+                     [bitmap = bitmap.data(), key_range_first] __device__(auto key) {
+                       auto offset = key - key_range_first;
+                       auto mask   = uint32_t{1} << (offset % (sizeof(uint32_t) * 8));
+                       atomicOr(bitmap + (offset / (sizeof(uint32_t) * 8)), mask);
+                     });
+    auto num_uniques = thrust::transform_reduce(
+      handle.get_thrust_policy(),
+      bitmap.begin(),
+      bitmap.end(),
+      [] __device__(uint32_t word) { return static_cast<size_t>(__popc(word)); },
+      size_t{0},
+      thrust::plus<size_t>{});
+    resize_dataframe_buffer(key_buffer, num_uniques, handle.get_stream());
+    shrink_to_fit_dataframe_buffer(key_buffer, handle.get_stream());
+    thrust::copy_if(handle.get_thrust_policy(),
+                    thrust::make_counting_iterator(key_range_first),
+                    thrust::make_counting_iterator(key_range_last),
+                    get_dataframe_buffer_begin(key_buffer),
+                    [bitmap = bitmap.data(), key_range_first] __device__(auto key) {
+                      auto offset = key - key_range_first;
+                      auto mask   = uint32_t{1} << (offset % (sizeof(uint32_t) * 8));
+                      return (bitmap[offset / (sizeof(uint32_t) * 8)] & mask) != uint32_t{0};
+                    });
+  } else {
+    // winner slots are 4 byte wide unless the buffer has more than 2^32 - 1 elements
+    if (size_dataframe_buffer(key_buffer) <
+        static_cast<size_t>(std::numeric_limits<uint32_t>::max())) {
+      std::tie(key_buffer, payload_buffer) =
+        dense_select_winner_elements<key_t, payload_t, uint32_t>(
+          handle, std::move(key_buffer), std::move(payload_buffer), key_range_first, range_size);
+    } else {
+      std::tie(key_buffer, payload_buffer) =
+        dense_select_winner_elements<key_t, payload_t, unsigned long long int>(
+          handle, std::move(key_buffer), std::move(payload_buffer), key_range_first, range_size);
+    }
+  }
+
+  return std::make_tuple(std::move(key_buffer), std::move(payload_buffer));
+}
+
+// dense_reduce_buffer_elements is used instead of sort & reduce if the number of keys is at least
+// 1/dense_reduce_ratio of the key range size
+size_t constexpr dense_reduce_ratio{8};
+
 template <typename key_t, typename payload_t, typename ReduceOp>
 auto sort_and_reduce_buffer_elements(
   raft::handle_t const& handle,
   decltype(allocate_dataframe_buffer<key_t>(0, rmm::cuda_stream_view{}))&& key_buffer,
   decltype(allocate_optional_payload_buffer<payload_t>(0,
                                                        rmm::cuda_stream_view{}))&& payload_buffer,
-  ReduceOp reduce_op)
+  ReduceOp reduce_op,
+  std::optional<std::tuple<key_t, key_t>> key_range /* valid only if key_t is a vertex type */)
 {
+  if constexpr (std::is_integral_v<key_t> &&
+                (std::is_same_v<payload_t, void> ||
+                 std::is_same_v<ReduceOp, reduce_op::any<typename ReduceOp::value_type>>)) {
+    if (key_range && (size_dataframe_buffer(key_buffer) * dense_reduce_ratio >=
+                      static_cast<size_t>(std::get<1>(*key_range) - std::get<0>(*key_range)))) {
+      return dense_reduce_buffer_elements<key_t, payload_t>(handle,
+                                                            std::move(key_buffer),
+                                                            std::move(payload_buffer),
+                                                            std::get<0>(*key_range),
+                                                            std::get<1>(*key_range));
+    }
+  }
+
   if constexpr (std::is_same_v<payload_t, void>) {
     thrust::sort(handle.get_thrust_policy(),
                  get_dataframe_buffer_begin(key_buffer),
@@ -1219,9 +1364,14 @@ transform_reduce_v_frontier_outgoing_e_by_dst(
   shrink_to_fit_dataframe_buffer(key_buffer, handle.get_stream());
   detail::shrink_to_fit_optional_payload_buffer<payload_t>(payload_buffer, handle.get_stream());
 
+  std::optional<std::tuple<key_t, key_t>> key_range{std::nullopt};
+  if constexpr (std::is_same_v<key_t, vertex_t>) {
+    key_range = std::make_tuple(graph_view.local_edge_partition_dst_range_first(),
+                                graph_view.local_edge_partition_dst_range_last());
+  }
   std::tie(key_buffer, payload_buffer) =
     detail::sort_and_reduce_buffer_elements<key_t, payload_t, ReduceOp>(
-      handle, std::move(key_buffer), std::move(payload_buffer), reduce_op);
+      handle, std::move(key_buffer), std::move(payload_buffer), reduce_op, key_range);
   if constexpr (GraphViewType::is_multi_gpu) {
     // FIXME: this step is unnecessary if row_comm_size== 1
     auto& comm               = handle.get_comms();
@@ -1274,9 +1424,13 @@ transform_reduce_v_frontier_outgoing_e_by_dst(
       payload_buffer = std::move(rx_payload_buffer);
     }
 
+    if constexpr (std::is_same_v<key_t, vertex_t>) {
+      key_range = std::make_tuple(graph_view.local_vertex_partition_range_first(),
+                                  graph_view.local_vertex_partition_range_last());
+    }
     std::tie(key_buffer, payload_buffer) =
       detail::sort_and_reduce_buffer_elements<key_t, payload_t, ReduceOp>(
-        handle, std::move(key_buffer), std::move(payload_buffer), reduce_op);
+        handle, std::move(key_buffer), std::move(payload_buffer), reduce_op, key_range);
   }
 
   if constexpr (!std::is_same_v<payload_t, void>) {
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <prims/property_op_utils.cuh>
+#include <prims/reduce_op.cuh>
+
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/dataframe_buffer.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+
+#include <cub/cub.cuh>
+#include <thrust/reduce.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace cugraph {
+
+namespace detail {
+
+int32_t constexpr transform_reduce_v_with_output_kernel_block_size = 128;
+// cap the grid (the grid-stride loop covers the remaining vertices) to keep the number of per-block
+// partial results small
+int32_t constexpr transform_reduce_v_with_output_max_blocks_per_sm = 4;
+
+template <typename vertex_t,
+          typename VertexValueInputIterator,
+          typename VertexValueOutputIterator,
+          typename VertexOp,
+          typename T,
+          typename ReduceOp,
+          typename ResultIterator>
+__global__ void transform_reduce_v_with_output_kernel(
+  vertex_t local_vertex_partition_range_first,
+  vertex_t num_vertices,
+  VertexValueInputIterator vertex_value_input_first,
+  VertexValueOutputIterator vertex_value_output_first,
+  VertexOp v_op,
+  T identity_element,
+  ReduceOp reduce_op,
+  ResultIterator block_result_first)
+{
+  auto const tid = threadIdx.x + blockIdx.x * blockDim.x;
+  auto idx       = static_cast<size_t>(tid);
+
+  using BlockReduce = cub::BlockReduce<T, transform_reduce_v_with_output_kernel_block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+
+  auto block_result = identity_element;
+  while (idx < static_cast<size_t>(num_vertices)) {
+    auto ret =
+      v_op(local_vertex_partition_range_first + static_cast<vertex_t>(idx),
+           *(vertex_value_input_first + idx));  // read before the output (may alias) is written
+    *(vertex_value_output_first + idx) = thrust::get<0>(ret);
+    block_result = reduce_op(block_result, static_cast<T>(thrust::get<1>(ret)));
+    idx += gridDim.x * blockDim.x;
+  }
+
+  block_result = BlockReduce(temp_storage).Reduce(block_result, reduce_op);
+  if (threadIdx.x == 0) { *(block_result_first + blockIdx.x) = block_result; }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Transform the input vertex property values to new vertex property values and reduce
+ * values derived in the same pass.
+ *
+ * This fuses a thrust::transform() of the vertex property values with a transform_reduce_v() over
+ * the same vertices (e.g. "compute the new value, store it, and accumulate its difference from the
+ * old value") in a single pass: @p v_op is evaluated once per vertex, the output is stored, and the
+ * derived values are block-reduced in the same kernel (only the per-block partial results, at most
+ * a few per SM, are reduced afterwards).
+ * @p vertex_value_input_first and @p vertex_value_output_first may point to the same arrays, each
+ * vertex property value is read before it is overwritten.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam ReduceOp Type of the binary reduction operator. Should have an identity element and a
+ * compatible raft::comms reduction operator (e.g. reduce_op::plus, reduce_op::minimum, or
+ * reduce_op::maximum).
+ * @tparam VertexValueInputIterator Type of the iterator for input vertex property values.
+ * @tparam VertexValueOutputIterator Type of the iterator for output vertex property values.
+ * @tparam VertexOp Type of the binary vertex operator.
+ * @tparam T Type of the initial value.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param vertex_value_input_first Iterator pointing to the input vertex property values for the
+ * first (inclusive) vertex (assigned to this process in multi-GPU). `vertex_value_input_last`
+ * (exclusive) is deduced as @p vertex_value_input_first + @p
+ * graph_view.local_vertex_partition_range_size().
+ * @param vertex_value_output_first Iterator pointing to the output vertex property values for the
+ * first (inclusive) vertex (assigned to this process in multi-GPU).
+ * @param v_op Binary operator takes vertex ID and *(@p vertex_value_input_first + i) (where i is
+ * [0, @p graph_view.local_vertex_partition_range_size())) and returns a thrust::tuple of the value
+ * to be stored in *(@p vertex_value_output_first + i) and the value to be reduced.
+ * @param init Initial value to be reduced with the values returned by @p v_op.
+ * @param reduce_op Binary operator that takes two input arguments and reduce the two values to one.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return T Reduced values.
+ */
+template <typename GraphViewType,
+          typename ReduceOp,
+          typename VertexValueInputIterator,
+          typename VertexValueOutputIterator,
+          typename VertexOp,
+          typename T>
+T transform_reduce_v_with_output(raft::handle_t const& handle,
+                                 GraphViewType const& graph_view,
+                                 VertexValueInputIterator vertex_value_input_first,
+                                 VertexValueOutputIterator vertex_value_output_first,
+                                 VertexOp v_op,
+                                 T init,
+                                 ReduceOp reduce_op,
+                                 bool do_expensive_check = false)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(reduce_op::has_identity_element_v<ReduceOp> &&
+                reduce_op::has_compatible_raft_comms_op_v<ReduceOp>);
+
+  if (do_expensive_check) {
+    // currently, nothing to do
+  }
+
+  auto local_init = init;
+  if constexpr (GraphViewType::is_multi_gpu) {
+    if (handle.get_comms().get_rank() != int{0}) { local_init = ReduceOp::identity_element; }
+  }
+
+  auto num_vertices = graph_view.local_vertex_partition_range_size();
+  auto ret          = local_init;
+  if (num_vertices > vertex_t{0}) {
+    raft::grid_1d_thread_t update_grid(
+      num_vertices,
+      detail::transform_reduce_v_with_output_kernel_block_size,
+      std::min(handle.get_device_properties().maxGridSize[0],
+               handle.get_device_properties().multiProcessorCount *
+                 detail::transform_reduce_v_with_output_max_blocks_per_sm));
+    auto block_results = allocate_dataframe_buffer<T>(static_cast<size_t>(update_grid.num_blocks),
+                                                      handle.get_stream());
+    detail::transform_reduce_v_with_output_kernel<<<update_grid.num_blocks,
+                                                    update_grid.block_size,
+                                                    0,
+                                                    handle.get_stream()>>>(
+      graph_view.local_vertex_partition_range_first(),
+      num_vertices,
+      vertex_value_input_first,
+      vertex_value_output_first,
+      v_op,
+      ReduceOp::identity_element,
+      reduce_op,
+      get_dataframe_buffer_begin(block_results));
+    ret = thrust::reduce(handle.get_thrust_policy(),
+                         get_dataframe_buffer_begin(block_results),
+                         get_dataframe_buffer_end(block_results),
+                         local_init,
+                         reduce_op);
+  }
+
+  if constexpr (GraphViewType::is_multi_gpu) {
+    ret = host_scalar_allreduce(
+      handle.get_comms(), ret, ReduceOp::compatible_raft_comms_op, handle.get_stream());
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Transform the input vertex property values to new vertex property values and sum values
+ * derived in the same pass.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam VertexValueInputIterator Type of the iterator for input vertex property values.
+ * @tparam VertexValueOutputIterator Type of the iterator for output vertex property values.
+ * @tparam VertexOp Type of the binary vertex operator.
+ * @tparam T Type of the initial value.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param vertex_value_input_first Iterator pointing to the input vertex property values for the
+ * first (inclusive) vertex (assigned to this process in multi-GPU).
+ * @param vertex_value_output_first Iterator pointing to the output vertex property values for the
+ * first (inclusive) vertex (assigned to this process in multi-GPU).
+ * @param v_op Binary operator takes vertex ID and *(@p vertex_value_input_first + i) (where i is
+ * [0, @p graph_view.local_vertex_partition_range_size())) and returns a thrust::tuple of the value
+ * to be stored in *(@p vertex_value_output_first + i) and the value to be summed.
+ * @param init Initial value to be added to the values returned by @p v_op.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return T Sum of the values returned by @p v_op and @p init.
+ */
+template <typename GraphViewType,
+          typename VertexValueInputIterator,
+          typename VertexValueOutputIterator,
+          typename VertexOp,
+          typename T>
+T transform_reduce_v_with_output(raft::handle_t const& handle,
+                                 GraphViewType const& graph_view,
+                                 VertexValueInputIterator vertex_value_input_first,
+                                 VertexValueOutputIterator vertex_value_output_first,
+                                 VertexOp v_op,
+                                 T init,
+                                 bool do_expensive_check = false)
+{
+  return transform_reduce_v_with_output(handle,
+                                        graph_view,
+                                        vertex_value_input_first,
+                                        vertex_value_output_first,
+                                        v_op,
+                                        init,
+                                        reduce_op::plus<T>{},
+                                        do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -26,7 +26,10 @@
 #include <thrust/copy.h>
 #include <thrust/distance.h>
 #include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/merge.h>
 #include <thrust/partition.h>
@@ -34,6 +37,7 @@
 #include <thrust/remove.h>
 #include <thrust/sort.h>
 #include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
 #include <thrust/tuple.h>
 #include <thrust/unique.h>
 
@@ -46,8 +50,59 @@
 
 namespace cugraph {
 
+namespace detail {
+
+template <typename vertex_t>
+struct set_bucket_bitmap_bit_t {
+  uint32_t* bitmap{nullptr};
+  vertex_t vertex_range_first{};
+
+  __device__ void operator()(vertex_t v) const
+  {
+    auto offset = v - vertex_range_first;
+    auto mask   = uint32_t{1} << (offset % (sizeof(uint32_t) * 8));
+    atomicOr(bitmap + (offset / (sizeof(uint32_t) * 8)), mask);
+  }
+};
+
+// returns true if the bit was not set before
+template <typename vertex_t>
+struct test_and_set_bucket_bitmap_bit_t {
+  uint32_t* bitmap{nullptr};
+  vertex_t vertex_range_first{};
+
+  __device__ bool operator()(vertex_t v) const
+  {
+    auto offset = v - vertex_range_first;
+    auto mask   = uint32_t{1} << (offset % (sizeof(uint32_t) * 8));
+    return (atomicOr(bitmap + (offset / (sizeof(uint32_t) * 8)), mask) & mask) == uint32_t{0};
+  }
+};
+
+template <typename vertex_t>
+struct clear_bucket_bitmap_bit_t {
+  uint32_t* bitmap{nullptr};
+  vertex_t vertex_range_first{};
+
+  __device__ void operator()(vertex_t v) const
+  {
+    auto offset = v - vertex_range_first;
+    auto mask   = uint32_t{1} << (offset % (sizeof(uint32_t) * 8));
+    atomicAnd(bitmap + (offset / (sizeof(uint32_t) * 8)), ~mask);
+  }
+};
+
+}  // namespace detail
+
 // stores unique key objects in the sorted (non-descending) order; key type is either vertex_t
 // (tag_t == void) or thrust::tuple<vertex_t, tag_t> (tag_t != void)
+//
+// If a vertex range is provided (tag_t == void only), the bucket keeps a bitmap over the range next
+// to the sorted list while the bitmap is no larger than the list. Inserting into a non-empty dense
+// bucket then filters the vertices already in the bucket in O(1) per vertex and merges only the new
+// vertices (no unique pass over the merged list). Inserting into an empty bucket is a plain copy.
+// The bitmap is rebuilt lazily (only when an insertion needs it), so clear() and the non-const
+// element access only mark the bitmap stale. The sorted list is always up-to-date.
 template <typename vertex_t, typename tag_t = void, bool is_multi_gpu = false>
 class sorted_unique_key_bucket_t {
   static_assert(std::is_same_v<tag_t, void> || std::is_arithmetic_v<tag_t>);
@@ -62,6 +117,26 @@ class sorted_unique_key_bucket_t {
   {
   }
 
+  /**
+   * @brief Construct a bucket that may switch to the bitmap representation.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param vertex_range_first First (inclusive) vertex of the range every inserted vertex belongs
+   * to.
+   * @param vertex_range_last Last (exclusive) vertex of the range every inserted vertex belongs to.
+   */
+  template <typename tag_type = tag_t, std::enable_if_t<std::is_same_v<tag_type, void>>* = nullptr>
+  sorted_unique_key_bucket_t(raft::handle_t const& handle,
+                             vertex_t vertex_range_first,
+                             vertex_t vertex_range_last)
+    : handle_ptr_(&handle),
+      vertices_(0, handle.get_stream()),
+      tags_(std::byte{0}),
+      vertex_range_(std::make_tuple(vertex_range_first, vertex_range_last))
+  {
+  }
+
   template <typename tag_type = tag_t, std::enable_if_t<!std::is_same_v<tag_type, void>>* = nullptr>
   sorted_unique_key_bucket_t(raft::handle_t const& handle)
     : handle_ptr_(&handle), vertices_(0, handle.get_stream()), tags_(0, handle.get_stream())
@@ -76,12 +151,13 @@ class sorted_unique_key_bucket_t {
   template <typename tag_type = tag_t, std::enable_if_t<std::is_same_v<tag_type, void>>* = nullptr>
   void insert(vertex_t vertex)
   {
-    if (vertices_.size() > 0) {
+    if (size() > 0) {
       rmm::device_scalar<vertex_t> tmp(vertex, handle_ptr_->get_stream());
       insert(tmp.data(), tmp.data() + 1);
     } else {
       vertices_.resize(1, handle_ptr_->get_stream());
       raft::update_device(vertices_.data(), &vertex, size_t{1}, handle_ptr_->get_stream());
+      bitmap_valid_ = false;
     }
   }
 
@@ -125,7 +201,38 @@ class sorted_unique_key_bucket_t {
     static_assert(
       std::is_same_v<typename std::iterator_traits<VertexIterator>::value_type, vertex_t>);
 
-    if (vertices_.size() > 0) {
+    auto num_inserts = static_cast<size_t>(thrust::distance(vertex_first, vertex_last));
+    if ((vertices_.size() > 0) && use_bitmap(vertices_.size() + num_inserts)) {
+      update_bitmap();
+      rmm::device_uvector<bool> is_new(num_inserts, handle_ptr_->get_stream());
+      thrust::transform(handle_ptr_->get_thrust_policy(),
+                        vertex_first,
+                        vertex_last,
+                        is_new.begin(),
+                        detail::test_and_set_bucket_bitmap_bit_t<vertex_t>{
+                          bitmap_->data(), std::get<0>(*vertex_range_)});
+      // copy_if is stable, so the new vertices remain sorted
+      rmm::device_uvector<vertex_t> new_vertices(num_inserts, handle_ptr_->get_stream());
+      new_vertices.resize(
+        thrust::distance(new_vertices.begin(),
+                         thrust::copy_if(handle_ptr_->get_thrust_policy(),
+                                         vertex_first,
+                                         vertex_last,
+                                         is_new.begin(),
+                                         new_vertices.begin(),
+                                         thrust::identity<bool>{})),
+        handle_ptr_->get_stream());
+      // the new vertices are not in the bucket, no need to unique
+      rmm::device_uvector<vertex_t> merged_vertices(vertices_.size() + new_vertices.size(),
+                                                    handle_ptr_->get_stream());
+      thrust::merge(handle_ptr_->get_thrust_policy(),
+                    vertices_.begin(),
+                    vertices_.end(),
+                    new_vertices.begin(),
+                    new_vertices.end(),
+                    merged_vertices.begin());
+      vertices_ = std::move(merged_vertices);
+    } else if (vertices_.size() > 0) {
       rmm::device_uvector<vertex_t> merged_vertices(
         vertices_.size() + thrust::distance(vertex_first, vertex_last), handle_ptr_->get_stream());
       thrust::merge(handle_ptr_->get_thrust_policy(),
@@ -140,10 +247,12 @@ class sorted_unique_key_bucket_t {
                                                              merged_vertices.end())),
                              handle_ptr_->get_stream());
       merged_vertices.shrink_to_fit(handle_ptr_->get_stream());
-      vertices_ = std::move(merged_vertices);
+      vertices_     = std::move(merged_vertices);
+      bitmap_valid_ = false;
     } else {
       vertices_.resize(thrust::distance(vertex_first, vertex_last), handle_ptr_->get_stream());
       thrust::copy(handle_ptr_->get_thrust_policy(), vertex_first, vertex_last, vertices_.begin());
+      bitmap_valid_ = false;
     }
   }
 
@@ -203,25 +312,39 @@ class sorted_unique_key_bucket_t {
   template <bool do_aggregate = is_multi_gpu>
   std::enable_if_t<do_aggregate, size_t> aggregate_size() const
   {
-    return host_scalar_allreduce(handle_ptr_->get_comms(),
-                                 vertices_.size(),
-                                 raft::comms::op_t::SUM,
-                                 handle_ptr_->get_stream());
+    return host_scalar_allreduce(
+      handle_ptr_->get_comms(), size(), raft::comms::op_t::SUM, handle_ptr_->get_stream());
   }
 
   template <bool do_aggregate = is_multi_gpu>
   std::enable_if_t<!do_aggregate, size_t> aggregate_size() const
   {
-    return vertices_.size();
+    return size();
   }
 
   void resize(size_t size)
   {
+    if (bitmap_valid_) {
+      if (size <= vertices_.size()) {
+        thrust::for_each(handle_ptr_->get_thrust_policy(),
+                         vertices_.begin() + size,
+                         vertices_.end(),
+                         detail::clear_bucket_bitmap_bit_t<vertex_t>{bitmap_->data(),
+                                                                     std::get<0>(*vertex_range_)});
+      } else {
+        bitmap_valid_ = false;  // the new elements are undefined
+      }
+    }
     vertices_.resize(size, handle_ptr_->get_stream());
     if constexpr (!std::is_same_v<tag_t, void>) { tags_.resize(size, handle_ptr_->get_stream()); }
   }
 
-  void clear() { resize(0); }
+  void clear()
+  {
+    bitmap_valid_ = false;  // keep the bitmap buffer, it is reset only if needed again
+    vertices_.resize(0, handle_ptr_->get_stream());
+    if constexpr (!std::is_same_v<tag_t, void>) { tags_.resize(0, handle_ptr_->get_stream()); }
+  }
 
   void shrink_to_fit()
   {
@@ -239,9 +362,12 @@ class sorted_unique_key_bucket_t {
     return vertices_.begin();
   }
 
+  // the caller may update the bucket elements through the returned iterator, this marks the
+  // bitmap stale (use the const overload for read-only access)
   template <typename tag_type = tag_t, std::enable_if_t<std::is_same_v<tag_type, void>>* = nullptr>
   auto begin()
   {
+    bitmap_valid_ = false;
     return vertices_.begin();
   }
 
@@ -281,9 +407,43 @@ class sorted_unique_key_bucket_t {
   auto end() { return begin() + vertices_.size(); }
 
  private:
+  // a bitmap over the vertex range is no larger than the sorted list if the list has at least one
+  // element per sizeof(vertex_t) * 8 vertices in the range
+  bool use_bitmap(size_t num_vertices) const
+  {
+    if (!vertex_range_) { return false; }
+    auto range_size =
+      static_cast<size_t>(std::get<1>(*vertex_range_) - std::get<0>(*vertex_range_));
+    return num_vertices * (sizeof(vertex_t) * 8) >= range_size;
+  }
+
+  // (re-)build the bitmap from the sorted list if it is stale, the bitmap buffer is re-used
+  void update_bitmap()
+  {
+    if (bitmap_valid_) { return; }
+    if (!bitmap_) {
+      auto range_size =
+        static_cast<size_t>(std::get<1>(*vertex_range_) - std::get<0>(*vertex_range_));
+      bitmap_ = rmm::device_uvector<uint32_t>(
+        (range_size + (sizeof(uint32_t) * 8 - 1)) / (sizeof(uint32_t) * 8),
+        handle_ptr_->get_stream());
+    }
+    thrust::fill(handle_ptr_->get_thrust_policy(), bitmap_->begin(), bitmap_->end(), uint32_t{0});
+    thrust::for_each(
+      handle_ptr_->get_thrust_policy(),
+      vertices_.begin(),
+      vertices_.end(),
+      detail::set_bucket_bitmap_bit_t<vertex_t>{bitmap_->data(), std::get<0>(*vertex_range_)});
+    bitmap_valid_ = true;
+  }
+
   raft::handle_t const* handle_ptr_{nullptr};
   rmm::device_uvector<vertex_t> vertices_;
   optional_buffer_type tags_;
+
+  std::optional<std::tuple<vertex_t, vertex_t>> vertex_range_{std::nullopt};
+  std::optional<rmm::device_uvector<uint32_t>> bitmap_{std::nullopt};
+  bool bitmap_valid_{false};  // true if bitmap_ has exactly the bits of vertices_ set
 };
 
 template <typename vertex_t, typename tag_t = void, bool is_multi_gpu = false>
@@ -303,6 +463,21 @@ class vertex_frontier_t {
     }
   }
 
+  // every vertex inserted to this frontier should be in [vertex_range_first, vertex_range_last),
+  // this allows buckets to switch to the bitmap representation when they become dense
+  template <typename tag_type = tag_t, std::enable_if_t<std::is_same_v<tag_type, void>>* = nullptr>
+  vertex_frontier_t(raft::handle_t const& handle,
+                    size_t num_buckets,
+                    vertex_t vertex_range_first,
+                    vertex_t vertex_range_last)
+    : handle_ptr_(&handle)
+  {
+    buckets_.reserve(num_buckets);
+    for (size_t i = 0; i < num_buckets; ++i) {
+      buckets_.emplace_back(handle, vertex_range_first, vertex_range_last);
+    }
+  }
+
   size_t num_buckets() const { return buckets_.size(); }
 
   sorted_unique_key_bucket_t<vertex_t, tag_t, is_multi_gpu>& bucket(size_t bucket_idx)
@@ -82,43 +82,96 @@ rmm::device_uvector<typename GraphViewType::edge_type> get_global_adjacency_offs
   const rmm::device_uvector<typename GraphViewType::edge_type>& global_out_degrees);
 
 /**
- * @brief Gather active majors across gpus in a column communicator
+ * @brief Gather the per-GPU degree offsets of the vertices owned by current gpu
  *
- * Collect all the vertex ids and client gpu ids to be processed by every gpu in
- * the column communicator and sort the list.
+ * The adjacency list of a vertex is split across the gpus in the column communicator. For each
+ * local vertex, collect the offset of every such gpu's slice of the adjacency list (followed by
+ * the global out degree) so the owner can route work directly to the gpus storing the edges. In
+ * single-GPU, every row holds the offset 0 followed by the out degree.
  *
- * @tparam vertex_t Type of vertex indices.
+ * @tparam GraphViewType Type of the passed non-owning graph object.
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
- * @param d_in Device vector containing vertices local to this GPU
- * @return Device vector containing all the vertices that are to be processed by every gpu
- * in the column communicator
+ * @param graph_view Non-owning graph object.
+ * @param global_degree_offsets Global degree offset to local adjacency list for every major
+ * represented by current gpu
+ * @param global_out_degrees Global out degrees for every source represented by current gpu
+ * @return Device vector of size local_vertex_partition_range_size() * (col_comm_size + 1), row v
+ * stores the degree offsets of vertex (local_vertex_partition_range_first() + v) on column
+ * communicator ranks 0 to col_comm_size - 1 followed by its global out degree
  */
-template <typename vertex_t>
-rmm::device_uvector<vertex_t> allgather_active_majors(raft::handle_t const& handle,
-                                                      rmm::device_uvector<vertex_t>&& d_in);
+template <typename GraphViewType>
+rmm::device_uvector<typename GraphViewType::edge_type> get_vertex_partition_degree_offsets(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  const rmm::device_uvector<typename GraphViewType::edge_type>& global_degree_offsets,
+  const rmm::device_uvector<typename GraphViewType::edge_type>& global_out_degrees);
 
 /**
- * @brief Return global out degrees of active majors
- *
- * Get partition information of all graph partitions on the gpu and select
- * global degrees of all active majors
+ * @brief Return global out degrees of vertices owned by current gpu
  *
  * @tparam GraphViewType Type of the passed non-owning graph object.
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
  * @param graph_view Non-owning graph object.
- * @param active_majors Device vector containing all the vertex id that are processed by
- * gpus in the column communicator
- * @param global_out_degrees Global out degrees for every source represented by current gpu
- * @return Global out degrees of all majors in active_majors
+ * @param vertices Device vector of vertices in the local vertex partition
+ * @param vertex_partition_degree_offsets Output of get_vertex_partition_degree_offsets
+ * @return Global out degrees of all vertices in @p vertices
  */
 template <typename GraphViewType>
-rmm::device_uvector<typename GraphViewType::edge_type> get_active_major_global_degrees(
+rmm::device_uvector<typename GraphViewType::edge_type> get_vertex_partition_global_degrees(
   raft::handle_t const& handle,
   GraphViewType const& graph_view,
-  const rmm::device_uvector<typename GraphViewType::vertex_type>& active_majors,
-  const rmm::device_uvector<typename GraphViewType::edge_type>& global_out_degrees);
+  const rmm::device_uvector<typename GraphViewType::vertex_type>& vertices,
+  const rmm::device_uvector<typename GraphViewType::edge_type>& vertex_partition_degree_offsets);
+
+/**
+ * @brief Send sampled neighbor indices to the gpus storing the selected edges
+ *
+ * Each (vertex, index) pair is sent only to the gpu in the column communicator whose slice of the
+ * vertex's adjacency list contains the index; negative (invalid) indices are dropped.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object (multi-GPU only).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param vertices Device vector of vertices in the local vertex partition
+ * @param minor_map Device vector of @p indices_per_major sampled indices for every vertex
+ * @param indices_per_major Number of indices supplied for every vertex
+ * @param vertex_partition_degree_offsets Output of get_vertex_partition_degree_offsets
+ * @return Tuple of the received majors and their sampled indices (one index per major)
+ */
+template <typename GraphViewType>
+std::tuple<rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<typename GraphViewType::edge_type>>
+shuffle_sampled_indices_to_edge_partitions(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  rmm::device_uvector<typename GraphViewType::vertex_type>&& vertices,
+  rmm::device_uvector<typename GraphViewType::edge_type>&& minor_map,
+  typename GraphViewType::edge_type indices_per_major,
+  const rmm::device_uvector<typename GraphViewType::edge_type>& vertex_partition_degree_offsets);
+
+/**
+ * @brief Send active majors to the gpus storing at least one of their edges
+ *
+ * Used when the full adjacency lists are needed: a vertex is sent only to the gpus in the column
+ * communicator with a non-empty slice of its adjacency list.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object (multi-GPU only).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param vertices Device vector of vertices in the local vertex partition
+ * @param vertex_partition_degree_offsets Output of get_vertex_partition_degree_offsets
+ * @return Sorted device vector of the active majors to be processed by current gpu
+ */
+template <typename GraphViewType>
+rmm::device_uvector<typename GraphViewType::vertex_type> shuffle_active_majors_to_edge_partitions(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  rmm::device_uvector<typename GraphViewType::vertex_type>&& vertices,
+  const rmm::device_uvector<typename GraphViewType::edge_type>& vertex_partition_degree_offsets);
 
 /**
  * @brief Gather specified edges present on the current gpu
@@ -174,6 +227,30 @@ gather_one_hop_edgelist(
   GraphViewType const& graph_view,
   const rmm::device_uvector<typename GraphViewType::vertex_type>& active_majors);
 
+/**
+ * @brief Randomly select neighbor indices for every major
+ *
+ * For each major, generate @p indices_per_major indices in [0, out_degree). Sampling without
+ * replacement uses Floyd's algorithm; if the degree does not exceed @p indices_per_major every
+ * neighbor is selected and the remaining slots are set to -1 (dropped by gather_local_edges).
+ *
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param out_degrees Device vector of (global) out degrees of the majors, all must be non-zero
+ * @param indices_per_major Number of indices to generate for every major
+ * @param with_replacement If true, sample with replacement, otherwise without
+ * @param seed Seed for the random number generator
+ * @return Device vector of size out_degrees.size() * indices_per_major holding the selected
+ * neighbor indices of each major in consecutive blocks
+ */
+template <typename edge_t>
+rmm::device_uvector<edge_t> sample_nbr_index(raft::handle_t const& handle,
+                                             rmm::device_uvector<edge_t> const& out_degrees,
+                                             edge_t indices_per_major,
+                                             bool with_replacement,
+                                             uint64_t seed);
+
 template <typename vertex_t, typename edge_t, typename weight_t>
 std::tuple<rmm::device_uvector<vertex_t>,
            rmm::device_uvector<vertex_t>,
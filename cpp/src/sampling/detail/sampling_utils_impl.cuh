@@ -19,9 +19,11 @@
 #include <cugraph/detail/decompress_edge_partition.cuh>
 #include <cugraph/edge_partition_device_view.cuh>
 #include <cugraph/partition_manager.hpp>
+#include <cugraph/utilities/dataframe_buffer.cuh>
 #include <cugraph/utilities/device_comm.hpp>
 #include <cugraph/utilities/device_functors.cuh>
 #include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
 
 #include <raft/handle.hpp>
 
@@ -36,6 +38,7 @@
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/memory.h>
 #include <thrust/optional.h>
+#include <thrust/random.h>
 #include <thrust/reduce.h>
 #include <thrust/remove.h>
 #include <thrust/scan.h>
@@ -192,102 +195,205 @@ get_global_degree_information(raft::handle_t const& handle, GraphViewType const&
   }
 }
 
-template <typename vertex_t>
-rmm::device_uvector<vertex_t> allgather_active_majors(raft::handle_t const& handle,
-                                                      rmm::device_uvector<vertex_t>&& d_in)
+template <typename GraphViewType>
+rmm::device_uvector<typename GraphViewType::edge_type> get_vertex_partition_degree_offsets(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  const rmm::device_uvector<typename GraphViewType::edge_type>& global_degree_offsets,
+  const rmm::device_uvector<typename GraphViewType::edge_type>& global_out_degrees)
 {
-  auto const& col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
-  size_t source_count  = d_in.size();
-
-  auto external_source_counts =
-    cugraph::host_scalar_allgather(col_comm, source_count, handle.get_stream());
-
-  auto total_external_source_count =
-    std::accumulate(external_source_counts.begin(), external_source_counts.end(), size_t{0});
-  std::vector<size_t> displacements(external_source_counts.size(), size_t{0});
-  std::exclusive_scan(
-    external_source_counts.begin(), external_source_counts.end(), displacements.begin(), size_t{0});
-
-  rmm::device_uvector<vertex_t> active_majors(total_external_source_count, handle.get_stream());
-
-  // Get the sources other gpus on the same row are working on
-  // FIXME : replace with device_bcast for better scaling
-  device_allgatherv(col_comm,
-                    d_in.data(),
-                    active_majors.data(),
-                    external_source_counts,
-                    displacements,
-                    handle.get_stream());
-  thrust::sort(handle.get_thrust_policy(), active_majors.begin(), active_majors.end());
+  using edge_t = typename GraphViewType::edge_type;
 
-  return active_majors;
+  auto num_local_vertices = static_cast<size_t>(graph_view.local_vertex_partition_range_size());
+
+  int col_comm_size{1};
+  size_t own_partition_displacement{0};
+  rmm::device_uvector<edge_t> rx_degree_offsets(size_t{0}, handle.get_stream());
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& col_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+    col_comm_size            = col_comm.get_size();
+    auto const col_comm_rank = col_comm.get_rank();
+
+    // local edge partition i covers the majors owned by rank i of the column communicator, send
+    // the degree offsets of each partition to the owner of its majors
+    std::vector<size_t> tx_counts(col_comm_size);
+    for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+      tx_counts[i] = static_cast<size_t>(graph_view.local_edge_partition_src_range_size(i));
+      if (i < static_cast<size_t>(col_comm_rank)) { own_partition_displacement += tx_counts[i]; }
+    }
+
+    std::tie(rx_degree_offsets, std::ignore) =
+      shuffle_values(col_comm, global_degree_offsets.begin(), tx_counts, handle.get_stream());
+  }
+
+  rmm::device_uvector<edge_t> vertex_partition_degree_offsets(
+    num_local_vertices * (col_comm_size + 1), handle.get_stream());
+  thrust::tabulate(
+    handle.get_thrust_policy(),
+    vertex_partition_degree_offsets.begin(),
+    vertex_partition_degree_offsets.end(),
+    [rx_degree_offsets = GraphViewType::is_multi_gpu ? rx_degree_offsets.data()
+                                                     : global_degree_offsets.data(),
+     global_out_degrees = global_out_degrees.data() + own_partition_displacement,
+     num_local_vertices,
+     col_comm_size] __device__(size_t i) {
+      auto v = i / (col_comm_size + 1);
+      auto r = static_cast<int>(i % (col_comm_size + 1));
+      return r < col_comm_size ? rx_degree_offsets[r * num_local_vertices + v]
+                               : global_out_degrees[v];
+    });
+
+  return vertex_partition_degree_offsets;
 }
 
 template <typename GraphViewType>
-rmm::device_uvector<typename GraphViewType::edge_type> get_active_major_global_degrees(
+rmm::device_uvector<typename GraphViewType::edge_type> get_vertex_partition_global_degrees(
   raft::handle_t const& handle,
   GraphViewType const& graph_view,
-  const rmm::device_uvector<typename GraphViewType::vertex_type>& active_majors,
-  const rmm::device_uvector<typename GraphViewType::edge_type>& global_out_degrees)
+  const rmm::device_uvector<typename GraphViewType::vertex_type>& vertices,
+  const rmm::device_uvector<typename GraphViewType::edge_type>& vertex_partition_degree_offsets)
 {
-  using vertex_t    = typename GraphViewType::vertex_type;
-  using edge_t      = typename GraphViewType::edge_type;
-  using partition_t = edge_partition_device_view_t<typename GraphViewType::vertex_type,
-                                                   typename GraphViewType::edge_type,
-                                                   typename GraphViewType::weight_type,
-                                                   GraphViewType::is_multi_gpu>;
-  rmm::device_uvector<edge_t> active_major_degrees(active_majors.size(), handle.get_stream());
+  using edge_t = typename GraphViewType::edge_type;
 
-  std::vector<vertex_t> id_begin;
-  std::vector<vertex_t> id_end;
-  std::vector<vertex_t> count_offsets;
-  id_begin.reserve(graph_view.number_of_local_edge_partitions());
-  id_end.reserve(graph_view.number_of_local_edge_partitions());
-  count_offsets.reserve(graph_view.number_of_local_edge_partitions());
-  vertex_t counter{0};
-  for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
-    auto edge_partition = partition_t(graph_view.local_edge_partition_view(i));
-    // Starting vertex ids of each partition
-    id_begin.push_back(edge_partition.major_range_first());
-    id_end.push_back(edge_partition.major_range_last());
-    count_offsets.push_back(counter);
-    counter += edge_partition.major_range_size();
+  int col_comm_size{1};
+  if constexpr (GraphViewType::is_multi_gpu) {
+    col_comm_size =
+      handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name()).get_size();
   }
-  rmm::device_uvector<vertex_t> vertex_id_begin(id_begin.size(), handle.get_stream());
-  rmm::device_uvector<vertex_t> vertex_id_end(id_end.size(), handle.get_stream());
-  rmm::device_uvector<vertex_t> vertex_count_offsets(count_offsets.size(), handle.get_stream());
-  raft::update_device(
-    vertex_id_begin.data(), id_begin.data(), id_begin.size(), handle.get_stream());
-  raft::update_device(vertex_id_end.data(), id_end.data(), id_end.size(), handle.get_stream());
-  raft::update_device(
-    vertex_count_offsets.data(), count_offsets.data(), count_offsets.size(), handle.get_stream());
 
+  rmm::device_uvector<edge_t> degrees(vertices.size(), handle.get_stream());
   thrust::transform(handle.get_thrust_policy(),
-                    active_majors.begin(),
-                    active_majors.end(),
-                    active_major_degrees.begin(),
-                    [id_begin             = vertex_id_begin.data(),
-                     id_end               = vertex_id_end.data(),
-                     global_out_degrees   = global_out_degrees.data(),
-                     vertex_count_offsets = vertex_count_offsets.data(),
-                     count                = vertex_id_end.size()] __device__(auto v) {
-                      // Find which partition id did the vertex belong to
-                      auto partition_id = thrust::distance(
-                        id_end, thrust::upper_bound(thrust::seq, id_end, id_end + count, v));
-                      // starting position of the segment within global_degree_offset
-                      // where the information for partition (partition_id) starts
-                      //  vertex_count_offsets[partition_id]
-                      // The relative location of offset information for vertex id v within
-                      // the segment
-                      //  v - id_end[partition_id]
-                      auto location_in_segment = v - id_begin[partition_id];
-                      // read location of global_degree_offset needs to take into account the
-                      // partition offsets because it is a concatenation of all the offsets
-                      // across all partitions
-                      auto location = location_in_segment + vertex_count_offsets[partition_id];
-                      return global_out_degrees[location];
+                    vertices.begin(),
+                    vertices.end(),
+                    degrees.begin(),
+                    [offsets               = vertex_partition_degree_offsets.data(),
+                     vertex_partition_first = graph_view.local_vertex_partition_range_first(),
+                     col_comm_size] __device__(auto v) {
+                      return offsets[static_cast<size_t>(v - vertex_partition_first) *
+                                       (col_comm_size + 1) +
+                                     col_comm_size];
                     });
-  return active_major_degrees;
+
+  return degrees;
+}
+
+template <typename GraphViewType>
+std::tuple<rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<typename GraphViewType::edge_type>>
+shuffle_sampled_indices_to_edge_partitions(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  rmm::device_uvector<typename GraphViewType::vertex_type>&& vertices,
+  rmm::device_uvector<typename GraphViewType::edge_type>&& minor_map,
+  typename GraphViewType::edge_type indices_per_major,
+  const rmm::device_uvector<typename GraphViewType::edge_type>& vertex_partition_degree_offsets)
+{
+  static_assert(GraphViewType::is_multi_gpu);
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  auto& col_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+  auto const col_comm_size = col_comm.get_size();
+
+  rmm::device_uvector<vertex_t> majors(minor_map.size(), handle.get_stream());
+  thrust::tabulate(handle.get_thrust_policy(),
+                   majors.begin(),
+                   majors.end(),
+                   [vertices = vertices.data(), indices_per_major] __device__(size_t i) {
+                     return vertices[i / indices_per_major];
+                   });
+  vertices.resize(0, handle.get_stream());
+  vertices.shrink_to_fit(handle.get_stream());
+
+  auto pair_first =
+    thrust::make_zip_iterator(thrust::make_tuple(majors.begin(), minor_map.begin()));
+  auto num_valid_pairs = static_cast<size_t>(thrust::distance(
+    pair_first,
+    thrust::remove_if(handle.get_thrust_policy(),
+                      pair_first,
+                      pair_first + majors.size(),
+                      [] __device__(auto pair) { return thrust::get<1>(pair) < 0; })));
+  majors.resize(num_valid_pairs, handle.get_stream());
+  minor_map.resize(num_valid_pairs, handle.get_stream());
+
+  // send every sampled index only to the GPU (in the column communicator) storing the edge
+  auto rx_pairs = allocate_dataframe_buffer<thrust::tuple<vertex_t, edge_t>>(size_t{0},
+                                                                              handle.get_stream());
+  std::tie(rx_pairs, std::ignore) = groupby_gpu_id_and_shuffle_values(
+    col_comm,
+    pair_first,
+    pair_first + num_valid_pairs,
+    [offsets                = vertex_partition_degree_offsets.data(),
+     vertex_partition_first = graph_view.local_vertex_partition_range_first(),
+     col_comm_size] __device__(auto pair) {
+      auto row =
+        offsets + static_cast<size_t>(thrust::get<0>(pair) - vertex_partition_first) *
+                    (col_comm_size + 1);
+      return static_cast<int>(thrust::distance(
+        row + 1,
+        thrust::upper_bound(thrust::seq, row + 1, row + col_comm_size, thrust::get<1>(pair))));
+    },
+    handle.get_stream());
+
+  return std::make_tuple(std::move(std::get<0>(rx_pairs)), std::move(std::get<1>(rx_pairs)));
+}
+
+template <typename GraphViewType>
+rmm::device_uvector<typename GraphViewType::vertex_type> shuffle_active_majors_to_edge_partitions(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  rmm::device_uvector<typename GraphViewType::vertex_type>&& vertices,
+  const rmm::device_uvector<typename GraphViewType::edge_type>& vertex_partition_degree_offsets)
+{
+  static_assert(GraphViewType::is_multi_gpu);
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto& col_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+  auto const col_comm_size = col_comm.get_size();
+
+  // (vertex, rank) pairs for every rank in the column communicator holding at least one edge
+  rmm::device_uvector<vertex_t> tx_vertices(vertices.size() * col_comm_size, handle.get_stream());
+  rmm::device_uvector<int> tx_ranks(tx_vertices.size(), handle.get_stream());
+  auto pair_first =
+    thrust::make_zip_iterator(thrust::make_tuple(tx_vertices.begin(), tx_ranks.begin()));
+  thrust::tabulate(handle.get_thrust_policy(),
+                   pair_first,
+                   pair_first + tx_vertices.size(),
+                   [vertices = vertices.data(), col_comm_size] __device__(size_t i) {
+                     return thrust::make_tuple(vertices[i / col_comm_size],
+                                               static_cast<int>(i % col_comm_size));
+                   });
+  vertices.resize(0, handle.get_stream());
+  vertices.shrink_to_fit(handle.get_stream());
+
+  auto num_pairs = static_cast<size_t>(thrust::distance(
+    pair_first,
+    thrust::remove_if(handle.get_thrust_policy(),
+                      pair_first,
+                      pair_first + tx_vertices.size(),
+                      [offsets                = vertex_partition_degree_offsets.data(),
+                       vertex_partition_first = graph_view.local_vertex_partition_range_first(),
+                       col_comm_size] __device__(auto pair) {
+                        auto row = offsets + static_cast<size_t>(thrust::get<0>(pair) -
+                                                                 vertex_partition_first) *
+                                               (col_comm_size + 1);
+                        auto r   = thrust::get<1>(pair);
+                        return row[r + 1] == row[r];
+                      })));
+
+  auto rx_pairs =
+    allocate_dataframe_buffer<thrust::tuple<vertex_t, int>>(size_t{0}, handle.get_stream());
+  std::tie(rx_pairs, std::ignore) = groupby_gpu_id_and_shuffle_values(
+    col_comm,
+    pair_first,
+    pair_first + num_pairs,
+    [] __device__(auto pair) { return thrust::get<1>(pair); },
+    handle.get_stream());
+
+  auto active_majors = std::move(std::get<0>(rx_pairs));
+  thrust::sort(handle.get_thrust_policy(), active_majors.begin(), active_majors.end());
+
+  return active_majors;
 }
 
 template <typename GraphViewType>
@@ -849,6 +955,72 @@ gather_one_hop_edgelist(
   return std::make_tuple(std::move(majors), std::move(minors), std::move(weights));
 }
 
+template <typename edge_t>
+struct sample_nbr_index_t {
+  edge_t const* out_degrees{nullptr};
+  edge_t* indices{nullptr};
+  edge_t indices_per_major{0};
+  bool with_replacement{true};
+  uint64_t seed{0};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto degree = out_degrees[i];
+    auto output = indices + i * indices_per_major;
+
+    thrust::default_random_engine rng(seed);
+    rng.discard(i * indices_per_major);
+
+    if (with_replacement) {
+      thrust::uniform_int_distribution<edge_t> dist(edge_t{0}, degree - 1);
+      for (edge_t j = 0; j < indices_per_major; ++j) {
+        output[j] = dist(rng);
+      }
+    } else if (degree <= indices_per_major) {
+      // take every neighbor, pad the rest with an invalid index (filtered in gather_local_edges)
+      for (edge_t j = 0; j < indices_per_major; ++j) {
+        output[j] = j < degree ? j : edge_t{-1};
+      }
+    } else {
+      // Floyd's algorithm, O(indices_per_major^2) but fan-outs are small
+      for (edge_t j = 0; j < indices_per_major; ++j) {
+        auto r = degree - indices_per_major + j;
+        thrust::uniform_int_distribution<edge_t> dist(edge_t{0}, r);
+        auto candidate = dist(rng);
+        for (edge_t l = 0; l < j; ++l) {
+          if (output[l] == candidate) {
+            candidate = r;
+            break;
+          }
+        }
+        output[j] = candidate;
+      }
+    }
+  }
+};
+
+template <typename edge_t>
+rmm::device_uvector<edge_t> sample_nbr_index(raft::handle_t const& handle,
+                                             rmm::device_uvector<edge_t> const& out_degrees,
+                                             edge_t indices_per_major,
+                                             bool with_replacement,
+                                             uint64_t seed)
+{
+  rmm::device_uvector<edge_t> indices(out_degrees.size() * indices_per_major,
+                                      handle.get_stream());
+
+  thrust::for_each(handle.get_thrust_policy(),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(out_degrees.size()),
+                   sample_nbr_index_t<edge_t>{out_degrees.data(),
+                                              indices.data(),
+                                              indices_per_major,
+                                              with_replacement,
+                                              seed});
+
+  return indices;
+}
+
 template <typename vertex_t, typename edge_t, typename weight_t>
 std::tuple<rmm::device_uvector<vertex_t>,
            rmm::device_uvector<vertex_t>,
@@ -46,48 +46,6 @@ get_global_degree_information(
   raft::handle_t const& handle,
   graph_view_t<int64_t, int64_t, double, false, true> const& graph_view);
 
-template rmm::device_uvector<int32_t> allgather_active_majors(raft::handle_t const& handle,
-                                                              rmm::device_uvector<int32_t>&& d_in);
-
-template rmm::device_uvector<int64_t> allgather_active_majors(raft::handle_t const& handle,
-                                                              rmm::device_uvector<int64_t>&& d_in);
-
-template rmm::device_uvector<int32_t> get_active_major_global_degrees(
-  raft::handle_t const& handle,
-  graph_view_t<int32_t, int32_t, float, false, true> const& graph_view,
-  const rmm::device_uvector<int32_t>& active_majors,
-  const rmm::device_uvector<int32_t>& global_out_degrees);
-
-template rmm::device_uvector<int32_t> get_active_major_global_degrees(
-  raft::handle_t const& handle,
-  graph_view_t<int32_t, int32_t, double, false, true> const& graph_view,
-  const rmm::device_uvector<int32_t>& active_majors,
-  const rmm::device_uvector<int32_t>& global_out_degrees);
-
-template rmm::device_uvector<int64_t> get_active_major_global_degrees(
-  raft::handle_t const& handle,
-  graph_view_t<int32_t, int64_t, float, false, true> const& graph_view,
-  const rmm::device_uvector<int32_t>& active_majors,
-  const rmm::device_uvector<int64_t>& global_out_degrees);
-
-template rmm::device_uvector<int64_t> get_active_major_global_degrees(
-  raft::handle_t const& handle,
-  graph_view_t<int32_t, int64_t, double, false, true> const& graph_view,
-  const rmm::device_uvector<int32_t>& active_majors,
-  const rmm::device_uvector<int64_t>& global_out_degrees);
-
-template rmm::device_uvector<int64_t> get_active_major_global_degrees(
-  raft::handle_t const& handle,
-  graph_view_t<int64_t, int64_t, float, false, true> const& graph_view,
-  const rmm::device_uvector<int64_t>& active_majors,
-  const rmm::device_uvector<int64_t>& global_out_degrees);
-
-template rmm::device_uvector<int64_t> get_active_major_global_degrees(
-  raft::handle_t const& handle,
-  graph_view_t<int64_t, int64_t, double, false, true> const& graph_view,
-  const rmm::device_uvector<int64_t>& active_majors,
-  const rmm::device_uvector<int64_t>& global_out_degrees);
-
 template std::tuple<
   rmm::device_uvector<edge_partition_device_view_t<int32_t, int32_t, float, true>>,
   rmm::device_uvector<int32_t>,
@@ -142,6 +100,168 @@ template std::tuple<
 partition_information(raft::handle_t const& handle,
                       graph_view_t<int64_t, int64_t, double, false, true> const& graph_view);
 
+template rmm::device_uvector<int32_t> get_vertex_partition_degree_offsets(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, true> const& graph_view,
+  const rmm::device_uvector<int32_t>& global_degree_offsets,
+  const rmm::device_uvector<int32_t>& global_out_degrees);
+
+template rmm::device_uvector<int32_t> get_vertex_partition_degree_offsets(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, true> const& graph_view,
+  const rmm::device_uvector<int32_t>& global_degree_offsets,
+  const rmm::device_uvector<int32_t>& global_out_degrees);
+
+template rmm::device_uvector<int64_t> get_vertex_partition_degree_offsets(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, true> const& graph_view,
+  const rmm::device_uvector<int64_t>& global_degree_offsets,
+  const rmm::device_uvector<int64_t>& global_out_degrees);
+
+template rmm::device_uvector<int64_t> get_vertex_partition_degree_offsets(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, true> const& graph_view,
+  const rmm::device_uvector<int64_t>& global_degree_offsets,
+  const rmm::device_uvector<int64_t>& global_out_degrees);
+
+template rmm::device_uvector<int64_t> get_vertex_partition_degree_offsets(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, true> const& graph_view,
+  const rmm::device_uvector<int64_t>& global_degree_offsets,
+  const rmm::device_uvector<int64_t>& global_out_degrees);
+
+template rmm::device_uvector<int64_t> get_vertex_partition_degree_offsets(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, true> const& graph_view,
+  const rmm::device_uvector<int64_t>& global_degree_offsets,
+  const rmm::device_uvector<int64_t>& global_out_degrees);
+
+template rmm::device_uvector<int32_t> get_vertex_partition_global_degrees(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, true> const& graph_view,
+  const rmm::device_uvector<int32_t>& vertices,
+  const rmm::device_uvector<int32_t>& vertex_partition_degree_offsets);
+
+template rmm::device_uvector<int32_t> get_vertex_partition_global_degrees(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, true> const& graph_view,
+  const rmm::device_uvector<int32_t>& vertices,
+  const rmm::device_uvector<int32_t>& vertex_partition_degree_offsets);
+
+template rmm::device_uvector<int64_t> get_vertex_partition_global_degrees(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, true> const& graph_view,
+  const rmm::device_uvector<int32_t>& vertices,
+  const rmm::device_uvector<int64_t>& vertex_partition_degree_offsets);
+
+template rmm::device_uvector<int64_t> get_vertex_partition_global_degrees(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, true> const& graph_view,
+  const rmm::device_uvector<int32_t>& vertices,
+  const rmm::device_uvector<int64_t>& vertex_partition_degree_offsets);
+
+template rmm::device_uvector<int64_t> get_vertex_partition_global_degrees(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, true> const& graph_view,
+  const rmm::device_uvector<int64_t>& vertices,
+  const rmm::device_uvector<int64_t>& vertex_partition_degree_offsets);
+
+template rmm::device_uvector<int64_t> get_vertex_partition_global_degrees(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, true> const& graph_view,
+  const rmm::device_uvector<int64_t>& vertices,
+  const rmm::device_uvector<int64_t>& vertex_partition_degree_offsets);
+
+template std::tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<int32_t>>
+shuffle_sampled_indices_to_edge_partitions(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, true> const& graph_view,
+  rmm::device_uvector<int32_t>&& vertices,
+  rmm::device_uvector<int32_t>&& minor_map,
+  int32_t indices_per_major,
+  const rmm::device_uvector<int32_t>& vertex_partition_degree_offsets);
+
+template std::tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<int32_t>>
+shuffle_sampled_indices_to_edge_partitions(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, true> const& graph_view,
+  rmm::device_uvector<int32_t>&& vertices,
+  rmm::device_uvector<int32_t>&& minor_map,
+  int32_t indices_per_major,
+  const rmm::device_uvector<int32_t>& vertex_partition_degree_offsets);
+
+template std::tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<int64_t>>
+shuffle_sampled_indices_to_edge_partitions(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, true> const& graph_view,
+  rmm::device_uvector<int32_t>&& vertices,
+  rmm::device_uvector<int64_t>&& minor_map,
+  int64_t indices_per_major,
+  const rmm::device_uvector<int64_t>& vertex_partition_degree_offsets);
+
+template std::tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<int64_t>>
+shuffle_sampled_indices_to_edge_partitions(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, true> const& graph_view,
+  rmm::device_uvector<int32_t>&& vertices,
+  rmm::device_uvector<int64_t>&& minor_map,
+  int64_t indices_per_major,
+  const rmm::device_uvector<int64_t>& vertex_partition_degree_offsets);
+
+template std::tuple<rmm::device_uvector<int64_t>, rmm::device_uvector<int64_t>>
+shuffle_sampled_indices_to_edge_partitions(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, true> const& graph_view,
+  rmm::device_uvector<int64_t>&& vertices,
+  rmm::device_uvector<int64_t>&& minor_map,
+  int64_t indices_per_major,
+  const rmm::device_uvector<int64_t>& vertex_partition_degree_offsets);
+
+template std::tuple<rmm::device_uvector<int64_t>, rmm::device_uvector<int64_t>>
+shuffle_sampled_indices_to_edge_partitions(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, true> const& graph_view,
+  rmm::device_uvector<int64_t>&& vertices,
+  rmm::device_uvector<int64_t>&& minor_map,
+  int64_t indices_per_major,
+  const rmm::device_uvector<int64_t>& vertex_partition_degree_offsets);
+
+template rmm::device_uvector<int32_t> shuffle_active_majors_to_edge_partitions(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, true> const& graph_view,
+  rmm::device_uvector<int32_t>&& vertices,
+  const rmm::device_uvector<int32_t>& vertex_partition_degree_offsets);
+
+template rmm::device_uvector<int32_t> shuffle_active_majors_to_edge_partitions(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, true> const& graph_view,
+  rmm::device_uvector<int32_t>&& vertices,
+  const rmm::device_uvector<int32_t>& vertex_partition_degree_offsets);
+
+template rmm::device_uvector<int32_t> shuffle_active_majors_to_edge_partitions(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, true> const& graph_view,
+  rmm::device_uvector<int32_t>&& vertices,
+  const rmm::device_uvector<int64_t>& vertex_partition_degree_offsets);
+
+template rmm::device_uvector<int32_t> shuffle_active_majors_to_edge_partitions(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, true> const& graph_view,
+  rmm::device_uvector<int32_t>&& vertices,
+  const rmm::device_uvector<int64_t>& vertex_partition_degree_offsets);
+
+template rmm::device_uvector<int64_t> shuffle_active_majors_to_edge_partitions(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, true> const& graph_view,
+  rmm::device_uvector<int64_t>&& vertices,
+  const rmm::device_uvector<int64_t>& vertex_partition_degree_offsets);
+
+template rmm::device_uvector<int64_t> shuffle_active_majors_to_edge_partitions(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, true> const& graph_view,
+  rmm::device_uvector<int64_t>&& vertices,
+  const rmm::device_uvector<int64_t>& vertex_partition_degree_offsets);
+
 template std::tuple<rmm::device_uvector<int32_t>,
                     rmm::device_uvector<int32_t>,
                     std::optional<rmm::device_uvector<float>>>
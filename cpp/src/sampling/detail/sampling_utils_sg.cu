@@ -49,42 +49,78 @@ get_global_degree_information(
   raft::handle_t const& handle,
   graph_view_t<int64_t, int64_t, double, false, false> const& graph_view);
 
-template rmm::device_uvector<int32_t> get_active_major_global_degrees(
+template rmm::device_uvector<int32_t> get_vertex_partition_degree_offsets(
   raft::handle_t const& handle,
   graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
-  const rmm::device_uvector<int32_t>& active_majors,
+  const rmm::device_uvector<int32_t>& global_degree_offsets,
   const rmm::device_uvector<int32_t>& global_out_degrees);
 
-template rmm::device_uvector<int32_t> get_active_major_global_degrees(
+template rmm::device_uvector<int32_t> get_vertex_partition_degree_offsets(
   raft::handle_t const& handle,
   graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
-  const rmm::device_uvector<int32_t>& active_majors,
+  const rmm::device_uvector<int32_t>& global_degree_offsets,
   const rmm::device_uvector<int32_t>& global_out_degrees);
 
-template rmm::device_uvector<int64_t> get_active_major_global_degrees(
+template rmm::device_uvector<int64_t> get_vertex_partition_degree_offsets(
   raft::handle_t const& handle,
   graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
-  const rmm::device_uvector<int32_t>& active_majors,
+  const rmm::device_uvector<int64_t>& global_degree_offsets,
   const rmm::device_uvector<int64_t>& global_out_degrees);
 
-template rmm::device_uvector<int64_t> get_active_major_global_degrees(
+template rmm::device_uvector<int64_t> get_vertex_partition_degree_offsets(
   raft::handle_t const& handle,
   graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
-  const rmm::device_uvector<int32_t>& active_majors,
+  const rmm::device_uvector<int64_t>& global_degree_offsets,
   const rmm::device_uvector<int64_t>& global_out_degrees);
 
-template rmm::device_uvector<int64_t> get_active_major_global_degrees(
+template rmm::device_uvector<int64_t> get_vertex_partition_degree_offsets(
   raft::handle_t const& handle,
   graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
-  const rmm::device_uvector<int64_t>& active_majors,
+  const rmm::device_uvector<int64_t>& global_degree_offsets,
   const rmm::device_uvector<int64_t>& global_out_degrees);
 
-template rmm::device_uvector<int64_t> get_active_major_global_degrees(
+template rmm::device_uvector<int64_t> get_vertex_partition_degree_offsets(
   raft::handle_t const& handle,
   graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
-  const rmm::device_uvector<int64_t>& active_majors,
+  const rmm::device_uvector<int64_t>& global_degree_offsets,
   const rmm::device_uvector<int64_t>& global_out_degrees);
 
+template rmm::device_uvector<int32_t> get_vertex_partition_global_degrees(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
+  const rmm::device_uvector<int32_t>& vertices,
+  const rmm::device_uvector<int32_t>& vertex_partition_degree_offsets);
+
+template rmm::device_uvector<int32_t> get_vertex_partition_global_degrees(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
+  const rmm::device_uvector<int32_t>& vertices,
+  const rmm::device_uvector<int32_t>& vertex_partition_degree_offsets);
+
+template rmm::device_uvector<int64_t> get_vertex_partition_global_degrees(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
+  const rmm::device_uvector<int32_t>& vertices,
+  const rmm::device_uvector<int64_t>& vertex_partition_degree_offsets);
+
+template rmm::device_uvector<int64_t> get_vertex_partition_global_degrees(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
+  const rmm::device_uvector<int32_t>& vertices,
+  const rmm::device_uvector<int64_t>& vertex_partition_degree_offsets);
+
+template rmm::device_uvector<int64_t> get_vertex_partition_global_degrees(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
+  const rmm::device_uvector<int64_t>& vertices,
+  const rmm::device_uvector<int64_t>& vertex_partition_degree_offsets);
+
+template rmm::device_uvector<int64_t> get_vertex_partition_global_degrees(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
+  const rmm::device_uvector<int64_t>& vertices,
+  const rmm::device_uvector<int64_t>& vertex_partition_degree_offsets);
+
 template std::tuple<rmm::device_uvector<int32_t>,
                     rmm::device_uvector<int32_t>,
                     std::optional<rmm::device_uvector<float>>>
@@ -188,6 +224,20 @@ gather_one_hop_edgelist(raft::handle_t const& handle,
                         rmm::device_uvector<int64_t> const& active_majors);
 
 //  Only need to build once, not separately for SG/MG
+template rmm::device_uvector<int32_t> sample_nbr_index(
+  raft::handle_t const& handle,
+  rmm::device_uvector<int32_t> const& out_degrees,
+  int32_t indices_per_major,
+  bool with_replacement,
+  uint64_t seed);
+
+template rmm::device_uvector<int64_t> sample_nbr_index(
+  raft::handle_t const& handle,
+  rmm::device_uvector<int64_t> const& out_degrees,
+  int64_t indices_per_major,
+  bool with_replacement,
+  uint64_t seed);
+
 template std::tuple<rmm::device_uvector<int32_t>,
                     rmm::device_uvector<int32_t>,
                     rmm::device_uvector<float>,
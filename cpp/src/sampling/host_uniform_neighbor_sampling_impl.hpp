@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <raft/span.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <random>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+// splitmix64, cheap to seed, so every frontier element can use its own generator and the samples do
+// not depend on the number of threads
+class host_sampling_rng_t {
+ public:
+  using result_type = uint64_t;
+
+  explicit host_sampling_rng_t(uint64_t seed) : state_(seed) {}
+
+  static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+  static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+  result_type operator()()
+  {
+    auto z = (state_ += uint64_t{0x9e3779b97f4a7c15});
+    z      = (z ^ (z >> 30)) * uint64_t{0xbf58476d1ce4e5b9};
+    z      = (z ^ (z >> 27)) * uint64_t{0x94d049bb133111eb};
+    return z ^ (z >> 31);
+  }
+
+ private:
+  uint64_t state_{0};
+};
+
+// Append the neighbor indices (in [0, degree)) sampled for one frontier vertex to @p output.
+// Without replacement, every neighbor is taken if degree <= fan_out, otherwise Floyd's algorithm
+// (O(fan_out^2)) is used for small fan-outs and reservoir sampling (O(degree)) for the others.
+template <typename edge_t>
+void host_sample_nbr_index(edge_t degree,
+                           edge_t fan_out,
+                           bool with_replacement,
+                           host_sampling_rng_t& rng,
+                           std::vector<edge_t>& output)
+{
+  auto first = output.size();
+  if (with_replacement) {
+    std::uniform_int_distribution<edge_t> dist(edge_t{0}, degree - 1);
+    for (edge_t j = 0; j < fan_out; ++j) {
+      output.push_back(dist(rng));
+    }
+  } else if (degree <= fan_out) {
+    for (edge_t j = 0; j < degree; ++j) {
+      output.push_back(j);
+    }
+  } else if (static_cast<double>(fan_out) * static_cast<double>(fan_out) <=
+             static_cast<double>(degree)) {
+    for (edge_t j = 0; j < fan_out; ++j) {
+      auto r = degree - fan_out + j;
+      std::uniform_int_distribution<edge_t> dist(edge_t{0}, r);
+      auto candidate = dist(rng);
+      if (std::find(output.begin() + first, output.end(), candidate) != output.end()) {
+        candidate = r;
+      }
+      output.push_back(candidate);
+    }
+  } else {
+    for (edge_t j = 0; j < fan_out; ++j) {
+      output.push_back(j);
+    }
+    for (edge_t j = fan_out; j < degree; ++j) {
+      std::uniform_int_distribution<edge_t> dist(edge_t{0}, j);
+      auto r = dist(rng);
+      if (r < fan_out) { output[first + r] = j; }
+    }
+  }
+}
+
+// Same hops as the device implementation (see uniform_neighbor_sampling_impl.hpp): the sampled
+// destinations (with duplicates) form the next frontier. The frontier of each hop is split into
+// contiguous ranges over the threads and the per-thread outputs are concatenated in thread order.
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<std::vector<vertex_t>, std::vector<vertex_t>, std::vector<weight_t>, std::vector<edge_t>>
+host_uniform_nbr_sample(edge_t const* offsets,
+                        vertex_t const* indices,
+                        weight_t const* weights /* nullptr if unweighted */,
+                        std::vector<vertex_t>&& frontier,
+                        raft::host_span<int const> fan_out,
+                        bool with_replacement,
+                        uint64_t seed,
+                        size_t num_threads)
+{
+  auto run_on_threads = [num_threads](auto op) {
+    std::vector<std::thread> threads{};
+    threads.reserve(num_threads - 1);
+    for (size_t i = 1; i < num_threads; ++i) {
+      threads.emplace_back(op, i);
+    }
+    op(0);
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  };
+
+  std::vector<std::tuple<vertex_t, vertex_t, weight_t>> edges{};
+  std::vector<std::vector<std::tuple<vertex_t, vertex_t, weight_t>>> thread_edges(num_threads);
+  for (auto k_level : fan_out) {
+    auto sample = [&](size_t thread_idx) {
+      auto first   = (frontier.size() * thread_idx) / num_threads;
+      auto last    = (frontier.size() * (thread_idx + 1)) / num_threads;
+      auto& output = thread_edges[thread_idx];
+      output.clear();
+      std::vector<edge_t> nbr_indices{};
+      for (auto i = first; i < last; ++i) {
+        auto v      = frontier[i];
+        auto degree = offsets[v + 1] - offsets[v];
+        if (degree == edge_t{0}) { continue; }
+        nbr_indices.clear();
+        if (k_level > 0) {
+          host_sampling_rng_t rng(seed + i);
+          host_sample_nbr_index(
+            degree, static_cast<edge_t>(k_level), with_replacement, rng, nbr_indices);
+        } else {
+          for (edge_t j = 0; j < degree; ++j) {
+            nbr_indices.push_back(j);
+          }
+        }
+        for (auto j : nbr_indices) {
+          auto e = offsets[v] + j;
+          output.emplace_back(v, indices[e], weights != nullptr ? weights[e] : weight_t{1.0});
+        }
+      }
+    };
+    run_on_threads(sample);
+    seed += frontier.size();
+
+    frontier.clear();
+    for (auto const& output : thread_edges) {
+      edges.insert(edges.end(), output.begin(), output.end());
+      for (auto const& edge : output) {
+        frontier.push_back(std::get<1>(edge));
+      }
+    }
+  }
+
+  // count and remove duplicates (as count_and_remove_duplicates in the device implementation)
+
+  std::sort(edges.begin(), edges.end());
+  std::vector<vertex_t> srcs{};
+  std::vector<vertex_t> dsts{};
+  std::vector<weight_t> wgts{};
+  std::vector<edge_t> counts{};
+  for (size_t i = 0; i < edges.size();) {
+    auto j = i + 1;
+    while ((j < edges.size()) && (edges[j] == edges[i])) {
+      ++j;
+    }
+    srcs.push_back(std::get<0>(edges[i]));
+    dsts.push_back(std::get<1>(edges[i]));
+    wgts.push_back(std::get<2>(edges[i]));
+    counts.push_back(static_cast<edge_t>(j - i));
+    i = j;
+  }
+
+  return std::make_tuple(std::move(srcs), std::move(dsts), std::move(wgts), std::move(counts));
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<std::vector<vertex_t>, std::vector<vertex_t>, std::vector<weight_t>, std::vector<edge_t>>
+host_uniform_nbr_sample(raft::host_span<edge_t const> offsets,
+                        raft::host_span<vertex_t const> indices,
+                        std::optional<raft::host_span<weight_t const>> weights,
+                        raft::host_span<vertex_t const> starting_vertices,
+                        raft::host_span<int const> fan_out,
+                        bool with_replacement,
+                        uint64_t seed,
+                        size_t num_threads,
+                        bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(offsets.size() >= 1,
+                  "Invalid input arguments: offsets should have at least one element.");
+  CUGRAPH_EXPECTS(
+    offsets.size() - 1 <= static_cast<size_t>(std::numeric_limits<vertex_t>::max()),
+    "Invalid input arguments: the number of vertices does not fit in vertex_t.");
+  CUGRAPH_EXPECTS((offsets[0] == edge_t{0}) &&
+                    (static_cast<size_t>(offsets[offsets.size() - 1]) == indices.size()),
+                  "Invalid input arguments: offsets and indices do not form a valid CSR.");
+  CUGRAPH_EXPECTS(!weights || ((*weights).size() == indices.size()),
+                  "Invalid input arguments: (*weights).size() does not coincide with "
+                  "indices.size().");
+  CUGRAPH_EXPECTS(fan_out.size() > 0, "Invalid input argument: number of levels must be non-zero.");
+
+  auto const num_vertices = static_cast<vertex_t>(offsets.size() - 1);
+
+  if (do_expensive_check) {
+    CUGRAPH_EXPECTS(std::is_sorted(offsets.begin(), offsets.end()),
+                    "Invalid input arguments: offsets should be non-decreasing.");
+    CUGRAPH_EXPECTS(
+      std::all_of(indices.begin(),
+                  indices.end(),
+                  [num_vertices](auto v) { return is_valid_vertex(num_vertices, v); }),
+      "Invalid input arguments: indices have invalid vertex IDs.");
+  }
+  CUGRAPH_EXPECTS(
+    std::all_of(starting_vertices.begin(),
+                starting_vertices.end(),
+                [num_vertices](auto v) { return is_valid_vertex(num_vertices, v); }),
+    "Invalid input arguments: starting_vertices have invalid vertex IDs.");
+
+  if (num_threads == 0) {
+    num_threads = std::max(static_cast<size_t>(std::thread::hardware_concurrency()), size_t{1});
+  }
+
+  return detail::host_uniform_nbr_sample(
+    offsets.data(),
+    indices.data(),
+    weights ? (*weights).data() : nullptr,
+    std::vector<vertex_t>(starting_vertices.begin(), starting_vertices.end()),
+    fan_out,
+    with_replacement,
+    seed,
+    num_threads);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>,
+           rmm::device_uvector<edge_t>>
+host_uniform_nbr_sample(raft::handle_t const& handle,
+                        graph_view_t<vertex_t, edge_t, weight_t, false, false> const& graph_view,
+                        raft::device_span<vertex_t const> starting_vertices,
+                        raft::host_span<int const> fan_out,
+                        bool with_replacement,
+                        uint64_t seed,
+                        size_t num_threads,
+                        bool do_expensive_check)
+{
+  auto const num_vertices = graph_view.number_of_vertices();
+  auto const num_edges    = graph_view.number_of_edges();
+
+  auto edge_partition = graph_view.local_edge_partition_view();
+
+  std::vector<edge_t> h_offsets(num_vertices + 1);
+  std::vector<vertex_t> h_indices(num_edges);
+  std::vector<weight_t> h_weights(graph_view.is_weighted() ? num_edges : edge_t{0});
+  raft::update_host(
+    h_offsets.data(), edge_partition.offsets(), h_offsets.size(), handle.get_stream());
+  raft::update_host(
+    h_indices.data(), edge_partition.indices(), h_indices.size(), handle.get_stream());
+  if (graph_view.is_weighted()) {
+    raft::update_host(
+      h_weights.data(), *(edge_partition.weights()), h_weights.size(), handle.get_stream());
+  }
+  std::vector<vertex_t> h_starting_vertices(starting_vertices.size());
+  raft::update_host(h_starting_vertices.data(),
+                    starting_vertices.data(),
+                    h_starting_vertices.size(),
+                    handle.get_stream());
+  handle.sync_stream();
+
+  auto [h_srcs, h_dsts, h_wgts, h_counts] = host_uniform_nbr_sample(
+    raft::host_span<edge_t const>(h_offsets.data(), h_offsets.size()),
+    raft::host_span<vertex_t const>(h_indices.data(), h_indices.size()),
+    graph_view.is_weighted()
+      ? std::make_optional<raft::host_span<weight_t const>>(h_weights.data(), h_weights.size())
+      : std::nullopt,
+    raft::host_span<vertex_t const>(h_starting_vertices.data(), h_starting_vertices.size()),
+    fan_out,
+    with_replacement,
+    seed,
+    num_threads,
+    do_expensive_check);
+
+  rmm::device_uvector<vertex_t> srcs(h_srcs.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> dsts(h_dsts.size(), handle.get_stream());
+  rmm::device_uvector<weight_t> wgts(h_wgts.size(), handle.get_stream());
+  rmm::device_uvector<edge_t> counts(h_counts.size(), handle.get_stream());
+  raft::update_device(srcs.data(), h_srcs.data(), h_srcs.size(), handle.get_stream());
+  raft::update_device(dsts.data(), h_dsts.data(), h_dsts.size(), handle.get_stream());
+  raft::update_device(wgts.data(), h_wgts.data(), h_wgts.size(), handle.get_stream());
+  raft::update_device(counts.data(), h_counts.data(), h_counts.size(), handle.get_stream());
+  handle.sync_stream();
+
+  return std::make_tuple(std::move(srcs), std::move(dsts), std::move(wgts), std::move(counts));
+}
+
+}  // namespace cugraph
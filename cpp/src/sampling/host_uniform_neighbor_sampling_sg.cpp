@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sampling/host_uniform_neighbor_sampling_impl.hpp>
+
+namespace cugraph {
+
+// SG instantiation
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<float>,
+                    rmm::device_uvector<int32_t>>
+host_uniform_nbr_sample(raft::handle_t const& handle,
+                        graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
+                        raft::device_span<int32_t const> starting_vertices,
+                        raft::host_span<int const> fan_out,
+                        bool with_replacement,
+                        uint64_t seed,
+                        size_t num_threads,
+                        bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<float>,
+                    rmm::device_uvector<int64_t>>
+host_uniform_nbr_sample(raft::handle_t const& handle,
+                        graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
+                        raft::device_span<int32_t const> starting_vertices,
+                        raft::host_span<int const> fan_out,
+                        bool with_replacement,
+                        uint64_t seed,
+                        size_t num_threads,
+                        bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<float>,
+                    rmm::device_uvector<int64_t>>
+host_uniform_nbr_sample(raft::handle_t const& handle,
+                        graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
+                        raft::device_span<int64_t const> starting_vertices,
+                        raft::host_span<int const> fan_out,
+                        bool with_replacement,
+                        uint64_t seed,
+                        size_t num_threads,
+                        bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<double>,
+                    rmm::device_uvector<int32_t>>
+host_uniform_nbr_sample(raft::handle_t const& handle,
+                        graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
+                        raft::device_span<int32_t const> starting_vertices,
+                        raft::host_span<int const> fan_out,
+                        bool with_replacement,
+                        uint64_t seed,
+                        size_t num_threads,
+                        bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<double>,
+                    rmm::device_uvector<int64_t>>
+host_uniform_nbr_sample(raft::handle_t const& handle,
+                        graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
+                        raft::device_span<int32_t const> starting_vertices,
+                        raft::host_span<int const> fan_out,
+                        bool with_replacement,
+                        uint64_t seed,
+                        size_t num_threads,
+                        bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<double>,
+                    rmm::device_uvector<int64_t>>
+host_uniform_nbr_sample(raft::handle_t const& handle,
+                        graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
+                        raft::device_span<int64_t const> starting_vertices,
+                        raft::host_span<int const> fan_out,
+                        bool with_replacement,
+                        uint64_t seed,
+                        size_t num_threads,
+                        bool do_expensive_check);
+
+template std::tuple<std::vector<int32_t>,
+                    std::vector<int32_t>,
+                    std::vector<float>,
+                    std::vector<int32_t>>
+host_uniform_nbr_sample(raft::host_span<int32_t const> offsets,
+                        raft::host_span<int32_t const> indices,
+                        std::optional<raft::host_span<float const>> weights,
+                        raft::host_span<int32_t const> starting_vertices,
+                        raft::host_span<int const> fan_out,
+                        bool with_replacement,
+                        uint64_t seed,
+                        size_t num_threads,
+                        bool do_expensive_check);
+
+template std::tuple<std::vector<int32_t>,
+                    std::vector<int32_t>,
+                    std::vector<float>,
+                    std::vector<int64_t>>
+host_uniform_nbr_sample(raft::host_span<int64_t const> offsets,
+                        raft::host_span<int32_t const> indices,
+                        std::optional<raft::host_span<float const>> weights,
+                        raft::host_span<int32_t const> starting_vertices,
+                        raft::host_span<int const> fan_out,
+                        bool with_replacement,
+                        uint64_t seed,
+                        size_t num_threads,
+                        bool do_expensive_check);
+
+template std::tuple<std::vector<int64_t>,
+                    std::vector<int64_t>,
+                    std::vector<float>,
+                    std::vector<int64_t>>
+host_uniform_nbr_sample(raft::host_span<int64_t const> offsets,
+                        raft::host_span<int64_t const> indices,
+                        std::optional<raft::host_span<float const>> weights,
+                        raft::host_span<int64_t const> starting_vertices,
+                        raft::host_span<int const> fan_out,
+                        bool with_replacement,
+                        uint64_t seed,
+                        size_t num_threads,
+                        bool do_expensive_check);
+
+template std::tuple<std::vector<int32_t>,
+                    std::vector<int32_t>,
+                    std::vector<double>,
+                    std::vector<int32_t>>
+host_uniform_nbr_sample(raft::host_span<int32_t const> offsets,
+                        raft::host_span<int32_t const> indices,
+                        std::optional<raft::host_span<double const>> weights,
+                        raft::host_span<int32_t const> starting_vertices,
+                        raft::host_span<int const> fan_out,
+                        bool with_replacement,
+                        uint64_t seed,
+                        size_t num_threads,
+                        bool do_expensive_check);
+
+template std::tuple<std::vector<int32_t>,
+                    std::vector<int32_t>,
+                    std::vector<double>,
+                    std::vector<int64_t>>
+host_uniform_nbr_sample(raft::host_span<int64_t const> offsets,
+                        raft::host_span<int32_t const> indices,
+                        std::optional<raft::host_span<double const>> weights,
+                        raft::host_span<int32_t const> starting_vertices,
+                        raft::host_span<int const> fan_out,
+                        bool with_replacement,
+                        uint64_t seed,
+                        size_t num_threads,
+                        bool do_expensive_check);
+
+template std::tuple<std::vector<int64_t>,
+                    std::vector<int64_t>,
+                    std::vector<double>,
+                    std::vector<int64_t>>
+host_uniform_nbr_sample(raft::host_span<int64_t const> offsets,
+                        raft::host_span<int64_t const> indices,
+                        std::optional<raft::host_span<double const>> weights,
+                        raft::host_span<int64_t const> starting_vertices,
+                        raft::host_span<int const> fan_out,
+                        bool with_replacement,
+                        uint64_t seed,
+                        size_t num_threads,
+                        bool do_expensive_check);
+
+}  // namespace cugraph
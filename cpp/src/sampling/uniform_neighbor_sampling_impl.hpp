@@ -27,15 +27,12 @@
 
 #include <rmm/device_uvector.hpp>
 
-#ifndef NO_CUGRAPH_OPS
-#include <cugraph-ops/graph/sampling.hpp>
-#endif
-
 #include <thrust/optional.h>
 
 #include <algorithm>
 #include <limits>
 #include <numeric>
+#include <optional>
 #include <type_traits>
 #include <vector>
 
@@ -61,13 +58,6 @@ uniform_nbr_sample_impl(
   using edge_t   = typename graph_view_t::edge_type;
   using weight_t = typename graph_view_t::weight_type;
 
-#ifdef NO_CUGRAPH_OPS
-  CUGRAPH_FAIL(
-    "uniform_nbr_sampl_impl not supported in this configuration, built with NO_CUGRAPH_OPS");
-#else
-
-  namespace cugraph_ops = cugraph::ops::gnn::graph;
-
   CUGRAPH_EXPECTS(h_fan_out.size() > 0,
                   "Invalid input argument: number of levels must be non-zero.");
 
@@ -77,20 +67,25 @@ uniform_nbr_sample_impl(
     thrust::make_optional(rmm::device_uvector<weight_t>(0, handle.get_stream()));
 
   size_t level{0};
-  size_t row_comm_size{1};
+  size_t comm_size{1};
 
   if constexpr (graph_view_t::is_multi_gpu) {
-    auto& row_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
-    seed += row_comm.get_rank();
-    row_comm_size = row_comm.get_size();
+    auto& comm = handle.get_comms();
+    seed += comm.get_rank();
+    comm_size = comm.get_size();
   }
 
+  // Row v holds the offsets of vertex v's adjacency list slices on the GPUs of the column
+  // communicator. Computed once and reused for every hop, it lets the owner of a frontier vertex
+  // sample it and send each sampled index only to the GPU storing the selected edge.
+  auto vertex_partition_degree_offsets = get_vertex_partition_degree_offsets(
+    handle, graph_view, global_degree_offsets, global_out_degrees);
+
   for (auto&& k_level : h_fan_out) {
     // prep step for extracting out-degs(sources):
     if constexpr (graph_view_t::is_multi_gpu) {
       d_in = shuffle_int_vertices_by_gpu_id(
         handle, std::move(d_in), graph_view.vertex_partition_range_lasts());
-      d_in = allgather_active_majors(handle, std::move(d_in));
     }
 
     rmm::device_uvector<vertex_t> d_out_src(0, handle.get_stream());
@@ -99,38 +94,42 @@ uniform_nbr_sample_impl(
 
     if (k_level > 0) {
       // extract out-degs(sources):
-      auto&& d_out_degs =
-        get_active_major_global_degrees(handle, graph_view, d_in, global_out_degrees);
+      auto d_out_degs = get_vertex_partition_global_degrees(
+        handle, graph_view, d_in, vertex_partition_degree_offsets);
 
       // eliminate 0 degree vertices
       std::tie(d_in, d_out_degs) =
         cugraph::detail::filter_degree_0_vertices(handle, std::move(d_in), std::move(d_out_degs));
 
       // segmented-random-generation of indices:
-      rmm::device_uvector<edge_t> d_rnd_indices(d_in.size() * k_level, handle.get_stream());
-
-      raft::random::RngState rng_state(seed);
-      seed += d_rnd_indices.size() * row_comm_size;
-
-      if (d_rnd_indices.size() > 0) {
-        // FIXME: This cugraph_ops function does not handle 0 inputs properly
-        cugraph_ops::get_sampling_index(d_rnd_indices.data(),
-                                        rng_state,
-                                        d_out_degs.data(),
-                                        static_cast<edge_t>(d_out_degs.size()),
-                                        static_cast<int32_t>(k_level),
-                                        with_replacement,
-                                        handle.get_stream());
+      auto d_rnd_indices = sample_nbr_index(
+        handle, d_out_degs, static_cast<edge_t>(k_level), with_replacement, seed);
+      seed += d_rnd_indices.size() * comm_size;
+
+      auto indices_per_major = static_cast<edge_t>(k_level);
+      if constexpr (graph_view_t::is_multi_gpu) {
+        std::tie(d_in, d_rnd_indices) =
+          shuffle_sampled_indices_to_edge_partitions(handle,
+                                                     graph_view,
+                                                     std::move(d_in),
+                                                     std::move(d_rnd_indices),
+                                                     indices_per_major,
+                                                     vertex_partition_degree_offsets);
+        indices_per_major = edge_t{1};
       }
 
-      std::tie(d_out_src, d_out_dst, d_out_indices) =
-        gather_local_edges(handle,
-                           graph_view,
-                           d_in,
-                           std::move(d_rnd_indices),
-                           static_cast<edge_t>(k_level),
-                           global_degree_offsets);
+      std::tie(d_out_src, d_out_dst, d_out_indices) = gather_local_edges(handle,
+                                                                         graph_view,
+                                                                         d_in,
+                                                                         std::move(d_rnd_indices),
+                                                                         indices_per_major,
+                                                                         global_degree_offsets);
     } else {
+      if constexpr (graph_view_t::is_multi_gpu) {
+        d_in = shuffle_active_majors_to_edge_partitions(
+          handle, graph_view, std::move(d_in), vertex_partition_degree_offsets);
+      }
+
       std::tie(d_out_src, d_out_dst, d_out_indices) =
         gather_one_hop_edgelist(handle, graph_view, d_in);
     }
@@ -160,7 +159,6 @@ uniform_nbr_sample_impl(
 
   return count_and_remove_duplicates<vertex_t, edge_t, weight_t>(
     handle, std::move(d_result_src), std::move(d_result_dst), std::move(*d_result_indices));
-#endif
 }
 }  // namespace detail
 
@@ -25,6 +25,7 @@
 
 #include <thrust/copy.h>
 
+#include <mutex>
 #include <type_traits>
 
 namespace cugraph {
@@ -254,6 +255,156 @@ graph_t serializer_t::unserialize(size_t device_sz_bytes, size_t host_sz_bytes)
   }
 }
 
+// contraction hierarchy serialization:
+//
+template <typename vertex_t, typename edge_t, typename weight_t>
+void serializer_t::serialize(contraction_hierarchy_t<vertex_t, edge_t, weight_t> const& hierarchy)
+{
+  using hierarchy_graph_t = graph_t<vertex_t, edge_t, weight_t, false, false>;
+
+  auto upward_sz   = get_device_graph_sz_bytes(hierarchy.upward_graph);
+  auto downward_sz = get_device_graph_sz_bytes(hierarchy.downward_graph);
+
+  serialize(hierarchy.levels.size());
+  serialize(upward_sz.first);
+  serialize(upward_sz.second);
+  serialize(downward_sz.first);
+  serialize(downward_sz.second);
+  serialize(hierarchy.shortcut_srcs.size());
+
+  serialize(hierarchy.levels.data(), hierarchy.levels.size());
+  serialize(hierarchy.shortcut_srcs.data(), hierarchy.shortcut_srcs.size());
+  serialize(hierarchy.shortcut_dsts.data(), hierarchy.shortcut_dsts.size());
+  serialize(hierarchy.shortcut_middles.data(), hierarchy.shortcut_middles.size());
+  serialize(hierarchy.shortcut_first_weights.data(), hierarchy.shortcut_first_weights.size());
+
+  graph_meta_t<hierarchy_graph_t> gmeta{};
+  serialize(hierarchy.upward_graph, gmeta);
+  serialize(hierarchy.downward_graph, gmeta);
+}
+
+// contraction hierarchy unserialization:
+//
+template <typename vertex_t, typename edge_t, typename weight_t>
+contraction_hierarchy_t<vertex_t, edge_t, weight_t>
+serializer_t::unserialize_contraction_hierarchy(void)
+{
+  using hierarchy_graph_t = graph_t<vertex_t, edge_t, weight_t, false, false>;
+
+  auto num_vertices       = unserialize<size_t>();
+  auto upward_device_sz   = unserialize<size_t>();
+  auto upward_host_sz     = unserialize<size_t>();
+  auto downward_device_sz = unserialize<size_t>();
+  auto downward_host_sz   = unserialize<size_t>();
+  auto num_shortcuts      = unserialize<size_t>();
+
+  auto levels                 = unserialize<vertex_t>(num_vertices);
+  auto shortcut_srcs          = unserialize<vertex_t>(num_shortcuts);
+  auto shortcut_dsts          = unserialize<vertex_t>(num_shortcuts);
+  auto shortcut_middles       = unserialize<vertex_t>(num_shortcuts);
+  auto shortcut_first_weights = unserialize<weight_t>(num_shortcuts);
+
+  auto upward_graph   = unserialize<hierarchy_graph_t>(upward_device_sz, upward_host_sz);
+  auto downward_graph = unserialize<hierarchy_graph_t>(downward_device_sz, downward_host_sz);
+
+  return contraction_hierarchy_t<vertex_t, edge_t, weight_t>{std::move(levels),
+                                                             std::move(upward_graph),
+                                                             std::move(downward_graph),
+                                                             std::move(shortcut_srcs),
+                                                             std::move(shortcut_dsts),
+                                                             std::move(shortcut_middles),
+                                                             std::move(shortcut_first_weights)};
+}
+
+// MinHash index serialization:
+//
+template <typename vertex_t>
+void serializer_t::serialize(minhash_index_t<vertex_t> const& index)
+{
+  serialize(index.number_of_vertices);
+  serialize(index.num_hashes);
+  serialize(index.seed);
+
+  serialize(index.signatures.data(), index.signatures.size());
+}
+
+// MinHash index unserialization:
+//
+template <typename vertex_t>
+minhash_index_t<vertex_t> serializer_t::unserialize_minhash_index(void)
+{
+  auto number_of_vertices = unserialize<vertex_t>();
+  auto num_hashes         = unserialize<size_t>();
+  auto seed               = unserialize<uint64_t>();
+
+  auto signatures = unserialize<uint32_t>(num_hashes * static_cast<size_t>(number_of_vertices));
+
+  return minhash_index_t<vertex_t>{number_of_vertices, num_hashes, seed, std::move(signatures)};
+}
+
+// cached derived vertex attributes serialization:
+//
+template <typename graph_t>
+void serializer_t::serialize_derived_attributes(graph_t const& graph)
+{
+  if constexpr (!graph_t::is_multi_gpu) {
+    using bool_t = typename graph_meta_t<graph_t>::bool_ser_t;
+
+    auto& attributes = *(graph.derived_attributes_);
+    std::lock_guard<std::mutex> lock(attributes.mutex);
+
+    serialize(static_cast<bool_t>(attributes.in_degrees.has_value()));
+    serialize(static_cast<bool_t>(attributes.out_degrees.has_value()));
+    serialize(static_cast<bool_t>(attributes.in_weight_sums.has_value()));
+    serialize(static_cast<bool_t>(attributes.out_weight_sums.has_value()));
+
+    if (attributes.in_degrees) {
+      serialize((*attributes.in_degrees).data(), (*attributes.in_degrees).size());
+    }
+    if (attributes.out_degrees) {
+      serialize((*attributes.out_degrees).data(), (*attributes.out_degrees).size());
+    }
+    if (attributes.in_weight_sums) {
+      serialize((*attributes.in_weight_sums).data(), (*attributes.in_weight_sums).size());
+    }
+    if (attributes.out_weight_sums) {
+      serialize((*attributes.out_weight_sums).data(), (*attributes.out_weight_sums).size());
+    }
+  } else {
+    CUGRAPH_FAIL("Unsupported graph type for serialization.");
+  }
+}
+
+// cached derived vertex attributes unserialization:
+//
+template <typename graph_t>
+void serializer_t::unserialize_derived_attributes(graph_t& graph)
+{
+  using edge_t   = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+
+  if constexpr (!graph_t::is_multi_gpu) {
+    using bool_t = typename graph_meta_t<graph_t>::bool_ser_t;
+
+    auto has_in_degrees      = unserialize<bool_t>();
+    auto has_out_degrees     = unserialize<bool_t>();
+    auto has_in_weight_sums  = unserialize<bool_t>();
+    auto has_out_weight_sums = unserialize<bool_t>();
+
+    size_t num_vertices = graph.number_of_vertices();
+
+    auto& attributes = *(graph.derived_attributes_);
+    std::lock_guard<std::mutex> lock(attributes.mutex);
+
+    if (has_in_degrees) { attributes.in_degrees = unserialize<edge_t>(num_vertices); }
+    if (has_out_degrees) { attributes.out_degrees = unserialize<edge_t>(num_vertices); }
+    if (has_in_weight_sums) { attributes.in_weight_sums = unserialize<weight_t>(num_vertices); }
+    if (has_out_weight_sums) { attributes.out_weight_sums = unserialize<weight_t>(num_vertices); }
+  } else {
+    CUGRAPH_FAIL("Unsupported graph type for unserialization.");
+  }
+}
+
 // Manual template instantiations (EIDir's):
 //
 template void serializer_t::serialize(int32_t const* p_d_src, size_t size);
@@ -306,5 +457,93 @@ template graph_t<int32_t, int64_t, double, false, false> serializer_t::unseriali
 
 template graph_t<int64_t, int64_t, double, false, false> serializer_t::unserialize(size_t, size_t);
 
+// serialize contraction hierarchy:
+//
+template void serializer_t::serialize(
+  contraction_hierarchy_t<int32_t, int32_t, float> const& hierarchy);
+
+template void serializer_t::serialize(
+  contraction_hierarchy_t<int32_t, int64_t, float> const& hierarchy);
+
+template void serializer_t::serialize(
+  contraction_hierarchy_t<int64_t, int64_t, float> const& hierarchy);
+
+template void serializer_t::serialize(
+  contraction_hierarchy_t<int32_t, int32_t, double> const& hierarchy);
+
+template void serializer_t::serialize(
+  contraction_hierarchy_t<int32_t, int64_t, double> const& hierarchy);
+
+template void serializer_t::serialize(
+  contraction_hierarchy_t<int64_t, int64_t, double> const& hierarchy);
+
+// unserialize contraction hierarchy:
+//
+template contraction_hierarchy_t<int32_t, int32_t, float>
+serializer_t::unserialize_contraction_hierarchy<int32_t, int32_t, float>(void);
+
+template contraction_hierarchy_t<int32_t, int64_t, float>
+serializer_t::unserialize_contraction_hierarchy<int32_t, int64_t, float>(void);
+
+template contraction_hierarchy_t<int64_t, int64_t, float>
+serializer_t::unserialize_contraction_hierarchy<int64_t, int64_t, float>(void);
+
+template contraction_hierarchy_t<int32_t, int32_t, double>
+serializer_t::unserialize_contraction_hierarchy<int32_t, int32_t, double>(void);
+
+template contraction_hierarchy_t<int32_t, int64_t, double>
+serializer_t::unserialize_contraction_hierarchy<int32_t, int64_t, double>(void);
+
+template contraction_hierarchy_t<int64_t, int64_t, double>
+serializer_t::unserialize_contraction_hierarchy<int64_t, int64_t, double>(void);
+
+// serialize / unserialize MinHash index:
+//
+template void serializer_t::serialize(minhash_index_t<int32_t> const& index);
+
+template void serializer_t::serialize(minhash_index_t<int64_t> const& index);
+
+template minhash_index_t<int32_t> serializer_t::unserialize_minhash_index<int32_t>(void);
+
+template minhash_index_t<int64_t> serializer_t::unserialize_minhash_index<int64_t>(void);
+
+// serialize / unserialize cached derived vertex attributes:
+//
+template void serializer_t::serialize_derived_attributes(
+  graph_t<int32_t, int32_t, float, false, false> const& graph);
+
+template void serializer_t::serialize_derived_attributes(
+  graph_t<int32_t, int64_t, float, false, false> const& graph);
+
+template void serializer_t::serialize_derived_attributes(
+  graph_t<int64_t, int64_t, float, false, false> const& graph);
+
+template void serializer_t::serialize_derived_attributes(
+  graph_t<int32_t, int32_t, double, false, false> const& graph);
+
+template void serializer_t::serialize_derived_attributes(
+  graph_t<int32_t, int64_t, double, false, false> const& graph);
+
+template void serializer_t::serialize_derived_attributes(
+  graph_t<int64_t, int64_t, double, false, false> const& graph);
+
+template void serializer_t::unserialize_derived_attributes(
+  graph_t<int32_t, int32_t, float, false, false>& graph);
+
+template void serializer_t::unserialize_derived_attributes(
+  graph_t<int32_t, int64_t, float, false, false>& graph);
+
+template void serializer_t::unserialize_derived_attributes(
+  graph_t<int64_t, int64_t, float, false, false>& graph);
+
+template void serializer_t::unserialize_derived_attributes(
+  graph_t<int32_t, int32_t, double, false, false>& graph);
+
+template void serializer_t::unserialize_derived_attributes(
+  graph_t<int32_t, int64_t, double, false, false>& graph);
+
+template void serializer_t::unserialize_derived_attributes(
+  graph_t<int64_t, int64_t, double, false, false>& graph);
+
 }  // namespace serializer
 }  // namespace cugraph
@@ -0,0 +1,462 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/delimited_edgelist_reader.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace cugraph {
+
+namespace detail {
+
+// read-only contents of a file, memory mapped if supported
+class host_mapped_file_t {
+ public:
+  explicit host_mapped_file_t(std::string const& file_path)
+  {
+#ifdef __linux__
+    fd_ = ::open(file_path.c_str(), O_RDONLY);
+    CUGRAPH_EXPECTS(fd_ != -1, "Failed to open %s.", file_path.c_str());
+    struct stat file_stat {
+    };
+    if (::fstat(fd_, &file_stat) != 0) {
+      ::close(fd_);
+      CUGRAPH_FAIL("Failed to stat %s.", file_path.c_str());
+    }
+    size_ = static_cast<size_t>(file_stat.st_size);
+    if (size_ > 0) {
+      auto addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+      if (addr == MAP_FAILED) {
+        ::close(fd_);
+        CUGRAPH_FAIL("Failed to memory map %s.", file_path.c_str());
+      }
+      ::madvise(addr, size_, MADV_SEQUENTIAL);
+      data_ = static_cast<char const*>(addr);
+    }
+#else
+    std::ifstream file(file_path, std::ios::binary);
+    CUGRAPH_EXPECTS(file.good(), "Failed to open %s.", file_path.c_str());
+    buffer_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+#endif
+  }
+
+  host_mapped_file_t(host_mapped_file_t const&) = delete;
+  host_mapped_file_t& operator=(host_mapped_file_t const&) = delete;
+
+  ~host_mapped_file_t()
+  {
+#ifdef __linux__
+    if (data_ != nullptr) { ::munmap(const_cast<char*>(data_), size_); }
+    if (fd_ != -1) { ::close(fd_); }
+#endif
+  }
+
+  std::string_view contents() const { return std::string_view(data_, size_); }
+
+ private:
+  char const* data_{nullptr};
+  size_t size_{0};
+#ifdef __linux__
+  int fd_{-1};
+#else
+  std::string buffer_{};
+#endif
+};
+
+inline bool is_blank(char c) { return (c == ' ') || (c == '\t') || (c == '\r'); }
+
+inline std::string_view trim_and_unquote(std::string_view field)
+{
+  while (!field.empty() && is_blank(field.front())) {
+    field.remove_prefix(1);
+  }
+  while (!field.empty() && is_blank(field.back())) {
+    field.remove_suffix(1);
+  }
+  if ((field.size() >= 2) && (field.front() == '"') && (field.back() == '"')) {
+    field = field.substr(1, field.size() - 2);
+  }
+  return field;
+}
+
+// split a line to fields, a std::nullopt delimiter splits at runs of spaces and tabs
+inline void split_delimited_line(std::string_view line,
+                                 std::optional<char> delimiter,
+                                 std::vector<std::string_view>& fields)
+{
+  fields.clear();
+  if (delimiter) {
+    size_t first{0};
+    while (true) {
+      auto last = line.find(*delimiter, first);
+      fields.push_back(trim_and_unquote(line.substr(first, last - first)));
+      if (last == std::string_view::npos) { break; }
+      first = last + 1;
+    }
+  } else {
+    size_t i{0};
+    while (i < line.size()) {
+      while ((i < line.size()) && is_blank(line[i])) {
+        ++i;
+      }
+      if (i == line.size()) { break; }
+      auto first = i;
+      while ((i < line.size()) && !is_blank(line[i])) {
+        ++i;
+      }
+      fields.push_back(trim_and_unquote(line.substr(first, i - first)));
+    }
+  }
+}
+
+// return the next line (without the line break) and advance offset past the line break
+inline std::string_view next_line(std::string_view contents, size_t& offset)
+{
+  auto last = contents.find('\n', offset);
+  if (last == std::string_view::npos) { last = contents.size(); }
+  auto line = contents.substr(offset, last - offset);
+  offset    = std::min(last + 1, contents.size());
+  return line;
+}
+
+inline bool is_comment_or_empty_line(std::string_view line)
+{
+  auto first = std::find_if_not(line.begin(), line.end(), is_blank);
+  return (first == line.end()) || (*first == '#') || (*first == '%');
+}
+
+template <typename vertex_t>
+bool parse_integer_vertex_id(std::string_view field, vertex_t& v)
+{
+  if (!field.empty() && (field.front() == '+')) { field.remove_prefix(1); }
+  auto [ptr, ec] = std::from_chars(field.data(), field.data() + field.size(), v);
+  return (ec == std::errc()) && (ptr == field.data() + field.size()) && !field.empty();
+}
+
+template <typename weight_t>
+struct delimited_edgelist_chunk_t {
+  std::vector<std::string_view> srcs{};
+  std::vector<std::string_view> dsts{};
+  std::vector<weight_t> weights{};
+  std::vector<std::vector<std::string>> extra_columns{};
+  bool integer_vertex_ids{true};
+  std::string error{};
+};
+
+template <typename vertex_t, typename weight_t>
+void parse_delimited_edgelist_chunk(std::string_view contents,
+                                    size_t first,
+                                    size_t last,
+                                    std::optional<char> delimiter,
+                                    size_t num_columns,
+                                    size_t src_column,
+                                    size_t dst_column,
+                                    std::optional<size_t> weight_column,
+                                    std::vector<size_t> const& extra_column_indices,
+                                    delimited_edgelist_chunk_t<weight_t>& chunk)
+{
+  chunk.extra_columns.resize(extra_column_indices.size());
+
+  std::vector<std::string_view> fields{};
+  std::string weight_str{};
+  vertex_t v{};
+  auto offset = first;
+  while (offset < last) {
+    auto line = next_line(contents, offset);
+    if (is_comment_or_empty_line(line)) { continue; }
+
+    split_delimited_line(line, delimiter, fields);
+    if (fields.size() != num_columns) {
+      chunk.error = "Invalid input file: inconsistent number of columns in \"" +
+                    std::string(line) + "\".";
+      return;
+    }
+
+    chunk.srcs.push_back(fields[src_column]);
+    chunk.dsts.push_back(fields[dst_column]);
+    if (chunk.integer_vertex_ids) {
+      chunk.integer_vertex_ids = parse_integer_vertex_id(fields[src_column], v) &&
+                                 parse_integer_vertex_id(fields[dst_column], v);
+    }
+    if (weight_column) {
+      weight_str.assign(fields[*weight_column]);
+      char* end{nullptr};
+      auto w = std::strtod(weight_str.c_str(), &end);
+      if (weight_str.empty() || (end != weight_str.c_str() + weight_str.size())) {
+        chunk.error = "Invalid input file: invalid edge weight in \"" + std::string(line) + "\".";
+        return;
+      }
+      chunk.weights.push_back(static_cast<weight_t>(w));
+    }
+    for (size_t i = 0; i < extra_column_indices.size(); ++i) {
+      chunk.extra_columns[i].emplace_back(fields[extra_column_indices[i]]);
+    }
+  }
+}
+
+template <typename Func>
+void run_on_host_threads(size_t num_threads, Func func)
+{
+  std::vector<std::thread> threads{};
+  threads.reserve(num_threads);
+  for (size_t i = 0; i < num_threads; ++i) {
+    threads.emplace_back(func, i);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename weight_t>
+host_edgelist_t<vertex_t, weight_t> read_delimited_edgelist(
+  std::string const& file_path, delimited_edgelist_options_t const& options)
+{
+  // FIXME: tuning parameter, a thread gets at least this many bytes
+  constexpr size_t min_bytes_per_thread{size_t{1} << 20};
+
+  detail::host_mapped_file_t file(file_path);
+  auto contents = file.contents();
+
+  host_edgelist_t<vertex_t, weight_t> edgelist{};
+
+  // 1. find the header and the first record to set the column layout
+
+  size_t offset{0};
+  std::string_view first_record{};
+  size_t body_first{0};
+  bool header_found{false};
+  while (offset < contents.size()) {
+    auto line_first = offset;
+    auto line       = detail::next_line(contents, offset);
+    if (detail::is_comment_or_empty_line(line)) { continue; }
+    if (options.header && !header_found) {
+      header_found = true;
+      body_first   = offset;
+      continue;
+    }
+    first_record = line;
+    if (!options.header) { body_first = line_first; }
+    break;
+  }
+
+  std::optional<char> delimiter = options.delimiter;
+  if (!delimiter) {
+    if (first_record.find(',') != std::string_view::npos) {
+      delimiter = ',';
+    } else if (first_record.find('\t') != std::string_view::npos) {
+      delimiter = '\t';
+    }
+  }
+
+  if (first_record.empty()) { return edgelist; }
+
+  std::vector<std::string_view> fields{};
+  detail::split_delimited_line(first_record, delimiter, fields);
+  auto num_columns = fields.size();
+
+  CUGRAPH_EXPECTS((options.src_column < num_columns) && (options.dst_column < num_columns),
+                  "Invalid input arguments: source or destination column out of range.");
+  auto weight_column = (options.weight_column && (*options.weight_column < num_columns))
+                         ? options.weight_column
+                         : std::nullopt;
+  for (size_t i = 0; i < num_columns; ++i) {
+    if ((i != options.src_column) && (i != options.dst_column) && (i != weight_column)) {
+      edgelist.extra_column_indices.push_back(i);
+    }
+  }
+
+  if (options.header) {
+    size_t header_offset{0};
+    std::string_view header_line{};
+    do {
+      header_line = detail::next_line(contents, header_offset);
+    } while (detail::is_comment_or_empty_line(header_line));
+    detail::split_delimited_line(header_line, delimiter, fields);
+    edgelist.column_names = std::vector<std::string>(fields.begin(), fields.end());
+  }
+
+  // 2. split the body at line boundaries and parse the pieces in parallel
+
+  auto num_threads = options.num_threads > 0
+                       ? options.num_threads
+                       : static_cast<size_t>(std::thread::hardware_concurrency());
+  num_threads      = std::max(
+    size_t{1}, std::min(num_threads, (contents.size() - body_first) / min_bytes_per_thread));
+
+  std::vector<size_t> chunk_offsets(num_threads + 1);
+  chunk_offsets[0]           = body_first;
+  chunk_offsets[num_threads] = contents.size();
+  for (size_t i = 1; i < num_threads; ++i) {
+    auto chunk_first =
+      std::max(chunk_offsets[i - 1],
+               body_first + (contents.size() - body_first) / num_threads * i);
+    if ((chunk_first > 0) && (contents[chunk_first - 1] != '\n')) {
+      detail::next_line(contents, chunk_first);  // move to the beginning of the next line
+    }
+    chunk_offsets[i] = chunk_first;
+  }
+
+  std::vector<detail::delimited_edgelist_chunk_t<weight_t>> chunks(num_threads);
+  detail::run_on_host_threads(num_threads, [&](size_t i) {
+    detail::parse_delimited_edgelist_chunk<vertex_t>(contents,
+                                                     chunk_offsets[i],
+                                                     chunk_offsets[i + 1],
+                                                     delimiter,
+                                                     num_columns,
+                                                     options.src_column,
+                                                     options.dst_column,
+                                                     weight_column,
+                                                     edgelist.extra_column_indices,
+                                                     chunks[i]);
+  });
+
+  for (auto const& chunk : chunks) {
+    CUGRAPH_EXPECTS(chunk.error.empty(), "%s", chunk.error.c_str());
+  }
+
+  // 3. convert the vertex IDs and concatenate the pieces
+
+  std::vector<size_t> edge_offsets(num_threads + 1, size_t{0});
+  for (size_t i = 0; i < num_threads; ++i) {
+    edge_offsets[i + 1] = edge_offsets[i] + chunks[i].srcs.size();
+  }
+  auto num_edges = edge_offsets.back();
+
+  edgelist.srcs.resize(num_edges);
+  edgelist.dsts.resize(num_edges);
+
+  auto integer_vertex_ids = std::all_of(
+    chunks.begin(), chunks.end(), [](auto const& chunk) { return chunk.integer_vertex_ids; });
+  if (integer_vertex_ids) {
+    detail::run_on_host_threads(num_threads, [&](size_t i) {
+      for (size_t j = 0; j < chunks[i].srcs.size(); ++j) {
+        detail::parse_integer_vertex_id(chunks[i].srcs[j], edgelist.srcs[edge_offsets[i] + j]);
+        detail::parse_integer_vertex_id(chunks[i].dsts[j], edgelist.dsts[edge_offsets[i] + j]);
+      }
+    });
+  } else {
+    // assign IDs in the order of first appearance so the mapping does not depend on num_threads
+    std::unordered_map<std::string_view, vertex_t> label_to_id{};
+    edgelist.vertex_labels = std::vector<std::string>{};
+    auto get_id            = [&label_to_id, &edgelist](std::string_view label) {
+      auto [it, inserted] =
+        label_to_id.try_emplace(label, static_cast<vertex_t>(label_to_id.size()));
+      if (inserted) { (*(edgelist.vertex_labels)).emplace_back(label); }
+      return it->second;
+    };
+    for (size_t i = 0; i < num_threads; ++i) {
+      for (size_t j = 0; j < chunks[i].srcs.size(); ++j) {
+        edgelist.srcs[edge_offsets[i] + j] = get_id(chunks[i].srcs[j]);
+        edgelist.dsts[edge_offsets[i] + j] = get_id(chunks[i].dsts[j]);
+      }
+    }
+  }
+
+  if (weight_column) {
+    edgelist.weights = std::vector<weight_t>(num_edges);
+    for (size_t i = 0; i < num_threads; ++i) {
+      std::copy(chunks[i].weights.begin(),
+                chunks[i].weights.end(),
+                (*(edgelist.weights)).begin() + edge_offsets[i]);
+    }
+  }
+
+  edgelist.extra_columns.resize(edgelist.extra_column_indices.size());
+  for (size_t i = 0; i < edgelist.extra_columns.size(); ++i) {
+    edgelist.extra_columns[i].reserve(num_edges);
+    for (auto& chunk : chunks) {
+      std::move(chunk.extra_columns[i].begin(),
+                chunk.extra_columns[i].end(),
+                std::back_inserter(edgelist.extra_columns[i]));
+    }
+  }
+
+  return edgelist;
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+std::tuple<graph_t<vertex_t, edge_t, weight_t, store_transposed, false>,
+           std::optional<rmm::device_uvector<vertex_t>>,
+           std::optional<std::vector<std::string>>>
+create_graph_from_delimited_edgelist_file(raft::handle_t const& handle,
+                                          std::string const& file_path,
+                                          delimited_edgelist_options_t const& options,
+                                          graph_properties_t graph_properties,
+                                          bool renumber,
+                                          bool do_expensive_check)
+{
+  auto edgelist = read_delimited_edgelist<vertex_t, weight_t>(file_path, options);
+
+  rmm::device_uvector<vertex_t> d_srcs(edgelist.srcs.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> d_dsts(edgelist.dsts.size(), handle.get_stream());
+  auto d_weights = edgelist.weights ? std::make_optional<rmm::device_uvector<weight_t>>(
+                                        (*(edgelist.weights)).size(), handle.get_stream())
+                                    : std::nullopt;
+
+  raft::update_device(d_srcs.data(), edgelist.srcs.data(), d_srcs.size(), handle.get_stream());
+  raft::update_device(d_dsts.data(), edgelist.dsts.data(), d_dsts.size(), handle.get_stream());
+  if (d_weights) {
+    raft::update_device(
+      (*d_weights).data(), (*(edgelist.weights)).data(), (*d_weights).size(), handle.get_stream());
+  }
+  handle.sync_stream();
+
+  auto [graph, renumber_map] =
+    create_graph_from_edgelist<vertex_t, edge_t, weight_t, store_transposed, false>(
+      handle,
+      std::nullopt,
+      std::move(d_srcs),
+      std::move(d_dsts),
+      std::move(d_weights),
+      graph_properties,
+      renumber,
+      do_expensive_check);
+
+  return std::make_tuple(
+    std::move(graph), std::move(renumber_map), std::move(edgelist.vertex_labels));
+}
+
+}  // namespace cugraph
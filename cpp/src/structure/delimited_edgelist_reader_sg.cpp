@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <structure/delimited_edgelist_reader_impl.hpp>
+
+namespace cugraph {
+
+// SG instantiation
+
+template host_edgelist_t<int32_t, float> read_delimited_edgelist<int32_t, float>(
+  std::string const& file_path, delimited_edgelist_options_t const& options);
+
+template host_edgelist_t<int32_t, double> read_delimited_edgelist<int32_t, double>(
+  std::string const& file_path, delimited_edgelist_options_t const& options);
+
+template host_edgelist_t<int64_t, float> read_delimited_edgelist<int64_t, float>(
+  std::string const& file_path, delimited_edgelist_options_t const& options);
+
+template host_edgelist_t<int64_t, double> read_delimited_edgelist<int64_t, double>(
+  std::string const& file_path, delimited_edgelist_options_t const& options);
+
+template std::tuple<graph_t<int32_t, int32_t, float, true, false>,
+                    std::optional<rmm::device_uvector<int32_t>>,
+                    std::optional<std::vector<std::string>>>
+create_graph_from_delimited_edgelist_file<int32_t, int32_t, float, true>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  delimited_edgelist_options_t const& options,
+  graph_properties_t graph_properties,
+  bool renumber,
+  bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int32_t, float, false, false>,
+                    std::optional<rmm::device_uvector<int32_t>>,
+                    std::optional<std::vector<std::string>>>
+create_graph_from_delimited_edgelist_file<int32_t, int32_t, float, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  delimited_edgelist_options_t const& options,
+  graph_properties_t graph_properties,
+  bool renumber,
+  bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int32_t, double, true, false>,
+                    std::optional<rmm::device_uvector<int32_t>>,
+                    std::optional<std::vector<std::string>>>
+create_graph_from_delimited_edgelist_file<int32_t, int32_t, double, true>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  delimited_edgelist_options_t const& options,
+  graph_properties_t graph_properties,
+  bool renumber,
+  bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int32_t, double, false, false>,
+                    std::optional<rmm::device_uvector<int32_t>>,
+                    std::optional<std::vector<std::string>>>
+create_graph_from_delimited_edgelist_file<int32_t, int32_t, double, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  delimited_edgelist_options_t const& options,
+  graph_properties_t graph_properties,
+  bool renumber,
+  bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int64_t, float, true, false>,
+                    std::optional<rmm::device_uvector<int32_t>>,
+                    std::optional<std::vector<std::string>>>
+create_graph_from_delimited_edgelist_file<int32_t, int64_t, float, true>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  delimited_edgelist_options_t const& options,
+  graph_properties_t graph_properties,
+  bool renumber,
+  bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int64_t, float, false, false>,
+                    std::optional<rmm::device_uvector<int32_t>>,
+                    std::optional<std::vector<std::string>>>
+create_graph_from_delimited_edgelist_file<int32_t, int64_t, float, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  delimited_edgelist_options_t const& options,
+  graph_properties_t graph_properties,
+  bool renumber,
+  bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int64_t, double, true, false>,
+                    std::optional<rmm::device_uvector<int32_t>>,
+                    std::optional<std::vector<std::string>>>
+create_graph_from_delimited_edgelist_file<int32_t, int64_t, double, true>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  delimited_edgelist_options_t const& options,
+  graph_properties_t graph_properties,
+  bool renumber,
+  bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int64_t, double, false, false>,
+                    std::optional<rmm::device_uvector<int32_t>>,
+                    std::optional<std::vector<std::string>>>
+create_graph_from_delimited_edgelist_file<int32_t, int64_t, double, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  delimited_edgelist_options_t const& options,
+  graph_properties_t graph_properties,
+  bool renumber,
+  bool do_expensive_check);
+
+template std::tuple<graph_t<int64_t, int64_t, float, true, false>,
+                    std::optional<rmm::device_uvector<int64_t>>,
+                    std::optional<std::vector<std::string>>>
+create_graph_from_delimited_edgelist_file<int64_t, int64_t, float, true>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  delimited_edgelist_options_t const& options,
+  graph_properties_t graph_properties,
+  bool renumber,
+  bool do_expensive_check);
+
+template std::tuple<graph_t<int64_t, int64_t, float, false, false>,
+                    std::optional<rmm::device_uvector<int64_t>>,
+                    std::optional<std::vector<std::string>>>
+create_graph_from_delimited_edgelist_file<int64_t, int64_t, float, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  delimited_edgelist_options_t const& options,
+  graph_properties_t graph_properties,
+  bool renumber,
+  bool do_expensive_check);
+
+template std::tuple<graph_t<int64_t, int64_t, double, true, false>,
+                    std::optional<rmm::device_uvector<int64_t>>,
+                    std::optional<std::vector<std::string>>>
+create_graph_from_delimited_edgelist_file<int64_t, int64_t, double, true>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  delimited_edgelist_options_t const& options,
+  graph_properties_t graph_properties,
+  bool renumber,
+  bool do_expensive_check);
+
+template std::tuple<graph_t<int64_t, int64_t, double, false, false>,
+                    std::optional<rmm::device_uvector<int64_t>>,
+                    std::optional<std::vector<std::string>>>
+create_graph_from_delimited_edgelist_file<int64_t, int64_t, double, false>(
+  raft::handle_t const& handle,
+  std::string const& file_path,
+  delimited_edgelist_options_t const& options,
+  graph_properties_t graph_properties,
+  bool renumber,
+  bool do_expensive_check);
+
+}  // namespace cugraph
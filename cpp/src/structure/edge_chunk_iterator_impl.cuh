@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/edge_chunk_iterator.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <optional>
+
+namespace cugraph {
+
+namespace detail {
+
+// decompress the edges [edge_first, edge_last) of a CSR (CSC if store_transposed) graph
+template <typename vertex_t, typename edge_t, typename weight_t>
+void decompress_edge_chunk(rmm::cuda_stream_view stream_view,
+                           edge_t const* offsets,
+                           vertex_t const* indices,
+                           std::optional<weight_t const*> weights,
+                           vertex_t number_of_vertices,
+                           edge_t edge_first,
+                           edge_t edge_last,
+                           std::optional<raft::device_span<vertex_t const>> renumber_map,
+                           vertex_t* majors,
+                           vertex_t* minors,
+                           std::optional<weight_t*> chunk_weights)
+{
+  // an edge chunk can start and end in the middle of a vertex's neighbor list, so find each
+  // edge's major with a binary search instead of expanding whole neighbor lists
+  thrust::transform(rmm::exec_policy(stream_view),
+                    thrust::make_counting_iterator(edge_first),
+                    thrust::make_counting_iterator(edge_last),
+                    majors,
+                    [offsets, number_of_vertices] __device__(auto e) {
+                      return static_cast<vertex_t>(thrust::distance(
+                        offsets + 1,
+                        thrust::upper_bound(
+                          thrust::seq, offsets + 1, offsets + (number_of_vertices + 1), e)));
+                    });
+  thrust::copy(rmm::exec_policy(stream_view), indices + edge_first, indices + edge_last, minors);
+  if (weights) {
+    thrust::copy(rmm::exec_policy(stream_view),
+                 *weights + edge_first,
+                 *weights + edge_last,
+                 *chunk_weights);
+  }
+
+  if (renumber_map) {
+    auto size          = static_cast<size_t>(edge_last - edge_first);
+    auto unrenumber_op = [renumber_map = (*renumber_map).data()] __device__(auto v) {
+      return renumber_map[v];
+    };
+    thrust::transform(rmm::exec_policy(stream_view), majors, majors + size, majors, unrenumber_op);
+    thrust::transform(rmm::exec_policy(stream_view), minors, minors + size, minors, unrenumber_op);
+  }
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+edge_chunk_iterator_t<vertex_t, edge_t, weight_t, store_transposed>::edge_chunk_iterator_t(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, store_transposed, false> const& graph_view,
+  std::optional<raft::device_span<vertex_t const>> renumber_map,
+  size_t max_chunk_size)
+  : handle_ptr_(&handle),
+    stream_view_(handle.get_next_usable_stream(0)),
+    offsets_(graph_view.local_edge_partition_view().offsets()),
+    indices_(graph_view.local_edge_partition_view().indices()),
+    weights_(graph_view.local_edge_partition_view().weights()),
+    number_of_vertices_(graph_view.number_of_vertices()),
+    number_of_edges_(graph_view.number_of_edges()),
+    renumber_map_(renumber_map),
+    max_chunk_size_(max_chunk_size),
+    majors_{rmm::device_uvector<vertex_t>(0, handle.get_stream()),
+            rmm::device_uvector<vertex_t>(0, handle.get_stream())},
+    minors_{rmm::device_uvector<vertex_t>(0, handle.get_stream()),
+            rmm::device_uvector<vertex_t>(0, handle.get_stream())}
+{
+  CUGRAPH_EXPECTS(max_chunk_size > 0, "Invalid input argument: max_chunk_size should be positive.");
+  CUGRAPH_EXPECTS(
+    !renumber_map || ((*renumber_map).size() == static_cast<size_t>(number_of_vertices_)),
+    "Invalid input argument: renumber_map size does not match with the number of vertices.");
+
+  num_chunks_ = (static_cast<size_t>(number_of_edges_) + (max_chunk_size_ - 1)) / max_chunk_size_;
+
+  auto buffer_size = std::min(max_chunk_size_, static_cast<size_t>(number_of_edges_));
+  for (size_t i = 0; i < 2; ++i) {
+    majors_[i].resize(buffer_size, handle.get_stream());
+    minors_[i].resize(buffer_size, handle.get_stream());
+  }
+  if (weights_) {
+    chunk_weights_ = std::array<rmm::device_uvector<weight_t>, 2>{
+      rmm::device_uvector<weight_t>(buffer_size, handle.get_stream()),
+      rmm::device_uvector<weight_t>(buffer_size, handle.get_stream())};
+  }
+  handle.sync_stream();  // buffers are used on stream_view_
+
+  if (num_chunks_ > 0) { enqueue_chunk(0); }
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+edge_chunk_iterator_t<vertex_t, edge_t, weight_t, store_transposed>::~edge_chunk_iterator_t()
+{
+  // the buffers are released on the handle's stream, the chunk enqueued in advance is written on
+  // stream_view_
+  stream_view_.synchronize();
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+std::optional<typename edge_chunk_iterator_t<vertex_t, edge_t, weight_t, store_transposed>::
+                chunk_type>
+edge_chunk_iterator_t<vertex_t, edge_t, weight_t, store_transposed>::next()
+{
+  if (next_chunk_idx_ >= num_chunks_) { return std::nullopt; }
+
+  auto chunk_idx = next_chunk_idx_++;
+  stream_view_.synchronize();  // chunk_idx'th chunk is ready
+
+  if (next_chunk_idx_ < num_chunks_) {
+    // the consumer is done with the previous chunk (in the buffer to be reused) once its work
+    // enqueued on the handle's stream completes
+    handle_ptr_->sync_stream();
+    enqueue_chunk(next_chunk_idx_);
+  }
+
+  auto buffer_idx = chunk_idx % 2;
+  auto edge_first = chunk_idx * max_chunk_size_;
+  auto size       = std::min(max_chunk_size_, static_cast<size_t>(number_of_edges_) - edge_first);
+
+  raft::device_span<vertex_t const> majors(majors_[buffer_idx].data(), size);
+  raft::device_span<vertex_t const> minors(minors_[buffer_idx].data(), size);
+  auto weights =
+    chunk_weights_
+      ? std::make_optional<raft::device_span<weight_t const>>((*chunk_weights_)[buffer_idx].data(),
+                                                              size)
+      : std::nullopt;
+
+  return std::make_optional<chunk_type>(
+    store_transposed ? minors : majors, store_transposed ? majors : minors, weights);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+void edge_chunk_iterator_t<vertex_t, edge_t, weight_t, store_transposed>::enqueue_chunk(
+  size_t chunk_idx)
+{
+  auto buffer_idx = chunk_idx % 2;
+  auto edge_first = static_cast<edge_t>(chunk_idx * max_chunk_size_);
+  auto edge_last  = static_cast<edge_t>(
+    std::min(static_cast<size_t>(edge_first) + max_chunk_size_,
+             static_cast<size_t>(number_of_edges_)));
+
+  detail::decompress_edge_chunk(
+    stream_view_,
+    offsets_,
+    indices_,
+    weights_,
+    number_of_vertices_,
+    edge_first,
+    edge_last,
+    renumber_map_,
+    majors_[buffer_idx].data(),
+    minors_[buffer_idx].data(),
+    chunk_weights_ ? std::optional<weight_t*>{(*chunk_weights_)[buffer_idx].data()}
+                   : std::nullopt);
+}
+
+}  // namespace cugraph
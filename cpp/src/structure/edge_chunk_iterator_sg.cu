@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <structure/edge_chunk_iterator_impl.cuh>
+
+namespace cugraph {
+
+// SG instantiation
+
+template class edge_chunk_iterator_t<int32_t, int32_t, float, true>;
+template class edge_chunk_iterator_t<int32_t, int32_t, float, false>;
+template class edge_chunk_iterator_t<int32_t, int32_t, double, true>;
+template class edge_chunk_iterator_t<int32_t, int32_t, double, false>;
+template class edge_chunk_iterator_t<int32_t, int64_t, float, true>;
+template class edge_chunk_iterator_t<int32_t, int64_t, float, false>;
+template class edge_chunk_iterator_t<int32_t, int64_t, double, true>;
+template class edge_chunk_iterator_t<int32_t, int64_t, double, false>;
+template class edge_chunk_iterator_t<int64_t, int64_t, float, true>;
+template class edge_chunk_iterator_t<int64_t, int64_t, float, false>;
+template class edge_chunk_iterator_t<int64_t, int64_t, double, true>;
+template class edge_chunk_iterator_t<int64_t, int64_t, double, false>;
+
+}  // namespace cugraph
@@ -55,6 +55,7 @@
 #include <thrust/unique.h>
 
 #include <algorithm>
+#include <mutex>
 #include <tuple>
 
 namespace cugraph {
@@ -953,6 +954,21 @@ void sort_adjacency_list(raft::handle_t const& handle,
   }
 }
 
+// return the cached vertex attribute, filling the cache through the graph view (which caches the
+// values it computes) first if not cached yet
+template <typename T, typename FillOp>
+raft::device_span<T const> get_or_fill_vertex_attribute(
+  std::mutex& mutex, std::optional<rmm::device_uvector<T>>& attribute, FillOp fill_op)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (attribute) { return raft::device_span<T const>((*attribute).data(), (*attribute).size()); }
+  }
+  fill_op();
+  std::lock_guard<std::mutex> lock(mutex);
+  return raft::device_span<T const>((*attribute).data(), (*attribute).size());
+}
+
 }  // namespace
 
 template <typename vertex_t,
@@ -1619,4 +1635,220 @@ graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_
   return result;
 }
 
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+raft::device_span<edge_t const>
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
+  in_degrees(raft::handle_t const& handle) const
+{
+  return get_or_fill_vertex_attribute(
+    derived_attributes_->mutex, derived_attributes_->in_degrees, [this, &handle]() {
+      this->view().compute_in_degrees(handle);
+    });
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+raft::device_span<edge_t const>
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
+  out_degrees(raft::handle_t const& handle) const
+{
+  return get_or_fill_vertex_attribute(
+    derived_attributes_->mutex, derived_attributes_->out_degrees, [this, &handle]() {
+      this->view().compute_out_degrees(handle);
+    });
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+raft::device_span<weight_t const>
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
+  in_weight_sums(raft::handle_t const& handle) const
+{
+  return get_or_fill_vertex_attribute(
+    derived_attributes_->mutex, derived_attributes_->in_weight_sums, [this, &handle]() {
+      this->view().compute_in_weight_sums(handle);
+    });
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+raft::device_span<weight_t const>
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
+  out_weight_sums(raft::handle_t const& handle) const
+{
+  return get_or_fill_vertex_attribute(
+    derived_attributes_->mutex, derived_attributes_->out_weight_sums, [this, &handle]() {
+      this->view().compute_out_weight_sums(handle);
+    });
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+edge_t
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
+  max_in_degree(raft::handle_t const& handle) const
+{
+  return this->view().compute_max_in_degree(handle);
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+edge_t
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
+  max_out_degree(raft::handle_t const& handle) const
+{
+  return this->view().compute_max_out_degree(handle);
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+weight_t
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
+  max_in_weight_sum(raft::handle_t const& handle) const
+{
+  return this->view().compute_max_in_weight_sum(handle);
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+weight_t
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
+  max_out_weight_sum(raft::handle_t const& handle) const
+{
+  return this->view().compute_max_out_weight_sum(handle);
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+raft::device_span<edge_t const>
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<!multi_gpu>>::
+  in_degrees(raft::handle_t const& handle) const
+{
+  return get_or_fill_vertex_attribute(
+    derived_attributes_->mutex, derived_attributes_->in_degrees, [this, &handle]() {
+      this->view().compute_in_degrees(handle);
+    });
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+raft::device_span<edge_t const>
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<!multi_gpu>>::
+  out_degrees(raft::handle_t const& handle) const
+{
+  return get_or_fill_vertex_attribute(
+    derived_attributes_->mutex, derived_attributes_->out_degrees, [this, &handle]() {
+      this->view().compute_out_degrees(handle);
+    });
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+raft::device_span<weight_t const>
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<!multi_gpu>>::
+  in_weight_sums(raft::handle_t const& handle) const
+{
+  return get_or_fill_vertex_attribute(
+    derived_attributes_->mutex, derived_attributes_->in_weight_sums, [this, &handle]() {
+      this->view().compute_in_weight_sums(handle);
+    });
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+raft::device_span<weight_t const>
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<!multi_gpu>>::
+  out_weight_sums(raft::handle_t const& handle) const
+{
+  return get_or_fill_vertex_attribute(
+    derived_attributes_->mutex, derived_attributes_->out_weight_sums, [this, &handle]() {
+      this->view().compute_out_weight_sums(handle);
+    });
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+edge_t
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<!multi_gpu>>::
+  max_in_degree(raft::handle_t const& handle) const
+{
+  return this->view().compute_max_in_degree(handle);
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+edge_t
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<!multi_gpu>>::
+  max_out_degree(raft::handle_t const& handle) const
+{
+  return this->view().compute_max_out_degree(handle);
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+weight_t
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<!multi_gpu>>::
+  max_in_weight_sum(raft::handle_t const& handle) const
+{
+  return this->view().compute_max_in_weight_sum(handle);
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+weight_t
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<!multi_gpu>>::
+  max_out_weight_sum(raft::handle_t const& handle) const
+{
+  return this->view().compute_max_out_weight_sum(handle);
+}
+
 }  // namespace cugraph
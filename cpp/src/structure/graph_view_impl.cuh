@@ -22,11 +22,13 @@
 #include <prims/transform_reduce_e.cuh>
 
 #include <cugraph/detail/decompress_edge_partition.cuh>
+#include <cugraph/graph.hpp>
 #include <cugraph/graph_functions.hpp>
 #include <cugraph/graph_view.hpp>
 #include <cugraph/partition_manager.hpp>
 #include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
 
 #include <raft/cudart_utils.h>
 #include <raft/handle.hpp>
@@ -34,6 +36,7 @@
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/count.h>
 #include <thrust/extrema.h>
 #include <thrust/fill.h>
@@ -43,6 +46,8 @@
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/optional.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
 #include <thrust/sort.h>
 #include <thrust/tabulate.h>
 #include <thrust/transform.h>
@@ -51,6 +56,8 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
+#include <mutex>
 #include <type_traits>
 #include <vector>
 
@@ -442,6 +449,268 @@ edge_t count_edge_partition_multi_edges(
   }
 }
 
+template <typename vertex_t>
+struct in_major_range_t {
+  vertex_t major_range_first{};
+  vertex_t major_range_last{};
+
+  __device__ bool operator()(vertex_t major) const
+  {
+    return (major >= major_range_first) && (major < major_range_last);
+  }
+};
+
+// look up an edge (major, minor) with a binary search in the (sorted) neighbor list of the major,
+// returns whether the edge exists (T is bool, or uint8_t to communicate the results) or its weight
+// (T is weight_t)
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu, typename T>
+struct lookup_edge_t {
+  edge_partition_device_view_t<vertex_t, edge_t, weight_t, multi_gpu> edge_partition;
+
+  __host__ __device__ static T not_found()
+  {
+    if constexpr (std::is_same_v<T, weight_t>) {
+      return std::numeric_limits<weight_t>::max();
+    } else {
+      return T{0};
+    }
+  }
+
+  __device__ T operator()(vertex_t major, vertex_t minor) const
+  {
+    auto major_idx = edge_partition.major_offset_from_major_nocheck(major);
+    if constexpr (multi_gpu) {
+      auto major_hypersparse_first = edge_partition.major_hypersparse_first();
+      if (major_hypersparse_first && (major >= *major_hypersparse_first)) {
+        auto major_hypersparse_idx = edge_partition.major_hypersparse_idx_from_major_nocheck(major);
+        if (!major_hypersparse_idx) { return not_found(); }
+        major_idx = (*major_hypersparse_first - edge_partition.major_range_first()) +
+                    *major_hypersparse_idx;  // major_offset != major_idx in the hypersparse region
+      }
+    }
+    vertex_t const* indices{nullptr};
+    thrust::optional<weight_t const*> weights{thrust::nullopt};
+    edge_t local_degree{};
+    thrust::tie(indices, weights, local_degree) = edge_partition.local_edges(major_idx);
+    auto it = thrust::lower_bound(thrust::seq, indices, indices + local_degree, minor);
+    if ((it == indices + local_degree) || (*it != minor)) { return not_found(); }
+    if constexpr (std::is_same_v<T, weight_t>) {
+      return weights ? (*weights)[thrust::distance(indices, it)] : weight_t{1.0};
+    } else {
+      return T{1};
+    }
+  }
+};
+
+template <typename vertex_t>
+struct compute_gpu_id_from_int_edge_query_t {
+  detail::compute_gpu_id_from_int_edge_t<vertex_t> gpu_id_op{};
+
+  template <typename Query>
+  __device__ int operator()(Query query) const
+  {
+    return gpu_id_op(thrust::get<0>(query), thrust::get<1>(query));
+  }
+};
+
+// look up the (major, minor) pairs (internal vertex IDs) in the local edge partitions
+template <typename T, typename GraphViewType>
+rmm::device_uvector<T> lookup_local_edges(raft::handle_t const& handle,
+                                          GraphViewType const& graph_view,
+                                          typename GraphViewType::vertex_type const* majors,
+                                          typename GraphViewType::vertex_type const* minors,
+                                          size_t num_pairs)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+  using lookup_t = lookup_edge_t<vertex_t, edge_t, weight_t, GraphViewType::is_multi_gpu, T>;
+
+  rmm::device_uvector<T> results(num_pairs, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), results.begin(), results.end(), lookup_t::not_found());
+  for (size_t i = 0; i < graph_view.number_of_local_edge_partitions(); ++i) {
+    auto edge_partition =
+      edge_partition_device_view_t<vertex_t, edge_t, weight_t, GraphViewType::is_multi_gpu>(
+        graph_view.local_edge_partition_view(i));
+    thrust::transform_if(handle.get_thrust_policy(),
+                         majors,
+                         majors + num_pairs,
+                         minors,
+                         majors,
+                         results.begin(),
+                         lookup_t{edge_partition},
+                         in_major_range_t<vertex_t>{edge_partition.major_range_first(),
+                                                    edge_partition.major_range_last()});
+  }
+
+  return results;
+}
+
+// look up the (src, dst) pairs, in multi-GPU, the pairs are routed to the GPUs owning the edges
+// and the results are routed back
+template <typename T, typename GraphViewType>
+rmm::device_uvector<T> lookup_edges(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  raft::device_span<typename GraphViewType::vertex_type const> edge_srcs,
+  raft::device_span<typename GraphViewType::vertex_type const> edge_dsts,
+  std::optional<rmm::device_uvector<typename GraphViewType::vertex_type>> const& renumber_map,
+  bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  CUGRAPH_EXPECTS(edge_srcs.size() == edge_dsts.size(),
+                  "Invalid input argument: edge_srcs and edge_dsts should have the same size.");
+
+  if (do_expensive_check && !renumber_map) {
+    auto num_invalid_vertices =
+      thrust::count_if(handle.get_thrust_policy(),
+                       edge_srcs.begin(),
+                       edge_srcs.end(),
+                       out_of_range_t<vertex_t>{0, graph_view.number_of_vertices()}) +
+      thrust::count_if(handle.get_thrust_policy(),
+                       edge_dsts.begin(),
+                       edge_dsts.end(),
+                       out_of_range_t<vertex_t>{0, graph_view.number_of_vertices()});
+    if constexpr (GraphViewType::is_multi_gpu) {
+      num_invalid_vertices = host_scalar_allreduce(
+        handle.get_comms(), num_invalid_vertices, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input argument: edge_srcs or edge_dsts have invalid vertex IDs.");
+  }
+
+  auto edge_majors = GraphViewType::is_storage_transposed ? edge_dsts : edge_srcs;
+  auto edge_minors = GraphViewType::is_storage_transposed ? edge_srcs : edge_dsts;
+
+  rmm::device_uvector<vertex_t> majors(edge_majors.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> minors(edge_minors.size(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(), edge_majors.begin(), edge_majors.end(), majors.begin());
+  thrust::copy(handle.get_thrust_policy(), edge_minors.begin(), edge_minors.end(), minors.begin());
+
+  // vertices missing in renumber_map become invalid_vertex_id and the queries using them are not
+  // found (renumber_ext_vertices throws on missing vertices instead if do_expensive_check is true)
+  if (renumber_map) {
+    renumber_ext_vertices<vertex_t, GraphViewType::is_multi_gpu>(
+      handle,
+      majors.data(),
+      majors.size(),
+      (*renumber_map).data(),
+      graph_view.local_vertex_partition_range_first(),
+      graph_view.local_vertex_partition_range_last(),
+      do_expensive_check);
+    renumber_ext_vertices<vertex_t, GraphViewType::is_multi_gpu>(
+      handle,
+      minors.data(),
+      minors.size(),
+      (*renumber_map).data(),
+      graph_view.local_vertex_partition_range_first(),
+      graph_view.local_vertex_partition_range_last(),
+      do_expensive_check);
+  }
+
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+    auto& row_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+    auto const row_comm_size = row_comm.get_size();
+    auto& col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+    auto const col_comm_size = col_comm.get_size();
+
+    auto h_vertex_partition_range_lasts = graph_view.vertex_partition_range_lasts();
+    rmm::device_uvector<vertex_t> d_vertex_partition_range_lasts(
+      h_vertex_partition_range_lasts.size(), handle.get_stream());
+    raft::update_device(d_vertex_partition_range_lasts.data(),
+                        h_vertex_partition_range_lasts.data(),
+                        h_vertex_partition_range_lasts.size(),
+                        handle.get_stream());
+
+    // the positions of the pairs to scatter the results (the pairs are reordered by the shuffle)
+    rmm::device_uvector<size_t> positions(majors.size(), handle.get_stream());
+    thrust::sequence(handle.get_thrust_policy(), positions.begin(), positions.end(), size_t{0});
+
+    auto query_first = thrust::make_zip_iterator(
+      thrust::make_tuple(majors.begin(), minors.begin(), positions.begin()));
+    auto [rx_queries, rx_counts] = groupby_gpu_id_and_shuffle_values(
+      comm,
+      query_first,
+      query_first + majors.size(),
+      compute_gpu_id_from_int_edge_query_t<vertex_t>{
+        detail::compute_gpu_id_from_int_edge_t<vertex_t>{
+          raft::device_span<vertex_t const>(d_vertex_partition_range_lasts.data(),
+                                            d_vertex_partition_range_lasts.size()),
+          comm_size,
+          row_comm_size,
+          col_comm_size}},
+      handle.get_stream());
+
+    auto rx_results = lookup_local_edges<T>(handle,
+                                            graph_view,
+                                            std::get<0>(rx_queries).data(),
+                                            std::get<1>(rx_queries).data(),
+                                            std::get<0>(rx_queries).size());
+
+    auto [tx_results, tx_counts] =
+      shuffle_values(comm, rx_results.begin(), rx_counts, handle.get_stream());
+
+    rmm::device_uvector<T> results(majors.size(), handle.get_stream());
+    thrust::scatter(handle.get_thrust_policy(),
+                    tx_results.begin(),
+                    tx_results.end(),
+                    positions.begin(),
+                    results.begin());
+
+    return results;
+  } else {
+    return lookup_local_edges<T>(handle, graph_view, majors.data(), minors.data(), majors.size());
+  }
+}
+
+// copy the vertex attribute from the derived attribute cache of the graph_t owning the graph view
+// (computing and caching it first if not cached yet), or compute it if the graph view has no cache
+template <typename T, typename Attributes, typename ComputeOp>
+rmm::device_uvector<T> copy_or_compute_vertex_attribute(
+  raft::handle_t const& handle,
+  Attributes* attributes /* nullptr if the graph view has no cache */,
+  std::optional<rmm::device_uvector<T>> Attributes::*attribute,
+  ComputeOp compute_op)
+{
+  if (attributes == nullptr) { return compute_op(); }
+
+  std::lock_guard<std::mutex> lock(attributes->mutex);
+  auto& cached_values = attributes->*attribute;
+  if (!cached_values) {
+    cached_values = compute_op();
+    handle.sync_stream();  // the cached values can be read on other streams
+  }
+  rmm::device_uvector<T> values((*cached_values).size(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(),
+               (*cached_values).begin(),
+               (*cached_values).end(),
+               values.begin());
+  return values;
+}
+
+// return the cached maximum of a vertex attribute, or compute it (and cache it if the graph view
+// has a cache); compute_op may use the cached vertex attribute, so the lock is not held while
+// computing
+template <typename T, typename Attributes, typename ComputeOp>
+T get_or_compute_max_vertex_attribute(Attributes* attributes /* nullptr if no cache */,
+                                      std::optional<T> Attributes::*max_value,
+                                      ComputeOp compute_op)
+{
+  if (attributes != nullptr) {
+    std::lock_guard<std::mutex> lock(attributes->mutex);
+    if (attributes->*max_value) { return *(attributes->*max_value); }
+  }
+  auto ret = compute_op();
+  if (attributes != nullptr) {
+    std::lock_guard<std::mutex> lock(attributes->mutex);
+    attributes->*max_value = ret;
+  }
+  return ret;
+}
+
 }  // namespace
 
 template <typename vertex_t,
@@ -456,7 +725,8 @@ graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enabl
                std::optional<std::vector<weight_t const*>> const& edge_partition_weights,
                std::optional<std::vector<vertex_t const*>> const& edge_partition_dcs_nzd_vertices,
                std::optional<std::vector<vertex_t>> const& edge_partition_dcs_nzd_vertex_counts,
-               graph_view_meta_t<vertex_t, edge_t, store_transposed, multi_gpu> meta)
+               graph_view_meta_t<vertex_t, edge_t, store_transposed, multi_gpu> meta,
+               detail::graph_derived_attributes_t<edge_t, weight_t>* derived_attributes)
   : detail::graph_base_t<vertex_t, edge_t, weight_t>(
       handle, meta.number_of_vertices, meta.number_of_edges, meta.properties),
     edge_partition_offsets_(edge_partition_offsets),
@@ -483,7 +753,8 @@ graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enabl
       meta.local_sorted_unique_edge_dst_chunk_start_offsets),
     local_sorted_unique_edge_dst_chunk_size_(meta.local_sorted_unique_edge_dst_chunk_size),
     local_sorted_unique_edge_dst_vertex_partition_offsets_(
-      meta.local_sorted_unique_edge_dst_vertex_partition_offsets)
+      meta.local_sorted_unique_edge_dst_vertex_partition_offsets),
+    derived_attributes_(derived_attributes)
 {
   // cheap error checks
 
@@ -539,13 +810,15 @@ graph_view_t<vertex_t,
                edge_t const* offsets,
                vertex_t const* indices,
                std::optional<weight_t const*> weights,
-               graph_view_meta_t<vertex_t, edge_t, store_transposed, multi_gpu> meta)
+               graph_view_meta_t<vertex_t, edge_t, store_transposed, multi_gpu> meta,
+               detail::graph_derived_attributes_t<edge_t, weight_t>* derived_attributes)
   : detail::graph_base_t<vertex_t, edge_t, weight_t>(
       handle, meta.number_of_vertices, meta.number_of_edges, meta.properties),
     offsets_(offsets),
     indices_(indices),
     weights_(weights),
-    segment_offsets_(meta.segment_offsets)
+    segment_offsets_(meta.segment_offsets),
+    derived_attributes_(derived_attributes)
 {
   // cheap error checks
 
@@ -566,16 +839,22 @@ rmm::device_uvector<edge_t>
 graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
   compute_in_degrees(raft::handle_t const& handle) const
 {
-  if (store_transposed) {
-    return compute_major_degrees(handle,
-                                 this->edge_partition_offsets_,
-                                 this->edge_partition_dcs_nzd_vertices_,
-                                 this->edge_partition_dcs_nzd_vertex_counts_,
-                                 this->partition_,
-                                 this->edge_partition_segment_offsets_);
-  } else {
-    return compute_minor_degrees(handle, *this);
-  }
+  return copy_or_compute_vertex_attribute(
+    handle,
+    this->derived_attributes_,
+    &detail::graph_derived_attributes_t<edge_t, weight_t>::in_degrees,
+    [&]() {
+      if (store_transposed) {
+        return compute_major_degrees(handle,
+                                     this->edge_partition_offsets_,
+                                     this->edge_partition_dcs_nzd_vertices_,
+                                     this->edge_partition_dcs_nzd_vertex_counts_,
+                                     this->partition_,
+                                     this->edge_partition_segment_offsets_);
+      } else {
+        return compute_minor_degrees(handle, *this);
+      }
+    });
 }
 
 template <typename vertex_t,
@@ -591,11 +870,18 @@ graph_view_t<vertex_t,
              multi_gpu,
              std::enable_if_t<!multi_gpu>>::compute_in_degrees(raft::handle_t const& handle) const
 {
-  if (store_transposed) {
-    return compute_major_degrees(handle, this->offsets_, this->local_vertex_partition_range_size());
-  } else {
-    return compute_minor_degrees(handle, *this);
-  }
+  return copy_or_compute_vertex_attribute(
+    handle,
+    this->derived_attributes_,
+    &detail::graph_derived_attributes_t<edge_t, weight_t>::in_degrees,
+    [&]() {
+      if (store_transposed) {
+        return compute_major_degrees(
+          handle, this->offsets_, this->local_vertex_partition_range_size());
+      } else {
+        return compute_minor_degrees(handle, *this);
+      }
+    });
 }
 
 template <typename vertex_t,
@@ -607,16 +893,22 @@ rmm::device_uvector<edge_t>
 graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
   compute_out_degrees(raft::handle_t const& handle) const
 {
-  if (store_transposed) {
-    return compute_minor_degrees(handle, *this);
-  } else {
-    return compute_major_degrees(handle,
-                                 this->edge_partition_offsets_,
-                                 this->edge_partition_dcs_nzd_vertices_,
-                                 this->edge_partition_dcs_nzd_vertex_counts_,
-                                 this->partition_,
-                                 this->edge_partition_segment_offsets_);
-  }
+  return copy_or_compute_vertex_attribute(
+    handle,
+    this->derived_attributes_,
+    &detail::graph_derived_attributes_t<edge_t, weight_t>::out_degrees,
+    [&]() {
+      if (store_transposed) {
+        return compute_minor_degrees(handle, *this);
+      } else {
+        return compute_major_degrees(handle,
+                                     this->edge_partition_offsets_,
+                                     this->edge_partition_dcs_nzd_vertices_,
+                                     this->edge_partition_dcs_nzd_vertex_counts_,
+                                     this->partition_,
+                                     this->edge_partition_segment_offsets_);
+      }
+    });
 }
 
 template <typename vertex_t,
@@ -632,11 +924,18 @@ graph_view_t<vertex_t,
              multi_gpu,
              std::enable_if_t<!multi_gpu>>::compute_out_degrees(raft::handle_t const& handle) const
 {
-  if (store_transposed) {
-    return compute_minor_degrees(handle, *this);
-  } else {
-    return compute_major_degrees(handle, this->offsets_, this->local_vertex_partition_range_size());
-  }
+  return copy_or_compute_vertex_attribute(
+    handle,
+    this->derived_attributes_,
+    &detail::graph_derived_attributes_t<edge_t, weight_t>::out_degrees,
+    [&]() {
+      if (store_transposed) {
+        return compute_minor_degrees(handle, *this);
+      } else {
+        return compute_major_degrees(
+          handle, this->offsets_, this->local_vertex_partition_range_size());
+      }
+    });
 }
 
 template <typename vertex_t,
@@ -648,11 +947,17 @@ rmm::device_uvector<weight_t>
 graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
   compute_in_weight_sums(raft::handle_t const& handle) const
 {
-  if (store_transposed) {
-    return compute_weight_sums<true>(handle, *this);
-  } else {
-    return compute_weight_sums<false>(handle, *this);
-  }
+  return copy_or_compute_vertex_attribute(
+    handle,
+    this->derived_attributes_,
+    &detail::graph_derived_attributes_t<edge_t, weight_t>::in_weight_sums,
+    [&]() {
+      if (store_transposed) {
+        return compute_weight_sums<true>(handle, *this);
+      } else {
+        return compute_weight_sums<false>(handle, *this);
+      }
+    });
 }
 
 template <typename vertex_t,
@@ -668,11 +973,17 @@ rmm::device_uvector<weight_t> graph_view_t<
   multi_gpu,
   std::enable_if_t<!multi_gpu>>::compute_in_weight_sums(raft::handle_t const& handle) const
 {
-  if (store_transposed) {
-    return compute_weight_sums<true>(handle, *this);
-  } else {
-    return compute_weight_sums<false>(handle, *this);
-  }
+  return copy_or_compute_vertex_attribute(
+    handle,
+    this->derived_attributes_,
+    &detail::graph_derived_attributes_t<edge_t, weight_t>::in_weight_sums,
+    [&]() {
+      if (store_transposed) {
+        return compute_weight_sums<true>(handle, *this);
+      } else {
+        return compute_weight_sums<false>(handle, *this);
+      }
+    });
 }
 
 template <typename vertex_t,
@@ -684,11 +995,17 @@ rmm::device_uvector<weight_t>
 graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
   compute_out_weight_sums(raft::handle_t const& handle) const
 {
-  if (store_transposed) {
-    return compute_weight_sums<false>(handle, *this);
-  } else {
-    return compute_weight_sums<true>(handle, *this);
-  }
+  return copy_or_compute_vertex_attribute(
+    handle,
+    this->derived_attributes_,
+    &detail::graph_derived_attributes_t<edge_t, weight_t>::out_weight_sums,
+    [&]() {
+      if (store_transposed) {
+        return compute_weight_sums<false>(handle, *this);
+      } else {
+        return compute_weight_sums<true>(handle, *this);
+      }
+    });
 }
 
 template <typename vertex_t,
@@ -704,11 +1021,17 @@ rmm::device_uvector<weight_t> graph_view_t<
   multi_gpu,
   std::enable_if_t<!multi_gpu>>::compute_out_weight_sums(raft::handle_t const& handle) const
 {
-  if (store_transposed) {
-    return compute_weight_sums<false>(handle, *this);
-  } else {
-    return compute_weight_sums<true>(handle, *this);
-  }
+  return copy_or_compute_vertex_attribute(
+    handle,
+    this->derived_attributes_,
+    &detail::graph_derived_attributes_t<edge_t, weight_t>::out_weight_sums,
+    [&]() {
+      if (store_transposed) {
+        return compute_weight_sums<false>(handle, *this);
+      } else {
+        return compute_weight_sums<true>(handle, *this);
+      }
+    });
 }
 
 template <typename vertex_t,
@@ -720,16 +1043,22 @@ edge_t
 graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
   compute_max_in_degree(raft::handle_t const& handle) const
 {
-  auto in_degrees = compute_in_degrees(handle);
-  auto it = thrust::max_element(handle.get_thrust_policy(), in_degrees.begin(), in_degrees.end());
-  rmm::device_scalar<edge_t> ret(edge_t{0}, handle.get_stream());
-  device_allreduce(handle.get_comms(),
-                   it != in_degrees.end() ? it : ret.data(),
-                   ret.data(),
-                   1,
-                   raft::comms::op_t::MAX,
-                   handle.get_stream());
-  return ret.value(handle.get_stream());
+  return get_or_compute_max_vertex_attribute(
+    this->derived_attributes_,
+    &detail::graph_derived_attributes_t<edge_t, weight_t>::max_in_degree,
+    [&]() {
+      auto in_degrees = compute_in_degrees(handle);
+      auto it =
+        thrust::max_element(handle.get_thrust_policy(), in_degrees.begin(), in_degrees.end());
+      rmm::device_scalar<edge_t> ret(edge_t{0}, handle.get_stream());
+      device_allreduce(handle.get_comms(),
+                       it != in_degrees.end() ? it : ret.data(),
+                       ret.data(),
+                       1,
+                       raft::comms::op_t::MAX,
+                       handle.get_stream());
+      return ret.value(handle.get_stream());
+    });
 }
 
 template <typename vertex_t,
@@ -745,12 +1074,18 @@ edge_t graph_view_t<vertex_t,
                     std::enable_if_t<!multi_gpu>>::compute_max_in_degree(raft::handle_t const&
                                                                            handle) const
 {
-  auto in_degrees = compute_in_degrees(handle);
-  auto it = thrust::max_element(handle.get_thrust_policy(), in_degrees.begin(), in_degrees.end());
-  edge_t ret{0};
-  if (it != in_degrees.end()) { raft::update_host(&ret, it, 1, handle.get_stream()); }
-  handle.sync_stream();
-  return ret;
+  return get_or_compute_max_vertex_attribute(
+    this->derived_attributes_,
+    &detail::graph_derived_attributes_t<edge_t, weight_t>::max_in_degree,
+    [&]() {
+      auto in_degrees = compute_in_degrees(handle);
+      auto it =
+        thrust::max_element(handle.get_thrust_policy(), in_degrees.begin(), in_degrees.end());
+      edge_t ret{0};
+      if (it != in_degrees.end()) { raft::update_host(&ret, it, 1, handle.get_stream()); }
+      handle.sync_stream();
+      return ret;
+    });
 }
 
 template <typename vertex_t,
@@ -762,16 +1097,22 @@ edge_t
 graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
   compute_max_out_degree(raft::handle_t const& handle) const
 {
-  auto out_degrees = compute_out_degrees(handle);
-  auto it = thrust::max_element(handle.get_thrust_policy(), out_degrees.begin(), out_degrees.end());
-  rmm::device_scalar<edge_t> ret(edge_t{0}, handle.get_stream());
-  device_allreduce(handle.get_comms(),
-                   it != out_degrees.end() ? it : ret.data(),
-                   ret.data(),
-                   1,
-                   raft::comms::op_t::MAX,
-                   handle.get_stream());
-  return ret.value(handle.get_stream());
+  return get_or_compute_max_vertex_attribute(
+    this->derived_attributes_,
+    &detail::graph_derived_attributes_t<edge_t, weight_t>::max_out_degree,
+    [&]() {
+      auto out_degrees = compute_out_degrees(handle);
+      auto it =
+        thrust::max_element(handle.get_thrust_policy(), out_degrees.begin(), out_degrees.end());
+      rmm::device_scalar<edge_t> ret(edge_t{0}, handle.get_stream());
+      device_allreduce(handle.get_comms(),
+                       it != out_degrees.end() ? it : ret.data(),
+                       ret.data(),
+                       1,
+                       raft::comms::op_t::MAX,
+                       handle.get_stream());
+      return ret.value(handle.get_stream());
+    });
 }
 
 template <typename vertex_t,
@@ -787,12 +1128,18 @@ edge_t graph_view_t<vertex_t,
                     std::enable_if_t<!multi_gpu>>::compute_max_out_degree(raft::handle_t const&
                                                                             handle) const
 {
-  auto out_degrees = compute_out_degrees(handle);
-  auto it = thrust::max_element(handle.get_thrust_policy(), out_degrees.begin(), out_degrees.end());
-  edge_t ret{0};
-  if (it != out_degrees.end()) { raft::update_host(&ret, it, 1, handle.get_stream()); }
-  handle.sync_stream();
-  return ret;
+  return get_or_compute_max_vertex_attribute(
+    this->derived_attributes_,
+    &detail::graph_derived_attributes_t<edge_t, weight_t>::max_out_degree,
+    [&]() {
+      auto out_degrees = compute_out_degrees(handle);
+      auto it =
+        thrust::max_element(handle.get_thrust_policy(), out_degrees.begin(), out_degrees.end());
+      edge_t ret{0};
+      if (it != out_degrees.end()) { raft::update_host(&ret, it, 1, handle.get_stream()); }
+      handle.sync_stream();
+      return ret;
+    });
 }
 
 template <typename vertex_t,
@@ -804,17 +1151,22 @@ weight_t
 graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
   compute_max_in_weight_sum(raft::handle_t const& handle) const
 {
-  auto in_weight_sums = compute_in_weight_sums(handle);
-  auto it =
-    thrust::max_element(handle.get_thrust_policy(), in_weight_sums.begin(), in_weight_sums.end());
-  rmm::device_scalar<weight_t> ret(weight_t{0.0}, handle.get_stream());
-  device_allreduce(handle.get_comms(),
-                   it != in_weight_sums.end() ? it : ret.data(),
-                   ret.data(),
-                   1,
-                   raft::comms::op_t::MAX,
-                   handle.get_stream());
-  return ret.value(handle.get_stream());
+  return get_or_compute_max_vertex_attribute(
+    this->derived_attributes_,
+    &detail::graph_derived_attributes_t<edge_t, weight_t>::max_in_weight_sum,
+    [&]() {
+      auto in_weight_sums = compute_in_weight_sums(handle);
+      auto it = thrust::max_element(
+        handle.get_thrust_policy(), in_weight_sums.begin(), in_weight_sums.end());
+      rmm::device_scalar<weight_t> ret(weight_t{0.0}, handle.get_stream());
+      device_allreduce(handle.get_comms(),
+                       it != in_weight_sums.end() ? it : ret.data(),
+                       ret.data(),
+                       1,
+                       raft::comms::op_t::MAX,
+                       handle.get_stream());
+      return ret.value(handle.get_stream());
+    });
 }
 
 template <typename vertex_t,
@@ -830,13 +1182,18 @@ weight_t graph_view_t<vertex_t,
                       std::enable_if_t<!multi_gpu>>::compute_max_in_weight_sum(raft::handle_t const&
                                                                                  handle) const
 {
-  auto in_weight_sums = compute_in_weight_sums(handle);
-  auto it =
-    thrust::max_element(handle.get_thrust_policy(), in_weight_sums.begin(), in_weight_sums.end());
-  weight_t ret{0.0};
-  if (it != in_weight_sums.end()) { raft::update_host(&ret, it, 1, handle.get_stream()); }
-  handle.sync_stream();
-  return ret;
+  return get_or_compute_max_vertex_attribute(
+    this->derived_attributes_,
+    &detail::graph_derived_attributes_t<edge_t, weight_t>::max_in_weight_sum,
+    [&]() {
+      auto in_weight_sums = compute_in_weight_sums(handle);
+      auto it = thrust::max_element(
+        handle.get_thrust_policy(), in_weight_sums.begin(), in_weight_sums.end());
+      weight_t ret{0.0};
+      if (it != in_weight_sums.end()) { raft::update_host(&ret, it, 1, handle.get_stream()); }
+      handle.sync_stream();
+      return ret;
+    });
 }
 
 template <typename vertex_t,
@@ -848,17 +1205,22 @@ weight_t
 graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
   compute_max_out_weight_sum(raft::handle_t const& handle) const
 {
-  auto out_weight_sums = compute_out_weight_sums(handle);
-  auto it =
-    thrust::max_element(handle.get_thrust_policy(), out_weight_sums.begin(), out_weight_sums.end());
-  rmm::device_scalar<weight_t> ret(weight_t{0.0}, handle.get_stream());
-  device_allreduce(handle.get_comms(),
-                   it != out_weight_sums.end() ? it : ret.data(),
-                   ret.data(),
-                   1,
-                   raft::comms::op_t::MAX,
-                   handle.get_stream());
-  return ret.value(handle.get_stream());
+  return get_or_compute_max_vertex_attribute(
+    this->derived_attributes_,
+    &detail::graph_derived_attributes_t<edge_t, weight_t>::max_out_weight_sum,
+    [&]() {
+      auto out_weight_sums = compute_out_weight_sums(handle);
+      auto it = thrust::max_element(
+        handle.get_thrust_policy(), out_weight_sums.begin(), out_weight_sums.end());
+      rmm::device_scalar<weight_t> ret(weight_t{0.0}, handle.get_stream());
+      device_allreduce(handle.get_comms(),
+                       it != out_weight_sums.end() ? it : ret.data(),
+                       ret.data(),
+                       1,
+                       raft::comms::op_t::MAX,
+                       handle.get_stream());
+      return ret.value(handle.get_stream());
+    });
 }
 
 template <typename vertex_t,
@@ -874,13 +1236,18 @@ weight_t graph_view_t<
   multi_gpu,
   std::enable_if_t<!multi_gpu>>::compute_max_out_weight_sum(raft::handle_t const& handle) const
 {
-  auto out_weight_sums = compute_out_weight_sums(handle);
-  auto it =
-    thrust::max_element(handle.get_thrust_policy(), out_weight_sums.begin(), out_weight_sums.end());
-  weight_t ret{0.0};
-  if (it != out_weight_sums.end()) { raft::update_host(&ret, it, 1, handle.get_stream()); }
-  handle.sync_stream();
-  return ret;
+  return get_or_compute_max_vertex_attribute(
+    this->derived_attributes_,
+    &detail::graph_derived_attributes_t<edge_t, weight_t>::max_out_weight_sum,
+    [&]() {
+      auto out_weight_sums = compute_out_weight_sums(handle);
+      auto it = thrust::max_element(
+        handle.get_thrust_policy(), out_weight_sums.begin(), out_weight_sums.end());
+      weight_t ret{0.0};
+      if (it != out_weight_sums.end()) { raft::update_host(&ret, it, 1, handle.get_stream()); }
+      handle.sync_stream();
+      return ret;
+    });
 }
 
 template <typename vertex_t,
@@ -1134,4 +1501,91 @@ graph_view_t<vertex_t,
                          std::move(edgelist_weights));
 }
 
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+rmm::device_uvector<bool>
+graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
+  has_edges(raft::handle_t const& handle,
+            raft::device_span<vertex_t const> edge_srcs,
+            raft::device_span<vertex_t const> edge_dsts,
+            std::optional<rmm::device_uvector<vertex_t>> const& renumber_map,
+            bool do_expensive_check) const
+{
+  // the results are communicated as uint8_t
+  auto found = lookup_edges<uint8_t>(
+    handle, *this, edge_srcs, edge_dsts, renumber_map, do_expensive_check);
+
+  rmm::device_uvector<bool> results(found.size(), handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    found.begin(),
+                    found.end(),
+                    results.begin(),
+                    thrust::identity<bool>{});
+
+  return results;
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+rmm::device_uvector<weight_t>
+graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
+  lookup_edge_weights(raft::handle_t const& handle,
+                      raft::device_span<vertex_t const> edge_srcs,
+                      raft::device_span<vertex_t const> edge_dsts,
+                      std::optional<rmm::device_uvector<vertex_t>> const& renumber_map,
+                      bool do_expensive_check) const
+{
+  return lookup_edges<weight_t>(
+    handle, *this, edge_srcs, edge_dsts, renumber_map, do_expensive_check);
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+rmm::device_uvector<bool>
+graph_view_t<vertex_t,
+             edge_t,
+             weight_t,
+             store_transposed,
+             multi_gpu,
+             std::enable_if_t<!multi_gpu>>::
+  has_edges(raft::handle_t const& handle,
+            raft::device_span<vertex_t const> edge_srcs,
+            raft::device_span<vertex_t const> edge_dsts,
+            std::optional<rmm::device_uvector<vertex_t>> const& renumber_map,
+            bool do_expensive_check) const
+{
+  return lookup_edges<bool>(handle, *this, edge_srcs, edge_dsts, renumber_map, do_expensive_check);
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+rmm::device_uvector<weight_t>
+graph_view_t<vertex_t,
+             edge_t,
+             weight_t,
+             store_transposed,
+             multi_gpu,
+             std::enable_if_t<!multi_gpu>>::
+  lookup_edge_weights(raft::handle_t const& handle,
+                      raft::device_span<vertex_t const> edge_srcs,
+                      raft::device_span<vertex_t const> edge_dsts,
+                      std::optional<rmm::device_uvector<vertex_t>> const& renumber_map,
+                      bool do_expensive_check) const
+{
+  return lookup_edges<weight_t>(
+    handle, *this, edge_srcs, edge_dsts, renumber_map, do_expensive_check);
+}
+
 }  // namespace cugraph
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/propagation_blocking.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <optional>
+
+namespace cugraph {
+
+namespace detail {
+
+template <typename vertex_t>
+struct dst_block_t {
+  vertex_t block_size{};
+
+  __device__ vertex_t operator()(vertex_t dst) const { return dst / block_size; }
+};
+
+}  // namespace detail
+
+template <typename result_t,
+          typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed>
+propagation_blocking_t<vertex_t, edge_t, weight_t> build_propagation_blocking(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, store_transposed, false> const& graph_view,
+  std::optional<vertex_t> block_size)
+{
+  // the destination values of a block are accumulated in the shared memory of a thread block
+  auto shared_memory_size = static_cast<size_t>(handle.get_device_properties().sharedMemPerBlock);
+  if (!block_size) {
+    block_size =
+      static_cast<vertex_t>(std::max(shared_memory_size / sizeof(result_t), size_t{1}));
+  }
+  CUGRAPH_EXPECTS(*block_size > vertex_t{0},
+                  "Invalid input argument: block_size should be positive.");
+  CUGRAPH_EXPECTS(static_cast<size_t>(*block_size) * sizeof(result_t) <= shared_memory_size,
+                  "Invalid input argument: the values of a block should fit in the shared memory "
+                  "of a thread block.");
+
+  auto num_vertices = graph_view.number_of_vertices();
+  auto num_blocks =
+    num_vertices > vertex_t{0} ? (num_vertices - 1) / *block_size + 1 : vertex_t{0};
+
+  // 1. sort the edges by source (the order the binning phase walks the edges in)
+
+  auto [srcs, dsts, weights] = graph_view.decompress_to_edgelist(handle, std::nullopt);
+  auto num_edges             = srcs.size();
+
+  auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), dsts.begin()));
+  if (weights) {
+    thrust::sort_by_key(
+      handle.get_thrust_policy(), edge_first, edge_first + num_edges, (*weights).begin());
+  } else {
+    thrust::sort(handle.get_thrust_policy(), edge_first, edge_first + num_edges);
+  }
+
+  // 2. assign the bin slots, the slots of a bin are in source order
+
+  rmm::device_uvector<vertex_t> dst_blocks(num_edges, handle.get_stream());
+  rmm::device_uvector<edge_t> slot_edges(num_edges, handle.get_stream());
+  thrust::transform(handle.get_thrust_policy(),
+                    dsts.begin(),
+                    dsts.end(),
+                    dst_blocks.begin(),
+                    detail::dst_block_t<vertex_t>{*block_size});
+  thrust::sequence(handle.get_thrust_policy(), slot_edges.begin(), slot_edges.end(), edge_t{0});
+  thrust::stable_sort_by_key(
+    handle.get_thrust_policy(), dst_blocks.begin(), dst_blocks.end(), slot_edges.begin());
+
+  rmm::device_uvector<edge_t> block_offsets(num_blocks + 1, handle.get_stream());
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      dst_blocks.begin(),
+                      dst_blocks.end(),
+                      thrust::make_counting_iterator(vertex_t{0}),
+                      thrust::make_counting_iterator(num_blocks + 1),
+                      block_offsets.begin());
+  dst_blocks.resize(0, handle.get_stream());
+  dst_blocks.shrink_to_fit(handle.get_stream());
+
+  rmm::device_uvector<edge_t> bin_positions(num_edges, handle.get_stream());
+  thrust::scatter(handle.get_thrust_policy(),
+                  thrust::make_counting_iterator(edge_t{0}),
+                  thrust::make_counting_iterator(static_cast<edge_t>(num_edges)),
+                  slot_edges.begin(),
+                  bin_positions.begin());
+  rmm::device_uvector<vertex_t> bin_dsts(num_edges, handle.get_stream());
+  thrust::gather(handle.get_thrust_policy(),
+                 slot_edges.begin(),
+                 slot_edges.end(),
+                 dsts.begin(),
+                 bin_dsts.begin());
+
+  return propagation_blocking_t<vertex_t, edge_t, weight_t>{*block_size,
+                                                            std::move(block_offsets),
+                                                            std::move(srcs),
+                                                            std::move(weights),
+                                                            std::move(bin_positions),
+                                                            std::move(bin_dsts)};
+}
+
+}  // namespace cugraph
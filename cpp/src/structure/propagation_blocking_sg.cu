@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <structure/propagation_blocking_impl.cuh>
+
+namespace cugraph {
+
+// SG instantiation
+
+template propagation_blocking_t<int32_t, int32_t, float> build_propagation_blocking<float>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
+  std::optional<int32_t> block_size);
+
+template propagation_blocking_t<int32_t, int32_t, float> build_propagation_blocking<double>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
+  std::optional<int32_t> block_size);
+
+template propagation_blocking_t<int32_t, int32_t, double> build_propagation_blocking<float>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
+  std::optional<int32_t> block_size);
+
+template propagation_blocking_t<int32_t, int32_t, double> build_propagation_blocking<double>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
+  std::optional<int32_t> block_size);
+
+template propagation_blocking_t<int32_t, int64_t, float> build_propagation_blocking<float>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
+  std::optional<int32_t> block_size);
+
+template propagation_blocking_t<int32_t, int64_t, float> build_propagation_blocking<double>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
+  std::optional<int32_t> block_size);
+
+template propagation_blocking_t<int32_t, int64_t, double> build_propagation_blocking<float>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
+  std::optional<int32_t> block_size);
+
+template propagation_blocking_t<int32_t, int64_t, double> build_propagation_blocking<double>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
+  std::optional<int32_t> block_size);
+
+template propagation_blocking_t<int64_t, int64_t, float> build_propagation_blocking<float>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
+  std::optional<int64_t> block_size);
+
+template propagation_blocking_t<int64_t, int64_t, float> build_propagation_blocking<double>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
+  std::optional<int64_t> block_size);
+
+template propagation_blocking_t<int64_t, int64_t, double> build_propagation_blocking<float>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
+  std::optional<int64_t> block_size);
+
+template propagation_blocking_t<int64_t, int64_t, double> build_propagation_blocking<double>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
+  std::optional<int64_t> block_size);
+
+template propagation_blocking_t<int32_t, int32_t, float> build_propagation_blocking<float>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, true, false> const& graph_view,
+  std::optional<int32_t> block_size);
+
+template propagation_blocking_t<int32_t, int32_t, float> build_propagation_blocking<double>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, true, false> const& graph_view,
+  std::optional<int32_t> block_size);
+
+template propagation_blocking_t<int32_t, int32_t, double> build_propagation_blocking<float>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, true, false> const& graph_view,
+  std::optional<int32_t> block_size);
+
+template propagation_blocking_t<int32_t, int32_t, double> build_propagation_blocking<double>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, true, false> const& graph_view,
+  std::optional<int32_t> block_size);
+
+template propagation_blocking_t<int32_t, int64_t, float> build_propagation_blocking<float>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, true, false> const& graph_view,
+  std::optional<int32_t> block_size);
+
+template propagation_blocking_t<int32_t, int64_t, float> build_propagation_blocking<double>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, true, false> const& graph_view,
+  std::optional<int32_t> block_size);
+
+template propagation_blocking_t<int32_t, int64_t, double> build_propagation_blocking<float>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, true, false> const& graph_view,
+  std::optional<int32_t> block_size);
+
+template propagation_blocking_t<int32_t, int64_t, double> build_propagation_blocking<double>(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, true, false> const& graph_view,
+  std::optional<int32_t> block_size);
+
+template propagation_blocking_t<int64_t, int64_t, float> build_propagation_blocking<float>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, true, false> const& graph_view,
+  std::optional<int64_t> block_size);
+
+template propagation_blocking_t<int64_t, int64_t, float> build_propagation_blocking<double>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, true, false> const& graph_view,
+  std::optional<int64_t> block_size);
+
+template propagation_blocking_t<int64_t, int64_t, double> build_propagation_blocking<float>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, true, false> const& graph_view,
+  std::optional<int64_t> block_size);
+
+template propagation_blocking_t<int64_t, int64_t, double> build_propagation_blocking<double>(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, true, false> const& graph_view,
+  std::optional<int64_t> block_size);
+
+}  // namespace cugraph
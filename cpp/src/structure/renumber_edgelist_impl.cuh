@@ -24,6 +24,7 @@
 #include <cugraph/utilities/device_functors.cuh>
 #include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/memory_tracking.hpp>
 #include <cugraph/utilities/shuffle_comm.cuh>
 
 #include <cuco/static_map.cuh>
@@ -100,6 +101,8 @@ std::tuple<rmm::device_uvector<vertex_t>, std::vector<vertex_t>> compute_renumbe
   std::vector<vertex_t const*> const& edgelist_minors,
   std::vector<edge_t> const& edgelist_edge_counts)
 {
+  memory_phase_range_t memory_phase("renumber/compute_map");
+
   rmm::device_uvector<vertex_t> sorted_local_vertices(0, handle.get_stream());
 
   edge_t num_local_edges = std::reduce(edgelist_edge_counts.begin(), edgelist_edge_counts.end());
@@ -734,6 +737,8 @@ renumber_edgelist(
 
   // 3. renumber edges
 
+  memory_phase_range_t memory_phase("renumber/hash_build");
+
   double constexpr load_factor = 0.7;
 
   // FIXME: compare this hash based approach with a binary search based approach in both memory
@@ -920,6 +925,8 @@ renumber_edgelist(raft::handle_t const& handle,
       std::vector<vertex_t const*>{edgelist_minors},
       std::vector<edge_t>{num_edgelist_edges});
 
+  memory_phase_range_t memory_phase("renumber/hash_build");
+
   double constexpr load_factor = 0.7;
 
   // FIXME: compare this hash based approach with a binary search based approach in both memory
@@ -22,6 +22,7 @@
 #include <cugraph/graph_functions.hpp>
 #include <cugraph/utilities/error.hpp>
 #include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
 
 #include <cuco/static_map.cuh>
 #include <rmm/mr/device/per_device_resource.hpp>
@@ -31,10 +32,12 @@
 #include <thrust/copy.h>
 #include <thrust/count.h>
 #include <thrust/distance.h>
+#include <thrust/execution_policy.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/sequence.h>
 #include <thrust/sort.h>
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
@@ -44,6 +47,64 @@ namespace cugraph {
 
 namespace detail {
 
+template <typename vertex_t>
+struct find_int_vertex_t {
+  vertex_t const* sorted_ext_vertices{nullptr};
+  vertex_t const* int_vertices{nullptr};
+  size_t num_vertices{0};
+
+  __device__ vertex_t operator()(vertex_t ext_v) const
+  {
+    auto last = sorted_ext_vertices + num_vertices;
+    auto it   = thrust::lower_bound(thrust::seq, sorted_ext_vertices, last, ext_v);
+    return ((it != last) && (*it == ext_v))
+             ? int_vertices[thrust::distance(sorted_ext_vertices, it)]
+             : invalid_vertex_id<vertex_t>::value;
+  }
+};
+
+// renumber [vertices, vertices + num_vertices) in-place using (sorted external vertex, internal
+// vertex) pairs, external vertices missing in the pairs are mapped to invalid_vertex_id
+template <typename vertex_t>
+void renumber_with_sorted_pairs(raft::handle_t const& handle,
+                                vertex_t* vertices /* [INOUT] */,
+                                size_t num_vertices,
+                                vertex_t const* sorted_ext_vertices,
+                                vertex_t const* int_vertices,
+                                size_t num_pairs,
+                                bool do_expensive_check)
+{
+  find_int_vertex_t<vertex_t> find_op{sorted_ext_vertices, int_vertices, num_pairs};
+  if (do_expensive_check) {
+    rmm::device_uvector<vertex_t> int_vertices_for_vertices(num_vertices, handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      vertices,
+                      vertices + num_vertices,
+                      int_vertices_for_vertices.begin(),
+                      find_op);
+    auto pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(vertices, int_vertices_for_vertices.begin()));
+    CUGRAPH_EXPECTS(thrust::count_if(handle.get_thrust_policy(),
+                                     pair_first,
+                                     pair_first + num_vertices,
+                                     [] __device__(auto pair) {
+                                       return (thrust::get<0>(pair) !=
+                                               invalid_vertex_id<vertex_t>::value) &&
+                                              (thrust::get<1>(pair) ==
+                                               invalid_vertex_id<vertex_t>::value);
+                                     }) == 0,
+                    "Invalid input arguments: vertices have elements that are missing in "
+                    "(aggregate) renumber_map_labels.");
+    thrust::copy(handle.get_thrust_policy(),
+                 int_vertices_for_vertices.begin(),
+                 int_vertices_for_vertices.end(),
+                 vertices);
+  } else {
+    thrust::transform(
+      handle.get_thrust_policy(), vertices, vertices + num_vertices, vertices, find_op);
+  }
+}
+
 template <typename vertex_t>
 void unrenumber_local_int_edges(
   raft::handle_t const& handle,
@@ -544,6 +605,127 @@ void renumber_local_ext_vertices(raft::handle_t const& handle,
   renumber_map_ptr->find(vertices, vertices + num_vertices, vertices);
 }
 
+template <typename vertex_t, bool multi_gpu>
+renumber_index_t<vertex_t, multi_gpu>::renumber_index_t(raft::handle_t const& handle,
+                                                        vertex_t const* renumber_map_labels,
+                                                        vertex_t local_int_vertex_first,
+                                                        vertex_t local_int_vertex_last,
+                                                        bool do_expensive_check)
+  : sorted_ext_vertices_(local_int_vertex_last - local_int_vertex_first, handle.get_stream()),
+    int_vertices_(local_int_vertex_last - local_int_vertex_first, handle.get_stream()),
+    local_int_vertex_first_(local_int_vertex_first),
+    local_int_vertex_last_(local_int_vertex_last)
+{
+  thrust::copy(handle.get_thrust_policy(),
+               renumber_map_labels,
+               renumber_map_labels + sorted_ext_vertices_.size(),
+               sorted_ext_vertices_.begin());
+  thrust::sequence(
+    handle.get_thrust_policy(), int_vertices_.begin(), int_vertices_.end(), local_int_vertex_first);
+  thrust::sort_by_key(handle.get_thrust_policy(),
+                      sorted_ext_vertices_.begin(),
+                      sorted_ext_vertices_.end(),
+                      int_vertices_.begin());
+
+  if (do_expensive_check) {
+    CUGRAPH_EXPECTS(
+      thrust::count_if(handle.get_thrust_policy(),
+                       thrust::make_counting_iterator(size_t{1}),
+                       thrust::make_counting_iterator(sorted_ext_vertices_.size()),
+                       [sorted_ext_vertices = sorted_ext_vertices_.data()] __device__(auto i) {
+                         return sorted_ext_vertices[i - 1] == sorted_ext_vertices[i];
+                       }) == 0,
+      "Invalid input arguments: renumber_map_labels have duplicate elements.");
+  }
+}
+
+template <typename vertex_t, bool multi_gpu>
+void renumber_ext_vertices(raft::handle_t const& handle,
+                           vertex_t* vertices /* [INOUT] */,
+                           size_t num_vertices,
+                           renumber_index_t<vertex_t, multi_gpu> const& renumber_index,
+                           bool do_expensive_check)
+{
+  if constexpr (multi_gpu) {
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+
+    // 1. collect the internal vertices for the unique external vertices from their owners
+
+    rmm::device_uvector<vertex_t> unique_ext_vertices(num_vertices, handle.get_stream());
+    unique_ext_vertices.resize(
+      thrust::distance(
+        unique_ext_vertices.begin(),
+        thrust::copy_if(handle.get_thrust_policy(),
+                        vertices,
+                        vertices + num_vertices,
+                        unique_ext_vertices.begin(),
+                        [] __device__(auto v) { return v != invalid_vertex_id<vertex_t>::value; })),
+      handle.get_stream());
+    thrust::sort(
+      handle.get_thrust_policy(), unique_ext_vertices.begin(), unique_ext_vertices.end());
+    unique_ext_vertices.resize(
+      thrust::distance(unique_ext_vertices.begin(),
+                       thrust::unique(handle.get_thrust_policy(),
+                                      unique_ext_vertices.begin(),
+                                      unique_ext_vertices.end())),
+      handle.get_stream());
+
+    rmm::device_uvector<vertex_t> int_vertices_for_unique_ext_vertices(0, handle.get_stream());
+    {
+      auto [rx_ext_vertices, rx_counts] = groupby_gpu_id_and_shuffle_values(
+        comm,
+        unique_ext_vertices.begin(),
+        unique_ext_vertices.end(),
+        [key_func = detail::compute_gpu_id_from_ext_vertex_t<vertex_t>{comm_size}] __device__(
+          auto v) { return key_func(v); },
+        handle.get_stream());
+      thrust::transform(handle.get_thrust_policy(),
+                        rx_ext_vertices.begin(),
+                        rx_ext_vertices.end(),
+                        rx_ext_vertices.begin(),
+                        detail::find_int_vertex_t<vertex_t>{renumber_index.sorted_ext_vertices(),
+                                                            renumber_index.int_vertices(),
+                                                            renumber_index.size()});
+      std::tie(int_vertices_for_unique_ext_vertices, std::ignore) =
+        shuffle_values(comm, rx_ext_vertices.begin(), rx_counts, handle.get_stream());
+    }
+
+    // 2. renumber (unique_ext_vertices is grouped by owner after the shuffle, sort again)
+
+    thrust::sort_by_key(handle.get_thrust_policy(),
+                        unique_ext_vertices.begin(),
+                        unique_ext_vertices.end(),
+                        int_vertices_for_unique_ext_vertices.begin());
+    detail::renumber_with_sorted_pairs(handle,
+                                       vertices,
+                                       num_vertices,
+                                       unique_ext_vertices.data(),
+                                       int_vertices_for_unique_ext_vertices.data(),
+                                       unique_ext_vertices.size(),
+                                       do_expensive_check);
+  } else {
+    renumber_local_ext_vertices(
+      handle, vertices, num_vertices, renumber_index, do_expensive_check);
+  }
+}
+
+template <typename vertex_t, bool multi_gpu>
+void renumber_local_ext_vertices(raft::handle_t const& handle,
+                                 vertex_t* vertices /* [INOUT] */,
+                                 size_t num_vertices,
+                                 renumber_index_t<vertex_t, multi_gpu> const& renumber_index,
+                                 bool do_expensive_check)
+{
+  detail::renumber_with_sorted_pairs(handle,
+                                     vertices,
+                                     num_vertices,
+                                     renumber_index.sorted_ext_vertices(),
+                                     renumber_index.int_vertices(),
+                                     renumber_index.size(),
+                                     do_expensive_check);
+}
+
 template <typename vertex_t>
 void unrenumber_local_int_vertices(
   raft::handle_t const& handle,
@@ -52,6 +52,38 @@ template void renumber_local_ext_vertices<int64_t, true>(raft::handle_t const& h
                                                          int64_t local_int_vertex_last,
                                                          bool do_expensive_check);
 
+template class renumber_index_t<int32_t, true>;
+
+template class renumber_index_t<int64_t, true>;
+
+template void renumber_ext_vertices<int32_t, true>(
+  raft::handle_t const& handle,
+  int32_t* vertices,
+  size_t num_vertices,
+  renumber_index_t<int32_t, true> const& renumber_index,
+  bool do_expensive_check);
+
+template void renumber_ext_vertices<int64_t, true>(
+  raft::handle_t const& handle,
+  int64_t* vertices,
+  size_t num_vertices,
+  renumber_index_t<int64_t, true> const& renumber_index,
+  bool do_expensive_check);
+
+template void renumber_local_ext_vertices<int32_t, true>(
+  raft::handle_t const& handle,
+  int32_t* vertices,
+  size_t num_vertices,
+  renumber_index_t<int32_t, true> const& renumber_index,
+  bool do_expensive_check);
+
+template void renumber_local_ext_vertices<int64_t, true>(
+  raft::handle_t const& handle,
+  int64_t* vertices,
+  size_t num_vertices,
+  renumber_index_t<int64_t, true> const& renumber_index,
+  bool do_expensive_check);
+
 template void unrenumber_int_vertices<int32_t, true>(
   raft::handle_t const& handle,
   int32_t* vertices,
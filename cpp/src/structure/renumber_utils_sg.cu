@@ -52,6 +52,38 @@ template void renumber_local_ext_vertices<int64_t, false>(raft::handle_t const&
                                                           int64_t local_int_vertex_last,
                                                           bool do_expensive_check);
 
+template class renumber_index_t<int32_t, false>;
+
+template class renumber_index_t<int64_t, false>;
+
+template void renumber_ext_vertices<int32_t, false>(
+  raft::handle_t const& handle,
+  int32_t* vertices,
+  size_t num_vertices,
+  renumber_index_t<int32_t, false> const& renumber_index,
+  bool do_expensive_check);
+
+template void renumber_ext_vertices<int64_t, false>(
+  raft::handle_t const& handle,
+  int64_t* vertices,
+  size_t num_vertices,
+  renumber_index_t<int64_t, false> const& renumber_index,
+  bool do_expensive_check);
+
+template void renumber_local_ext_vertices<int32_t, false>(
+  raft::handle_t const& handle,
+  int32_t* vertices,
+  size_t num_vertices,
+  renumber_index_t<int32_t, false> const& renumber_index,
+  bool do_expensive_check);
+
+template void renumber_local_ext_vertices<int64_t, false>(
+  raft::handle_t const& handle,
+  int64_t* vertices,
+  size_t num_vertices,
+  renumber_index_t<int64_t, false> const& renumber_index,
+  bool do_expensive_check);
+
 template void unrenumber_local_int_vertices<int32_t>(raft::handle_t const& handle,
                                                      int32_t* vertices,
                                                      size_t num_vertices,
@@ -0,0 +1,579 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <detail/graph_utils.cuh>
+#include <prims/edge_partition_src_dst_property.cuh>
+#include <prims/reduce_op.cuh>
+#include <prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh>
+#include <prims/vertex_frontier.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/dataframe_buffer.cuh>
+#include <cugraph/utilities/device_comm.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/distance.h>
+#include <thrust/extrema.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/merge.h>
+#include <thrust/optional.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+template <typename vertex_t>
+struct batched_bfs_e_op_t {
+  vertex_t const* depth_limits{nullptr};  // indexed by request (frontier tag)
+  size_t* edge_counts{nullptr};           // indexed by request, relevant only if edge-budgeted
+  vertex_t depth{};
+
+  __device__ thrust::optional<thrust::tuple<vertex_t, vertex_t>> operator()(
+    thrust::tuple<vertex_t, vertex_t> tagged_src,
+    vertex_t dst,
+    thrust::nullopt_t,
+    thrust::nullopt_t) const
+  {
+    auto request = thrust::get<1>(tagged_src);
+    if (depth >= depth_limits[request]) { return thrust::nullopt; }
+    if (edge_counts != nullptr) {
+      static_assert(sizeof(unsigned long long int) == sizeof(size_t));
+      atomicAdd(reinterpret_cast<unsigned long long int*>(edge_counts + request),
+                static_cast<unsigned long long int>(1));
+    }
+    return thrust::optional<thrust::tuple<vertex_t, vertex_t>>{
+      thrust::make_tuple(request, thrust::get<0>(tagged_src))};
+  }
+};
+
+}  // namespace
+
+namespace detail {
+
+template <typename GraphViewType>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<typename GraphViewType::vertex_type>>
+bfs_batched(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  raft::device_span<typename GraphViewType::vertex_type const> sources,
+  std::optional<raft::device_span<typename GraphViewType::vertex_type const>> depth_limits,
+  typename GraphViewType::vertex_type depth_limit,
+  bool compute_predecessors,
+  std::optional<raft::device_span<typename GraphViewType::vertex_type const>> targets,
+  std::optional<size_t> vertex_budget,
+  std::optional<size_t> edge_budget,
+  bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  auto constexpr invalid_vertex = invalid_vertex_id<vertex_t>::value;
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(!depth_limits || ((*depth_limits).size() == sources.size()),
+                  "Invalid input argument: sources and depth_limits should have the same size.");
+  CUGRAPH_EXPECTS(depth_limits || (depth_limit >= vertex_t{0}),
+                  "Invalid input argument: depth_limit should be non-negative.");
+  CUGRAPH_EXPECTS(!targets || ((*targets).size() == sources.size()),
+                  "Invalid input argument: sources and targets should have the same size.");
+
+  if (do_expensive_check) {
+    auto num_invalid_sources = thrust::count_if(
+      handle.get_thrust_policy(),
+      sources.begin(),
+      sources.end(),
+      [num_vertices = push_graph_view.number_of_vertices()] __device__(auto v) {
+        return !((v >= vertex_t{0}) && (v < num_vertices));
+      });
+    auto num_invalid_targets =
+      targets ? thrust::count_if(handle.get_thrust_policy(),
+                                 (*targets).begin(),
+                                 (*targets).end(),
+                                 [num_vertices = push_graph_view.number_of_vertices()] __device__(
+                                   auto v) {
+                                   return !(((v >= vertex_t{0}) && (v < num_vertices)) ||
+                                            (v == invalid_vertex_id<vertex_t>::value));
+                                 })
+              : 0;
+    auto num_invalid_depth_limits =
+      depth_limits ? thrust::count_if(handle.get_thrust_policy(),
+                                      (*depth_limits).begin(),
+                                      (*depth_limits).end(),
+                                      [] __device__(auto limit) { return limit < vertex_t{0}; })
+                   : 0;
+    if constexpr (GraphViewType::is_multi_gpu) {
+      num_invalid_sources = host_scalar_allreduce(
+        handle.get_comms(), num_invalid_sources, raft::comms::op_t::SUM, handle.get_stream());
+      num_invalid_targets = host_scalar_allreduce(
+        handle.get_comms(), num_invalid_targets, raft::comms::op_t::SUM, handle.get_stream());
+      num_invalid_depth_limits = host_scalar_allreduce(
+        handle.get_comms(), num_invalid_depth_limits, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalid_sources == 0,
+                    "Invalid input argument: sources have invalid vertex IDs.");
+    CUGRAPH_EXPECTS(num_invalid_targets == 0,
+                    "Invalid input argument: targets have invalid vertex IDs.");
+    CUGRAPH_EXPECTS(num_invalid_depth_limits == 0,
+                    "Invalid input argument: depth_limits have negative values.");
+  }
+
+  // 2. assign global request IDs (used as frontier tags) and gather every request's depth limit
+  // (and target)
+
+  vertex_t request_offset{0};
+  std::vector<size_t> request_counts{sources.size()};
+  std::vector<size_t> request_displacements{0};
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& comm     = handle.get_comms();
+    request_counts = host_scalar_allgather(comm, sources.size(), handle.get_stream());
+    request_displacements.resize(request_counts.size());
+    std::exclusive_scan(
+      request_counts.begin(), request_counts.end(), request_displacements.begin(), size_t{0});
+    request_offset = static_cast<vertex_t>(request_displacements[comm.get_rank()]);
+  }
+  auto num_aggregate_requests = request_displacements.back() + request_counts.back();
+  CUGRAPH_EXPECTS(
+    num_aggregate_requests <= static_cast<size_t>(std::numeric_limits<vertex_t>::max()),
+    "Invalid input argument: the number of requests exceeds the maximum vertex_t value.");
+
+  // a request whose target is its source (or whose vertex budget is exhausted by the source alone)
+  // stops at depth 0
+
+  rmm::device_uvector<vertex_t> local_depth_limits(sources.size(), handle.get_stream());
+  if (depth_limits) {
+    thrust::copy(handle.get_thrust_policy(),
+                 (*depth_limits).begin(),
+                 (*depth_limits).end(),
+                 local_depth_limits.begin());
+  } else {
+    thrust::fill(handle.get_thrust_policy(),
+                 local_depth_limits.begin(),
+                 local_depth_limits.end(),
+                 depth_limit);
+  }
+  if (vertex_budget && (*vertex_budget <= size_t{1})) {
+    thrust::fill(handle.get_thrust_policy(),
+                 local_depth_limits.begin(),
+                 local_depth_limits.end(),
+                 vertex_t{0});
+  }
+  if (targets) {
+    thrust::transform(
+      handle.get_thrust_policy(),
+      local_depth_limits.begin(),
+      local_depth_limits.end(),
+      thrust::make_zip_iterator(thrust::make_tuple(sources.begin(), (*targets).begin())),
+      local_depth_limits.begin(),
+      [] __device__(auto limit, auto pair) {
+        return thrust::get<0>(pair) == thrust::get<1>(pair) ? vertex_t{0} : limit;
+      });
+  }
+
+  rmm::device_uvector<vertex_t> aggregate_depth_limits(0, handle.get_stream());
+  std::optional<rmm::device_uvector<vertex_t>> aggregate_targets{std::nullopt};
+  if constexpr (GraphViewType::is_multi_gpu) {
+    aggregate_depth_limits.resize(num_aggregate_requests, handle.get_stream());
+    device_allgatherv(handle.get_comms(),
+                      local_depth_limits.begin(),
+                      aggregate_depth_limits.begin(),
+                      request_counts,
+                      request_displacements,
+                      handle.get_stream());
+    if (targets) {
+      aggregate_targets =
+        rmm::device_uvector<vertex_t>(num_aggregate_requests, handle.get_stream());
+      device_allgatherv(handle.get_comms(),
+                        (*targets).begin(),
+                        (*aggregate_targets).begin(),
+                        request_counts,
+                        request_displacements,
+                        handle.get_stream());
+    }
+  } else {
+    aggregate_depth_limits = std::move(local_depth_limits);
+    if (targets) {
+      aggregate_targets =
+        rmm::device_uvector<vertex_t>(num_aggregate_requests, handle.get_stream());
+      thrust::copy(handle.get_thrust_policy(),
+                   (*targets).begin(),
+                   (*targets).end(),
+                   (*aggregate_targets).begin());
+    }
+  }
+
+  // a request stops expanding once it reaches its target or exhausts its budget, this is applied by
+  // lowering its depth limit to the current depth. counts[i] and counts[num_aggregate_requests + i]
+  // store the number of vertices visited and the number of edges examined by request i so far
+  // (replicated in multi-GPU).
+
+  auto budgeted = vertex_budget.has_value() || edge_budget.has_value();
+  rmm::device_uvector<size_t> counts(budgeted ? 2 * num_aggregate_requests : size_t{0},
+                                     handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(),
+               counts.begin(),
+               counts.begin() + (budgeted ? num_aggregate_requests : size_t{0}),
+               size_t{1} /* the source */);
+  thrust::fill(handle.get_thrust_policy(),
+               counts.begin() + (budgeted ? num_aggregate_requests : size_t{0}),
+               counts.end(),
+               size_t{0});
+
+  auto max_depth_limit = thrust::reduce(handle.get_thrust_policy(),
+                                        aggregate_depth_limits.begin(),
+                                        aggregate_depth_limits.end(),
+                                        vertex_t{0},
+                                        thrust::maximum<vertex_t>{});
+
+  // 3. initialize the visited (vertex, request) pairs (sorted, with distances & predecessors) and
+  // the frontier, both reside in the GPU owning the vertex
+
+  rmm::device_uvector<vertex_t> visited_vertices(sources.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> visited_requests(sources.size(), handle.get_stream());
+  thrust::copy(
+    handle.get_thrust_policy(), sources.begin(), sources.end(), visited_vertices.begin());
+  thrust::sequence(
+    handle.get_thrust_policy(), visited_requests.begin(), visited_requests.end(), request_offset);
+
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& comm = handle.get_comms();
+
+    auto h_vertex_partition_range_lasts = push_graph_view.vertex_partition_range_lasts();
+    rmm::device_uvector<vertex_t> d_vertex_partition_range_lasts(
+      h_vertex_partition_range_lasts.size(), handle.get_stream());
+    raft::update_device(d_vertex_partition_range_lasts.data(),
+                        h_vertex_partition_range_lasts.data(),
+                        h_vertex_partition_range_lasts.size(),
+                        handle.get_stream());
+
+    auto pair_first = thrust::make_zip_iterator(
+      thrust::make_tuple(visited_vertices.begin(), visited_requests.begin()));
+    std::forward_as_tuple(std::tie(visited_vertices, visited_requests), std::ignore) =
+      groupby_gpu_id_and_shuffle_values(
+        comm,
+        pair_first,
+        pair_first + visited_vertices.size(),
+        [key_func =
+           compute_gpu_id_from_int_vertex_t<vertex_t>{raft::device_span<vertex_t>(
+             d_vertex_partition_range_lasts.data(),
+             d_vertex_partition_range_lasts.size())}] __device__(auto val) {
+          return key_func(thrust::get<0>(val));
+        },
+        handle.get_stream());
+  }
+
+  auto visited_pair_first = thrust::make_zip_iterator(
+    thrust::make_tuple(visited_vertices.begin(), visited_requests.begin()));
+  thrust::sort(handle.get_thrust_policy(),
+               visited_pair_first,
+               visited_pair_first + visited_vertices.size());
+  rmm::device_uvector<vertex_t> visited_distances(visited_vertices.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> visited_predecessors(visited_vertices.size(), handle.get_stream());
+  thrust::fill(
+    handle.get_thrust_policy(), visited_distances.begin(), visited_distances.end(), vertex_t{0});
+  thrust::fill(handle.get_thrust_policy(),
+               visited_predecessors.begin(),
+               visited_predecessors.end(),
+               invalid_vertex);
+
+  constexpr size_t bucket_idx_cur = 0;
+  constexpr size_t num_buckets    = 1;
+
+  vertex_frontier_t<vertex_t, vertex_t, GraphViewType::is_multi_gpu> vertex_frontier(handle,
+                                                                                     num_buckets);
+  vertex_frontier.bucket(bucket_idx_cur)
+    .insert(visited_pair_first, visited_pair_first + visited_vertices.size());
+
+  // 4. BFS iteration, every request advances by one hop per iteration
+
+  vertex_t depth{0};
+  while ((depth < max_depth_limit) &&
+         (vertex_frontier.bucket(bucket_idx_cur).aggregate_size() > 0)) {
+    rmm::device_uvector<size_t> iteration_counts(counts.size(), handle.get_stream());
+    thrust::fill(
+      handle.get_thrust_policy(), iteration_counts.begin(), iteration_counts.end(), size_t{0});
+
+    auto [new_key_buffer, new_predecessors] = transform_reduce_v_frontier_outgoing_e_by_dst(
+      handle,
+      push_graph_view,
+      vertex_frontier,
+      bucket_idx_cur,
+      dummy_property_t<vertex_t>{}.device_view(),
+      dummy_property_t<vertex_t>{}.device_view(),
+      batched_bfs_e_op_t<vertex_t>{
+        aggregate_depth_limits.data(),
+        edge_budget ? iteration_counts.data() + num_aggregate_requests : nullptr,
+        depth},
+      reduce_op::any<vertex_t>());
+
+    // drop the (vertex, request) pairs visited in the previous iterations, the returned pairs are
+    // sorted and this preserves the order
+
+    auto new_key_first = get_dataframe_buffer_begin(new_key_buffer);
+    auto new_pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(new_key_first, new_predecessors.begin()));
+    auto num_new_keys = static_cast<size_t>(thrust::distance(
+      new_pair_first,
+      thrust::remove_if(handle.get_thrust_policy(),
+                        new_pair_first,
+                        new_pair_first + size_dataframe_buffer(new_key_buffer),
+                        [visited_pair_first, num_visited = visited_vertices.size()] __device__(
+                          auto pair) {
+                          return thrust::binary_search(thrust::seq,
+                                                       visited_pair_first,
+                                                       visited_pair_first + num_visited,
+                                                       thrust::get<0>(pair));
+                        })));
+    resize_dataframe_buffer(new_key_buffer, num_new_keys, handle.get_stream());
+    new_predecessors.resize(num_new_keys, handle.get_stream());
+
+    // merge the newly visited pairs
+
+    rmm::device_uvector<vertex_t> merged_vertices(visited_vertices.size() + num_new_keys,
+                                                  handle.get_stream());
+    rmm::device_uvector<vertex_t> merged_requests(merged_vertices.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> merged_distances(merged_vertices.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> merged_predecessors(merged_vertices.size(),
+                                                      handle.get_stream());
+    thrust::merge_by_key(
+      handle.get_thrust_policy(),
+      visited_pair_first,
+      visited_pair_first + visited_vertices.size(),
+      new_key_first,
+      new_key_first + num_new_keys,
+      thrust::make_zip_iterator(
+        thrust::make_tuple(visited_distances.begin(), visited_predecessors.begin())),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(thrust::make_constant_iterator(depth + 1), new_predecessors.begin())),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(merged_vertices.begin(), merged_requests.begin())),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(merged_distances.begin(), merged_predecessors.begin())));
+    visited_vertices     = std::move(merged_vertices);
+    visited_requests     = std::move(merged_requests);
+    visited_distances    = std::move(merged_distances);
+    visited_predecessors = std::move(merged_predecessors);
+    visited_pair_first   = thrust::make_zip_iterator(
+      thrust::make_tuple(visited_vertices.begin(), visited_requests.begin()));
+
+    // stop the requests that reached their targets or exhausted their budgets in this iteration
+    // (the vertices visited in this iteration are still returned)
+
+    if (aggregate_targets || budgeted) {
+      rmm::device_uvector<uint8_t> reached(aggregate_targets ? num_aggregate_requests : size_t{0},
+                                           handle.get_stream());
+      thrust::fill(handle.get_thrust_policy(), reached.begin(), reached.end(), uint8_t{0});
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        new_key_first,
+        new_key_first + num_new_keys,
+        [vertex_counts = vertex_budget ? iteration_counts.data() : static_cast<size_t*>(nullptr),
+         targets       = aggregate_targets ? (*aggregate_targets).data()
+                                           : static_cast<vertex_t const*>(nullptr),
+         reached       = reached.data()] __device__(auto key) {
+          auto request = thrust::get<1>(key);
+          if (vertex_counts != nullptr) {
+            atomicAdd(reinterpret_cast<unsigned long long int*>(vertex_counts + request),
+                      static_cast<unsigned long long int>(1));
+          }
+          if ((targets != nullptr) && (targets[request] == thrust::get<0>(key))) {
+            reached[request] = uint8_t{1};
+          }
+        });
+
+      if constexpr (GraphViewType::is_multi_gpu) {
+        device_allreduce(handle.get_comms(),
+                         iteration_counts.begin(),
+                         iteration_counts.begin(),
+                         iteration_counts.size(),
+                         raft::comms::op_t::SUM,
+                         handle.get_stream());
+        device_allreduce(handle.get_comms(),
+                         reached.begin(),
+                         reached.begin(),
+                         reached.size(),
+                         raft::comms::op_t::MAX,
+                         handle.get_stream());
+      }
+
+      thrust::for_each(
+        handle.get_thrust_policy(),
+        thrust::make_counting_iterator(size_t{0}),
+        thrust::make_counting_iterator(num_aggregate_requests),
+        [depth_limits     = aggregate_depth_limits.data(),
+         counts           = budgeted ? counts.data() : static_cast<size_t*>(nullptr),
+         iteration_counts = iteration_counts.data(),
+         reached = aggregate_targets ? reached.data() : static_cast<uint8_t const*>(nullptr),
+         vertex_budget = vertex_budget ? *vertex_budget : std::numeric_limits<size_t>::max(),
+         edge_budget   = edge_budget ? *edge_budget : std::numeric_limits<size_t>::max(),
+         num_aggregate_requests,
+         depth] __device__(auto request) {
+          auto stop = (reached != nullptr) && (reached[request] != uint8_t{0});
+          if (counts != nullptr) {
+            auto vertex_count = counts[request] + iteration_counts[request];
+            auto edge_count   = counts[num_aggregate_requests + request] +
+                              iteration_counts[num_aggregate_requests + request];
+            counts[request]                          = vertex_count;
+            counts[num_aggregate_requests + request] = edge_count;
+            stop = stop || (vertex_count >= vertex_budget) || (edge_count >= edge_budget);
+          }
+          if (stop) { depth_limits[request] = thrust::min(depth_limits[request], depth + 1); }
+        });
+    }
+
+    // only the pairs of the requests allowed to go one hop further form the next frontier
+
+    num_new_keys = static_cast<size_t>(thrust::distance(
+      new_key_first,
+      thrust::remove_if(handle.get_thrust_policy(),
+                        new_key_first,
+                        new_key_first + num_new_keys,
+                        [depth_limits = aggregate_depth_limits.data(), depth] __device__(auto key) {
+                          return depth_limits[thrust::get<1>(key)] <= depth + 1;
+                        })));
+
+    vertex_frontier.bucket(bucket_idx_cur).clear();
+    vertex_frontier.bucket(bucket_idx_cur).shrink_to_fit();
+    vertex_frontier.bucket(bucket_idx_cur).insert(new_key_first, new_key_first + num_new_keys);
+
+    depth++;
+  }
+
+  // 5. return the results to the GPUs that submitted the requests and pack them request by request
+
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& comm = handle.get_comms();
+
+    std::vector<vertex_t> h_request_lasts(request_counts.size());
+    std::inclusive_scan(request_counts.begin(), request_counts.end(), h_request_lasts.begin());
+    rmm::device_uvector<vertex_t> d_request_lasts(h_request_lasts.size(), handle.get_stream());
+    raft::update_device(
+      d_request_lasts.data(), h_request_lasts.data(), h_request_lasts.size(), handle.get_stream());
+
+    auto result_first = thrust::make_zip_iterator(thrust::make_tuple(visited_vertices.begin(),
+                                                                     visited_requests.begin(),
+                                                                     visited_distances.begin(),
+                                                                     visited_predecessors.begin()));
+    std::forward_as_tuple(
+      std::tie(visited_vertices, visited_requests, visited_distances, visited_predecessors),
+      std::ignore) =
+      groupby_gpu_id_and_shuffle_values(
+        comm,
+        result_first,
+        result_first + visited_vertices.size(),
+        [request_lasts = raft::device_span<vertex_t const>(
+           d_request_lasts.data(), d_request_lasts.size())] __device__(auto val) {
+          return static_cast<int>(thrust::distance(
+            request_lasts.begin(),
+            thrust::upper_bound(
+              thrust::seq, request_lasts.begin(), request_lasts.end(), thrust::get<1>(val))));
+        },
+        handle.get_stream());
+  }
+
+  auto result_key_first = thrust::make_zip_iterator(
+    thrust::make_tuple(visited_requests.begin(), visited_vertices.begin()));
+  thrust::sort_by_key(handle.get_thrust_policy(),
+                      result_key_first,
+                      result_key_first + visited_vertices.size(),
+                      thrust::make_zip_iterator(thrust::make_tuple(
+                        visited_distances.begin(), visited_predecessors.begin())));
+
+  rmm::device_uvector<size_t> offsets(sources.size() + 1, handle.get_stream());
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      visited_requests.begin(),
+                      visited_requests.end(),
+                      thrust::make_counting_iterator(request_offset),
+                      thrust::make_counting_iterator(request_offset +
+                                                     static_cast<vertex_t>(offsets.size())),
+                      offsets.begin());
+
+  if (!compute_predecessors) {
+    visited_predecessors.resize(0, handle.get_stream());
+    visited_predecessors.shrink_to_fit(handle.get_stream());
+  }
+
+  return std::make_tuple(std::move(offsets),
+                         std::move(visited_vertices),
+                         std::move(visited_distances),
+                         std::move(visited_predecessors));
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>>
+bfs_batched(raft::handle_t const& handle,
+            graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+            raft::device_span<vertex_t const> sources,
+            std::optional<raft::device_span<vertex_t const>> depth_limits,
+            vertex_t depth_limit,
+            bool compute_predecessors,
+            std::optional<raft::device_span<vertex_t const>> targets,
+            std::optional<size_t> vertex_budget,
+            std::optional<size_t> edge_budget,
+            bool do_expensive_check)
+{
+  return detail::bfs_batched(handle,
+                             graph_view,
+                             sources,
+                             depth_limits,
+                             depth_limit,
+                             compute_predecessors,
+                             targets,
+                             vertex_budget,
+                             edge_budget,
+                             do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <traversal/bfs_batched_impl.cuh>
+
+namespace cugraph {
+
+// MG instantiation
+
+template std::tuple<rmm::device_uvector<size_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>>
+bfs_batched(raft::handle_t const& handle,
+            graph_view_t<int32_t, int32_t, float, false, true> const& graph_view,
+            raft::device_span<int32_t const> sources,
+            std::optional<raft::device_span<int32_t const>> depth_limits,
+            int32_t depth_limit,
+            bool compute_predecessors,
+            std::optional<raft::device_span<int32_t const>> targets,
+            std::optional<size_t> vertex_budget,
+            std::optional<size_t> edge_budget,
+            bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<size_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>>
+bfs_batched(raft::handle_t const& handle,
+            graph_view_t<int32_t, int32_t, double, false, true> const& graph_view,
+            raft::device_span<int32_t const> sources,
+            std::optional<raft::device_span<int32_t const>> depth_limits,
+            int32_t depth_limit,
+            bool compute_predecessors,
+            std::optional<raft::device_span<int32_t const>> targets,
+            std::optional<size_t> vertex_budget,
+            std::optional<size_t> edge_budget,
+            bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<size_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>>
+bfs_batched(raft::handle_t const& handle,
+            graph_view_t<int32_t, int64_t, float, false, true> const& graph_view,
+            raft::device_span<int32_t const> sources,
+            std::optional<raft::device_span<int32_t const>> depth_limits,
+            int32_t depth_limit,
+            bool compute_predecessors,
+            std::optional<raft::device_span<int32_t const>> targets,
+            std::optional<size_t> vertex_budget,
+            std::optional<size_t> edge_budget,
+            bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<size_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>>
+bfs_batched(raft::handle_t const& handle,
+            graph_view_t<int32_t, int64_t, double, false, true> const& graph_view,
+            raft::device_span<int32_t const> sources,
+            std::optional<raft::device_span<int32_t const>> depth_limits,
+            int32_t depth_limit,
+            bool compute_predecessors,
+            std::optional<raft::device_span<int32_t const>> targets,
+            std::optional<size_t> vertex_budget,
+            std::optional<size_t> edge_budget,
+            bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<size_t>,
+                    rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>>
+bfs_batched(raft::handle_t const& handle,
+            graph_view_t<int64_t, int64_t, float, false, true> const& graph_view,
+            raft::device_span<int64_t const> sources,
+            std::optional<raft::device_span<int64_t const>> depth_limits,
+            int64_t depth_limit,
+            bool compute_predecessors,
+            std::optional<raft::device_span<int64_t const>> targets,
+            std::optional<size_t> vertex_budget,
+            std::optional<size_t> edge_budget,
+            bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<size_t>,
+                    rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>>
+bfs_batched(raft::handle_t const& handle,
+            graph_view_t<int64_t, int64_t, double, false, true> const& graph_view,
+            raft::device_span<int64_t const> sources,
+            std::optional<raft::device_span<int64_t const>> depth_limits,
+            int64_t depth_limit,
+            bool compute_predecessors,
+            std::optional<raft::device_span<int64_t const>> targets,
+            std::optional<size_t> vertex_budget,
+            std::optional<size_t> edge_budget,
+            bool do_expensive_check);
+
+}  // namespace cugraph
@@ -178,8 +178,11 @@ void bfs(raft::handle_t const& handle,
   constexpr size_t bucket_idx_next = 1;
   constexpr size_t num_buckets     = 2;
 
-  vertex_frontier_t<vertex_t, void, GraphViewType::is_multi_gpu> vertex_frontier(handle,
-                                                                                 num_buckets);
+  vertex_frontier_t<vertex_t, void, GraphViewType::is_multi_gpu> vertex_frontier(
+    handle,
+    num_buckets,
+    push_graph_view.local_vertex_partition_range_first(),
+    push_graph_view.local_vertex_partition_range_last());
 
   vertex_frontier.bucket(bucket_idx_cur).insert(sources, sources + n_sources);
   rmm::device_uvector<uint32_t> visited_flags(
@@ -205,10 +208,12 @@ void bfs(raft::handle_t const& handle,
       CUGRAPH_FAIL("unimplemented.");
     } else {
       if (GraphViewType::is_multi_gpu) {
+        auto const& cur_frontier_bucket =
+          vertex_frontier.bucket(bucket_idx_cur);  // const access keeps the bucket bitmap valid
         update_edge_partition_dst_property(handle,
                                            push_graph_view,
-                                           vertex_frontier.bucket(bucket_idx_cur).begin(),
-                                           vertex_frontier.bucket(bucket_idx_cur).end(),
+                                           cur_frontier_bucket.begin(),
+                                           cur_frontier_bucket.end(),
                                            thrust::make_constant_iterator(uint8_t{1}),
                                            dst_visited_flags);
       } else {
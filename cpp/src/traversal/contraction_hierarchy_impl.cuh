@@ -0,0 +1,1235 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/contraction_hierarchy.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <raft/device_atomics.cuh>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/merge.h>
+#include <thrust/partition.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <limits>
+
+namespace cugraph {
+
+namespace detail {
+
+// edge difference (number of shortcuts added, assuming no witness path, minus number of edges
+// removed) plus the number of already contracted neighbors, smaller is contracted earlier
+template <typename vertex_t, typename edge_t>
+struct contraction_priority_t {
+  edge_t const* in_degrees{nullptr};
+  edge_t const* out_degrees{nullptr};
+  edge_t const* contracted_neighbor_counts{nullptr};
+
+  __device__ int64_t operator()(vertex_t v) const
+  {
+    auto in  = static_cast<int64_t>(in_degrees[v]);
+    auto out = static_cast<int64_t>(out_degrees[v]);
+    return in * out - in - out + static_cast<int64_t>(contracted_neighbor_counts[v]);
+  }
+};
+
+// a vertex is contracted in this level only if its priority is smaller than the priorities of all
+// its remaining neighbors (ties are broken by vertex ID), so the contracted vertices form an
+// independent set
+template <typename vertex_t>
+struct unselect_lower_priority_endpoint_t {
+  int64_t const* priorities{nullptr};
+  uint8_t* selected{nullptr};
+
+  __device__ void operator()(thrust::tuple<vertex_t, vertex_t> e) const
+  {
+    auto u  = thrust::get<0>(e);
+    auto v  = thrust::get<1>(e);
+    auto pu = priorities[u];
+    auto pv = priorities[v];
+    if ((pu < pv) || ((pu == pv) && (u < v))) {
+      selected[v] = uint8_t{0};
+    } else {
+      selected[u] = uint8_t{0};
+    }
+  }
+};
+
+// shortcut i of the contracted vertex contracted_vertices[j] connects its k-th in-neighbor to its
+// l-th out-neighbor (k = (i - shortcut_offsets[j]) / out-degree, l = (i - shortcut_offsets[j]) %
+// out-degree), returns (src, dst, weight, middle, first weight)
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct generate_shortcut_t {
+  size_t const* shortcut_offsets{nullptr};
+  vertex_t const* contracted_vertices{nullptr};
+  size_t num_contracted_vertices{};
+  edge_t const* in_firsts{nullptr};
+  edge_t const* out_firsts{nullptr};
+  edge_t const* out_lasts{nullptr};
+  vertex_t const* in_nbrs{nullptr};
+  weight_t const* in_weights{nullptr};
+  vertex_t const* out_nbrs{nullptr};
+  weight_t const* out_weights{nullptr};
+
+  __device__ thrust::tuple<vertex_t, vertex_t, weight_t, vertex_t, weight_t> operator()(
+    size_t i) const
+  {
+    auto j = static_cast<size_t>(thrust::distance(
+               shortcut_offsets,
+               thrust::upper_bound(
+                 thrust::seq, shortcut_offsets, shortcut_offsets + num_contracted_vertices, i))) -
+             1;
+    auto k          = i - shortcut_offsets[j];
+    auto out_degree = static_cast<size_t>(out_lasts[j] - out_firsts[j]);
+    auto in_idx     = in_firsts[j] + static_cast<edge_t>(k / out_degree);
+    auto out_idx    = out_firsts[j] + static_cast<edge_t>(k % out_degree);
+    return thrust::make_tuple(in_nbrs[in_idx],
+                              out_nbrs[out_idx],
+                              in_weights[in_idx] + out_weights[out_idx],
+                              contracted_vertices[j],
+                              in_weights[in_idx]);
+  }
+};
+
+template <typename vertex_t, typename weight_t>
+struct has_same_first_two_elements_t {
+  __device__ bool operator()(thrust::tuple<vertex_t, vertex_t, weight_t> lhs,
+                             thrust::tuple<vertex_t, vertex_t, weight_t> rhs) const
+  {
+    return (thrust::get<0>(lhs) == thrust::get<0>(rhs)) &&
+           (thrust::get<1>(lhs) == thrust::get<1>(rhs));
+  }
+};
+
+// returns the index of the (first, second) key in the sorted key lists (or size if not found)
+template <typename vertex_t>
+struct find_pair_t {
+  vertex_t const* firsts{nullptr};
+  vertex_t const* seconds{nullptr};
+  size_t size{0};
+
+  __device__ size_t operator()(vertex_t first, vertex_t second) const
+  {
+    auto key_first = thrust::make_zip_iterator(thrust::make_tuple(firsts, seconds));
+    auto idx       = static_cast<size_t>(thrust::distance(
+      key_first,
+      thrust::lower_bound(
+        thrust::seq, key_first, key_first + size, thrust::make_tuple(first, second))));
+    return ((idx < size) && (firsts[idx] == first) && (seconds[idx] == second)) ? idx : size;
+  }
+};
+
+// edge lists of the graph remaining in the contraction, the middle vertex is invalid for input
+// edges
+template <typename vertex_t, typename weight_t>
+struct remaining_edges_t {
+  remaining_edges_t(raft::handle_t const& handle, size_t size)
+    : srcs(size, handle.get_stream()),
+      dsts(size, handle.get_stream()),
+      weights(size, handle.get_stream()),
+      middles(size, handle.get_stream()),
+      first_weights(size, handle.get_stream())
+  {
+  }
+
+  size_t size() const { return srcs.size(); }
+
+  void resize(raft::handle_t const& handle, size_t size)
+  {
+    srcs.resize(size, handle.get_stream());
+    dsts.resize(size, handle.get_stream());
+    weights.resize(size, handle.get_stream());
+    middles.resize(size, handle.get_stream());
+    first_weights.resize(size, handle.get_stream());
+  }
+
+  auto begin()
+  {
+    return thrust::make_zip_iterator(thrust::make_tuple(
+      srcs.begin(), dsts.begin(), weights.begin(), middles.begin(), first_weights.begin()));
+  }
+
+  auto end() { return begin() + size(); }
+
+  // edges viewed in the reversed direction (the shortcut fields stay in the input direction)
+  auto reversed_begin()
+  {
+    return thrust::make_zip_iterator(thrust::make_tuple(
+      dsts.begin(), srcs.begin(), weights.begin(), middles.begin(), first_weights.begin()));
+  }
+
+  rmm::device_uvector<vertex_t> srcs;
+  rmm::device_uvector<vertex_t> dsts;
+  rmm::device_uvector<weight_t> weights;
+  rmm::device_uvector<vertex_t> middles;
+  rmm::device_uvector<weight_t> first_weights;
+};
+
+// sort edges and keep only the minimum weight edge of each (src, dst) pair
+template <typename vertex_t, typename weight_t>
+void sort_and_reduce_parallel_edges(raft::handle_t const& handle,
+                                    remaining_edges_t<vertex_t, weight_t>& edges)
+{
+  auto key_first = thrust::make_zip_iterator(
+    thrust::make_tuple(edges.srcs.begin(), edges.dsts.begin(), edges.weights.begin()));
+  auto value_first = thrust::make_zip_iterator(
+    thrust::make_tuple(edges.middles.begin(), edges.first_weights.begin()));
+  thrust::sort_by_key(handle.get_thrust_policy(), key_first, key_first + edges.size(), value_first);
+  auto num_edges = static_cast<size_t>(thrust::distance(
+    key_first,
+    thrust::get<0>(thrust::unique_by_key(handle.get_thrust_policy(),
+                                         key_first,
+                                         key_first + edges.size(),
+                                         value_first,
+                                         has_same_first_two_elements_t<vertex_t, weight_t>{}))));
+  edges.resize(handle, num_edges);
+}
+
+// computes the distance from each seed to every vertex reached within max_hops hops (and within
+// bounds[tag], if bounds is not nullptr) in the graph given in CSR, returns (tag, vertex, distance,
+// predecessor) quadruplets sorted by (tag, vertex), the tag of a search is the index of its seed
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>,
+           rmm::device_uvector<vertex_t>>
+bounded_search(raft::handle_t const& handle,
+               edge_t const* offsets,
+               vertex_t const* indices,
+               weight_t const* weights,
+               raft::device_span<vertex_t const> seeds,
+               weight_t const* bounds,
+               size_t max_hops)
+{
+  // visited (tag, vertex, distance, predecessor) quadruplets
+
+  rmm::device_uvector<vertex_t> tags(seeds.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> vertices(seeds.size(), handle.get_stream());
+  rmm::device_uvector<weight_t> distances(seeds.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> predecessors(seeds.size(), handle.get_stream());
+  thrust::sequence(handle.get_thrust_policy(), tags.begin(), tags.end(), vertex_t{0});
+  thrust::copy(handle.get_thrust_policy(), seeds.begin(), seeds.end(), vertices.begin());
+  thrust::fill(handle.get_thrust_policy(), distances.begin(), distances.end(), weight_t{0.0});
+  thrust::fill(handle.get_thrust_policy(),
+               predecessors.begin(),
+               predecessors.end(),
+               invalid_vertex_id<vertex_t>::value);
+
+  // frontier (triplets updated in the previous iteration)
+
+  rmm::device_uvector<vertex_t> frontier_tags(tags.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> frontier_vertices(vertices.size(), handle.get_stream());
+  rmm::device_uvector<weight_t> frontier_distances(distances.size(), handle.get_stream());
+  thrust::copy(handle.get_thrust_policy(),
+               thrust::make_zip_iterator(
+                 thrust::make_tuple(tags.begin(), vertices.begin(), distances.begin())),
+               thrust::make_zip_iterator(
+                 thrust::make_tuple(tags.end(), vertices.end(), distances.end())),
+               thrust::make_zip_iterator(thrust::make_tuple(
+                 frontier_tags.begin(), frontier_vertices.begin(), frontier_distances.begin())));
+
+  for (size_t hop = 0; (hop < max_hops) && (frontier_tags.size() > 0); ++hop) {
+    // 1. expand the frontier
+
+    rmm::device_uvector<size_t> expansion_offsets(frontier_vertices.size() + 1,
+                                                  handle.get_stream());
+    expansion_offsets.set_element_to_zero_async(0, handle.get_stream());
+    thrust::transform_inclusive_scan(
+      handle.get_thrust_policy(),
+      frontier_vertices.begin(),
+      frontier_vertices.end(),
+      expansion_offsets.begin() + 1,
+      [offsets] __device__(auto v) { return static_cast<size_t>(offsets[v + 1] - offsets[v]); },
+      thrust::plus<size_t>{});
+    auto num_expanded = expansion_offsets.back_element(handle.get_stream());
+
+    rmm::device_uvector<vertex_t> new_tags(num_expanded, handle.get_stream());
+    rmm::device_uvector<vertex_t> new_vertices(num_expanded, handle.get_stream());
+    rmm::device_uvector<weight_t> new_distances(num_expanded, handle.get_stream());
+    rmm::device_uvector<vertex_t> new_predecessors(num_expanded, handle.get_stream());
+    auto new_first = thrust::make_zip_iterator(
+      thrust::make_tuple(new_tags.begin(), new_vertices.begin(), new_distances.begin()));
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(num_expanded),
+      thrust::make_zip_iterator(thrust::make_tuple(new_first, new_predecessors.begin())),
+      [expansion_offsets  = expansion_offsets.data(),
+       num_frontier       = frontier_vertices.size(),
+       frontier_tags      = frontier_tags.data(),
+       frontier_vertices  = frontier_vertices.data(),
+       frontier_distances = frontier_distances.data(),
+       offsets,
+       indices,
+       weights] __device__(size_t i) {
+        auto j = static_cast<size_t>(thrust::distance(
+                   expansion_offsets,
+                   thrust::upper_bound(
+                     thrust::seq, expansion_offsets, expansion_offsets + num_frontier, i))) -
+                 1;
+        auto v = frontier_vertices[j];
+        auto e = offsets[v] + static_cast<edge_t>(i - expansion_offsets[j]);
+        return thrust::make_tuple(
+          thrust::make_tuple(frontier_tags[j], indices[e], frontier_distances[j] + weights[e]), v);
+      });
+
+    // 2. keep the minimum distance per (tag, vertex) and drop the triplets out of bounds or not
+    // improving the visited distance
+
+    thrust::sort_by_key(
+      handle.get_thrust_policy(), new_first, new_first + num_expanded, new_predecessors.begin());
+    auto num_unique = static_cast<size_t>(thrust::distance(
+      new_first,
+      thrust::get<0>(thrust::unique_by_key(handle.get_thrust_policy(),
+                                           new_first,
+                                           new_first + num_expanded,
+                                           new_predecessors.begin(),
+                                           has_same_first_two_elements_t<vertex_t, weight_t>{}))));
+
+    auto visited_key_first =
+      thrust::make_zip_iterator(thrust::make_tuple(tags.begin(), vertices.begin()));
+    auto new_key_first =
+      thrust::make_zip_iterator(thrust::make_tuple(new_tags.begin(), new_vertices.begin()));
+    rmm::device_uvector<size_t> visited_indices(num_unique, handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      new_tags.begin(),
+                      new_tags.begin() + num_unique,
+                      new_vertices.begin(),
+                      visited_indices.begin(),
+                      find_pair_t<vertex_t>{tags.data(), vertices.data(), tags.size()});
+
+    auto quadruplet_first = thrust::make_zip_iterator(
+      thrust::make_tuple(new_first, new_predecessors.begin(), visited_indices.begin()));
+    auto num_improved = static_cast<size_t>(thrust::distance(
+      quadruplet_first,
+      thrust::remove_if(handle.get_thrust_policy(),
+                        quadruplet_first,
+                        quadruplet_first + num_unique,
+                        [distances   = distances.data(),
+                         num_visited = tags.size(),
+                         bounds] __device__(auto val) {
+                          auto triplet = thrust::get<0>(val);
+                          auto idx     = thrust::get<2>(val);
+                          if ((bounds != nullptr) &&
+                              (thrust::get<2>(triplet) > bounds[thrust::get<0>(triplet)])) {
+                            return true;
+                          }
+                          return (idx < num_visited) && (distances[idx] <= thrust::get<2>(triplet));
+                        })));
+
+    // 3. update the visited distances in place and merge the newly visited triplets
+
+    auto num_existing = static_cast<size_t>(thrust::distance(
+      quadruplet_first,
+      thrust::stable_partition(
+        handle.get_thrust_policy(),
+        quadruplet_first,
+        quadruplet_first + num_improved,
+        [num_visited = tags.size()] __device__(auto val) {
+          return thrust::get<2>(val) < num_visited;
+        })));
+
+    thrust::for_each(handle.get_thrust_policy(),
+                     quadruplet_first,
+                     quadruplet_first + num_existing,
+                     [distances    = distances.data(),
+                      predecessors = predecessors.data()] __device__(auto val) {
+                       auto idx          = thrust::get<2>(val);
+                       distances[idx]    = thrust::get<2>(thrust::get<0>(val));
+                       predecessors[idx] = thrust::get<1>(val);
+                     });
+
+    rmm::device_uvector<vertex_t> merged_tags(tags.size() + (num_improved - num_existing),
+                                              handle.get_stream());
+    rmm::device_uvector<vertex_t> merged_vertices(merged_tags.size(), handle.get_stream());
+    rmm::device_uvector<weight_t> merged_distances(merged_tags.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> merged_predecessors(merged_tags.size(), handle.get_stream());
+    thrust::merge_by_key(
+      handle.get_thrust_policy(),
+      visited_key_first,
+      visited_key_first + tags.size(),
+      new_key_first + num_existing,
+      new_key_first + num_improved,
+      thrust::make_zip_iterator(thrust::make_tuple(distances.begin(), predecessors.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(new_distances.begin() + num_existing,
+                                                   new_predecessors.begin() + num_existing)),
+      thrust::make_zip_iterator(thrust::make_tuple(merged_tags.begin(), merged_vertices.begin())),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(merged_distances.begin(), merged_predecessors.begin())));
+    tags         = std::move(merged_tags);
+    vertices     = std::move(merged_vertices);
+    distances    = std::move(merged_distances);
+    predecessors = std::move(merged_predecessors);
+
+    new_tags.resize(num_improved, handle.get_stream());
+    new_vertices.resize(num_improved, handle.get_stream());
+    new_distances.resize(num_improved, handle.get_stream());
+
+    frontier_tags      = std::move(new_tags);
+    frontier_vertices  = std::move(new_vertices);
+    frontier_distances = std::move(new_distances);
+  }
+
+  return std::make_tuple(
+    std::move(tags), std::move(vertices), std::move(distances), std::move(predecessors));
+}
+
+// drop the shortcuts in [num_kept_edges, edges.size()) with a witness path (a path as short as the
+// shortcut in the graph of the kept edges, so avoiding every vertex contracted in this level), the
+// witness search is bounded to max_witness_hops hops and to the longest shortcut from the source
+template <typename vertex_t, typename edge_t, typename weight_t>
+void remove_witnessed_shortcuts(raft::handle_t const& handle,
+                                vertex_t num_vertices,
+                                remaining_edges_t<vertex_t, weight_t>& edges,
+                                size_t num_kept_edges,
+                                size_t max_witness_hops)
+{
+  auto edge_first = edges.begin();
+  thrust::sort(handle.get_thrust_policy(), edge_first, edge_first + num_kept_edges);
+  thrust::sort(handle.get_thrust_policy(), edge_first + num_kept_edges, edge_first + edges.size());
+  auto num_shortcuts = edges.size() - num_kept_edges;
+
+  rmm::device_uvector<edge_t> offsets(num_vertices + 1, handle.get_stream());
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      edges.srcs.begin(),
+                      edges.srcs.begin() + num_kept_edges,
+                      thrust::make_counting_iterator(vertex_t{0}),
+                      thrust::make_counting_iterator(num_vertices + 1),
+                      offsets.begin());
+
+  rmm::device_uvector<vertex_t> seeds(num_shortcuts, handle.get_stream());
+  rmm::device_uvector<weight_t> bounds(num_shortcuts, handle.get_stream());
+  seeds.resize(thrust::distance(seeds.begin(),
+                                thrust::get<0>(thrust::reduce_by_key(
+                                  handle.get_thrust_policy(),
+                                  edges.srcs.begin() + num_kept_edges,
+                                  edges.srcs.end(),
+                                  edges.weights.begin() + num_kept_edges,
+                                  seeds.begin(),
+                                  bounds.begin(),
+                                  thrust::equal_to<vertex_t>{},
+                                  thrust::maximum<weight_t>{}))),
+               handle.get_stream());
+  bounds.resize(seeds.size(), handle.get_stream());
+
+  auto [tags, vertices, distances, predecessors] =
+    bounded_search(handle,
+                   offsets.data(),
+                   edges.dsts.data(),
+                   edges.weights.data(),
+                   raft::device_span<vertex_t const>(seeds.data(), seeds.size()),
+                   bounds.data(),
+                   max_witness_hops);
+  predecessors.resize(0, handle.get_stream());
+  predecessors.shrink_to_fit(handle.get_stream());
+
+  edges.resize(
+    handle,
+    num_kept_edges +
+      static_cast<size_t>(thrust::distance(
+        edge_first + num_kept_edges,
+        thrust::remove_if(
+          handle.get_thrust_policy(),
+          edge_first + num_kept_edges,
+          edge_first + edges.size(),
+          [seeds        = seeds.data(),
+           num_seeds    = seeds.size(),
+           find_reached = find_pair_t<vertex_t>{tags.data(), vertices.data(), tags.size()},
+           distances    = distances.data()] __device__(auto e) {
+            auto tag = static_cast<vertex_t>(thrust::distance(
+              seeds,
+              thrust::lower_bound(thrust::seq, seeds, seeds + num_seeds, thrust::get<0>(e))));
+            auto idx = find_reached(tag, thrust::get<1>(e));
+            return (idx != find_reached.size) && (distances[idx] <= thrust::get<2>(e));
+          }))));
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+contraction_hierarchy_t<vertex_t, edge_t, weight_t> build_contraction_hierarchy(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, false> const& graph_view,
+  bool do_expensive_check)
+{
+  auto constexpr invalid_level  = invalid_vertex_id<vertex_t>::value;
+  auto constexpr invalid_middle = invalid_vertex_id<vertex_t>::value;
+
+  // witness paths longer than this (in hops) are not searched for, the shortcut is inserted
+  size_t constexpr max_witness_hops{5};
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(graph_view.is_weighted(),
+                  "Invalid input argument: a contraction hierarchy requires a weighted graph.");
+
+  auto num_vertices = graph_view.number_of_vertices();
+
+  remaining_edges_t<vertex_t, weight_t> edges(handle, 0);
+  {
+    std::optional<rmm::device_uvector<weight_t>> weights{std::nullopt};
+    std::tie(edges.srcs, edges.dsts, weights) =
+      graph_view.decompress_to_edgelist(handle, std::nullopt);
+    edges.weights = std::move(*weights);
+  }
+  edges.middles.resize(edges.srcs.size(), handle.get_stream());
+  edges.first_weights.resize(edges.srcs.size(), handle.get_stream());
+  thrust::fill(
+    handle.get_thrust_policy(), edges.middles.begin(), edges.middles.end(), invalid_middle);
+  thrust::fill(handle.get_thrust_policy(),
+               edges.first_weights.begin(),
+               edges.first_weights.end(),
+               weight_t{0.0});
+
+  if (do_expensive_check) {
+    auto num_negative_edge_weights =
+      thrust::count_if(handle.get_thrust_policy(),
+                       edges.weights.begin(),
+                       edges.weights.end(),
+                       [] __device__(auto w) { return w < 0.0; });
+    CUGRAPH_EXPECTS(num_negative_edge_weights == 0,
+                    "Invalid input argument: input graph should have non-negative edge weights.");
+  }
+
+  // 2. remove self-loops and parallel edges (self-loops do not lie on any shortest path)
+
+  auto is_self_loop = [] __device__(auto e) { return thrust::get<0>(e) == thrust::get<1>(e); };
+  edges.resize(handle,
+               static_cast<size_t>(thrust::distance(
+                 edges.begin(),
+                 thrust::remove_if(
+                   handle.get_thrust_policy(), edges.begin(), edges.end(), is_self_loop))));
+  sort_and_reduce_parallel_edges(handle, edges);
+
+  // 3. contract an independent set of the remaining graph per level
+
+  rmm::device_uvector<vertex_t> levels(num_vertices, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), levels.begin(), levels.end(), invalid_level);
+
+  rmm::device_uvector<edge_t> in_degrees(num_vertices, handle.get_stream());
+  rmm::device_uvector<edge_t> out_degrees(num_vertices, handle.get_stream());
+  rmm::device_uvector<edge_t> contracted_neighbor_counts(num_vertices, handle.get_stream());
+  rmm::device_uvector<int64_t> priorities(num_vertices, handle.get_stream());
+  rmm::device_uvector<uint8_t> selected(num_vertices, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(),
+               contracted_neighbor_counts.begin(),
+               contracted_neighbor_counts.end(),
+               edge_t{0});
+
+  rmm::device_uvector<vertex_t> upward_srcs(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> upward_dsts(0, handle.get_stream());
+  rmm::device_uvector<weight_t> upward_weights(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> downward_srcs(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> downward_dsts(0, handle.get_stream());
+  rmm::device_uvector<weight_t> downward_weights(0, handle.get_stream());
+  remaining_edges_t<vertex_t, weight_t> shortcuts(handle, 0);
+
+  auto num_remaining_vertices = num_vertices;
+  vertex_t level{0};
+  while (num_remaining_vertices > 0) {
+    // 3-1. select the vertices to contract
+
+    thrust::fill(handle.get_thrust_policy(), in_degrees.begin(), in_degrees.end(), edge_t{0});
+    thrust::fill(handle.get_thrust_policy(), out_degrees.begin(), out_degrees.end(), edge_t{0});
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(thrust::make_tuple(edges.srcs.begin(), edges.dsts.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(edges.srcs.end(), edges.dsts.end())),
+      [in_degrees = in_degrees.data(), out_degrees = out_degrees.data()] __device__(auto e) {
+        atomicAdd(out_degrees + thrust::get<0>(e), edge_t{1});
+        atomicAdd(in_degrees + thrust::get<1>(e), edge_t{1});
+      });
+    thrust::transform(handle.get_thrust_policy(),
+                      thrust::make_counting_iterator(vertex_t{0}),
+                      thrust::make_counting_iterator(num_vertices),
+                      priorities.begin(),
+                      contraction_priority_t<vertex_t, edge_t>{in_degrees.data(),
+                                                                out_degrees.data(),
+                                                                contracted_neighbor_counts.data()});
+    thrust::transform(handle.get_thrust_policy(),
+                      levels.begin(),
+                      levels.end(),
+                      selected.begin(),
+                      [] __device__(auto l) {
+                        return l == invalid_level ? uint8_t{1} : uint8_t{0};
+                      });
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(thrust::make_tuple(edges.srcs.begin(), edges.dsts.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(edges.srcs.end(), edges.dsts.end())),
+      unselect_lower_priority_endpoint_t<vertex_t>{priorities.data(), selected.data()});
+
+    rmm::device_uvector<vertex_t> contracted_vertices(num_remaining_vertices, handle.get_stream());
+    contracted_vertices.resize(
+      thrust::distance(contracted_vertices.begin(),
+                       thrust::copy_if(handle.get_thrust_policy(),
+                                       thrust::make_counting_iterator(vertex_t{0}),
+                                       thrust::make_counting_iterator(num_vertices),
+                                       selected.begin(),
+                                       contracted_vertices.begin(),
+                                       thrust::identity<uint8_t>{})),
+      handle.get_stream());
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      contracted_vertices.begin(),
+      contracted_vertices.end(),
+      [levels = levels.data(), level] __device__(auto v) { levels[v] = level; });
+    num_remaining_vertices -= static_cast<vertex_t>(contracted_vertices.size());
+
+    // 3-2. move the edges incident to the contracted vertices to the upward (out-edges) and the
+    // downward (in-edges, reversed) graphs
+
+    auto edge_first     = edges.begin();
+    auto num_kept_edges = static_cast<size_t>(thrust::distance(
+      edge_first,
+      thrust::partition(handle.get_thrust_policy(),
+                        edge_first,
+                        edge_first + edges.size(),
+                        [selected = selected.data()] __device__(auto e) {
+                          return (selected[thrust::get<0>(e)] == uint8_t{0}) &&
+                                 (selected[thrust::get<1>(e)] == uint8_t{0});
+                        })));
+    auto num_removed_edges = edges.size() - num_kept_edges;
+
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      edge_first + num_kept_edges,
+      edge_first + edges.size(),
+      [selected                   = selected.data(),
+       contracted_neighbor_counts = contracted_neighbor_counts.data()] __device__(auto e) {
+        auto v = selected[thrust::get<0>(e)] ? thrust::get<1>(e) : thrust::get<0>(e);
+        atomicAdd(contracted_neighbor_counts + v, edge_t{1});
+      });
+
+    // the removed shortcuts are recorded (in the input edge direction) for path unpacking
+    {
+      auto is_shortcut = [] __device__(auto e) { return thrust::get<3>(e) != invalid_middle; };
+      auto num_removed_shortcuts = static_cast<size_t>(thrust::count_if(
+        handle.get_thrust_policy(), edge_first + num_kept_edges, edges.end(), is_shortcut));
+      auto old_size = shortcuts.size();
+      shortcuts.resize(handle, old_size + num_removed_shortcuts);
+      thrust::copy_if(handle.get_thrust_policy(),
+                      edge_first + num_kept_edges,
+                      edges.end(),
+                      shortcuts.begin() + old_size,
+                      is_shortcut);
+    }
+
+    // edges with a contracted source come first, sorted by (source, destination)
+    auto num_out_edges = static_cast<size_t>(thrust::distance(
+      edge_first + num_kept_edges,
+      thrust::partition(handle.get_thrust_policy(),
+                        edge_first + num_kept_edges,
+                        edge_first + edges.size(),
+                        [selected = selected.data()] __device__(auto e) {
+                          return selected[thrust::get<0>(e)] != uint8_t{0};
+                        })));
+    auto num_in_edges = num_removed_edges - num_out_edges;
+    thrust::sort(handle.get_thrust_policy(),
+                 edge_first + num_kept_edges,
+                 edge_first + num_kept_edges + num_out_edges);
+    // edges with a contracted destination are reversed and sorted by (destination, source)
+    auto in_edge_first = edges.reversed_begin();
+    thrust::sort(handle.get_thrust_policy(),
+                 in_edge_first + num_kept_edges + num_out_edges,
+                 in_edge_first + edges.size());
+
+    auto triplet_first = thrust::make_zip_iterator(
+      thrust::make_tuple(edges.srcs.begin(), edges.dsts.begin(), edges.weights.begin()));
+    auto old_upward_size = upward_srcs.size();
+    upward_srcs.resize(old_upward_size + num_out_edges, handle.get_stream());
+    upward_dsts.resize(upward_srcs.size(), handle.get_stream());
+    upward_weights.resize(upward_srcs.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 triplet_first + num_kept_edges,
+                 triplet_first + num_kept_edges + num_out_edges,
+                 thrust::make_zip_iterator(thrust::make_tuple(upward_srcs.begin(),
+                                                              upward_dsts.begin(),
+                                                              upward_weights.begin())) +
+                   old_upward_size);
+
+    auto in_triplet_first = thrust::make_zip_iterator(
+      thrust::make_tuple(edges.dsts.begin(), edges.srcs.begin(), edges.weights.begin()));
+    auto old_downward_size = downward_srcs.size();
+    downward_srcs.resize(old_downward_size + num_in_edges, handle.get_stream());
+    downward_dsts.resize(downward_srcs.size(), handle.get_stream());
+    downward_weights.resize(downward_srcs.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 in_triplet_first + num_kept_edges + num_out_edges,
+                 in_triplet_first + edges.size(),
+                 thrust::make_zip_iterator(thrust::make_tuple(downward_srcs.begin(),
+                                                              downward_dsts.begin(),
+                                                              downward_weights.begin())) +
+                   old_downward_size);
+
+    // 3-3. insert a shortcut between every (in-neighbor, out-neighbor) pair of each contracted
+    // vertex unless a witness path is found
+
+    auto out_vertex_first = upward_srcs.begin() + old_upward_size;
+    auto out_vertex_last  = upward_srcs.end();
+    auto in_vertex_first  = downward_srcs.begin() + old_downward_size;
+    auto in_vertex_last   = downward_srcs.end();
+
+    rmm::device_uvector<edge_t> in_firsts(contracted_vertices.size(), handle.get_stream());
+    rmm::device_uvector<edge_t> in_lasts(contracted_vertices.size(), handle.get_stream());
+    rmm::device_uvector<edge_t> out_firsts(contracted_vertices.size(), handle.get_stream());
+    rmm::device_uvector<edge_t> out_lasts(contracted_vertices.size(), handle.get_stream());
+    thrust::lower_bound(handle.get_thrust_policy(),
+                        in_vertex_first,
+                        in_vertex_last,
+                        contracted_vertices.begin(),
+                        contracted_vertices.end(),
+                        in_firsts.begin());
+    thrust::upper_bound(handle.get_thrust_policy(),
+                        in_vertex_first,
+                        in_vertex_last,
+                        contracted_vertices.begin(),
+                        contracted_vertices.end(),
+                        in_lasts.begin());
+    thrust::lower_bound(handle.get_thrust_policy(),
+                        out_vertex_first,
+                        out_vertex_last,
+                        contracted_vertices.begin(),
+                        contracted_vertices.end(),
+                        out_firsts.begin());
+    thrust::upper_bound(handle.get_thrust_policy(),
+                        out_vertex_first,
+                        out_vertex_last,
+                        contracted_vertices.begin(),
+                        contracted_vertices.end(),
+                        out_lasts.begin());
+
+    rmm::device_uvector<size_t> shortcut_offsets(contracted_vertices.size() + 1,
+                                                 handle.get_stream());
+    shortcut_offsets.set_element_to_zero_async(0, handle.get_stream());
+    thrust::transform_inclusive_scan(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(thrust::make_tuple(
+        in_firsts.begin(), in_lasts.begin(), out_firsts.begin(), out_lasts.begin())),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(in_firsts.end(), in_lasts.end(), out_firsts.end(), out_lasts.end())),
+      shortcut_offsets.begin() + 1,
+      [] __device__(auto ranges) {
+        return static_cast<size_t>(thrust::get<1>(ranges) - thrust::get<0>(ranges)) *
+               static_cast<size_t>(thrust::get<3>(ranges) - thrust::get<2>(ranges));
+      },
+      thrust::plus<size_t>{});
+    auto num_shortcuts =
+      shortcut_offsets.back_element(handle.get_stream());  // synchronizes the stream
+
+    edges.resize(handle, num_kept_edges + num_shortcuts);
+    edge_first = edges.begin();
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(num_shortcuts),
+      edge_first + num_kept_edges,
+      generate_shortcut_t<vertex_t, edge_t, weight_t>{shortcut_offsets.data(),
+                                                      contracted_vertices.data(),
+                                                      contracted_vertices.size(),
+                                                      in_firsts.data(),
+                                                      out_firsts.data(),
+                                                      out_lasts.data(),
+                                                      downward_dsts.data() + old_downward_size,
+                                                      downward_weights.data() + old_downward_size,
+                                                      upward_dsts.data() + old_upward_size,
+                                                      upward_weights.data() + old_upward_size});
+
+    edges.resize(handle,
+                 static_cast<size_t>(thrust::distance(
+                   edge_first,
+                   thrust::remove_if(handle.get_thrust_policy(),
+                                     edge_first + num_kept_edges,
+                                     edge_first + edges.size(),
+                                     is_self_loop))));
+    if ((edges.size() > num_kept_edges) && (num_kept_edges > 0)) {
+      remove_witnessed_shortcuts<vertex_t, edge_t, weight_t>(
+        handle, num_vertices, edges, num_kept_edges, max_witness_hops);
+    }
+    sort_and_reduce_parallel_edges(handle, edges);
+
+    ++level;
+  }
+
+  // 4. build the upward and the downward graphs and the shortcut table
+
+  graph_t<vertex_t, edge_t, weight_t, false, false> upward_graph(
+    handle,
+    std::move(upward_srcs),
+    std::move(upward_dsts),
+    std::make_optional(std::move(upward_weights)),
+    graph_meta_t<vertex_t, edge_t, false>{num_vertices, graph_properties_t{false, false}});
+  graph_t<vertex_t, edge_t, weight_t, false, false> downward_graph(
+    handle,
+    std::move(downward_srcs),
+    std::move(downward_dsts),
+    std::make_optional(std::move(downward_weights)),
+    graph_meta_t<vertex_t, edge_t, false>{num_vertices, graph_properties_t{false, false}});
+
+  // an edge is moved once (when its first endpoint is contracted), so (src, dst) is unique
+  thrust::sort(handle.get_thrust_policy(), shortcuts.begin(), shortcuts.end());
+  shortcuts.weights.resize(0, handle.get_stream());
+  shortcuts.weights.shrink_to_fit(handle.get_stream());
+
+  return contraction_hierarchy_t<vertex_t, edge_t, weight_t>{std::move(levels),
+                                                             std::move(upward_graph),
+                                                             std::move(downward_graph),
+                                                             std::move(shortcuts.srcs),
+                                                             std::move(shortcuts.dsts),
+                                                             std::move(shortcuts.middles),
+                                                             std::move(shortcuts.first_weights)};
+}
+
+// runs the upward searches from the sources (in the upward graph) and from the targets (in the
+// reversed downward graph) and returns the shortest distance and the meeting vertex (with the
+// smallest vertex ID among the meeting vertices of the shortest paths) of each query, with the
+// search results, the meeting vertex is invalid if the target is unreachable
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<rmm::device_uvector<weight_t>,
+           rmm::device_uvector<vertex_t>,
+           std::tuple<rmm::device_uvector<vertex_t>,
+                      rmm::device_uvector<vertex_t>,
+                      rmm::device_uvector<weight_t>,
+                      rmm::device_uvector<vertex_t>>,
+           std::tuple<rmm::device_uvector<vertex_t>,
+                      rmm::device_uvector<vertex_t>,
+                      rmm::device_uvector<weight_t>,
+                      rmm::device_uvector<vertex_t>>>
+meet_upward_searches(raft::handle_t const& handle,
+                     contraction_hierarchy_t<vertex_t, edge_t, weight_t> const& hierarchy,
+                     raft::device_span<vertex_t const> sources,
+                     raft::device_span<vertex_t const> targets,
+                     bool do_expensive_check)
+{
+  auto constexpr invalid_distance = std::numeric_limits<weight_t>::max();
+  auto constexpr invalid_vertex   = invalid_vertex_id<vertex_t>::value;
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((sources.size() == targets.size()) || (sources.size() == 1),
+                  "Invalid input argument: sources should have one element or the same size as "
+                  "targets.");
+
+  auto upward_graph_view   = hierarchy.upward_graph.view();
+  auto downward_graph_view = hierarchy.downward_graph.view();
+
+  if (do_expensive_check) {
+    auto num_vertices = upward_graph_view.number_of_vertices();
+    auto is_invalid   = [num_vertices] __device__(auto v) {
+      return !((v >= vertex_t{0}) && (v < num_vertices));
+    };
+    auto num_invalid_vertices =
+      thrust::count_if(handle.get_thrust_policy(), sources.begin(), sources.end(), is_invalid) +
+      thrust::count_if(handle.get_thrust_policy(), targets.begin(), targets.end(), is_invalid);
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input argument: sources or targets have invalid vertex IDs.");
+  }
+
+  // 2. run the upward searches, the graphs are DAGs in the contraction level order so the searches
+  // terminate without a hop limit
+
+  auto forward_search = bounded_search(
+    handle,
+    upward_graph_view.local_edge_partition_view().offsets(),
+    upward_graph_view.local_edge_partition_view().indices(),
+    *(upward_graph_view.local_edge_partition_view().weights()),
+    sources,
+    static_cast<weight_t const*>(nullptr),
+    std::numeric_limits<size_t>::max());
+  auto backward_search = bounded_search(
+    handle,
+    downward_graph_view.local_edge_partition_view().offsets(),
+    downward_graph_view.local_edge_partition_view().indices(),
+    *(downward_graph_view.local_edge_partition_view().weights()),
+    targets,
+    static_cast<weight_t const*>(nullptr),
+    std::numeric_limits<size_t>::max());
+
+  auto const& forward_tags       = std::get<0>(forward_search);
+  auto const& forward_vertices   = std::get<1>(forward_search);
+  auto const& forward_distances  = std::get<2>(forward_search);
+  auto const& backward_tags      = std::get<0>(backward_search);
+  auto const& backward_vertices  = std::get<1>(backward_search);
+  auto const& backward_distances = std::get<2>(backward_search);
+
+  // 3. the distance of query i is the minimum forward distance + backward distance over the
+  // vertices visited by both searches
+
+  rmm::device_uvector<weight_t> candidate_distances(backward_tags.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> candidate_meetings(backward_tags.size(), handle.get_stream());
+  thrust::transform(
+    handle.get_thrust_policy(),
+    thrust::make_zip_iterator(thrust::make_tuple(
+      backward_tags.begin(), backward_vertices.begin(), backward_distances.begin())),
+    thrust::make_zip_iterator(
+      thrust::make_tuple(backward_tags.end(), backward_vertices.end(), backward_distances.end())),
+    thrust::make_zip_iterator(
+      thrust::make_tuple(candidate_distances.begin(), candidate_meetings.begin())),
+    [find_forward = find_pair_t<vertex_t>{forward_tags.data(),
+                                          forward_vertices.data(),
+                                          forward_tags.size()},
+     forward_distances = forward_distances.data(),
+     one_to_many       = (sources.size() == 1)] __device__(auto triplet) {
+      auto v   = thrust::get<1>(triplet);
+      auto idx = find_forward(one_to_many ? vertex_t{0} : thrust::get<0>(triplet), v);
+      return idx != find_forward.size
+               ? thrust::make_tuple(forward_distances[idx] + thrust::get<2>(triplet), v)
+               : thrust::make_tuple(invalid_distance, invalid_vertex);
+    });
+
+  rmm::device_uvector<vertex_t> query_ids(backward_tags.size(), handle.get_stream());
+  rmm::device_uvector<weight_t> query_distances(backward_tags.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> query_meetings(backward_tags.size(), handle.get_stream());
+  auto num_queries = static_cast<size_t>(thrust::distance(
+    query_ids.begin(),
+    thrust::get<0>(thrust::reduce_by_key(
+      handle.get_thrust_policy(),
+      backward_tags.begin(),
+      backward_tags.end(),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(candidate_distances.begin(), candidate_meetings.begin())),
+      query_ids.begin(),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(query_distances.begin(), query_meetings.begin())),
+      thrust::equal_to<vertex_t>{},
+      [] __device__(auto lhs, auto rhs) { return lhs < rhs ? lhs : rhs; }))));
+
+  rmm::device_uvector<weight_t> distances(targets.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> meetings(targets.size(), handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), distances.begin(), distances.end(), invalid_distance);
+  thrust::fill(handle.get_thrust_policy(), meetings.begin(), meetings.end(), invalid_vertex);
+  thrust::scatter(
+    handle.get_thrust_policy(),
+    thrust::make_zip_iterator(thrust::make_tuple(query_distances.begin(), query_meetings.begin())),
+    thrust::make_zip_iterator(thrust::make_tuple(query_distances.begin(), query_meetings.begin())) +
+      num_queries,
+    query_ids.begin(),
+    thrust::make_zip_iterator(thrust::make_tuple(distances.begin(), meetings.begin())));
+
+  return std::make_tuple(std::move(distances),
+                         std::move(meetings),
+                         std::move(forward_search),
+                         std::move(backward_search));
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+rmm::device_uvector<weight_t> contraction_hierarchy_distances(
+  raft::handle_t const& handle,
+  contraction_hierarchy_t<vertex_t, edge_t, weight_t> const& hierarchy,
+  raft::device_span<vertex_t const> sources,
+  raft::device_span<vertex_t const> targets,
+  bool do_expensive_check)
+{
+  return std::get<0>(
+    meet_upward_searches(handle, hierarchy, sources, targets, do_expensive_check));
+}
+
+// walk the predecessors of an upward search from the meeting vertex of every query at once, the
+// vertex reached after i hops is appended to the path elements with the order i (backward search,
+// skipping the meeting vertex) or -i (forward search)
+template <typename vertex_t, typename weight_t>
+void walk_upward_search_predecessors(
+  raft::handle_t const& handle,
+  std::tuple<rmm::device_uvector<vertex_t>,
+             rmm::device_uvector<vertex_t>,
+             rmm::device_uvector<weight_t>,
+             rmm::device_uvector<vertex_t>> const& search,
+  bool backward,
+  bool one_to_many,
+  rmm::device_uvector<weight_t> const& query_distances,
+  rmm::device_uvector<vertex_t> const& query_meetings,
+  rmm::device_uvector<vertex_t>& path_queries,
+  rmm::device_uvector<vertex_t>& path_orders,
+  rmm::device_uvector<vertex_t>& path_vertices,
+  rmm::device_uvector<weight_t>& path_distances)
+{
+  auto const& tags         = std::get<0>(search);
+  auto const& vertices     = std::get<1>(search);
+  auto const& distances    = std::get<2>(search);
+  auto const& predecessors = std::get<3>(search);
+
+  auto num_queries = query_meetings.size();
+  rmm::device_uvector<vertex_t> walker_queries(num_queries, handle.get_stream());
+  rmm::device_uvector<vertex_t> walker_vertices(num_queries, handle.get_stream());
+  auto walker_first = thrust::make_zip_iterator(
+    thrust::make_tuple(walker_queries.begin(), walker_vertices.begin()));
+  walker_queries.resize(
+    thrust::distance(
+      walker_first,
+      thrust::copy_if(handle.get_thrust_policy(),
+                      thrust::make_zip_iterator(thrust::make_tuple(
+                        thrust::make_counting_iterator(vertex_t{0}), query_meetings.begin())),
+                      thrust::make_zip_iterator(thrust::make_tuple(
+                        thrust::make_counting_iterator(static_cast<vertex_t>(num_queries)),
+                        query_meetings.end())),
+                      walker_first,
+                      [] __device__(auto val) {
+                        return thrust::get<1>(val) != invalid_vertex_id<vertex_t>::value;
+                      })),
+    handle.get_stream());
+  walker_vertices.resize(walker_queries.size(), handle.get_stream());
+
+  vertex_t hop{0};
+  while (walker_queries.size() > 0) {
+    rmm::device_uvector<size_t> indices(walker_queries.size(), handle.get_stream());
+    thrust::transform(
+      handle.get_thrust_policy(),
+      walker_queries.begin(),
+      walker_queries.end(),
+      walker_vertices.begin(),
+      indices.begin(),
+      [find_visited = find_pair_t<vertex_t>{tags.data(), vertices.data(), tags.size()},
+       one_to_many] __device__(auto q, auto v) {
+        return find_visited(one_to_many ? vertex_t{0} : q, v);
+      });
+
+    if (!backward || (hop > vertex_t{0})) {
+      auto old_size = path_queries.size();
+      path_queries.resize(old_size + walker_queries.size(), handle.get_stream());
+      path_orders.resize(path_queries.size(), handle.get_stream());
+      path_vertices.resize(path_queries.size(), handle.get_stream());
+      path_distances.resize(path_queries.size(), handle.get_stream());
+      thrust::copy(handle.get_thrust_policy(),
+                   walker_first,
+                   walker_first + walker_queries.size(),
+                   thrust::make_zip_iterator(thrust::make_tuple(
+                     path_queries.begin() + old_size, path_vertices.begin() + old_size)));
+      thrust::fill(handle.get_thrust_policy(),
+                   path_orders.begin() + old_size,
+                   path_orders.end(),
+                   backward ? hop : -hop);
+      thrust::transform(
+        handle.get_thrust_policy(),
+        walker_queries.begin(),
+        walker_queries.end(),
+        indices.begin(),
+        path_distances.begin() + old_size,
+        [distances = distances.data(), query_distances = query_distances.data(), backward]
+        __device__(auto q, auto idx) {
+          return backward ? query_distances[q] - distances[idx] : distances[idx];
+        });
+    }
+
+    thrust::transform(handle.get_thrust_policy(),
+                      indices.begin(),
+                      indices.end(),
+                      walker_vertices.begin(),
+                      [predecessors = predecessors.data()] __device__(auto idx) {
+                        return predecessors[idx];
+                      });
+    walker_queries.resize(
+      thrust::distance(walker_first,
+                       thrust::remove_if(handle.get_thrust_policy(),
+                                         walker_first,
+                                         walker_first + walker_queries.size(),
+                                         [] __device__(auto val) {
+                                           return thrust::get<1>(val) ==
+                                                  invalid_vertex_id<vertex_t>::value;
+                                         })),
+      handle.get_stream());
+    walker_vertices.resize(walker_queries.size(), handle.get_stream());
+    ++hop;
+  }
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+contraction_hierarchy_paths(raft::handle_t const& handle,
+                            contraction_hierarchy_t<vertex_t, edge_t, weight_t> const& hierarchy,
+                            raft::device_span<vertex_t const> sources,
+                            raft::device_span<vertex_t const> targets,
+                            bool do_expensive_check)
+{
+  // 1. find the shortest path in the hierarchy (through the meeting vertex) of each query
+
+  auto [query_distances, query_meetings, forward_search, backward_search] =
+    meet_upward_searches(handle, hierarchy, sources, targets, do_expensive_check);
+
+  rmm::device_uvector<vertex_t> path_queries(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> path_orders(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> path_vertices(0, handle.get_stream());
+  rmm::device_uvector<weight_t> path_distances(0, handle.get_stream());
+  walk_upward_search_predecessors(handle,
+                                  forward_search,
+                                  false,
+                                  sources.size() == 1,
+                                  query_distances,
+                                  query_meetings,
+                                  path_queries,
+                                  path_orders,
+                                  path_vertices,
+                                  path_distances);
+  walk_upward_search_predecessors(handle,
+                                  backward_search,
+                                  true,
+                                  false,
+                                  query_distances,
+                                  query_meetings,
+                                  path_queries,
+                                  path_orders,
+                                  path_vertices,
+                                  path_distances);
+
+  auto path_key_first =
+    thrust::make_zip_iterator(thrust::make_tuple(path_queries.begin(), path_orders.begin()));
+  thrust::sort_by_key(
+    handle.get_thrust_policy(),
+    path_key_first,
+    path_key_first + path_queries.size(),
+    thrust::make_zip_iterator(thrust::make_tuple(path_vertices.begin(), path_distances.begin())));
+  path_orders.resize(0, handle.get_stream());
+  path_orders.shrink_to_fit(handle.get_stream());
+
+  // 2. unpack the shortcuts, every round inserts the middle vertex of each shortcut between its
+  // endpoints (shortcuts can bypass shortcuts, at most one round per contraction level)
+
+  auto find_shortcut = find_pair_t<vertex_t>{hierarchy.shortcut_srcs.data(),
+                                             hierarchy.shortcut_dsts.data(),
+                                             hierarchy.shortcut_srcs.size()};
+  while (true) {
+    rmm::device_uvector<size_t> shortcut_indices(path_queries.size(), handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      thrust::make_counting_iterator(size_t{0}),
+                      thrust::make_counting_iterator(path_queries.size()),
+                      shortcut_indices.begin(),
+                      [path_queries  = path_queries.data(),
+                       path_vertices = path_vertices.data(),
+                       num_elements  = path_queries.size(),
+                       find_shortcut] __device__(auto i) {
+                        return ((i + 1 < num_elements) && (path_queries[i] == path_queries[i + 1]))
+                                 ? find_shortcut(path_vertices[i], path_vertices[i + 1])
+                                 : find_shortcut.size;
+                      });
+
+    rmm::device_uvector<size_t> new_positions(path_queries.size() + 1, handle.get_stream());
+    new_positions.set_element_to_zero_async(0, handle.get_stream());
+    thrust::transform_inclusive_scan(handle.get_thrust_policy(),
+                                     shortcut_indices.begin(),
+                                     shortcut_indices.end(),
+                                     new_positions.begin() + 1,
+                                     [num_shortcuts = find_shortcut.size] __device__(auto idx) {
+                                       return idx != num_shortcuts ? size_t{2} : size_t{1};
+                                     },
+                                     thrust::plus<size_t>{});
+    auto new_size = new_positions.back_element(handle.get_stream());
+    if (new_size == path_queries.size()) { break; }
+
+    rmm::device_uvector<vertex_t> new_path_queries(new_size, handle.get_stream());
+    rmm::device_uvector<vertex_t> new_path_vertices(new_size, handle.get_stream());
+    rmm::device_uvector<weight_t> new_path_distances(new_size, handle.get_stream());
+    thrust::for_each(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(path_queries.size()),
+      [path_queries           = path_queries.data(),
+       path_vertices          = path_vertices.data(),
+       path_distances         = path_distances.data(),
+       shortcut_indices       = shortcut_indices.data(),
+       new_positions          = new_positions.data(),
+       new_path_queries       = new_path_queries.data(),
+       new_path_vertices      = new_path_vertices.data(),
+       new_path_distances     = new_path_distances.data(),
+       shortcut_middles       = hierarchy.shortcut_middles.data(),
+       shortcut_first_weights = hierarchy.shortcut_first_weights.data(),
+       num_shortcuts          = find_shortcut.size] __device__(auto i) {
+        auto pos                = new_positions[i];
+        new_path_queries[pos]   = path_queries[i];
+        new_path_vertices[pos]  = path_vertices[i];
+        new_path_distances[pos] = path_distances[i];
+        auto idx                = shortcut_indices[i];
+        if (idx != num_shortcuts) {
+          new_path_queries[pos + 1]   = path_queries[i];
+          new_path_vertices[pos + 1]  = shortcut_middles[idx];
+          new_path_distances[pos + 1] = path_distances[i] + shortcut_first_weights[idx];
+        }
+      });
+    path_queries   = std::move(new_path_queries);
+    path_vertices  = std::move(new_path_vertices);
+    path_distances = std::move(new_path_distances);
+  }
+
+  // 3. pack the paths query by query
+
+  rmm::device_uvector<size_t> offsets(targets.size() + 1, handle.get_stream());
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      path_queries.begin(),
+                      path_queries.end(),
+                      thrust::make_counting_iterator(vertex_t{0}),
+                      thrust::make_counting_iterator(static_cast<vertex_t>(offsets.size())),
+                      offsets.begin());
+
+  return std::make_tuple(std::move(offsets), std::move(path_vertices), std::move(path_distances));
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+contraction_hierarchy_t<vertex_t, edge_t, weight_t> build_contraction_hierarchy(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, false> const& graph_view,
+  bool do_expensive_check)
+{
+  return detail::build_contraction_hierarchy(handle, graph_view, do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+rmm::device_uvector<weight_t> contraction_hierarchy_distances(
+  raft::handle_t const& handle,
+  contraction_hierarchy_t<vertex_t, edge_t, weight_t> const& hierarchy,
+  raft::device_span<vertex_t const> sources,
+  raft::device_span<vertex_t const> targets,
+  bool do_expensive_check)
+{
+  return detail::contraction_hierarchy_distances(
+    handle, hierarchy, sources, targets, do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+contraction_hierarchy_paths(raft::handle_t const& handle,
+                            contraction_hierarchy_t<vertex_t, edge_t, weight_t> const& hierarchy,
+                            raft::device_span<vertex_t const> sources,
+                            raft::device_span<vertex_t const> targets,
+                            bool do_expensive_check)
+{
+  return detail::contraction_hierarchy_paths(
+    handle, hierarchy, sources, targets, do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -0,0 +1,436 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <utilities/host_numa_utils.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+namespace cugraph {
+namespace detail {
+
+class host_thread_barrier_t {
+ public:
+  explicit host_thread_barrier_t(size_t num_threads) : num_threads_(num_threads) {}
+
+  void arrive_and_wait()
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto generation = generation_;
+    if (++num_arrived_ == num_threads_) {
+      num_arrived_ = 0;
+      ++generation_;
+      cv_.notify_all();
+    } else {
+      cv_.wait(lock, [this, generation] { return generation != generation_; });
+    }
+  }
+
+ private:
+  std::mutex mutex_{};
+  std::condition_variable cv_{};
+  size_t num_threads_{0};
+  size_t num_arrived_{0};
+  size_t generation_{0};
+};
+
+template <typename T>
+bool host_atomic_min(std::atomic<T>& target, T val)
+{
+  auto old = target.load(std::memory_order_relaxed);
+  while (val < old) {
+    if (target.compare_exchange_weak(old, val, std::memory_order_relaxed)) { return true; }
+  }
+  return false;
+}
+
+// Delta-stepping (U. Meyer and P. Sanders, "Delta-stepping: a parallelizable shortest path
+// algorithm," 2003) on a host CSR. Every thread owns its buckets; the vertices of the current
+// bucket are drained in chunks and a thread that runs out of its own chunks steals from the other
+// threads. Relaxations are applied in two passes separated by barriers, the first pass takes the
+// minimum distance and the second pass the minimum predecessor among the requests reaching that
+// distance, so the output does not depend on the thread schedule.
+//
+// If node_cpus (the CPU IDs of each NUMA node) lists more than one node, the threads are pinned to
+// the NUMA nodes in contiguous groups, every thread first-touches the CSR and per-vertex arrays of
+// its vertex range (so the graph is partitioned by vertex range across the nodes), and a thread
+// steals from the threads on its own node before stealing across nodes.
+template <typename vertex_t, typename edge_t, typename weight_t>
+void host_sssp(edge_t const* offsets,
+               vertex_t const* indices,
+               weight_t const* weights,
+               vertex_t num_vertices,
+               weight_t* distances,
+               vertex_t* predecessors /* nullptr if not needed */,
+               vertex_t source_vertex,
+               weight_t cutoff,
+               size_t num_threads,
+               std::vector<std::vector<int>> const& node_cpus)
+{
+  constexpr size_t chunk_size     = 64;
+  constexpr auto invalid_distance = std::numeric_limits<weight_t>::max();
+  constexpr auto invalid_vertex   = invalid_vertex_id<vertex_t>::value;
+  constexpr auto no_predecessor   = std::numeric_limits<vertex_t>::max();
+  constexpr auto no_bucket        = std::numeric_limits<size_t>::max();
+
+  if (num_vertices == 0) { return; }
+  auto num_edges = offsets[num_vertices];
+
+  num_threads = std::max(num_threads, size_t{1});
+  num_threads = std::min(num_threads, static_cast<size_t>(num_vertices));
+
+  // 1. place the threads on the NUMA nodes
+
+  auto num_nodes = std::max(node_cpus.size(), size_t{1});
+
+  std::vector<size_t> thread_nodes(num_threads);
+  for (size_t i = 0; i < num_threads; ++i) {
+    thread_nodes[i] = (i * num_nodes) / num_threads;
+  }
+
+  std::vector<std::vector<size_t>> victims(num_threads);  // own thread, same node, other nodes
+  for (size_t i = 0; i < num_threads; ++i) {
+    for (size_t j = 0; j < num_threads; ++j) {
+      auto victim = (i + j) % num_threads;
+      if (thread_nodes[victim] == thread_nodes[i]) { victims[i].push_back(victim); }
+    }
+    for (size_t j = 0; j < num_threads; ++j) {
+      auto victim = (i + j) % num_threads;
+      if (thread_nodes[victim] != thread_nodes[i]) { victims[i].push_back(victim); }
+    }
+  }
+
+  // 2. allocate the shared arrays without touching them (each thread first-touches its own vertex
+  // range)
+
+  std::unique_ptr<vertex_t[]> h_indices(new vertex_t[num_edges]);
+  std::unique_ptr<weight_t[]> h_weights(new weight_t[num_edges]);
+  std::unique_ptr<edge_t[]> light_ends(new edge_t[num_vertices]);
+  std::unique_ptr<std::atomic<weight_t>[]> shared_distances(
+    new std::atomic<weight_t>[num_vertices]);
+  std::unique_ptr<std::atomic<weight_t>[]> expanded_distances(
+    new std::atomic<weight_t>[num_vertices]);
+  std::unique_ptr<std::atomic<vertex_t>[]> shared_predecessors(
+    new std::atomic<vertex_t>[num_vertices]);
+
+  weight_t average_edge_weight{0.0};
+  for (edge_t i = 0; i < num_edges; ++i) {
+    average_edge_weight += weights[i];
+  }
+  average_edge_weight = num_edges > 0 ? average_edge_weight / static_cast<weight_t>(num_edges)
+                                      : weight_t{1.0};
+  auto delta = average_edge_weight > weight_t{0.0} ? average_edge_weight : weight_t{1.0};
+
+  // 3. per-thread state
+
+  struct relax_request_t {
+    vertex_t dst;
+    vertex_t src;
+    weight_t distance;
+  };
+
+  std::vector<std::map<size_t, std::vector<vertex_t>>> buckets(num_threads);
+  std::vector<std::vector<vertex_t>> frontiers(num_threads);
+  std::vector<std::atomic<size_t>> frontier_cursors(num_threads);
+  std::vector<std::vector<vertex_t>> expanded_vertices(num_threads);
+  std::vector<std::vector<relax_request_t>> requests(num_threads);
+  std::vector<size_t> min_bucket_indices(num_threads);
+  std::vector<size_t> light_bucket_sizes(num_threads);
+
+  auto bucket_index = [delta](weight_t distance) {
+    return static_cast<size_t>(distance / delta);
+  };
+
+  host_thread_barrier_t barrier(num_threads);
+
+  auto worker = [&](size_t thread_id) {
+    if (node_cpus.size() > 1) { pin_this_thread_to_host_cpus(node_cpus[thread_nodes[thread_id]]); }
+
+    // separate light and heavy edges (light edges first in each adjacency list)
+
+    auto v_first = static_cast<vertex_t>((num_vertices * thread_id) / num_threads);
+    auto v_last  = static_cast<vertex_t>((num_vertices * (thread_id + 1)) / num_threads);
+
+    for (vertex_t v = v_first; v < v_last; ++v) {
+      auto first = offsets[v];
+      auto last  = offsets[v + 1];
+      std::vector<std::pair<weight_t, vertex_t>> adjacency(last - first);
+      for (edge_t i = first; i < last; ++i) {
+        adjacency[i - first] = std::make_pair(weights[i], indices[i]);
+      }
+      auto light_last = std::partition(adjacency.begin(), adjacency.end(), [delta](auto const& e) {
+        return e.first <= delta;
+      });
+      for (edge_t i = first; i < last; ++i) {
+        h_weights[i] = adjacency[i - first].first;
+        h_indices[i] = adjacency[i - first].second;
+      }
+      light_ends[v] = first + static_cast<edge_t>(std::distance(adjacency.begin(), light_last));
+
+      shared_distances[v].store(v == source_vertex ? weight_t{0.0} : invalid_distance,
+                                std::memory_order_relaxed);
+      expanded_distances[v].store(invalid_distance, std::memory_order_relaxed);
+      shared_predecessors[v].store(no_predecessor, std::memory_order_relaxed);
+    }
+    if ((source_vertex >= v_first) && (source_vertex < v_last)) {
+      buckets[thread_id][0].push_back(source_vertex);
+    }
+    barrier.arrive_and_wait();
+
+    auto& my_buckets  = buckets[thread_id];
+    auto& my_expanded = expanded_vertices[thread_id];
+    auto& my_requests = requests[thread_id];
+
+    auto relax = [&](vertex_t src, edge_t first, edge_t last) {
+      auto src_distance = shared_distances[src].load(std::memory_order_relaxed);
+      for (edge_t i = first; i < last; ++i) {
+        auto dst          = h_indices[i];
+        auto new_distance = src_distance + h_weights[i];
+        if ((new_distance < cutoff) &&
+            (new_distance < shared_distances[dst].load(std::memory_order_relaxed))) {
+          my_requests.push_back(relax_request_t{dst, src, new_distance});
+        }
+      }
+    };
+
+    auto apply_requests = [&]() {
+      for (auto const& request : my_requests) {
+        if (host_atomic_min(shared_distances[request.dst], request.distance)) {
+          shared_predecessors[request.dst].store(no_predecessor, std::memory_order_relaxed);
+        }
+      }
+      barrier.arrive_and_wait();
+      for (auto const& request : my_requests) {
+        if (request.distance == shared_distances[request.dst].load(std::memory_order_relaxed)) {
+          host_atomic_min(shared_predecessors[request.dst], request.src);
+          my_buckets[bucket_index(request.distance)].push_back(request.dst);
+        }
+      }
+      my_requests.clear();
+      barrier.arrive_and_wait();
+    };
+
+    while (true) {
+      // find the lowest non-empty bucket
+
+      min_bucket_indices[thread_id] = my_buckets.empty() ? no_bucket : my_buckets.begin()->first;
+      barrier.arrive_and_wait();
+      auto cur_bucket_idx =
+        *std::min_element(min_bucket_indices.begin(), min_bucket_indices.end());
+      barrier.arrive_and_wait();
+      if (cur_bucket_idx == no_bucket) { break; }
+
+      // relax light edges until the current bucket stays empty
+
+      while (true) {
+        auto it = my_buckets.find(cur_bucket_idx);
+        if (it != my_buckets.end()) {
+          frontiers[thread_id] = std::move(it->second);
+          my_buckets.erase(it);
+        } else {
+          frontiers[thread_id].clear();
+        }
+        frontier_cursors[thread_id].store(0, std::memory_order_relaxed);
+        barrier.arrive_and_wait();
+
+        for (auto victim : victims[thread_id]) {  // own frontier first, then steal
+          auto const& frontier = frontiers[victim];
+          while (true) {
+            auto chunk_first = frontier_cursors[victim].fetch_add(chunk_size);
+            if (chunk_first >= frontier.size()) { break; }
+            auto chunk_last = std::min(chunk_first + chunk_size, frontier.size());
+            for (auto j = chunk_first; j < chunk_last; ++j) {
+              auto v        = frontier[j];
+              auto distance = shared_distances[v].load(std::memory_order_relaxed);
+              if (bucket_index(distance) != cur_bucket_idx) { continue; }  // stale entry
+              if (!host_atomic_min(expanded_distances[v], distance)) { continue; }  // duplicate
+              my_expanded.push_back(v);
+              relax(v, offsets[v], light_ends[v]);
+            }
+          }
+        }
+        barrier.arrive_and_wait();
+
+        apply_requests();
+
+        auto it_next                  = my_buckets.find(cur_bucket_idx);
+        light_bucket_sizes[thread_id] = it_next != my_buckets.end() ? it_next->second.size() : 0;
+        barrier.arrive_and_wait();
+        auto num_reinserted =
+          std::accumulate(light_bucket_sizes.begin(), light_bucket_sizes.end(), size_t{0});
+        barrier.arrive_and_wait();
+        if (num_reinserted == 0) { break; }
+      }
+
+      // relax heavy edges of the vertices expanded in the current bucket (these can't land in
+      // the current bucket)
+
+      for (auto v : my_expanded) {
+        relax(v, light_ends[v], offsets[v + 1]);
+      }
+      my_expanded.clear();
+      barrier.arrive_and_wait();
+
+      apply_requests();
+    }
+  };
+
+  // run every worker on a new thread (pinning must not change the caller's affinity)
+  std::vector<std::thread> threads{};
+  threads.reserve(num_threads);
+  for (size_t i = 0; i < num_threads; ++i) {
+    threads.emplace_back(worker, i);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (vertex_t v = 0; v < num_vertices; ++v) {
+    distances[v] = shared_distances[v].load(std::memory_order_relaxed);
+    if (predecessors != nullptr) {
+      auto pred       = shared_predecessors[v].load(std::memory_order_relaxed);
+      predecessors[v] = pred == no_predecessor ? invalid_vertex : pred;
+    }
+  }
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+void host_sssp(raft::host_span<edge_t const> offsets,
+               raft::host_span<vertex_t const> indices,
+               raft::host_span<weight_t const> weights,
+               weight_t* distances,
+               vertex_t* predecessors,
+               vertex_t source_vertex,
+               weight_t cutoff,
+               size_t num_threads,
+               bool numa_aware,
+               bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(offsets.size() > 0,
+                  "Invalid input argument: offsets should have number of vertices + 1 elements.");
+  auto const num_vertices = static_cast<vertex_t>(offsets.size() - 1);
+  if (num_vertices == 0) { return; }
+
+  CUGRAPH_EXPECTS(static_cast<size_t>(offsets[num_vertices]) == indices.size(),
+                  "Invalid input argument: indices size does not match the number of edges.");
+  CUGRAPH_EXPECTS(weights.size() == indices.size(),
+                  "Invalid input argument: weights size does not match the number of edges.");
+  CUGRAPH_EXPECTS((source_vertex >= vertex_t{0}) && (source_vertex < num_vertices),
+                  "Invalid input argument: source vertex out-of-range.");
+
+  if (do_expensive_check) {
+    CUGRAPH_EXPECTS(std::is_sorted(offsets.begin(), offsets.end()) && (offsets[0] == edge_t{0}),
+                    "Invalid input argument: offsets should be non-decreasing from 0.");
+    CUGRAPH_EXPECTS(std::all_of(indices.begin(),
+                                indices.end(),
+                                [num_vertices](auto v) {
+                                  return (v >= vertex_t{0}) && (v < num_vertices);
+                                }),
+                    "Invalid input argument: indices have invalid vertex IDs.");
+    CUGRAPH_EXPECTS(std::none_of(weights.begin(), weights.end(), [](auto w) { return w < 0.0; }),
+                    "Invalid input argument: input graph should have non-negative edge weights.");
+  }
+
+  if (num_threads == 0) {
+    num_threads = std::max(static_cast<size_t>(std::thread::hardware_concurrency()), size_t{1});
+  }
+
+  detail::host_sssp(offsets.data(),
+                    indices.data(),
+                    weights.data(),
+                    num_vertices,
+                    distances,
+                    predecessors,
+                    source_vertex,
+                    cutoff,
+                    num_threads,
+                    numa_aware ? detail::host_numa_node_cpus() : std::vector<std::vector<int>>{});
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+void host_sssp(raft::handle_t const& handle,
+               graph_view_t<vertex_t, edge_t, weight_t, false, false> const& graph_view,
+               weight_t* distances,
+               vertex_t* predecessors,
+               vertex_t source_vertex,
+               weight_t cutoff,
+               size_t num_threads,
+               bool numa_aware,
+               bool do_expensive_check)
+{
+  auto const num_vertices = graph_view.number_of_vertices();
+  auto const num_edges    = graph_view.number_of_edges();
+  if (num_vertices == 0) { return; }
+
+  CUGRAPH_EXPECTS(graph_view.is_valid_vertex(source_vertex),
+                  "Invalid input argument: source vertex out-of-range.");
+  CUGRAPH_EXPECTS(graph_view.is_weighted(),
+                  "Invalid input argument: an unweighted graph is passed to SSSP, BFS is more "
+                  "efficient for unweighted graphs.");
+
+  auto edge_partition = graph_view.local_edge_partition_view();
+
+  std::vector<edge_t> h_offsets(num_vertices + 1);
+  std::vector<vertex_t> h_indices(num_edges);
+  std::vector<weight_t> h_weights(num_edges);
+  raft::update_host(
+    h_offsets.data(), edge_partition.offsets(), h_offsets.size(), handle.get_stream());
+  raft::update_host(
+    h_indices.data(), edge_partition.indices(), h_indices.size(), handle.get_stream());
+  raft::update_host(
+    h_weights.data(), *(edge_partition.weights()), h_weights.size(), handle.get_stream());
+  handle.sync_stream();
+
+  std::vector<weight_t> h_distances(num_vertices);
+  std::vector<vertex_t> h_predecessors(predecessors != nullptr ? num_vertices : vertex_t{0});
+  host_sssp(raft::host_span<edge_t const>(h_offsets.data(), h_offsets.size()),
+            raft::host_span<vertex_t const>(h_indices.data(), h_indices.size()),
+            raft::host_span<weight_t const>(h_weights.data(), h_weights.size()),
+            h_distances.data(),
+            predecessors != nullptr ? h_predecessors.data() : nullptr,
+            source_vertex,
+            cutoff,
+            num_threads,
+            numa_aware,
+            do_expensive_check);
+
+  raft::update_device(distances, h_distances.data(), h_distances.size(), handle.get_stream());
+  if (predecessors != nullptr) {
+    raft::update_device(
+      predecessors, h_predecessors.data(), h_predecessors.size(), handle.get_stream());
+  }
+  handle.sync_stream();
+}
+
+}  // namespace cugraph
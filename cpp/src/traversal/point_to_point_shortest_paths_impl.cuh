@@ -0,0 +1,1619 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <detail/graph_utils.cuh>
+#include <prims/count_if_e.cuh>
+#include <prims/count_if_v.cuh>
+#include <prims/reduce_op.cuh>
+#include <prims/transform_reduce_e.cuh>
+#include <prims/transform_reduce_v_frontier_outgoing_e_by_dst.cuh>
+#include <prims/vertex_frontier.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/utilities/dataframe_buffer.hpp>
+#include <cugraph/utilities/device_comm.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/host_scalar_comm.hpp>
+#include <cugraph/utilities/shuffle_comm.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/distance.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/merge.h>
+#include <thrust/optional.h>
+#include <thrust/remove.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+
+namespace {
+
+// A frontier (vertex, pair) element is tagged with its index in the frontier element table
+// gathered from the GPUs whose frontier keys are expanded on this GPU (the GPUs in the column
+// communicator in multi-GPU), the table stores the pair and the distance of each element. The
+// output keys are tagged with the pair.
+template <typename vertex_t, typename weight_t>
+struct p2p_e_op_t {
+  size_t const* element_pairs{nullptr};
+  weight_t const* element_distances{nullptr};
+  weight_t const* best_distances{nullptr};  // indexed by pair
+  weight_t cutoff{};
+
+  __device__ thrust::optional<thrust::tuple<size_t, thrust::tuple<weight_t, vertex_t>>> operator()(
+    thrust::tuple<vertex_t, size_t> tagged_src,
+    vertex_t,
+    weight_t w,
+    thrust::nullopt_t,
+    thrust::nullopt_t) const
+  {
+    auto element_idx  = thrust::get<1>(tagged_src);
+    auto pair         = element_pairs[element_idx];
+    auto new_distance = element_distances[element_idx] + w;
+    if ((new_distance >= cutoff) || (new_distance >= best_distances[pair])) {
+      return thrust::nullopt;
+    }
+    return thrust::optional<thrust::tuple<size_t, thrust::tuple<weight_t, vertex_t>>>{
+      thrust::make_tuple(pair, thrust::make_tuple(new_distance, thrust::get<0>(tagged_src)))};
+  }
+};
+
+// returns the index of the (vertex, pair) key in the sorted reached list (or num_reached if the key
+// is not in the list)
+template <typename vertex_t>
+struct find_reached_t {
+  vertex_t const* vertices{nullptr};
+  size_t const* pairs{nullptr};
+  size_t num_reached{0};
+
+  __device__ size_t operator()(thrust::tuple<vertex_t, size_t> key) const
+  {
+    auto first = thrust::make_zip_iterator(thrust::make_tuple(vertices, pairs));
+    auto idx   = static_cast<size_t>(thrust::distance(
+      first, thrust::lower_bound(thrust::seq, first, first + num_reached, key)));
+    return ((idx < num_reached) && (vertices[idx] == thrust::get<0>(key)) &&
+            (pairs[idx] == thrust::get<1>(key)))
+             ? idx
+             : num_reached;
+  }
+};
+
+// non-negative floating point values order as their bit patterns (read as unsigned integers) do
+template <typename weight_t>
+__device__ void atomic_min_non_negative(weight_t* addr, weight_t val)
+{
+  if constexpr (sizeof(weight_t) == sizeof(unsigned int)) {
+    atomicMin(reinterpret_cast<unsigned int*>(addr), __float_as_uint(val));
+  } else {
+    atomicMin(reinterpret_cast<unsigned long long int*>(addr),
+              static_cast<unsigned long long int>(__double_as_longlong(val)));
+  }
+}
+
+}  // namespace
+
+namespace detail {
+
+// heuristic value of a local vertex shared by every target (0 if values is nullptr)
+template <typename vertex_t, typename weight_t>
+struct shared_heuristic_op_t {
+  weight_t const* values{nullptr};
+  vertex_t local_vertex_partition_range_first{};
+
+  __device__ weight_t operator()(vertex_t v, vertex_t) const
+  {
+    return values != nullptr ? values[v - local_vertex_partition_range_first] : weight_t{0.0};
+  }
+};
+
+// heuristic value of a local vertex toward a target, the values for the i'th (sorted) target are
+// stored in values[i * local_vertex_partition_range_size, (i + 1) *
+// local_vertex_partition_range_size), 0 for the targets not in the list
+template <typename vertex_t, typename weight_t>
+struct per_target_heuristic_op_t {
+  raft::device_span<vertex_t const> targets{};
+  weight_t const* values{nullptr};
+  vertex_t local_vertex_partition_range_first{};
+  vertex_t local_vertex_partition_range_size{};
+
+  __device__ weight_t operator()(vertex_t v, vertex_t target) const
+  {
+    auto it = thrust::lower_bound(thrust::seq, targets.begin(), targets.end(), target);
+    if ((it == targets.end()) || (*it != target)) { return weight_t{0.0}; }
+    return values[static_cast<size_t>(thrust::distance(targets.begin(), it)) *
+                    static_cast<size_t>(local_vertex_partition_range_size) +
+                  static_cast<size_t>(v - local_vertex_partition_range_first)];
+  }
+};
+
+// state of a search (forward from the sources or backward from the targets) for every pair, all
+// the (vertex, pair) lists are sorted and reside in the GPU owning the vertex
+template <typename vertex_t, typename weight_t>
+struct p2p_search_t {
+  p2p_search_t(raft::handle_t const& handle)
+    : vertices(0, handle.get_stream()),
+      pairs(0, handle.get_stream()),
+      distances(0, handle.get_stream()),
+      predecessors(0, handle.get_stream()),
+      near_vertices(0, handle.get_stream()),
+      near_pairs(0, handle.get_stream()),
+      far_vertices(0, handle.get_stream()),
+      far_pairs(0, handle.get_stream())
+  {
+  }
+
+  // reached (vertex, pair) pairs with the distance from the search origin and the predecessor (the
+  // previous vertex in the search, i.e. the next vertex toward the target in the backward search)
+  rmm::device_uvector<vertex_t> vertices;
+  rmm::device_uvector<size_t> pairs;
+  rmm::device_uvector<weight_t> distances;
+  rmm::device_uvector<vertex_t> predecessors;
+
+  // queued (vertex, pair) pairs, near pairs are expanded in the next iteration, far pairs once the
+  // near queue is empty
+  rmm::device_uvector<vertex_t> near_vertices;
+  rmm::device_uvector<size_t> near_pairs;
+  rmm::device_uvector<vertex_t> far_vertices;
+  rmm::device_uvector<size_t> far_pairs;
+
+  weight_t near_far_threshold{0.0};
+};
+
+template <typename vertex_t, typename... Ts>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<Ts>...> shuffle_to_vertex_owners(
+  raft::handle_t const& handle,
+  rmm::device_uvector<vertex_t> const& d_vertex_partition_range_lasts,
+  rmm::device_uvector<vertex_t>&& vertices,
+  rmm::device_uvector<Ts>&&... values)
+{
+  auto first = thrust::make_zip_iterator(thrust::make_tuple(vertices.begin(), values.begin()...));
+  auto [rx_values, rx_counts] = groupby_gpu_id_and_shuffle_values(
+    handle.get_comms(),
+    first,
+    first + vertices.size(),
+    [key_func = compute_gpu_id_from_int_vertex_t<vertex_t>{raft::device_span<vertex_t>(
+       const_cast<vertex_t*>(d_vertex_partition_range_lasts.data()),
+       d_vertex_partition_range_lasts.size())}] __device__(auto val) {
+      return key_func(thrust::get<0>(val));
+    },
+    handle.get_stream());
+  return std::move(rx_values);
+}
+
+// merge the sorted (vertex, pair) keys to the sorted & unique list
+template <typename vertex_t, typename KeyIterator>
+void insert_p2p_keys(raft::handle_t const& handle,
+                     rmm::device_uvector<vertex_t>& vertices,
+                     rmm::device_uvector<size_t>& pairs,
+                     KeyIterator key_first,
+                     size_t num_keys)
+{
+  rmm::device_uvector<vertex_t> merged_vertices(vertices.size() + num_keys, handle.get_stream());
+  rmm::device_uvector<size_t> merged_pairs(merged_vertices.size(), handle.get_stream());
+  auto old_key_first =
+    thrust::make_zip_iterator(thrust::make_tuple(vertices.begin(), pairs.begin()));
+  auto merged_key_first =
+    thrust::make_zip_iterator(thrust::make_tuple(merged_vertices.begin(), merged_pairs.begin()));
+  thrust::merge(handle.get_thrust_policy(),
+                old_key_first,
+                old_key_first + vertices.size(),
+                key_first,
+                key_first + num_keys,
+                merged_key_first);
+  merged_vertices.resize(
+    thrust::distance(merged_key_first,
+                     thrust::unique(handle.get_thrust_policy(),
+                                    merged_key_first,
+                                    merged_key_first + merged_vertices.size())),
+    handle.get_stream());
+  merged_pairs.resize(merged_vertices.size(), handle.get_stream());
+  vertices = std::move(merged_vertices);
+  pairs    = std::move(merged_pairs);
+}
+
+template <typename vertex_t, bool multi_gpu>
+size_t aggregate_size(raft::handle_t const& handle, size_t size)
+{
+  if constexpr (multi_gpu) {
+    return host_scalar_allreduce(
+      handle.get_comms(), size, raft::comms::op_t::SUM, handle.get_stream());
+  } else {
+    return size;
+  }
+}
+
+// drop the queued (vertex, pair) pairs that cannot lead to a path shorter than the best path found
+// so far (and the pairs of the finished pairs, if finished is not nullptr)
+template <typename vertex_t, typename weight_t, typename HeuristicOp>
+void prune_p2p_queue(raft::handle_t const& handle,
+                     p2p_search_t<vertex_t, weight_t> const& search,
+                     rmm::device_uvector<vertex_t>& vertices,
+                     rmm::device_uvector<size_t>& pairs,
+                     HeuristicOp heuristic_op,
+                     vertex_t const* targets,
+                     weight_t const* best_distances,
+                     uint8_t const* finished)
+{
+  auto key_first = thrust::make_zip_iterator(thrust::make_tuple(vertices.begin(), pairs.begin()));
+  vertices.resize(
+    thrust::distance(
+      key_first,
+      thrust::remove_if(
+        handle.get_thrust_policy(),
+        key_first,
+        key_first + vertices.size(),
+        [find_reached = find_reached_t<vertex_t>{search.vertices.data(),
+                                                 search.pairs.data(),
+                                                 search.vertices.size()},
+         distances    = search.distances.data(),
+         heuristic_op,
+         targets,
+         best_distances,
+         finished] __device__(auto key) {
+          auto pair = thrust::get<1>(key);
+          if ((finished != nullptr) && (finished[pair] != uint8_t{0})) { return true; }
+          return distances[find_reached(key)] +
+                   heuristic_op(thrust::get<0>(key), targets[pair]) >=
+                 best_distances[pair];
+        })),
+    handle.get_stream());
+  pairs.resize(vertices.size(), handle.get_stream());
+}
+
+// once the near queue is empty, move the far (vertex, pair) pairs within delta of the smallest far
+// key (distance + heuristic) to the near queue
+template <typename vertex_t, typename weight_t, bool multi_gpu, typename HeuristicOp>
+void refill_p2p_near_queue(raft::handle_t const& handle,
+                           p2p_search_t<vertex_t, weight_t>& search,
+                           HeuristicOp heuristic_op,
+                           vertex_t const* targets,
+                           weight_t delta)
+{
+  auto key_first = thrust::make_zip_iterator(
+    thrust::make_tuple(search.far_vertices.begin(), search.far_pairs.begin()));
+  auto key_op = [find_reached = find_reached_t<vertex_t>{search.vertices.data(),
+                                                         search.pairs.data(),
+                                                         search.vertices.size()},
+                 distances    = search.distances.data(),
+                 heuristic_op,
+                 targets] __device__(auto key) {
+    return distances[find_reached(key)] +
+           heuristic_op(thrust::get<0>(key), targets[thrust::get<1>(key)]);
+  };
+
+  auto min_key = thrust::transform_reduce(handle.get_thrust_policy(),
+                                          key_first,
+                                          key_first + search.far_vertices.size(),
+                                          key_op,
+                                          std::numeric_limits<weight_t>::max(),
+                                          thrust::minimum<weight_t>());
+  if constexpr (multi_gpu) {
+    min_key = host_scalar_allreduce(
+      handle.get_comms(), min_key, raft::comms::op_t::MIN, handle.get_stream());
+  }
+  search.near_far_threshold = min_key + delta;
+
+  auto pred = [key_op, threshold = search.near_far_threshold] __device__(auto key) {
+    return key_op(key) < threshold;
+  };
+  auto num_near = static_cast<size_t>(thrust::count_if(
+    handle.get_thrust_policy(), key_first, key_first + search.far_vertices.size(), pred));
+  search.near_vertices.resize(num_near, handle.get_stream());
+  search.near_pairs.resize(num_near, handle.get_stream());
+  thrust::copy_if(handle.get_thrust_policy(),
+                  key_first,
+                  key_first + search.far_vertices.size(),
+                  thrust::make_zip_iterator(
+                    thrust::make_tuple(search.near_vertices.begin(), search.near_pairs.begin())),
+                  pred);
+  search.far_vertices.resize(
+    thrust::distance(key_first,
+                     thrust::remove_if(handle.get_thrust_policy(),
+                                       key_first,
+                                       key_first + search.far_vertices.size(),
+                                       pred)),
+    handle.get_stream());
+  search.far_pairs.resize(search.far_vertices.size(), handle.get_stream());
+}
+
+// expand the near queue of the search by one hop for every pair at once, update the reached
+// (vertex, pair) pairs, queue the improved ones, and return them with their new distances
+template <typename GraphViewType, typename HeuristicOp>
+std::tuple<rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<size_t>,
+           rmm::device_uvector<typename GraphViewType::weight_type>>
+relax_p2p_search(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  p2p_search_t<typename GraphViewType::vertex_type, typename GraphViewType::weight_type>& search,
+  HeuristicOp heuristic_op,
+  typename GraphViewType::vertex_type const* targets,
+  typename GraphViewType::weight_type const* best_distances,
+  typename GraphViewType::weight_type cutoff)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  // 1. take the near queue as the frontier and build the frontier element table
+
+  rmm::device_uvector<vertex_t> frontier_vertices(0, handle.get_stream());
+  rmm::device_uvector<size_t> frontier_pairs(0, handle.get_stream());
+  std::swap(frontier_vertices, search.near_vertices);
+  std::swap(frontier_pairs, search.near_pairs);
+
+  rmm::device_uvector<weight_t> frontier_distances(frontier_vertices.size(), handle.get_stream());
+  auto frontier_key_first = thrust::make_zip_iterator(
+    thrust::make_tuple(frontier_vertices.begin(), frontier_pairs.begin()));
+  thrust::transform(handle.get_thrust_policy(),
+                    frontier_key_first,
+                    frontier_key_first + frontier_vertices.size(),
+                    frontier_distances.begin(),
+                    [find_reached = find_reached_t<vertex_t>{search.vertices.data(),
+                                                             search.pairs.data(),
+                                                             search.vertices.size()},
+                     distances    = search.distances.data()] __device__(auto key) {
+                      return distances[find_reached(key)];
+                    });
+
+  size_t element_offset{0};
+  rmm::device_uvector<size_t> element_pairs(0, handle.get_stream());
+  rmm::device_uvector<weight_t> element_distances(0, handle.get_stream());
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+    auto element_counts =
+      host_scalar_allgather(col_comm, frontier_vertices.size(), handle.get_stream());
+    std::vector<size_t> element_displacements(element_counts.size());
+    std::exclusive_scan(
+      element_counts.begin(), element_counts.end(), element_displacements.begin(), size_t{0});
+    element_offset = element_displacements[col_comm.get_rank()];
+    element_pairs.resize(element_displacements.back() + element_counts.back(),
+                         handle.get_stream());
+    element_distances.resize(element_pairs.size(), handle.get_stream());
+    device_allgatherv(col_comm,
+                      frontier_pairs.begin(),
+                      element_pairs.begin(),
+                      element_counts,
+                      element_displacements,
+                      handle.get_stream());
+    device_allgatherv(col_comm,
+                      frontier_distances.begin(),
+                      element_distances.begin(),
+                      element_counts,
+                      element_displacements,
+                      handle.get_stream());
+  } else {
+    element_pairs     = std::move(frontier_pairs);
+    element_distances = std::move(frontier_distances);
+  }
+
+  vertex_frontier_t<vertex_t, size_t, GraphViewType::is_multi_gpu> vertex_frontier(handle, 1);
+  auto tagged_frontier_key_first = thrust::make_zip_iterator(
+    thrust::make_tuple(frontier_vertices.begin(), thrust::make_counting_iterator(element_offset)));
+  vertex_frontier.bucket(0).insert(tagged_frontier_key_first,
+                                   tagged_frontier_key_first + frontier_vertices.size());
+  frontier_vertices.resize(0, handle.get_stream());
+  frontier_vertices.shrink_to_fit(handle.get_stream());
+
+  // 2. expand, every (vertex, pair) pair reached keeps the shortest distance and its predecessor
+
+  auto [new_key_buffer, new_payload_buffer] = transform_reduce_v_frontier_outgoing_e_by_dst(
+    handle,
+    push_graph_view,
+    vertex_frontier,
+    0,
+    dummy_property_t<vertex_t>{}.device_view(),
+    dummy_property_t<vertex_t>{}.device_view(),
+    p2p_e_op_t<vertex_t, weight_t>{
+      element_pairs.data(), element_distances.data(), best_distances, cutoff},
+    reduce_op::minimum<thrust::tuple<weight_t, vertex_t>>());
+
+  auto& new_vertices     = std::get<0>(new_key_buffer);
+  auto& new_pairs        = std::get<1>(new_key_buffer);
+  auto& new_distances    = std::get<0>(new_payload_buffer);
+  auto& new_predecessors = std::get<1>(new_payload_buffer);
+
+  // 3. drop the pairs not improving the reached distances, the returned pairs are sorted and this
+  // preserves the order
+
+  auto num_reached = search.vertices.size();
+  rmm::device_uvector<size_t> reached_indices(new_vertices.size(), handle.get_stream());
+  auto new_key_first =
+    thrust::make_zip_iterator(thrust::make_tuple(new_vertices.begin(), new_pairs.begin()));
+  thrust::transform(
+    handle.get_thrust_policy(),
+    new_key_first,
+    new_key_first + new_vertices.size(),
+    reached_indices.begin(),
+    find_reached_t<vertex_t>{search.vertices.data(), search.pairs.data(), num_reached});
+
+  auto new_first = thrust::make_zip_iterator(thrust::make_tuple(new_vertices.begin(),
+                                                                new_pairs.begin(),
+                                                                new_distances.begin(),
+                                                                new_predecessors.begin(),
+                                                                reached_indices.begin()));
+  auto num_improved = static_cast<size_t>(thrust::distance(
+    new_first,
+    thrust::remove_if(
+      handle.get_thrust_policy(),
+      new_first,
+      new_first + new_vertices.size(),
+      [distances = search.distances.data(), num_reached] __device__(auto val) {
+        auto idx = thrust::get<4>(val);
+        return (idx != num_reached) && (distances[idx] <= thrust::get<2>(val));
+      })));
+  new_vertices.resize(num_improved, handle.get_stream());
+  new_pairs.resize(num_improved, handle.get_stream());
+  new_distances.resize(num_improved, handle.get_stream());
+  new_predecessors.resize(num_improved, handle.get_stream());
+  reached_indices.resize(num_improved, handle.get_stream());
+
+  // 4. update the pairs reached before in place and merge the newly reached pairs
+
+  thrust::for_each(handle.get_thrust_policy(),
+                   new_first,
+                   new_first + num_improved,
+                   [distances    = search.distances.data(),
+                    predecessors = search.predecessors.data(),
+                    num_reached] __device__(auto val) {
+                     auto idx = thrust::get<4>(val);
+                     if (idx != num_reached) {
+                       distances[idx]    = thrust::get<2>(val);
+                       predecessors[idx] = thrust::get<3>(val);
+                     }
+                   });
+
+  auto num_inserted = static_cast<size_t>(thrust::count(
+    handle.get_thrust_policy(), reached_indices.begin(), reached_indices.end(), num_reached));
+  if (num_inserted > 0) {
+    rmm::device_uvector<vertex_t> inserted_vertices(num_inserted, handle.get_stream());
+    rmm::device_uvector<size_t> inserted_pairs(num_inserted, handle.get_stream());
+    rmm::device_uvector<weight_t> inserted_distances(num_inserted, handle.get_stream());
+    rmm::device_uvector<vertex_t> inserted_predecessors(num_inserted, handle.get_stream());
+    thrust::copy_if(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(thrust::make_tuple(
+        new_vertices.begin(), new_pairs.begin(), new_distances.begin(), new_predecessors.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(
+        new_vertices.end(), new_pairs.end(), new_distances.end(), new_predecessors.end())),
+      reached_indices.begin(),
+      thrust::make_zip_iterator(thrust::make_tuple(inserted_vertices.begin(),
+                                                   inserted_pairs.begin(),
+                                                   inserted_distances.begin(),
+                                                   inserted_predecessors.begin())),
+      [num_reached] __device__(auto idx) { return idx == num_reached; });
+
+    rmm::device_uvector<vertex_t> merged_vertices(num_reached + num_inserted, handle.get_stream());
+    rmm::device_uvector<size_t> merged_pairs(merged_vertices.size(), handle.get_stream());
+    rmm::device_uvector<weight_t> merged_distances(merged_vertices.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> merged_predecessors(merged_vertices.size(),
+                                                      handle.get_stream());
+    thrust::merge_by_key(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(search.vertices.begin(), search.pairs.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(search.vertices.end(), search.pairs.end())),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(inserted_vertices.begin(), inserted_pairs.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(inserted_vertices.end(), inserted_pairs.end())),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(search.distances.begin(), search.predecessors.begin())),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(inserted_distances.begin(), inserted_predecessors.begin())),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(merged_vertices.begin(), merged_pairs.begin())),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(merged_distances.begin(), merged_predecessors.begin())));
+    search.vertices     = std::move(merged_vertices);
+    search.pairs        = std::move(merged_pairs);
+    search.distances    = std::move(merged_distances);
+    search.predecessors = std::move(merged_predecessors);
+  }
+
+  // 5. queue the improved pairs by distance + heuristic (pairs that cannot lead to a shorter path
+  // are not queued)
+
+  constexpr uint8_t queue_none{0};
+  constexpr uint8_t queue_near{1};
+  constexpr uint8_t queue_far{2};
+  rmm::device_uvector<uint8_t> queues(num_improved, handle.get_stream());
+  thrust::transform(
+    handle.get_thrust_policy(),
+    thrust::make_zip_iterator(
+      thrust::make_tuple(new_vertices.begin(), new_pairs.begin(), new_distances.begin())),
+    thrust::make_zip_iterator(
+      thrust::make_tuple(new_vertices.end(), new_pairs.end(), new_distances.end())),
+    queues.begin(),
+    [heuristic_op,
+     targets,
+     best_distances,
+     threshold = search.near_far_threshold] __device__(auto val) {
+      auto pair = thrust::get<1>(val);
+      auto key  = thrust::get<2>(val) + heuristic_op(thrust::get<0>(val), targets[pair]);
+      return key >= best_distances[pair] ? queue_none
+                                          : (key < threshold ? queue_near : queue_far);
+    });
+  for (auto queue : {queue_near, queue_far}) {
+    auto num_queued = static_cast<size_t>(
+      thrust::count(handle.get_thrust_policy(), queues.begin(), queues.end(), queue));
+    rmm::device_uvector<vertex_t> queued_vertices(num_queued, handle.get_stream());
+    rmm::device_uvector<size_t> queued_pairs(num_queued, handle.get_stream());
+    thrust::copy_if(
+      handle.get_thrust_policy(),
+      new_key_first,
+      new_key_first + num_improved,
+      queues.begin(),
+      thrust::make_zip_iterator(thrust::make_tuple(queued_vertices.begin(), queued_pairs.begin())),
+      [queue] __device__(auto q) { return q == queue; });
+    insert_p2p_keys(
+      handle,
+      queue == queue_near ? search.near_vertices : search.far_vertices,
+      queue == queue_near ? search.near_pairs : search.far_pairs,
+      thrust::make_zip_iterator(thrust::make_tuple(queued_vertices.begin(), queued_pairs.begin())),
+      num_queued);
+  }
+
+  new_predecessors.resize(0, handle.get_stream());
+  new_predecessors.shrink_to_fit(handle.get_stream());
+  return std::make_tuple(std::move(new_vertices), std::move(new_pairs), std::move(new_distances));
+}
+
+// find the (vertex, pair) keys in the search and return (pair, distance + the found distance,
+// meeting vertex) for the found keys, (vertex, pair) should reside in the GPU owning the vertex
+template <typename vertex_t, typename weight_t>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<weight_t>,
+           rmm::device_uvector<vertex_t>>
+meet_p2p_search(raft::handle_t const& handle,
+                p2p_search_t<vertex_t, weight_t> const& search,
+                rmm::device_uvector<vertex_t>&& vertices,
+                rmm::device_uvector<size_t>&& pairs,
+                rmm::device_uvector<weight_t>&& distances,
+                rmm::device_uvector<vertex_t>&& meetings)
+{
+  auto first = thrust::make_zip_iterator(
+    thrust::make_tuple(vertices.begin(), pairs.begin(), distances.begin(), meetings.begin()));
+  thrust::transform(
+    handle.get_thrust_policy(),
+    first,
+    first + vertices.size(),
+    distances.begin(),
+    [find_reached = find_reached_t<vertex_t>{search.vertices.data(),
+                                             search.pairs.data(),
+                                             search.vertices.size()},
+     reached_distances = search.distances.data(),
+     num_reached       = search.vertices.size()] __device__(auto val) {
+      auto idx = find_reached(thrust::make_tuple(thrust::get<0>(val), thrust::get<1>(val)));
+      return idx != num_reached ? thrust::get<2>(val) + reached_distances[idx]
+                                : std::numeric_limits<weight_t>::max();
+    });
+  pairs.resize(thrust::distance(first,
+                                thrust::remove_if(handle.get_thrust_policy(),
+                                                  first,
+                                                  first + vertices.size(),
+                                                  [] __device__(auto val) {
+                                                    return thrust::get<2>(val) ==
+                                                           std::numeric_limits<weight_t>::max();
+                                                  })),
+               handle.get_stream());
+  distances.resize(pairs.size(), handle.get_stream());
+  meetings.resize(pairs.size(), handle.get_stream());
+  return std::make_tuple(std::move(pairs), std::move(distances), std::move(meetings));
+}
+
+// walk the predecessors of the search from the (vertex, pair) walkers back to the search origin
+// for every walker at once, the vertex reached after i hops is appended to the path elements with
+// the order i (backward search, skipping the walker vertex itself) or -i (forward search)
+template <typename vertex_t, typename weight_t, bool multi_gpu>
+void walk_p2p_predecessors(raft::handle_t const& handle,
+                           rmm::device_uvector<vertex_t> const& d_vertex_partition_range_lasts,
+                           p2p_search_t<vertex_t, weight_t> const& search,
+                           bool backward,
+                           vertex_t const* vertex_ids /* map the local vertices if not nullptr */,
+                           vertex_t local_vertex_partition_range_first,
+                           weight_t const* best_distances,
+                           rmm::device_uvector<vertex_t>&& walker_vertices,
+                           rmm::device_uvector<size_t>&& walker_pairs,
+                           rmm::device_uvector<size_t>& path_pairs,
+                           rmm::device_uvector<vertex_t>& path_orders,
+                           rmm::device_uvector<vertex_t>& path_vertices,
+                           rmm::device_uvector<weight_t>& path_distances)
+{
+  vertex_t hop{0};
+  while (aggregate_size<vertex_t, multi_gpu>(handle, walker_vertices.size()) > 0) {
+    if constexpr (multi_gpu) {
+      std::tie(walker_vertices, walker_pairs) =
+        shuffle_to_vertex_owners(handle,
+                                 d_vertex_partition_range_lasts,
+                                 std::move(walker_vertices),
+                                 std::move(walker_pairs));
+    }
+
+    auto walker_first =
+      thrust::make_zip_iterator(thrust::make_tuple(walker_vertices.begin(), walker_pairs.begin()));
+    rmm::device_uvector<size_t> reached_indices(walker_vertices.size(), handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      walker_first,
+                      walker_first + walker_vertices.size(),
+                      reached_indices.begin(),
+                      find_reached_t<vertex_t>{
+                        search.vertices.data(), search.pairs.data(), search.vertices.size()});
+
+    if (!backward || (hop > vertex_t{0})) {
+      auto old_size = path_pairs.size();
+      path_pairs.resize(old_size + walker_vertices.size(), handle.get_stream());
+      path_orders.resize(path_pairs.size(), handle.get_stream());
+      path_vertices.resize(path_pairs.size(), handle.get_stream());
+      path_distances.resize(path_pairs.size(), handle.get_stream());
+      thrust::copy(handle.get_thrust_policy(),
+                   walker_pairs.begin(),
+                   walker_pairs.end(),
+                   path_pairs.begin() + old_size);
+      thrust::fill(handle.get_thrust_policy(),
+                   path_orders.begin() + old_size,
+                   path_orders.end(),
+                   backward ? hop : -hop);
+      thrust::transform(
+        handle.get_thrust_policy(),
+        thrust::make_zip_iterator(thrust::make_tuple(
+          walker_vertices.begin(), walker_pairs.begin(), reached_indices.begin())),
+        thrust::make_zip_iterator(
+          thrust::make_tuple(walker_vertices.end(), walker_pairs.end(), reached_indices.end())),
+        thrust::make_zip_iterator(thrust::make_tuple(path_vertices.begin() + old_size,
+                                                     path_distances.begin() + old_size)),
+        [distances = search.distances.data(),
+         vertex_ids,
+         local_vertex_partition_range_first,
+         best_distances,
+         backward] __device__(auto val) {
+          auto v = thrust::get<0>(val);
+          auto d = distances[thrust::get<2>(val)];
+          return thrust::make_tuple(
+            vertex_ids != nullptr ? vertex_ids[v - local_vertex_partition_range_first] : v,
+            backward ? best_distances[thrust::get<1>(val)] - d : d);
+        });
+    }
+
+    thrust::transform(handle.get_thrust_policy(),
+                      reached_indices.begin(),
+                      reached_indices.end(),
+                      walker_vertices.begin(),
+                      [predecessors = search.predecessors.data()] __device__(auto idx) {
+                        return predecessors[idx];
+                      });
+    walker_pairs.resize(
+      thrust::distance(
+        walker_first,
+        thrust::remove_if(handle.get_thrust_policy(),
+                          walker_first,
+                          walker_first + walker_vertices.size(),
+                          [] __device__(auto val) {
+                            return thrust::get<0>(val) == invalid_vertex_id<vertex_t>::value;
+                          })),
+      handle.get_stream());
+    walker_vertices.resize(walker_pairs.size(), handle.get_stream());
+    ++hop;
+  }
+}
+
+// map the local vertices to the other vertex ID space
+template <typename vertex_t>
+void map_local_vertices(raft::handle_t const& handle,
+                        rmm::device_uvector<vertex_t>& vertices,
+                        vertex_t const* vertex_ids,
+                        vertex_t local_vertex_partition_range_first)
+{
+  thrust::transform(handle.get_thrust_policy(),
+                    vertices.begin(),
+                    vertices.end(),
+                    vertices.begin(),
+                    [vertex_ids, local_vertex_partition_range_first] __device__(auto v) {
+                      return vertex_ids[v - local_vertex_partition_range_first];
+                    });
+}
+
+template <typename vertex_t, bool multi_gpu>
+rmm::device_uvector<vertex_t> copy_vertex_partition_range_lasts(
+  raft::handle_t const& handle, std::vector<vertex_t> const& h_vertex_partition_range_lasts)
+{
+  rmm::device_uvector<vertex_t> d_vertex_partition_range_lasts(
+    multi_gpu ? h_vertex_partition_range_lasts.size() : size_t{0}, handle.get_stream());
+  if constexpr (multi_gpu) {
+    raft::update_device(d_vertex_partition_range_lasts.data(),
+                        h_vertex_partition_range_lasts.data(),
+                        h_vertex_partition_range_lasts.size(),
+                        handle.get_stream());
+  }
+  return d_vertex_partition_range_lasts;
+}
+
+// Every (source, target) pair submitted by any GPU is searched at once: the frontier holds
+// (vertex, pair) elements and every GPU expands the elements of the vertices it owns (or of the
+// edge partitions it holds), so the number of iterations is set by the longest search and not by
+// the number of pairs. If reverse_graph is valid (a push view of the reversed graph and the
+// push_graph_view vertex ID of each local vertex of the reversed graph), the targets are searched
+// backward at the same time and a pair stops once the smallest queued forward and backward
+// distances add up to at least the best path found.
+template <typename GraphViewType, typename HeuristicOp>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<typename GraphViewType::weight_type>>
+point_to_point_shortest_paths(
+  raft::handle_t const& handle,
+  GraphViewType const& push_graph_view,
+  std::optional<std::tuple<GraphViewType,
+                           raft::device_span<typename GraphViewType::vertex_type const>>>
+    reverse_graph,
+  raft::device_span<typename GraphViewType::vertex_type const> sources,
+  raft::device_span<typename GraphViewType::vertex_type const> targets,
+  HeuristicOp heuristic_op,
+  typename GraphViewType::weight_type cutoff,
+  bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_storage_transposed,
+                "GraphViewType should support the push model.");
+
+  auto constexpr invalid_distance = std::numeric_limits<weight_t>::max();
+  auto constexpr invalid_meeting  = std::numeric_limits<vertex_t>::max();
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(sources.size() == targets.size(),
+                  "Invalid input argument: sources and targets should have the same size.");
+  CUGRAPH_EXPECTS(push_graph_view.is_weighted(),
+                  "Invalid input argument: an unweighted graph is passed to shortest paths, BFS is "
+                  "more efficient for unweighted graphs.");
+  if (reverse_graph) {
+    auto const& reverse_graph_view = std::get<0>(*reverse_graph);
+    CUGRAPH_EXPECTS(
+      (reverse_graph_view.number_of_vertices() == push_graph_view.number_of_vertices()) &&
+        (reverse_graph_view.number_of_edges() == push_graph_view.number_of_edges()) &&
+        reverse_graph_view.is_weighted(),
+      "Invalid input argument: the transposed graph does not match the graph.");
+    CUGRAPH_EXPECTS(std::get<1>(*reverse_graph).size() ==
+                      static_cast<size_t>(reverse_graph_view.local_vertex_partition_range_size()),
+                    "Invalid input argument: transposed_graph_vertex_ids should have one element "
+                    "per local vertex of the transposed graph.");
+  }
+
+  if (do_expensive_check) {
+    auto num_invalid_vertices = thrust::count_if(
+      handle.get_thrust_policy(),
+      thrust::make_zip_iterator(thrust::make_tuple(sources.begin(), targets.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(sources.end(), targets.end())),
+      [num_vertices = push_graph_view.number_of_vertices()] __device__(auto pair) {
+        auto s = thrust::get<0>(pair);
+        auto t = thrust::get<1>(pair);
+        return !((s >= vertex_t{0}) && (s < num_vertices) && (t >= vertex_t{0}) &&
+                 (t < num_vertices));
+      });
+    if (reverse_graph) {
+      num_invalid_vertices += thrust::count_if(
+        handle.get_thrust_policy(),
+        std::get<1>(*reverse_graph).begin(),
+        std::get<1>(*reverse_graph).end(),
+        [num_vertices = push_graph_view.number_of_vertices()] __device__(auto v) {
+          return !((v >= vertex_t{0}) && (v < num_vertices));
+        });
+    }
+    if constexpr (GraphViewType::is_multi_gpu) {
+      num_invalid_vertices = host_scalar_allreduce(
+        handle.get_comms(), num_invalid_vertices, raft::comms::op_t::SUM, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input argument: sources, targets, or transposed_graph_vertex_ids have "
+                    "invalid vertex IDs.");
+
+    auto num_negative_edge_weights =
+      count_if_e(handle,
+                 push_graph_view,
+                 dummy_property_t<vertex_t>{}.device_view(),
+                 dummy_property_t<vertex_t>{}.device_view(),
+                 [] __device__(vertex_t, vertex_t, weight_t w, auto, auto) { return w < 0.0; });
+    CUGRAPH_EXPECTS(num_negative_edge_weights == 0,
+                    "Invalid input argument: input graph should have non-negative edge weights.");
+  }
+
+  // 2. assign global pair IDs and gather every pair's source and target
+
+  size_t pair_offset{0};
+  std::vector<size_t> pair_counts{sources.size()};
+  std::vector<size_t> pair_displacements{0};
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& comm  = handle.get_comms();
+    pair_counts = host_scalar_allgather(comm, sources.size(), handle.get_stream());
+    pair_displacements.resize(pair_counts.size());
+    std::exclusive_scan(
+      pair_counts.begin(), pair_counts.end(), pair_displacements.begin(), size_t{0});
+    pair_offset = pair_displacements[comm.get_rank()];
+  }
+  auto num_aggregate_pairs = pair_displacements.back() + pair_counts.back();
+
+  rmm::device_uvector<vertex_t> aggregate_sources(num_aggregate_pairs, handle.get_stream());
+  rmm::device_uvector<vertex_t> aggregate_targets(num_aggregate_pairs, handle.get_stream());
+  if constexpr (GraphViewType::is_multi_gpu) {
+    device_allgatherv(handle.get_comms(),
+                      sources.begin(),
+                      aggregate_sources.begin(),
+                      pair_counts,
+                      pair_displacements,
+                      handle.get_stream());
+    device_allgatherv(handle.get_comms(),
+                      targets.begin(),
+                      aggregate_targets.begin(),
+                      pair_counts,
+                      pair_displacements,
+                      handle.get_stream());
+  } else {
+    thrust::copy(
+      handle.get_thrust_policy(), sources.begin(), sources.end(), aggregate_sources.begin());
+    thrust::copy(
+      handle.get_thrust_policy(), targets.begin(), targets.end(), aggregate_targets.begin());
+  }
+
+  auto d_vertex_partition_range_lasts =
+    copy_vertex_partition_range_lasts<vertex_t, GraphViewType::is_multi_gpu>(
+      handle, push_graph_view.vertex_partition_range_lasts());
+
+  // 3. map between the vertex IDs of the graph and the reversed graph and find the targets in the
+  // reversed graph
+
+  rmm::device_uvector<vertex_t> reverse_vertex_ids(0, handle.get_stream());  // graph to reversed
+  rmm::device_uvector<vertex_t> d_reverse_vertex_partition_range_lasts(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> aggregate_reverse_targets(0, handle.get_stream());
+  if (reverse_graph) {
+    auto const& reverse_graph_view = std::get<0>(*reverse_graph);
+    auto vertex_ids                = std::get<1>(*reverse_graph);
+
+    d_reverse_vertex_partition_range_lasts =
+      copy_vertex_partition_range_lasts<vertex_t, GraphViewType::is_multi_gpu>(
+        handle, reverse_graph_view.vertex_partition_range_lasts());
+
+    rmm::device_uvector<vertex_t> graph_vertices(vertex_ids.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> reverse_vertices(vertex_ids.size(), handle.get_stream());
+    thrust::copy(
+      handle.get_thrust_policy(), vertex_ids.begin(), vertex_ids.end(), graph_vertices.begin());
+    thrust::sequence(handle.get_thrust_policy(),
+                     reverse_vertices.begin(),
+                     reverse_vertices.end(),
+                     reverse_graph_view.local_vertex_partition_range_first());
+    if constexpr (GraphViewType::is_multi_gpu) {
+      std::tie(graph_vertices, reverse_vertices) =
+        shuffle_to_vertex_owners(handle,
+                                 d_vertex_partition_range_lasts,
+                                 std::move(graph_vertices),
+                                 std::move(reverse_vertices));
+    }
+    reverse_vertex_ids.resize(push_graph_view.local_vertex_partition_range_size(),
+                              handle.get_stream());
+    thrust::scatter(handle.get_thrust_policy(),
+                    reverse_vertices.begin(),
+                    reverse_vertices.end(),
+                    thrust::make_transform_iterator(
+                      graph_vertices.begin(),
+                      [local_first = push_graph_view.local_vertex_partition_range_first()]
+                      __device__(auto v) { return v - local_first; }),
+                    reverse_vertex_ids.begin());
+
+    // only the GPU owning the target contributes a non-zero value
+    aggregate_reverse_targets.resize(num_aggregate_pairs, handle.get_stream());
+    thrust::transform(handle.get_thrust_policy(),
+                      aggregate_targets.begin(),
+                      aggregate_targets.end(),
+                      aggregate_reverse_targets.begin(),
+                      [reverse_vertex_ids = reverse_vertex_ids.data(),
+                       local_first = push_graph_view.local_vertex_partition_range_first(),
+                       local_last  = push_graph_view.local_vertex_partition_range_last()]
+                      __device__(auto t) {
+                        return ((t >= local_first) && (t < local_last))
+                                 ? reverse_vertex_ids[t - local_first]
+                                 : vertex_t{0};
+                      });
+    if constexpr (GraphViewType::is_multi_gpu) {
+      device_allreduce(handle.get_comms(),
+                       aggregate_reverse_targets.begin(),
+                       aggregate_reverse_targets.begin(),
+                       aggregate_reverse_targets.size(),
+                       raft::comms::op_t::SUM,
+                       handle.get_stream());
+    }
+  }
+
+  // 4. initialize the best path of every pair (replicated in multi-GPU), a path ends at the meeting
+  // vertex in the forward search (the target if reverse_graph is std::nullopt) and continues from
+  // there to the target in the backward search
+
+  rmm::device_uvector<weight_t> best_distances(num_aggregate_pairs, handle.get_stream());
+  rmm::device_uvector<vertex_t> best_meetings(num_aggregate_pairs, handle.get_stream());
+  thrust::transform(
+    handle.get_thrust_policy(),
+    thrust::make_zip_iterator(
+      thrust::make_tuple(aggregate_sources.begin(), aggregate_targets.begin())),
+    thrust::make_zip_iterator(thrust::make_tuple(aggregate_sources.end(), aggregate_targets.end())),
+    thrust::make_zip_iterator(thrust::make_tuple(best_distances.begin(), best_meetings.begin())),
+    [] __device__(auto pair) {
+      auto s = thrust::get<0>(pair);
+      return s == thrust::get<1>(pair) ? thrust::make_tuple(weight_t{0.0}, s)
+                                       : thrust::make_tuple(invalid_distance, invalid_meeting);
+    });
+
+  // 5. set-up the bucket width and the searches, the origins start in the far queues
+
+  weight_t delta{0.0};
+  if (push_graph_view.number_of_edges() > 0) {
+    weight_t average_vertex_degree{0.0};
+    weight_t average_edge_weight{0.0};
+    thrust::tie(average_vertex_degree, average_edge_weight) = transform_reduce_e(
+      handle,
+      push_graph_view,
+      dummy_property_t<vertex_t>{}.device_view(),
+      dummy_property_t<vertex_t>{}.device_view(),
+      [] __device__(vertex_t, vertex_t, weight_t w, auto, auto) {
+        return thrust::make_tuple(weight_t{1.0}, w);
+      },
+      thrust::make_tuple(weight_t{0.0}, weight_t{0.0}));
+    average_vertex_degree /= static_cast<weight_t>(push_graph_view.number_of_vertices());
+    average_edge_weight /= static_cast<weight_t>(push_graph_view.number_of_edges());
+    delta =
+      (static_cast<weight_t>(raft::warp_size()) * average_edge_weight) / average_vertex_degree;
+  }
+
+  auto init_search = [&handle, pair_offset, num_pairs = sources.size()](
+                       p2p_search_t<vertex_t, weight_t>& search,
+                       vertex_t const* origins /* indexed by pair */,
+                       rmm::device_uvector<vertex_t> const& d_lasts) {
+    search.vertices.resize(num_pairs, handle.get_stream());
+    search.pairs.resize(num_pairs, handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 origins + pair_offset,
+                 origins + pair_offset + num_pairs,
+                 search.vertices.begin());
+    thrust::sequence(
+      handle.get_thrust_policy(), search.pairs.begin(), search.pairs.end(), pair_offset);
+    if constexpr (GraphViewType::is_multi_gpu) {
+      std::tie(search.vertices, search.pairs) = shuffle_to_vertex_owners(
+        handle, d_lasts, std::move(search.vertices), std::move(search.pairs));
+    }
+    auto key_first = thrust::make_zip_iterator(
+      thrust::make_tuple(search.vertices.begin(), search.pairs.begin()));
+    thrust::sort(handle.get_thrust_policy(), key_first, key_first + search.vertices.size());
+    search.distances.resize(search.vertices.size(), handle.get_stream());
+    search.predecessors.resize(search.vertices.size(), handle.get_stream());
+    thrust::fill(handle.get_thrust_policy(),
+                 search.distances.begin(),
+                 search.distances.end(),
+                 weight_t{0.0});
+    thrust::fill(handle.get_thrust_policy(),
+                 search.predecessors.begin(),
+                 search.predecessors.end(),
+                 invalid_vertex_id<vertex_t>::value);
+    search.far_vertices.resize(search.vertices.size(), handle.get_stream());
+    search.far_pairs.resize(search.vertices.size(), handle.get_stream());
+    thrust::copy(handle.get_thrust_policy(),
+                 key_first,
+                 key_first + search.vertices.size(),
+                 thrust::make_zip_iterator(
+                   thrust::make_tuple(search.far_vertices.begin(), search.far_pairs.begin())));
+  };
+
+  p2p_search_t<vertex_t, weight_t> forward_search(handle);
+  p2p_search_t<vertex_t, weight_t> backward_search(handle);
+  init_search(forward_search, aggregate_sources.data(), d_vertex_partition_range_lasts);
+  if (reverse_graph) {
+    init_search(backward_search,
+                aggregate_reverse_targets.data(),
+                d_reverse_vertex_partition_range_lasts);
+  }
+
+  // the backward search has no heuristic
+  auto backward_heuristic_op = shared_heuristic_op_t<vertex_t, weight_t>{
+    nullptr,
+    reverse_graph ? std::get<0>(*reverse_graph).local_vertex_partition_range_first() : vertex_t{0}};
+
+  // 6. search iteration, every pair advances at once
+
+  rmm::device_uvector<uint8_t> finished(reverse_graph ? num_aggregate_pairs : size_t{0},
+                                        handle.get_stream());
+  while (true) {
+    auto num_near = size_t{0};
+    for (auto search_ptr : {&forward_search, &backward_search}) {
+      if ((search_ptr == &backward_search) && !reverse_graph) { continue; }
+      auto& search = *search_ptr;
+      auto n       = aggregate_size<vertex_t, GraphViewType::is_multi_gpu>(
+        handle, search.near_vertices.size());
+      if ((n == 0) && (aggregate_size<vertex_t, GraphViewType::is_multi_gpu>(
+                         handle, search.far_vertices.size()) > 0)) {
+        if (search_ptr == &forward_search) {
+          refill_p2p_near_queue<vertex_t, weight_t, GraphViewType::is_multi_gpu>(
+            handle, search, heuristic_op, aggregate_targets.data(), delta);
+        } else {
+          refill_p2p_near_queue<vertex_t, weight_t, GraphViewType::is_multi_gpu>(
+            handle, search, backward_heuristic_op, aggregate_targets.data(), delta);
+        }
+        n = aggregate_size<vertex_t, GraphViewType::is_multi_gpu>(handle,
+                                                                  search.near_vertices.size());
+      }
+      num_near += n;
+    }
+    if (num_near == 0) { break; }
+
+    // 6-1. expand both searches by one hop
+
+    auto [forward_vertices, forward_pairs, forward_distances] =
+      relax_p2p_search(handle,
+                       push_graph_view,
+                       forward_search,
+                       heuristic_op,
+                       aggregate_targets.data(),
+                       best_distances.data(),
+                       cutoff);
+
+    // 6-2. find the paths improved in this iteration, (pair, distance, meeting vertex) triplets
+
+    rmm::device_uvector<size_t> candidate_pairs(0, handle.get_stream());
+    rmm::device_uvector<weight_t> candidate_distances(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> candidate_meetings(0, handle.get_stream());
+    if (reverse_graph) {
+      auto [backward_vertices, backward_pairs, backward_distances] =
+        relax_p2p_search(handle,
+                         std::get<0>(*reverse_graph),
+                         backward_search,
+                         backward_heuristic_op,
+                         aggregate_targets.data(),
+                         best_distances.data(),
+                         cutoff);
+
+      // forward pairs meet the backward search in the reversed graph vertex ID space
+
+      rmm::device_uvector<vertex_t> forward_meetings(forward_vertices.size(), handle.get_stream());
+      thrust::copy(handle.get_thrust_policy(),
+                   forward_vertices.begin(),
+                   forward_vertices.end(),
+                   forward_meetings.begin());
+      map_local_vertices(handle,
+                         forward_vertices,
+                         reverse_vertex_ids.data(),
+                         push_graph_view.local_vertex_partition_range_first());
+      if constexpr (GraphViewType::is_multi_gpu) {
+        std::tie(forward_vertices, forward_pairs, forward_distances, forward_meetings) =
+          shuffle_to_vertex_owners(handle,
+                                   d_reverse_vertex_partition_range_lasts,
+                                   std::move(forward_vertices),
+                                   std::move(forward_pairs),
+                                   std::move(forward_distances),
+                                   std::move(forward_meetings));
+      }
+      auto [forward_candidate_pairs, forward_candidate_distances, forward_candidate_meetings] =
+        meet_p2p_search(handle,
+                        backward_search,
+                        std::move(forward_vertices),
+                        std::move(forward_pairs),
+                        std::move(forward_distances),
+                        std::move(forward_meetings));
+
+      // backward pairs meet the forward search in the graph vertex ID space
+
+      map_local_vertices(handle,
+                         backward_vertices,
+                         std::get<1>(*reverse_graph).data(),
+                         std::get<0>(*reverse_graph).local_vertex_partition_range_first());
+      rmm::device_uvector<vertex_t> backward_meetings(0, handle.get_stream());
+      if constexpr (GraphViewType::is_multi_gpu) {
+        std::tie(backward_vertices, backward_pairs, backward_distances) =
+          shuffle_to_vertex_owners(handle,
+                                   d_vertex_partition_range_lasts,
+                                   std::move(backward_vertices),
+                                   std::move(backward_pairs),
+                                   std::move(backward_distances));
+      }
+      backward_meetings.resize(backward_vertices.size(), handle.get_stream());
+      thrust::copy(handle.get_thrust_policy(),
+                   backward_vertices.begin(),
+                   backward_vertices.end(),
+                   backward_meetings.begin());
+      std::tie(candidate_pairs, candidate_distances, candidate_meetings) =
+        meet_p2p_search(handle,
+                        forward_search,
+                        std::move(backward_vertices),
+                        std::move(backward_pairs),
+                        std::move(backward_distances),
+                        std::move(backward_meetings));
+
+      auto old_size = candidate_pairs.size();
+      candidate_pairs.resize(old_size + forward_candidate_pairs.size(), handle.get_stream());
+      candidate_distances.resize(candidate_pairs.size(), handle.get_stream());
+      candidate_meetings.resize(candidate_pairs.size(), handle.get_stream());
+      thrust::copy(
+        handle.get_thrust_policy(),
+        thrust::make_zip_iterator(thrust::make_tuple(forward_candidate_pairs.begin(),
+                                                     forward_candidate_distances.begin(),
+                                                     forward_candidate_meetings.begin())),
+        thrust::make_zip_iterator(thrust::make_tuple(forward_candidate_pairs.end(),
+                                                     forward_candidate_distances.end(),
+                                                     forward_candidate_meetings.end())),
+        thrust::make_zip_iterator(thrust::make_tuple(candidate_pairs.begin() + old_size,
+                                                     candidate_distances.begin() + old_size,
+                                                     candidate_meetings.begin() + old_size)));
+    } else {
+      // a path is found when the forward search reaches the target
+
+      auto forward_first = thrust::make_zip_iterator(thrust::make_tuple(
+        forward_pairs.begin(), forward_distances.begin(), forward_vertices.begin()));
+      auto is_target = [targets = aggregate_targets.data()] __device__(auto val) {
+        return targets[thrust::get<0>(val)] == thrust::get<2>(val);
+      };
+      auto num_candidates =
+        static_cast<size_t>(thrust::count_if(handle.get_thrust_policy(),
+                                             forward_first,
+                                             forward_first + forward_pairs.size(),
+                                             is_target));
+      candidate_pairs.resize(num_candidates, handle.get_stream());
+      candidate_distances.resize(num_candidates, handle.get_stream());
+      candidate_meetings.resize(num_candidates, handle.get_stream());
+      thrust::copy_if(handle.get_thrust_policy(),
+                      forward_first,
+                      forward_first + forward_pairs.size(),
+                      thrust::make_zip_iterator(thrust::make_tuple(candidate_pairs.begin(),
+                                                                   candidate_distances.begin(),
+                                                                   candidate_meetings.begin())),
+                      is_target);
+    }
+
+    // 6-3. update the best paths, the smallest meeting vertex is taken among the equally short
+    // paths found in the same iteration
+
+    {
+      auto candidate_first = thrust::make_zip_iterator(thrust::make_tuple(
+        candidate_pairs.begin(), candidate_distances.begin(), candidate_meetings.begin()));
+      thrust::sort(
+        handle.get_thrust_policy(), candidate_first, candidate_first + candidate_pairs.size());
+      auto num_unique_candidates = static_cast<size_t>(thrust::distance(
+        candidate_first,
+        thrust::unique(handle.get_thrust_policy(),
+                       candidate_first,
+                       candidate_first + candidate_pairs.size(),
+                       [] __device__(auto lhs, auto rhs) {
+                         return thrust::get<0>(lhs) == thrust::get<0>(rhs);
+                       })));
+
+      rmm::device_uvector<weight_t> new_best_distances(best_distances.size(), handle.get_stream());
+      thrust::copy(handle.get_thrust_policy(),
+                   best_distances.begin(),
+                   best_distances.end(),
+                   new_best_distances.begin());
+      thrust::for_each(handle.get_thrust_policy(),
+                       candidate_first,
+                       candidate_first + num_unique_candidates,
+                       [best_distances = new_best_distances.data(),
+                        best_meetings  = best_meetings.data(),
+                        cutoff] __device__(auto val) {
+                         auto pair = thrust::get<0>(val);
+                         auto d    = thrust::get<1>(val);
+                         if ((d < cutoff) && (d < best_distances[pair])) {
+                           best_distances[pair] = d;
+                           best_meetings[pair]  = thrust::get<2>(val);
+                         }
+                       });
+      if constexpr (GraphViewType::is_multi_gpu) {
+        device_allreduce(handle.get_comms(),
+                         new_best_distances.begin(),
+                         best_distances.begin(),
+                         best_distances.size(),
+                         raft::comms::op_t::MIN,
+                         handle.get_stream());
+        thrust::transform(
+          handle.get_thrust_policy(),
+          thrust::make_zip_iterator(thrust::make_tuple(
+            new_best_distances.begin(), best_distances.begin(), best_meetings.begin())),
+          thrust::make_zip_iterator(thrust::make_tuple(
+            new_best_distances.end(), best_distances.end(), best_meetings.end())),
+          best_meetings.begin(),
+          [] __device__(auto val) {
+            return thrust::get<0>(val) == thrust::get<1>(val) ? thrust::get<2>(val)
+                                                               : invalid_meeting;
+          });
+        device_allreduce(handle.get_comms(),
+                         best_meetings.begin(),
+                         best_meetings.begin(),
+                         best_meetings.size(),
+                         raft::comms::op_t::MIN,
+                         handle.get_stream());
+      } else {
+        best_distances = std::move(new_best_distances);
+      }
+    }
+
+    // 6-4. a bidirectional search of a pair finishes once the smallest queued forward distance
+    // plus the smallest queued backward distance cannot beat the best path (every shorter path
+    // would pass through a queued vertex of each search)
+
+    if (reverse_graph) {
+      rmm::device_uvector<weight_t> min_queued_distances(2 * num_aggregate_pairs,
+                                                         handle.get_stream());
+      thrust::fill(handle.get_thrust_policy(),
+                   min_queued_distances.begin(),
+                   min_queued_distances.end(),
+                   invalid_distance);
+      for (size_t i = 0; i < 2; ++i) {
+        auto& search = i == 0 ? forward_search : backward_search;
+        for (auto queue_ptr : {&search.near_vertices, &search.far_vertices}) {
+          auto& queue_pairs =
+            queue_ptr == &search.near_vertices ? search.near_pairs : search.far_pairs;
+          auto key_first =
+            thrust::make_zip_iterator(thrust::make_tuple(queue_ptr->begin(), queue_pairs.begin()));
+          thrust::for_each(
+            handle.get_thrust_policy(),
+            key_first,
+            key_first + queue_ptr->size(),
+            [find_reached = find_reached_t<vertex_t>{search.vertices.data(),
+                                                     search.pairs.data(),
+                                                     search.vertices.size()},
+             distances    = search.distances.data(),
+             mins         = min_queued_distances.data() + i * num_aggregate_pairs] __device__(
+              auto key) {
+              atomic_min_non_negative(mins + thrust::get<1>(key), distances[find_reached(key)]);
+            });
+        }
+      }
+      if constexpr (GraphViewType::is_multi_gpu) {
+        device_allreduce(handle.get_comms(),
+                         min_queued_distances.begin(),
+                         min_queued_distances.begin(),
+                         min_queued_distances.size(),
+                         raft::comms::op_t::MIN,
+                         handle.get_stream());
+      }
+      thrust::transform(handle.get_thrust_policy(),
+                        thrust::make_counting_iterator(size_t{0}),
+                        thrust::make_counting_iterator(num_aggregate_pairs),
+                        finished.begin(),
+                        [mins = min_queued_distances.data(),
+                         best_distances = best_distances.data(),
+                         num_aggregate_pairs] __device__(auto pair) {
+                          return static_cast<uint8_t>(
+                            mins[pair] + mins[num_aggregate_pairs + pair] >= best_distances[pair]);
+                        });
+    }
+
+    // 6-5. drop the queued pairs that cannot lead to a shorter path
+
+    prune_p2p_queue(handle,
+                    forward_search,
+                    forward_search.near_vertices,
+                    forward_search.near_pairs,
+                    heuristic_op,
+                    aggregate_targets.data(),
+                    best_distances.data(),
+                    reverse_graph ? finished.data() : static_cast<uint8_t const*>(nullptr));
+    prune_p2p_queue(handle,
+                    forward_search,
+                    forward_search.far_vertices,
+                    forward_search.far_pairs,
+                    heuristic_op,
+                    aggregate_targets.data(),
+                    best_distances.data(),
+                    reverse_graph ? finished.data() : static_cast<uint8_t const*>(nullptr));
+    if (reverse_graph) {
+      prune_p2p_queue(handle,
+                      backward_search,
+                      backward_search.near_vertices,
+                      backward_search.near_pairs,
+                      backward_heuristic_op,
+                      aggregate_targets.data(),
+                      best_distances.data(),
+                      finished.data());
+      prune_p2p_queue(handle,
+                      backward_search,
+                      backward_search.far_vertices,
+                      backward_search.far_pairs,
+                      backward_heuristic_op,
+                      aggregate_targets.data(),
+                      best_distances.data(),
+                      finished.data());
+    }
+  }
+
+  // 7. extract the paths of every pair at once by walking the predecessors from the meeting vertex
+  // back to the source (and forward to the target in the backward search), one hop per step
+
+  rmm::device_uvector<size_t> path_pairs(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> path_orders(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> path_vertices(0, handle.get_stream());
+  rmm::device_uvector<weight_t> path_distances(0, handle.get_stream());
+  {
+    auto found_first = thrust::make_zip_iterator(
+      thrust::make_tuple(best_meetings.begin() + pair_offset,
+                         thrust::make_counting_iterator(pair_offset)));
+    auto is_found    = [best_distances = best_distances.data()] __device__(auto val) {
+      return best_distances[thrust::get<1>(val)] != invalid_distance;
+    };
+    auto num_found = static_cast<size_t>(thrust::count_if(
+      handle.get_thrust_policy(), found_first, found_first + sources.size(), is_found));
+
+    rmm::device_uvector<vertex_t> walker_vertices(num_found, handle.get_stream());
+    rmm::device_uvector<size_t> walker_pairs(num_found, handle.get_stream());
+    thrust::copy_if(
+      handle.get_thrust_policy(),
+      found_first,
+      found_first + sources.size(),
+      thrust::make_zip_iterator(thrust::make_tuple(walker_vertices.begin(), walker_pairs.begin())),
+      is_found);
+
+    if (reverse_graph) {
+      rmm::device_uvector<vertex_t> backward_walker_vertices(num_found, handle.get_stream());
+      rmm::device_uvector<size_t> backward_walker_pairs(num_found, handle.get_stream());
+      thrust::copy(handle.get_thrust_policy(),
+                   walker_vertices.begin(),
+                   walker_vertices.end(),
+                   backward_walker_vertices.begin());
+      thrust::copy(handle.get_thrust_policy(),
+                   walker_pairs.begin(),
+                   walker_pairs.end(),
+                   backward_walker_pairs.begin());
+      if constexpr (GraphViewType::is_multi_gpu) {
+        std::tie(backward_walker_vertices, backward_walker_pairs) =
+          shuffle_to_vertex_owners(handle,
+                                   d_vertex_partition_range_lasts,
+                                   std::move(backward_walker_vertices),
+                                   std::move(backward_walker_pairs));
+      }
+      map_local_vertices(handle,
+                         backward_walker_vertices,
+                         reverse_vertex_ids.data(),
+                         push_graph_view.local_vertex_partition_range_first());
+      walk_p2p_predecessors<vertex_t, weight_t, GraphViewType::is_multi_gpu>(
+        handle,
+        d_reverse_vertex_partition_range_lasts,
+        backward_search,
+        true,
+        std::get<1>(*reverse_graph).data(),
+        std::get<0>(*reverse_graph).local_vertex_partition_range_first(),
+        best_distances.data(),
+        std::move(backward_walker_vertices),
+        std::move(backward_walker_pairs),
+        path_pairs,
+        path_orders,
+        path_vertices,
+        path_distances);
+    }
+
+    walk_p2p_predecessors<vertex_t, weight_t, GraphViewType::is_multi_gpu>(
+      handle,
+      d_vertex_partition_range_lasts,
+      forward_search,
+      false,
+      static_cast<vertex_t const*>(nullptr),
+      push_graph_view.local_vertex_partition_range_first(),
+      best_distances.data(),
+      std::move(walker_vertices),
+      std::move(walker_pairs),
+      path_pairs,
+      path_orders,
+      path_vertices,
+      path_distances);
+  }
+
+  // 8. return the paths to the GPUs that submitted the pairs and pack them pair by pair
+
+  if constexpr (GraphViewType::is_multi_gpu) {
+    auto& comm = handle.get_comms();
+
+    std::vector<size_t> h_pair_lasts(pair_counts.size());
+    std::inclusive_scan(pair_counts.begin(), pair_counts.end(), h_pair_lasts.begin());
+    rmm::device_uvector<size_t> d_pair_lasts(h_pair_lasts.size(), handle.get_stream());
+    raft::update_device(
+      d_pair_lasts.data(), h_pair_lasts.data(), h_pair_lasts.size(), handle.get_stream());
+
+    auto path_first = thrust::make_zip_iterator(thrust::make_tuple(
+      path_pairs.begin(), path_orders.begin(), path_vertices.begin(), path_distances.begin()));
+    std::forward_as_tuple(std::tie(path_pairs, path_orders, path_vertices, path_distances),
+                          std::ignore) =
+      groupby_gpu_id_and_shuffle_values(
+        comm,
+        path_first,
+        path_first + path_pairs.size(),
+        [pair_lasts = raft::device_span<size_t const>(d_pair_lasts.data(),
+                                                      d_pair_lasts.size())] __device__(auto val) {
+          return static_cast<int>(thrust::distance(
+            pair_lasts.begin(),
+            thrust::upper_bound(
+              thrust::seq, pair_lasts.begin(), pair_lasts.end(), thrust::get<0>(val))));
+        },
+        handle.get_stream());
+  }
+
+  auto path_key_first =
+    thrust::make_zip_iterator(thrust::make_tuple(path_pairs.begin(), path_orders.begin()));
+  thrust::sort_by_key(
+    handle.get_thrust_policy(),
+    path_key_first,
+    path_key_first + path_pairs.size(),
+    thrust::make_zip_iterator(thrust::make_tuple(path_vertices.begin(), path_distances.begin())));
+
+  rmm::device_uvector<size_t> offsets(sources.size() + 1, handle.get_stream());
+  thrust::lower_bound(handle.get_thrust_policy(),
+                      path_pairs.begin(),
+                      path_pairs.end(),
+                      thrust::make_counting_iterator(pair_offset),
+                      thrust::make_counting_iterator(pair_offset + offsets.size()),
+                      offsets.begin());
+
+  return std::make_tuple(std::move(offsets), std::move(path_vertices), std::move(path_distances));
+}
+
+template <typename GraphViewType>
+void check_p2p_heuristics(raft::handle_t const& handle,
+                          GraphViewType const& push_graph_view,
+                          typename GraphViewType::weight_type const* heuristics,
+                          size_t num_heuristics)
+{
+  auto num_negative_heuristics = static_cast<size_t>(thrust::count_if(
+    handle.get_thrust_policy(), heuristics, heuristics + num_heuristics, [] __device__(auto h) {
+      return h < 0.0;
+    }));
+  if constexpr (GraphViewType::is_multi_gpu) {
+    num_negative_heuristics = host_scalar_allreduce(
+      handle.get_comms(), num_negative_heuristics, raft::comms::op_t::SUM, handle.get_stream());
+  }
+  CUGRAPH_EXPECTS(num_negative_heuristics == 0,
+                  "Invalid input argument: heuristics should be non-negative.");
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+point_to_point_shortest_paths(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  raft::device_span<vertex_t const> sources,
+  raft::device_span<vertex_t const> targets,
+  std::optional<weight_t const*> heuristics,
+  weight_t cutoff,
+  bool do_expensive_check)
+{
+  if (do_expensive_check && heuristics) {
+    detail::check_p2p_heuristics(
+      handle, graph_view, *heuristics, graph_view.local_vertex_partition_range_size());
+  }
+
+  return detail::point_to_point_shortest_paths(
+    handle,
+    graph_view,
+    std::optional<std::tuple<graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu>,
+                             raft::device_span<vertex_t const>>>{std::nullopt},
+    sources,
+    targets,
+    detail::shared_heuristic_op_t<vertex_t, weight_t>{
+      heuristics ? *heuristics : static_cast<weight_t const*>(nullptr),
+      graph_view.local_vertex_partition_range_first()},
+    cutoff,
+    do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+point_to_point_shortest_paths(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  raft::device_span<vertex_t const> sources,
+  raft::device_span<vertex_t const> targets,
+  raft::device_span<vertex_t const> heuristic_targets,
+  raft::device_span<weight_t const> heuristics,
+  weight_t cutoff,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(heuristics.size() == heuristic_targets.size() *
+                                         static_cast<size_t>(
+                                           graph_view.local_vertex_partition_range_size()),
+                  "Invalid input argument: heuristics should have one value per (heuristic target, "
+                  "local vertex) pair.");
+
+  if (do_expensive_check) {
+    // is_sorted with less_equal fails on any non-increasing adjacent pair
+    CUGRAPH_EXPECTS(thrust::is_sorted(handle.get_thrust_policy(),
+                                      heuristic_targets.begin(),
+                                      heuristic_targets.end(),
+                                      thrust::less_equal<vertex_t>{}),
+                    "Invalid input argument: heuristic_targets should be sorted and unique.");
+    detail::check_p2p_heuristics(handle, graph_view, heuristics.data(), heuristics.size());
+  }
+
+  return detail::point_to_point_shortest_paths(
+    handle,
+    graph_view,
+    std::optional<std::tuple<graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu>,
+                             raft::device_span<vertex_t const>>>{std::nullopt},
+    sources,
+    targets,
+    detail::per_target_heuristic_op_t<vertex_t, weight_t>{
+      heuristic_targets,
+      heuristics.data(),
+      graph_view.local_vertex_partition_range_first(),
+      graph_view.local_vertex_partition_range_size()},
+    cutoff,
+    do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+point_to_point_shortest_paths(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const& transposed_graph_view,
+  raft::device_span<vertex_t const> transposed_graph_vertex_ids,
+  raft::device_span<vertex_t const> sources,
+  raft::device_span<vertex_t const> targets,
+  std::optional<weight_t const*> heuristics,
+  weight_t cutoff,
+  bool do_expensive_check)
+{
+  if (do_expensive_check && heuristics) {
+    detail::check_p2p_heuristics(
+      handle, graph_view, *heuristics, graph_view.local_vertex_partition_range_size());
+  }
+
+  return detail::point_to_point_shortest_paths(
+    handle,
+    graph_view,
+    std::make_optional(std::make_tuple(transposed_graph_view.reverse_view(),
+                                       transposed_graph_vertex_ids)),
+    sources,
+    targets,
+    detail::shared_heuristic_op_t<vertex_t, weight_t>{
+      heuristics ? *heuristics : static_cast<weight_t const*>(nullptr),
+      graph_view.local_vertex_partition_range_first()},
+    cutoff,
+    do_expensive_check);
+}
+
+}  // namespace cugraph
@@ -132,8 +132,11 @@ void sssp(raft::handle_t const& handle,
   constexpr size_t bucket_idx_far       = 2;
   constexpr size_t num_buckets          = 3;
 
-  vertex_frontier_t<vertex_t, void, GraphViewType::is_multi_gpu> vertex_frontier(handle,
-                                                                                 num_buckets);
+  vertex_frontier_t<vertex_t, void, GraphViewType::is_multi_gpu> vertex_frontier(
+    handle,
+    num_buckets,
+    push_graph_view.local_vertex_partition_range_first(),
+    push_graph_view.local_vertex_partition_range_last());
 
   // 5. SSSP iteration
 
@@ -152,10 +155,12 @@ void sssp(raft::handle_t const& handle,
   auto near_far_threshold = delta;
   while (true) {
     if (GraphViewType::is_multi_gpu) {
+      auto const& cur_near_frontier_bucket =
+        vertex_frontier.bucket(bucket_idx_cur_near);  // const access keeps the bucket bitmap valid
       update_edge_partition_src_property(handle,
                                          push_graph_view,
-                                         vertex_frontier.bucket(bucket_idx_cur_near).begin(),
-                                         vertex_frontier.bucket(bucket_idx_cur_near).end(),
+                                         cur_near_frontier_bucket.begin(),
+                                         cur_near_frontier_bucket.end(),
                                          distances,
                                          edge_partition_src_distances);
     }
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace cugraph {
+namespace detail {
+
+// parse a Linux sysfs CPU/node list (e.g. "0-15,32-47")
+inline std::vector<int> parse_host_id_list(std::string const& list)
+{
+  std::vector<int> ids{};
+  std::stringstream ss(list);
+  std::string range{};
+  while (std::getline(ss, range, ',')) {
+    if (range.empty() || (range == "\n")) { continue; }
+    auto dash = range.find('-');
+    auto first = std::stoi(range.substr(0, dash));
+    auto last  = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+    for (auto id = first; id <= last; ++id) {
+      ids.push_back(id);
+    }
+  }
+  return ids;
+}
+
+// CPU IDs of each NUMA node with CPUs, empty if the topology is not available
+inline std::vector<std::vector<int>> host_numa_node_cpus()
+{
+  std::vector<std::vector<int>> node_cpus{};
+#ifdef __linux__
+  std::string line{};
+  std::ifstream possible("/sys/devices/system/node/possible");
+  if (!possible || !std::getline(possible, line)) { return node_cpus; }
+  for (auto node : parse_host_id_list(line)) {
+    std::ifstream cpulist("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    if (cpulist && std::getline(cpulist, line)) {
+      auto cpus = parse_host_id_list(line);
+      if (!cpus.empty()) { node_cpus.push_back(std::move(cpus)); }
+    }
+  }
+#endif
+  return node_cpus;
+}
+
+// CPU IDs the calling thread may run on, empty if not supported or failed
+inline std::vector<int> host_this_thread_cpus()
+{
+  std::vector<int> cpus{};
+#ifdef __linux__
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  if (pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpu_set) == 0) {
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if (CPU_ISSET(cpu, &cpu_set)) { cpus.push_back(cpu); }
+    }
+  }
+#endif
+  return cpus;
+}
+
+// pin the calling thread to the given CPUs, returns false if not supported or failed
+inline bool pin_this_thread_to_host_cpus(std::vector<int> const& cpus)
+{
+#ifdef __linux__
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (auto cpu : cpus) {
+    if ((cpu >= 0) && (cpu < CPU_SETSIZE)) { CPU_SET(cpu, &cpu_set); }
+  }
+  return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpu_set) == 0;
+#else
+  return false;
+#endif
+}
+
+}  // namespace detail
+}  // namespace cugraph
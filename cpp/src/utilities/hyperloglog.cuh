@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <thrust/tuple.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace cugraph {
+namespace detail {
+namespace hll {
+
+// HyperLogLog counters with 8-bit registers, eight registers are packed in a 64-bit word so
+// register unions are computed with byte-wise (SIMD within a register) maximums. A register stores
+// at most 64 - log2(number of registers) + 1 (< 128), so the most significant bit of every byte is
+// free.
+
+using register_word_t = uint64_t;
+
+constexpr size_t registers_per_word{sizeof(register_word_t)};
+
+// registers are processed in slabs of four words (32 registers) per vertex, as the graph primitives
+// take arithmetic types or thrust tuples of arithmetic types for vertex properties
+using register_slab_t =
+  thrust::tuple<register_word_t, register_word_t, register_word_t, register_word_t>;
+
+constexpr size_t words_per_slab{thrust::tuple_size<register_slab_t>::value};
+constexpr size_t registers_per_slab{registers_per_word * words_per_slab};
+
+// splitmix64 finalizer
+__host__ __device__ inline uint64_t hash(uint64_t key, uint64_t seed)
+{
+  auto x = key + seed + uint64_t{0x9e3779b97f4a7c15};
+  x      = (x ^ (x >> 30)) * uint64_t{0xbf58476d1ce4e5b9};
+  x      = (x ^ (x >> 27)) * uint64_t{0x94d049bb133111eb};
+  return x ^ (x >> 31);
+}
+
+// the lower log2_num_registers bits of a hash value select a register, the register value is the
+// position of the leftmost 1 bit in the remaining bits
+__host__ __device__ inline uint8_t rank(uint64_t hash_value, uint32_t log2_num_registers)
+{
+  auto w = hash_value >> log2_num_registers;
+  if (w == 0) { return static_cast<uint8_t>(64 - log2_num_registers + 1); }
+#ifdef __CUDA_ARCH__
+  auto leading_zeros = static_cast<uint32_t>(__clzll(static_cast<long long>(w)));
+#else
+  auto leading_zeros = static_cast<uint32_t>(__builtin_clzll(w));
+#endif
+  return static_cast<uint8_t>(leading_zeros - log2_num_registers + 1);
+}
+
+__host__ __device__ inline register_word_t register_word_max(register_word_t lhs,
+                                                             register_word_t rhs)
+{
+#ifdef __CUDA_ARCH__
+  auto lo = __vmaxu4(static_cast<uint32_t>(lhs), static_cast<uint32_t>(rhs));
+  auto hi = __vmaxu4(static_cast<uint32_t>(lhs >> 32), static_cast<uint32_t>(rhs >> 32));
+  return (static_cast<register_word_t>(hi) << 32) | static_cast<register_word_t>(lo);
+#else
+  constexpr register_word_t msbs{0x8080808080808080};
+  // the most significant bit of a byte is set iff the lhs register >= the rhs register (this does
+  // not borrow across bytes as registers are smaller than 128)
+  auto ge   = ((lhs | msbs) - rhs) & msbs;
+  auto mask = (ge >> 7) * register_word_t{0xff};
+  return (lhs & mask) | (rhs & ~mask);
+#endif
+}
+
+// reduction operator (see prims/reduce_op.cuh) computing the union of register slabs,
+// register_slab_t{} (all zero registers, the empty set) is the identity element
+struct register_slab_max_t {
+  using value_type                    = register_slab_t;
+  static constexpr bool pure_function = true;  // this can be called in any process
+
+  __host__ __device__ register_slab_t operator()(register_slab_t const& lhs,
+                                                 register_slab_t const& rhs) const
+  {
+    return thrust::make_tuple(register_word_max(thrust::get<0>(lhs), thrust::get<0>(rhs)),
+                              register_word_max(thrust::get<1>(lhs), thrust::get<1>(rhs)),
+                              register_word_max(thrust::get<2>(lhs), thrust::get<2>(rhs)),
+                              register_word_max(thrust::get<3>(lhs), thrust::get<3>(rhs)));
+  }
+};
+
+// accumulate sum_j 2^(-register_j) and the number of zero registers over the registers of a word
+__host__ __device__ inline void accumulate_register_word(register_word_t word,
+                                                         double& inverse_power_sum,
+                                                         uint32_t& num_zeros)
+{
+  for (size_t i = 0; i < registers_per_word; ++i) {
+    auto r = static_cast<uint32_t>((word >> (i * 8)) & register_word_t{0xff});
+    inverse_power_sum += 1.0 / static_cast<double>(uint64_t{1} << r);
+    num_zeros += (r == 0) ? uint32_t{1} : uint32_t{0};
+  }
+}
+
+// HyperLogLog cardinality estimate (with the linear counting correction for small cardinalities),
+// a 64-bit hash function makes the large range correction unnecessary
+__host__ __device__ inline double estimate(double inverse_power_sum,
+                                           uint32_t num_zeros,
+                                           size_t num_registers)
+{
+  auto m     = static_cast<double>(num_registers);
+  auto alpha = num_registers == 16   ? 0.673
+               : num_registers == 32 ? 0.697
+               : num_registers == 64 ? 0.709
+                                     : 0.7213 / (1.0 + 1.079 / m);
+  auto e     = alpha * m * m / inverse_power_sum;
+  if ((e <= 2.5 * m) && (num_zeros > 0)) { e = m * log(m / static_cast<double>(num_zeros)); }
+  return e;
+}
+
+}  // namespace hll
+}  // namespace detail
+}  // namespace cugraph
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "c_test_utils.h" /* RUN_TEST */
+
+#include <cugraph_c/arrow.h>
+
+#include <stdio.h>
+
+void release_schema_noop(struct ArrowSchema* schema) { schema->release = NULL; }
+void release_array_noop(struct ArrowArray* array) { array->release = NULL; }
+
+/*
+ * View an Arrow array produced outside cugraph (with an offset) as a host array.
+ */
+int test_host_array_view_from_arrow()
+{
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error;
+
+  int64_t h_values[]     = {7, 0, 1, 2, 3};
+  const void* buffers[2] = {NULL, h_values};
+
+  /* the buffers are owned by this function, so the release callbacks have nothing to free */
+  struct ArrowSchema schema = {"l", "src", NULL, 0, 0, NULL, NULL, release_schema_noop, NULL};
+  struct ArrowArray array = {4, 0, 1, 2, 0, buffers, NULL, NULL, release_array_noop, NULL};
+
+  cugraph_type_erased_host_array_view_t* view;
+
+  ret_code = cugraph_type_erased_host_array_view_from_arrow(&array, &schema, &view, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "view from arrow failed.");
+
+  TEST_ASSERT(test_ret_value, cugraph_type_erased_host_array_size(view) == 4, "wrong size.");
+  TEST_ASSERT(test_ret_value, cugraph_type_erased_host_array_type(view) == INT64, "wrong type.");
+
+  int64_t* h_view = (int64_t*)cugraph_type_erased_host_array_pointer(view);
+  for (int i = 0; (i < 4) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value, h_view[i] == h_values[i + 1], "view doesn't match.");
+  }
+
+  cugraph_type_erased_host_array_view_free(view);
+
+  schema.format = "u";  // utf8 strings, not supported
+  ret_code = cugraph_type_erased_host_array_view_from_arrow(&array, &schema, &view, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_INVALID_INPUT, "unsupported type accepted.");
+  cugraph_error_free(ret_error);
+
+  array.release(&array);
+  schema.release(&schema);
+
+  return test_ret_value;
+}
+
+/*
+ * Export a device array to Arrow and view it back (zero-copy round trip).
+ */
+int test_device_array_arrow_round_trip()
+{
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error;
+
+  size_t num_elems = 5;
+  float h_values[] = {0.5f, 1.5f, 2.5f, 3.5f, 4.5f};
+  float h_result[] = {0, 0, 0, 0, 0};
+
+  cugraph_resource_handle_t* p_handle = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  cugraph_type_erased_device_array_t* values;
+  cugraph_type_erased_device_array_view_t* values_view;
+
+  ret_code =
+    cugraph_type_erased_device_array_create(p_handle, num_elems, FLOAT32, &values, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "values create failed.");
+
+  values_view = cugraph_type_erased_device_array_view(values);
+
+  ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+    p_handle, values_view, (byte_t*)h_values, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "values copy_from_host failed.");
+
+  const void* exported_pointer = cugraph_type_erased_device_array_view_pointer(values_view);
+  cugraph_type_erased_device_array_view_free(values_view);
+
+  struct ArrowDeviceArray array;
+  struct ArrowSchema schema;
+
+  ret_code =
+    cugraph_type_erased_device_array_export_arrow(p_handle, values, &array, &schema, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "export to arrow failed.");
+  TEST_ASSERT(test_ret_value, array.device_type == ARROW_DEVICE_CUDA, "wrong device type.");
+  TEST_ASSERT(test_ret_value, array.array.length == (int64_t)num_elems, "wrong length.");
+  TEST_ASSERT(test_ret_value, array.array.buffers[1] == exported_pointer, "buffer was copied.");
+
+  ret_code = cugraph_type_erased_device_array_view_from_arrow(
+    p_handle, &array, &schema, &values_view, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "view from arrow failed.");
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_result, values_view, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  for (int i = 0; (i < num_elems) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value, h_result[i] == h_values[i], "values don't match.");
+  }
+
+  cugraph_type_erased_device_array_view_free(values_view);
+  array.array.release(&array.array);
+  schema.release(&schema);
+  TEST_ASSERT(test_ret_value, array.array.release == NULL, "array not marked released.");
+
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+  int result = 0;
+  result |= RUN_TEST(test_host_array_view_from_arrow);
+  result |= RUN_TEST(test_device_array_arrow_round_trip);
+  return result;
+}
@@ -169,6 +169,401 @@ int test_bfs_with_transpose()
                           TRUE);
 }
 
+int test_bfs_alternating_with_pagerank(cugraph_orientation_policy_t policy)
+{
+  size_t num_edges    = 8;
+  size_t num_vertices = 6;
+
+  vertex_t h_src[]                 = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t h_dst[]                 = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t h_wgt[]                 = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  vertex_t h_seeds[]               = {0};
+  vertex_t expected_distances[]    = {0, 1, 2147483647, 2, 2, 3};
+  vertex_t expected_predecessors[] = {-1, 0, -1, 1, 1, 3};
+
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error    = NULL;
+
+  cugraph_resource_handle_t* p_handle                    = NULL;
+  cugraph_graph_t* p_graph                               = NULL;
+  cugraph_type_erased_device_array_t* p_sources          = NULL;
+  cugraph_type_erased_device_array_view_t* p_source_view = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  // PageRank wants store_transposed = TRUE, BFS wants store_transposed = FALSE
+  ret_code = create_test_graph(
+    p_handle, h_src, h_dst, h_wgt, num_edges, TRUE, FALSE, FALSE, &p_graph, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "create_test_graph failed.");
+
+  ret_code = cugraph_graph_set_orientation_policy(p_handle, p_graph, policy, 1 << 20, &ret_error);
+  TEST_ASSERT(
+    test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_graph_set_orientation_policy failed.");
+
+  ret_code = cugraph_type_erased_device_array_create(p_handle, 1, INT32, &p_sources, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "p_sources create failed.");
+
+  p_source_view = cugraph_type_erased_device_array_view(p_sources);
+
+  ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+    p_handle, p_source_view, (byte_t*)h_seeds, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "src copy_from_host failed.");
+
+  for (int iter = 0; (iter < 2) && (test_ret_value == 0); ++iter) {
+    cugraph_paths_result_t* p_bfs_result           = NULL;
+    cugraph_centrality_result_t* p_pagerank_result = NULL;
+
+    ret_code = cugraph_bfs(
+      p_handle, p_graph, p_source_view, FALSE, 10, TRUE, FALSE, &p_bfs_result, &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_bfs failed.");
+
+    vertex_t h_vertices[num_vertices];
+    vertex_t h_distances[num_vertices];
+    vertex_t h_predecessors[num_vertices];
+
+    ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+      p_handle, (byte_t*)h_vertices, cugraph_paths_result_get_vertices(p_bfs_result), &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+    ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+      p_handle, (byte_t*)h_distances, cugraph_paths_result_get_distances(p_bfs_result), &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+    ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+      p_handle,
+      (byte_t*)h_predecessors,
+      cugraph_paths_result_get_predecessors(p_bfs_result),
+      &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+    for (int i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+      TEST_ASSERT(test_ret_value,
+                  expected_distances[h_vertices[i]] == h_distances[i],
+                  "bfs distances don't match");
+
+      TEST_ASSERT(test_ret_value,
+                  expected_predecessors[h_vertices[i]] == h_predecessors[i],
+                  "bfs predecessors don't match");
+    }
+
+    cugraph_paths_result_free(p_bfs_result);
+
+    // transposes the graph back (or swaps to the kept orientation)
+    ret_code = cugraph_pagerank(p_handle,
+                                p_graph,
+                                NULL,
+                                NULL,
+                                NULL,
+                                NULL,
+                                0.95,
+                                0.0001,
+                                10,
+                                FALSE,
+                                &p_pagerank_result,
+                                &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_pagerank failed.");
+
+    cugraph_centrality_result_free(p_pagerank_result);
+  }
+
+  cugraph_type_erased_device_array_free(p_sources);
+  cugraph_sg_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int test_bfs_alternating_keep_one()
+{
+  return test_bfs_alternating_with_pagerank(CUGRAPH_ORIENTATION_KEEP_ONE);
+}
+
+int test_bfs_alternating_keep_both()
+{
+  return test_bfs_alternating_with_pagerank(CUGRAPH_ORIENTATION_KEEP_BOTH);
+}
+
+int test_bfs_alternating_budgeted()
+{
+  return test_bfs_alternating_with_pagerank(CUGRAPH_ORIENTATION_BUDGETED);
+}
+
+int test_bfs_batched()
+{
+  int test_ret_value = 0;
+
+  size_t num_edges    = 8;
+  size_t num_requests = 4;
+  size_t num_results  = 12;
+
+  vertex_t src[]                = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t dst[]                = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t wgt[]                = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  vertex_t seeds[]              = {0, 1, 0, 5};
+  vertex_t depth_limits[]       = {1, 2, 10, 3};
+  int64_t expected_offsets[]    = {0, 2, 6, 11, 12};
+  vertex_t expected_vertices[]  = {0, 1, 1, 3, 4, 5, 0, 1, 3, 4, 5, 5};
+  vertex_t expected_distances[] = {0, 1, 0, 1, 1, 2, 0, 1, 2, 2, 3, 0};
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error    = NULL;
+
+  cugraph_resource_handle_t* p_handle                          = NULL;
+  cugraph_graph_t* p_graph                                     = NULL;
+  cugraph_paths_result_t* p_result                             = NULL;
+  cugraph_type_erased_device_array_t* p_sources                = NULL;
+  cugraph_type_erased_device_array_t* p_depth_limits           = NULL;
+  cugraph_type_erased_device_array_view_t* p_source_view       = NULL;
+  cugraph_type_erased_device_array_view_t* p_depth_limits_view = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  ret_code = create_test_graph(
+    p_handle, src, dst, wgt, num_edges, FALSE, FALSE, FALSE, &p_graph, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "create_test_graph failed.");
+
+  ret_code =
+    cugraph_type_erased_device_array_create(p_handle, num_requests, INT32, &p_sources, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "p_sources create failed.");
+
+  p_source_view = cugraph_type_erased_device_array_view(p_sources);
+
+  ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+    p_handle, p_source_view, (byte_t*)seeds, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "src copy_from_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_create(
+    p_handle, num_requests, INT32, &p_depth_limits, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "p_depth_limits create failed.");
+
+  p_depth_limits_view = cugraph_type_erased_device_array_view(p_depth_limits);
+
+  ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+    p_handle, p_depth_limits_view, (byte_t*)depth_limits, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "depth_limits copy_from_host failed.");
+
+  ret_code = cugraph_bfs_batched(p_handle,
+                                 p_graph,
+                                 p_source_view,
+                                 p_depth_limits_view,
+                                 0,
+                                 NULL,
+                                 0,
+                                 0,
+                                 TRUE,
+                                 FALSE,
+                                 &p_result,
+                                 &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_bfs_batched failed.");
+
+  cugraph_type_erased_device_array_view_t* offsets;
+  cugraph_type_erased_device_array_view_t* vertices;
+  cugraph_type_erased_device_array_view_t* distances;
+  cugraph_type_erased_device_array_view_t* predecessors;
+
+  offsets      = cugraph_paths_result_get_offsets(p_result);
+  vertices     = cugraph_paths_result_get_vertices(p_result);
+  distances    = cugraph_paths_result_get_distances(p_result);
+  predecessors = cugraph_paths_result_get_predecessors(p_result);
+
+  TEST_ASSERT(test_ret_value,
+              cugraph_type_erased_device_array_view_size(offsets) == (num_requests + 1),
+              "offsets size doesn't match");
+  TEST_ASSERT(test_ret_value,
+              cugraph_type_erased_device_array_view_size(vertices) == num_results,
+              "number of reached vertices doesn't match");
+
+  int64_t h_offsets[num_requests + 1];
+  vertex_t h_vertices[num_results];
+  vertex_t h_distances[num_results];
+  vertex_t h_predecessors[num_results];
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_offsets, offsets, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_vertices, vertices, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_distances, distances, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_predecessors, predecessors, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  for (int i = 0; (i < (num_requests + 1)) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(
+      test_ret_value, expected_offsets[i] == h_offsets[i], "bfs_batched offsets don't match");
+  }
+
+  for (int i = 0; (i < num_results) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(
+      test_ret_value, expected_vertices[i] == h_vertices[i], "bfs_batched vertices don't match");
+    TEST_ASSERT(test_ret_value,
+                expected_distances[i] == h_distances[i],
+                "bfs_batched distances don't match");
+  }
+
+  // predecessors may differ between equally short paths, check that each one is an in-neighbor
+  // reached by the same request one hop earlier
+  for (int r = 0; (r < num_requests) && (test_ret_value == 0); ++r) {
+    for (int64_t i = h_offsets[r]; (i < h_offsets[r + 1]) && (test_ret_value == 0); ++i) {
+      if (h_distances[i] == 0) {
+        TEST_ASSERT(test_ret_value, h_predecessors[i] == -1, "source predecessor should be -1");
+        continue;
+      }
+
+      int valid = 0;
+      for (int e = 0; e < num_edges; ++e) {
+        if ((src[e] != h_predecessors[i]) || (dst[e] != h_vertices[i])) continue;
+        for (int64_t j = h_offsets[r]; j < h_offsets[r + 1]; ++j) {
+          if ((h_vertices[j] == src[e]) && (h_distances[j] == (h_distances[i] - 1))) valid = 1;
+        }
+      }
+      TEST_ASSERT(test_ret_value, valid, "bfs_batched predecessors are not valid");
+    }
+  }
+
+  cugraph_type_erased_device_array_free(p_sources);
+  cugraph_type_erased_device_array_free(p_depth_limits);
+  cugraph_paths_result_free(p_result);
+  cugraph_sg_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int test_bfs_batched_early_exit()
+{
+  int test_ret_value = 0;
+
+  size_t num_edges    = 8;
+  size_t num_requests = 3;
+  size_t num_results  = 7;
+
+  // the third request's target is its source, it stops at depth 0
+  vertex_t src[]                = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t dst[]                = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t wgt[]                = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  vertex_t seeds[]              = {0, 0, 2};
+  vertex_t targets[]            = {1, -1, 2};
+  size_t vertex_budget          = 3;
+  int64_t expected_offsets[]    = {0, 2, 6, 7};
+  vertex_t expected_vertices[]  = {0, 1, 0, 1, 3, 4, 2};
+  vertex_t expected_distances[] = {0, 1, 0, 1, 2, 2, 0};
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error    = NULL;
+
+  cugraph_resource_handle_t* p_handle                     = NULL;
+  cugraph_graph_t* p_graph                                = NULL;
+  cugraph_paths_result_t* p_result                        = NULL;
+  cugraph_type_erased_device_array_t* p_sources           = NULL;
+  cugraph_type_erased_device_array_t* p_targets           = NULL;
+  cugraph_type_erased_device_array_view_t* p_source_view  = NULL;
+  cugraph_type_erased_device_array_view_t* p_targets_view = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  ret_code = create_test_graph(
+    p_handle, src, dst, wgt, num_edges, FALSE, FALSE, FALSE, &p_graph, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "create_test_graph failed.");
+
+  ret_code =
+    cugraph_type_erased_device_array_create(p_handle, num_requests, INT32, &p_sources, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "p_sources create failed.");
+
+  p_source_view = cugraph_type_erased_device_array_view(p_sources);
+
+  ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+    p_handle, p_source_view, (byte_t*)seeds, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "src copy_from_host failed.");
+
+  ret_code =
+    cugraph_type_erased_device_array_create(p_handle, num_requests, INT32, &p_targets, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "p_targets create failed.");
+
+  p_targets_view = cugraph_type_erased_device_array_view(p_targets);
+
+  ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+    p_handle, p_targets_view, (byte_t*)targets, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "targets copy_from_host failed.");
+
+  ret_code = cugraph_bfs_batched(p_handle,
+                                 p_graph,
+                                 p_source_view,
+                                 NULL,
+                                 10,
+                                 p_targets_view,
+                                 vertex_budget,
+                                 0,
+                                 FALSE,
+                                 FALSE,
+                                 &p_result,
+                                 &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_bfs_batched failed.");
+
+  cugraph_type_erased_device_array_view_t* offsets;
+  cugraph_type_erased_device_array_view_t* vertices;
+  cugraph_type_erased_device_array_view_t* distances;
+
+  offsets   = cugraph_paths_result_get_offsets(p_result);
+  vertices  = cugraph_paths_result_get_vertices(p_result);
+  distances = cugraph_paths_result_get_distances(p_result);
+
+  TEST_ASSERT(test_ret_value,
+              cugraph_type_erased_device_array_view_size(vertices) == num_results,
+              "number of reached vertices doesn't match");
+
+  int64_t h_offsets[num_requests + 1];
+  vertex_t h_vertices[num_results];
+  vertex_t h_distances[num_results];
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_offsets, offsets, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_vertices, vertices, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_distances, distances, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  for (int i = 0; (i < (num_requests + 1)) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(
+      test_ret_value, expected_offsets[i] == h_offsets[i], "bfs_batched offsets don't match");
+  }
+
+  for (int i = 0; (i < num_results) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(
+      test_ret_value, expected_vertices[i] == h_vertices[i], "bfs_batched vertices don't match");
+    TEST_ASSERT(test_ret_value,
+                expected_distances[i] == h_distances[i],
+                "bfs_batched distances don't match");
+  }
+
+  cugraph_type_erased_device_array_free(p_sources);
+  cugraph_type_erased_device_array_free(p_targets);
+  cugraph_paths_result_free(p_result);
+  cugraph_sg_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
 /******************************************************************************/
 
 int main(int argc, char** argv)
@@ -176,5 +571,10 @@ int main(int argc, char** argv)
   int result = 0;
   result |= RUN_TEST(test_bfs);
   result |= RUN_TEST(test_bfs_with_transpose);
+  result |= RUN_TEST(test_bfs_alternating_keep_one);
+  result |= RUN_TEST(test_bfs_alternating_keep_both);
+  result |= RUN_TEST(test_bfs_alternating_budgeted);
+  result |= RUN_TEST(test_bfs_batched);
+  result |= RUN_TEST(test_bfs_batched_early_exit);
   return result;
 }
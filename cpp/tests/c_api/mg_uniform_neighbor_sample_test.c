@@ -69,10 +69,6 @@ int generic_uniform_neighbor_sample_test(const cugraph_resource_handle_t* handle
   ret_code = cugraph_uniform_neighbor_sample(
     handle, graph, d_start_view, h_fan_out_view, with_replacement, FALSE, &result, &ret_error);
 
-#ifdef NO_CUGRAPH_OPS
-  TEST_ASSERT(
-    test_ret_value, ret_code != CUGRAPH_SUCCESS, "uniform_neighbor_sample should have failed");
-#else
   TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
   TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "uniform_neighbor_sample failed.");
 
@@ -123,7 +119,6 @@ int generic_uniform_neighbor_sample_test(const cugraph_resource_handle_t* handle
   }
 
   cugraph_sample_result_free(result);
-#endif
 
   cugraph_type_erased_host_array_view_free(h_fan_out_view);
   cugraph_mg_graph_free(graph);
@@ -233,6 +233,177 @@ int test_sssp_with_transpose_double()
     src, dst, wgt, 0, expected_distances, expected_predecessors, num_vertices, num_edges, 10, TRUE);
 }
 
+int generic_point_to_point_shortest_paths_test(bool_t bidirectional)
+{
+  int test_ret_value = 0;
+
+  size_t num_edges      = 8;
+  size_t num_pairs      = 3;
+  size_t num_heuristics = 2;
+  size_t num_results    = 6;
+
+  vertex_t src[]                = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t dst[]                = {1, 3, 4, 0, 1, 3, 5, 5};
+  float wgt[]                   = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  vertex_t sources[]            = {0, 0, 2};
+  vertex_t targets[]            = {5, 2, 3};
+  vertex_t heuristic_vertices[] = {4, 5};
+  float heuristic_values[]      = {3.2f, 0.0f};
+  int64_t expected_offsets[]    = {0, 4, 4, 6};
+  vertex_t expected_vertices[]  = {0, 1, 4, 5, 2, 3};
+  float expected_distances[]    = {0.0f, 0.1f, 1.2f, 4.4f, 0.0f, 4.1f};
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error    = NULL;
+
+  cugraph_resource_handle_t* p_handle                                = NULL;
+  cugraph_graph_t* p_graph                                           = NULL;
+  cugraph_paths_result_t* p_result                                   = NULL;
+  cugraph_type_erased_device_array_t* p_sources                      = NULL;
+  cugraph_type_erased_device_array_t* p_targets                      = NULL;
+  cugraph_type_erased_device_array_t* p_heuristic_vertices           = NULL;
+  cugraph_type_erased_device_array_t* p_heuristic_values             = NULL;
+  cugraph_type_erased_device_array_view_t* p_sources_view            = NULL;
+  cugraph_type_erased_device_array_view_t* p_targets_view            = NULL;
+  cugraph_type_erased_device_array_view_t* p_heuristic_vertices_view = NULL;
+  cugraph_type_erased_device_array_view_t* p_heuristic_values_view   = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  // A graph stored transposed and keeping both orientations has the incoming edges at hand once
+  // the point to point search transposes it, and the targets are searched backward
+  ret_code = create_test_graph(
+    p_handle, src, dst, wgt, num_edges, bidirectional, FALSE, FALSE, &p_graph, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "create_test_graph failed.");
+
+  if (bidirectional) {
+    ret_code = cugraph_graph_set_orientation_policy(
+      p_handle, p_graph, CUGRAPH_ORIENTATION_KEEP_BOTH, 0, &ret_error);
+    TEST_ASSERT(test_ret_value,
+                ret_code == CUGRAPH_SUCCESS,
+                "cugraph_graph_set_orientation_policy failed.");
+  }
+
+  ret_code =
+    cugraph_type_erased_device_array_create(p_handle, num_pairs, INT32, &p_sources, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "p_sources create failed.");
+
+  p_sources_view = cugraph_type_erased_device_array_view(p_sources);
+
+  ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+    p_handle, p_sources_view, (byte_t*)sources, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "sources copy_from_host failed.");
+
+  ret_code =
+    cugraph_type_erased_device_array_create(p_handle, num_pairs, INT32, &p_targets, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "p_targets create failed.");
+
+  p_targets_view = cugraph_type_erased_device_array_view(p_targets);
+
+  ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+    p_handle, p_targets_view, (byte_t*)targets, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "targets copy_from_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_create(
+    p_handle, num_heuristics, INT32, &p_heuristic_vertices, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "p_heuristic_vertices create failed.");
+
+  p_heuristic_vertices_view = cugraph_type_erased_device_array_view(p_heuristic_vertices);
+
+  ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+    p_handle, p_heuristic_vertices_view, (byte_t*)heuristic_vertices, &ret_error);
+  TEST_ASSERT(
+    test_ret_value, ret_code == CUGRAPH_SUCCESS, "heuristic vertices copy_from_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_create(
+    p_handle, num_heuristics, FLOAT32, &p_heuristic_values, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "p_heuristic_values create failed.");
+
+  p_heuristic_values_view = cugraph_type_erased_device_array_view(p_heuristic_values);
+
+  ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+    p_handle, p_heuristic_values_view, (byte_t*)heuristic_values, &ret_error);
+  TEST_ASSERT(
+    test_ret_value, ret_code == CUGRAPH_SUCCESS, "heuristic values copy_from_host failed.");
+
+  ret_code = cugraph_point_to_point_shortest_paths(p_handle,
+                                                   p_graph,
+                                                   p_sources_view,
+                                                   p_targets_view,
+                                                   p_heuristic_vertices_view,
+                                                   p_heuristic_values_view,
+                                                   10,
+                                                   FALSE,
+                                                   &p_result,
+                                                   &ret_error);
+  TEST_ASSERT(
+    test_ret_value, ret_code == CUGRAPH_SUCCESS, "cugraph_point_to_point_shortest_paths failed.");
+
+  cugraph_type_erased_device_array_view_t* offsets;
+  cugraph_type_erased_device_array_view_t* vertices;
+  cugraph_type_erased_device_array_view_t* distances;
+
+  offsets   = cugraph_paths_result_get_offsets(p_result);
+  vertices  = cugraph_paths_result_get_vertices(p_result);
+  distances = cugraph_paths_result_get_distances(p_result);
+
+  TEST_ASSERT(test_ret_value,
+              cugraph_type_erased_device_array_view_size(vertices) == num_results,
+              "number of path vertices doesn't match");
+
+  int64_t h_offsets[num_pairs + 1];
+  vertex_t h_vertices[num_results];
+  float h_distances[num_results];
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_offsets, offsets, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_vertices, vertices, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_distances, distances, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  for (int i = 0; (i < (num_pairs + 1)) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value, expected_offsets[i] == h_offsets[i], "path offsets don't match");
+  }
+
+  for (int i = 0; (i < num_results) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value, expected_vertices[i] == h_vertices[i], "paths don't match");
+    TEST_ASSERT(test_ret_value,
+                nearlyEqual(expected_distances[i], h_distances[i], EPSILON),
+                "path distances don't match");
+  }
+
+  cugraph_type_erased_device_array_view_free(offsets);
+  cugraph_type_erased_device_array_view_free(vertices);
+  cugraph_type_erased_device_array_view_free(distances);
+  cugraph_type_erased_device_array_free(p_sources);
+  cugraph_type_erased_device_array_free(p_targets);
+  cugraph_type_erased_device_array_free(p_heuristic_vertices);
+  cugraph_type_erased_device_array_free(p_heuristic_values);
+  cugraph_paths_result_free(p_result);
+  cugraph_sg_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int test_point_to_point_shortest_paths()
+{
+  return generic_point_to_point_shortest_paths_test(FALSE);
+}
+
+int test_point_to_point_shortest_paths_bidirectional()
+{
+  return generic_point_to_point_shortest_paths_test(TRUE);
+}
+
 /******************************************************************************/
 
 int main(int argc, char** argv)
@@ -241,5 +412,7 @@ int main(int argc, char** argv)
   result |= RUN_TEST(test_sssp);
   result |= RUN_TEST(test_sssp_with_transpose);
   result |= RUN_TEST(test_sssp_with_transpose_double);
+  result |= RUN_TEST(test_point_to_point_shortest_paths);
+  result |= RUN_TEST(test_point_to_point_shortest_paths_bidirectional);
   return result;
 }
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/high_res_clock.h>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <tuple>
+#include <vector>
+
+// exact reference: a BFS from every vertex
+template <typename vertex_t, typename edge_t, typename result_t>
+std::tuple<std::vector<result_t>, std::vector<result_t>, std::vector<result_t>>
+hyperball_reference(edge_t const* offsets, vertex_t const* indices, vertex_t num_vertices)
+{
+  std::vector<result_t> harmonic_centralities(num_vertices, result_t{0.0});
+  std::vector<result_t> closeness_centralities(num_vertices, result_t{0.0});
+  std::vector<result_t> neighborhood_function{};
+
+  std::vector<vertex_t> distances(num_vertices);
+  for (vertex_t s = 0; s < num_vertices; ++s) {
+    std::fill(distances.begin(), distances.end(), std::numeric_limits<vertex_t>::max());
+    distances[s] = 0;
+    std::queue<vertex_t> queue{};
+    queue.push(s);
+    size_t num_reached{0};
+    double distance_sum{0.0};
+    while (!queue.empty()) {
+      auto v = queue.front();
+      queue.pop();
+      if (static_cast<size_t>(distances[v]) >= neighborhood_function.size()) {
+        neighborhood_function.resize(distances[v] + 1, result_t{0.0});
+      }
+      neighborhood_function[distances[v]] += result_t{1.0};
+      if (v != s) {
+        ++num_reached;
+        distance_sum += distances[v];
+        harmonic_centralities[s] += result_t{1.0} / static_cast<result_t>(distances[v]);
+      }
+      for (edge_t i = offsets[v]; i < offsets[v + 1]; ++i) {
+        if (distances[indices[i]] == std::numeric_limits<vertex_t>::max()) {
+          distances[indices[i]] = distances[v] + 1;
+          queue.push(indices[i]);
+        }
+      }
+    }
+    closeness_centralities[s] =
+      distance_sum > 0.0 ? static_cast<result_t>(num_reached / distance_sum) : result_t{0.0};
+  }
+  for (size_t t = 1; t < neighborhood_function.size(); ++t) {  // cumulative counts
+    neighborhood_function[t] += neighborhood_function[t - 1];
+  }
+
+  return std::make_tuple(
+    std::move(harmonic_centralities), std::move(closeness_centralities), neighborhood_function);
+}
+
+struct HyperBall_Usecase {
+  size_t num_registers{4096};
+  double relative_tolerance{0.1};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_HyperBall
+  : public ::testing::TestWithParam<std::tuple<HyperBall_Usecase, input_usecase_t>> {
+ public:
+  Tests_HyperBall() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(std::tuple<HyperBall_Usecase const&, input_usecase_t const&> const& param)
+  {
+    constexpr bool renumber = true;
+
+    using weight_t = float;
+    using result_t = float;
+
+    auto [hyperball_usecase, input_usecase] = param;
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, renumber);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "construct_graph took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    auto graph_view = graph.view();
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto [d_harmonic_centralities,
+          d_closeness_centralities,
+          neighborhood_function,
+          effective_diameter] =
+      cugraph::hyperball<vertex_t, edge_t, weight_t, result_t, false>(
+        handle, graph_view, hyperball_usecase.num_registers);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "HyperBall took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (hyperball_usecase.check_correctness) {
+      // the results are in the (renumbered) vertex order of graph_view
+      std::vector<edge_t> h_offsets(graph_view.number_of_vertices() + 1);
+      std::vector<vertex_t> h_indices(graph_view.number_of_edges());
+      raft::update_host(h_offsets.data(),
+                        graph_view.local_edge_partition_view().offsets(),
+                        graph_view.number_of_vertices() + 1,
+                        handle.get_stream());
+      raft::update_host(h_indices.data(),
+                        graph_view.local_edge_partition_view().indices(),
+                        graph_view.number_of_edges(),
+                        handle.get_stream());
+
+      std::vector<result_t> h_harmonic_centralities(d_harmonic_centralities.size());
+      std::vector<result_t> h_closeness_centralities(d_closeness_centralities.size());
+      raft::update_host(h_harmonic_centralities.data(),
+                        d_harmonic_centralities.data(),
+                        d_harmonic_centralities.size(),
+                        handle.get_stream());
+      raft::update_host(h_closeness_centralities.data(),
+                        d_closeness_centralities.data(),
+                        d_closeness_centralities.size(),
+                        handle.get_stream());
+
+      handle.sync_stream();
+
+      auto [h_reference_harmonic_centralities,
+            h_reference_closeness_centralities,
+            h_reference_neighborhood_function] =
+        hyperball_reference<vertex_t, edge_t, result_t>(
+          h_offsets.data(), h_indices.data(), graph_view.number_of_vertices());
+
+      auto nearly_equal = [tolerance = hyperball_usecase.relative_tolerance](auto lhs, auto rhs) {
+        return std::abs(lhs - rhs) <= tolerance * std::max(std::abs(lhs), std::abs(rhs));
+      };
+
+      for (vertex_t i = 0; i < graph_view.number_of_vertices(); ++i) {
+        ASSERT_TRUE(nearly_equal(h_harmonic_centralities[i], h_reference_harmonic_centralities[i]))
+          << "harmonic centrality of vertex " << i << " (" << h_harmonic_centralities[i]
+          << ") is not within the tolerance of the reference value ("
+          << h_reference_harmonic_centralities[i] << ").";
+        ASSERT_TRUE(
+          nearly_equal(h_closeness_centralities[i], h_reference_closeness_centralities[i]))
+          << "closeness centrality of vertex " << i << " (" << h_closeness_centralities[i]
+          << ") is not within the tolerance of the reference value ("
+          << h_reference_closeness_centralities[i] << ").";
+      }
+
+      ASSERT_TRUE(neighborhood_function.size() > 0);
+      ASSERT_TRUE(nearly_equal(neighborhood_function.back(),
+                               h_reference_neighborhood_function.back()))
+        << "the number of reachable pairs (" << neighborhood_function.back()
+        << ") is not within the tolerance of the reference value ("
+        << h_reference_neighborhood_function.back() << ").";
+      ASSERT_TRUE(effective_diameter >= result_t{0.0});
+      ASSERT_TRUE(effective_diameter <=
+                  static_cast<result_t>(h_reference_neighborhood_function.size()));
+    }
+  }
+};
+
+using Tests_HyperBall_File = Tests_HyperBall<cugraph::test::File_Usecase>;
+using Tests_HyperBall_Rmat = Tests_HyperBall<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_HyperBall_File, CheckInt32Int32)
+{
+  run_current_test<int32_t, int32_t>(override_File_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+TEST_P(Tests_HyperBall_Rmat, CheckInt32Int32)
+{
+  run_current_test<int32_t, int32_t>(override_Rmat_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+TEST_P(Tests_HyperBall_Rmat, CheckInt64Int64)
+{
+  run_current_test<int64_t, int64_t>(override_Rmat_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_HyperBall_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(HyperBall_Usecase{}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_HyperBall_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(HyperBall_Usecase{}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_HyperBall_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(HyperBall_Usecase{64, 0.1, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
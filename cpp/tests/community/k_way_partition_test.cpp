@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/high_res_clock.h>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <vector>
+
+struct KWayPartition_Usecase {
+  size_t num_partitions{2};
+  double imbalance{0.03};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_KWayPartition
+  : public ::testing::TestWithParam<std::tuple<KWayPartition_Usecase, input_usecase_t>> {
+ public:
+  Tests_KWayPartition() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(KWayPartition_Usecase const& k_way_partition_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, true, renumber);
+    auto graph_view = graph.view();
+
+    auto num_vertices = graph_view.number_of_vertices();
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto d_parts = cugraph::k_way_partition(handle,
+                                            graph_view,
+                                            k_way_partition_usecase.num_partitions,
+                                            k_way_partition_usecase.imbalance);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "k_way_partition took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (k_way_partition_usecase.check_correctness) {
+      ASSERT_EQ(d_parts.size(), static_cast<size_t>(num_vertices));
+
+      auto num_parts = static_cast<vertex_t>(k_way_partition_usecase.num_partitions);
+
+      auto h_parts   = cugraph::test::to_host(handle, d_parts.data(), d_parts.size());
+      auto h_offsets = cugraph::test::to_host(
+        handle, graph_view.local_edge_partition_view().offsets(), num_vertices + 1);
+      auto h_indices = cugraph::test::to_host(handle,
+                                              graph_view.local_edge_partition_view().indices(),
+                                              graph_view.number_of_edges());
+      auto h_weights = cugraph::test::to_host(handle,
+                                              *(graph_view.local_edge_partition_view().weights()),
+                                              graph_view.number_of_edges());
+
+      std::vector<vertex_t> part_sizes(num_parts, vertex_t{0});
+      for (vertex_t v = 0; v < num_vertices; ++v) {
+        ASSERT_TRUE((h_parts[v] >= 0) && (h_parts[v] < num_parts))
+          << "vertex " << v << " has an invalid part ID (" << h_parts[v] << ").";
+        ++part_sizes[h_parts[v]];
+      }
+
+      // every part has at most (1.0 + imbalance) * average vertices (rounded down, but no fewer
+      // than the average rounded up, as a smaller bound may be infeasible)
+
+      auto average_part_size = static_cast<double>(num_vertices) / static_cast<double>(num_parts);
+      auto max_allowed_part_size = static_cast<vertex_t>(
+        std::max(std::floor((1.0 + k_way_partition_usecase.imbalance) * average_part_size),
+                 std::ceil(average_part_size)));
+      auto max_part_size = *std::max_element(part_sizes.begin(), part_sizes.end());
+      ASSERT_TRUE(max_part_size <= max_allowed_part_size)
+        << "the partition is imbalanced (the largest part has " << max_part_size
+        << " vertices, at most " << max_allowed_part_size << " vertices are allowed).";
+
+      // the edge cut should be (much) smaller than the edge cut of a round-robin partition
+
+      weight_t edge_cut{0.0};
+      weight_t round_robin_edge_cut{0.0};
+      for (vertex_t v = 0; v < num_vertices; ++v) {
+        for (auto i = h_offsets[v]; i < h_offsets[v + 1]; ++i) {
+          auto nbr = h_indices[i];
+          if (h_parts[v] != h_parts[nbr]) { edge_cut += h_weights[i]; }
+          if ((v % num_parts) != (nbr % num_parts)) { round_robin_edge_cut += h_weights[i]; }
+        }
+      }
+      ASSERT_TRUE(edge_cut < round_robin_edge_cut)
+        << "the edge cut (" << edge_cut << ") is not smaller than the round-robin edge cut ("
+        << round_robin_edge_cut << ").";
+    }
+  }
+};
+
+using Tests_KWayPartition_File = Tests_KWayPartition<cugraph::test::File_Usecase>;
+using Tests_KWayPartition_Rmat = Tests_KWayPartition<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_KWayPartition_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_KWayPartition_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_KWayPartition_Rmat, CheckInt32Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_KWayPartition_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_KWayPartition_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(KWayPartition_Usecase{2}, KWayPartition_Usecase{4}),
+    // larger than the coarsest graph size (256 vertices), so the graphs are coarsened
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_KWayPartition_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(KWayPartition_Usecase{2}, KWayPartition_Usecase{8}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(12, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_KWayPartition_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(KWayPartition_Usecase{64, 0.03, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/high_res_clock.h>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <raft/span.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+struct LabelPropagation_Usecase {
+  size_t seed_stride{0};  // every seed_stride'th vertex is a seed (no seeds if 0)
+  size_t max_iterations{100};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_LabelPropagation
+  : public ::testing::TestWithParam<std::tuple<LabelPropagation_Usecase, input_usecase_t>> {
+ public:
+  Tests_LabelPropagation() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(LabelPropagation_Usecase const& label_propagation_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, renumber);
+    auto graph_view = graph.view();
+
+    auto num_vertices = graph_view.number_of_vertices();
+
+    std::optional<rmm::device_uvector<vertex_t>> d_seed_vertices{std::nullopt};
+    std::optional<rmm::device_uvector<vertex_t>> d_seed_labels{std::nullopt};
+    std::vector<vertex_t> h_seed_vertices{};
+    std::vector<vertex_t> h_seed_labels{};
+    if (label_propagation_usecase.seed_stride > 0) {
+      for (vertex_t v = 0; v < num_vertices;
+           v += static_cast<vertex_t>(label_propagation_usecase.seed_stride)) {
+        h_seed_vertices.push_back(v);
+        h_seed_labels.push_back(v % vertex_t{3});  // three classes
+      }
+      d_seed_vertices = rmm::device_uvector<vertex_t>(h_seed_vertices.size(), handle.get_stream());
+      d_seed_labels   = rmm::device_uvector<vertex_t>(h_seed_labels.size(), handle.get_stream());
+      raft::update_device((*d_seed_vertices).data(),
+                          h_seed_vertices.data(),
+                          h_seed_vertices.size(),
+                          handle.get_stream());
+      raft::update_device(
+        (*d_seed_labels).data(), h_seed_labels.data(), h_seed_labels.size(), handle.get_stream());
+    }
+    auto seed_vertex_span =
+      d_seed_vertices ? std::make_optional<raft::device_span<vertex_t const>>(
+                          (*d_seed_vertices).data(), (*d_seed_vertices).size())
+                      : std::nullopt;
+    auto seed_label_span = d_seed_labels
+                             ? std::make_optional<raft::device_span<vertex_t const>>(
+                                 (*d_seed_labels).data(), (*d_seed_labels).size())
+                             : std::nullopt;
+
+    rmm::device_uvector<vertex_t> d_labels(num_vertices, handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto num_iterations =
+      cugraph::label_propagation(handle,
+                                 graph_view,
+                                 raft::device_span<vertex_t>(d_labels.data(), d_labels.size()),
+                                 seed_vertex_span,
+                                 seed_label_span,
+                                 label_propagation_usecase.max_iterations);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "label_propagation took " << elapsed_time * 1e-6 << " s (" << num_iterations
+                << " iterations).\n";
+    }
+
+    if (label_propagation_usecase.check_correctness) {
+      rmm::device_uvector<vertex_t> d_host_labels(num_vertices, handle.get_stream());
+      auto host_num_iterations = cugraph::host_label_propagation(
+        handle,
+        graph_view,
+        raft::device_span<vertex_t>(d_host_labels.data(), d_host_labels.size()),
+        seed_vertex_span,
+        seed_label_span,
+        label_propagation_usecase.max_iterations);
+
+      auto h_labels = cugraph::test::to_host(handle, d_labels.data(), d_labels.size());
+      auto h_host_labels =
+        cugraph::test::to_host(handle, d_host_labels.data(), d_host_labels.size());
+      auto h_offsets = cugraph::test::to_host(
+        handle, graph_view.local_edge_partition_view().offsets(), num_vertices + 1);
+      auto h_indices = cugraph::test::to_host(handle,
+                                              graph_view.local_edge_partition_view().indices(),
+                                              graph_view.number_of_edges());
+
+      // the host implementation shares the update schedule and the tie-breaking rules (and the
+      // graph is unweighted, so there is no floating point summation order difference)
+
+      ASSERT_EQ(num_iterations, host_num_iterations)
+        << "the device and host implementations took different numbers of iterations.";
+      ASSERT_TRUE(std::equal(h_labels.begin(), h_labels.end(), h_host_labels.begin()))
+        << "the device and host implementations returned different labels.";
+
+      // the host CSR entry point runs the same iteration
+
+      std::vector<vertex_t> h_csr_labels(num_vertices);
+      auto csr_num_iterations = cugraph::host_label_propagation<vertex_t, edge_t, weight_t>(
+        raft::host_span<edge_t const>(h_offsets.data(), h_offsets.size()),
+        raft::host_span<vertex_t const>(h_indices.data(), h_indices.size()),
+        std::nullopt,
+        raft::host_span<vertex_t>(h_csr_labels.data(), h_csr_labels.size()),
+        d_seed_vertices ? std::make_optional<raft::host_span<vertex_t const>>(
+                            h_seed_vertices.data(), h_seed_vertices.size())
+                        : std::nullopt,
+        d_seed_labels ? std::make_optional<raft::host_span<vertex_t const>>(h_seed_labels.data(),
+                                                                            h_seed_labels.size())
+                      : std::nullopt,
+        label_propagation_usecase.max_iterations,
+        size_t{0},
+        true);
+
+      ASSERT_EQ(csr_num_iterations, host_num_iterations)
+        << "the host CSR and graph view entry points took different numbers of iterations.";
+      ASSERT_TRUE(std::equal(h_csr_labels.begin(), h_csr_labels.end(), h_host_labels.begin()))
+        << "the host CSR and graph view entry points returned different labels.";
+
+      std::vector<bool> is_seed(num_vertices, false);
+      for (size_t i = 0; i < h_seed_vertices.size(); ++i) {
+        is_seed[h_seed_vertices[i]] = true;
+        ASSERT_EQ(h_labels[h_seed_vertices[i]], h_seed_labels[i])
+          << "seed vertex " << h_seed_vertices[i] << " changed its label.";
+      }
+
+      for (vertex_t v = 0; v < num_vertices; ++v) {
+        if (h_seed_vertices.size() > 0) {
+          ASSERT_TRUE((h_labels[v] == cugraph::invalid_vertex_id<vertex_t>::value) ||
+                      std::find(h_seed_labels.begin(), h_seed_labels.end(), h_labels[v]) !=
+                        h_seed_labels.end())
+            << "vertex " << v << " has a label (" << h_labels[v] << ") that is not a seed label.";
+        } else {
+          ASSERT_TRUE((h_labels[v] >= 0) && (h_labels[v] < num_vertices))
+            << "vertex " << v << " has an invalid label (" << h_labels[v] << ").";
+        }
+      }
+
+      // on convergence, every (non-seed, non-isolated) vertex holds one of the most frequent
+      // labels among its neighbors
+
+      if (num_iterations < label_propagation_usecase.max_iterations) {
+        for (vertex_t v = 0; v < num_vertices; ++v) {
+          if (is_seed[v] || (h_offsets[v + 1] == h_offsets[v])) { continue; }
+          std::map<vertex_t, edge_t> label_counts{};
+          for (auto i = h_offsets[v]; i < h_offsets[v + 1]; ++i) {
+            auto label = h_labels[h_indices[i]];
+            if (label != cugraph::invalid_vertex_id<vertex_t>::value) { ++label_counts[label]; }
+          }
+          if (label_counts.size() == 0) { continue; }
+          auto max_count = std::max_element(label_counts.begin(),
+                                            label_counts.end(),
+                                            [](auto lhs, auto rhs) {
+                                              return lhs.second < rhs.second;
+                                            })
+                             ->second;
+          auto it = label_counts.find(h_labels[v]);
+          ASSERT_TRUE((it != label_counts.end()) && ((*it).second == max_count))
+            << "vertex " << v << " does not hold one of the most frequent neighbor labels.";
+        }
+      }
+    }
+  }
+};
+
+using Tests_LabelPropagation_File = Tests_LabelPropagation<cugraph::test::File_Usecase>;
+using Tests_LabelPropagation_Rmat = Tests_LabelPropagation<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_LabelPropagation_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_LabelPropagation_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_LabelPropagation_Rmat, CheckInt32Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_LabelPropagation_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_LabelPropagation_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(LabelPropagation_Usecase{}, LabelPropagation_Usecase{10}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_LabelPropagation_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(LabelPropagation_Usecase{}, LabelPropagation_Usecase{10}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_LabelPropagation_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(LabelPropagation_Usecase{0, 100, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/device_comm_wrapper.hpp>
+#include <utilities/high_res_clock.h>
+#include <utilities/mg_utilities.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+struct KWayPartition_Usecase {
+  size_t num_partitions{2};
+  double imbalance{0.03};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGKWayPartition
+  : public ::testing::TestWithParam<std::tuple<KWayPartition_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGKWayPartition() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Check the balance and the edge cut of the partition computed on multiple GPUs (the refinement
+  // splits the part capacities among the GPUs, so the partition differs from a single-GPU run)
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(KWayPartition_Usecase const& k_way_partition_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    HighResClock hr_clock{};
+
+    // 1. create MG graph
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        *handle_, input_usecase, true, true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG construct_graph took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    auto mg_graph_view = mg_graph.view();
+
+    // 2. run MG k_way_partition
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto d_mg_parts = cugraph::k_way_partition(*handle_,
+                                               mg_graph_view,
+                                               k_way_partition_usecase.num_partitions,
+                                               k_way_partition_usecase.imbalance);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG k_way_partition took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    // 3. check the partition
+
+    if (k_way_partition_usecase.check_correctness) {
+      ASSERT_EQ(d_mg_parts.size(),
+                static_cast<size_t>(mg_graph_view.local_vertex_partition_range_size()));
+
+      // 3-1. aggregate MG results and the MG graph's edges (in internal vertex IDs, the local
+      // vertex partition ranges are ordered by rank, so the aggregated part IDs are in vertex ID
+      // order)
+
+      auto [d_mg_srcs, d_mg_dsts, d_mg_weights] =
+        mg_graph_view.decompress_to_edgelist(*handle_, std::nullopt);
+
+      auto d_mg_aggregate_srcs =
+        cugraph::test::device_gatherv(*handle_, d_mg_srcs.data(), d_mg_srcs.size());
+      auto d_mg_aggregate_dsts =
+        cugraph::test::device_gatherv(*handle_, d_mg_dsts.data(), d_mg_dsts.size());
+      auto d_mg_aggregate_weights =
+        cugraph::test::device_gatherv(*handle_, (*d_mg_weights).data(), (*d_mg_weights).size());
+      auto d_mg_aggregate_parts =
+        cugraph::test::device_gatherv(*handle_, d_mg_parts.data(), d_mg_parts.size());
+
+      if (handle_->get_comms().get_rank() == int{0}) {
+        auto num_vertices = mg_graph_view.number_of_vertices();
+        auto num_parts    = static_cast<vertex_t>(k_way_partition_usecase.num_partitions);
+
+        auto h_srcs    = cugraph::test::to_host(
+          *handle_, d_mg_aggregate_srcs.data(), d_mg_aggregate_srcs.size());
+        auto h_dsts    = cugraph::test::to_host(
+          *handle_, d_mg_aggregate_dsts.data(), d_mg_aggregate_dsts.size());
+        auto h_weights = cugraph::test::to_host(
+          *handle_, d_mg_aggregate_weights.data(), d_mg_aggregate_weights.size());
+        auto h_parts   = cugraph::test::to_host(
+          *handle_, d_mg_aggregate_parts.data(), d_mg_aggregate_parts.size());
+
+        ASSERT_EQ(h_parts.size(), static_cast<size_t>(num_vertices));
+
+        std::vector<vertex_t> part_sizes(num_parts, vertex_t{0});
+        for (vertex_t v = 0; v < num_vertices; ++v) {
+          ASSERT_TRUE((h_parts[v] >= 0) && (h_parts[v] < num_parts))
+            << "vertex " << v << " has an invalid part ID (" << h_parts[v] << ").";
+          ++part_sizes[h_parts[v]];
+        }
+
+        // 3-2. every part has at most (1.0 + imbalance) * average vertices (rounded down, but no
+        // fewer than the average rounded up, as a smaller bound may be infeasible)
+
+        auto average_part_size = static_cast<double>(num_vertices) / static_cast<double>(num_parts);
+        auto max_allowed_part_size = static_cast<vertex_t>(
+          std::max(std::floor((1.0 + k_way_partition_usecase.imbalance) * average_part_size),
+                   std::ceil(average_part_size)));
+        auto max_part_size = *std::max_element(part_sizes.begin(), part_sizes.end());
+        ASSERT_TRUE(max_part_size <= max_allowed_part_size)
+          << "the partition is imbalanced (the largest part has " << max_part_size
+          << " vertices, at most " << max_allowed_part_size << " vertices are allowed).";
+
+        // 3-3. the edge cut should be (much) smaller than the edge cut of a round-robin partition
+
+        weight_t edge_cut{0.0};
+        weight_t round_robin_edge_cut{0.0};
+        for (size_t i = 0; i < h_srcs.size(); ++i) {
+          if (h_parts[h_srcs[i]] != h_parts[h_dsts[i]]) { edge_cut += h_weights[i]; }
+          if ((h_srcs[i] % num_parts) != (h_dsts[i] % num_parts)) {
+            round_robin_edge_cut += h_weights[i];
+          }
+        }
+        ASSERT_TRUE(edge_cut < round_robin_edge_cut)
+          << "the edge cut (" << edge_cut << ") is not smaller than the round-robin edge cut ("
+          << round_robin_edge_cut << ").";
+      }
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGKWayPartition<input_usecase_t>::handle_ = nullptr;
+
+using Tests_MGKWayPartition_File = Tests_MGKWayPartition<cugraph::test::File_Usecase>;
+using Tests_MGKWayPartition_Rmat = Tests_MGKWayPartition<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGKWayPartition_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGKWayPartition_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGKWayPartition_Rmat, CheckInt32Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGKWayPartition_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_tests,
+  Tests_MGKWayPartition_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(KWayPartition_Usecase{2}, KWayPartition_Usecase{4}),
+    // larger than the coarsest graph size (256 vertices), so the graphs are coarsened
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/netscience.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_tests,
+  Tests_MGKWayPartition_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(KWayPartition_Usecase{2}, KWayPartition_Usecase{8}),
+    ::testing::Values(
+      cugraph::test::Rmat_Usecase(12, 16, 0.57, 0.19, 0.19, 0, true, false, 0, true))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGKWayPartition_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(KWayPartition_Usecase{64, 0.03, false}),
+    ::testing::Values(
+      cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false, 0, true))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/device_comm_wrapper.hpp>
+#include <utilities/high_res_clock.h>
+#include <utilities/mg_utilities.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/sequence.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+struct LabelPropagation_Usecase {
+  size_t seed_stride{0};  // every seed_stride'th vertex is a seed (no seeds if 0)
+  size_t max_iterations{100};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGLabelPropagation
+  : public ::testing::TestWithParam<std::tuple<LabelPropagation_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGLabelPropagation() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Compare the results of running label_propagation on multiple GPUs to that of a single-GPU run
+  // on the same (renumbered) graph, the labels are deterministic and do not depend on the number of
+  // GPUs
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(LabelPropagation_Usecase const& label_propagation_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    HighResClock hr_clock{};
+
+    // 1. create MG graph
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        *handle_, input_usecase, false, true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG construct_graph took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    auto mg_graph_view = mg_graph.view();
+
+    // 2. seeds: every seed_stride'th (internal) vertex in the local vertex partition range
+
+    std::vector<vertex_t> h_mg_seed_vertices{};
+    std::vector<vertex_t> h_mg_seed_labels{};
+    if (label_propagation_usecase.seed_stride > 0) {
+      for (auto v = mg_graph_view.local_vertex_partition_range_first();
+           v < mg_graph_view.local_vertex_partition_range_last();
+           ++v) {
+        if (v % static_cast<vertex_t>(label_propagation_usecase.seed_stride) == 0) {
+          h_mg_seed_vertices.push_back(v);
+          h_mg_seed_labels.push_back(v % vertex_t{3});  // three classes
+        }
+      }
+    }
+    rmm::device_uvector<vertex_t> d_mg_seed_vertices(h_mg_seed_vertices.size(),
+                                                     handle_->get_stream());
+    rmm::device_uvector<vertex_t> d_mg_seed_labels(h_mg_seed_labels.size(), handle_->get_stream());
+    raft::update_device(d_mg_seed_vertices.data(),
+                        h_mg_seed_vertices.data(),
+                        h_mg_seed_vertices.size(),
+                        handle_->get_stream());
+    raft::update_device(d_mg_seed_labels.data(),
+                        h_mg_seed_labels.data(),
+                        h_mg_seed_labels.size(),
+                        handle_->get_stream());
+
+    // 3. run MG label_propagation
+
+    rmm::device_uvector<vertex_t> d_mg_labels(mg_graph_view.local_vertex_partition_range_size(),
+                                              handle_->get_stream());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto mg_num_iterations = cugraph::label_propagation(
+      *handle_,
+      mg_graph_view,
+      raft::device_span<vertex_t>(d_mg_labels.data(), d_mg_labels.size()),
+      label_propagation_usecase.seed_stride > 0
+        ? std::make_optional<raft::device_span<vertex_t const>>(d_mg_seed_vertices.data(),
+                                                                d_mg_seed_vertices.size())
+        : std::nullopt,
+      label_propagation_usecase.seed_stride > 0
+        ? std::make_optional<raft::device_span<vertex_t const>>(d_mg_seed_labels.data(),
+                                                                d_mg_seed_labels.size())
+        : std::nullopt,
+      label_propagation_usecase.max_iterations);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG label_propagation took " << elapsed_time * 1e-6 << " s ("
+                << mg_num_iterations << " iterations).\n";
+    }
+
+    // 4. compare SG & MG results
+
+    if (label_propagation_usecase.check_correctness) {
+      // 4-1. aggregate MG results and the MG graph's edges (in internal vertex IDs, the local
+      // vertex partition ranges are ordered by rank, so the aggregated labels are in vertex ID
+      // order)
+
+      auto [d_mg_srcs, d_mg_dsts, d_mg_weights] =
+        mg_graph_view.decompress_to_edgelist(*handle_, std::nullopt);
+
+      auto d_mg_aggregate_srcs =
+        cugraph::test::device_gatherv(*handle_, d_mg_srcs.data(), d_mg_srcs.size());
+      auto d_mg_aggregate_dsts =
+        cugraph::test::device_gatherv(*handle_, d_mg_dsts.data(), d_mg_dsts.size());
+      auto d_mg_aggregate_labels =
+        cugraph::test::device_gatherv(*handle_, d_mg_labels.data(), d_mg_labels.size());
+      auto d_mg_aggregate_seed_vertices = cugraph::test::device_gatherv(
+        *handle_, d_mg_seed_vertices.data(), d_mg_seed_vertices.size());
+      auto d_mg_aggregate_seed_labels =
+        cugraph::test::device_gatherv(*handle_, d_mg_seed_labels.data(), d_mg_seed_labels.size());
+
+      if (handle_->get_comms().get_rank() == int{0}) {
+        // 4-2. create SG graph with the MG graph's vertex IDs
+
+        rmm::device_uvector<vertex_t> d_sg_vertices(mg_graph_view.number_of_vertices(),
+                                                    handle_->get_stream());
+        thrust::sequence(handle_->get_thrust_policy(),
+                         d_sg_vertices.begin(),
+                         d_sg_vertices.end(),
+                         vertex_t{0});
+
+        cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> sg_graph(*handle_);
+        std::tie(sg_graph, std::ignore) =
+          cugraph::create_graph_from_edgelist<vertex_t, edge_t, weight_t, false, false>(
+            *handle_,
+            std::make_optional(std::move(d_sg_vertices)),
+            std::move(d_mg_aggregate_srcs),
+            std::move(d_mg_aggregate_dsts),
+            std::nullopt,
+            cugraph::graph_properties_t{true, mg_graph_view.is_multigraph()},
+            false);
+
+        auto sg_graph_view = sg_graph.view();
+
+        ASSERT_EQ(mg_graph_view.number_of_vertices(), sg_graph_view.number_of_vertices());
+
+        // 4-3. run SG label_propagation
+
+        rmm::device_uvector<vertex_t> d_sg_labels(sg_graph_view.number_of_vertices(),
+                                                  handle_->get_stream());
+
+        auto sg_num_iterations = cugraph::label_propagation(
+          *handle_,
+          sg_graph_view,
+          raft::device_span<vertex_t>(d_sg_labels.data(), d_sg_labels.size()),
+          label_propagation_usecase.seed_stride > 0
+            ? std::make_optional<raft::device_span<vertex_t const>>(
+                d_mg_aggregate_seed_vertices.data(), d_mg_aggregate_seed_vertices.size())
+            : std::nullopt,
+          label_propagation_usecase.seed_stride > 0
+            ? std::make_optional<raft::device_span<vertex_t const>>(
+                d_mg_aggregate_seed_labels.data(), d_mg_aggregate_seed_labels.size())
+            : std::nullopt,
+          label_propagation_usecase.max_iterations);
+
+        // 4-4. compare
+
+        auto h_mg_aggregate_labels = cugraph::test::to_host(
+          *handle_, d_mg_aggregate_labels.data(), d_mg_aggregate_labels.size());
+        auto h_sg_labels = cugraph::test::to_host(*handle_, d_sg_labels.data(), d_sg_labels.size());
+
+        ASSERT_EQ(mg_num_iterations, sg_num_iterations)
+          << "MG and SG label_propagation took different numbers of iterations.";
+        ASSERT_TRUE(std::equal(
+          h_mg_aggregate_labels.begin(), h_mg_aggregate_labels.end(), h_sg_labels.begin()))
+          << "MG and SG label_propagation returned different labels.";
+      }
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGLabelPropagation<input_usecase_t>::handle_ = nullptr;
+
+using Tests_MGLabelPropagation_File = Tests_MGLabelPropagation<cugraph::test::File_Usecase>;
+using Tests_MGLabelPropagation_Rmat = Tests_MGLabelPropagation<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGLabelPropagation_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGLabelPropagation_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGLabelPropagation_Rmat, CheckInt32Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGLabelPropagation_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_tests,
+  Tests_MGLabelPropagation_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(LabelPropagation_Usecase{}, LabelPropagation_Usecase{10}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_tests,
+  Tests_MGLabelPropagation_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(LabelPropagation_Usecase{}, LabelPropagation_Usecase{10}),
+    ::testing::Values(
+      cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false, 0, true))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGLabelPropagation_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(LabelPropagation_Usecase{0, 100, false}),
+    ::testing::Values(
+      cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false, 0, true))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/high_res_clock.h>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <raft/span.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// brute-force reference: classify every vertex triple using the 64 possible arc combinations
+template <typename vertex_t, typename edge_t>
+std::array<uint64_t, 16> triad_census_reference(edge_t const* offsets,
+                                                vertex_t const* indices,
+                                                vertex_t num_vertices)
+{
+  // arc combination (bit 0: v->u, bit 1: u->v, bit 2: v->w, bit 3: w->v, bit 4: u->w, bit 5: w->u)
+  // to triad type index (003, 012, 102, 021D, 021U, 021C, 111D, 111U, 030T, 030C, 201, 120D, 120U,
+  // 120C, 210, 300)
+  constexpr std::array<int, 64> tricode_to_type{
+    0, 1,  1,  2,  1, 3,  5,  7,  1, 5,  4,  6,  2,  7,  6,  10, 1,  5,  3,  7,  4, 8,
+    8, 12, 5,  9,  8, 13, 6,  13, 11, 14, 1, 4,  5,  6,  5,  8,  9,  13, 3,  8,  8, 11,
+    7, 12, 13, 14, 2, 6,  7,  10, 6,  11, 13, 14, 7,  13, 12, 14, 10, 14, 14, 15};
+
+  std::vector<bool> adjacency(static_cast<size_t>(num_vertices) * num_vertices, false);
+  for (vertex_t i = 0; i < num_vertices; ++i) {
+    for (edge_t j = offsets[i]; j < offsets[i + 1]; ++j) {
+      if (indices[j] != i) {  // ignore self-loops
+        adjacency[static_cast<size_t>(i) * num_vertices + indices[j]] = true;
+      }
+    }
+  }
+  auto has_edge = [&adjacency, num_vertices](vertex_t src, vertex_t dst) {
+    return adjacency[static_cast<size_t>(src) * num_vertices + dst];
+  };
+
+  std::array<uint64_t, 16> census{};
+  census.fill(uint64_t{0});
+  for (vertex_t v = 0; v < num_vertices; ++v) {
+    for (vertex_t u = v + 1; u < num_vertices; ++u) {
+      for (vertex_t w = u + 1; w < num_vertices; ++w) {
+        int code = (has_edge(v, u) ? 1 : 0) | (has_edge(u, v) ? 2 : 0) | (has_edge(v, w) ? 4 : 0) |
+                   (has_edge(w, v) ? 8 : 0) | (has_edge(u, w) ? 16 : 0) | (has_edge(w, u) ? 32 : 0);
+        ++census[tricode_to_type[code]];
+      }
+    }
+  }
+
+  return census;
+}
+
+struct TriadCensus_Usecase {
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_TriadCensus
+  : public ::testing::TestWithParam<std::tuple<TriadCensus_Usecase, input_usecase_t>> {
+ public:
+  Tests_TriadCensus() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(std::tuple<TriadCensus_Usecase const&, input_usecase_t const&> const& param)
+  {
+    constexpr bool renumber = true;
+
+    using weight_t = float;
+
+    auto [triad_census_usecase, input_usecase] = param;
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, renumber, false, true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "construct_graph took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    auto graph_view = graph.view();
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto census = cugraph::triad_census<vertex_t, edge_t, weight_t, false>(handle, graph_view);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "Triad census took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (triad_census_usecase.check_correctness) {
+      // triad census is invariant under renumbering
+      std::vector<edge_t> h_offsets(graph_view.number_of_vertices() + 1);
+      std::vector<vertex_t> h_indices(graph_view.number_of_edges());
+      raft::update_host(h_offsets.data(),
+                        graph_view.local_edge_partition_view().offsets(),
+                        graph_view.number_of_vertices() + 1,
+                        handle.get_stream());
+      raft::update_host(h_indices.data(),
+                        graph_view.local_edge_partition_view().indices(),
+                        graph_view.number_of_edges(),
+                        handle.get_stream());
+
+      handle.sync_stream();
+
+      auto h_reference_census = triad_census_reference(
+        h_offsets.data(), h_indices.data(), graph_view.number_of_vertices());
+
+      for (size_t i = 0; i < census.size(); ++i) {
+        ASSERT_EQ(census[i], h_reference_census[i])
+          << "Triad census values do not match with the reference values (triad type index " << i
+          << ").";
+      }
+
+      // the host implementation should produce the same census regardless of the number of threads
+
+      for (size_t num_threads : {size_t{1}, size_t{4}}) {
+        auto h_census = cugraph::host_triad_census(
+          raft::host_span<edge_t const>(h_offsets.data(), h_offsets.size()),
+          raft::host_span<vertex_t const>(h_indices.data(), h_indices.size()),
+          num_threads);
+        for (size_t i = 0; i < h_census.size(); ++i) {
+          ASSERT_EQ(h_census[i], h_reference_census[i])
+            << "Host triad census values do not match with the reference values (triad type index "
+            << i << ", " << num_threads << " threads).";
+        }
+      }
+    }
+  }
+};
+
+using Tests_TriadCensus_File = Tests_TriadCensus<cugraph::test::File_Usecase>;
+using Tests_TriadCensus_Rmat = Tests_TriadCensus<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_TriadCensus_File, CheckInt32Int32)
+{
+  run_current_test<int32_t, int32_t>(override_File_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+TEST_P(Tests_TriadCensus_Rmat, CheckInt32Int32)
+{
+  run_current_test<int32_t, int32_t>(override_Rmat_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+TEST_P(Tests_TriadCensus_File, CheckInt32Int64)
+{
+  run_current_test<int32_t, int64_t>(override_File_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+TEST_P(Tests_TriadCensus_Rmat, CheckInt64Int64)
+{
+  run_current_test<int64_t, int64_t>(override_Rmat_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_TriadCensus_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(TriadCensus_Usecase{}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_TriadCensus_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(TriadCensus_Usecase{}),
+    // directed graphs
+    ::testing::Values(cugraph::test::Rmat_Usecase(8, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_TriadCensus_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(TriadCensus_Usecase{false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/device_comm_wrapper.hpp>
+#include <utilities/high_res_clock.h>
+#include <utilities/mg_utilities.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/sequence.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+struct VertexColoring_Usecase {
+  size_t distance{1};
+  cugraph::coloring_algorithm_t algorithm{cugraph::coloring_algorithm_t::JONES_PLASSMANN};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGVertexColoring
+  : public ::testing::TestWithParam<std::tuple<VertexColoring_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGVertexColoring() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Compare the results of running vertex_coloring on multiple GPUs to that of a single-GPU run on
+  // the same (renumbered) graph (the colors are deterministic for a given seed and do not depend on
+  // the number of GPUs), and check that the MG colors form a valid coloring
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(VertexColoring_Usecase const& vertex_coloring_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    HighResClock hr_clock{};
+
+    // 1. create MG graph
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        *handle_, input_usecase, false, true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG construct_graph took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    auto mg_graph_view = mg_graph.view();
+
+    // 2. run MG vertex_coloring
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto d_mg_colors = cugraph::vertex_coloring(*handle_,
+                                                mg_graph_view,
+                                                vertex_coloring_usecase.distance,
+                                                vertex_coloring_usecase.algorithm);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG vertex_coloring took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    // 3. compare SG & MG results
+
+    if (vertex_coloring_usecase.check_correctness) {
+      ASSERT_EQ(d_mg_colors.size(),
+                static_cast<size_t>(mg_graph_view.local_vertex_partition_range_size()));
+
+      // 3-1. aggregate MG results and the MG graph's edges (in internal vertex IDs, the local
+      // vertex partition ranges are ordered by rank, so the aggregated colors are in vertex ID
+      // order)
+
+      auto [d_mg_srcs, d_mg_dsts, d_mg_weights] =
+        mg_graph_view.decompress_to_edgelist(*handle_, std::nullopt);
+
+      auto d_mg_aggregate_srcs =
+        cugraph::test::device_gatherv(*handle_, d_mg_srcs.data(), d_mg_srcs.size());
+      auto d_mg_aggregate_dsts =
+        cugraph::test::device_gatherv(*handle_, d_mg_dsts.data(), d_mg_dsts.size());
+      auto d_mg_aggregate_colors =
+        cugraph::test::device_gatherv(*handle_, d_mg_colors.data(), d_mg_colors.size());
+
+      if (handle_->get_comms().get_rank() == int{0}) {
+        // 3-2. create SG graph with the MG graph's vertex IDs
+
+        rmm::device_uvector<vertex_t> d_sg_vertices(mg_graph_view.number_of_vertices(),
+                                                    handle_->get_stream());
+        thrust::sequence(handle_->get_thrust_policy(),
+                         d_sg_vertices.begin(),
+                         d_sg_vertices.end(),
+                         vertex_t{0});
+
+        cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> sg_graph(*handle_);
+        std::tie(sg_graph, std::ignore) =
+          cugraph::create_graph_from_edgelist<vertex_t, edge_t, weight_t, false, false>(
+            *handle_,
+            std::make_optional(std::move(d_sg_vertices)),
+            std::move(d_mg_aggregate_srcs),
+            std::move(d_mg_aggregate_dsts),
+            std::nullopt,
+            cugraph::graph_properties_t{true, mg_graph_view.is_multigraph()},
+            false);
+
+        auto sg_graph_view = sg_graph.view();
+
+        auto num_vertices = sg_graph_view.number_of_vertices();
+        ASSERT_EQ(mg_graph_view.number_of_vertices(), num_vertices);
+
+        // 3-3. run SG vertex_coloring
+
+        auto d_sg_colors = cugraph::vertex_coloring(*handle_,
+                                                    sg_graph_view,
+                                                    vertex_coloring_usecase.distance,
+                                                    vertex_coloring_usecase.algorithm);
+
+        // 3-4. compare
+
+        auto h_mg_aggregate_colors = cugraph::test::to_host(
+          *handle_, d_mg_aggregate_colors.data(), d_mg_aggregate_colors.size());
+        auto h_sg_colors = cugraph::test::to_host(*handle_, d_sg_colors.data(), d_sg_colors.size());
+
+        ASSERT_TRUE(std::equal(
+          h_mg_aggregate_colors.begin(), h_mg_aggregate_colors.end(), h_sg_colors.begin()))
+          << "MG and SG vertex_coloring returned different colors.";
+
+        // 3-5. the MG colors are dense, and no two vertices within the coloring distance share a
+        // color
+
+        auto h_offsets = cugraph::test::to_host(
+          *handle_, sg_graph_view.local_edge_partition_view().offsets(), num_vertices + 1);
+        auto h_indices = cugraph::test::to_host(*handle_,
+                                                sg_graph_view.local_edge_partition_view().indices(),
+                                                sg_graph_view.number_of_edges());
+
+        auto num_colors = num_vertices > 0 ? *std::max_element(h_mg_aggregate_colors.begin(),
+                                                               h_mg_aggregate_colors.end()) +
+                                               1
+                                           : vertex_t{0};
+        std::vector<bool> is_used(num_colors, false);
+        for (vertex_t v = 0; v < num_vertices; ++v) {
+          ASSERT_TRUE((h_mg_aggregate_colors[v] >= 0) && (h_mg_aggregate_colors[v] < num_colors))
+            << "vertex " << v << " has an invalid color (" << h_mg_aggregate_colors[v] << ").";
+          is_used[h_mg_aggregate_colors[v]] = true;
+        }
+        ASSERT_TRUE(std::all_of(is_used.begin(), is_used.end(), [](auto used) { return used; }))
+          << "the colors are not dense.";
+
+        for (vertex_t v = 0; v < num_vertices; ++v) {
+          for (auto i = h_offsets[v]; i < h_offsets[v + 1]; ++i) {
+            auto nbr = h_indices[i];
+            if (nbr == v) { continue; }
+            ASSERT_NE(h_mg_aggregate_colors[v], h_mg_aggregate_colors[nbr])
+              << "adjacent vertices " << v << " and " << nbr << " share a color.";
+            if (vertex_coloring_usecase.distance == 2) {
+              for (auto j = h_offsets[nbr]; j < h_offsets[nbr + 1]; ++j) {
+                auto two_hop_nbr = h_indices[j];
+                if (two_hop_nbr == v) { continue; }
+                ASSERT_NE(h_mg_aggregate_colors[v], h_mg_aggregate_colors[two_hop_nbr])
+                  << "vertices " << v << " and " << two_hop_nbr
+                  << " (within distance 2) share a color.";
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGVertexColoring<input_usecase_t>::handle_ = nullptr;
+
+using Tests_MGVertexColoring_File = Tests_MGVertexColoring<cugraph::test::File_Usecase>;
+using Tests_MGVertexColoring_Rmat = Tests_MGVertexColoring<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGVertexColoring_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGVertexColoring_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGVertexColoring_Rmat, CheckInt32Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGVertexColoring_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_tests,
+  Tests_MGVertexColoring_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(
+      VertexColoring_Usecase{1, cugraph::coloring_algorithm_t::JONES_PLASSMANN},
+      VertexColoring_Usecase{2, cugraph::coloring_algorithm_t::JONES_PLASSMANN},
+      VertexColoring_Usecase{1, cugraph::coloring_algorithm_t::SPECULATIVE},
+      VertexColoring_Usecase{2, cugraph::coloring_algorithm_t::SPECULATIVE}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_tests,
+  Tests_MGVertexColoring_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(
+      VertexColoring_Usecase{1, cugraph::coloring_algorithm_t::JONES_PLASSMANN},
+      VertexColoring_Usecase{2, cugraph::coloring_algorithm_t::JONES_PLASSMANN},
+      VertexColoring_Usecase{1, cugraph::coloring_algorithm_t::SPECULATIVE},
+      VertexColoring_Usecase{2, cugraph::coloring_algorithm_t::SPECULATIVE}),
+    ::testing::Values(
+      cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false, 0, true))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGVertexColoring_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(
+      VertexColoring_Usecase{1, cugraph::coloring_algorithm_t::JONES_PLASSMANN, false},
+      VertexColoring_Usecase{1, cugraph::coloring_algorithm_t::SPECULATIVE, false}),
+    ::testing::Values(
+      cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false, 0, true))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/high_res_clock.h>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+struct VertexColoring_Usecase {
+  size_t distance{1};
+  cugraph::coloring_algorithm_t algorithm{cugraph::coloring_algorithm_t::JONES_PLASSMANN};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_VertexColoring
+  : public ::testing::TestWithParam<std::tuple<VertexColoring_Usecase, input_usecase_t>> {
+ public:
+  Tests_VertexColoring() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(VertexColoring_Usecase const& vertex_coloring_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, renumber);
+    auto graph_view = graph.view();
+
+    auto num_vertices = graph_view.number_of_vertices();
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto d_colors = cugraph::vertex_coloring(handle,
+                                             graph_view,
+                                             vertex_coloring_usecase.distance,
+                                             vertex_coloring_usecase.algorithm);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "vertex_coloring took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (vertex_coloring_usecase.check_correctness) {
+      ASSERT_EQ(d_colors.size(), static_cast<size_t>(num_vertices));
+
+      auto [d_class_vertices, h_class_offsets] = cugraph::color_classes(
+        handle, graph_view, raft::device_span<vertex_t const>(d_colors.data(), d_colors.size()));
+
+      auto h_colors = cugraph::test::to_host(handle, d_colors.data(), d_colors.size());
+      auto h_class_vertices =
+        cugraph::test::to_host(handle, d_class_vertices.data(), d_class_vertices.size());
+      auto h_offsets = cugraph::test::to_host(
+        handle, graph_view.local_edge_partition_view().offsets(), num_vertices + 1);
+      auto h_indices = cugraph::test::to_host(handle,
+                                              graph_view.local_edge_partition_view().indices(),
+                                              graph_view.number_of_edges());
+
+      // the colors are dense
+
+      auto num_colors =
+        num_vertices > 0 ? *std::max_element(h_colors.begin(), h_colors.end()) + 1 : vertex_t{0};
+      std::vector<bool> is_used(num_colors, false);
+      for (vertex_t v = 0; v < num_vertices; ++v) {
+        ASSERT_TRUE((h_colors[v] >= 0) && (h_colors[v] < num_colors))
+          << "vertex " << v << " has an invalid color (" << h_colors[v] << ").";
+        is_used[h_colors[v]] = true;
+      }
+      ASSERT_TRUE(std::all_of(is_used.begin(), is_used.end(), [](auto used) { return used; }))
+        << "the colors are not dense.";
+
+      // no two vertices within the coloring distance share a color
+
+      for (vertex_t v = 0; v < num_vertices; ++v) {
+        for (auto i = h_offsets[v]; i < h_offsets[v + 1]; ++i) {
+          auto nbr = h_indices[i];
+          if (nbr == v) { continue; }
+          ASSERT_NE(h_colors[v], h_colors[nbr])
+            << "adjacent vertices " << v << " and " << nbr << " share a color.";
+          if (vertex_coloring_usecase.distance == 2) {
+            for (auto j = h_offsets[nbr]; j < h_offsets[nbr + 1]; ++j) {
+              auto two_hop_nbr = h_indices[j];
+              if (two_hop_nbr == v) { continue; }
+              ASSERT_NE(h_colors[v], h_colors[two_hop_nbr])
+                << "vertices " << v << " and " << two_hop_nbr
+                << " (within distance 2) share a color.";
+            }
+          }
+        }
+      }
+
+      // the color classes partition the vertices, and each class is sorted
+
+      ASSERT_EQ(h_class_offsets.size(), static_cast<size_t>(num_colors) + 1);
+      ASSERT_EQ(h_class_offsets.back(), static_cast<size_t>(num_vertices));
+      for (vertex_t c = 0; c < num_colors; ++c) {
+        ASSERT_TRUE(std::is_sorted(h_class_vertices.begin() + h_class_offsets[c],
+                                   h_class_vertices.begin() + h_class_offsets[c + 1]))
+          << "color class " << c << " is not sorted.";
+        for (auto i = h_class_offsets[c]; i < h_class_offsets[c + 1]; ++i) {
+          ASSERT_EQ(h_colors[h_class_vertices[i]], c)
+            << "vertex " << h_class_vertices[i] << " is in a wrong color class.";
+        }
+      }
+    }
+  }
+};
+
+using Tests_VertexColoring_File = Tests_VertexColoring<cugraph::test::File_Usecase>;
+using Tests_VertexColoring_Rmat = Tests_VertexColoring<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_VertexColoring_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_VertexColoring_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_VertexColoring_Rmat, CheckInt32Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_VertexColoring_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_VertexColoring_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(
+      VertexColoring_Usecase{1, cugraph::coloring_algorithm_t::JONES_PLASSMANN},
+      VertexColoring_Usecase{2, cugraph::coloring_algorithm_t::JONES_PLASSMANN},
+      VertexColoring_Usecase{1, cugraph::coloring_algorithm_t::SPECULATIVE},
+      VertexColoring_Usecase{2, cugraph::coloring_algorithm_t::SPECULATIVE}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_VertexColoring_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(
+      VertexColoring_Usecase{1, cugraph::coloring_algorithm_t::JONES_PLASSMANN},
+      VertexColoring_Usecase{2, cugraph::coloring_algorithm_t::JONES_PLASSMANN},
+      VertexColoring_Usecase{1, cugraph::coloring_algorithm_t::SPECULATIVE},
+      VertexColoring_Usecase{2, cugraph::coloring_algorithm_t::SPECULATIVE}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, true, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_VertexColoring_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(
+      VertexColoring_Usecase{1, cugraph::coloring_algorithm_t::JONES_PLASSMANN, false},
+      VertexColoring_Usecase{1, cugraph::coloring_algorithm_t::SPECULATIVE, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, true, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -133,6 +133,7 @@ struct PageRank_Usecase {
   double personalization_ratio{0.0};
   bool test_weighted{false};
   bool check_correctness{true};
+  bool use_propagation_blocking{false};
 };
 
 template <typename input_usecase_t>
@@ -230,28 +231,67 @@ class Tests_PageRank
 
     rmm::device_uvector<result_t> d_pageranks(graph_view.number_of_vertices(), handle.get_stream());
 
+    auto run_pagerank = [&](cugraph::propagation_blocking_t<vertex_t, edge_t, weight_t> const*
+                              blocking,
+                            result_t* pageranks) {
+      auto personalization_vertices =
+        d_personalization_vertices
+          ? std::optional<vertex_t const*>{(*d_personalization_vertices).data()}
+          : std::nullopt;
+      auto personalization_values =
+        d_personalization_values
+          ? std::optional<result_t const*>{(*d_personalization_values).data()}
+          : std::nullopt;
+      auto personalization_vector_size =
+        d_personalization_vertices ? std::optional<vertex_t>{(*d_personalization_vertices).size()}
+                                   : std::nullopt;
+      if (blocking != nullptr) {
+        cugraph::pagerank<vertex_t, edge_t, weight_t>(handle,
+                                                      graph_view,
+                                                      *blocking,
+                                                      std::nullopt,
+                                                      personalization_vertices,
+                                                      personalization_values,
+                                                      personalization_vector_size,
+                                                      pageranks,
+                                                      alpha,
+                                                      epsilon,
+                                                      std::numeric_limits<size_t>::max(),
+                                                      false,
+                                                      false);
+      } else {
+        cugraph::pagerank<vertex_t, edge_t, weight_t>(handle,
+                                                      graph_view,
+                                                      std::nullopt,
+                                                      personalization_vertices,
+                                                      personalization_values,
+                                                      personalization_vector_size,
+                                                      pageranks,
+                                                      alpha,
+                                                      epsilon,
+                                                      std::numeric_limits<size_t>::max(),
+                                                      false,
+                                                      false);
+      }
+    };
+
+    // the default block size covers the small test graphs with a single block, so the correctness
+    // tests use a small block size to walk many blocks
+    auto blocking =
+      pagerank_usecase.use_propagation_blocking
+        ? std::make_optional(cugraph::build_propagation_blocking<result_t>(
+            handle,
+            graph_view,
+            pagerank_usecase.check_correctness ? std::optional<vertex_t>{vertex_t{8}}
+                                               : std::nullopt))
+        : std::nullopt;
+
     if (cugraph::test::g_perf) {
       RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
       hr_clock.start();
     }
 
-    cugraph::pagerank<vertex_t, edge_t, weight_t>(
-      handle,
-      graph_view,
-      std::nullopt,
-      d_personalization_vertices
-        ? std::optional<vertex_t const*>{(*d_personalization_vertices).data()}
-        : std::nullopt,
-      d_personalization_values ? std::optional<result_t const*>{(*d_personalization_values).data()}
-                               : std::nullopt,
-      d_personalization_vertices ? std::optional<vertex_t>{(*d_personalization_vertices).size()}
-                                 : std::nullopt,
-      d_pageranks.data(),
-      alpha,
-      epsilon,
-      std::numeric_limits<size_t>::max(),
-      false,
-      false);
+    run_pagerank(blocking ? &(*blocking) : nullptr, d_pageranks.data());
 
     if (cugraph::test::g_perf) {
       RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
@@ -260,6 +300,43 @@ class Tests_PageRank
       std::cout << "PageRank took " << elapsed_time * 1e-6 << " s.\n";
     }
 
+    if (pagerank_usecase.check_correctness && blocking) {
+      // the blocked edge pass should produce the same values as the compressed sparse edge pass,
+      // with the given and with the default block size
+      rmm::device_uvector<result_t> d_unblocked_pageranks(d_pageranks.size(), handle.get_stream());
+      run_pagerank(nullptr, d_unblocked_pageranks.data());
+      auto h_unblocked_pageranks = cugraph::test::to_host(
+        handle, d_unblocked_pageranks.data(), d_unblocked_pageranks.size());
+
+      auto default_blocking =
+        cugraph::build_propagation_blocking<result_t>(handle, graph_view, std::nullopt);
+      ASSERT_TRUE(default_blocking.block_size * sizeof(result_t) <=
+                  static_cast<size_t>(handle.get_device_properties().sharedMemPerBlock));
+      rmm::device_uvector<result_t> d_default_blocked_pageranks(d_pageranks.size(),
+                                                                handle.get_stream());
+      run_pagerank(&default_blocking, d_default_blocked_pageranks.data());
+
+      auto h_blocked_pageranks =
+        cugraph::test::to_host(handle, d_pageranks.data(), d_pageranks.size());
+      auto h_default_blocked_pageranks = cugraph::test::to_host(
+        handle, d_default_blocked_pageranks.data(), d_default_blocked_pageranks.size());
+
+      auto blocked_nearly_equal = [](auto lhs, auto rhs) {
+        return std::abs(lhs - rhs) <= std::max(std::abs(lhs), std::abs(rhs)) * 1e-4;
+      };
+      ASSERT_TRUE(std::equal(h_unblocked_pageranks.begin(),
+                             h_unblocked_pageranks.end(),
+                             h_blocked_pageranks.begin(),
+                             blocked_nearly_equal))
+        << "propagation blocked PageRank values do not match with the unblocked values.";
+      ASSERT_TRUE(std::equal(h_unblocked_pageranks.begin(),
+                             h_unblocked_pageranks.end(),
+                             h_default_blocked_pageranks.begin(),
+                             blocked_nearly_equal))
+        << "propagation blocked PageRank values (default block size) do not match with the "
+           "unblocked values.";
+    }
+
     if (pagerank_usecase.check_correctness) {
       cugraph::graph_t<vertex_t, edge_t, weight_t, true, false> unrenumbered_graph(handle);
       if (renumber) {
@@ -438,7 +515,9 @@ INSTANTIATE_TEST_SUITE_P(
     ::testing::Values(PageRank_Usecase{0.0, false},
                       PageRank_Usecase{0.5, false},
                       PageRank_Usecase{0.0, true},
-                      PageRank_Usecase{0.5, true}),
+                      PageRank_Usecase{0.5, true},
+                      PageRank_Usecase{0.0, true, true, true},
+                      PageRank_Usecase{0.5, true, true, true}),
     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
                       cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
 
@@ -450,7 +529,9 @@ INSTANTIATE_TEST_SUITE_P(
     ::testing::Values(PageRank_Usecase{0.0, false},
                       PageRank_Usecase{0.5, false},
                       PageRank_Usecase{0.0, true},
-                      PageRank_Usecase{0.5, true}),
+                      PageRank_Usecase{0.5, true},
+                      PageRank_Usecase{0.0, true, true, true},
+                      PageRank_Usecase{0.5, true, true, true}),
     ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
 
 INSTANTIATE_TEST_SUITE_P(
@@ -480,7 +561,8 @@ INSTANTIATE_TEST_SUITE_P(
     ::testing::Values(PageRank_Usecase{0.0, false, false},
                       PageRank_Usecase{0.5, false, false},
                       PageRank_Usecase{0.0, true, false},
-                      PageRank_Usecase{0.5, true, false}),
+                      PageRank_Usecase{0.5, true, false},
+                      PageRank_Usecase{0.0, true, false, true}),
     ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
 
 CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/serialization/serializer.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// exact Jaccard similarity coefficient of the out-neighborhoods of u and v
+template <typename vertex_t, typename edge_t>
+double jaccard_reference(std::vector<edge_t> const& offsets,
+                         std::vector<vertex_t> const& indices,
+                         vertex_t u,
+                         vertex_t v)
+{
+  std::set<vertex_t> u_nbrs(indices.begin() + offsets[u], indices.begin() + offsets[u + 1]);
+  std::set<vertex_t> v_nbrs(indices.begin() + offsets[v], indices.begin() + offsets[v + 1]);
+  std::vector<vertex_t> intersection{};
+  std::set_intersection(u_nbrs.begin(),
+                        u_nbrs.end(),
+                        v_nbrs.begin(),
+                        v_nbrs.end(),
+                        std::back_inserter(intersection));
+  auto union_size = u_nbrs.size() + v_nbrs.size() - intersection.size();
+  return union_size > 0 ? static_cast<double>(intersection.size()) / union_size : 0.0;
+}
+
+}  // namespace
+
+struct MinHashIndex_Usecase {
+  size_t num_hashes{1024};
+  size_t num_bands{256};
+  double threshold{0.5};
+  double tolerance{0.1};
+};
+
+template <typename input_usecase_t>
+class Tests_MinHashIndex
+  : public ::testing::TestWithParam<std::tuple<MinHashIndex_Usecase, input_usecase_t>> {
+ public:
+  Tests_MinHashIndex() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(
+    std::tuple<MinHashIndex_Usecase const&, input_usecase_t const&> const& param)
+  {
+    using weight_t = float;
+    using result_t = float;
+
+    auto [minhash_usecase, input_usecase] = param;
+
+    raft::handle_t handle{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, false);
+    auto graph_view   = graph.view();
+    auto num_vertices = graph_view.number_of_vertices();
+
+    auto index =
+      cugraph::build_minhash_index(handle, graph_view, minhash_usecase.num_hashes, 0, true);
+
+    auto h_offsets = cugraph::test::to_host(
+      handle, graph_view.local_edge_partition_view().offsets(), num_vertices + 1);
+    auto h_indices = cugraph::test::to_host(
+      handle, graph_view.local_edge_partition_view().indices(), graph_view.number_of_edges());
+
+    // 1. estimates for every pair of vertices
+
+    std::vector<vertex_t> h_first{};
+    std::vector<vertex_t> h_second{};
+    for (vertex_t u = 0; u < num_vertices; ++u) {
+      for (vertex_t v = u + 1; v < num_vertices; ++v) {
+        h_first.push_back(u);
+        h_second.push_back(v);
+      }
+    }
+    rmm::device_uvector<vertex_t> d_first(h_first.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_second(h_second.size(), handle.get_stream());
+    raft::update_device(d_first.data(), h_first.data(), h_first.size(), handle.get_stream());
+    raft::update_device(d_second.data(), h_second.data(), h_second.size(), handle.get_stream());
+
+    auto d_coefficients = cugraph::minhash_jaccard_coefficients<vertex_t, result_t>(
+      handle,
+      index,
+      raft::device_span<vertex_t const>(d_first.data(), d_first.size()),
+      raft::device_span<vertex_t const>(d_second.data(), d_second.size()),
+      true);
+    auto h_coefficients =
+      cugraph::test::to_host(handle, d_coefficients.data(), d_coefficients.size());
+
+    std::set<std::pair<vertex_t, vertex_t>> h_reference_similar_pairs{};
+    for (size_t i = 0; i < h_first.size(); ++i) {
+      auto reference = jaccard_reference(h_offsets, h_indices, h_first[i], h_second[i]);
+      ASSERT_NEAR(h_coefficients[i], reference, minhash_usecase.tolerance)
+        << "vertex pair (" << h_first[i] << ", " << h_second[i] << ")";
+      if (reference >= minhash_usecase.threshold + minhash_usecase.tolerance) {
+        h_reference_similar_pairs.insert(std::make_pair(h_first[i], h_second[i]));
+      }
+    }
+
+    // 2. pairs found by locality sensitive hashing, the pairs well above the threshold are found
+    // with high probability
+
+    auto [d_similar_firsts, d_similar_seconds, d_similar_coefficients] =
+      cugraph::minhash_similar_pairs(handle,
+                                     index,
+                                     minhash_usecase.num_bands,
+                                     static_cast<result_t>(minhash_usecase.threshold));
+    auto h_similar_firsts =
+      cugraph::test::to_host(handle, d_similar_firsts.data(), d_similar_firsts.size());
+    auto h_similar_seconds =
+      cugraph::test::to_host(handle, d_similar_seconds.data(), d_similar_seconds.size());
+    auto h_similar_coefficients =
+      cugraph::test::to_host(handle, d_similar_coefficients.data(), d_similar_coefficients.size());
+
+    std::set<std::pair<vertex_t, vertex_t>> h_similar_pairs{};
+    for (size_t i = 0; i < h_similar_firsts.size(); ++i) {
+      ASSERT_TRUE(h_similar_firsts[i] < h_similar_seconds[i]);
+      ASSERT_TRUE(h_similar_coefficients[i] >= static_cast<result_t>(minhash_usecase.threshold));
+      ASSERT_TRUE(h_similar_pairs.insert(std::make_pair(h_similar_firsts[i], h_similar_seconds[i]))
+                    .second)
+        << "duplicate vertex pair (" << h_similar_firsts[i] << ", " << h_similar_seconds[i] << ")";
+    }
+    for (auto const& pair : h_reference_similar_pairs) {
+      ASSERT_TRUE(h_similar_pairs.find(pair) != h_similar_pairs.end())
+        << "vertex pair (" << pair.first << ", " << pair.second << ") is not found.";
+    }
+
+    // 3. capping the bucket size bounds the number of candidates per band and returns a subset of
+    // the uncapped pairs
+
+    size_t max_bucket_size{4};
+    auto [d_capped_firsts, d_capped_seconds, d_capped_coefficients] =
+      cugraph::minhash_similar_pairs(handle,
+                                     index,
+                                     minhash_usecase.num_bands,
+                                     static_cast<result_t>(minhash_usecase.threshold),
+                                     max_bucket_size,
+                                     true);
+    auto h_capped_firsts =
+      cugraph::test::to_host(handle, d_capped_firsts.data(), d_capped_firsts.size());
+    auto h_capped_seconds =
+      cugraph::test::to_host(handle, d_capped_seconds.data(), d_capped_seconds.size());
+
+    ASSERT_TRUE(h_capped_firsts.size() <=
+                minhash_usecase.num_bands * static_cast<size_t>(num_vertices) *
+                  (max_bucket_size - 1));
+    for (size_t i = 0; i < h_capped_firsts.size(); ++i) {
+      ASSERT_TRUE(h_similar_pairs.find(std::make_pair(h_capped_firsts[i], h_capped_seconds[i])) !=
+                  h_similar_pairs.end())
+        << "vertex pair (" << h_capped_firsts[i] << ", " << h_capped_seconds[i]
+        << ") is not found without capping the bucket size.";
+    }
+  }
+};
+
+using Tests_MinHashIndex_File = Tests_MinHashIndex<cugraph::test::File_Usecase>;
+
+TEST_P(Tests_MinHashIndex_File, CheckInt32Int32)
+{
+  run_current_test<int32_t, int32_t>(override_File_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+TEST_P(Tests_MinHashIndex_File, CheckInt64Int64)
+{
+  run_current_test<int64_t, int64_t>(override_File_Usecase_with_cmd_line_arguments(GetParam()));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MinHashIndex_File,
+  ::testing::Combine(::testing::Values(MinHashIndex_Usecase{}),
+                     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                                       cugraph::test::File_Usecase("test/datasets/dolphins.mtx"))));
+
+TEST(MinHashIndexTest, IndexSerUnserWithGraph)
+{
+  using namespace cugraph::serializer;
+
+  using vertex_t = int32_t;
+  using edge_t   = int32_t;
+  using weight_t = float;
+
+  raft::handle_t handle{};
+
+  edge_t num_edges      = 8;
+  vertex_t num_vertices = 6;
+
+  std::vector<vertex_t> v_src{0, 1, 1, 2, 2, 2, 3, 4};
+  std::vector<vertex_t> v_dst{1, 3, 4, 0, 1, 3, 5, 5};
+  std::vector<weight_t> v_w{0.1, 1.1, 2.1, 3.1, 4.1, 5.1, 6.1, 7.1};
+
+  auto graph = cugraph::test::make_graph(
+    handle, v_src, v_dst, std::optional<std::vector<weight_t>>{v_w}, num_vertices, num_edges);
+
+  auto index = cugraph::build_minhash_index(handle, graph.view(), 64, 7);
+
+  auto graph_sz     = serializer_t::get_device_graph_sz_bytes(graph);
+  auto total_ser_sz = graph_sz.first + graph_sz.second +
+                      serializer_t::get_device_minhash_index_sz_bytes(index);
+
+  serializer_t ser(handle, total_ser_sz);
+  serializer_t::graph_meta_t<decltype(graph)> graph_meta{};
+  ser.serialize(graph, graph_meta);
+  ser.serialize(index);
+
+  serializer_t unser(handle, ser.get_storage());
+  auto graph_copy = unser.unserialize<decltype(graph)>(graph_sz.first, graph_sz.second);
+  auto index_copy = unser.unserialize_minhash_index<vertex_t>();
+
+  auto pair = cugraph::test::compare_graphs(handle, graph, graph_copy);
+  if (pair.first == false) std::cerr << "Test failed with " << pair.second << ".\n";
+  ASSERT_TRUE(pair.first);
+
+  EXPECT_EQ(index_copy.number_of_vertices, index.number_of_vertices);
+  EXPECT_EQ(index_copy.num_hashes, index.num_hashes);
+  EXPECT_EQ(index_copy.seed, index.seed);
+  EXPECT_EQ(
+    cugraph::test::to_host(handle, index.signatures.data(), index.signatures.size()),
+    cugraph::test::to_host(handle, index_copy.signatures.data(), index_copy.signatures.size()));
+}
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -24,6 +24,7 @@
 
 #include <prims/edge_partition_src_dst_property.cuh>
 #include <prims/per_v_transform_reduce_incoming_outgoing_e.cuh>
+#include <prims/reduce_op.cuh>
 #include <prims/update_edge_partition_src_dst_property.cuh>
 
 #include <cugraph/algorithms.hpp>
@@ -221,6 +222,65 @@ template <typename... Args>
 struct generate<std::tuple<Args...>> : public generate_impl<Args...> {
 };
 
+// negative values, a value-initialized T is not the identity element of reduce_op::maximum
+struct negated_min_property_e_op_t {
+  template <typename vertex_t, typename weight_t, typename T>
+  __device__ T operator()(vertex_t, vertex_t, weight_t, T src_property, T dst_property) const
+  {
+    return -(src_property < dst_property ? src_property : dst_property) - T{1};
+  }
+};
+
+// negative and positive values, a value-initialized T is not the identity element of
+// reduce_op::minimum (for the vertices with only positive values)
+struct property_difference_e_op_t {
+  template <typename vertex_t, typename weight_t, typename T>
+  __device__ T operator()(vertex_t, vertex_t, weight_t, T src_property, T dst_property) const
+  {
+    return src_property - dst_property + T{1};
+  }
+};
+
+// reduce the edge values to the major vertices with a custom reduction operator (custom reduction
+// operators are supported only when updating major vertices)
+template <typename GraphViewType,
+          typename EdgePartitionSrcValueInputWrapper,
+          typename EdgePartitionDstValueInputWrapper,
+          typename EdgeOp,
+          typename T,
+          typename ReduceOp,
+          typename VertexValueOutputIterator>
+void per_v_transform_reduce_major(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  EdgePartitionSrcValueInputWrapper edge_partition_src_value_input,
+  EdgePartitionDstValueInputWrapper edge_partition_dst_value_input,
+  EdgeOp e_op,
+  T init,
+  ReduceOp reduce_op,
+  VertexValueOutputIterator vertex_value_output_first)
+{
+  if constexpr (GraphViewType::is_storage_transposed) {
+    per_v_transform_reduce_incoming_e(handle,
+                                      graph_view,
+                                      edge_partition_src_value_input,
+                                      edge_partition_dst_value_input,
+                                      e_op,
+                                      init,
+                                      reduce_op,
+                                      vertex_value_output_first);
+  } else {
+    per_v_transform_reduce_outgoing_e(handle,
+                                      graph_view,
+                                      edge_partition_src_value_input,
+                                      edge_partition_dst_value_input,
+                                      e_op,
+                                      init,
+                                      reduce_op,
+                                      vertex_value_output_first);
+  }
+}
+
 struct Prims_Usecase {
   bool check_correctness{true};
   bool test_weighted{false};
@@ -345,6 +405,35 @@ class Tests_MGPerVTransformReduceIncomingOutgoingE
       std::cout << "MG per_v_transform_reduce_outgoing_e took " << elapsed_time * 1e-6 << " s.\n";
     }
 
+    // raft::comms reduces tuples element-wise while reduce_op::minimum & maximum compare them
+    // lexicographically (this is rejected at compile time), so the custom reduction operators are
+    // tested with scalar properties; the edge values are negative (maximum) or of both signs
+    // (minimum), so the results are wrong unless the edge partitions not owning a vertex start
+    // from the reduction operator's identity element
+
+    auto max_result = cugraph::allocate_dataframe_buffer<typename generate<result_t>::type>(
+      mg_graph_view.local_vertex_partition_range_size(), handle_->get_stream());
+    auto min_result = cugraph::allocate_dataframe_buffer<typename generate<result_t>::type>(
+      mg_graph_view.local_vertex_partition_range_size(), handle_->get_stream());
+    if constexpr (std::is_arithmetic_v<result_t>) {
+      per_v_transform_reduce_major(*handle_,
+                                   mg_graph_view,
+                                   row_prop.device_view(),
+                                   col_prop.device_view(),
+                                   negated_min_property_e_op_t{},
+                                   static_cast<result_t>(-initial_value - hash_bin_count),
+                                   cugraph::reduce_op::maximum<result_t>{},
+                                   cugraph::get_dataframe_buffer_begin(max_result));
+      per_v_transform_reduce_major(*handle_,
+                                   mg_graph_view,
+                                   row_prop.device_view(),
+                                   col_prop.device_view(),
+                                   property_difference_e_op_t{},
+                                   static_cast<result_t>(initial_value + hash_bin_count),
+                                   cugraph::reduce_op::minimum<result_t>{},
+                                   cugraph::get_dataframe_buffer_begin(min_result));
+    }
+
     // 3. compare SG & MG results
 
     if (prims_usecase.check_correctness) {
@@ -398,9 +487,36 @@ class Tests_MGPerVTransformReduceIncomingOutgoingE
         },
         property_initial_value,
         cugraph::get_dataframe_buffer_begin(global_in_result));
+      auto global_max_result =
+        cugraph::allocate_dataframe_buffer<typename generate<result_t>::type>(
+          sg_graph_view.local_vertex_partition_range_size(), handle_->get_stream());
+      auto global_min_result =
+        cugraph::allocate_dataframe_buffer<typename generate<result_t>::type>(
+          sg_graph_view.local_vertex_partition_range_size(), handle_->get_stream());
+      if constexpr (std::is_arithmetic_v<result_t>) {
+        per_v_transform_reduce_major(*handle_,
+                                     sg_graph_view,
+                                     sg_row_prop.device_view(),
+                                     sg_col_prop.device_view(),
+                                     negated_min_property_e_op_t{},
+                                     static_cast<result_t>(-initial_value - hash_bin_count),
+                                     cugraph::reduce_op::maximum<result_t>{},
+                                     cugraph::get_dataframe_buffer_begin(global_max_result));
+        per_v_transform_reduce_major(*handle_,
+                                     sg_graph_view,
+                                     sg_row_prop.device_view(),
+                                     sg_col_prop.device_view(),
+                                     property_difference_e_op_t{},
+                                     static_cast<result_t>(initial_value + hash_bin_count),
+                                     cugraph::reduce_op::minimum<result_t>{},
+                                     cugraph::get_dataframe_buffer_begin(global_min_result));
+      }
+
       auto aggregate_labels      = aggregate(*handle_, *d_mg_renumber_map_labels);
       auto aggregate_out_results = aggregate(*handle_, out_result);
       auto aggregate_in_results  = aggregate(*handle_, in_result);
+      auto aggregate_max_results = aggregate(*handle_, max_result);
+      auto aggregate_min_results = aggregate(*handle_, min_result);
       if (handle_->get_comms().get_rank() == int{0}) {
         std::tie(std::ignore, aggregate_out_results) =
           cugraph::test::sort_by_key(*handle_, aggregate_labels, aggregate_out_results);
@@ -408,6 +524,14 @@ class Tests_MGPerVTransformReduceIncomingOutgoingE
           cugraph::test::sort_by_key(*handle_, aggregate_labels, aggregate_in_results);
         ASSERT_TRUE(comp(aggregate_out_results, global_out_result));
         ASSERT_TRUE(comp(aggregate_in_results, global_in_result));
+        if constexpr (std::is_arithmetic_v<result_t>) {
+          std::tie(std::ignore, aggregate_max_results) =
+            cugraph::test::sort_by_key(*handle_, aggregate_labels, aggregate_max_results);
+          ASSERT_TRUE(comp(aggregate_max_results, global_max_result));
+          std::tie(std::ignore, aggregate_min_results) =
+            cugraph::test::sort_by_key(*handle_, aggregate_labels, aggregate_min_results);
+          ASSERT_TRUE(comp(aggregate_min_results, global_min_result));
+        }
       }
     }
   }
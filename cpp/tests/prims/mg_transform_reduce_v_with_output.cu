@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/device_comm_wrapper.hpp>
+#include <utilities/high_res_clock.h>
+#include <utilities/mg_utilities.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+#include <utilities/thrust_wrapper.hpp>
+
+#include <prims/transform_reduce_v.cuh>
+#include <prims/transform_reduce_v_with_output.cuh>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/partition_manager.hpp>
+
+#include <cuco/detail/hash_functions.cuh>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <unordered_map>
+
+template <typename vertex_t, typename T>
+struct property_transform {
+  int mod{};
+  __device__ T operator()(vertex_t, vertex_t val) const
+  {
+    cuco::detail::MurmurHash3_32<vertex_t> hash_func{};
+    return static_cast<T>(hash_func(val) % mod);
+  }
+};
+
+// stores the property value + 1 and reduces the property value
+template <typename vertex_t, typename T>
+struct property_output_and_transform {
+  int mod{};
+  __device__ thrust::tuple<T, T> operator()(vertex_t v, vertex_t val) const
+  {
+    auto value = property_transform<vertex_t, T>{mod}(v, val);
+    return thrust::make_tuple(value + T{1}, value);
+  }
+};
+
+template <typename T>
+bool nearly_equal(T t1, T t2)
+{
+  if constexpr (std::is_floating_point_v<T>) {
+    return (t1 == t2) || (std::abs(t1 - t2) < (std::max(std::abs(t1), std::abs(t2)) * 1e-3));
+  } else {
+    return t1 == t2;
+  }
+}
+
+struct Prims_Usecase {
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGTransformReduceVWithOutput
+  : public ::testing::TestWithParam<std::tuple<Prims_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGTransformReduceVWithOutput() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Compare the reduced values and the stored values of the transform_reduce_v_with_output
+  // primitive with transform_reduce_v and thrust::transform on a single GPU
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_current_test(Prims_Usecase const& prims_usecase, input_usecase_t const& input_usecase)
+  {
+    HighResClock hr_clock{};
+
+    // 1. create MG graph
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_clock.start();
+    }
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        *handle_, input_usecase, false, true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG construct_graph took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    auto mg_graph_view = mg_graph.view();
+
+    // 2. run MG transform reduce with output
+
+    int const hash_bin_count = 5;
+    auto const init          = result_t{10};
+
+    property_output_and_transform<vertex_t, result_t> v_op{hash_bin_count};
+    enum class reduction_type_t { PLUS, MINIMUM, MAXIMUM };
+    reduction_type_t reduction_types[] = {
+      reduction_type_t::PLUS, reduction_type_t::MINIMUM, reduction_type_t::MAXIMUM};
+
+    std::unordered_map<reduction_type_t, result_t> results;
+    std::unordered_map<reduction_type_t, rmm::device_uvector<result_t>> outputs;
+
+    for (auto reduction_type : reduction_types) {
+      rmm::device_uvector<result_t> d_outputs(mg_graph_view.local_vertex_partition_range_size(),
+                                              handle_->get_stream());
+
+      if (cugraph::test::g_perf) {
+        RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        handle_->get_comms().barrier();
+        hr_clock.start();
+      }
+
+      switch (reduction_type) {
+        case reduction_type_t::PLUS:
+          results[reduction_type] =
+            transform_reduce_v_with_output(*handle_,
+                                           mg_graph_view,
+                                           d_mg_renumber_map_labels->begin(),
+                                           d_outputs.begin(),
+                                           v_op,
+                                           init,
+                                           cugraph::reduce_op::plus<result_t>{});
+          break;
+        case reduction_type_t::MINIMUM:
+          results[reduction_type] =
+            transform_reduce_v_with_output(*handle_,
+                                           mg_graph_view,
+                                           d_mg_renumber_map_labels->begin(),
+                                           d_outputs.begin(),
+                                           v_op,
+                                           init,
+                                           cugraph::reduce_op::minimum<result_t>{});
+          break;
+        case reduction_type_t::MAXIMUM:
+          results[reduction_type] =
+            transform_reduce_v_with_output(*handle_,
+                                           mg_graph_view,
+                                           d_mg_renumber_map_labels->begin(),
+                                           d_outputs.begin(),
+                                           v_op,
+                                           init,
+                                           cugraph::reduce_op::maximum<result_t>{});
+          break;
+        default: FAIL() << "should not be reached.";
+      }
+
+      if (cugraph::test::g_perf) {
+        RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        handle_->get_comms().barrier();
+        double elapsed_time{0.0};
+        hr_clock.stop(&elapsed_time);
+        std::cout << "MG transform reduce with output took " << elapsed_time * 1e-6 << " s.\n";
+      }
+
+      outputs.insert({reduction_type, std::move(d_outputs)});
+    }
+
+    // 3. compare SG & MG results
+
+    if (prims_usecase.check_correctness) {
+      cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> sg_graph(*handle_);
+      std::tie(sg_graph, std::ignore) =
+        cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+          *handle_, input_usecase, false, false);
+      auto sg_graph_view = sg_graph.view();
+
+      rmm::device_uvector<result_t> d_expected_outputs(
+        sg_graph_view.local_vertex_partition_range_size(), handle_->get_stream());
+      thrust::transform(
+        handle_->get_thrust_policy(),
+        thrust::make_counting_iterator(sg_graph_view.local_vertex_partition_range_first()),
+        thrust::make_counting_iterator(sg_graph_view.local_vertex_partition_range_last()),
+        d_expected_outputs.begin(),
+        [v_op] __device__(auto v) { return thrust::get<0>(v_op(v, v)); });
+      auto h_expected_outputs = cugraph::test::to_host(
+        *handle_, d_expected_outputs.data(), d_expected_outputs.size());
+
+      auto d_mg_aggregate_labels = cugraph::test::device_gatherv(
+        *handle_, d_mg_renumber_map_labels->data(), d_mg_renumber_map_labels->size());
+
+      property_transform<vertex_t, result_t> prop{hash_bin_count};
+      for (auto reduction_type : reduction_types) {
+        result_t expected_result{};
+        switch (reduction_type) {
+          case reduction_type_t::PLUS:
+            expected_result = transform_reduce_v(
+              *handle_,
+              sg_graph_view,
+              thrust::make_counting_iterator(sg_graph_view.local_vertex_partition_range_first()),
+              prop,
+              init,
+              cugraph::reduce_op::plus<result_t>{});
+            break;
+          case reduction_type_t::MINIMUM:
+            expected_result = transform_reduce_v(
+              *handle_,
+              sg_graph_view,
+              thrust::make_counting_iterator(sg_graph_view.local_vertex_partition_range_first()),
+              prop,
+              init,
+              cugraph::reduce_op::minimum<result_t>{});
+            break;
+          case reduction_type_t::MAXIMUM:
+            expected_result = transform_reduce_v(
+              *handle_,
+              sg_graph_view,
+              thrust::make_counting_iterator(sg_graph_view.local_vertex_partition_range_first()),
+              prop,
+              init,
+              cugraph::reduce_op::maximum<result_t>{});
+            break;
+          default: FAIL() << "should not be reached.";
+        }
+        ASSERT_TRUE(nearly_equal(expected_result, results[reduction_type]))
+          << "reduced values do not match with the SG values.";
+
+        auto const& d_outputs = outputs.at(reduction_type);
+        auto d_mg_aggregate_outputs =
+          cugraph::test::device_gatherv(*handle_, d_outputs.data(), d_outputs.size());
+        if (handle_->get_comms().get_rank() == int{0}) {
+          std::tie(std::ignore, d_mg_aggregate_outputs) =
+            cugraph::test::sort_by_key(*handle_, d_mg_aggregate_labels, d_mg_aggregate_outputs);
+          auto h_mg_aggregate_outputs = cugraph::test::to_host(
+            *handle_, d_mg_aggregate_outputs.data(), d_mg_aggregate_outputs.size());
+          ASSERT_TRUE(std::equal(h_mg_aggregate_outputs.begin(),
+                                 h_mg_aggregate_outputs.end(),
+                                 h_expected_outputs.begin(),
+                                 nearly_equal<result_t>))
+            << "stored values do not match with the SG values.";
+        }
+      }
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGTransformReduceVWithOutput<input_usecase_t>::handle_ =
+  nullptr;
+
+using Tests_MGTransformReduceVWithOutput_File =
+  Tests_MGTransformReduceVWithOutput<cugraph::test::File_Usecase>;
+using Tests_MGTransformReduceVWithOutput_Rmat =
+  Tests_MGTransformReduceVWithOutput<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGTransformReduceVWithOutput_File, CheckInt32Int32FloatInt)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, int>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGTransformReduceVWithOutput_Rmat, CheckInt32Int32FloatInt)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, int>(
+    std::get<0>(param),
+    cugraph::test::override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGTransformReduceVWithOutput_File, CheckInt32Int32FloatDouble)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, double>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGTransformReduceVWithOutput_Rmat, CheckInt64Int64FloatDouble)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float, double>(
+    std::get<0>(param),
+    cugraph::test::override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGTransformReduceVWithOutput_File,
+  ::testing::Combine(
+    ::testing::Values(Prims_Usecase{true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MGTransformReduceVWithOutput_Rmat,
+  ::testing::Combine(::testing::Values(Prims_Usecase{true}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       10, 16, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_large_test,
+  Tests_MGTransformReduceVWithOutput_Rmat,
+  ::testing::Combine(::testing::Values(Prims_Usecase{false}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       20, 32, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
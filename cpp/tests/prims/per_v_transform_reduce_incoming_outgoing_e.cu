@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <prims/edge_partition_src_dst_property.cuh>
+#include <prims/per_v_transform_reduce_incoming_outgoing_e.cuh>
+#include <prims/reduce_op.cuh>
+#include <prims/update_edge_partition_src_dst_property.cuh>
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+template <typename vertex_t>
+struct vertex_property_t {
+  __device__ int operator()(vertex_t v) const
+  {
+    return static_cast<int>((static_cast<uint64_t>(v) * uint64_t{2654435761}) % uint64_t{97});
+  }
+};
+
+struct PerVTransformReduce_Usecase {
+  bool check_correctness{true};
+};
+
+// Compare per_v_transform_reduce_incoming|outgoing_e with the default (sum) and a custom (maximum)
+// reduction operator against host references
+template <typename input_usecase_t>
+class Tests_PerVTransformReduceIncomingOutgoingE
+  : public ::testing::TestWithParam<std::tuple<PerVTransformReduce_Usecase, input_usecase_t>> {
+ public:
+  Tests_PerVTransformReduceIncomingOutgoingE() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(PerVTransformReduce_Usecase const& prims_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, store_transposed, false>(
+        handle, input_usecase, false, false);
+    auto graph_view = graph.view();
+
+    rmm::device_uvector<int> d_properties(graph_view.number_of_vertices(), handle.get_stream());
+    thrust::transform(
+      handle.get_thrust_policy(),
+      thrust::make_counting_iterator(graph_view.local_vertex_partition_range_first()),
+      thrust::make_counting_iterator(graph_view.local_vertex_partition_range_last()),
+      d_properties.begin(),
+      vertex_property_t<vertex_t>{});
+
+    cugraph::edge_partition_src_property_t<decltype(graph_view), int> src_properties(handle,
+                                                                                     graph_view);
+    cugraph::edge_partition_dst_property_t<decltype(graph_view), int> dst_properties(handle,
+                                                                                     graph_view);
+    update_edge_partition_src_property(handle, graph_view, d_properties.begin(), src_properties);
+    update_edge_partition_dst_property(handle, graph_view, d_properties.begin(), dst_properties);
+
+    auto e_op = [] __device__(vertex_t, vertex_t, weight_t, int src_property, int dst_property) {
+      return src_property < dst_property ? src_property : dst_property;
+    };
+
+    rmm::device_uvector<int> d_in_sums(graph_view.number_of_vertices(), handle.get_stream());
+    rmm::device_uvector<int> d_out_sums(graph_view.number_of_vertices(), handle.get_stream());
+    rmm::device_uvector<int> d_major_maximums(graph_view.number_of_vertices(),
+                                              handle.get_stream());
+
+    per_v_transform_reduce_incoming_e(handle,
+                                      graph_view,
+                                      src_properties.device_view(),
+                                      dst_properties.device_view(),
+                                      e_op,
+                                      int{0},
+                                      d_in_sums.begin());
+    per_v_transform_reduce_outgoing_e(handle,
+                                      graph_view,
+                                      src_properties.device_view(),
+                                      dst_properties.device_view(),
+                                      e_op,
+                                      int{0},
+                                      d_out_sums.begin());
+    // custom reduction operators are supported only when updating major vertices
+    if constexpr (store_transposed) {
+      per_v_transform_reduce_incoming_e(handle,
+                                        graph_view,
+                                        src_properties.device_view(),
+                                        dst_properties.device_view(),
+                                        e_op,
+                                        int{0},
+                                        cugraph::reduce_op::maximum<int>{},
+                                        d_major_maximums.begin());
+    } else {
+      per_v_transform_reduce_outgoing_e(handle,
+                                        graph_view,
+                                        src_properties.device_view(),
+                                        dst_properties.device_view(),
+                                        e_op,
+                                        int{0},
+                                        cugraph::reduce_op::maximum<int>{},
+                                        d_major_maximums.begin());
+    }
+
+    if (prims_usecase.check_correctness) {
+      auto [d_srcs, d_dsts, d_weights] = graph.decompress_to_edgelist(handle, std::nullopt, false);
+
+      auto h_srcs       = cugraph::test::to_host(handle, d_srcs.data(), d_srcs.size());
+      auto h_dsts       = cugraph::test::to_host(handle, d_dsts.data(), d_dsts.size());
+      auto h_properties = cugraph::test::to_host(handle, d_properties.data(), d_properties.size());
+
+      std::vector<int> h_reference_in_sums(h_properties.size(), int{0});
+      std::vector<int> h_reference_out_sums(h_properties.size(), int{0});
+      std::vector<int> h_reference_major_maximums(h_properties.size(), int{0});
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        auto value = std::min(h_properties[h_srcs[i]], h_properties[h_dsts[i]]);
+        h_reference_in_sums[h_dsts[i]] += value;
+        h_reference_out_sums[h_srcs[i]] += value;
+        auto major = store_transposed ? h_dsts[i] : h_srcs[i];
+        h_reference_major_maximums[major] = std::max(h_reference_major_maximums[major], value);
+      }
+
+      ASSERT_TRUE(cugraph::test::to_host(handle, d_in_sums.data(), d_in_sums.size()) ==
+                  h_reference_in_sums)
+        << "per_v_transform_reduce_incoming_e results do not match with the reference values.";
+      ASSERT_TRUE(cugraph::test::to_host(handle, d_out_sums.data(), d_out_sums.size()) ==
+                  h_reference_out_sums)
+        << "per_v_transform_reduce_outgoing_e results do not match with the reference values.";
+      ASSERT_TRUE(
+        cugraph::test::to_host(handle, d_major_maximums.data(), d_major_maximums.size()) ==
+        h_reference_major_maximums)
+        << "per_v_transform_reduce_" << (store_transposed ? "incoming" : "outgoing")
+        << "_e results with reduce_op::maximum do not match with the reference values.";
+    }
+  }
+};
+
+using Tests_PerVTransformReduceIncomingOutgoingE_File =
+  Tests_PerVTransformReduceIncomingOutgoingE<cugraph::test::File_Usecase>;
+using Tests_PerVTransformReduceIncomingOutgoingE_Rmat =
+  Tests_PerVTransformReduceIncomingOutgoingE<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_PerVTransformReduceIncomingOutgoingE_File, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_PerVTransformReduceIncomingOutgoingE_File, CheckInt32Int32FloatTransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, true>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_PerVTransformReduceIncomingOutgoingE_Rmat, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(
+    std::get<0>(param),
+    cugraph::test::override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_PerVTransformReduceIncomingOutgoingE_Rmat, CheckInt64Int64FloatTransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float, true>(
+    std::get<0>(param),
+    cugraph::test::override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_PerVTransformReduceIncomingOutgoingE_File,
+  ::testing::Combine(
+    ::testing::Values(PerVTransformReduce_Usecase{true}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_PerVTransformReduceIncomingOutgoingE_Rmat,
+  ::testing::Combine(::testing::Values(PerVTransformReduce_Usecase{true}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_PerVTransformReduceIncomingOutgoingE_Rmat,
+  ::testing::Combine(::testing::Values(PerVTransformReduce_Usecase{false}),
+                     ::testing::Values(cugraph::test::Rmat_Usecase(
+                       20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
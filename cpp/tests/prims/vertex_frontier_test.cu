@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <prims/vertex_frontier.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Buckets with a vertex range hold a bitmap once they become dense, check that the bitmap path
+// keeps the bucket elements sorted & unique through insertions, resizes, and clears
+class Tests_VertexFrontierBucket : public ::testing::Test {
+ public:
+  Tests_VertexFrontierBucket() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t>
+  void run_current_test(vertex_t range_first, vertex_t range_last)
+  {
+    raft::handle_t handle{};
+
+    cugraph::sorted_unique_key_bucket_t<vertex_t> bucket(handle, range_first, range_last);
+    std::vector<vertex_t> h_expected{};
+
+    rmm::device_uvector<vertex_t> d_inserts(0, handle.get_stream());
+    auto to_device = [&](std::vector<vertex_t> const& h_vertices) {
+      d_inserts.resize(h_vertices.size(), handle.get_stream());
+      raft::update_device(
+        d_inserts.data(), h_vertices.data(), h_vertices.size(), handle.get_stream());
+    };
+
+    auto check = [&]() {
+      std::sort(h_expected.begin(), h_expected.end());
+      h_expected.erase(std::unique(h_expected.begin(), h_expected.end()), h_expected.end());
+      ASSERT_EQ(bucket.size(), h_expected.size());
+      auto const& const_bucket = bucket;  // const access does not drop the bitmap
+      auto h_elements = cugraph::test::to_host(handle, const_bucket.begin(), bucket.size());
+      ASSERT_TRUE(std::equal(h_elements.begin(), h_elements.end(), h_expected.begin()))
+        << "bucket elements do not match the inserted vertices.";
+    };
+
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<vertex_t> dist(range_first, range_last - 1);
+    auto range_size = static_cast<size_t>(range_last - range_first);
+
+    // 1. a dense, unsorted insertion with duplicates to an empty bucket (switches to the bitmap)
+
+    std::vector<vertex_t> h_inserts(range_size / 2);
+    std::generate(h_inserts.begin(), h_inserts.end(), [&]() { return dist(gen); });
+    to_device(h_inserts);
+    bucket.insert(d_inserts.begin(), d_inserts.end());
+    h_expected.insert(h_expected.end(), h_inserts.begin(), h_inserts.end());
+    check();
+
+    // 2. small insertions overlapping with the bucket elements
+
+    for (size_t i = 0; i < 4; ++i) {
+      h_inserts.resize(range_size / 16);
+      std::generate(h_inserts.begin(), h_inserts.end(), [&]() { return dist(gen); });
+      to_device(h_inserts);
+      bucket.insert(d_inserts.begin(), d_inserts.end());
+      h_expected.insert(h_expected.end(), h_inserts.begin(), h_inserts.end());
+      check();
+    }
+    bucket.insert(range_first);
+    h_expected.push_back(range_first);
+    check();
+
+    // 3. shrinking removes the largest vertices, they should be insertable again
+
+    auto removed_last = h_expected.back();
+    bucket.resize(h_expected.size() / 2);
+    h_expected.resize(h_expected.size() / 2);
+    check();
+    bucket.insert(removed_last);
+    h_expected.push_back(removed_last);
+    check();
+
+    // 4. clear and re-fill
+
+    bucket.clear();
+    h_expected.clear();
+    check();
+    h_inserts.resize(range_size);
+    std::generate(h_inserts.begin(), h_inserts.end(), [&]() { return dist(gen); });
+    to_device(h_inserts);
+    bucket.insert(d_inserts.begin(), d_inserts.end());
+    h_expected.insert(h_expected.end(), h_inserts.begin(), h_inserts.end());
+    check();
+
+    // 5. non-const access drops the bitmap, later insertions should still de-duplicate
+
+    bucket.begin();
+    bucket.insert(d_inserts.begin(), d_inserts.end());
+    check();
+  }
+};
+
+TEST_F(Tests_VertexFrontierBucket, CheckInt32)
+{
+  run_current_test<int32_t>(int32_t{100}, int32_t{10100});
+}
+
+TEST_F(Tests_VertexFrontierBucket, CheckInt64)
+{
+  run_current_test<int64_t>(int64_t{1} << 33, (int64_t{1} << 33) + 4099);
+}
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -23,11 +23,13 @@
 #include <raft/comms/comms.hpp>
 #include <raft/comms/mpi_comms.hpp>
 
+#include <thrust/distance.h>
 #include <thrust/equal.h>
 #include <thrust/fill.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/sort.h>
 #include <thrust/tuple.h>
+#include <thrust/unique.h>
 
 #include <gtest/gtest.h>
 
@@ -95,10 +97,23 @@ class Tests_MG_GatherEdges
                                                 source_sample_count),
                                        repetitions_per_vertex);
 
-    // FIXME: allgather is probably a poor name for this function.
-    //        It's really an allgather across the row communicator
-    auto active_sources =
-      cugraph::detail::allgather_active_majors(*handle_, std::move(random_sources));
+    thrust::sort(handle_->get_thrust_policy(), random_sources.begin(), random_sources.end());
+    random_sources.resize(
+      thrust::distance(
+        random_sources.begin(),
+        thrust::unique(handle_->get_thrust_policy(), random_sources.begin(), random_sources.end())),
+      handle_->get_stream());
+
+    // send every source only to the gpus storing (a part of) its adjacency list
+    auto vertex_partition_degree_offsets = cugraph::detail::get_vertex_partition_degree_offsets(
+      *handle_, mg_graph_view, global_degree_offsets, global_out_degrees);
+    rmm::device_uvector<vertex_t> local_sources(random_sources.size(), handle_->get_stream());
+    raft::copy(local_sources.data(),
+               random_sources.data(),
+               random_sources.size(),
+               handle_->get_stream());
+    auto active_sources = cugraph::detail::shuffle_active_majors_to_edge_partitions(
+      *handle_, mg_graph_view, std::move(random_sources), vertex_partition_degree_offsets);
 
     auto [src, dst, edge_ids] =
       cugraph::detail::gather_one_hop_edgelist(*handle_, mg_graph_view, active_sources);
@@ -111,12 +126,8 @@ class Tests_MG_GatherEdges
         *handle_, raft::device_span<vertex_t const>{dst.data(), dst.size()});
 
       // Gather relevant edges from graph
-      auto& col_comm      = handle_->get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
-      auto const col_rank = col_comm.get_rank();
       auto all_active_sources = cugraph::test::device_allgatherv(
-        *handle_,
-        raft::device_span<vertex_t const>{active_sources.data(),
-                                          col_rank == 0 ? active_sources.size() : 0});
+        *handle_, raft::device_span<vertex_t const>{local_sources.data(), local_sources.size()});
 
       thrust::sort(
         handle_->get_thrust_policy(), all_active_sources.begin(), all_active_sources.end());
@@ -42,11 +42,9 @@ std::tuple<std::vector<vertex_t>, std::vector<vertex_t>> test_gather_local_edges
   cugraph::graph_view_t<vertex_t, edge_t, weight_t, false, true> const& mg_graph_view,
   rmm::device_uvector<vertex_t> const& sources,
   rmm::device_uvector<edge_t> const& destination_offsets,
-  edge_t indices_per_source)
+  edge_t indices_per_source,
+  rmm::device_uvector<edge_t> const& vertex_partition_degree_offsets)
 {
-  auto& col_comm      = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
-  auto const col_rank = col_comm.get_rank();
-
   // logic relies on gather_one_hop not having duplicates
   rmm::device_uvector<vertex_t> sources_copy(sources.size(), handle.get_stream());
   raft::copy(sources_copy.data(), sources.data(), sources.size(), handle.get_stream());
@@ -55,9 +53,11 @@ std::tuple<std::vector<vertex_t>, std::vector<vertex_t>> test_gather_local_edges
     thrust::unique(handle.get_thrust_policy(), sources_copy.begin(), sources_copy.end());
   sources_copy.resize(thrust::distance(sources_copy.begin(), sources_copy_end),
                       handle.get_stream());
+  auto active_sources = cugraph::detail::shuffle_active_majors_to_edge_partitions(
+    handle, mg_graph_view, std::move(sources_copy), vertex_partition_degree_offsets);
 
   auto [one_hop_src, one_hop_dst, one_hop_edge_ids] =
-    cugraph::detail::gather_one_hop_edgelist(handle, mg_graph_view, sources_copy);
+    cugraph::detail::gather_one_hop_edgelist(handle, mg_graph_view, active_sources);
 
   rmm::device_uvector<int> one_hop_gpu_id(one_hop_src.size(), handle.get_stream());
   thrust::fill(handle.get_thrust_policy(),
@@ -73,11 +73,10 @@ std::tuple<std::vector<vertex_t>, std::vector<vertex_t>> test_gather_local_edges
   auto sg_gpu_id = cugraph::test::device_gatherv(
     handle, raft::device_span<int const>{one_hop_gpu_id.data(), one_hop_gpu_id.size()});
   auto sg_sources = cugraph::test::device_gatherv(
-    handle, raft::device_span<vertex_t const>{sources.data(), col_rank == 0 ? sources.size() : 0});
+    handle, raft::device_span<vertex_t const>{sources.data(), sources.size()});
   auto sg_destination_offsets = cugraph::test::device_gatherv(
     handle,
-    raft::device_span<edge_t const>{destination_offsets.data(),
-                                    col_rank == 0 ? destination_offsets.size() : 0});
+    raft::device_span<edge_t const>{destination_offsets.data(), destination_offsets.size()});
 
   thrust::sort(handle.get_thrust_policy(),
                thrust::make_zip_iterator(sg_src.begin(), sg_gpu_id.begin(), sg_dst.begin()),
@@ -193,22 +192,24 @@ class Tests_MG_GatherEdges
                                                 source_sample_count),
                                        repetitions_per_vertex);
 
-    // FIXME: allgather is probably a poor name for this function.
-    //        It's really an allgather across the row communicator
-    auto active_sources =
-      cugraph::detail::allgather_active_majors(*handle_, std::move(random_sources));
-
-    // get source global out degrees to generate indices
-    auto active_source_degrees = cugraph::detail::get_active_major_global_degrees(
-      *handle_, mg_graph_view, active_sources, global_out_degrees);
+    // get source global out degrees to generate indices, the sources are owned by current gpu
+    auto vertex_partition_degree_offsets = cugraph::detail::get_vertex_partition_degree_offsets(
+      *handle_, mg_graph_view, global_degree_offsets, global_out_degrees);
+    auto random_source_degrees = cugraph::detail::get_vertex_partition_global_degrees(
+      *handle_, mg_graph_view, random_sources, vertex_partition_degree_offsets);
 
     auto random_destination_offsets =
       cugraph::test::generate_random_destination_indices(*handle_,
-                                                         active_source_degrees,
+                                                         random_source_degrees,
                                                          mg_graph_view.number_of_vertices(),
                                                          edge_t{-1},
                                                          indices_per_source);
 
+    rmm::device_uvector<vertex_t> input_sources(random_sources.size(), handle_->get_stream());
+    raft::copy(input_sources.data(),
+               random_sources.data(),
+               random_sources.size(),
+               handle_->get_stream());
     rmm::device_uvector<edge_t> input_destination_offsets(random_destination_offsets.size(),
                                                           handle_->get_stream());
     raft::copy(input_destination_offsets.data(),
@@ -216,19 +217,33 @@ class Tests_MG_GatherEdges
                random_destination_offsets.size(),
                handle_->get_stream());
 
+    // route every sampled index to the gpu storing the selected edge
+    auto [active_sources, active_destination_offsets] =
+      cugraph::detail::shuffle_sampled_indices_to_edge_partitions(
+        *handle_,
+        mg_graph_view,
+        std::move(random_sources),
+        std::move(random_destination_offsets),
+        indices_per_source,
+        vertex_partition_degree_offsets);
+
     auto [src, dst, dst_map] =
       cugraph::detail::gather_local_edges(*handle_,
                                           mg_graph_view,
                                           active_sources,
-                                          std::move(random_destination_offsets),
-                                          indices_per_source,
+                                          std::move(active_destination_offsets),
+                                          edge_t{1},
                                           global_degree_offsets);
 
     if (prims_usecase.check_correctness) {
       // NOTE: This test assumes that edgea within the data structure are sorted
       //  We'll use gather_one_hop_edgelist to pull out the relevant edges
-      auto [h_src, h_dst] = test_gather_local_edges(
-        *handle_, mg_graph_view, active_sources, input_destination_offsets, indices_per_source);
+      auto [h_src, h_dst] = test_gather_local_edges(*handle_,
+                                                    mg_graph_view,
+                                                    input_sources,
+                                                    input_destination_offsets,
+                                                    indices_per_source,
+                                                    vertex_partition_degree_offsets);
 
       auto agg_src = cugraph::test::device_gatherv(
         *handle_, raft::device_span<vertex_t const>{src.data(), src.size()});
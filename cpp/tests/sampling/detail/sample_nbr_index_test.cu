@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sampling/detail/graph_functions.hpp>
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <raft/span.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <vector>
+
+namespace {
+
+// non-zero degrees covering every sampling path for a fan-out of 4: 1-3 (all neighbors + padding),
+// 4 (degree == fan-out), 5 (Floyd's algorithm with the largest collision chance), and large degrees
+template <typename edge_t>
+std::vector<edge_t> test_degrees()
+{
+  return std::vector<edge_t>{1, 4, 5, 17, 3, 1000, 2, 100000};
+}
+
+template <typename edge_t>
+std::vector<edge_t> sample_nbr_index(raft::handle_t const& handle,
+                                     std::vector<edge_t> const& h_out_degrees,
+                                     edge_t indices_per_major,
+                                     bool with_replacement,
+                                     uint64_t seed)
+{
+  rmm::device_uvector<edge_t> d_out_degrees(h_out_degrees.size(), handle.get_stream());
+  raft::update_device(
+    d_out_degrees.data(), h_out_degrees.data(), h_out_degrees.size(), handle.get_stream());
+
+  auto d_indices = cugraph::detail::sample_nbr_index(
+    handle, d_out_degrees, indices_per_major, with_replacement, seed);
+
+  return cugraph::test::to_host(handle, d_indices);
+}
+
+}  // namespace
+
+struct SampleNbrIndexTest : public ::testing::Test {
+};
+
+TEST_F(SampleNbrIndexTest, WithoutReplacementUniqueInRange)
+{
+  using edge_t = int32_t;
+
+  raft::handle_t handle{};
+
+  edge_t constexpr fan_out = 4;
+  auto out_degrees         = test_degrees<edge_t>();
+
+  for (uint64_t seed = 0; seed < 16; ++seed) {
+    auto indices = sample_nbr_index(handle, out_degrees, fan_out, false, seed);
+    ASSERT_EQ(indices.size(), out_degrees.size() * fan_out);
+
+    for (size_t i = 0; i < out_degrees.size(); ++i) {
+      auto degree = out_degrees[i];
+      std::vector<edge_t> sampled(indices.begin() + i * fan_out,
+                                  indices.begin() + (i + 1) * fan_out);
+      if (degree <= fan_out) {
+        // every neighbor, then -1 padding
+        for (edge_t j = 0; j < fan_out; ++j) {
+          ASSERT_EQ(sampled[j], j < degree ? j : edge_t{-1})
+            << "seed=" << seed << " major=" << i << " degree=" << degree;
+        }
+      } else {
+        ASSERT_TRUE(std::all_of(sampled.begin(),
+                                sampled.end(),
+                                [degree](auto idx) { return (idx >= 0) && (idx < degree); }))
+          << "seed=" << seed << " major=" << i << " degree=" << degree;
+        std::sort(sampled.begin(), sampled.end());
+        ASSERT_TRUE(std::adjacent_find(sampled.begin(), sampled.end()) == sampled.end())
+          << "seed=" << seed << " major=" << i << " degree=" << degree;
+      }
+    }
+  }
+}
+
+TEST_F(SampleNbrIndexTest, WithoutReplacementCoversDegreeEqualsFanOutPlusOne)
+{
+  using edge_t = int64_t;
+
+  raft::handle_t handle{};
+
+  // with degree 5 and fan-out 4, each neighbor index should be left out in some samples
+  edge_t constexpr fan_out = 4;
+  edge_t constexpr degree  = 5;
+  std::vector<edge_t> out_degrees(1024, degree);
+
+  auto indices = sample_nbr_index(handle, out_degrees, fan_out, false, uint64_t{0});
+
+  std::vector<size_t> counts(degree, 0);
+  for (auto idx : indices) {
+    ASSERT_TRUE((idx >= 0) && (idx < degree));
+    ++counts[idx];
+  }
+  ASSERT_TRUE(std::all_of(
+    counts.begin(), counts.end(), [&out_degrees](auto c) { return c < out_degrees.size(); }));
+  ASSERT_EQ(std::accumulate(counts.begin(), counts.end(), size_t{0}),
+            out_degrees.size() * fan_out);
+}
+
+TEST_F(SampleNbrIndexTest, WithReplacementInRange)
+{
+  using edge_t = int32_t;
+
+  raft::handle_t handle{};
+
+  edge_t constexpr fan_out = 4;
+  auto out_degrees         = test_degrees<edge_t>();
+
+  for (uint64_t seed = 0; seed < 16; ++seed) {
+    auto indices = sample_nbr_index(handle, out_degrees, fan_out, true, seed);
+    ASSERT_EQ(indices.size(), out_degrees.size() * fan_out);
+
+    for (size_t i = 0; i < indices.size(); ++i) {
+      auto degree = out_degrees[i / fan_out];
+      ASSERT_TRUE((indices[i] >= 0) && (indices[i] < degree))
+        << "seed=" << seed << " major=" << i / fan_out << " degree=" << degree;
+    }
+  }
+}
+
+TEST_F(SampleNbrIndexTest, HostCSRWithoutReplacement)
+{
+  using vertex_t = int32_t;
+  using edge_t   = int32_t;
+  using weight_t = float;
+
+  // vertex 0 has degree 100 (Floyd's algorithm), 1 degree 6 (reservoir sampling), 2 degree 3 (all
+  // neighbors), and 3 is isolated, the neighbors of a vertex v are (v + j + 1) % num_vertices
+  vertex_t constexpr num_vertices = 128;
+  std::vector<edge_t> degrees(num_vertices, edge_t{0});
+  degrees[0] = 100;
+  degrees[1] = 6;
+  degrees[2] = 3;
+  std::vector<edge_t> offsets(num_vertices + 1, edge_t{0});
+  std::inclusive_scan(degrees.begin(), degrees.end(), offsets.begin() + 1);
+  std::vector<vertex_t> indices(offsets.back());
+  std::vector<weight_t> weights(indices.size());
+  for (vertex_t v = 0; v < num_vertices; ++v) {
+    for (edge_t j = 0; j < degrees[v]; ++j) {
+      indices[offsets[v] + j] = (v + j + 1) % num_vertices;
+      weights[offsets[v] + j] = static_cast<weight_t>(v * num_vertices + j);
+    }
+  }
+
+  std::vector<vertex_t> starting_vertices{0, 1, 2, 3};
+  std::vector<int> fan_out{4};
+
+  for (size_t num_threads : {size_t{1}, size_t{3}}) {
+    auto [srcs, dsts, wgts, counts] = cugraph::host_uniform_nbr_sample(
+      raft::host_span<edge_t const>(offsets.data(), offsets.size()),
+      raft::host_span<vertex_t const>(indices.data(), indices.size()),
+      std::make_optional<raft::host_span<weight_t const>>(weights.data(), weights.size()),
+      raft::host_span<vertex_t const>(starting_vertices.data(), starting_vertices.size()),
+      raft::host_span<int const>(fan_out.data(), fan_out.size()),
+      false,
+      uint64_t{0},
+      num_threads,
+      true);
+
+    // without replacement, every sampled edge is unique (count 1), min(degree, fan-out) per source
+
+    ASSERT_TRUE(std::all_of(counts.begin(), counts.end(), [](auto c) { return c == 1; }));
+    for (auto v : starting_vertices) {
+      auto num_sampled = std::count(srcs.begin(), srcs.end(), v);
+      ASSERT_EQ(num_sampled, std::min(degrees[v], static_cast<edge_t>(fan_out[0])))
+        << "num_threads=" << num_threads << " source=" << v;
+    }
+    for (size_t i = 0; i < srcs.size(); ++i) {
+      auto v = srcs[i];
+      auto j = (dsts[i] - v - 1 + num_vertices) % num_vertices;
+      ASSERT_TRUE((j >= 0) && (j < degrees[v]));
+      ASSERT_EQ(wgts[i], weights[offsets[v] + j]);
+    }
+  }
+}
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -87,15 +87,6 @@ class Tests_MGNbrSampling
 
     std::vector<int> h_fan_out{indices_per_source};  // depth = 1
 
-#ifdef NO_CUGRAPH_OPS
-    EXPECT_THROW(cugraph::uniform_nbr_sample(
-                   *handle_,
-                   mg_graph_view,
-                   raft::device_span<vertex_t>(random_sources.data(), random_sources.size()),
-                   raft::host_span<const int>(h_fan_out.data(), h_fan_out.size()),
-                   prims_usecase.flag_replacement),
-                 std::exception);
-#else
     auto&& [d_src_out, d_dst_out, d_indices, d_counts] = cugraph::uniform_nbr_sample(
       *handle_,
       mg_graph_view,
@@ -159,7 +150,6 @@ class Tests_MGNbrSampling
                                                h_fan_out.size());
       }
     }
-#endif
   }
 
  private:
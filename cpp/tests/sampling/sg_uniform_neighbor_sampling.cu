@@ -25,6 +25,7 @@
 struct Prims_Usecase {
   bool check_correctness{true};
   bool flag_replacement{true};
+  bool use_host_sampler{false};
 };
 
 template <typename input_usecase_t>
@@ -81,21 +82,20 @@ class Tests_Uniform_Neighbor_Sampling
 
     std::vector<int> h_fan_out{indices_per_source};  // depth = 1
 
-#ifdef NO_CUGRAPH_OPS
-    EXPECT_THROW(cugraph::uniform_nbr_sample(
-                   handle,
-                   graph_view,
-                   raft::device_span<vertex_t>(random_sources.data(), random_sources.size()),
-                   raft::host_span<const int>(h_fan_out.data(), h_fan_out.size()),
-                   prims_usecase.flag_replacement),
-                 std::exception);
-#else
-    auto&& [d_src_out, d_dst_out, d_indices, d_counts] = cugraph::uniform_nbr_sample(
-      handle,
-      graph_view,
-      raft::device_span<vertex_t>(random_sources.data(), random_sources.size()),
-      raft::host_span<const int>(h_fan_out.data(), h_fan_out.size()),
-      prims_usecase.flag_replacement);
+    auto&& [d_src_out, d_dst_out, d_indices, d_counts] =
+      prims_usecase.use_host_sampler
+        ? cugraph::host_uniform_nbr_sample(
+            handle,
+            graph_view,
+            raft::device_span<vertex_t const>(random_sources.data(), random_sources.size()),
+            raft::host_span<const int>(h_fan_out.data(), h_fan_out.size()),
+            prims_usecase.flag_replacement)
+        : cugraph::uniform_nbr_sample(
+            handle,
+            graph_view,
+            raft::device_span<vertex_t>(random_sources.data(), random_sources.size()),
+            raft::host_span<const int>(h_fan_out.data(), h_fan_out.size()),
+            prims_usecase.flag_replacement);
 
     if (prims_usecase.check_correctness) {
       //  First validate that the extracted edges are actually a subset of the
@@ -137,7 +137,6 @@ class Tests_Uniform_Neighbor_Sampling
                                              std::move(random_sources),
                                              h_fan_out.size());
     }
-#endif
   }
 };
 
@@ -187,7 +186,10 @@ INSTANTIATE_TEST_SUITE_P(
   file_test,
   Tests_Uniform_Neighbor_Sampling_File,
   ::testing::Combine(
-    ::testing::Values(Prims_Usecase{true, true}, Prims_Usecase{true, false}),
+    ::testing::Values(Prims_Usecase{true, true},
+                      Prims_Usecase{true, false},
+                      Prims_Usecase{true, true, true},
+                      Prims_Usecase{true, false, true}),
     ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
                       cugraph::test::File_Usecase("test/datasets/web-Google.mtx"),
                       cugraph::test::File_Usecase("test/datasets/ljournal-2008.mtx"),
@@ -177,3 +177,72 @@ TEST(SerializationTest, UnweightedGraphDecoupledSerUnser)
     ASSERT_TRUE(pair.first);
   }
 }
+
+TEST(SerializationTest, DerivedAttributesSerUnser)
+{
+  using namespace cugraph::serializer;
+
+  using vertex_t = int32_t;
+  using edge_t   = vertex_t;
+  using weight_t = float;
+
+  raft::handle_t handle{};
+
+  edge_t num_edges      = 8;
+  vertex_t num_vertices = 6;
+
+  std::vector<vertex_t> v_src{0, 1, 1, 2, 2, 2, 3, 4};
+  std::vector<vertex_t> v_dst{1, 3, 4, 0, 1, 3, 5, 5};
+  std::vector<weight_t> v_w{0.1, 1.1, 2.1, 3.1, 4.1, 5.1, 6.1, 7.1};
+
+  auto graph = cugraph::test::make_graph(
+    handle, v_src, v_dst, std::optional<std::vector<weight_t>>{v_w}, num_vertices, num_edges);
+
+  // cache only some of the derived attributes, only those are serialized
+
+  auto in_degrees      = graph.in_degrees(handle);
+  auto out_weight_sums = graph.out_weight_sums(handle);
+
+  auto pair_sz       = serializer_t::get_device_graph_sz_bytes(graph);
+  auto attributes_sz = serializer_t::get_device_derived_attributes_sz_bytes(graph);
+  EXPECT_EQ(attributes_sz,
+            4 * sizeof(serializer_t::graph_meta_t<decltype(graph)>::bool_ser_t) +
+              num_vertices * (sizeof(edge_t) + sizeof(weight_t)));
+
+  serializer_t ser(handle, pair_sz.first + pair_sz.second + attributes_sz);
+  serializer_t::graph_meta_t<decltype(graph)> graph_meta{};
+  ser.serialize(graph, graph_meta);
+  ser.serialize_derived_attributes(graph);
+
+  serializer_t unser(handle, ser.get_storage());
+  auto graph_copy = unser.unserialize<decltype(graph)>(pair_sz.first, pair_sz.second);
+  unser.unserialize_derived_attributes(graph_copy);
+
+  auto pair = cugraph::test::compare_graphs(handle, graph, graph_copy);
+  if (pair.first == false) std::cerr << "Test failed with " << pair.second << ".\n";
+  ASSERT_TRUE(pair.first);
+
+  auto h_in_degrees = cugraph::test::to_host(handle, in_degrees.data(), in_degrees.size());
+  auto h_out_weight_sums =
+    cugraph::test::to_host(handle, out_weight_sums.data(), out_weight_sums.size());
+
+  auto copy_in_degrees      = graph_copy.in_degrees(handle);
+  auto copy_out_weight_sums = graph_copy.out_weight_sums(handle);
+  auto h_copy_in_degrees =
+    cugraph::test::to_host(handle, copy_in_degrees.data(), copy_in_degrees.size());
+  auto h_copy_out_weight_sums =
+    cugraph::test::to_host(handle, copy_out_weight_sums.data(), copy_out_weight_sums.size());
+
+  ASSERT_TRUE(h_in_degrees == h_copy_in_degrees)
+    << "Unserialized in-degrees do not match with the serialized values.";
+  ASSERT_TRUE(h_out_weight_sums == h_copy_out_weight_sums)
+    << "Unserialized out-weight-sums do not match with the serialized values.";
+
+  // the attributes not serialized are computed on first use
+
+  auto out_degrees      = graph.out_degrees(handle);
+  auto copy_out_degrees = graph_copy.out_degrees(handle);
+  ASSERT_TRUE(cugraph::test::to_host(handle, out_degrees.data(), out_degrees.size()) ==
+              cugraph::test::to_host(handle, copy_out_degrees.data(), copy_out_degrees.size()))
+    << "Out-degrees of the unserialized graph do not match with the original graph.";
+}
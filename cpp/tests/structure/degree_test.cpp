@@ -142,6 +142,35 @@ class Tests_Degree : public ::testing::TestWithParam<Degree_Usecase> {
                            h_reference_out_degrees.end(),
                            h_cugraph_out_degrees.begin()))
       << "Out-degree values do not match with the reference values.";
+
+    auto cached_in_degrees  = graph.in_degrees(handle);
+    auto cached_out_degrees = graph.out_degrees(handle);
+
+    ASSERT_EQ(graph.in_degrees(handle).data(), cached_in_degrees.data())
+      << "Cached in-degrees are recomputed on the second access.";
+    ASSERT_EQ(graph.out_degrees(handle).data(), cached_out_degrees.data())
+      << "Cached out-degrees are recomputed on the second access.";
+
+    raft::update_host(h_cugraph_in_degrees.data(),
+                      cached_in_degrees.data(),
+                      cached_in_degrees.size(),
+                      handle.get_stream());
+    raft::update_host(h_cugraph_out_degrees.data(),
+                      cached_out_degrees.data(),
+                      cached_out_degrees.size(),
+                      handle.get_stream());
+    handle.sync_stream();
+
+    ASSERT_TRUE(std::equal(
+      h_reference_in_degrees.begin(), h_reference_in_degrees.end(), h_cugraph_in_degrees.begin()))
+      << "Cached in-degree values do not match with the reference values.";
+    ASSERT_TRUE(std::equal(h_reference_out_degrees.begin(),
+                           h_reference_out_degrees.end(),
+                           h_cugraph_out_degrees.begin()))
+      << "Cached out-degree values do not match with the reference values.";
+    ASSERT_EQ(graph.max_in_degree(handle),
+              *std::max_element(h_reference_in_degrees.begin(), h_reference_in_degrees.end()))
+      << "Cached maximum in-degree does not match with the reference value.";
   }
 };
 
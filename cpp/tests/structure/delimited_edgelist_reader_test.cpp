@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/delimited_edgelist_reader.hpp>
+#include <cugraph/graph.hpp>
+
+#include <raft/handle.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::string write_temp_file(std::string const& name, std::string const& contents)
+{
+  auto file_path = ::testing::TempDir() + name;
+  std::ofstream file(file_path, std::ios::binary);
+  file << contents;
+  return file_path;
+}
+
+}  // namespace
+
+TEST(DelimitedEdgelistReader, IntegerIdsWithWeights)
+{
+  auto file_path =
+    write_temp_file("integer_ids.txt", "% comment\n1 0 1.5\n2  0\t2.5\n\n# comment\n3 2 -1\n");
+
+  auto edgelist = cugraph::read_delimited_edgelist<int32_t, float>(file_path);
+  std::remove(file_path.c_str());
+
+  ASSERT_EQ(edgelist.srcs, (std::vector<int32_t>{1, 2, 3}));
+  ASSERT_EQ(edgelist.dsts, (std::vector<int32_t>{0, 0, 2}));
+  ASSERT_TRUE(edgelist.weights.has_value());
+  ASSERT_EQ(*(edgelist.weights), (std::vector<float>{1.5, 2.5, -1.0}));
+  ASSERT_FALSE(edgelist.vertex_labels.has_value());
+  ASSERT_TRUE(edgelist.extra_columns.empty());
+}
+
+TEST(DelimitedEdgelistReader, StringIdsWithHeaderAndExtraColumn)
+{
+  auto file_path = write_temp_file("string_ids.csv",
+                                   "\"idx\",\"srcip\",\"dstip\"\r\n"
+                                   "0,\"59.166.0.0\",\"149.171.126.6\"\r\n"
+                                   "1,\"59.166.0.0\",\"149.171.126.9\"\r\n"
+                                   "2,\"149.171.126.9\",\"59.166.0.0\"\r\n");
+
+  cugraph::delimited_edgelist_options_t options{};
+  options.header        = true;
+  options.src_column    = 1;
+  options.dst_column    = 2;
+  options.weight_column = std::nullopt;
+
+  auto edgelist = cugraph::read_delimited_edgelist<int32_t, float>(file_path, options);
+  std::remove(file_path.c_str());
+
+  ASSERT_TRUE(edgelist.column_names.has_value());
+  ASSERT_EQ(*(edgelist.column_names), (std::vector<std::string>{"idx", "srcip", "dstip"}));
+  ASSERT_TRUE(edgelist.vertex_labels.has_value());
+  ASSERT_EQ(*(edgelist.vertex_labels),
+            (std::vector<std::string>{"59.166.0.0", "149.171.126.6", "149.171.126.9"}));
+  ASSERT_EQ(edgelist.srcs, (std::vector<int32_t>{0, 0, 2}));
+  ASSERT_EQ(edgelist.dsts, (std::vector<int32_t>{1, 2, 0}));
+  ASSERT_FALSE(edgelist.weights.has_value());
+  ASSERT_EQ(edgelist.extra_column_indices, (std::vector<size_t>{0}));
+  ASSERT_EQ(edgelist.extra_columns.size(), size_t{1});
+  ASSERT_EQ(edgelist.extra_columns[0], (std::vector<std::string>{"0", "1", "2"}));
+}
+
+TEST(DelimitedEdgelistReader, ParallelParseMatchesFileOrder)
+{
+  size_t constexpr num_edges{300000};  // large enough to be split between multiple threads
+
+  std::string contents{};
+  std::vector<int64_t> h_srcs(num_edges);
+  std::vector<int64_t> h_dsts(num_edges);
+  for (size_t i = 0; i < num_edges; ++i) {
+    h_srcs[i] = static_cast<int64_t>(i % 1000);
+    h_dsts[i] = static_cast<int64_t>((i * 7919) % 100000);
+    contents += std::to_string(h_srcs[i]) + "\t" + std::to_string(h_dsts[i]) + "\n";
+  }
+  auto file_path = write_temp_file("parallel.tsv", contents);
+
+  cugraph::delimited_edgelist_options_t options{};
+  options.num_threads = 4;
+
+  auto edgelist = cugraph::read_delimited_edgelist<int64_t, double>(file_path, options);
+
+  ASSERT_EQ(edgelist.srcs, h_srcs);
+  ASSERT_EQ(edgelist.dsts, h_dsts);
+  ASSERT_FALSE(edgelist.weights.has_value());
+
+  raft::handle_t handle{};
+
+  auto [graph, renumber_map, vertex_labels] =
+    cugraph::create_graph_from_delimited_edgelist_file<int64_t, int64_t, double, false>(
+      handle, file_path, options, cugraph::graph_properties_t{false, true}, true, true);
+  std::remove(file_path.c_str());
+
+  ASSERT_EQ(graph.number_of_edges(), static_cast<int64_t>(num_edges));
+  ASSERT_TRUE(renumber_map.has_value());
+  ASSERT_FALSE(vertex_labels.has_value());
+}
+
+CUGRAPH_TEST_PROGRAM_MAIN()
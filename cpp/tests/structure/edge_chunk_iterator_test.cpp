@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/edge_chunk_iterator.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+typedef struct EdgeChunkIterator_Usecase_t {
+  std::string graph_file_full_path{};
+  size_t max_chunk_size{};
+  bool test_weighted{false};
+  bool renumber{false};
+
+  EdgeChunkIterator_Usecase_t(std::string const& graph_file_path,
+                              size_t max_chunk_size,
+                              bool test_weighted,
+                              bool renumber)
+    : max_chunk_size(max_chunk_size), test_weighted(test_weighted), renumber(renumber)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} EdgeChunkIterator_Usecase;
+
+class Tests_EdgeChunkIterator : public ::testing::TestWithParam<EdgeChunkIterator_Usecase> {
+ public:
+  Tests_EdgeChunkIterator() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(EdgeChunkIterator_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, false> graph(handle);
+    std::optional<rmm::device_uvector<vertex_t>> d_renumber_map_labels{std::nullopt};
+    std::tie(graph, d_renumber_map_labels) = cugraph::test::
+      read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, store_transposed, false>(
+        handle,
+        configuration.graph_file_full_path,
+        configuration.test_weighted,
+        configuration.renumber);
+    auto graph_view = graph.view();
+
+    std::vector<vertex_t> h_chunk_srcs{};
+    std::vector<vertex_t> h_chunk_dsts{};
+    std::vector<weight_t> h_chunk_weights{};
+
+    cugraph::edge_chunk_iterator_t<vertex_t, edge_t, weight_t, store_transposed> edge_chunks(
+      handle,
+      graph_view,
+      d_renumber_map_labels ? std::make_optional<raft::device_span<vertex_t const>>(
+                                (*d_renumber_map_labels).data(), (*d_renumber_map_labels).size())
+                            : std::nullopt,
+      configuration.max_chunk_size);
+
+    size_t num_chunks{0};
+    while (auto chunk = edge_chunks.next()) {
+      auto [srcs, dsts, weights] = *chunk;
+      ASSERT_TRUE(srcs.size() <= configuration.max_chunk_size) << "Chunk size exceeds the limit.";
+      ASSERT_EQ(weights.has_value(), graph_view.is_weighted());
+
+      auto h_srcs = cugraph::test::to_host(handle, srcs.data(), srcs.size());
+      auto h_dsts = cugraph::test::to_host(handle, dsts.data(), dsts.size());
+      h_chunk_srcs.insert(h_chunk_srcs.end(), h_srcs.begin(), h_srcs.end());
+      h_chunk_dsts.insert(h_chunk_dsts.end(), h_dsts.begin(), h_dsts.end());
+      if (weights) {
+        auto h_weights = cugraph::test::to_host(handle, (*weights).data(), (*weights).size());
+        h_chunk_weights.insert(h_chunk_weights.end(), h_weights.begin(), h_weights.end());
+      }
+      ++num_chunks;
+    }
+    ASSERT_EQ(num_chunks, edge_chunks.num_chunks());
+
+    // destroy an iterator while the chunk after the returned one is still being decompressed
+
+    {
+      cugraph::edge_chunk_iterator_t<vertex_t, edge_t, weight_t, store_transposed>
+        abandoned_edge_chunks(handle, graph_view, std::nullopt, configuration.max_chunk_size);
+      abandoned_edge_chunks.next();
+    }
+
+    auto [d_srcs, d_dsts, d_weights] =
+      graph.decompress_to_edgelist(handle, d_renumber_map_labels, false);
+
+    auto h_srcs = cugraph::test::to_host(handle, d_srcs.data(), d_srcs.size());
+    auto h_dsts = cugraph::test::to_host(handle, d_dsts.data(), d_dsts.size());
+
+    ASSERT_TRUE(h_chunk_srcs == h_srcs) << "Chunked sources do not match with the edge list.";
+    ASSERT_TRUE(h_chunk_dsts == h_dsts) << "Chunked destinations do not match with the edge list.";
+    if (d_weights) {
+      auto h_weights = cugraph::test::to_host(handle, (*d_weights).data(), (*d_weights).size());
+      ASSERT_TRUE(h_chunk_weights == h_weights)
+        << "Chunked weights do not match with the edge list.";
+    }
+  }
+};
+
+TEST_P(Tests_EdgeChunkIterator, CheckInt32Int32FloatTransposeFalse)
+{
+  run_current_test<int32_t, int32_t, float, false>(GetParam());
+}
+
+TEST_P(Tests_EdgeChunkIterator, CheckInt32Int32FloatTransposeTrue)
+{
+  run_current_test<int32_t, int32_t, float, true>(GetParam());
+}
+
+TEST_P(Tests_EdgeChunkIterator, CheckInt64Int64FloatTransposeFalse)
+{
+  run_current_test<int64_t, int64_t, float, false>(GetParam());
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  simple_test,
+  Tests_EdgeChunkIterator,
+  ::testing::Values(
+    EdgeChunkIterator_Usecase("test/datasets/karate.mtx", 1, false, false),
+    EdgeChunkIterator_Usecase("test/datasets/karate.mtx", 7, true, false),
+    EdgeChunkIterator_Usecase("test/datasets/karate.mtx", 1024, true, true),
+    EdgeChunkIterator_Usecase("test/datasets/web-Google.mtx", 100000, false, true),
+    EdgeChunkIterator_Usecase("test/datasets/web-Google.mtx", 1 << 20, true, true)));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/high_res_clock.h>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+struct HasEdges_Usecase {
+  size_t num_random_queries{1000};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_HasEdges
+  : public ::testing::TestWithParam<std::tuple<HasEdges_Usecase, input_usecase_t>> {
+ public:
+  Tests_HasEdges() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(HasEdges_Usecase const& has_edges_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    constexpr bool renumber = true;
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, store_transposed, false>(
+        handle, input_usecase, true, renumber);
+    auto graph_view = graph.view();
+
+    // queries in external (unrenumbered) vertex IDs: every edge and random vertex pairs
+
+    auto [unrenumbered_graph, unused_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, store_transposed, false>(
+        handle, input_usecase, true, false);
+    auto unrenumbered_graph_view = unrenumbered_graph.view();
+
+    auto num_vertices = unrenumbered_graph_view.number_of_vertices();
+    auto h_offsets    = cugraph::test::to_host(
+      handle, unrenumbered_graph_view.local_edge_partition_view().offsets(), num_vertices + 1);
+    auto h_indices = cugraph::test::to_host(
+      handle,
+      unrenumbered_graph_view.local_edge_partition_view().indices(),
+      unrenumbered_graph_view.number_of_edges());
+    auto h_weights = cugraph::test::to_host(
+      handle,
+      *(unrenumbered_graph_view.local_edge_partition_view().weights()),
+      unrenumbered_graph_view.number_of_edges());
+
+    // (major, minor) => weights of the (multi-)edges
+    std::map<std::pair<vertex_t, vertex_t>, std::vector<weight_t>> h_reference_edges{};
+    std::vector<vertex_t> h_srcs{};
+    std::vector<vertex_t> h_dsts{};
+    for (vertex_t major = 0; major < num_vertices; ++major) {
+      for (edge_t i = h_offsets[major]; i < h_offsets[major + 1]; ++i) {
+        h_reference_edges[std::make_pair(major, h_indices[i])].push_back(h_weights[i]);
+        h_srcs.push_back(store_transposed ? h_indices[i] : major);
+        h_dsts.push_back(store_transposed ? major : h_indices[i]);
+      }
+    }
+    std::mt19937 gen{0};
+    std::uniform_int_distribution<vertex_t> distribution(0, num_vertices - 1);
+    for (size_t i = 0; i < has_edges_usecase.num_random_queries; ++i) {
+      h_srcs.push_back(distribution(gen));
+      h_dsts.push_back(distribution(gen));
+    }
+
+    rmm::device_uvector<vertex_t> d_srcs(h_srcs.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_dsts(h_dsts.size(), handle.get_stream());
+    raft::update_device(d_srcs.data(), h_srcs.data(), h_srcs.size(), handle.get_stream());
+    raft::update_device(d_dsts.data(), h_dsts.data(), h_dsts.size(), handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto d_has_edges = graph_view.has_edges(
+      handle,
+      raft::device_span<vertex_t const>(d_srcs.data(), d_srcs.size()),
+      raft::device_span<vertex_t const>(d_dsts.data(), d_dsts.size()),
+      d_renumber_map_labels,
+      true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "has_edges took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    auto d_edge_weights = graph_view.lookup_edge_weights(
+      handle,
+      raft::device_span<vertex_t const>(d_srcs.data(), d_srcs.size()),
+      raft::device_span<vertex_t const>(d_dsts.data(), d_dsts.size()),
+      d_renumber_map_labels,
+      true);
+
+    if (has_edges_usecase.check_correctness) {
+      std::vector<uint8_t> h_has_edges(d_has_edges.size());
+      std::vector<weight_t> h_edge_weights(d_edge_weights.size());
+      raft::update_host(reinterpret_cast<bool*>(h_has_edges.data()),
+                        d_has_edges.data(),
+                        d_has_edges.size(),
+                        handle.get_stream());
+      raft::update_host(
+        h_edge_weights.data(), d_edge_weights.data(), d_edge_weights.size(), handle.get_stream());
+      handle.sync_stream();
+
+      for (size_t i = 0; i < h_srcs.size(); ++i) {
+        auto it = h_reference_edges.find(store_transposed ? std::make_pair(h_dsts[i], h_srcs[i])
+                                                          : std::make_pair(h_srcs[i], h_dsts[i]));
+        if (it != h_reference_edges.end()) {
+          ASSERT_TRUE(h_has_edges[i]) << "edge (" << h_srcs[i] << ", " << h_dsts[i]
+                                      << ") exists but is not found.";
+          ASSERT_TRUE(std::find((*it).second.begin(), (*it).second.end(), h_edge_weights[i]) !=
+                      (*it).second.end())
+            << "edge (" << h_srcs[i] << ", " << h_dsts[i] << ") weight does not match.";
+        } else {
+          ASSERT_FALSE(h_has_edges[i])
+            << "edge (" << h_srcs[i] << ", " << h_dsts[i] << ") does not exist but is found.";
+          ASSERT_EQ(h_edge_weights[i], std::numeric_limits<weight_t>::max())
+            << "edge (" << h_srcs[i] << ", " << h_dsts[i] << ") does not exist but has a weight.";
+        }
+      }
+    }
+  }
+};
+
+using Tests_HasEdges_File = Tests_HasEdges<cugraph::test::File_Usecase>;
+using Tests_HasEdges_Rmat = Tests_HasEdges<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_HasEdges_File, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_HasEdges_File, CheckInt32Int32FloatTransposeTrue)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, true>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_HasEdges_Rmat, CheckInt32Int32FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_HasEdges_Rmat, CheckInt64Int64FloatTransposeFalse)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float, false>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_HasEdges_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(HasEdges_Usecase{}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_HasEdges_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(HasEdges_Usecase{}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_HasEdges_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(HasEdges_Usecase{size_t{1} << 24, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/graph.hpp>
+#include <cugraph/utilities/memory_tracking.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/mr/host/new_delete_resource.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <optional>
+
+class Tests_MemoryTracking : public ::testing::Test {
+ public:
+  Tests_MemoryTracking() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() { upstream_ = rmm::mr::get_current_device_resource(); }
+  virtual void TearDown() { rmm::mr::set_current_device_resource(upstream_); }
+
+ protected:
+  rmm::mr::device_memory_resource* upstream_{nullptr};
+};
+
+TEST_F(Tests_MemoryTracking, DevicePhases)
+{
+  cugraph::phase_tracking_resource_adaptor<rmm::mr::device_memory_resource> mr(upstream_);
+  rmm::mr::set_current_device_resource(&mr);
+
+  raft::handle_t handle{};
+
+  {
+    cugraph::memory_phase_range_t outer("test/outer");
+    rmm::device_uvector<int32_t> a(1024, handle.get_stream());
+    {
+      cugraph::memory_phase_range_t inner("test/inner");
+      rmm::device_uvector<int32_t> b(2048, handle.get_stream());
+      rmm::device_uvector<int32_t> c(2048, handle.get_stream());
+    }
+    rmm::device_uvector<int32_t> d(512, handle.get_stream());
+  }
+  handle.sync_stream();
+
+  auto stats = mr.tracker().phase_stats();
+  ASSERT_EQ(stats.count("test/outer"), size_t{1});
+  ASSERT_EQ(stats.count("test/inner"), size_t{1});
+
+  auto const& outer = stats["test/outer"];
+  EXPECT_EQ(outer.num_allocations, size_t{2});
+  EXPECT_EQ(outer.num_deallocations, size_t{2});
+  EXPECT_EQ(outer.current_bytes, size_t{0});
+  EXPECT_EQ(outer.peak_bytes, (1024 + 512) * sizeof(int32_t));
+
+  auto const& inner = stats["test/inner"];
+  EXPECT_EQ(inner.num_allocations, size_t{2});
+  EXPECT_EQ(inner.current_bytes, size_t{0});
+  EXPECT_EQ(inner.peak_bytes, 2 * 2048 * sizeof(int32_t));
+
+  auto total = mr.tracker().total_stats();
+  EXPECT_EQ(total.peak_bytes, (1024 + 2 * 2048) * sizeof(int32_t));
+  EXPECT_EQ(total.current_bytes, size_t{0});
+}
+
+TEST_F(Tests_MemoryTracking, OutOfOrderPhases)
+{
+  // a range held in a std::optional (as Louvain does) can end before a range started after it
+  std::optional<cugraph::memory_phase_range_t> outer{};
+  outer.emplace("test/outer");
+  {
+    cugraph::memory_phase_range_t inner("test/inner");
+    outer.reset();
+    EXPECT_EQ(cugraph::current_memory_phase(), std::string("test/inner"));
+    outer.emplace("test/outer2");
+    EXPECT_EQ(cugraph::current_memory_phase(), std::string("test/outer2"));
+  }
+  EXPECT_EQ(cugraph::current_memory_phase(), std::string("test/outer2"));
+  outer.reset();
+  EXPECT_TRUE(cugraph::current_memory_phase().empty());
+}
+
+TEST_F(Tests_MemoryTracking, RenumberPhases)
+{
+  cugraph::phase_tracking_resource_adaptor<rmm::mr::device_memory_resource> mr(upstream_);
+  rmm::mr::set_current_device_resource(&mr);
+
+  raft::handle_t handle{};
+
+  {
+    auto [graph, renumber_map] =
+      cugraph::test::construct_graph<int32_t, int32_t, float, false, false>(
+        handle, cugraph::test::File_Usecase("test/datasets/karate.mtx"), false, true);
+  }
+  handle.sync_stream();
+
+  auto stats = mr.tracker().phase_stats();
+  ASSERT_EQ(stats.count("renumber/compute_map"), size_t{1});
+  ASSERT_EQ(stats.count("renumber/hash_build"), size_t{1});
+  EXPECT_GT(stats["renumber/compute_map"].peak_bytes, size_t{0});
+  EXPECT_GT(stats["renumber/hash_build"].num_allocations, size_t{0});
+  EXPECT_EQ(mr.tracker().total_stats().current_bytes, size_t{0});
+}
+
+TEST_F(Tests_MemoryTracking, HostPhases)
+{
+  rmm::mr::new_delete_resource upstream{};
+  cugraph::phase_tracking_host_resource_adaptor<rmm::mr::new_delete_resource> mr(&upstream);
+
+  {
+    cugraph::memory_phase_range_t phase("test/host");
+    auto p = mr.allocate(4096);
+    auto q = mr.allocate(1024);
+    mr.deallocate(p, 4096);
+    mr.deallocate(q, 1024);
+  }
+
+  auto stats = mr.tracker().phase_stats();
+  ASSERT_EQ(stats.count("test/host"), size_t{1});
+  EXPECT_EQ(stats["test/host"].peak_bytes, size_t{4096 + 1024});
+  EXPECT_EQ(stats["test/host"].num_deallocations, size_t{2});
+  EXPECT_EQ(stats["test/host"].current_bytes, size_t{0});
+}
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/device_comm_wrapper.hpp>
+#include <utilities/high_res_clock.h>
+#include <utilities/mg_utilities.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+struct Renumbering_Usecase {
+  size_t num_queries_per_gpu{1024};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGRenumbering
+  : public ::testing::TestWithParam<std::tuple<Renumbering_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGRenumbering() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Renumber external vertex queries with a renumber index and compare the results with the
+  // internal vertices the queries were drawn from (and with renumber_ext_vertices taking the
+  // renumber map labels)
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(Renumbering_Usecase const& renumbering_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    HighResClock hr_clock{};
+
+    auto const comm_rank = handle_->get_comms().get_rank();
+
+    // 1. create MG graph
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        *handle_, input_usecase, false, true);
+
+    auto mg_graph_view = mg_graph.view();
+    auto num_vertices  = mg_graph_view.number_of_vertices();
+
+    // 2. queries: external vertices drawn from the entire vertex range (so most are owned by
+    // another GPU), the second half repeats the first half in the reverse order, and every tenth
+    // query is invalid_vertex_id (which should remain unchanged). The GPUs submit different numbers
+    // of queries (every third GPU submits none).
+
+    auto d_aggregate_renumber_map_labels = cugraph::test::device_allgatherv(
+      *handle_, (*d_mg_renumber_map_labels).data(), (*d_mg_renumber_map_labels).size());
+    auto h_aggregate_renumber_map_labels =
+      cugraph::test::to_host(*handle_, d_aggregate_renumber_map_labels);
+
+    auto num_queries = (comm_rank % 3 == 2) ? size_t{0}
+                                            : renumbering_usecase.num_queries_per_gpu +
+                                                static_cast<size_t>(comm_rank);
+    std::vector<vertex_t> h_expected_int_vertices(num_queries);
+    for (size_t i = 0; i < (num_queries + 1) / 2; ++i) {
+      h_expected_int_vertices[i] =
+        (i % 10 == 9) ? cugraph::invalid_vertex_id<vertex_t>::value
+                      : static_cast<vertex_t>((i * size_t{7919} + static_cast<size_t>(comm_rank)) %
+                                              static_cast<size_t>(num_vertices));
+    }
+    for (size_t i = (num_queries + 1) / 2; i < num_queries; ++i) {
+      h_expected_int_vertices[i] = h_expected_int_vertices[num_queries - 1 - i];
+    }
+    std::vector<vertex_t> h_queries(num_queries);
+    for (size_t i = 0; i < num_queries; ++i) {
+      auto v       = h_expected_int_vertices[i];
+      h_queries[i] = (v == cugraph::invalid_vertex_id<vertex_t>::value)
+                       ? v
+                       : h_aggregate_renumber_map_labels[v];
+    }
+    rmm::device_uvector<vertex_t> d_queries(h_queries.size(), handle_->get_stream());
+    raft::update_device(
+      d_queries.data(), h_queries.data(), h_queries.size(), handle_->get_stream());
+
+    // 3. build the renumber index and renumber
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_clock.start();
+    }
+
+    cugraph::renumber_index_t<vertex_t, true> renumber_index(
+      *handle_,
+      (*d_mg_renumber_map_labels).data(),
+      mg_graph_view.local_vertex_partition_range_first(),
+      mg_graph_view.local_vertex_partition_range_last(),
+      renumbering_usecase.check_correctness);
+
+    rmm::device_uvector<vertex_t> d_index_renumbered(d_queries.size(), handle_->get_stream());
+    raft::copy(
+      d_index_renumbered.data(), d_queries.data(), d_queries.size(), handle_->get_stream());
+    cugraph::renumber_ext_vertices<vertex_t, true>(*handle_,
+                                                   d_index_renumbered.data(),
+                                                   d_index_renumbered.size(),
+                                                   renumber_index,
+                                                   renumbering_usecase.check_correctness);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG renumber index build & renumber_ext_vertices took "
+                << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    // 4. compare
+
+    if (renumbering_usecase.check_correctness) {
+      auto h_index_renumbered = cugraph::test::to_host(*handle_, d_index_renumbered);
+      ASSERT_EQ(h_index_renumbered, h_expected_int_vertices)
+        << "renumbering with a renumber index does not restore the internal vertices in the query "
+           "order.";
+
+      // the index is not consumed by renumbering
+
+      raft::copy(
+        d_index_renumbered.data(), d_queries.data(), d_queries.size(), handle_->get_stream());
+      cugraph::renumber_ext_vertices<vertex_t, true>(
+        *handle_, d_index_renumbered.data(), d_index_renumbered.size(), renumber_index, true);
+      h_index_renumbered = cugraph::test::to_host(*handle_, d_index_renumbered);
+      ASSERT_EQ(h_index_renumbered, h_expected_int_vertices)
+        << "renumbering with a reused renumber index does not restore the internal vertices.";
+
+      // renumbering with the renumber map labels should agree
+
+      rmm::device_uvector<vertex_t> d_map_renumbered(d_queries.size(), handle_->get_stream());
+      raft::copy(
+        d_map_renumbered.data(), d_queries.data(), d_queries.size(), handle_->get_stream());
+      cugraph::renumber_ext_vertices<vertex_t, true>(
+        *handle_,
+        d_map_renumbered.data(),
+        d_map_renumbered.size(),
+        (*d_mg_renumber_map_labels).data(),
+        mg_graph_view.local_vertex_partition_range_first(),
+        mg_graph_view.local_vertex_partition_range_last(),
+        true);
+      auto h_map_renumbered = cugraph::test::to_host(*handle_, d_map_renumbered);
+      ASSERT_EQ(h_map_renumbered, h_index_renumbered)
+        << "renumbering with a renumber index does not match renumbering with the renumber map "
+           "labels.";
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGRenumbering<input_usecase_t>::handle_ = nullptr;
+
+using Tests_MGRenumbering_File = Tests_MGRenumbering<cugraph::test::File_Usecase>;
+using Tests_MGRenumbering_Rmat = Tests_MGRenumbering<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGRenumbering_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGRenumbering_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGRenumbering_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGRenumbering_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(Renumbering_Usecase{}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MGRenumbering_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(Renumbering_Usecase{}),
+    ::testing::Values(
+      cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGRenumbering_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(Renumbering_Usecase{1 << 20, false}),
+    ::testing::Values(
+      cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
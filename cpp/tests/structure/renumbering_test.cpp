@@ -100,6 +100,10 @@ class Tests_Renumbering
     }
 
     if (renumbering_usecase.check_correctness) {
+      std::vector<vertex_t> h_renumbered_src_v(src_v.size());
+      raft::update_host(
+        h_renumbered_src_v.data(), src_v.data(), src_v.size(), handle.get_stream());
+
       cugraph::unrenumber_local_int_vertices(handle,
                                              src_v.data(),
                                              src_v.size(),
@@ -121,6 +125,30 @@ class Tests_Renumbering
 
       EXPECT_EQ(h_original_src_v, h_original_src_v);
       EXPECT_EQ(h_original_dst_v, h_original_dst_v);
+
+      // renumbering with a (reusable) renumber index should restore the internal vertices
+
+      cugraph::renumber_index_t<vertex_t, false> renumber_index(
+        handle,
+        renumber_map_labels_v.data(),
+        vertex_t{0},
+        static_cast<vertex_t>(renumber_map_labels_v.size()),
+        true);
+      for (size_t i = 0; i < 2; ++i) {  // the index is not consumed by renumbering
+        rmm::device_uvector<vertex_t> ext_src_v(src_v.size(), handle.get_stream());
+        raft::copy(ext_src_v.data(), src_v.data(), src_v.size(), handle.get_stream());
+        cugraph::renumber_ext_vertices<vertex_t, false>(
+          handle, ext_src_v.data(), ext_src_v.size(), renumber_index, true);
+
+        std::vector<vertex_t> h_index_renumbered_src_v(ext_src_v.size());
+        raft::update_host(h_index_renumbered_src_v.data(),
+                          ext_src_v.data(),
+                          ext_src_v.size(),
+                          handle.get_stream());
+        handle.sync_stream();
+
+        EXPECT_EQ(h_index_renumbered_src_v, h_renumbered_src_v);
+      }
     }
   }
 };
@@ -163,6 +163,58 @@ class Tests_WeightSum : public ::testing::TestWithParam<WeightSum_Usecase> {
                            h_cugraph_out_weight_sums.begin(),
                            nearly_equal))
       << "Out-weight-sum values do not match with the reference values.";
+
+    // graph_t caches the weight sums (the graph view above filled the cache)
+
+    auto cached_in_weight_sums  = graph.in_weight_sums(handle);
+    auto cached_out_weight_sums = graph.out_weight_sums(handle);
+
+    ASSERT_EQ(graph.in_weight_sums(handle).data(), cached_in_weight_sums.data())
+      << "Cached in-weight-sums are recomputed on the second access.";
+    ASSERT_EQ(graph.out_weight_sums(handle).data(), cached_out_weight_sums.data())
+      << "Cached out-weight-sums are recomputed on the second access.";
+    ASSERT_NE(d_in_weight_sums.data(), cached_in_weight_sums.data())
+      << "The graph view returns the cached in-weight-sums instead of a copy.";
+
+    raft::update_host(h_cugraph_in_weight_sums.data(),
+                      cached_in_weight_sums.data(),
+                      cached_in_weight_sums.size(),
+                      handle.get_stream());
+    raft::update_host(h_cugraph_out_weight_sums.data(),
+                      cached_out_weight_sums.data(),
+                      cached_out_weight_sums.size(),
+                      handle.get_stream());
+    handle.sync_stream();
+
+    ASSERT_TRUE(std::equal(h_reference_in_weight_sums.begin(),
+                           h_reference_in_weight_sums.end(),
+                           h_cugraph_in_weight_sums.begin(),
+                           nearly_equal))
+      << "Cached in-weight-sum values do not match with the reference values.";
+    ASSERT_TRUE(std::equal(h_reference_out_weight_sums.begin(),
+                           h_reference_out_weight_sums.end(),
+                           h_cugraph_out_weight_sums.begin(),
+                           nearly_equal))
+      << "Cached out-weight-sum values do not match with the reference values.";
+    ASSERT_TRUE(nearly_equal(
+      graph.max_in_weight_sum(handle),
+      *std::max_element(h_reference_in_weight_sums.begin(), h_reference_in_weight_sums.end())))
+      << "Cached maximum in-weight-sum does not match with the reference value.";
+    ASSERT_TRUE(nearly_equal(
+      graph.max_out_weight_sum(handle),
+      *std::max_element(h_reference_out_weight_sums.begin(), h_reference_out_weight_sums.end())))
+      << "Cached maximum out-weight-sum does not match with the reference value.";
+
+    // moving a graph moves its cache, and the moved-from graph stays usable
+
+    cugraph::graph_t<vertex_t, edge_t, weight_t, store_transposed, false> moved_graph(handle);
+    moved_graph = std::move(graph);
+    ASSERT_EQ(moved_graph.in_weight_sums(handle).data(), cached_in_weight_sums.data())
+      << "Moving a graph drops its cached in-weight-sums.";
+
+    graph = std::move(moved_graph);
+    ASSERT_EQ(graph.out_weight_sums(handle).data(), cached_out_weight_sums.data())
+      << "Moving a graph back drops its cached out-weight-sums.";
   }
 };
 
@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/high_res_clock.h>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <raft/span.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <vector>
+
+// Check the packed (vertices, distances, predecessors) of a batched BFS request against the
+// distances of an individual BFS from the same source with the same depth limit, the predecessors
+// may differ if there are ties but should be one hop closer to the source
+template <typename vertex_t, typename edge_t>
+void check_bfs_batched_request(std::vector<edge_t> const& h_offsets,
+                               std::vector<vertex_t> const& h_indices,
+                               std::vector<vertex_t> const& h_bfs_distances,
+                               vertex_t source,
+                               vertex_t const* vertices,
+                               vertex_t const* distances,
+                               vertex_t const* predecessors,
+                               size_t size)
+{
+  std::vector<vertex_t> h_expected_vertices{};
+  for (size_t v = 0; v < h_bfs_distances.size(); ++v) {
+    if (h_bfs_distances[v] != std::numeric_limits<vertex_t>::max()) {
+      h_expected_vertices.push_back(static_cast<vertex_t>(v));
+    }
+  }
+
+  ASSERT_EQ(size, h_expected_vertices.size())
+    << "source " << source << ": the number of reached vertices does not match with BFS.";
+  for (size_t i = 0; i < size; ++i) {
+    auto v = vertices[i];
+    ASSERT_EQ(v, h_expected_vertices[i])
+      << "source " << source << ": reached vertices do not match with BFS.";
+    ASSERT_EQ(distances[i], h_bfs_distances[v])
+      << "source " << source << ": distance to vertex " << v << " does not match with BFS.";
+    auto pred = predecessors[i];
+    if (v == source) {
+      ASSERT_EQ(pred, cugraph::invalid_vertex_id<vertex_t>::value)
+        << "source " << source << ": the source should not have a predecessor.";
+    } else {
+      ASSERT_TRUE((pred >= vertex_t{0}) &&
+                  (pred < static_cast<vertex_t>(h_bfs_distances.size())) &&
+                  (h_bfs_distances[pred] + 1 == h_bfs_distances[v]))
+        << "source " << source << ": distance to vertex " << v
+        << " != distance to the predecessor vertex + 1.";
+      ASSERT_TRUE(std::find(h_indices.begin() + h_offsets[pred],
+                            h_indices.begin() + h_offsets[pred + 1],
+                            v) != h_indices.begin() + h_offsets[pred + 1])
+        << "source " << source << ": no edge from the predecessor vertex to vertex " << v << ".";
+    }
+  }
+}
+
+struct BFSBatched_Usecase {
+  size_t num_requests{32};
+  size_t depth_limit{2};
+  bool per_request_depth_limits{true};  // request i uses i % (depth_limit + 1) if set
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_BFSBatched
+  : public ::testing::TestWithParam<std::tuple<BFSBatched_Usecase, input_usecase_t>> {
+ public:
+  Tests_BFSBatched() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(BFSBatched_Usecase const& bfs_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using weight_t = float;
+
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, false, false);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "construct_graph took " << elapsed_time * 1e-6 << " s.\n";
+    }
+    auto graph_view   = graph.view();
+    auto num_vertices = graph_view.number_of_vertices();
+
+    // the sources are spread over the vertex range, every odd request repeats the previous
+    // request's source (with a different depth limit if per_request_depth_limits is set)
+
+    std::vector<vertex_t> h_sources(bfs_usecase.num_requests);
+    std::vector<vertex_t> h_depth_limits(h_sources.size());
+    for (size_t i = 0; i < h_sources.size(); ++i) {
+      h_sources[i] = (i % 2 == 1)
+                       ? h_sources[i - 1]
+                       : static_cast<vertex_t>((static_cast<size_t>(num_vertices) * i) /
+                                               h_sources.size());
+      h_depth_limits[i] = static_cast<vertex_t>(bfs_usecase.per_request_depth_limits
+                                                  ? i % (bfs_usecase.depth_limit + 1)
+                                                  : bfs_usecase.depth_limit);
+    }
+    rmm::device_uvector<vertex_t> d_sources(h_sources.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_depth_limits(h_depth_limits.size(), handle.get_stream());
+    raft::update_device(d_sources.data(), h_sources.data(), h_sources.size(), handle.get_stream());
+    raft::update_device(
+      d_depth_limits.data(), h_depth_limits.data(), h_depth_limits.size(), handle.get_stream());
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto [d_offsets, d_vertices, d_distances, d_predecessors] = cugraph::bfs_batched(
+      handle,
+      graph_view,
+      raft::device_span<vertex_t const>(d_sources.data(), d_sources.size()),
+      bfs_usecase.per_request_depth_limits
+        ? std::make_optional<raft::device_span<vertex_t const>>(d_depth_limits.data(),
+                                                                d_depth_limits.size())
+        : std::nullopt,
+      static_cast<vertex_t>(bfs_usecase.depth_limit),
+      true,
+      std::nullopt,
+      std::nullopt,
+      std::nullopt,
+      true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "BFS batched took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    if (bfs_usecase.check_correctness) {
+      auto h_offsets = cugraph::test::to_host(
+        handle, graph_view.local_edge_partition_view().offsets(), num_vertices + 1);
+      auto h_indices = cugraph::test::to_host(
+        handle, graph_view.local_edge_partition_view().indices(), graph_view.number_of_edges());
+
+      auto h_request_offsets = cugraph::test::to_host(handle, d_offsets);
+      auto h_vertices        = cugraph::test::to_host(handle, d_vertices);
+      auto h_distances       = cugraph::test::to_host(handle, d_distances);
+      auto h_predecessors    = cugraph::test::to_host(handle, d_predecessors);
+
+      ASSERT_EQ(h_request_offsets.size(), h_sources.size() + 1);
+      ASSERT_EQ(h_request_offsets.back(), h_vertices.size());
+      ASSERT_EQ(h_predecessors.size(), h_vertices.size());
+
+      rmm::device_uvector<vertex_t> d_bfs_distances(num_vertices, handle.get_stream());
+      rmm::device_uvector<vertex_t> d_bfs_predecessors(num_vertices, handle.get_stream());
+      for (size_t i = 0; i < h_sources.size(); ++i) {
+        rmm::device_scalar<vertex_t> const d_source(h_sources[i], handle.get_stream());
+        cugraph::bfs(handle,
+                     graph_view,
+                     d_bfs_distances.data(),
+                     d_bfs_predecessors.data(),
+                     d_source.data(),
+                     size_t{1},
+                     false,
+                     h_depth_limits[i]);
+        auto h_bfs_distances = cugraph::test::to_host(handle, d_bfs_distances);
+
+        auto first = h_request_offsets[i];
+        check_bfs_batched_request(h_offsets,
+                                  h_indices,
+                                  h_bfs_distances,
+                                  h_sources[i],
+                                  h_vertices.data() + first,
+                                  h_distances.data() + first,
+                                  h_predecessors.data() + first,
+                                  h_request_offsets[i + 1] - first);
+        if (::testing::Test::HasFatalFailure()) { return; }
+      }
+    }
+  }
+};
+
+using Tests_BFSBatched_File = Tests_BFSBatched<cugraph::test::File_Usecase>;
+using Tests_BFSBatched_Rmat = Tests_BFSBatched<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_BFSBatched_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_BFSBatched_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_BFSBatched_Rmat, CheckInt32Int64)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_BFSBatched_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_BFSBatched_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(BFSBatched_Usecase{32, 2, true},
+                      BFSBatched_Usecase{32, 3, false},
+                      BFSBatched_Usecase{8, std::numeric_limits<int32_t>::max(), false}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/polbooks.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/wiki2003.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_BFSBatched_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(BFSBatched_Usecase{32, 2, true},
+                      BFSBatched_Usecase{32, 3, false},
+                      BFSBatched_Usecase{8, std::numeric_limits<int32_t>::max(), false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_BFSBatched_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(BFSBatched_Usecase{1024, 2, false, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
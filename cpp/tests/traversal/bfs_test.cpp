@@ -312,7 +312,11 @@ INSTANTIATE_TEST_SUITE_P(
   ::testing::Values(
     // enable correctness checks
     std::make_tuple(BFS_Usecase{0},
-                    cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+                    cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false)),
+    // dense graph, most frontiers cover a large fraction of the vertices (this exercises the
+    // bitmap frontier buckets and the dense key reduction)
+    std::make_tuple(BFS_Usecase{0},
+                    cugraph::test::Rmat_Usecase(8, 64, 0.45, 0.15, 0.15, 0, false, false))));
 
 INSTANTIATE_TEST_SUITE_P(
   rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
@@ -324,6 +328,9 @@ INSTANTIATE_TEST_SUITE_P(
   ::testing::Values(
     // disable correctness checks for large graphs
     std::make_pair(BFS_Usecase{0, false},
-                   cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+                   cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false)),
+    // dense graph, the middle BFS iterations insert most of the vertices into the next frontier
+    std::make_pair(BFS_Usecase{0, false},
+                   cugraph::test::Rmat_Usecase(20, 64, 0.45, 0.15, 0.15, 0, false, false))));
 
 CUGRAPH_TEST_PROGRAM_MAIN()
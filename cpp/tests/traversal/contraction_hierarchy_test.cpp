@@ -0,0 +1,407 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/high_res_clock.h>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/serialization/serializer.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/sequence.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+// every path should start at the source and end at the target (and be empty iff the target is
+// unreachable), consecutive path vertices should be connected by an input edge with the weight
+// matching the difference of the path distances, and the last path distance should be the SSSP
+// distance
+template <typename vertex_t, typename edge_t, typename weight_t>
+void check_paths(raft::handle_t const& handle,
+                 cugraph::graph_view_t<vertex_t, edge_t, weight_t, false, false> const& graph_view,
+                 cugraph::contraction_hierarchy_t<vertex_t, edge_t, weight_t> const& hierarchy,
+                 vertex_t source,
+                 std::vector<weight_t> const& h_sssp_distances)
+{
+  auto num_vertices = graph_view.number_of_vertices();
+
+  auto h_offsets = cugraph::test::to_host(
+    handle, graph_view.local_edge_partition_view().offsets(), num_vertices + 1);
+  auto h_indices = cugraph::test::to_host(
+    handle, graph_view.local_edge_partition_view().indices(), graph_view.number_of_edges());
+  auto h_weights = cugraph::test::to_host(
+    handle, *(graph_view.local_edge_partition_view().weights()), graph_view.number_of_edges());
+
+  rmm::device_uvector<vertex_t> d_targets(num_vertices, handle.get_stream());
+  thrust::sequence(handle.get_thrust_policy(), d_targets.begin(), d_targets.end(), vertex_t{0});
+  rmm::device_uvector<vertex_t> d_sources(num_vertices, handle.get_stream());
+  thrust::fill(handle.get_thrust_policy(), d_sources.begin(), d_sources.end(), source);
+
+  auto [d_path_offsets, d_path_vertices, d_path_distances] =
+    cugraph::contraction_hierarchy_paths(
+      handle,
+      hierarchy,
+      raft::device_span<vertex_t const>(d_sources.data(), d_sources.size()),
+      raft::device_span<vertex_t const>(d_targets.data(), d_targets.size()),
+      true);
+
+  auto h_path_offsets =
+    cugraph::test::to_host(handle, d_path_offsets.data(), d_path_offsets.size());
+  auto h_path_vertices =
+    cugraph::test::to_host(handle, d_path_vertices.data(), d_path_vertices.size());
+  auto h_path_distances =
+    cugraph::test::to_host(handle, d_path_distances.data(), d_path_distances.size());
+
+  auto nearly_equal = [](weight_t lhs, weight_t rhs) {
+    return std::fabs(lhs - rhs) <= std::max(std::fabs(lhs), std::fabs(rhs)) * weight_t{1e-4};
+  };
+
+  ASSERT_EQ(h_path_offsets.size(), static_cast<size_t>(num_vertices + 1));
+  for (vertex_t t = 0; t < num_vertices; ++t) {
+    auto first = h_path_offsets[t];
+    auto last  = h_path_offsets[t + 1];
+    if (h_sssp_distances[t] == std::numeric_limits<weight_t>::max()) {
+      ASSERT_EQ(first, last) << "source " << source << ", target " << t
+                             << ": a path to an unreachable target.";
+      continue;
+    }
+    ASSERT_TRUE(first < last) << "source " << source << ", target " << t << ": no path.";
+    ASSERT_EQ(h_path_vertices[first], source);
+    ASSERT_EQ(h_path_vertices[last - 1], t);
+    ASSERT_EQ(h_path_distances[first], weight_t{0.0});
+    ASSERT_TRUE(nearly_equal(h_path_distances[last - 1], h_sssp_distances[t]))
+      << "source " << source << ", target " << t << ": path distance does not match SSSP.";
+    for (auto i = first; i + 1 < last; ++i) {
+      auto u     = h_path_vertices[i];
+      auto v     = h_path_vertices[i + 1];
+      bool found = false;
+      for (auto j = h_offsets[u]; j < h_offsets[u + 1]; ++j) {
+        if ((h_indices[j] == v) &&
+            nearly_equal(h_path_distances[i] + h_weights[j], h_path_distances[i + 1])) {
+          found = true;
+          break;
+        }
+      }
+      ASSERT_TRUE(found) << "source " << source << ", target " << t
+                         << ": no input edge with the matching weight between path vertices "
+                         << u << " and " << v << ".";
+    }
+  }
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+void compare_with_sssp(
+  raft::handle_t const& handle,
+  cugraph::graph_view_t<vertex_t, edge_t, weight_t, false, false> const& graph_view,
+  cugraph::contraction_hierarchy_t<vertex_t, edge_t, weight_t> const& hierarchy)
+{
+  auto num_vertices = graph_view.number_of_vertices();
+
+  rmm::device_uvector<vertex_t> d_targets(num_vertices, handle.get_stream());
+  thrust::sequence(handle.get_thrust_policy(), d_targets.begin(), d_targets.end(), vertex_t{0});
+
+  rmm::device_uvector<weight_t> d_sssp_distances(num_vertices, handle.get_stream());
+  rmm::device_uvector<vertex_t> d_predecessors(num_vertices, handle.get_stream());
+  rmm::device_uvector<vertex_t> d_source(1, handle.get_stream());
+
+  for (vertex_t source = 0; source < num_vertices; ++source) {
+    cugraph::sssp(handle, graph_view, d_sssp_distances.data(), d_predecessors.data(), source);
+    raft::update_device(d_source.data(), &source, size_t{1}, handle.get_stream());
+
+    auto d_ch_distances = cugraph::contraction_hierarchy_distances(
+      handle,
+      hierarchy,
+      raft::device_span<vertex_t const>(d_source.data(), d_source.size()),
+      raft::device_span<vertex_t const>(d_targets.data(), d_targets.size()),
+      true);
+
+    auto h_sssp_distances =
+      cugraph::test::to_host(handle, d_sssp_distances.data(), d_sssp_distances.size());
+    auto h_ch_distances =
+      cugraph::test::to_host(handle, d_ch_distances.data(), d_ch_distances.size());
+
+    for (vertex_t v = 0; v < num_vertices; ++v) {
+      if (h_sssp_distances[v] == std::numeric_limits<weight_t>::max()) {
+        EXPECT_EQ(h_ch_distances[v], std::numeric_limits<weight_t>::max())
+          << "source " << source << ", target " << v;
+      } else {
+        EXPECT_NEAR(h_ch_distances[v], h_sssp_distances[v], weight_t{1e-4})
+          << "source " << source << ", target " << v;
+      }
+    }
+
+    check_paths(handle, graph_view, hierarchy, source, h_sssp_distances);
+  }
+}
+
+}  // namespace
+
+struct ContractionHierarchy_Usecase {
+  size_t num_sources{4};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_ContractionHierarchy
+  : public ::testing::TestWithParam<std::tuple<ContractionHierarchy_Usecase, input_usecase_t>> {
+ public:
+  Tests_ContractionHierarchy() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(ContractionHierarchy_Usecase const& ch_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, true, false);
+    auto graph_view   = graph.view();
+    auto num_vertices = graph_view.number_of_vertices();
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto hierarchy = cugraph::build_contraction_hierarchy(handle, graph_view, false);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "build_contraction_hierarchy took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    rmm::device_uvector<vertex_t> d_targets(num_vertices, handle.get_stream());
+    thrust::sequence(handle.get_thrust_policy(), d_targets.begin(), d_targets.end(), vertex_t{0});
+    rmm::device_uvector<vertex_t> d_source(1, handle.get_stream());
+    rmm::device_uvector<weight_t> d_sssp_distances(num_vertices, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_predecessors(num_vertices, handle.get_stream());
+
+    auto num_sources = std::min(ch_usecase.num_sources, static_cast<size_t>(num_vertices));
+    for (size_t i = 0; i < num_sources; ++i) {
+      // spread the sources over the vertex range
+      auto source = static_cast<vertex_t>((static_cast<size_t>(num_vertices) * i) / num_sources);
+      raft::update_device(d_source.data(), &source, size_t{1}, handle.get_stream());
+
+      if (cugraph::test::g_perf) {
+        RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        hr_clock.start();
+      }
+
+      auto d_ch_distances = cugraph::contraction_hierarchy_distances(
+        handle,
+        hierarchy,
+        raft::device_span<vertex_t const>(d_source.data(), d_source.size()),
+        raft::device_span<vertex_t const>(d_targets.data(), d_targets.size()),
+        false);
+
+      if (cugraph::test::g_perf) {
+        RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+        double elapsed_time{0.0};
+        hr_clock.stop(&elapsed_time);
+        std::cout << "contraction_hierarchy_distances took " << elapsed_time * 1e-6 << " s.\n";
+      }
+
+      if (ch_usecase.check_correctness) {
+        cugraph::sssp(
+          handle, graph_view, d_sssp_distances.data(), d_predecessors.data(), source);
+
+        auto h_sssp_distances =
+          cugraph::test::to_host(handle, d_sssp_distances.data(), d_sssp_distances.size());
+        auto h_ch_distances =
+          cugraph::test::to_host(handle, d_ch_distances.data(), d_ch_distances.size());
+
+        for (vertex_t v = 0; v < num_vertices; ++v) {
+          if (h_sssp_distances[v] == std::numeric_limits<weight_t>::max()) {
+            ASSERT_EQ(h_ch_distances[v], std::numeric_limits<weight_t>::max())
+              << "source " << source << ", target " << v;
+          } else {
+            ASSERT_TRUE(std::fabs(h_ch_distances[v] - h_sssp_distances[v]) <=
+                        std::fabs(h_sssp_distances[v]) * weight_t{1e-4})
+              << "source " << source << ", target " << v
+              << ": contraction hierarchy distance does not match SSSP.";
+          }
+        }
+
+        check_paths(handle, graph_view, hierarchy, source, h_sssp_distances);
+      }
+    }
+  }
+};
+
+using Tests_ContractionHierarchy_File = Tests_ContractionHierarchy<cugraph::test::File_Usecase>;
+using Tests_ContractionHierarchy_Rmat = Tests_ContractionHierarchy<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_ContractionHierarchy_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_ContractionHierarchy_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_ContractionHierarchy_Rmat, CheckInt32Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_ContractionHierarchy_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_ContractionHierarchy_File,
+  // enable correctness checks
+  ::testing::Values(
+    std::make_tuple(ContractionHierarchy_Usecase{8},
+                    cugraph::test::File_Usecase("test/datasets/karate.mtx")),
+    std::make_tuple(ContractionHierarchy_Usecase{4},
+                    cugraph::test::File_Usecase("test/datasets/dblp.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_ContractionHierarchy_Rmat,
+  // enable correctness checks
+  ::testing::Values(
+    std::make_tuple(ContractionHierarchy_Usecase{4},
+                    cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_ContractionHierarchy_Rmat,
+  // disable correctness checks for large graphs
+  ::testing::Values(
+    std::make_tuple(ContractionHierarchy_Usecase{4, false},
+                    cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+TEST(ContractionHierarchyTest, DistancesMatchSSSP)
+{
+  using vertex_t = int32_t;
+  using edge_t   = int32_t;
+  using weight_t = float;
+
+  raft::handle_t handle{};
+
+  edge_t num_edges      = 8;
+  vertex_t num_vertices = 6;
+
+  std::vector<vertex_t> v_src{0, 1, 1, 2, 2, 2, 3, 4};
+  std::vector<vertex_t> v_dst{1, 3, 4, 0, 1, 3, 5, 5};
+  std::vector<weight_t> v_w{0.1, 2.1, 1.1, 5.1, 3.1, 4.1, 7.2, 3.2};
+
+  auto graph = cugraph::test::make_graph(
+    handle, v_src, v_dst, std::optional<std::vector<weight_t>>{v_w}, num_vertices, num_edges);
+
+  auto hierarchy = cugraph::build_contraction_hierarchy(handle, graph.view(), true);
+
+  compare_with_sssp(handle, graph.view(), hierarchy);
+}
+
+TEST(ContractionHierarchyTest, HierarchySerUnser)
+{
+  using namespace cugraph::serializer;
+
+  using vertex_t = int32_t;
+  using edge_t   = int32_t;
+  using weight_t = double;
+
+  raft::handle_t handle{};
+
+  edge_t num_edges      = 8;
+  vertex_t num_vertices = 6;
+
+  std::vector<vertex_t> v_src{0, 1, 1, 2, 2, 2, 3, 4};
+  std::vector<vertex_t> v_dst{1, 3, 4, 0, 1, 3, 5, 5};
+  std::vector<weight_t> v_w{0.1, 2.1, 1.1, 5.1, 3.1, 4.1, 7.2, 3.2};
+
+  auto graph = cugraph::test::make_graph(
+    handle, v_src, v_dst, std::optional<std::vector<weight_t>>{v_w}, num_vertices, num_edges);
+
+  auto hierarchy = cugraph::build_contraction_hierarchy(handle, graph.view());
+
+  auto total_ser_sz = serializer_t::get_device_contraction_hierarchy_sz_bytes(hierarchy);
+
+  serializer_t ser(handle, total_ser_sz);
+  ser.serialize(hierarchy);
+
+  serializer_t unser(handle, ser.get_storage());
+  auto hierarchy_copy = unser.unserialize_contraction_hierarchy<vertex_t, edge_t, weight_t>();
+
+  EXPECT_EQ(cugraph::test::to_host(handle, hierarchy.levels.data(), hierarchy.levels.size()),
+            cugraph::test::to_host(
+              handle, hierarchy_copy.levels.data(), hierarchy_copy.levels.size()));
+
+  auto pair =
+    cugraph::test::compare_graphs(handle, hierarchy.upward_graph, hierarchy_copy.upward_graph);
+  if (pair.first == false) std::cerr << "Test failed with " << pair.second << ".\n";
+  ASSERT_TRUE(pair.first);
+
+  pair =
+    cugraph::test::compare_graphs(handle, hierarchy.downward_graph, hierarchy_copy.downward_graph);
+  if (pair.first == false) std::cerr << "Test failed with " << pair.second << ".\n";
+  ASSERT_TRUE(pair.first);
+
+  auto compare_arrays = [&handle](auto const& lhs, auto const& rhs) {
+    return cugraph::test::to_host(handle, lhs.data(), lhs.size()) ==
+           cugraph::test::to_host(handle, rhs.data(), rhs.size());
+  };
+  EXPECT_TRUE(compare_arrays(hierarchy.shortcut_srcs, hierarchy_copy.shortcut_srcs));
+  EXPECT_TRUE(compare_arrays(hierarchy.shortcut_dsts, hierarchy_copy.shortcut_dsts));
+  EXPECT_TRUE(compare_arrays(hierarchy.shortcut_middles, hierarchy_copy.shortcut_middles));
+  EXPECT_TRUE(
+    compare_arrays(hierarchy.shortcut_first_weights, hierarchy_copy.shortcut_first_weights));
+
+  compare_with_sssp(handle, graph.view(), hierarchy_copy);
+}
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,511 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/device_comm_wrapper.hpp>
+#include <utilities/high_res_clock.h>
+#include <utilities/mg_utilities.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <raft/span.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/sequence.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <vector>
+
+// The hop at which a request stops (and returns the vertices within), given the distances of an
+// individual BFS from the request's source with the request's depth limit: the request stops after
+// the hop visiting its target or the hop at which the number of visited vertices or the number of
+// examined edges (the out-edges of the vertices in the previous hops) reaches its budget
+template <typename vertex_t, typename edge_t>
+vertex_t bfs_batched_stop_depth(std::vector<edge_t> const& h_offsets,
+                                std::vector<vertex_t> const& h_bfs_distances,
+                                vertex_t source,
+                                vertex_t depth_limit,
+                                std::optional<vertex_t> target,
+                                std::optional<size_t> vertex_budget,
+                                std::optional<size_t> edge_budget)
+{
+  if ((depth_limit == vertex_t{0}) || (target && (*target == source)) ||
+      (vertex_budget && (*vertex_budget <= size_t{1}))) {
+    return vertex_t{0};
+  }
+
+  std::vector<size_t> vertex_counts{};  // vertex_counts[d]: # vertices at distance d
+  std::vector<size_t> edge_counts{};    // edge_counts[d]: # out-edges of the vertices at distance d
+  for (size_t v = 0; v < h_bfs_distances.size(); ++v) {
+    auto d = h_bfs_distances[v];
+    if (d == std::numeric_limits<vertex_t>::max()) { continue; }
+    if (static_cast<size_t>(d) >= vertex_counts.size()) {
+      vertex_counts.resize(d + 1, size_t{0});
+      edge_counts.resize(d + 1, size_t{0});
+    }
+    ++vertex_counts[d];
+    edge_counts[d] += static_cast<size_t>(h_offsets[v + 1] - h_offsets[v]);
+  }
+
+  auto target_distance = (target && (*target != cugraph::invalid_vertex_id<vertex_t>::value))
+                           ? h_bfs_distances[*target]
+                           : std::numeric_limits<vertex_t>::max();
+  size_t num_visited_vertices{vertex_counts[0]};
+  size_t num_examined_edges{0};
+  vertex_t depth{1};
+  for (; static_cast<size_t>(depth) < vertex_counts.size(); ++depth) {
+    num_visited_vertices += vertex_counts[depth];
+    num_examined_edges += edge_counts[depth - 1];
+    if ((depth == target_distance) || (vertex_budget && (num_visited_vertices >= *vertex_budget)) ||
+        (edge_budget && (num_examined_edges >= *edge_budget))) {
+      return depth;
+    }
+  }
+  return depth - 1;  // every vertex within the depth limit is visited
+}
+
+// Check the packed (vertices, distances, predecessors) of a batched BFS request against the
+// distances of an individual BFS from the same source with the same depth limit (up to the hop at
+// which the request stops), the predecessors may differ if there are ties but should be one hop
+// closer to the source
+template <typename vertex_t, typename edge_t>
+void check_bfs_batched_request(std::vector<edge_t> const& h_offsets,
+                               std::vector<vertex_t> const& h_indices,
+                               std::vector<vertex_t> const& h_bfs_distances,
+                               vertex_t source,
+                               vertex_t stop_depth,
+                               vertex_t const* vertices,
+                               vertex_t const* distances,
+                               vertex_t const* predecessors,
+                               size_t size)
+{
+  std::vector<vertex_t> h_expected_vertices{};
+  for (size_t v = 0; v < h_bfs_distances.size(); ++v) {
+    if (h_bfs_distances[v] <= stop_depth) {
+      h_expected_vertices.push_back(static_cast<vertex_t>(v));
+    }
+  }
+
+  ASSERT_EQ(size, h_expected_vertices.size())
+    << "source " << source << ": the number of reached vertices does not match with BFS.";
+  for (size_t i = 0; i < size; ++i) {
+    auto v = vertices[i];
+    ASSERT_EQ(v, h_expected_vertices[i])
+      << "source " << source << ": reached vertices do not match with BFS.";
+    ASSERT_EQ(distances[i], h_bfs_distances[v])
+      << "source " << source << ": distance to vertex " << v << " does not match with BFS.";
+    auto pred = predecessors[i];
+    if (v == source) {
+      ASSERT_EQ(pred, cugraph::invalid_vertex_id<vertex_t>::value)
+        << "source " << source << ": the source should not have a predecessor.";
+    } else {
+      ASSERT_TRUE((pred >= vertex_t{0}) &&
+                  (pred < static_cast<vertex_t>(h_bfs_distances.size())) &&
+                  (h_bfs_distances[pred] + 1 == h_bfs_distances[v]))
+        << "source " << source << ": distance to vertex " << v
+        << " != distance to the predecessor vertex + 1.";
+      ASSERT_TRUE(std::find(h_indices.begin() + h_offsets[pred],
+                            h_indices.begin() + h_offsets[pred + 1],
+                            v) != h_indices.begin() + h_offsets[pred + 1])
+        << "source " << source << ": no edge from the predecessor vertex to vertex " << v << ".";
+    }
+  }
+}
+
+struct BFSBatched_Usecase {
+  size_t num_requests_per_gpu{16};
+  size_t depth_limit{2};
+  bool per_request_depth_limits{true};  // request i uses i % (depth_limit + 1) if set
+  bool with_targets{false};
+  std::optional<size_t> vertex_budget{std::nullopt};
+  std::optional<size_t> edge_budget{std::nullopt};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGBFSBatched
+  : public ::testing::TestWithParam<std::tuple<BFSBatched_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGBFSBatched() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Compare the results of every request submitted by every GPU with a single-GPU BFS run on the
+  // same (renumbered) graph
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(BFSBatched_Usecase const& bfs_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    using weight_t = float;
+
+    HighResClock hr_clock{};
+
+    auto const comm_rank = handle_->get_comms().get_rank();
+    auto const comm_size = handle_->get_comms().get_size();
+
+    // 1. create MG graph
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        *handle_, input_usecase, false, true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG construct_graph took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    auto mg_graph_view = mg_graph.view();
+    auto num_vertices  = mg_graph_view.number_of_vertices();
+
+    // 2. requests: the GPUs submit different numbers of requests (every third GPU submits none)
+    // so the global request IDs depend on the allgathered request counts, the sources are spread
+    // over the entire vertex range (so most are owned by another GPU) and every odd request
+    // repeats the previous request's source. If with_targets is set, every fourth request targets
+    // its own source, the remaining even requests target a vertex a third of the range away, and
+    // the odd requests have no target
+
+    auto num_requests = (comm_rank % 3 == 2)
+                          ? size_t{0}
+                          : bfs_usecase.num_requests_per_gpu + static_cast<size_t>(comm_rank);
+    std::vector<vertex_t> h_mg_sources(num_requests);
+    std::vector<vertex_t> h_mg_depth_limits(h_mg_sources.size());
+    std::vector<vertex_t> h_mg_targets(h_mg_sources.size());
+    for (size_t i = 0; i < h_mg_sources.size(); ++i) {
+      auto idx        = i * static_cast<size_t>(comm_size) + static_cast<size_t>(comm_rank);
+      h_mg_sources[i] = (i % 2 == 1) ? h_mg_sources[i - 1]
+                                     : static_cast<vertex_t>((idx * size_t{7919}) %
+                                                             static_cast<size_t>(num_vertices));
+      h_mg_depth_limits[i] = static_cast<vertex_t>(bfs_usecase.per_request_depth_limits
+                                                     ? i % (bfs_usecase.depth_limit + 1)
+                                                     : bfs_usecase.depth_limit);
+      h_mg_targets[i] =
+        (i % 4 == 0)   ? h_mg_sources[i]
+        : (i % 2 == 0) ? static_cast<vertex_t>((h_mg_sources[i] + num_vertices / 3) % num_vertices)
+                       : cugraph::invalid_vertex_id<vertex_t>::value;
+    }
+    rmm::device_uvector<vertex_t> d_mg_sources(h_mg_sources.size(), handle_->get_stream());
+    rmm::device_uvector<vertex_t> d_mg_depth_limits(h_mg_depth_limits.size(),
+                                                    handle_->get_stream());
+    raft::update_device(
+      d_mg_sources.data(), h_mg_sources.data(), h_mg_sources.size(), handle_->get_stream());
+    raft::update_device(d_mg_depth_limits.data(),
+                        h_mg_depth_limits.data(),
+                        h_mg_depth_limits.size(),
+                        handle_->get_stream());
+    rmm::device_uvector<vertex_t> d_mg_targets(h_mg_targets.size(), handle_->get_stream());
+    raft::update_device(
+      d_mg_targets.data(), h_mg_targets.data(), h_mg_targets.size(), handle_->get_stream());
+
+    // 3. run MG batched BFS
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto [d_mg_offsets, d_mg_vertices, d_mg_distances, d_mg_predecessors] = cugraph::bfs_batched(
+      *handle_,
+      mg_graph_view,
+      raft::device_span<vertex_t const>(d_mg_sources.data(), d_mg_sources.size()),
+      bfs_usecase.per_request_depth_limits
+        ? std::make_optional<raft::device_span<vertex_t const>>(d_mg_depth_limits.data(),
+                                                                d_mg_depth_limits.size())
+        : std::nullopt,
+      static_cast<vertex_t>(bfs_usecase.depth_limit),
+      true,
+      bfs_usecase.with_targets
+        ? std::make_optional<raft::device_span<vertex_t const>>(d_mg_targets.data(),
+                                                                d_mg_targets.size())
+        : std::nullopt,
+      bfs_usecase.vertex_budget,
+      bfs_usecase.edge_budget,
+      true);
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG BFS batched took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    // 4. compare SG & MG results
+
+    if (bfs_usecase.check_correctness) {
+      // 4-1. every request's results should be returned to the GPU that submitted it
+
+      auto h_mg_offsets = cugraph::test::to_host(*handle_, d_mg_offsets);
+      ASSERT_EQ(h_mg_offsets.size(), h_mg_sources.size() + 1);
+      ASSERT_EQ(h_mg_offsets.back(), d_mg_vertices.size());
+      ASSERT_EQ(d_mg_predecessors.size(), d_mg_vertices.size());
+      std::vector<size_t> h_mg_sizes(h_mg_sources.size());
+      for (size_t i = 0; i < h_mg_sizes.size(); ++i) {
+        h_mg_sizes[i] = h_mg_offsets[i + 1] - h_mg_offsets[i];
+      }
+      rmm::device_uvector<size_t> d_mg_sizes(h_mg_sizes.size(), handle_->get_stream());
+      raft::update_device(
+        d_mg_sizes.data(), h_mg_sizes.data(), h_mg_sizes.size(), handle_->get_stream());
+
+      // 4-2. aggregate the requests, the results and the MG graph's edges (in internal vertex IDs)
+
+      auto d_mg_aggregate_sources =
+        cugraph::test::device_gatherv(*handle_, d_mg_sources.data(), d_mg_sources.size());
+      auto d_mg_aggregate_depth_limits = cugraph::test::device_gatherv(
+        *handle_, d_mg_depth_limits.data(), d_mg_depth_limits.size());
+      auto d_mg_aggregate_targets =
+        cugraph::test::device_gatherv(*handle_, d_mg_targets.data(), d_mg_targets.size());
+      auto d_mg_aggregate_sizes =
+        cugraph::test::device_gatherv(*handle_, d_mg_sizes.data(), d_mg_sizes.size());
+      auto d_mg_aggregate_vertices =
+        cugraph::test::device_gatherv(*handle_, d_mg_vertices.data(), d_mg_vertices.size());
+      auto d_mg_aggregate_distances =
+        cugraph::test::device_gatherv(*handle_, d_mg_distances.data(), d_mg_distances.size());
+      auto d_mg_aggregate_predecessors = cugraph::test::device_gatherv(
+        *handle_, d_mg_predecessors.data(), d_mg_predecessors.size());
+
+      auto [d_mg_srcs, d_mg_dsts, d_mg_weights] =
+        mg_graph_view.decompress_to_edgelist(*handle_, std::nullopt);
+
+      auto d_mg_aggregate_srcs =
+        cugraph::test::device_gatherv(*handle_, d_mg_srcs.data(), d_mg_srcs.size());
+      auto d_mg_aggregate_dsts =
+        cugraph::test::device_gatherv(*handle_, d_mg_dsts.data(), d_mg_dsts.size());
+
+      if (comm_rank == int{0}) {
+        // 4-3. create SG graph with the MG graph's vertex IDs
+
+        rmm::device_uvector<vertex_t> d_sg_vertices(num_vertices, handle_->get_stream());
+        thrust::sequence(handle_->get_thrust_policy(),
+                         d_sg_vertices.begin(),
+                         d_sg_vertices.end(),
+                         vertex_t{0});
+
+        cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> sg_graph(*handle_);
+        std::tie(sg_graph, std::ignore) =
+          cugraph::create_graph_from_edgelist<vertex_t, edge_t, weight_t, false, false>(
+            *handle_,
+            std::make_optional(std::move(d_sg_vertices)),
+            std::move(d_mg_aggregate_srcs),
+            std::move(d_mg_aggregate_dsts),
+            std::nullopt,
+            cugraph::graph_properties_t{mg_graph_view.is_symmetric(),
+                                        mg_graph_view.is_multigraph()},
+            false);
+
+        auto sg_graph_view = sg_graph.view();
+
+        ASSERT_EQ(num_vertices, sg_graph_view.number_of_vertices());
+
+        auto h_sg_offsets = cugraph::test::to_host(
+          *handle_, sg_graph_view.local_edge_partition_view().offsets(), num_vertices + 1);
+        auto h_sg_indices =
+          cugraph::test::to_host(*handle_,
+                                 sg_graph_view.local_edge_partition_view().indices(),
+                                 sg_graph_view.number_of_edges());
+
+        auto h_sources      = cugraph::test::to_host(*handle_, d_mg_aggregate_sources);
+        auto h_depth_limits = cugraph::test::to_host(*handle_, d_mg_aggregate_depth_limits);
+        auto h_targets      = cugraph::test::to_host(*handle_, d_mg_aggregate_targets);
+        auto h_sizes        = cugraph::test::to_host(*handle_, d_mg_aggregate_sizes);
+        auto h_vertices     = cugraph::test::to_host(*handle_, d_mg_aggregate_vertices);
+        auto h_distances    = cugraph::test::to_host(*handle_, d_mg_aggregate_distances);
+        auto h_predecessors = cugraph::test::to_host(*handle_, d_mg_aggregate_predecessors);
+
+        // 4-4. run SG BFS per request and compare, every GPU owning a part of the request's
+        // visited vertices should stop the request at the same hop: a GPU stopping late would
+        // return vertices beyond the stop hop and a GPU stopping early would miss vertices
+
+        rmm::device_uvector<vertex_t> d_sg_distances(num_vertices, handle_->get_stream());
+        rmm::device_uvector<vertex_t> d_sg_predecessors(num_vertices, handle_->get_stream());
+        size_t offset{0};
+        for (size_t i = 0; i < h_sources.size(); ++i) {
+          rmm::device_scalar<vertex_t> const d_sg_source(h_sources[i], handle_->get_stream());
+          cugraph::bfs(*handle_,
+                       sg_graph_view,
+                       d_sg_distances.data(),
+                       d_sg_predecessors.data(),
+                       d_sg_source.data(),
+                       size_t{1},
+                       false,
+                       h_depth_limits[i]);
+          auto h_sg_distances = cugraph::test::to_host(*handle_, d_sg_distances);
+
+          auto stop_depth = bfs_batched_stop_depth(
+            h_sg_offsets,
+            h_sg_distances,
+            h_sources[i],
+            h_depth_limits[i],
+            bfs_usecase.with_targets ? std::make_optional(h_targets[i]) : std::nullopt,
+            bfs_usecase.vertex_budget,
+            bfs_usecase.edge_budget);
+
+          check_bfs_batched_request(h_sg_offsets,
+                                    h_sg_indices,
+                                    h_sg_distances,
+                                    h_sources[i],
+                                    stop_depth,
+                                    h_vertices.data() + offset,
+                                    h_distances.data() + offset,
+                                    h_predecessors.data() + offset,
+                                    h_sizes[i]);
+          if (::testing::Test::HasFatalFailure()) { return; }
+
+          // the budgets are respected: the request did not exhaust them before its last hop
+
+          size_t num_vertices_before_last_hop{0};
+          size_t num_edges_before_last_hop{0};
+          for (size_t j = offset; j < offset + h_sizes[i]; ++j) {
+            if (h_distances[j] + 1 < stop_depth) {
+              num_edges_before_last_hop += static_cast<size_t>(h_sg_offsets[h_vertices[j] + 1] -
+                                                               h_sg_offsets[h_vertices[j]]);
+            }
+            if (h_distances[j] < stop_depth) { ++num_vertices_before_last_hop; }
+          }
+          if (bfs_usecase.vertex_budget && (stop_depth > vertex_t{0})) {
+            ASSERT_TRUE(num_vertices_before_last_hop < *(bfs_usecase.vertex_budget))
+              << "source " << h_sources[i] << ": the vertex budget is exceeded before hop "
+              << stop_depth << ".";
+          }
+          if (bfs_usecase.edge_budget && (stop_depth > vertex_t{1})) {
+            ASSERT_TRUE(num_edges_before_last_hop < *(bfs_usecase.edge_budget))
+              << "source " << h_sources[i] << ": the edge budget is exceeded before hop "
+              << stop_depth << ".";
+          }
+
+          offset += h_sizes[i];
+        }
+        ASSERT_EQ(offset, h_vertices.size());
+      }
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGBFSBatched<input_usecase_t>::handle_ = nullptr;
+
+using Tests_MGBFSBatched_File = Tests_MGBFSBatched<cugraph::test::File_Usecase>;
+using Tests_MGBFSBatched_Rmat = Tests_MGBFSBatched<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGBFSBatched_File, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGBFSBatched_Rmat, CheckInt32Int32)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGBFSBatched_Rmat, CheckInt32Int64)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGBFSBatched_Rmat, CheckInt64Int64)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_MGBFSBatched_File,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(
+      BFSBatched_Usecase{16, 2, true},
+      BFSBatched_Usecase{16, 3, false},
+      BFSBatched_Usecase{4, std::numeric_limits<int32_t>::max(), false},
+      // early exits: targets, vertex & edge budgets, and all of them together
+      BFSBatched_Usecase{16, 6, false, true},
+      BFSBatched_Usecase{16, 6, false, false, size_t{20}},
+      BFSBatched_Usecase{16, 6, false, false, size_t{1}},
+      BFSBatched_Usecase{16, 6, false, false, std::nullopt, size_t{64}},
+      BFSBatched_Usecase{16, 6, true, true, size_t{20}, size_t{64}}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/netscience.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/web-Google.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_MGBFSBatched_Rmat,
+  ::testing::Combine(
+    // enable correctness checks
+    ::testing::Values(
+      BFSBatched_Usecase{16, 2, true},
+      BFSBatched_Usecase{16, 3, false},
+      BFSBatched_Usecase{4, std::numeric_limits<int32_t>::max(), false},
+      // early exits: targets, vertex & edge budgets, and all of them together
+      BFSBatched_Usecase{16, 6, false, true},
+      BFSBatched_Usecase{16, 6, false, false, size_t{20}},
+      BFSBatched_Usecase{16, 6, false, false, size_t{1}},
+      BFSBatched_Usecase{16, 6, false, false, std::nullopt, size_t{64}},
+      BFSBatched_Usecase{16, 6, true, true, size_t{20}, size_t{64}}),
+    ::testing::Values(
+      cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGBFSBatched_Rmat,
+  ::testing::Combine(
+    // disable correctness checks for large graphs
+    ::testing::Values(BFSBatched_Usecase{1024, 2, false, false, std::nullopt, std::nullopt, false}),
+    ::testing::Values(
+      cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
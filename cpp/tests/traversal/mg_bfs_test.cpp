@@ -317,6 +317,10 @@ INSTANTIATE_TEST_SUITE_P(
     // disable correctness checks for large graphs
     std::make_tuple(
       BFS_Usecase{0, false},
-      cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+      cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false, 0, true)),
+    // dense graph, the middle BFS iterations insert most of the vertices into the next frontier
+    std::make_tuple(
+      BFS_Usecase{0, false},
+      cugraph::test::Rmat_Usecase(20, 64, 0.45, 0.15, 0.15, 0, false, false, 0, true))));
 
 CUGRAPH_MG_TEST_PROGRAM_MAIN()
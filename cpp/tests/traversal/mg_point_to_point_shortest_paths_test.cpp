@@ -0,0 +1,504 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/device_comm_wrapper.hpp>
+#include <utilities/high_res_clock.h>
+#include <utilities/mg_utilities.hpp>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_functions.hpp>
+#include <cugraph/graph_view.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/sequence.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+enum class P2PHeuristic { none, per_vertex, per_target };
+
+struct PointToPointShortestPaths_Usecase {
+  size_t num_pairs_per_gpu{8};
+  bool bidirectional{false};
+  P2PHeuristic heuristic{P2PHeuristic::none};
+  bool check_correctness{true};
+};
+
+template <typename input_usecase_t>
+class Tests_MGPointToPointShortestPaths
+  : public ::testing::TestWithParam<
+      std::tuple<PointToPointShortestPaths_Usecase, input_usecase_t>> {
+ public:
+  Tests_MGPointToPointShortestPaths() {}
+
+  static void SetUpTestCase() { handle_ = cugraph::test::initialize_mg_handle(); }
+
+  static void TearDownTestCase() { handle_.reset(); }
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Check the paths of the pairs submitted by every GPU against single-GPU SSSP runs on the same
+  // (renumbered) graph, the paths may differ from the SSSP predecessor paths if there are ties but
+  // the path distances should match the SSSP distances
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(PointToPointShortestPaths_Usecase const& p2p_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    HighResClock hr_clock{};
+
+    auto const comm_rank = handle_->get_comms().get_rank();
+    auto const comm_size = handle_->get_comms().get_size();
+
+    // 1. create MG graph (and its transposed copy for the bidirectional search, the two are
+    // renumbered separately)
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto [mg_graph, d_mg_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, true>(
+        *handle_, input_usecase, true, true);
+
+    std::optional<cugraph::graph_t<vertex_t, edge_t, weight_t, true, true>> mg_transposed_graph{
+      std::nullopt};
+    rmm::device_uvector<vertex_t> d_mg_transposed_graph_vertex_ids(0, handle_->get_stream());
+    if (p2p_usecase.bidirectional) {
+      std::optional<rmm::device_uvector<vertex_t>> d_mg_transposed_renumber_map_labels{
+        std::nullopt};
+      std::tie(mg_transposed_graph, d_mg_transposed_renumber_map_labels) =
+        cugraph::test::construct_graph<vertex_t, edge_t, weight_t, true, true>(
+          *handle_, input_usecase, true, true);
+      d_mg_transposed_graph_vertex_ids = std::move(*d_mg_transposed_renumber_map_labels);
+      cugraph::renumber_ext_vertices<vertex_t, true>(
+        *handle_,
+        d_mg_transposed_graph_vertex_ids.data(),
+        d_mg_transposed_graph_vertex_ids.size(),
+        (*d_mg_renumber_map_labels).data(),
+        mg_graph.view().local_vertex_partition_range_first(),
+        mg_graph.view().local_vertex_partition_range_last());
+    }
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG construct_graph took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    auto mg_graph_view = mg_graph.view();
+    auto num_vertices  = mg_graph_view.number_of_vertices();
+
+    // 2. pairs: each GPU submits its own pairs (the sources and targets need not be local), the
+    // sources of all the GPUs are spread over the vertex range and each target is half the range
+    // away
+
+    std::vector<vertex_t> h_mg_sources(p2p_usecase.num_pairs_per_gpu);
+    std::vector<vertex_t> h_mg_targets(h_mg_sources.size());
+    for (size_t i = 0; i < h_mg_sources.size(); ++i) {
+      auto idx        = i * static_cast<size_t>(comm_size) + static_cast<size_t>(comm_rank);
+      h_mg_sources[i] = static_cast<vertex_t>((static_cast<size_t>(num_vertices) * idx) /
+                                              (h_mg_sources.size() * comm_size));
+      h_mg_targets[i] =
+        static_cast<vertex_t>((h_mg_sources[i] + num_vertices / 2 + idx) % num_vertices);
+      if (h_mg_targets[i] == h_mg_sources[i]) {
+        h_mg_targets[i] = (h_mg_sources[i] + 1) % num_vertices;
+      }
+    }
+    rmm::device_uvector<vertex_t> d_mg_sources(h_mg_sources.size(), handle_->get_stream());
+    rmm::device_uvector<vertex_t> d_mg_targets(h_mg_targets.size(), handle_->get_stream());
+    raft::update_device(
+      d_mg_sources.data(), h_mg_sources.data(), h_mg_sources.size(), handle_->get_stream());
+    raft::update_device(
+      d_mg_targets.data(), h_mg_targets.data(), h_mg_targets.size(), handle_->get_stream());
+
+    // 3. heuristics: a landmark (ALT) heuristic, admissible by the triangle inequality: dist(v, t)
+    // >= dist(L, t) - dist(L, v) for the landmark L (the vertex with the median ID)
+
+    auto d_all_targets =
+      cugraph::test::device_allgatherv(*handle_, d_mg_targets.data(), d_mg_targets.size());
+    auto h_heuristic_targets = cugraph::test::to_host(*handle_, d_all_targets);
+    std::sort(h_heuristic_targets.begin(), h_heuristic_targets.end());
+    h_heuristic_targets.erase(
+      std::unique(h_heuristic_targets.begin(), h_heuristic_targets.end()),
+      h_heuristic_targets.end());
+    rmm::device_uvector<vertex_t> d_heuristic_targets(h_heuristic_targets.size(),
+                                                      handle_->get_stream());
+    raft::update_device(d_heuristic_targets.data(),
+                        h_heuristic_targets.data(),
+                        h_heuristic_targets.size(),
+                        handle_->get_stream());
+
+    rmm::device_uvector<weight_t> d_mg_heuristics(0, handle_->get_stream());
+    if (p2p_usecase.heuristic != P2PHeuristic::none) {
+      rmm::device_uvector<weight_t> d_mg_landmark_distances(
+        mg_graph_view.local_vertex_partition_range_size(), handle_->get_stream());
+      rmm::device_uvector<vertex_t> d_mg_landmark_predecessors(
+        mg_graph_view.local_vertex_partition_range_size(), handle_->get_stream());
+      cugraph::sssp(*handle_,
+                    mg_graph_view,
+                    d_mg_landmark_distances.data(),
+                    d_mg_landmark_predecessors.data(),
+                    num_vertices / 2);
+      // the local vertex partition ranges are ordered by rank, so the gathered distances are in
+      // vertex ID order
+      auto h_landmark_distances = cugraph::test::to_host(
+        *handle_,
+        cugraph::test::device_allgatherv(
+          *handle_, d_mg_landmark_distances.data(), d_mg_landmark_distances.size()));
+
+      auto heuristic = [&h_landmark_distances](vertex_t v, vertex_t t) {
+        auto constexpr infinity = std::numeric_limits<weight_t>::max();
+        if ((h_landmark_distances[v] == infinity) || (h_landmark_distances[t] == infinity)) {
+          return weight_t{0.0};
+        }
+        return std::max(h_landmark_distances[t] - h_landmark_distances[v], weight_t{0.0});
+      };
+
+      auto v_first    = mg_graph_view.local_vertex_partition_range_first();
+      auto local_size = static_cast<size_t>(mg_graph_view.local_vertex_partition_range_size());
+      std::vector<weight_t> h_mg_heuristics{};
+      if (p2p_usecase.heuristic == P2PHeuristic::per_vertex) {
+        // admissible toward every target submitted by any GPU
+        h_mg_heuristics.assign(local_size, std::numeric_limits<weight_t>::max());
+        for (size_t i = 0; i < local_size; ++i) {
+          for (auto t : h_heuristic_targets) {
+            h_mg_heuristics[i] =
+              std::min(h_mg_heuristics[i], heuristic(v_first + static_cast<vertex_t>(i), t));
+          }
+        }
+      } else {
+        h_mg_heuristics.resize(h_heuristic_targets.size() * local_size);
+        for (size_t j = 0; j < h_heuristic_targets.size(); ++j) {
+          for (size_t i = 0; i < local_size; ++i) {
+            h_mg_heuristics[j * local_size + i] =
+              heuristic(v_first + static_cast<vertex_t>(i), h_heuristic_targets[j]);
+          }
+        }
+      }
+      d_mg_heuristics.resize(h_mg_heuristics.size(), handle_->get_stream());
+      raft::update_device(d_mg_heuristics.data(),
+                          h_mg_heuristics.data(),
+                          h_mg_heuristics.size(),
+                          handle_->get_stream());
+    }
+
+    // 4. run MG point_to_point_shortest_paths
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      hr_clock.start();
+    }
+
+    auto per_vertex_heuristics = p2p_usecase.heuristic == P2PHeuristic::per_vertex
+                                   ? std::make_optional<weight_t const*>(d_mg_heuristics.data())
+                                   : std::nullopt;
+    rmm::device_uvector<size_t> d_mg_path_offsets(0, handle_->get_stream());
+    rmm::device_uvector<vertex_t> d_mg_path_vertices(0, handle_->get_stream());
+    rmm::device_uvector<weight_t> d_mg_path_distances(0, handle_->get_stream());
+    if (p2p_usecase.bidirectional) {
+      std::tie(d_mg_path_offsets, d_mg_path_vertices, d_mg_path_distances) =
+        cugraph::point_to_point_shortest_paths(
+          *handle_,
+          mg_graph_view,
+          (*mg_transposed_graph).view(),
+          raft::device_span<vertex_t const>(d_mg_transposed_graph_vertex_ids.data(),
+                                            d_mg_transposed_graph_vertex_ids.size()),
+          raft::device_span<vertex_t const>(d_mg_sources.data(), d_mg_sources.size()),
+          raft::device_span<vertex_t const>(d_mg_targets.data(), d_mg_targets.size()),
+          per_vertex_heuristics,
+          std::numeric_limits<weight_t>::max(),
+          true);
+    } else if (p2p_usecase.heuristic == P2PHeuristic::per_target) {
+      std::tie(d_mg_path_offsets, d_mg_path_vertices, d_mg_path_distances) =
+        cugraph::point_to_point_shortest_paths(
+          *handle_,
+          mg_graph_view,
+          raft::device_span<vertex_t const>(d_mg_sources.data(), d_mg_sources.size()),
+          raft::device_span<vertex_t const>(d_mg_targets.data(), d_mg_targets.size()),
+          raft::device_span<vertex_t const>(d_heuristic_targets.data(),
+                                            d_heuristic_targets.size()),
+          raft::device_span<weight_t const>(d_mg_heuristics.data(), d_mg_heuristics.size()),
+          std::numeric_limits<weight_t>::max(),
+          true);
+    } else {
+      std::tie(d_mg_path_offsets, d_mg_path_vertices, d_mg_path_distances) =
+        cugraph::point_to_point_shortest_paths(
+          *handle_,
+          mg_graph_view,
+          raft::device_span<vertex_t const>(d_mg_sources.data(), d_mg_sources.size()),
+          raft::device_span<vertex_t const>(d_mg_targets.data(), d_mg_targets.size()),
+          per_vertex_heuristics,
+          std::numeric_limits<weight_t>::max(),
+          true);
+    }
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      handle_->get_comms().barrier();
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "MG point_to_point_shortest_paths took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    // 5. compare the path distances with SG SSSP and check the path edges
+
+    if (p2p_usecase.check_correctness) {
+      // 5-1. aggregate the pairs, the paths and the MG graph's edges (in internal vertex IDs)
+
+      auto h_mg_path_offsets =
+        cugraph::test::to_host(*handle_, d_mg_path_offsets.data(), d_mg_path_offsets.size());
+      ASSERT_EQ(h_mg_path_offsets.size(), h_mg_sources.size() + 1);
+      std::vector<size_t> h_mg_path_sizes(h_mg_sources.size());
+      for (size_t i = 0; i < h_mg_path_sizes.size(); ++i) {
+        h_mg_path_sizes[i] = h_mg_path_offsets[i + 1] - h_mg_path_offsets[i];
+      }
+      rmm::device_uvector<size_t> d_mg_path_sizes(h_mg_path_sizes.size(), handle_->get_stream());
+      raft::update_device(d_mg_path_sizes.data(),
+                          h_mg_path_sizes.data(),
+                          h_mg_path_sizes.size(),
+                          handle_->get_stream());
+
+      auto d_mg_aggregate_sources =
+        cugraph::test::device_gatherv(*handle_, d_mg_sources.data(), d_mg_sources.size());
+      auto d_mg_aggregate_targets =
+        cugraph::test::device_gatherv(*handle_, d_mg_targets.data(), d_mg_targets.size());
+      auto d_mg_aggregate_path_sizes =
+        cugraph::test::device_gatherv(*handle_, d_mg_path_sizes.data(), d_mg_path_sizes.size());
+      auto d_mg_aggregate_path_vertices = cugraph::test::device_gatherv(
+        *handle_, d_mg_path_vertices.data(), d_mg_path_vertices.size());
+      auto d_mg_aggregate_path_distances = cugraph::test::device_gatherv(
+        *handle_, d_mg_path_distances.data(), d_mg_path_distances.size());
+
+      auto [d_mg_srcs, d_mg_dsts, d_mg_weights] =
+        mg_graph_view.decompress_to_edgelist(*handle_, std::nullopt);
+
+      auto d_mg_aggregate_srcs =
+        cugraph::test::device_gatherv(*handle_, d_mg_srcs.data(), d_mg_srcs.size());
+      auto d_mg_aggregate_dsts =
+        cugraph::test::device_gatherv(*handle_, d_mg_dsts.data(), d_mg_dsts.size());
+      auto d_mg_aggregate_weights =
+        cugraph::test::device_gatherv(*handle_, (*d_mg_weights).data(), (*d_mg_weights).size());
+
+      if (comm_rank == int{0}) {
+        // 5-2. create SG graph with the MG graph's vertex IDs
+
+        rmm::device_uvector<vertex_t> d_sg_vertices(num_vertices, handle_->get_stream());
+        thrust::sequence(handle_->get_thrust_policy(),
+                         d_sg_vertices.begin(),
+                         d_sg_vertices.end(),
+                         vertex_t{0});
+
+        cugraph::graph_t<vertex_t, edge_t, weight_t, false, false> sg_graph(*handle_);
+        std::tie(sg_graph, std::ignore) =
+          cugraph::create_graph_from_edgelist<vertex_t, edge_t, weight_t, false, false>(
+            *handle_,
+            std::make_optional(std::move(d_sg_vertices)),
+            std::move(d_mg_aggregate_srcs),
+            std::move(d_mg_aggregate_dsts),
+            std::make_optional(std::move(d_mg_aggregate_weights)),
+            cugraph::graph_properties_t{mg_graph_view.is_symmetric(),
+                                        mg_graph_view.is_multigraph()},
+            false);
+
+        auto sg_graph_view = sg_graph.view();
+
+        ASSERT_EQ(num_vertices, sg_graph_view.number_of_vertices());
+
+        auto h_sg_offsets = cugraph::test::to_host(
+          *handle_, sg_graph_view.local_edge_partition_view().offsets(), num_vertices + 1);
+        auto h_sg_indices =
+          cugraph::test::to_host(*handle_,
+                                 sg_graph_view.local_edge_partition_view().indices(),
+                                 sg_graph_view.number_of_edges());
+        auto h_sg_weights =
+          cugraph::test::to_host(*handle_,
+                                 *(sg_graph_view.local_edge_partition_view().weights()),
+                                 sg_graph_view.number_of_edges());
+
+        auto h_sources        = cugraph::test::to_host(*handle_, d_mg_aggregate_sources);
+        auto h_targets        = cugraph::test::to_host(*handle_, d_mg_aggregate_targets);
+        auto h_path_sizes     = cugraph::test::to_host(*handle_, d_mg_aggregate_path_sizes);
+        auto h_path_vertices  = cugraph::test::to_host(*handle_, d_mg_aggregate_path_vertices);
+        auto h_path_distances = cugraph::test::to_host(*handle_, d_mg_aggregate_path_distances);
+        ASSERT_EQ(h_sources.size(), p2p_usecase.num_pairs_per_gpu * comm_size);
+
+        // 5-3. run SG SSSP from every source and check the paths
+
+        auto nearly_equal = [](weight_t lhs, weight_t rhs) {
+          return std::fabs(lhs - rhs) <= std::max(std::fabs(lhs), std::fabs(rhs)) * weight_t{1e-4};
+        };
+
+        rmm::device_uvector<weight_t> d_sg_distances(num_vertices, handle_->get_stream());
+        rmm::device_uvector<vertex_t> d_sg_predecessors(num_vertices, handle_->get_stream());
+        std::map<vertex_t, std::vector<weight_t>> h_sg_distances{};
+        size_t path_offset{0};
+        for (size_t i = 0; i < h_sources.size(); ++i) {
+          auto source = h_sources[i];
+          auto target = h_targets[i];
+          if (h_sg_distances.find(source) == h_sg_distances.end()) {
+            cugraph::sssp(*handle_,
+                          sg_graph_view,
+                          d_sg_distances.data(),
+                          d_sg_predecessors.data(),
+                          source,
+                          std::numeric_limits<weight_t>::max());
+            h_sg_distances[source] =
+              cugraph::test::to_host(*handle_, d_sg_distances.data(), d_sg_distances.size());
+          }
+          auto const& h_sssp_distances = h_sg_distances[source];
+
+          auto first = path_offset;
+          auto last  = path_offset + h_path_sizes[i];
+          path_offset += h_path_sizes[i];
+          if (h_sssp_distances[target] == std::numeric_limits<weight_t>::max()) {
+            ASSERT_EQ(first, last) << "source " << source << ", target " << target
+                                   << ": a path to an unreachable target.";
+            continue;
+          }
+          ASSERT_TRUE(first < last) << "source " << source << ", target " << target
+                                    << ": no path.";
+          ASSERT_EQ(h_path_vertices[first], source);
+          ASSERT_EQ(h_path_vertices[last - 1], target);
+          ASSERT_EQ(h_path_distances[first], weight_t{0.0});
+          ASSERT_TRUE(nearly_equal(h_path_distances[last - 1], h_sssp_distances[target]))
+            << "source " << source << ", target " << target << ": path distance "
+            << h_path_distances[last - 1] << " does not match the SSSP distance "
+            << h_sssp_distances[target] << ".";
+          for (auto j = first; j + 1 < last; ++j) {
+            auto u     = h_path_vertices[j];
+            auto v     = h_path_vertices[j + 1];
+            bool found = false;
+            for (auto k = h_sg_offsets[u]; k < h_sg_offsets[u + 1]; ++k) {
+              if ((h_sg_indices[k] == v) &&
+                  nearly_equal(h_path_distances[j] + h_sg_weights[k], h_path_distances[j + 1])) {
+                found = true;
+                break;
+              }
+            }
+            ASSERT_TRUE(found) << "source " << source << ", target " << target
+                               << ": no input edge with the matching weight between path vertices "
+                               << u << " and " << v << ".";
+          }
+        }
+        ASSERT_EQ(path_offset, h_path_vertices.size());
+      }
+    }
+  }
+
+ private:
+  static std::unique_ptr<raft::handle_t> handle_;
+};
+
+template <typename input_usecase_t>
+std::unique_ptr<raft::handle_t> Tests_MGPointToPointShortestPaths<input_usecase_t>::handle_ =
+  nullptr;
+
+using Tests_MGPointToPointShortestPaths_File =
+  Tests_MGPointToPointShortestPaths<cugraph::test::File_Usecase>;
+using Tests_MGPointToPointShortestPaths_Rmat =
+  Tests_MGPointToPointShortestPaths<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_MGPointToPointShortestPaths_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_MGPointToPointShortestPaths_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGPointToPointShortestPaths_Rmat, CheckInt32Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_MGPointToPointShortestPaths_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_tests,
+  Tests_MGPointToPointShortestPaths_File,
+  // enable correctness checks
+  ::testing::Combine(
+    ::testing::Values(PointToPointShortestPaths_Usecase{8, false, P2PHeuristic::none},
+                      PointToPointShortestPaths_Usecase{8, false, P2PHeuristic::per_vertex},
+                      PointToPointShortestPaths_Usecase{8, false, P2PHeuristic::per_target},
+                      PointToPointShortestPaths_Usecase{8, true, P2PHeuristic::none},
+                      PointToPointShortestPaths_Usecase{8, true, P2PHeuristic::per_vertex}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dblp.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/wiki2003.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_tests,
+  Tests_MGPointToPointShortestPaths_Rmat,
+  // enable correctness checks
+  ::testing::Combine(
+    ::testing::Values(PointToPointShortestPaths_Usecase{8, false, P2PHeuristic::none},
+                      PointToPointShortestPaths_Usecase{8, false, P2PHeuristic::per_vertex},
+                      PointToPointShortestPaths_Usecase{8, false, P2PHeuristic::per_target},
+                      PointToPointShortestPaths_Usecase{8, true, P2PHeuristic::none},
+                      PointToPointShortestPaths_Usecase{8, true, P2PHeuristic::per_vertex}),
+    ::testing::Values(
+      cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_MGPointToPointShortestPaths_Rmat,
+  // disable correctness checks for large graphs
+  ::testing::Combine(
+    ::testing::Values(PointToPointShortestPaths_Usecase{32, false, P2PHeuristic::none, false},
+                      PointToPointShortestPaths_Usecase{32, true, P2PHeuristic::none, false}),
+    ::testing::Values(
+      cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false, 0, true))));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
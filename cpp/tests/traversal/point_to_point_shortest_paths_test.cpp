@@ -0,0 +1,396 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/high_res_clock.h>
+#include <utilities/test_graphs.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <cugraph/algorithms.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/sequence.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <optional>
+#include <vector>
+
+enum class P2PHeuristic { none, per_vertex, per_target };
+
+struct PointToPointShortestPaths_Usecase {
+  size_t num_pairs{16};
+  bool bidirectional{false};
+  P2PHeuristic heuristic{P2PHeuristic::none};
+  bool check_correctness{true};
+};
+
+namespace {
+
+// A landmark (ALT) heuristic, admissible by the triangle inequality: dist(v, t) >= dist(L, t) -
+// dist(L, v) for a landmark L (0 if either distance is infinite).
+template <typename weight_t>
+weight_t landmark_heuristic(std::vector<weight_t> const& h_landmark_distances,
+                            size_t v,
+                            size_t t)
+{
+  auto constexpr infinity = std::numeric_limits<weight_t>::max();
+  if ((h_landmark_distances[v] == infinity) || (h_landmark_distances[t] == infinity)) {
+    return weight_t{0.0};
+  }
+  return std::max(h_landmark_distances[t] - h_landmark_distances[v], weight_t{0.0});
+}
+
+// the path of every pair should start at the source and end at the target (and be empty iff the
+// target is unreachable), consecutive path vertices should be connected by an input edge with the
+// weight matching the difference of the path distances, and the last path distance should be the
+// SSSP distance
+template <typename vertex_t, typename edge_t, typename weight_t>
+void check_paths(std::vector<edge_t> const& h_offsets,
+                 std::vector<vertex_t> const& h_indices,
+                 std::vector<weight_t> const& h_weights,
+                 vertex_t source,
+                 vertex_t target,
+                 std::vector<weight_t> const& h_sssp_distances,
+                 vertex_t const* path_vertex_first,
+                 weight_t const* path_distance_first,
+                 size_t path_size)
+{
+  auto nearly_equal = [](weight_t lhs, weight_t rhs) {
+    return std::fabs(lhs - rhs) <= std::max(std::fabs(lhs), std::fabs(rhs)) * weight_t{1e-4};
+  };
+
+  if (h_sssp_distances[target] == std::numeric_limits<weight_t>::max()) {
+    ASSERT_EQ(path_size, size_t{0}) << "source " << source << ", target " << target
+                                    << ": a path to an unreachable target.";
+    return;
+  }
+  ASSERT_TRUE(path_size > 0) << "source " << source << ", target " << target << ": no path.";
+  ASSERT_EQ(path_vertex_first[0], source);
+  ASSERT_EQ(path_vertex_first[path_size - 1], target);
+  ASSERT_EQ(path_distance_first[0], weight_t{0.0});
+  ASSERT_TRUE(nearly_equal(path_distance_first[path_size - 1], h_sssp_distances[target]))
+    << "source " << source << ", target " << target << ": path distance "
+    << path_distance_first[path_size - 1] << " does not match the SSSP distance "
+    << h_sssp_distances[target] << ".";
+  for (size_t i = 0; i + 1 < path_size; ++i) {
+    auto u     = path_vertex_first[i];
+    auto v     = path_vertex_first[i + 1];
+    bool found = false;
+    for (auto j = h_offsets[u]; j < h_offsets[u + 1]; ++j) {
+      if ((h_indices[j] == v) &&
+          nearly_equal(path_distance_first[i] + h_weights[j], path_distance_first[i + 1])) {
+        found = true;
+        break;
+      }
+    }
+    ASSERT_TRUE(found) << "source " << source << ", target " << target
+                       << ": no input edge with the matching weight between path vertices " << u
+                       << " and " << v << ".";
+  }
+}
+
+}  // namespace
+
+template <typename input_usecase_t>
+class Tests_PointToPointShortestPaths
+  : public ::testing::TestWithParam<
+      std::tuple<PointToPointShortestPaths_Usecase, input_usecase_t>> {
+ public:
+  Tests_PointToPointShortestPaths() {}
+
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(PointToPointShortestPaths_Usecase const& p2p_usecase,
+                        input_usecase_t const& input_usecase)
+  {
+    raft::handle_t handle{};
+    HighResClock hr_clock{};
+
+    // 1. create the graph (and its transposed copy with the same vertex IDs for the bidirectional
+    // search)
+
+    auto [graph, d_renumber_map_labels] =
+      cugraph::test::construct_graph<vertex_t, edge_t, weight_t, false, false>(
+        handle, input_usecase, true, false);
+    auto graph_view   = graph.view();
+    auto num_vertices = graph_view.number_of_vertices();
+
+    std::optional<cugraph::graph_t<vertex_t, edge_t, weight_t, true, false>> transposed_graph{
+      std::nullopt};
+    rmm::device_uvector<vertex_t> d_transposed_graph_vertex_ids(0, handle.get_stream());
+    if (p2p_usecase.bidirectional) {
+      std::tie(transposed_graph, std::ignore) =
+        cugraph::test::construct_graph<vertex_t, edge_t, weight_t, true, false>(
+          handle, input_usecase, true, false);
+      d_transposed_graph_vertex_ids.resize(num_vertices, handle.get_stream());
+      thrust::sequence(handle.get_thrust_policy(),
+                       d_transposed_graph_vertex_ids.begin(),
+                       d_transposed_graph_vertex_ids.end(),
+                       vertex_t{0});
+    }
+
+    // 2. pairs: sources spread over the vertex range, each target half the range away
+
+    std::vector<vertex_t> h_sources(p2p_usecase.num_pairs);
+    std::vector<vertex_t> h_targets(h_sources.size());
+    for (size_t i = 0; i < h_sources.size(); ++i) {
+      h_sources[i] = static_cast<vertex_t>((static_cast<size_t>(num_vertices) * i) /
+                                           p2p_usecase.num_pairs);
+      h_targets[i] =
+        static_cast<vertex_t>((h_sources[i] + num_vertices / 2 + i) % num_vertices);
+      if (h_targets[i] == h_sources[i]) { h_targets[i] = (h_sources[i] + 1) % num_vertices; }
+    }
+    rmm::device_uvector<vertex_t> d_sources(h_sources.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_targets(h_targets.size(), handle.get_stream());
+    raft::update_device(d_sources.data(), h_sources.data(), h_sources.size(), handle.get_stream());
+    raft::update_device(d_targets.data(), h_targets.data(), h_targets.size(), handle.get_stream());
+
+    // 3. heuristics (landmark: the vertex with the median ID)
+
+    std::vector<vertex_t> h_heuristic_targets(h_targets);
+    std::sort(h_heuristic_targets.begin(), h_heuristic_targets.end());
+    h_heuristic_targets.erase(
+      std::unique(h_heuristic_targets.begin(), h_heuristic_targets.end()),
+      h_heuristic_targets.end());
+    rmm::device_uvector<vertex_t> d_heuristic_targets(h_heuristic_targets.size(),
+                                                      handle.get_stream());
+    raft::update_device(d_heuristic_targets.data(),
+                        h_heuristic_targets.data(),
+                        h_heuristic_targets.size(),
+                        handle.get_stream());
+    rmm::device_uvector<weight_t> d_heuristics(0, handle.get_stream());
+    if (p2p_usecase.heuristic != P2PHeuristic::none) {
+      rmm::device_uvector<weight_t> d_landmark_distances(num_vertices, handle.get_stream());
+      rmm::device_uvector<vertex_t> d_landmark_predecessors(num_vertices, handle.get_stream());
+      cugraph::sssp(handle,
+                    graph_view,
+                    d_landmark_distances.data(),
+                    d_landmark_predecessors.data(),
+                    num_vertices / 2);
+      auto h_landmark_distances =
+        cugraph::test::to_host(handle, d_landmark_distances.data(), d_landmark_distances.size());
+
+      std::vector<weight_t> h_heuristics{};
+      if (p2p_usecase.heuristic == P2PHeuristic::per_vertex) {
+        // admissible toward every target in the batch
+        h_heuristics.assign(num_vertices, std::numeric_limits<weight_t>::max());
+        for (vertex_t v = 0; v < num_vertices; ++v) {
+          for (auto t : h_heuristic_targets) {
+            h_heuristics[v] =
+              std::min(h_heuristics[v], landmark_heuristic(h_landmark_distances, v, t));
+          }
+        }
+      } else {
+        h_heuristics.resize(h_heuristic_targets.size() * num_vertices);
+        for (size_t i = 0; i < h_heuristic_targets.size(); ++i) {
+          for (vertex_t v = 0; v < num_vertices; ++v) {
+            h_heuristics[i * num_vertices + v] =
+              landmark_heuristic(h_landmark_distances, v, h_heuristic_targets[i]);
+          }
+        }
+      }
+      d_heuristics.resize(h_heuristics.size(), handle.get_stream());
+      raft::update_device(
+        d_heuristics.data(), h_heuristics.data(), h_heuristics.size(), handle.get_stream());
+    }
+
+    // 4. run point_to_point_shortest_paths
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      hr_clock.start();
+    }
+
+    auto per_vertex_heuristics = p2p_usecase.heuristic == P2PHeuristic::per_vertex
+                                   ? std::make_optional<weight_t const*>(d_heuristics.data())
+                                   : std::nullopt;
+    rmm::device_uvector<size_t> d_path_offsets(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_path_vertices(0, handle.get_stream());
+    rmm::device_uvector<weight_t> d_path_distances(0, handle.get_stream());
+    if (p2p_usecase.bidirectional) {
+      std::tie(d_path_offsets, d_path_vertices, d_path_distances) =
+        cugraph::point_to_point_shortest_paths(
+          handle,
+          graph_view,
+          (*transposed_graph).view(),
+          raft::device_span<vertex_t const>(d_transposed_graph_vertex_ids.data(),
+                                            d_transposed_graph_vertex_ids.size()),
+          raft::device_span<vertex_t const>(d_sources.data(), d_sources.size()),
+          raft::device_span<vertex_t const>(d_targets.data(), d_targets.size()),
+          per_vertex_heuristics,
+          std::numeric_limits<weight_t>::max(),
+          true);
+    } else if (p2p_usecase.heuristic == P2PHeuristic::per_target) {
+      std::tie(d_path_offsets, d_path_vertices, d_path_distances) =
+        cugraph::point_to_point_shortest_paths(
+          handle,
+          graph_view,
+          raft::device_span<vertex_t const>(d_sources.data(), d_sources.size()),
+          raft::device_span<vertex_t const>(d_targets.data(), d_targets.size()),
+          raft::device_span<vertex_t const>(d_heuristic_targets.data(),
+                                            d_heuristic_targets.size()),
+          raft::device_span<weight_t const>(d_heuristics.data(), d_heuristics.size()),
+          std::numeric_limits<weight_t>::max(),
+          true);
+    } else {
+      std::tie(d_path_offsets, d_path_vertices, d_path_distances) =
+        cugraph::point_to_point_shortest_paths(
+          handle,
+          graph_view,
+          raft::device_span<vertex_t const>(d_sources.data(), d_sources.size()),
+          raft::device_span<vertex_t const>(d_targets.data(), d_targets.size()),
+          per_vertex_heuristics,
+          std::numeric_limits<weight_t>::max(),
+          true);
+    }
+
+    if (cugraph::test::g_perf) {
+      RAFT_CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+      double elapsed_time{0.0};
+      hr_clock.stop(&elapsed_time);
+      std::cout << "point_to_point_shortest_paths took " << elapsed_time * 1e-6 << " s.\n";
+    }
+
+    // 5. compare the path distances with SSSP and check the path edges
+
+    if (p2p_usecase.check_correctness) {
+      auto h_offsets = cugraph::test::to_host(
+        handle, graph_view.local_edge_partition_view().offsets(), num_vertices + 1);
+      auto h_indices = cugraph::test::to_host(
+        handle, graph_view.local_edge_partition_view().indices(), graph_view.number_of_edges());
+      auto h_weights = cugraph::test::to_host(
+        handle, *(graph_view.local_edge_partition_view().weights()), graph_view.number_of_edges());
+
+      auto h_path_offsets =
+        cugraph::test::to_host(handle, d_path_offsets.data(), d_path_offsets.size());
+      auto h_path_vertices =
+        cugraph::test::to_host(handle, d_path_vertices.data(), d_path_vertices.size());
+      auto h_path_distances =
+        cugraph::test::to_host(handle, d_path_distances.data(), d_path_distances.size());
+      ASSERT_EQ(h_path_offsets.size(), h_sources.size() + 1);
+
+      rmm::device_uvector<weight_t> d_sssp_distances(num_vertices, handle.get_stream());
+      rmm::device_uvector<vertex_t> d_sssp_predecessors(num_vertices, handle.get_stream());
+      std::map<vertex_t, std::vector<weight_t>> h_sssp_distances{};
+      for (size_t i = 0; i < h_sources.size(); ++i) {
+        if (h_sssp_distances.find(h_sources[i]) == h_sssp_distances.end()) {
+          cugraph::sssp(handle,
+                        graph_view,
+                        d_sssp_distances.data(),
+                        d_sssp_predecessors.data(),
+                        h_sources[i]);
+          h_sssp_distances[h_sources[i]] =
+            cugraph::test::to_host(handle, d_sssp_distances.data(), d_sssp_distances.size());
+        }
+        check_paths(h_offsets,
+                    h_indices,
+                    h_weights,
+                    h_sources[i],
+                    h_targets[i],
+                    h_sssp_distances[h_sources[i]],
+                    h_path_vertices.data() + h_path_offsets[i],
+                    h_path_distances.data() + h_path_offsets[i],
+                    h_path_offsets[i + 1] - h_path_offsets[i]);
+        if (::testing::Test::HasFatalFailure()) { return; }
+      }
+    }
+  }
+};
+
+using Tests_PointToPointShortestPaths_File =
+  Tests_PointToPointShortestPaths<cugraph::test::File_Usecase>;
+using Tests_PointToPointShortestPaths_Rmat =
+  Tests_PointToPointShortestPaths<cugraph::test::Rmat_Usecase>;
+
+TEST_P(Tests_PointToPointShortestPaths_File, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(std::get<0>(param), std::get<1>(param));
+}
+
+TEST_P(Tests_PointToPointShortestPaths_Rmat, CheckInt32Int32Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int32_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_PointToPointShortestPaths_Rmat, CheckInt32Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int32_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+TEST_P(Tests_PointToPointShortestPaths_Rmat, CheckInt64Int64Float)
+{
+  auto param = GetParam();
+  run_current_test<int64_t, int64_t, float>(
+    std::get<0>(param), override_Rmat_Usecase_with_cmd_line_arguments(std::get<1>(param)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  file_test,
+  Tests_PointToPointShortestPaths_File,
+  // enable correctness checks
+  ::testing::Combine(
+    ::testing::Values(PointToPointShortestPaths_Usecase{16, false, P2PHeuristic::none},
+                      PointToPointShortestPaths_Usecase{16, false, P2PHeuristic::per_vertex},
+                      PointToPointShortestPaths_Usecase{16, false, P2PHeuristic::per_target},
+                      PointToPointShortestPaths_Usecase{16, true, P2PHeuristic::none},
+                      PointToPointShortestPaths_Usecase{16, true, P2PHeuristic::per_vertex}),
+    ::testing::Values(cugraph::test::File_Usecase("test/datasets/karate.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/dblp.mtx"),
+                      cugraph::test::File_Usecase("test/datasets/wiki2003.mtx"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_small_test,
+  Tests_PointToPointShortestPaths_Rmat,
+  // enable correctness checks
+  ::testing::Combine(
+    ::testing::Values(PointToPointShortestPaths_Usecase{16, false, P2PHeuristic::none},
+                      PointToPointShortestPaths_Usecase{16, false, P2PHeuristic::per_vertex},
+                      PointToPointShortestPaths_Usecase{16, false, P2PHeuristic::per_target},
+                      PointToPointShortestPaths_Usecase{16, true, P2PHeuristic::none},
+                      PointToPointShortestPaths_Usecase{16, true, P2PHeuristic::per_vertex}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(10, 16, 0.57, 0.19, 0.19, 0, false, false))));
+
+INSTANTIATE_TEST_SUITE_P(
+  rmat_benchmark_test, /* note that scale & edge factor can be overridden in benchmarking (with
+                          --gtest_filter to select only the rmat_benchmark_test with a specific
+                          vertex & edge type combination) by command line arguments and do not
+                          include more than one Rmat_Usecase that differ only in scale or edge
+                          factor (to avoid running same benchmarks more than once) */
+  Tests_PointToPointShortestPaths_Rmat,
+  // disable correctness checks for large graphs
+  ::testing::Combine(
+    ::testing::Values(PointToPointShortestPaths_Usecase{64, false, P2PHeuristic::none, false},
+                      PointToPointShortestPaths_Usecase{64, true, P2PHeuristic::none, false}),
+    ::testing::Values(cugraph::test::Rmat_Usecase(20, 32, 0.57, 0.19, 0.19, 0, false, false))));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
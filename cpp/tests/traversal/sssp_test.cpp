@@ -25,6 +25,9 @@
 #include <cugraph/graph_functions.hpp>
 #include <cugraph/graph_view.hpp>
 
+#include <traversal/host_sssp_impl.hpp>
+#include <utilities/host_numa_utils.hpp>
+
 #include <raft/cudart_utils.h>
 #include <raft/handle.hpp>
 #include <rmm/device_uvector.hpp>
@@ -203,6 +206,101 @@ class Tests_SSSP : public ::testing::TestWithParam<std::tuple<SSSP_Usecase, inpu
                      unrenumbered_source,
                      std::numeric_limits<weight_t>::max());
 
+      auto max_weight_element = std::max_element(h_weights.begin(), h_weights.end());
+      auto epsilon            = *max_weight_element * weight_t{1e-6};
+      auto nearly_equal = [epsilon](auto lhs, auto rhs) { return std::fabs(lhs - rhs) < epsilon; };
+
+      // host SSSP, both on the graph view and on the host CSR, the output does not depend on the
+      // number of threads
+
+      rmm::device_uvector<weight_t> d_host_distances(unrenumbered_graph_view.number_of_vertices(),
+                                                     handle.get_stream());
+      rmm::device_uvector<vertex_t> d_host_predecessors(
+        unrenumbered_graph_view.number_of_vertices(), handle.get_stream());
+      cugraph::host_sssp(handle,
+                         unrenumbered_graph_view,
+                         d_host_distances.data(),
+                         d_host_predecessors.data(),
+                         unrenumbered_source,
+                         std::numeric_limits<weight_t>::max(),
+                         size_t{4},
+                         true,
+                         false);
+      auto h_host_distances =
+        cugraph::test::to_host(handle, d_host_distances.data(), d_host_distances.size());
+      auto h_host_predecessors =
+        cugraph::test::to_host(handle, d_host_predecessors.data(), d_host_predecessors.size());
+
+      std::vector<weight_t> h_host_csr_distances(unrenumbered_graph_view.number_of_vertices());
+      std::vector<vertex_t> h_host_csr_predecessors(unrenumbered_graph_view.number_of_vertices());
+      cugraph::host_sssp(raft::host_span<edge_t const>(h_offsets.data(), h_offsets.size()),
+                         raft::host_span<vertex_t const>(h_indices.data(), h_indices.size()),
+                         raft::host_span<weight_t const>(h_weights.data(), h_weights.size()),
+                         h_host_csr_distances.data(),
+                         h_host_csr_predecessors.data(),
+                         unrenumbered_source,
+                         std::numeric_limits<weight_t>::max(),
+                         size_t{3},
+                         false,
+                         true);
+
+      ASSERT_TRUE(h_host_csr_distances == h_host_distances)
+        << "host SSSP distances depend on the input format or the number of threads.";
+      ASSERT_TRUE(h_host_csr_predecessors == h_host_predecessors)
+        << "host SSSP predecessors depend on the input format or the number of threads.";
+
+      // the NUMA-aware path (pinning, per-node first touch, node-local stealing) only runs on hosts
+      // with more than one NUMA node, run it on a two-node topology made of the CPUs this thread
+      // may run on
+
+      auto cpus = cugraph::detail::host_this_thread_cpus();
+      if (!cpus.empty()) {
+        auto half = std::max(cpus.size() / 2, size_t{1});
+        std::vector<std::vector<int>> node_cpus{std::vector<int>(cpus.begin(), cpus.begin() + half),
+                                                std::vector<int>(cpus.end() - half, cpus.end())};
+        std::vector<weight_t> h_numa_distances(unrenumbered_graph_view.number_of_vertices());
+        std::vector<vertex_t> h_numa_predecessors(unrenumbered_graph_view.number_of_vertices());
+        cugraph::detail::host_sssp(h_offsets.data(),
+                                   h_indices.data(),
+                                   h_weights.data(),
+                                   unrenumbered_graph_view.number_of_vertices(),
+                                   h_numa_distances.data(),
+                                   h_numa_predecessors.data(),
+                                   unrenumbered_source,
+                                   std::numeric_limits<weight_t>::max(),
+                                   size_t{5},
+                                   node_cpus);
+
+        ASSERT_TRUE(h_numa_distances == h_host_distances)
+          << "host SSSP distances depend on the NUMA placement of the threads.";
+        ASSERT_TRUE(h_numa_predecessors == h_host_predecessors)
+          << "host SSSP predecessors depend on the NUMA placement of the threads.";
+      }
+      ASSERT_TRUE(std::equal(h_reference_distances.begin(),
+                             h_reference_distances.end(),
+                             h_host_distances.begin(),
+                             nearly_equal))
+        << "host SSSP distances do not match with the reference values.";
+      for (vertex_t i = 0; i < unrenumbered_graph_view.number_of_vertices(); ++i) {
+        auto pred = h_host_predecessors[i];
+        if (pred == cugraph::invalid_vertex_id<vertex_t>::value) {
+          ASSERT_TRUE(h_reference_predecessors[i] == pred)
+            << "host SSSP vertex reachability does not match with the reference.";
+        } else {
+          bool found{false};
+          for (auto j = h_offsets[pred]; j < h_offsets[pred + 1]; ++j) {
+            if ((h_indices[j] == i) &&
+                nearly_equal(h_reference_distances[pred] + h_weights[j],
+                             h_reference_distances[i])) {
+              found = true;
+              break;
+            }
+          }
+          ASSERT_TRUE(found) << "host SSSP: no edge from the predecessor vertex to this vertex "
+                                "with the matching weight.";
+        }
+      }
+
       std::vector<weight_t> h_cugraph_distances(graph_view.number_of_vertices());
       std::vector<vertex_t> h_cugraph_predecessors(graph_view.number_of_vertices());
       if (renumber) {
@@ -242,10 +340,6 @@ class Tests_SSSP : public ::testing::TestWithParam<std::tuple<SSSP_Usecase, inpu
         handle.sync_stream();
       }
 
-      auto max_weight_element = std::max_element(h_weights.begin(), h_weights.end());
-      auto epsilon            = *max_weight_element * weight_t{1e-6};
-      auto nearly_equal = [epsilon](auto lhs, auto rhs) { return std::fabs(lhs - rhs) < epsilon; };
-
       ASSERT_TRUE(std::equal(h_reference_distances.begin(),
                              h_reference_distances.end(),
                              h_cugraph_distances.begin(),